@@ -44,6 +44,9 @@ SOFTWARE.
 #include "functional.h"
 #include "utility.h"
 #include "gcd.h"
+#include "static_assert.h"
+
+#include "private/algorithm_simd.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -82,8 +85,60 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  ETL_CONSTEXPR14 void heap_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14 void heap_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare);
 }
 
+//*****************************************************************************
+// Block-at-a-time find, count, equal and mismatch for contiguous ranges.
+// In C++14 and above the overloads are constexpr, so they are only enabled
+// if the compiler can tell when it is evaluating at compile time.
+// Define ETL_ALGORITHM_USING_SIMD as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_ALGORITHM_USING_SIMD)
+  #if ETL_USING_CPP14 && !ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+    #define ETL_ALGORITHM_USING_SIMD 0
+  #else
+    #define ETL_ALGORITHM_USING_SIMD 1
+  #endif
+#endif
+
+//*****************************************************************************
+// copy, move and fill between pointers to trivially copyable types use
+// memmove and memset, where the STL's algorithms are not used.
+// Define ETL_MEMCPY, ETL_MEMMOVE or ETL_MEMSET to replace the library function
+// with one of the same signature, such as one that uses DMA.
+// In C++14 and above the algorithms are constexpr, so the library functions
+// are only used if the compiler can tell when it is evaluating at compile time.
+// Define ETL_ALGORITHM_USING_MEM_FUNCTIONS as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_ALGORITHM_USING_MEM_FUNCTIONS)
+  #if (ETL_USING_STL && ETL_USING_CPP20) || (ETL_USING_CPP14 && !ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+    #define ETL_ALGORITHM_USING_MEM_FUNCTIONS 0
+  #else
+    #define ETL_ALGORITHM_USING_MEM_FUNCTIONS 1
+  #endif
+#endif
+
+#if !defined(ETL_MEMCPY)
+  #define ETL_MEMCPY memcpy
+#endif
+
+#if !defined(ETL_MEMMOVE)
+  #define ETL_MEMMOVE memmove
+#endif
+
+#if !defined(ETL_MEMSET)
+  #define ETL_MEMSET memset
+#endif
+
 //*****************************************************************************
 // Algorithms defined by the ETL
 //*****************************************************************************
@@ -91,6 +146,90 @@ namespace etl
 {
   namespace private_algorithm
   {
+#if ETL_ALGORITHM_USING_SIMD || ETL_ALGORITHM_USING_MEM_FUNCTIONS
+    //***************************************************************************
+    /// Returns true when evaluated at compile time.
+    //***************************************************************************
+    inline ETL_CONSTEXPR bool is_constant_evaluated()
+    {
+  #if ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+      return __builtin_is_constant_evaluated();
+  #else
+      return false;
+  #endif
+    }
+#endif
+
+#if ETL_ALGORITHM_USING_MEM_FUNCTIONS
+    //***************************************************************************
+    /// A range of TSource may be copied to a range of TDestination by memmove.
+    //***************************************************************************
+    template <typename TSource, typename TDestination>
+    struct is_mem_copyable : etl::integral_constant<bool, etl::is_same<typename etl::remove_const<TSource>::type, TDestination>::value &&
+                                                          !etl::is_const<TDestination>::value &&
+                                                          !etl::is_volatile<TSource>::value &&
+                                                          !etl::is_volatile<TDestination>::value &&
+                                                          etl::is_trivially_copyable<TDestination>::value>
+    {
+    };
+
+    //***************************************************************************
+    /// A range of T may be filled by memset.
+    //***************************************************************************
+    template <typename T>
+    struct is_mem_settable : etl::integral_constant<bool, etl::is_integral<T>::value &&
+                                                          !etl::is_const<T>::value &&
+                                                          !etl::is_volatile<T>::value &&
+                                                          (sizeof(T) == 1U)>
+    {
+    };
+
+    //***************************************************************************
+    /// Copies n objects from sb to db, which may overlap.
+    //***************************************************************************
+    template <typename TSource, typename TDestination>
+    TDestination* mem_move(TSource* sb, size_t n, TDestination* db)
+    {
+      if (n != 0U)
+      {
+        ETL_MEMMOVE(static_cast<void*>(db), static_cast<const void*>(sb), n * sizeof(TDestination));
+      }
+
+      return db + n;
+    }
+
+    //***************************************************************************
+    /// Sets n bytes from db to value.
+    //***************************************************************************
+    template <typename T>
+    T* mem_set(T* db, size_t n, T value)
+    {
+      if (n != 0U)
+      {
+        ETL_MEMSET(static_cast<void*>(db), static_cast<unsigned char>(value), n);
+      }
+
+      return db + n;
+    }
+#endif
+
+#if ETL_ALGORITHM_USING_SIMD
+    //***************************************************************************
+    /// Ranges of T may be compared with TValue a block at a time.
+    /// Integral types of 8, 16 or 32 bits, excluding bool, compared with the same type.
+    //***************************************************************************
+    template <typename T, typename TValue>
+    struct is_simd_comparable : etl::integral_constant<bool, etl::is_integral<T>::value &&
+                                                             !etl::is_volatile<T>::value &&
+                                                             !etl::is_volatile<TValue>::value &&
+                                                             !etl::is_same<typename etl::remove_cv<T>::type, bool>::value &&
+                                                             etl::is_same<typename etl::remove_cv<T>::type, typename etl::remove_cv<TValue>::type>::value &&
+                                                             ((sizeof(T) == 1U) || (sizeof(T) == 2U) || (sizeof(T) == 4U))>
+    {
+    };
+
+#endif
+
     template <bool use_swap>
     struct swap_impl;
 
@@ -187,14 +326,18 @@ namespace etl
 #if ETL_USING_STL && ETL_USING_CPP20
   // Use the STL constexpr implementation.
   template <typename TIterator1, typename TIterator2>
-  constexpr TIterator2 copy(TIterator1 sb, TIterator1 se, TIterator2 db)
+  constexpr
+  typename etl::enable_if<!etl::is_segmented_iterator<TIterator1>::value, TIterator2>::type
+    copy(TIterator1 sb, TIterator1 se, TIterator2 db)
   {
     return std::copy(sb, se, db);
   }
 #else
   // Non-pointer or not trivially copyable or not using builtin memcpy.
   template <typename TIterator1, typename TIterator2>
-  ETL_CONSTEXPR14 TIterator2 copy(TIterator1 sb, TIterator1 se, TIterator2 db)
+  ETL_CONSTEXPR14
+  typename etl::enable_if<!etl::is_segmented_iterator<TIterator1>::value, TIterator2>::type
+    copy(TIterator1 sb, TIterator1 se, TIterator2 db)
   {
     while (sb != se)
     {
@@ -207,6 +350,52 @@ namespace etl
   }
 #endif
 
+  //***************************************************************************
+  /// copy
+  /// Segmented iterators are copied one contiguous segment at a time.
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2>
+  typename etl::enable_if<etl::is_segmented_iterator<TIterator1>::value, TIterator2>::type
+    copy(TIterator1 sb, TIterator1 se, TIterator2 db)
+  {
+    while (sb != se)
+    {
+      const size_t n = sb.segment_size(se);
+      typename TIterator1::segment_pointer p = sb.segment_begin();
+
+      db = etl::copy(p, p + n, db);
+      sb.segment_advance(n);
+    }
+
+    return db;
+  }
+
+#if ETL_ALGORITHM_USING_MEM_FUNCTIONS
+  //***************************************************************************
+  /// copy
+  /// Trivially copyable types are copied by memmove.
+  //***************************************************************************
+  template <typename TSource, typename TDestination>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_mem_copyable<TSource, TDestination>::value, TDestination*>::type
+    copy(TSource* sb, TSource* se, TDestination* db)
+  {
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      return private_algorithm::mem_move(sb, static_cast<size_t>(se - sb), db);
+    }
+
+    while (sb != se)
+    {
+      *db = *sb;
+      ++db;
+      ++sb;
+    }
+
+    return db;
+  }
+#endif
+
   //***************************************************************************
   // reverse_copy
 #if ETL_USING_STL && ETL_USING_CPP20
@@ -256,6 +445,33 @@ namespace etl
   }
 #endif
 
+#if ETL_ALGORITHM_USING_MEM_FUNCTIONS
+  //***************************************************************************
+  /// copy_n
+  /// Trivially copyable types are copied by memmove.
+  //***************************************************************************
+  template <typename TSource, typename TSize, typename TDestination>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_mem_copyable<TSource, TDestination>::value, TDestination*>::type
+    copy_n(TSource* sb, TSize count, TDestination* db)
+  {
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      return private_algorithm::mem_move(sb, static_cast<size_t>(count), db);
+    }
+
+    while (count != 0)
+    {
+      *db = *sb;
+      ++db;
+      ++sb;
+      --count;
+    }
+
+    return db;
+  }
+#endif
+
   //***************************************************************************
   // copy_backward
 #if ETL_USING_STL && ETL_USING_CPP20
@@ -277,6 +493,34 @@ namespace etl
   }
 #endif
 
+#if ETL_ALGORITHM_USING_MEM_FUNCTIONS
+  //***************************************************************************
+  /// copy_backward
+  /// Trivially copyable types are copied by memmove.
+  //***************************************************************************
+  template <typename TSource, typename TDestination>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_mem_copyable<TSource, TDestination>::value, TDestination*>::type
+    copy_backward(TSource* sb, TSource* se, TDestination* de)
+  {
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      const size_t n = static_cast<size_t>(se - sb);
+
+      private_algorithm::mem_move(sb, n, de - n);
+
+      return de - n;
+    }
+
+    while (se != sb)
+    {
+      *(--de) = *(--se);
+    }
+
+    return de;
+  }
+#endif
+
   //***************************************************************************
   // move
 #if ETL_USING_STL && ETL_USING_CPP20
@@ -299,12 +543,26 @@ namespace etl
 
     return db;
   }
+
+  #if ETL_ALGORITHM_USING_MEM_FUNCTIONS
+  //***************************************************************************
+  /// move
+  /// Trivially copyable types are moved by memmove.
+  //***************************************************************************
+  template <typename TSource, typename TDestination>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_mem_copyable<TSource, TDestination>::value, TDestination*>::type
+    move(TSource* sb, TSource* se, TDestination* db)
+  {
+    return etl::copy(sb, se, db);
+  }
+  #endif
 #else
   // For C++03
   template <typename TIterator1, typename TIterator2>
   ETL_CONSTEXPR14 TIterator2 move(TIterator1 sb, TIterator1 se, TIterator2 db)
   {
-    return copy(sb, se, db);
+    return etl::copy(sb, se, db);
   }
 #endif
 
@@ -328,6 +586,20 @@ namespace etl
 
     return de;
   }
+
+  #if ETL_ALGORITHM_USING_MEM_FUNCTIONS
+  //***************************************************************************
+  /// move_backward
+  /// Trivially copyable types are moved by memmove.
+  //***************************************************************************
+  template <typename TSource, typename TDestination>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_mem_copyable<TSource, TDestination>::value, TDestination*>::type
+    move_backward(TSource* sb, TSource* se, TDestination* de)
+  {
+    return etl::copy_backward(sb, se, de);
+  }
+  #endif
 #else
   // For C++03
   template <typename TIterator1, typename TIterator2>
@@ -497,6 +769,110 @@ namespace etl
     return binary_search(first, last, value, compare());
   }
 
+  //***************************************************************************
+  // branchless_lower_bound
+  // A lower_bound for random access iterators where the loop has a fixed
+  // number of iterations for a given length and the comparison result only
+  // selects the next base, allowing the compiler to use a conditional move.
+  //***************************************************************************
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator branchless_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length = last - first;
+
+    if (length == 0)
+    {
+      return first;
+    }
+
+    while (length > 1)
+    {
+      const difference_t half = length / 2;
+
+      first   = compare(first[half], value) ? first + half : first;
+      length -= half;
+    }
+
+    return first + (compare(*first, value) ? 1 : 0);
+  }
+
+  template<typename TIterator, typename TValue>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator branchless_lower_bound(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::branchless_lower_bound(first, last, value, compare());
+  }
+
+  //***************************************************************************
+  // branchless_upper_bound
+  // An upper_bound for random access iterators, in the same form as
+  // branchless_lower_bound.
+  //***************************************************************************
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator branchless_upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length = last - first;
+
+    if (length == 0)
+    {
+      return first;
+    }
+
+    while (length > 1)
+    {
+      const difference_t half = length / 2;
+
+      first   = !compare(value, first[half]) ? first + half : first;
+      length -= half;
+    }
+
+    return first + (!compare(value, *first) ? 1 : 0);
+  }
+
+  template<typename TIterator, typename TValue>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator branchless_upper_bound(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::branchless_upper_bound(first, last, value, compare());
+  }
+
+  //***************************************************************************
+  // branchless_binary_search
+  //***************************************************************************
+  template <typename TIterator, typename T, typename Compare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool branchless_binary_search(TIterator first, TIterator last, const T& value, Compare compare)
+  {
+    first = etl::branchless_lower_bound(first, last, value, compare);
+
+    return (!(first == last) && !(compare(value, *first)));
+  }
+
+  template <typename TIterator, typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool branchless_binary_search(TIterator first, TIterator last, const T& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::branchless_binary_search(first, last, value, compare());
+  }
+
   //***************************************************************************
   // find_if
   //***************************************************************************
@@ -539,6 +915,38 @@ namespace etl
     return last;
   }
 
+#if ETL_ALGORITHM_USING_SIMD
+  //***************************************************************************
+  /// find
+  /// Contiguous 8, 16 and 32 bit integral ranges are searched a block at a time.
+  //***************************************************************************
+  template <typename T, typename TValue>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_simd_comparable<T, TValue>::value, T*>::type
+    find(T* first, T* last, const TValue& value)
+  {
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      typedef typename private_algorithm::simd_lane<sizeof(T)>::type lane_t;
+
+      first += private_algorithm::simd_find(reinterpret_cast<const char*>(first), static_cast<size_t>(last - first), static_cast<lane_t>(value));
+    }
+
+    while (first != last)
+    {
+      if (*first == value)
+      {
+        return first;
+      }
+
+      ++first;
+    }
+
+    return last;
+  }
+#endif
+
   //***************************************************************************
   // fill
 #if ETL_USING_STL && ETL_USING_CPP20
@@ -559,6 +967,31 @@ namespace etl
   }
 #endif
 
+#if ETL_ALGORITHM_USING_MEM_FUNCTIONS
+  //***************************************************************************
+  /// fill
+  /// Byte sized integral types are filled by memset.
+  //***************************************************************************
+  template<typename T, typename TValue>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_mem_settable<T>::value, void>::type
+    fill(T* first, T* last, const TValue& value)
+  {
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      private_algorithm::mem_set(first, static_cast<size_t>(last - first), static_cast<T>(value));
+
+      return;
+    }
+
+    while (first != last)
+    {
+      *first = value;
+      ++first;
+    }
+  }
+#endif
+
   //***************************************************************************
   // fill_n
 #if ETL_USING_STL && ETL_USING_CPP20
@@ -581,15 +1014,76 @@ namespace etl
   }
 #endif
 
+#if ETL_ALGORITHM_USING_MEM_FUNCTIONS
+  //***************************************************************************
+  /// fill_n
+  /// Byte sized integral types are filled by memset.
+  //***************************************************************************
+  template<typename T, typename TSize, typename TValue>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_mem_settable<T>::value, T*>::type
+    fill_n(T* first, TSize count, const TValue& value)
+  {
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      return private_algorithm::mem_set(first, static_cast<size_t>(count), static_cast<T>(value));
+    }
+
+    while (count != 0)
+    {
+      *first++ = value;
+      --count;
+    }
+
+    return first;
+  }
+#endif
+
   //***************************************************************************
   // count
   //***************************************************************************
-  template <typename TIterator, typename T>
+  template <typename TIterator, typename T>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
+  {
+    typename iterator_traits<TIterator>::difference_type n = 0;
+
+    while (first != last)
+    {
+      if (*first == value)
+      {
+        ++n;
+      }
+
+      ++first;
+    }
+
+    return n;
+  }
+
+#if ETL_ALGORITHM_USING_SIMD
+  //***************************************************************************
+  /// count
+  /// Contiguous 8, 16 and 32 bit integral ranges are counted a block at a time.
+  //***************************************************************************
+  template <typename T, typename TValue>
   ETL_NODISCARD
   ETL_CONSTEXPR14
-  typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
+  typename etl::enable_if<private_algorithm::is_simd_comparable<T, TValue>::value, ptrdiff_t>::type
+    count(T* first, T* last, const TValue& value)
   {
-    typename iterator_traits<TIterator>::difference_type n = 0;
+    ptrdiff_t n = 0;
+
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      typedef typename private_algorithm::simd_lane<sizeof(T)>::type lane_t;
+
+      size_t searched = 0U;
+
+      n      = static_cast<ptrdiff_t>(private_algorithm::simd_count(reinterpret_cast<const char*>(first), static_cast<size_t>(last - first), static_cast<lane_t>(value), searched));
+      first += searched;
+    }
 
     while (first != last)
     {
@@ -603,6 +1097,7 @@ namespace etl
 
     return n;
   }
+#endif
 
   //***************************************************************************
   // count_if
@@ -747,6 +1242,160 @@ namespace etl
 
     return (first1 == last1) && (first2 == last2);
   }
+
+  #if ETL_ALGORITHM_USING_SIMD
+  //***************************************************************************
+  /// Contiguous 8, 16 and 32 bit integral ranges are compared a block at a time.
+  //***************************************************************************
+  template <typename T1, typename T2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_simd_comparable<T1, T2>::value, bool>::type
+    equal(T1* first1, T1* last1, T2* first2)
+  {
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      typedef typename private_algorithm::simd_lane<sizeof(T1)>::type lane_t;
+
+      const size_t length = static_cast<size_t>(last1 - first1);
+      const size_t index  = private_algorithm::simd_mismatch<lane_t>(reinterpret_cast<const char*>(first1), reinterpret_cast<const char*>(first2), length);
+
+      first1 += index;
+      first2 += index;
+    }
+
+    while (first1 != last1)
+    {
+      if (*first1 != *first2)
+      {
+        return false;
+      }
+
+      ++first1;
+      ++first2;
+    }
+
+    return true;
+  }
+
+  // Four parameter
+  template <typename T1, typename T2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_simd_comparable<T1, T2>::value, bool>::type
+    equal(T1* first1, T1* last1, T2* first2, T2* last2)
+  {
+    return ((last1 - first1) == (last2 - first2)) && etl::equal(first1, last1, first2);
+  }
+  #endif
+#endif
+
+  //***************************************************************************
+  // mismatch
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+  {
+    while ((first1 != last1) && (*first1 == *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+
+  // Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TPredicate predicate)
+  {
+    while ((first1 != last1) && predicate(*first1, *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+
+  // Four parameter
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
+  {
+    while ((first1 != last1) && (first2 != last2) && (*first1 == *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+
+  // Four parameter, Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
+  {
+    while ((first1 != last1) && (first2 != last2) && predicate(*first1, *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+
+#if ETL_ALGORITHM_USING_SIMD
+  //***************************************************************************
+  /// Contiguous 8, 16 and 32 bit integral ranges are compared a block at a time.
+  //***************************************************************************
+  template <typename T1, typename T2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_simd_comparable<T1, T2>::value, ETL_OR_STD::pair<T1*, T2*> >::type
+    mismatch(T1* first1, T1* last1, T2* first2)
+  {
+    if (!private_algorithm::is_constant_evaluated())
+    {
+      typedef typename private_algorithm::simd_lane<sizeof(T1)>::type lane_t;
+
+      const size_t length = static_cast<size_t>(last1 - first1);
+      const size_t index  = private_algorithm::simd_mismatch<lane_t>(reinterpret_cast<const char*>(first1), reinterpret_cast<const char*>(first2), length);
+
+      first1 += index;
+      first2 += index;
+    }
+
+    while ((first1 != last1) && (*first1 == *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<T1*, T2*>(first1, first2);
+  }
+
+  // Four parameter
+  template <typename T1, typename T2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  typename etl::enable_if<private_algorithm::is_simd_comparable<T1, T2>::value, ETL_OR_STD::pair<T1*, T2*> >::type
+    mismatch(T1* first1, T1* last1, T2* first2, T2* last2)
+  {
+    if ((last2 - first2) < (last1 - first1))
+    {
+      last1 = first1 + (last2 - first2);
+    }
+
+    return etl::mismatch(first1, last1, first2);
+  }
 #endif
 
   //***************************************************************************
@@ -837,7 +1486,8 @@ namespace etl
   //***************************************************************************
   template <typename TIterator, typename TUnaryOperation>
   ETL_CONSTEXPR14
-  TUnaryOperation for_each(TIterator first, TIterator last, TUnaryOperation unary_operation)
+  typename etl::enable_if<!etl::is_segmented_iterator<TIterator>::value, TUnaryOperation>::type
+    for_each(TIterator first, TIterator last, TUnaryOperation unary_operation)
   {
     while (first != last)
     {
@@ -848,6 +1498,32 @@ namespace etl
     return unary_operation;
   }
 
+  //***************************************************************************
+  /// for_each
+  /// Segmented iterators are visited one contiguous segment at a time.
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryOperation>
+  typename etl::enable_if<etl::is_segmented_iterator<TIterator>::value, TUnaryOperation>::type
+    for_each(TIterator first, TIterator last, TUnaryOperation unary_operation)
+  {
+    while (first != last)
+    {
+      const size_t n = first.segment_size(last);
+      typename TIterator::segment_pointer p  = first.segment_begin();
+      typename TIterator::segment_pointer pe = p + n;
+
+      while (p != pe)
+      {
+        unary_operation(*p);
+        ++p;
+      }
+
+      first.segment_advance(n);
+    }
+
+    return unary_operation;
+  }
+
   //***************************************************************************
   // transform
   //***************************************************************************
@@ -929,12 +1605,12 @@ namespace etl
 
       while ((value_index > top_index) && compare(first[parent], value))
       {
-        first[value_index] = etl::move(first[parent]);
+        first[value_index] = ETL_MOVE(first[parent]);
         value_index = parent;
         parent = (value_index - 1) / 2;
       }
 
-      first[value_index] = etl::move(value);
+      first[value_index] = ETL_MOVE(value);
     }
 
     // Adjust Heap Helper
@@ -951,18 +1627,18 @@ namespace etl
           --child2nd;
         }
 
-        first[value_index] = etl::move(first[child2nd]);
+        first[value_index] = ETL_MOVE(first[child2nd]);
         value_index = child2nd;
         child2nd = 2 * (child2nd + 1);
       }
 
       if (child2nd == length)
       {
-        first[value_index] = etl::move(first[child2nd - 1]);
+        first[value_index] = ETL_MOVE(first[child2nd - 1]);
         value_index = child2nd - 1;
       }
 
-      push_heap(first, value_index, top_index, etl::move(value), compare);
+      push_heap(first, value_index, top_index, ETL_MOVE(value), compare);
     }
 
     // Is Heap Helper
@@ -995,10 +1671,10 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
     typedef typename etl::iterator_traits<TIterator>::difference_type distance_t;
 
-    value_t value = etl::move(last[-1]);
-    last[-1] = etl::move(first[0]);
+    value_t value = ETL_MOVE(last[-1]);
+    last[-1] = ETL_MOVE(first[0]);
 
-    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), etl::move(value), compare);
+    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), ETL_MOVE(value), compare);
   }
 
   // Pop Heap
@@ -1017,7 +1693,7 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
     typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
 
-    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(etl::move(*(last - 1))), compare);
+    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(ETL_MOVE(*(last - 1))), compare);
   }
 
   // Push Heap
@@ -1045,7 +1721,7 @@ namespace etl
 
     while (true)
     {
-      private_heap::adjust_heap(first, parent, length, etl::move(*(first + parent)), compare);
+      private_heap::adjust_heap(first, parent, length, ETL_MOVE(*(first + parent)), compare);
 
       if (parent == 0)
       {
@@ -2015,49 +2691,243 @@ namespace etl
     return etl::find_if(begin, end, predicate) == end;
   }
 
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Sorts a short random access range by insertion, moving elements rather
+    /// than swapping or rotating them. Stable.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void move_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        value_t   value = ETL_MOVE(*itr);
+        TIterator hole  = itr;
+
+        while ((hole != first) && compare(value, *(hole - 1)))
+        {
+          *hole = ETL_MOVE(*(hole - 1));
+          --hole;
+        }
+
+        *hole = ETL_MOVE(value);
+      }
+    }
+  }
+
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    // Ranges at or below this size are left for the final insertion sort.
+    static ETL_CONSTANT int introsort_threshold = 16;
+
+    //*************************************************************************
+    /// Swaps the median of a, b and c in to result.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void introsort_median_to_first(TIterator result, TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*a, *b))
+      {
+        if (compare(*b, *c))
+        {
+          etl::iter_swap(result, b);
+        }
+        else if (compare(*a, *c))
+        {
+          etl::iter_swap(result, c);
+        }
+        else
+        {
+          etl::iter_swap(result, a);
+        }
+      }
+      else if (compare(*a, *c))
+      {
+        etl::iter_swap(result, a);
+      }
+      else if (compare(*b, *c))
+      {
+        etl::iter_swap(result, c);
+      }
+      else
+      {
+        etl::iter_swap(result, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot.
+    /// The median of three selection guarantees that the scans stop within the range.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator introsort_partition(TIterator first, TIterator last, TIterator pivot, TCompare compare)
+    {
+      while (true)
+      {
+        while (compare(*first, *pivot))
+        {
+          ++first;
+        }
+
+        --last;
+
+        while (compare(*pivot, *last))
+        {
+          --last;
+        }
+
+        if (!(first < last))
+        {
+          return first;
+        }
+
+        etl::iter_swap(first, last);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Quick sorts until the ranges are short, falling back to heap sort
+    /// if the recursion becomes too deep.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void introsort_loop(TIterator first, TIterator last, int depth_limit, TCompare compare)
+    {
+      while ((last - first) > introsort_threshold)
+      {
+        if (depth_limit == 0)
+        {
+          etl::heap_sort(first, last, compare);
+          return;
+        }
+
+        --depth_limit;
+
+        TIterator middle = first + ((last - first) / 2);
+        introsort_median_to_first(first, first + 1, middle, last - 1, compare);
+
+        TIterator cut = introsort_partition(first + 1, last, first, compare);
+
+        introsort_loop(cut, last, depth_limit, compare);
+        last = cut;
+      }
+    }
+
+    //*************************************************************************
+    /// Introsort for random access iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort(TIterator first, TIterator last, TCompare compare)
+    {
+      if ((last - first) < 2)
+      {
+        return;
+      }
+
+      // Limit the depth to 2 * log2(n).
+      int depth_limit = 0;
+
+      for (typename etl::iterator_traits<TIterator>::difference_type n = (last - first); n > 1; n /= 2)
+      {
+        depth_limit += 2;
+      }
+
+      introsort_loop(first, last, depth_limit, compare);
+      move_insertion_sort(first, last, compare);
+    }
+
+    //*************************************************************************
+    /// Shell sort for other iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+  }
+
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Merge sort without a buffer for random access iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      stable_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::stable_sort(first, last, first, first, compare);
+    }
+
+    //*************************************************************************
+    /// Insertion sort for other iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      stable_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::insertion_sort(first, last, compare);
+    }
+  }
+
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses introsort for random access iterators, otherwise shell sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort(first, last, compare);
   }
 
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses introsort for random access iterators, otherwise shell sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    private_algorithm::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses a merge sort without a buffer for random access iterators,
+  /// otherwise insertion sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    private_algorithm::stable_sort(first, last, compare);
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses a merge sort without a buffer for random access iterators,
+  /// otherwise insertion sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    private_algorithm::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -2103,19 +2973,65 @@ namespace etl
   {
     std::stable_sort(first, last);
   }
-#endif
+#endif
+
+  //***************************************************************************
+  /// Accumulates values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<!etl::is_segmented_iterator<TIterator>::value, T>::type
+    accumulate(TIterator first, TIterator last, T sum)
+  {
+    while (first != last)
+    {
+      sum = ETL_MOVE(sum) + *first;
+      ++first;
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Accumulates values.
+  /// Segmented iterators are accumulated one contiguous segment at a time.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  typename etl::enable_if<etl::is_segmented_iterator<TIterator>::value, T>::type
+    accumulate(TIterator first, TIterator last, T sum)
+  {
+    while (first != last)
+    {
+      const size_t n = first.segment_size(last);
+      typename TIterator::segment_pointer p  = first.segment_begin();
+      typename TIterator::segment_pointer pe = p + n;
+
+      while (p != pe)
+      {
+        sum = ETL_MOVE(sum) + *p;
+        ++p;
+      }
+
+      first.segment_advance(n);
+    }
+
+    return sum;
+  }
 
   //***************************************************************************
   /// Accumulates values.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename T>
+  template <typename TIterator, typename T, typename TBinaryOperation>
   ETL_CONSTEXPR14
-  T accumulate(TIterator first, TIterator last, T sum)
+  typename etl::enable_if<!etl::is_segmented_iterator<TIterator>::value, T>::type
+    accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
   {
     while (first != last)
     {
-      sum = etl::move(sum) + *first;
+      sum = operation(ETL_MOVE(sum), *first);
       ++first;
     }
 
@@ -2124,16 +3040,26 @@ namespace etl
 
   //***************************************************************************
   /// Accumulates values.
+  /// Segmented iterators are accumulated one contiguous segment at a time.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename T, typename TBinaryOperation>
-  ETL_CONSTEXPR14
-  T accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
+  typename etl::enable_if<etl::is_segmented_iterator<TIterator>::value, T>::type
+    accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
   {
     while (first != last)
     {
-      sum = operation(etl::move(sum), *first);
-      ++first;
+      const size_t n = first.segment_size(last);
+      typename TIterator::segment_pointer p  = first.segment_begin();
+      typename TIterator::segment_pointer pe = p + n;
+
+      while (p != pe)
+      {
+        sum = operation(ETL_MOVE(sum), *p);
+        ++p;
+      }
+
+      first.segment_advance(n);
     }
 
     return sum;
@@ -3073,6 +3999,478 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements in to [first, middle).
+  /// The order of the rest is unspecified.
+  /// Keeps a heap of the smallest so far, so each of the remaining elements
+  /// costs one comparison unless it belongs in the result.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    if (first == middle)
+    {
+      return;
+    }
+
+    etl::make_heap(first, middle, compare);
+
+    const difference_t length = middle - first;
+
+    for (TIterator itr = middle; itr != last; ++itr)
+    {
+      if (compare(*itr, *first))
+      {
+        value_t value = ETL_MOVE(*itr);
+        *itr = ETL_MOVE(*first);
+        private_heap::adjust_heap(first, difference_t(0), length, ETL_MOVE(value), compare);
+      }
+    }
+
+    etl::sort_heap(first, middle, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements in to [first, middle).
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void partial_sort(TIterator first, TIterator middle, TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    etl::partial_sort(first, middle, last, compare());
+  }
+
+  //***************************************************************************
+  /// Copies the smallest elements of [first, last) to [d_first, d_last),
+  /// sorted. Copies at most (d_last - d_first) elements.
+  /// The input is read once and need only be an input iterator.
+  /// Uses user defined comparison.
+  ///\return An iterator to the end of the sorted output.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator, typename TCompare>
+  TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first, TRandomAccessIterator d_last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::value_type      value_t;
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::difference_type difference_t;
+
+    TRandomAccessIterator d_end = d_first;
+
+    while ((first != last) && (d_end != d_last))
+    {
+      *d_end = *first;
+      ++d_end;
+      ++first;
+    }
+
+    if (d_end == d_first)
+    {
+      return d_end;
+    }
+
+    etl::make_heap(d_first, d_end, compare);
+
+    const difference_t length = d_end - d_first;
+
+    while (first != last)
+    {
+      if (compare(*first, *d_first))
+      {
+        private_heap::adjust_heap(d_first, difference_t(0), length, value_t(*first), compare);
+      }
+
+      ++first;
+    }
+
+    etl::sort_heap(d_first, d_end, compare);
+
+    return d_end;
+  }
+
+  //***************************************************************************
+  /// Copies the smallest elements of [first, last) to [d_first, d_last),
+  /// sorted.
+  ///\return An iterator to the end of the sorted output.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator>
+  TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first, TRandomAccessIterator d_last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TRandomAccessIterator>::value_type> compare;
+
+    return etl::partial_sort_copy(first, last, d_first, d_last, compare());
+  }
+
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Returns the value as its own radix sort key.
+    //*************************************************************************
+    template <typename T>
+    struct radix_sort_identity
+    {
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// One counting pass of an LSD radix sort, on the byte at 'shift'.
+    ///\return <b>false</b> if all of the keys have the same byte and nothing was moved.
+    //*************************************************************************
+    template <typename TKey, typename TSource, typename TDestination, typename TKeyExtractor>
+    bool radix_sort_pass(TSource source, size_t n, TDestination destination, int shift, TKeyExtractor key_extractor)
+    {
+      typedef typename etl::make_unsigned<TKey>::type ukey_t;
+
+      // Signed keys have their sign bit flipped so that negative values sort first.
+      const ukey_t flip = etl::is_signed<TKey>::value ? static_cast<ukey_t>(ukey_t(1U) << (etl::integral_limits<ukey_t>::bits - 1U)) : ukey_t(0U);
+
+      size_t counts[256];
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        counts[i] = 0U;
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        ++counts[(static_cast<ukey_t>(static_cast<ukey_t>(key_extractor(source[i])) ^ flip) >> shift) & 0xFFU];
+      }
+
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        if (counts[i] == n)
+        {
+          return false;
+        }
+
+        const size_t count = counts[i];
+        counts[i] = total;
+        total    += count;
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const size_t digit = (static_cast<ukey_t>(static_cast<ukey_t>(key_extractor(source[i])) ^ flip) >> shift) & 0xFFU;
+
+        destination[counts[digit]++] = ETL_MOVE(source[i]);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// LSD radix sort, ping-ponging between the range and the buffer.
+    //*************************************************************************
+    template <typename TKey, typename TIterator, typename TBufferIterator, typename TKeyExtractor>
+    void radix_sort(TIterator first, TIterator last, TBufferIterator buffer, TKeyExtractor key_extractor)
+    {
+      ETL_STATIC_ASSERT(etl::is_integral<TKey>::value, "radix_sort keys must be integral");
+
+      typedef typename etl::make_unsigned<TKey>::type ukey_t;
+
+      const size_t n = static_cast<size_t>(last - first);
+
+      if (n < 2U)
+      {
+        return;
+      }
+
+      bool in_buffer = false;
+
+      for (int shift = 0; shift < int(etl::integral_limits<ukey_t>::bits); shift += 8)
+      {
+        if (in_buffer)
+        {
+          in_buffer = !radix_sort_pass<TKey>(buffer, n, first, shift, key_extractor);
+        }
+        else
+        {
+          in_buffer = radix_sort_pass<TKey>(first, n, buffer, shift, key_extractor);
+        }
+      }
+
+      if (in_buffer)
+      {
+        etl::move(buffer, buffer + n, first);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts integral values using an LSD radix sort, one byte per pass.
+  /// Stable. Does not compare elements.
+  /// Passes where every value has the same byte are skipped.
+  ///\param first  The start of the range.
+  ///\param last   The end of the range.
+  ///\param buffer The start of a scratch buffer at least as large as the range.
+  ///               The elements of the buffer are assigned to.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void radix_sort(TIterator first, TIterator last, TBufferIterator buffer)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    private_algorithm::radix_sort<value_t>(first, last, buffer, private_algorithm::radix_sort_identity<value_t>());
+  }
+
+  //***************************************************************************
+  /// Sorts elements by an integral key using an LSD radix sort, one byte per pass.
+  /// Stable. Does not compare elements.
+  /// Passes where every key has the same byte are skipped.
+  /// For C++03 the key extractor must define 'result_type'.
+  ///\param first         The start of the range.
+  ///\param last          The end of the range.
+  ///\param buffer        The start of a scratch buffer at least as large as the range.
+  ///                     The elements of the buffer are assigned to.
+  ///\param key_extractor Returns the integral key of an element.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TKeyExtractor>
+  void radix_sort(TIterator first, TIterator last, TBufferIterator buffer, TKeyExtractor key_extractor)
+  {
+#if ETL_USING_CPP11
+    typedef typename etl::decay<decltype(key_extractor(*first))>::type key_t;
+#else
+    typedef typename TKeyExtractor::result_type key_t;
+#endif
+
+    private_algorithm::radix_sort<key_t>(first, last, buffer, key_extractor);
+  }
+
+  //***************************************************************************
+  /// Merges two consecutive sorted ranges into one sorted range.
+  /// Stable. Does not allocate a buffer; the ranges are merged by rotation
+  /// with O(N log N) comparisons.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/inplace_merge"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  void inplace_merge(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length1 = etl::distance(first, middle);
+    difference_t length2 = etl::distance(middle, last);
+
+    while ((length1 != 0) && (length2 != 0))
+    {
+      if ((length1 + length2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          etl::iter_swap(first, middle);
+        }
+
+        return;
+      }
+
+      TIterator    cut1;
+      TIterator    cut2;
+      difference_t length11;
+      difference_t length22;
+
+      // Split the longer range in half and find the matching split in the other.
+      if (length1 > length2)
+      {
+        length11 = length1 / 2;
+        cut1     = etl::next(first, length11);
+        cut2     = etl::lower_bound(middle, last, *cut1, compare);
+        length22 = etl::distance(middle, cut2);
+      }
+      else
+      {
+        length22 = length2 / 2;
+        cut2     = etl::next(middle, length22);
+        cut1     = etl::upper_bound(first, middle, *cut2, compare);
+        length11 = etl::distance(first, cut1);
+      }
+
+      // Rotate [cut1, middle) and [middle, cut2).
+      etl::reverse(cut1, middle);
+      etl::reverse(middle, cut2);
+      etl::reverse(cut1, cut2);
+
+      TIterator new_middle = etl::next(cut1, length22);
+
+      // Recurse on the smaller half and loop on the larger.
+      if ((length11 + length22) < (length1 + length2 - length11 - length22))
+      {
+        etl::inplace_merge(first, cut1, new_middle, compare);
+        first    = new_middle;
+        middle   = cut2;
+        length1 -= length11;
+        length2 -= length22;
+      }
+      else
+      {
+        etl::inplace_merge(new_middle, cut2, last, compare);
+        last    = new_middle;
+        middle  = cut1;
+        length1 = length11;
+        length2 = length22;
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Merges two consecutive sorted ranges into one sorted range.
+  /// Stable. Does not allocate a buffer.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/inplace_merge"></a>
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR14
+  void inplace_merge(TIterator first, TIterator middle, TIterator last)
+  {
+    etl::inplace_merge(first, middle, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  namespace private_algorithm
+  {
+    // The length of the runs that are insertion sorted before merging.
+    static ETL_CONSTANT int stable_sort_run_length = 16;
+
+    //*************************************************************************
+    /// Merges two consecutive sorted ranges, moving the shorter one to the
+    /// buffer first. The buffer must hold the shorter range.
+    //*************************************************************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void buffered_merge(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer, TCompare compare)
+    {
+      if ((middle - first) <= (last - middle))
+      {
+        // Merge forwards from the front.
+        TBufferIterator buffer_last = etl::move(first, middle, buffer);
+        TIterator       output      = first;
+
+        while ((buffer != buffer_last) && (middle != last))
+        {
+          if (compare(*middle, *buffer))
+          {
+            *output = ETL_MOVE(*middle);
+            ++middle;
+          }
+          else
+          {
+            *output = ETL_MOVE(*buffer);
+            ++buffer;
+          }
+
+          ++output;
+        }
+
+        etl::move(buffer, buffer_last, output);
+      }
+      else
+      {
+        // Merge backwards from the back.
+        TBufferIterator buffer_last = etl::move(middle, last, buffer);
+        TIterator       output      = last;
+
+        while ((buffer != buffer_last) && (middle != first))
+        {
+          if (compare(*(buffer_last - 1), *(middle - 1)))
+          {
+            --middle;
+            *(--output) = ETL_MOVE(*middle);
+          }
+          else
+          {
+            --buffer_last;
+            *(--output) = ETL_MOVE(*buffer_last);
+          }
+        }
+
+        etl::move_backward(buffer, buffer_last, output);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a bottom up merge sort.
+  /// Stable. Requires random access iterators.
+  /// Runs of 16 elements are insertion sorted, then merged in pairs of
+  /// doubling length. Each merge moves the shorter run to the buffer. Merges
+  /// where the shorter run does not fit use etl::inplace_merge instead, so
+  /// the buffer may be any size, including empty. A buffer of half the range
+  /// gives O(N log N) time.
+  ///\param first        The start of the range.
+  ///\param last         The end of the range.
+  ///\param buffer_first The start of the scratch buffer. The elements of the buffer are assigned to.
+  ///\param buffer_last  The end of the scratch buffer.
+  ///\param compare      The comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    const difference_t length      = last - first;
+    const difference_t buffer_size = static_cast<difference_t>(etl::distance(buffer_first, buffer_last));
+    const difference_t run_length  = private_algorithm::stable_sort_run_length;
+
+    for (difference_t i = 0; i < length; i += run_length)
+    {
+      private_algorithm::move_insertion_sort(first + i, first + etl::min(i + run_length, length), compare);
+    }
+
+    for (difference_t width = run_length; width < length; width *= 2)
+    {
+      for (difference_t i = 0; i < (length - width); i += (2 * width))
+      {
+        TIterator lower  = first + i;
+        TIterator middle = lower + width;
+        TIterator upper  = first + etl::min(i + (2 * width), length);
+
+        // Already in order?
+        if (!compare(*middle, *(middle - 1)))
+        {
+          continue;
+        }
+
+        if (etl::min(width, difference_t(upper - middle)) <= buffer_size)
+        {
+          private_algorithm::buffered_merge(lower, middle, upper, buffer_first, compare);
+        }
+        else
+        {
+          etl::inplace_merge(lower, middle, upper, compare);
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a bottom up merge sort.
+  /// Stable. Requires random access iterators.
+  ///\param first        The start of the range.
+  ///\param last         The end of the range.
+  ///\param buffer_first The start of the scratch buffer. The elements of the buffer are assigned to.
+  ///\param buffer_last  The end of the scratch buffer.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::stable_sort(first, last, buffer_first, buffer_last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
@@ -3415,7 +4813,7 @@ namespace etl
   {
     typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare_t;
 
-    nth_element(first, last, compare_t());
+    nth_element(first, nth, last, compare_t());
   }
 #endif
 }
@@ -0,0 +1,576 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ASYNC_MESSAGE_BUS_INCLUDED
+#define ETL_ASYNC_MESSAGE_BUS_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "message_types.h"
+#include "message.h"
+#include "message_router.h"
+#include "shared_message.h"
+#include "task.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for async message bus
+  //***************************************************************************
+  class async_message_bus_exception : public etl::exception
+  {
+  public:
+
+    async_message_bus_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Too many subscribers.
+  //***************************************************************************
+  class async_message_bus_too_many_subscribers : public etl::async_message_bus_exception
+  {
+  public:
+
+    async_message_bus_too_many_subscribers(string_type file_name_, numeric_type line_number_)
+      : async_message_bus_exception(ETL_ERROR_TEXT("async message bus:too many subscribers", ETL_ASYNC_MESSAGE_BUS_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A subscriber's queue is full.
+  //***************************************************************************
+  class async_message_bus_queue_full : public etl::async_message_bus_exception
+  {
+  public:
+
+    async_message_bus_queue_full(string_type file_name_, numeric_type line_number_)
+      : async_message_bus_exception(ETL_ERROR_TEXT("async message bus:queue full", ETL_ASYNC_MESSAGE_BUS_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Interface for the asynchronous message bus.
+  /// Each subscribed router has its own queue of etl::shared_message.
+  /// Shared messages received by the bus are pushed to the queues of the
+  /// routers that accept them, and are delivered when the queues are
+  /// dispatched, usually from another thread or a scheduler task.
+  /// Messages that are not shared cannot be held by the bus, and are
+  /// delivered immediately, as for etl::message_bus.
+  /// Subscribed message buses only receive broadcast messages.
+  ///
+  /// TQueue is a queue of etl::shared_message, such as
+  /// etl::queue_spsc_atomic<etl::shared_message, SIZE> for a single publisher
+  /// or etl::queue_mpmc_mutex<etl::shared_message, SIZE> for several.
+  /// It must have push(const etl::shared_message&), front(), pop(), size()
+  /// and empty().
+  /// Each queue must only be dispatched from one thread at a time.
+  /// Subscribe and unsubscribe must not be called while messages are being
+  /// published or dispatched.
+  //***************************************************************************
+  template <typename TQueue>
+  class iasync_message_bus : public etl::imessage_router
+  {
+  public:
+
+    typedef TQueue queue_type;
+
+    using etl::imessage_router::receive;
+
+    //*******************************************
+    /// Subscribe to the bus.
+    //*******************************************
+    bool subscribe(etl::imessage_router& router)
+    {
+      bool ok = true;
+
+      // There's no point adding routers that don't consume messages.
+      if (router.is_consumer())
+      {
+        const size_t slot = find_slot(ETL_NULLPTR);
+
+        ok = (slot != max_routers);
+
+        ETL_ASSERT(ok, ETL_ERROR(etl::async_message_bus_too_many_subscribers));
+
+        if (ok)
+        {
+          p_routers[slot] = &router;
+          ++number_of_routers;
+        }
+      }
+
+      return ok;
+    }
+
+    //*******************************************
+    /// Unsubscribe from the bus.
+    /// Any messages queued for the routers are discarded.
+    //*******************************************
+    void unsubscribe(etl::message_router_id_t id)
+    {
+      if (id == etl::imessage_router::ALL_MESSAGE_ROUTERS)
+      {
+        clear();
+      }
+      else
+      {
+        for (size_t slot = 0U; slot < max_routers; ++slot)
+        {
+          if ((p_routers[slot] != ETL_NULLPTR) && (p_routers[slot]->get_message_router_id() == id))
+          {
+            remove(slot);
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Unsubscribe from the bus.
+    /// Any messages queued for the router are discarded.
+    //*******************************************
+    void unsubscribe(etl::imessage_router& router)
+    {
+      const size_t slot = find_slot(&router);
+
+      if (slot != max_routers)
+      {
+        remove(slot);
+      }
+    }
+
+    //*******************************************
+    virtual void receive(const etl::imessage& message) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, message);
+    }
+
+    //*******************************************
+    virtual void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+    }
+
+    //*******************************************
+    /// Delivers the message immediately, as it cannot be queued.
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id,
+                         const etl::imessage&     message) ETL_OVERRIDE
+    {
+      const etl::message_id_t id = message.get_message_id();
+
+      for (size_t slot = 0U; slot < max_routers; ++slot)
+      {
+        if (is_destination(slot, destination_router_id, id))
+        {
+          p_routers[slot]->receive(message);
+        }
+      }
+
+      if (has_successor())
+      {
+        if (get_successor().accepts(id))
+        {
+          get_successor().receive(destination_router_id, message);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Queues the message for each router that accepts it.
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id,
+                         etl::shared_message      shared_msg) ETL_OVERRIDE
+    {
+      const etl::message_id_t id = shared_msg.get_message().get_message_id();
+
+      for (size_t slot = 0U; slot < max_routers; ++slot)
+      {
+        if (is_destination(slot, destination_router_id, id))
+        {
+          const bool ok = p_queues[slot].push(shared_msg);
+
+          ETL_ASSERT(ok, ETL_ERROR(etl::async_message_bus_queue_full));
+          (void)ok;
+        }
+      }
+
+      if (has_successor())
+      {
+        if (get_successor().accepts(id))
+        {
+          get_successor().receive(destination_router_id, shared_msg);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Delivers the messages queued for all of the routers.
+    /// Messages pushed while dispatching are left for the next call.
+    /// Returns the number of messages delivered.
+    //*******************************************
+    size_t dispatch()
+    {
+      size_t count = 0U;
+
+      for (size_t slot = 0U; slot < max_routers; ++slot)
+      {
+        if (p_routers[slot] != ETL_NULLPTR)
+        {
+          count += dispatch_slot(slot);
+        }
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Delivers the messages queued for one router.
+    /// Allows each router to be dispatched from its own thread.
+    /// Returns the number of messages delivered.
+    //*******************************************
+    size_t dispatch(etl::imessage_router& router)
+    {
+      const size_t slot = find_slot(&router);
+
+      return (slot != max_routers) ? dispatch_slot(slot) : 0U;
+    }
+
+    //*******************************************
+    /// The number of messages queued for all of the routers.
+    //*******************************************
+    size_t pending() const
+    {
+      size_t count = 0U;
+
+      for (size_t slot = 0U; slot < max_routers; ++slot)
+      {
+        if (p_routers[slot] != ETL_NULLPTR)
+        {
+          count += p_queues[slot].size();
+        }
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// The number of messages queued for one router.
+    //*******************************************
+    size_t pending(const etl::imessage_router& router) const
+    {
+      const size_t slot = find_slot(&router);
+
+      return (slot != max_routers) ? size_t(p_queues[slot].size()) : 0U;
+    }
+
+    using imessage_router::accepts;
+
+    //*******************************************
+    /// Does this message bus accept the message id?
+    /// Returns <b>true</b> on the first router that does.
+    //*******************************************
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      for (size_t slot = 0U; slot < max_routers; ++slot)
+      {
+        if ((p_routers[slot] != ETL_NULLPTR) && p_routers[slot]->accepts(id))
+        {
+          return true;
+        }
+      }
+
+      // Check any successor.
+      if (has_successor())
+      {
+        if (get_successor().accepts(id))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    size_t size() const
+    {
+      return number_of_routers;
+    }
+
+    //*******************************************
+    /// Unsubscribes all of the routers.
+    /// Any queued messages are discarded.
+    //*******************************************
+    void clear()
+    {
+      for (size_t slot = 0U; slot < max_routers; ++slot)
+      {
+        if (p_routers[slot] != ETL_NULLPTR)
+        {
+          remove(slot);
+        }
+      }
+    }
+
+    //********************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //********************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    iasync_message_bus(etl::imessage_router** p_routers_, TQueue* p_queues_, size_t max_routers_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS)
+      , p_routers(p_routers_)
+      , p_queues(p_queues_)
+      , max_routers(max_routers_)
+      , number_of_routers(0U)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    iasync_message_bus(etl::imessage_router** p_routers_, TQueue* p_queues_, size_t max_routers_, etl::imessage_router& successor_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_)
+      , p_routers(p_routers_)
+      , p_queues(p_queues_)
+      , max_routers(max_routers_)
+      , number_of_routers(0U)
+    {
+    }
+
+  private:
+
+    //*******************************************
+    /// Finds the slot holding the router, or max_routers.
+    //*******************************************
+    size_t find_slot(const etl::imessage_router* p_router) const
+    {
+      size_t slot = 0U;
+
+      while ((slot < max_routers) && (p_routers[slot] != p_router))
+      {
+        ++slot;
+      }
+
+      return slot;
+    }
+
+    //*******************************************
+    /// Should the message be sent to the router in the slot?
+    //*******************************************
+    bool is_destination(size_t slot, etl::message_router_id_t destination_router_id, etl::message_id_t id) const
+    {
+      const etl::imessage_router* p_router = p_routers[slot];
+
+      return (p_router != ETL_NULLPTR) &&
+             ((destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS) || (destination_router_id == p_router->get_message_router_id())) &&
+             p_router->accepts(id);
+    }
+
+    //*******************************************
+    /// Delivers the messages in the slot's queue.
+    //*******************************************
+    size_t dispatch_slot(size_t slot)
+    {
+      TQueue& queue = p_queues[slot];
+
+      // Only deliver what is there now, so that a busy publisher cannot keep us here.
+      size_t count = queue.size();
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        // Release the queue entry before the router sees the message.
+        etl::shared_message shared_msg(queue.front());
+        queue.pop();
+
+        p_routers[slot]->receive(shared_msg);
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Removes the router in the slot, discarding its messages.
+    //*******************************************
+    void remove(size_t slot)
+    {
+      while (!p_queues[slot].empty())
+      {
+        p_queues[slot].pop();
+      }
+
+      p_routers[slot] = ETL_NULLPTR;
+      --number_of_routers;
+    }
+
+    // Disabled.
+    iasync_message_bus(const iasync_message_bus&) ETL_DELETE;
+    iasync_message_bus& operator =(const iasync_message_bus&) ETL_DELETE;
+
+    etl::imessage_router** p_routers;         ///< The subscribed router for each slot, or ETL_NULLPTR.
+    TQueue*                p_queues;          ///< The queue for each slot.
+    size_t                 max_routers;
+    size_t                 number_of_routers;
+  };
+
+  //***************************************************************************
+  /// The asynchronous message bus.
+  ///\tparam MAX_ROUTERS_ The maximum number of subscribed routers.
+  ///\tparam TQueue       The queue type for each router.
+  //***************************************************************************
+  template <size_t MAX_ROUTERS_, typename TQueue>
+  class async_message_bus : public etl::iasync_message_bus<TQueue>
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    async_message_bus()
+      : etl::iasync_message_bus<TQueue>(routers, queues, MAX_ROUTERS_)
+    {
+      initialise();
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    async_message_bus(etl::imessage_router& successor_)
+      : etl::iasync_message_bus<TQueue>(routers, queues, MAX_ROUTERS_, successor_)
+    {
+      initialise();
+    }
+
+  private:
+
+    //*******************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < MAX_ROUTERS_; ++i)
+      {
+        routers[i] = ETL_NULLPTR;
+      }
+    }
+
+    etl::imessage_router* routers[MAX_ROUTERS_];
+    TQueue                queues[MAX_ROUTERS_];
+  };
+
+  //***************************************************************************
+  /// A task that dispatches the queues of an asynchronous message bus.
+  /// May be limited to one router, so that routers may be dispatched by
+  /// different schedulers.
+  //***************************************************************************
+  template <typename TQueue>
+  class async_message_bus_task : public etl::task
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    /// Dispatches all of the routers on the bus.
+    //*******************************************
+    async_message_bus_task(etl::iasync_message_bus<TQueue>& bus_, etl::task_priority_t priority_)
+      : task(priority_)
+      , bus(bus_)
+      , p_router(ETL_NULLPTR)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    /// Dispatches one router on the bus.
+    //*******************************************
+    async_message_bus_task(etl::iasync_message_bus<TQueue>& bus_, etl::imessage_router& router_, etl::task_priority_t priority_)
+      : task(priority_)
+      , bus(bus_)
+      , p_router(&router_)
+    {
+    }
+
+    //*******************************************
+    /// Returns the number of queued messages.
+    //*******************************************
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return static_cast<uint32_t>((p_router == ETL_NULLPTR) ? bus.pending() : bus.pending(*p_router));
+    }
+
+    //*******************************************
+    /// Delivers the queued messages.
+    //*******************************************
+    void task_process_work() ETL_OVERRIDE
+    {
+      if (p_router == ETL_NULLPTR)
+      {
+        bus.dispatch();
+      }
+      else
+      {
+        bus.dispatch(*p_router);
+      }
+    }
+
+  private:
+
+    etl::iasync_message_bus<TQueue>& bus;
+    etl::imessage_router*            p_router;
+  };
+}
+
+#endif
@@ -45,4 +45,303 @@ SOFTWARE.
   #endif
 #endif
 
+#if ETL_HAS_ATOMIC
+
+#include "static_assert.h"
+
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+/// Called while spinning in etl::atomic_wait, when the atomic backend has no
+/// native wait. May be defined as a 'wait for event' or 'yield' instruction.
+//*****************************************************************************
+#if !defined(ETL_ATOMIC_WAIT_PAUSE)
+  #define ETL_ATOMIC_WAIT_PAUSE()
+#endif
+
+//*****************************************************************************
+/// Called by etl::atomic_notify_one and etl::atomic_notify_all, when the atomic
+/// backend has no native notify. May be defined as a 'send event' instruction.
+//*****************************************************************************
+#if !defined(ETL_ATOMIC_NOTIFY)
+  #define ETL_ATOMIC_NOTIFY()
+#endif
+
+#if defined(ETL_ATOMIC_STD_INCLUDED) && ETL_USING_CPP20 && defined(__cpp_lib_atomic_wait)
+  #define ETL_HAS_NATIVE_ATOMIC_WAIT 1
+#else
+  #define ETL_HAS_NATIVE_ATOMIC_WAIT 0
+#endif
+
+// Is there a lock free compare and swap of two pointers?
+#if ((UINTPTR_MAX == 0xFFFFFFFFUL) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)) || \
+    ((UINTPTR_MAX > 0xFFFFFFFFUL) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && defined(__SIZEOF_INT128__))
+  #define ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS 1
+#else
+  #define ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS 0
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Blocks while the atomic holds 'old'.
+  /// Uses the native wait if there is one, otherwise spins, calling
+  /// ETL_ATOMIC_WAIT_PAUSE() on each pass.
+  //***************************************************************************
+  template <typename T>
+  void atomic_wait(const etl::atomic<T>& object, T old, etl::memory_order order = etl::memory_order_seq_cst)
+  {
+#if ETL_HAS_NATIVE_ATOMIC_WAIT
+    object.wait(old, order);
+#else
+    while (object.load(order) == old)
+    {
+      ETL_ATOMIC_WAIT_PAUSE();
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Wakes one thread blocked in etl::atomic_wait on the atomic.
+  //***************************************************************************
+  template <typename T>
+  void atomic_notify_one(etl::atomic<T>& object)
+  {
+#if ETL_HAS_NATIVE_ATOMIC_WAIT
+    object.notify_one();
+#else
+    (void)object;
+    ETL_ATOMIC_NOTIFY();
+#endif
+  }
+
+  //***************************************************************************
+  /// Wakes all threads blocked in etl::atomic_wait on the atomic.
+  //***************************************************************************
+  template <typename T>
+  void atomic_notify_all(etl::atomic<T>& object)
+  {
+#if ETL_HAS_NATIVE_ATOMIC_WAIT
+    object.notify_all();
+#else
+    (void)object;
+    ETL_ATOMIC_NOTIFY();
+#endif
+  }
+
+  //***************************************************************************
+  /// Atomically replaces the value with the maximum of it and 'value'.
+  /// Returns the previous value.
+  /// Only writes if the value increases, so tracking a high water mark is
+  /// usually just a load.
+  //***************************************************************************
+  template <typename T>
+  T atomic_fetch_max(etl::atomic<T>& object, T value, etl::memory_order order = etl::memory_order_seq_cst)
+  {
+    T current = object.load(etl::memory_order_relaxed);
+
+    while ((current < value) && !object.compare_exchange_weak(current, value, order, etl::memory_order_relaxed))
+    {
+    }
+
+    return current;
+  }
+
+  //***************************************************************************
+  /// Atomically replaces the value with the minimum of it and 'value'.
+  /// Returns the previous value.
+  /// Only writes if the value decreases.
+  //***************************************************************************
+  template <typename T>
+  T atomic_fetch_min(etl::atomic<T>& object, T value, etl::memory_order order = etl::memory_order_seq_cst)
+  {
+    T current = object.load(etl::memory_order_relaxed);
+
+    while ((value < current) && !object.compare_exchange_weak(current, value, order, etl::memory_order_relaxed))
+    {
+    }
+
+    return current;
+  }
+
+  //***************************************************************************
+  /// A pointer and a tag, such as a modification count, that are compared
+  /// and swapped together. Used to avoid the ABA problem in lock free lists.
+  //***************************************************************************
+  template <typename T>
+  struct tagged_pointer
+  {
+    T*        pointer;
+    uintptr_t tag;
+  };
+
+  template <typename T>
+  bool operator ==(const etl::tagged_pointer<T>& lhs, const etl::tagged_pointer<T>& rhs)
+  {
+    return (lhs.pointer == rhs.pointer) && (lhs.tag == rhs.tag);
+  }
+
+  template <typename T>
+  bool operator !=(const etl::tagged_pointer<T>& lhs, const etl::tagged_pointer<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// An atomic etl::tagged_pointer.
+  /// Uses a double width compare and swap if the target has one, as shown by
+  /// ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS. Otherwise uses etl::atomic, which may
+  /// not be lock free.
+  //***************************************************************************
+  template <typename T>
+  class atomic_tagged_pointer
+  {
+  public:
+
+    typedef etl::tagged_pointer<T> value_type;
+
+    atomic_tagged_pointer()
+    {
+      value_type v = { ETL_NULLPTR, 0U };
+      store(v);
+    }
+
+    explicit atomic_tagged_pointer(value_type v)
+    {
+      store(v);
+    }
+
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+    //*************************************************************************
+    bool is_lock_free() const
+    {
+      return true;
+    }
+
+    //*************************************************************************
+    value_type load(etl::memory_order = etl::memory_order_seq_cst) const
+    {
+      // A swap of zero for zero is an atomic read.
+      return to_value(__sync_val_compare_and_swap(const_cast<word_t*>(&word), word_t(0), word_t(0)));
+    }
+
+    //*************************************************************************
+    void store(value_type v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      exchange(v, order);
+    }
+
+    //*************************************************************************
+    value_type exchange(value_type v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      value_type expected = load(order);
+
+      while (!compare_exchange_weak(expected, v, order))
+      {
+      }
+
+      return expected;
+    }
+
+    //*************************************************************************
+    bool compare_exchange_weak(value_type& expected, value_type desired, etl::memory_order = etl::memory_order_seq_cst)
+    {
+      const word_t expected_word = to_word(expected);
+      const word_t previous      = __sync_val_compare_and_swap(&word, expected_word, to_word(desired));
+
+      if (previous == expected_word)
+      {
+        return true;
+      }
+
+      expected = to_value(previous);
+
+      return false;
+    }
+
+    //*************************************************************************
+    bool compare_exchange_strong(value_type& expected, value_type desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return compare_exchange_weak(expected, desired, order);
+    }
+
+  private:
+
+#if UINTPTR_MAX > 0xFFFFFFFFUL
+    typedef unsigned __int128 word_t;
+#else
+    typedef uint64_t word_t;
+#endif
+
+    ETL_STATIC_ASSERT(sizeof(word_t) == sizeof(value_type), "Unexpected tagged_pointer size");
+
+    //*************************************************************************
+    static word_t to_word(value_type v)
+    {
+      word_t w;
+      memcpy(&w, &v, sizeof(w));
+
+      return w;
+    }
+
+    //*************************************************************************
+    static value_type to_value(word_t w)
+    {
+      value_type v;
+      memcpy(&v, &w, sizeof(v));
+
+      return v;
+    }
+
+    word_t word __attribute__((aligned(2 * sizeof(void*))));
+#else
+    //*************************************************************************
+    bool is_lock_free() const
+    {
+      return value.is_lock_free();
+    }
+
+    //*************************************************************************
+    value_type load(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return value.load(order);
+    }
+
+    //*************************************************************************
+    void store(value_type v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      value.store(v, order);
+    }
+
+    //*************************************************************************
+    value_type exchange(value_type v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return value.exchange(v, order);
+    }
+
+    //*************************************************************************
+    bool compare_exchange_weak(value_type& expected, value_type desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return value.compare_exchange_weak(expected, desired, order);
+    }
+
+    //*************************************************************************
+    bool compare_exchange_strong(value_type& expected, value_type desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return value.compare_exchange_strong(expected, desired, order);
+    }
+
+  private:
+
+    etl::atomic<value_type> value;
+#endif
+
+    // Disabled.
+    atomic_tagged_pointer(const atomic_tagged_pointer&);
+    atomic_tagged_pointer& operator =(const atomic_tagged_pointer&);
+  };
+}
+#endif
+
 #endif
@@ -931,6 +931,7 @@ namespace etl
       }
       else
       {
+        memcpy(&expected, &value, sizeof(T));
         result = false;
       }
       ETL_BUILTIN_UNLOCK;
@@ -951,6 +952,7 @@ namespace etl
       }
       else
       {
+        memcpy(&expected, &value, sizeof(T));
         result = false;
       }
       ETL_BUILTIN_UNLOCK;
@@ -1005,6 +1007,14 @@ namespace etl
     mutable T value;
   };
 
+  //***************************************************************************
+  /// Memory fence.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    __atomic_thread_fence(order);
+  }
+
 #undef ETL_BUILTIN_LOCK
 #undef ETL_BUILTIN_UNLOCK
 
@@ -2103,6 +2113,7 @@ namespace etl
       }
       else
       {
+        memcpy(&expected, &value, sizeof(T));
         result = false;
       }
       ETL_BUILTIN_UNLOCK;
@@ -2122,6 +2133,7 @@ namespace etl
       }
       else
       {
+        memcpy(&expected, &value, sizeof(T));
         result = false;
       }
       ETL_BUILTIN_UNLOCK;
@@ -2166,6 +2178,18 @@ namespace etl
     mutable T value;
   };
 
+  //***************************************************************************
+  /// Memory fence.
+  /// The '__sync' builtins only have a full fence.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    if (order != etl::memory_order_relaxed)
+    {
+      __sync_synchronize();
+    }
+  }
+
 #undef ETL_SYNC_BUILTIN_LOCK
 #undef ETL_SYNC_BUILTIN_UNLOCK
 
@@ -55,6 +55,14 @@ namespace etl
   static ETL_CONSTANT etl::memory_order memory_order_acq_rel = std::memory_order_acq_rel;
   static ETL_CONSTANT etl::memory_order memory_order_seq_cst = std::memory_order_seq_cst;
 
+  //***************************************************************************
+  /// Memory fence.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    std::atomic_thread_fence(order);
+  }
+
   using atomic_bool           = std::atomic<bool>;
   using atomic_char           = std::atomic<char>;
   using atomic_schar          = std::atomic<signed char>;
@@ -0,0 +1,420 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_INCLUDED
+#define ETL_ATOMIC_WAIT_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "utility.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+  #if defined(ETL_TARGET_OS_FREERTOS)
+    #include "atomic_wait/atomic_wait_freertos.h"
+    #define ETL_HAS_ATOMIC_WAIT 1
+  #elif ETL_USING_CPP20 && ETL_USING_STL && defined(__cpp_lib_atomic_wait)
+    #include "atomic_wait/atomic_wait_std.h"
+    #define ETL_HAS_ATOMIC_WAIT 1
+    #define ETL_ATOMIC_WAIT_USING_POLICY
+  #elif defined(__linux__)
+    #include "atomic_wait/atomic_wait_futex.h"
+    #define ETL_HAS_ATOMIC_WAIT 1
+    #define ETL_ATOMIC_WAIT_USING_POLICY
+  #endif
+#endif
+
+#if !defined(ETL_HAS_ATOMIC_WAIT)
+  #define ETL_HAS_ATOMIC_WAIT 0
+#endif
+
+namespace etl
+{
+  namespace traits
+  {
+    static ETL_CONSTANT bool has_atomic_wait = (ETL_HAS_ATOMIC_WAIT == 1);
+  }
+
+#if defined(ETL_ATOMIC_WAIT_USING_POLICY)
+  //***************************************************************************
+  ///\ingroup atomic_wait
+  /// An event that threads may block on until a condition is met.
+  /// The waiter passes a predicate that is tried before each sleep. The
+  /// notifier changes the state that the predicate tests, then calls notify().
+  /// notify() only makes a system call when a thread is waiting.
+  //***************************************************************************
+  class atomic_event
+  {
+  public:
+
+    atomic_event()
+      : epoch(0U)
+      , waiters(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Blocks the calling thread until ready() returns true.
+    /// ready() may be called several times, and may have side effects.
+    //*************************************************************************
+    template <typename TPredicate>
+    void wait(TPredicate ready)
+    {
+      while (!ready())
+      {
+        waiters.fetch_add(1U, etl::memory_order_seq_cst);
+
+        // Read before the check, so that a notify() after the check changes it.
+        uint32_t old_epoch = epoch.load(etl::memory_order_seq_cst);
+
+        bool done = ready();
+
+        if (!done)
+        {
+          etl::private_atomic_wait::wait_policy::wait(epoch, old_epoch);
+        }
+
+        waiters.fetch_sub(1U, etl::memory_order_relaxed);
+
+        if (done)
+        {
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Wakes all of the waiting threads.
+    //*************************************************************************
+    void notify()
+    {
+      epoch.fetch_add(1U, etl::memory_order_seq_cst);
+
+      if (waiters.load(etl::memory_order_seq_cst) != 0U)
+      {
+        etl::private_atomic_wait::wait_policy::notify_all(epoch);
+      }
+    }
+
+  private:
+
+    // Non-copyable
+    atomic_event(const atomic_event&) ETL_DELETE;
+    atomic_event& operator=(const atomic_event&) ETL_DELETE;
+
+    etl::atomic<uint32_t> epoch;   ///< Changed by every notify().
+    etl::atomic<uint32_t> waiters; ///< The number of threads that may be about to sleep.
+  };
+#endif
+
+#if ETL_HAS_ATOMIC_WAIT
+  //***************************************************************************
+  ///\ingroup atomic_wait
+  /// Adds blocking push and pop to a lock-free queue, such as
+  /// etl::queue_spsc_atomic or etl::queue_mpmc_atomic.
+  /// The non-blocking functions wake any thread that is waiting on the other side.
+  /// With FreeRTOS, only one task may wait to push and one to pop.
+  /// \tparam TQueue The queue type.
+  //***************************************************************************
+  template <typename TQueue>
+  class blocking_queue : private TQueue
+  {
+  public:
+
+    typedef TQueue                           queue_type;
+    typedef typename TQueue::value_type      value_type;
+    typedef typename TQueue::reference       reference;
+    typedef typename TQueue::const_reference const_reference;
+#if ETL_USING_CPP11
+    typedef typename TQueue::rvalue_reference rvalue_reference;
+#endif
+    typedef typename TQueue::size_type       size_type;
+
+    //*************************************************************************
+    /// Push a value to the queue and wake a waiting consumer.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      return notify_if(TQueue::push(value), not_empty);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Push a value to the queue and wake a waiting consumer.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      return notify_if(TQueue::push(etl::move(value)), not_empty);
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place' and wakes a waiting consumer.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      return notify_if(TQueue::emplace(etl::forward<Args>(args)...), not_empty);
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place' and wakes a waiting consumer.
+    //*************************************************************************
+    bool emplace()
+    {
+      return notify_if(TQueue::emplace(), not_empty);
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place' and wakes a waiting consumer.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      return notify_if(TQueue::emplace(value1), not_empty);
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place' and wakes a waiting consumer.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      return notify_if(TQueue::emplace(value1, value2), not_empty);
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place' and wakes a waiting consumer.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return notify_if(TQueue::emplace(value1, value2, value3), not_empty);
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place' and wakes a waiting consumer.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return notify_if(TQueue::emplace(value1, value2, value3, value4), not_empty);
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue and wake a waiting producer.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      return notify_if(TQueue::pop(value), not_full);
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue, discarding it, and wake a waiting producer.
+    //*************************************************************************
+    bool pop()
+    {
+      return notify_if(TQueue::pop(), not_full);
+    }
+
+    //*************************************************************************
+    /// Push a value to the queue, blocking while the queue is full.
+    //*************************************************************************
+    void wait_push(const_reference value)
+    {
+      push_copy pusher = { this, &value };
+
+      not_full.wait(pusher);
+      not_empty.notify();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Push a value to the queue, blocking while the queue is full.
+    //*************************************************************************
+    void wait_push(rvalue_reference value)
+    {
+      push_move pusher = { this, &value };
+
+      not_full.wait(pusher);
+      not_empty.notify();
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue, blocking while the queue is empty.
+    //*************************************************************************
+    void wait_pop(reference value)
+    {
+      pop_value popper = { this, &value };
+
+      not_empty.wait(popper);
+      not_full.notify();
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue, discarding it, blocking while the queue is empty.
+    //*************************************************************************
+    void wait_pop()
+    {
+      pop_discard popper = { this };
+
+      not_empty.wait(popper);
+      not_full.notify();
+    }
+
+    //*************************************************************************
+    /// Clears the queue and wakes a waiting producer.
+    //*************************************************************************
+    void clear()
+    {
+      TQueue::clear();
+      not_full.notify();
+    }
+
+    //*************************************************************************
+    /// Wakes any threads that are blocked in wait_push() or wait_pop(), so
+    /// that they can try again. Only needed after the queue has been changed
+    /// through other means.
+    //*************************************************************************
+    void notify_all()
+    {
+      not_empty.notify();
+      not_full.notify();
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return TQueue::empty();
+    }
+
+    //*************************************************************************
+    bool full() const
+    {
+      return TQueue::full();
+    }
+
+    //*************************************************************************
+    size_type size() const
+    {
+      return TQueue::size();
+    }
+
+    //*************************************************************************
+    size_type available() const
+    {
+      return TQueue::available();
+    }
+
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return TQueue::capacity();
+    }
+
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return TQueue::max_size();
+    }
+
+  private:
+
+    //*************************************************************************
+    static bool notify_if(bool success, etl::atomic_event& event)
+    {
+      if (success)
+      {
+        event.notify();
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    // The predicates for the blocking functions.
+    //*************************************************************************
+    struct push_copy
+    {
+      bool operator()() const
+      {
+        return p_queue->TQueue::push(*p_value);
+      }
+
+      blocking_queue*   p_queue;
+      const value_type* p_value;
+    };
+
+#if ETL_USING_CPP11
+    struct push_move
+    {
+      bool operator()() const
+      {
+        // The value is only moved from when the push succeeds.
+        return p_queue->TQueue::push(etl::move(*p_value));
+      }
+
+      blocking_queue* p_queue;
+      value_type*     p_value;
+    };
+#endif
+
+    struct pop_value
+    {
+      bool operator()() const
+      {
+        return p_queue->TQueue::pop(*p_value);
+      }
+
+      blocking_queue* p_queue;
+      value_type*     p_value;
+    };
+
+    struct pop_discard
+    {
+      bool operator()() const
+      {
+        return p_queue->TQueue::pop();
+      }
+
+      blocking_queue* p_queue;
+    };
+
+    etl::atomic_event not_empty; ///< Notified when a value is pushed.
+    etl::atomic_event not_full;  ///< Notified when a value is popped.
+  };
+#endif
+}
+
+#endif
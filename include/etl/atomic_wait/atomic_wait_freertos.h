@@ -0,0 +1,121 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_FREERTOS_INCLUDED
+#define ETL_ATOMIC_WAIT_FREERTOS_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "../nullptr.h"
+
+#include "FreeRTOS.h"
+#include <task.h>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup atomic_wait
+  ///\brief This event is implemented using FreeRTOS's direct to task notifications.
+  /// Only one task may wait on an event at a time.
+  //***************************************************************************
+  class atomic_event
+  {
+  public:
+
+    atomic_event()
+      : waiting_task(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Blocks the calling task until ready() returns true.
+    /// ready() may be called several times, and may have side effects.
+    //*************************************************************************
+    template <typename TPredicate>
+    void wait(TPredicate ready)
+    {
+      while (!ready())
+      {
+        waiting_task.store(xTaskGetCurrentTaskHandle(), etl::memory_order_seq_cst);
+
+        // A notification given after this check is held by the task, so is not lost.
+        bool done = ready();
+
+        if (!done)
+        {
+          ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+
+        waiting_task.store(ETL_NULLPTR, etl::memory_order_relaxed);
+
+        if (done)
+        {
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Wakes the waiting task, if there is one.
+    //*************************************************************************
+    void notify()
+    {
+      TaskHandle_t task = waiting_task.load(etl::memory_order_seq_cst);
+
+      if (task != ETL_NULLPTR)
+      {
+        xTaskNotifyGive(task);
+      }
+    }
+
+    //*************************************************************************
+    /// Wakes the waiting task, if there is one, from an interrupt.
+    //*************************************************************************
+    void notify_from_isr()
+    {
+      TaskHandle_t task = waiting_task.load(etl::memory_order_seq_cst);
+
+      if (task != ETL_NULLPTR)
+      {
+        BaseType_t higher_priority_task_woken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &higher_priority_task_woken);
+        portYIELD_FROM_ISR(higher_priority_task_woken);
+      }
+    }
+
+  private:
+
+    // Non-copyable
+    atomic_event(const atomic_event&) ETL_DELETE;
+    atomic_event& operator=(const atomic_event&) ETL_DELETE;
+
+    etl::atomic<TaskHandle_t> waiting_task;
+  };
+}
+
+#endif
@@ -0,0 +1,89 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_FUTEX_INCLUDED
+#define ETL_ATOMIC_WAIT_FUTEX_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "../static_assert.h"
+#include "../nullptr.h"
+
+#include <stdint.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace etl
+{
+  namespace private_atomic_wait
+  {
+    //*************************************************************************
+    /// Blocks and wakes using the Linux futex system call.
+    //*************************************************************************
+    struct wait_policy
+    {
+      ETL_STATIC_ASSERT(sizeof(etl::atomic<uint32_t>) == sizeof(uint32_t), "etl::atomic<uint32_t> must have the layout of uint32_t");
+
+      static void wait(etl::atomic<uint32_t>& epoch, uint32_t old_value)
+      {
+        // Returns at once if the epoch no longer holds old_value.
+        syscall(SYS_futex, address_of(epoch), FUTEX_WAIT_PRIVATE, old_value, ETL_NULLPTR, ETL_NULLPTR, 0);
+      }
+
+      static void notify_all(etl::atomic<uint32_t>& epoch)
+      {
+        syscall(SYS_futex, address_of(epoch), FUTEX_WAKE_PRIVATE, INT_MAX, ETL_NULLPTR, ETL_NULLPTR, 0);
+      }
+
+      //***********************************************************************
+      /// As wait() and notify_all(), for a value in memory that is shared
+      /// between processes.
+      //***********************************************************************
+      static void wait_shared(etl::atomic<uint32_t>& epoch, uint32_t old_value)
+      {
+        syscall(SYS_futex, address_of(epoch), FUTEX_WAIT, old_value, ETL_NULLPTR, ETL_NULLPTR, 0);
+      }
+
+      static void notify_all_shared(etl::atomic<uint32_t>& epoch)
+      {
+        syscall(SYS_futex, address_of(epoch), FUTEX_WAKE, INT_MAX, ETL_NULLPTR, ETL_NULLPTR, 0);
+      }
+
+    private:
+
+      static uint32_t* address_of(etl::atomic<uint32_t>& epoch)
+      {
+        return reinterpret_cast<uint32_t*>(&epoch);
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,60 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_STD_INCLUDED
+#define ETL_ATOMIC_WAIT_STD_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+
+#include <atomic>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_atomic_wait
+  {
+    //*************************************************************************
+    /// Blocks and wakes using C++20 std::atomic wait and notify.
+    //*************************************************************************
+    struct wait_policy
+    {
+      static void wait(std::atomic<uint32_t>& epoch, uint32_t old_value)
+      {
+        epoch.wait(old_value, std::memory_order_seq_cst);
+      }
+
+      static void notify_all(std::atomic<uint32_t>& epoch)
+      {
+        epoch.notify_all();
+      }
+    };
+  }
+}
+
+#endif
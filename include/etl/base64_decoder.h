@@ -41,6 +41,7 @@ SOFTWARE.
 #include "span.h"
 
 #include "base64.h"
+#include "private/base64_simd.h"
 
 #include <stdint.h>
 
@@ -106,15 +107,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_begin != input_end)
-      {
-        if (!decode(*input_begin++))
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return decode_range(input_begin, input_end);
     }
 
     //*************************************************************************
@@ -126,12 +119,36 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_length-- != 0)
+      while (input_length != 0U)
       {
+        // Decode whole blocks of contiguous input straight to the output buffer.
+        const size_t n_blocks = whole_blocks(input_length);
+
+        if (n_blocks != 0U)
+        {
+          const size_t decoded = decode_blocks(input_begin, n_blocks);
+
+          if (decoded != 0U)
+          {
+            input_length -= (decoded * 4U);
+
+            if (callback.is_valid() && output_buffer_is_full())
+            {
+              callback(span());
+              reset_output_buffer();
+            }
+
+            continue;
+          }
+        }
+
+        // Otherwise, one character at a time.
         if (!decode(*input_begin++))
         {
           return false;
         }
+
+        --input_length;
       }
 
       return true;
@@ -342,6 +359,142 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Decode a range one value at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    bool decode_range(TInputIterator input_begin, TInputIterator input_end)
+    {
+      while (input_begin != input_end)
+      {
+        if (!decode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Decode a contiguous range by its length.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    bool decode_range(T* input_begin, T* input_end)
+    {
+      return decode(input_begin, static_cast<size_t>(input_end - input_begin));
+    }
+
+    //*************************************************************************
+    // The number of whole blocks of the input that could be decoded straight
+    // to the output buffer.
+    //*************************************************************************
+    ETL_CONSTEXPR14
+    size_t whole_blocks(size_t input_length) const
+    {
+      if ((input_buffer_length != 0U) || padding_received || error())
+      {
+        return 0U;
+      }
+
+      const size_t input_blocks  = input_length / 4U;
+      const size_t output_blocks = (output_buffer_max_size - output_buffer_length) / 3U;
+
+      return (input_blocks < output_blocks) ? input_blocks : output_blocks;
+    }
+
+    //*************************************************************************
+    // Only contiguous input is decoded in whole blocks, as the characters of a
+    // block are checked before they are consumed.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    size_t decode_blocks(TInputIterator&, size_t)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    // Decode whole blocks of contiguous input straight to the output buffer,
+    // up to the first block that is not four characters of the table.
+    // Advances input and returns the number of blocks decoded.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    size_t decode_blocks(T*& input, size_t n_blocks)
+    {
+      unsigned char* p_output  = p_output_buffer + output_buffer_length;
+      size_t         remaining = n_blocks;
+      const char     char_62   = encoder_table[62];
+      const char     char_63   = encoder_table[63];
+
+#if ETL_BASE64_USING_SIMD
+      if (!private_base64::is_constant_evaluated())
+      {
+        const char* p_input = reinterpret_cast<const char*>(input);
+
+        private_base64::simd_decode(p_input, p_output, remaining, encoder_table);
+
+        input += ((n_blocks - remaining) * 4U);
+      }
+#endif
+
+      while (remaining != 0U)
+      {
+        const uint32_t index0 = index_from_sextet(input[0], char_62, char_63);
+        const uint32_t index1 = index_from_sextet(input[1], char_62, char_63);
+        const uint32_t index2 = index_from_sextet(input[2], char_62, char_63);
+        const uint32_t index3 = index_from_sextet(input[3], char_62, char_63);
+
+        if ((index0 | index1 | index2 | index3) > 63U)
+        {
+          break;
+        }
+
+        const uint32_t sextets = (index0 << 18) | (index1 << 12) | (index2 << 6) | index3;
+
+        *p_output++ = static_cast<unsigned char>(sextets >> 16);
+        *p_output++ = static_cast<unsigned char>(sextets >> 8);
+        *p_output++ = static_cast<unsigned char>(sextets >> 0);
+
+        input += 4U;
+        --remaining;
+      }
+
+      const size_t decoded = n_blocks - remaining;
+
+      output_buffer_length += (decoded * 3U);
+
+      return decoded;
+    }
+
+    //*************************************************************************
+    // Translates a sextet into an index.
+    // Returns a value greater than 63 if the sextet is not in the table.
+    // Every table has 'A' to 'Z', 'a' to 'z' and '0' to '9' at the start.
+    //*************************************************************************
+    template <typename T>
+    ETL_NODISCARD
+    static
+    ETL_CONSTEXPR14
+    uint32_t index_from_sextet(T sextet, char char_62, char char_63)
+    {
+      const uint32_t c = static_cast<uint32_t>(static_cast<unsigned char>(sextet));
+
+      // Masks, rather than branches, as the ranges are unpredictable.
+      const uint32_t is_upper = 0U - static_cast<uint32_t>((c - 'A') < 26U);
+      const uint32_t is_lower = 0U - static_cast<uint32_t>((c - 'a') < 26U);
+      const uint32_t is_digit = 0U - static_cast<uint32_t>((c - '0') < 10U);
+      const uint32_t is_62    = 0U - static_cast<uint32_t>(static_cast<char>(sextet) == char_62);
+      const uint32_t is_63    = 0U - static_cast<uint32_t>(static_cast<char>(sextet) == char_63);
+      const uint32_t is_other = ~(is_upper | is_lower | is_digit | is_62 | is_63);
+
+      return (is_upper & (c - 'A')) | (is_lower & (c - 'a' + 26U)) | (is_digit & (c - '0' + 52U)) |
+             (is_62 & 62U) | (is_63 & 63U) | (is_other & 64U);
+    }
+
     //*************************************************************************
     // Translates a sextet into an index
     //*************************************************************************
@@ -349,12 +502,11 @@ namespace etl
     ETL_CONSTEXPR14
     uint32_t get_index_from_sextet(T sextet)
     {
-      const char* encoder_table_end = encoder_table + 64;
-      const char* p_sextet = etl::find(encoder_table, encoder_table_end, static_cast<char>(sextet));
+      const uint32_t index = index_from_sextet(sextet, encoder_table[62], encoder_table[63]);
 
-      if (p_sextet != encoder_table_end)
+      if (index < 64U)
       {
-        return static_cast<uint32_t>(etl::distance(encoder_table, p_sextet));
+        return index;
       }
       else
       {
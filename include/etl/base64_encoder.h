@@ -41,6 +41,7 @@ SOFTWARE.
 #include "span.h"
 
 #include "base64.h"
+#include "private/base64_simd.h"
 
 #include <stdint.h>
 
@@ -104,6 +105,35 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      // Complete any partially filled block.
+      while ((input_length != 0U) && (input_buffer_length != 0U))
+      {
+        if (!encode(*input_begin++))
+        {
+          return false;
+        }
+
+        --input_length;
+      }
+
+      // Encode whole blocks straight to the output buffer.
+      size_t n_blocks = whole_blocks(input_length);
+
+      while (n_blocks != 0U)
+      {
+        encode_blocks(input_begin, n_blocks);
+        input_length -= (n_blocks * 3U);
+
+        if (callback.is_valid() && output_buffer_is_full())
+        {
+          callback(span());
+          reset_output_buffer();
+        }
+
+        n_blocks = whole_blocks(input_length);
+      }
+
+      // Encode the rest.
       while (input_length-- != 0)
       {
         if (!encode(*input_begin++))
@@ -124,15 +154,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_begin != input_end)
-      {
-        if (!encode(*input_begin++))
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return encode_range(input_begin, input_end);
     }
 
     //*************************************************************************
@@ -417,6 +439,101 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Encode a range one value at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    bool encode_range(TInputIterator input_begin, TInputIterator input_end)
+    {
+      while (input_begin != input_end)
+      {
+        if (!encode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Encode a contiguous range by its length.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    bool encode_range(T* input_begin, T* input_end)
+    {
+      return encode(input_begin, static_cast<size_t>(input_end - input_begin));
+    }
+
+    //*************************************************************************
+    // The number of whole blocks of the input that can be encoded straight to
+    // the output buffer.
+    //*************************************************************************
+    ETL_CONSTEXPR14
+    size_t whole_blocks(size_t input_length) const
+    {
+      if (error())
+      {
+        return 0U;
+      }
+
+      const size_t input_blocks  = input_length / 3U;
+      const size_t output_blocks = (output_buffer_max_size - output_buffer_length) / 4U;
+
+      return (input_blocks < output_blocks) ? input_blocks : output_blocks;
+    }
+
+    //*************************************************************************
+    // Encode whole blocks straight to the output buffer.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    void encode_blocks(TInputIterator& input, size_t n_blocks)
+    {
+      char* p_output = p_output_buffer + output_buffer_length;
+
+      output_buffer_length += (n_blocks * 4U);
+
+      while (n_blocks-- != 0U)
+      {
+        uint32_t octets = static_cast<uint32_t>(static_cast<uint8_t>(*input++)) << 16;
+        octets |= static_cast<uint32_t>(static_cast<uint8_t>(*input++)) << 8;
+        octets |= static_cast<uint32_t>(static_cast<uint8_t>(*input++));
+
+        *p_output++ = encoder_table[(octets >> 18) & 0x3F];
+        *p_output++ = encoder_table[(octets >> 12) & 0x3F];
+        *p_output++ = encoder_table[(octets >>  6) & 0x3F];
+        *p_output++ = encoder_table[(octets >>  0) & 0x3F];
+      }
+    }
+
+    //*************************************************************************
+    // Encode whole blocks of contiguous input straight to the output buffer.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    void encode_blocks(T*& input, size_t n_blocks)
+    {
+#if ETL_BASE64_USING_SIMD
+      if (!private_base64::is_constant_evaluated())
+      {
+        const uint8_t* p_input  = reinterpret_cast<const uint8_t*>(input);
+        char*          p_output = p_output_buffer + output_buffer_length;
+        const size_t   total    = n_blocks;
+
+        private_base64::simd_encode(p_input, p_output, n_blocks, encoder_table);
+
+        input                += ((total - n_blocks) * 3U);
+        output_buffer_length += ((total - n_blocks) * 4U);
+      }
+#endif
+
+      // The remaining blocks.
+      encode_blocks<T*>(input, n_blocks);
+    }
+
     //*************************************************************************
     // Push to the output buffer.
     //*************************************************************************
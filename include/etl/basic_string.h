@@ -47,6 +47,7 @@ SOFTWARE.
 #include "exception.h"
 #include "binary.h"
 #include "flags.h"
+#include "private/string_search.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -1374,21 +1375,7 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      if ((pos + str.size()) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return private_string_search::find_substring(p_buffer, size(), pos, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1398,23 +1385,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos = 0) const
     {
-#if ETL_IS_DEBUG_BUILD
-      if ((pos + etl::strlen(s)) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return private_string_search::find_substring(p_buffer, size(), pos, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1425,23 +1396,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos, size_type n) const
     {
-#if ETL_IS_DEBUG_BUILD
-      if ((pos + etl::strlen(s) - n) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return private_string_search::find_substring(p_buffer, size(), pos, s, n);
     }
 
     //*********************************************************************
@@ -1451,16 +1406,7 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return etl::distance(begin(), i);
-      }
-      else
-      {
-        return npos;
-      }
+      return private_string_search::find_char(p_buffer, size(), position, c);
     }
 
     //*********************************************************************
@@ -1912,21 +1858,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return private_string_search::find_first_of(p_buffer, size(), position, s, n);
     }
 
     //*********************************************************************
@@ -1936,18 +1868,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return private_string_search::find_char(p_buffer, size(), position, c);
     }
 
     //*********************************************************************
@@ -1978,30 +1899,7 @@ namespace etl
     //*********************************************************************
     size_type find_last_of(const_pointer s, size_type position, size_type n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return private_string_search::find_last_of(p_buffer, size(), position, s, n);
     }
 
     //*********************************************************************
@@ -2062,28 +1960,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return private_string_search::find_first_not_of(p_buffer, size(), position, s, n);
     }
 
     //*********************************************************************
@@ -2135,37 +2012,7 @@ namespace etl
     //*********************************************************************
     size_type find_last_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return private_string_search::find_last_not_of(p_buffer, size(), position, s, n);
     }
 
     //*********************************************************************
@@ -0,0 +1,387 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BASIC_STRING_SINK_STREAM_INCLUDED
+#define ETL_BASIC_STRING_SINK_STREAM_INCLUDED
+
+///\ingroup string
+
+#include "platform.h"
+#include "algorithm.h"
+#include "delegate.h"
+#include "to_string.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// A string stream that writes through a small buffer to a sink.
+  /// When the buffer fills, its contents are passed to the flush delegate and
+  /// it is cleared, so output of any length is formatted in constant memory.
+  /// The delegate may send the text to a UART, a queue or a file; the view it
+  /// is given is only valid for the duration of the call.
+  /// A value whose text does not fit in the rest of the buffer is formatted
+  /// again after a flush, so values are not split, except for strings and
+  /// values longer than the whole buffer.
+  /// The remaining text is flushed when the stream is destroyed.
+  //***************************************************************************
+  template <typename TFormat, typename TIString, typename TStringView>
+  class basic_string_sink_stream
+  {
+  public:
+
+    typedef TFormat                          format_spec_type;
+    typedef TIString                         istring_type;
+    typedef TStringView                      string_view_type;
+    typedef typename TIString::value_type    value_type;
+    typedef typename TIString::size_type     size_type;
+    typedef typename TIString::pointer       pointer;
+    typedef typename TIString::const_pointer const_pointer;
+    typedef etl::delegate<void(TStringView)> flush_type;
+
+    //*************************************************************************
+    /// Construct from a buffer and a flush delegate.
+    //*************************************************************************
+    basic_string_sink_stream(TIString& buffer_, const flush_type& flush_function_)
+      : text(buffer_)
+      , flush_function(flush_function_)
+      , flushed(0U)
+    {
+      text.clear();
+    }
+
+    //*************************************************************************
+    /// Construct from a buffer, a flush delegate and format fmt.
+    //*************************************************************************
+    basic_string_sink_stream(TIString& buffer_, const flush_type& flush_function_, const TFormat& spec_)
+      : text(buffer_)
+      , format(spec_)
+      , flush_function(flush_function_)
+      , flushed(0U)
+    {
+      text.clear();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Flushes any remaining text.
+    //*************************************************************************
+    ~basic_string_sink_stream()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Set the format fmt.
+    //*************************************************************************
+    void set_format(const TFormat& spec_)
+    {
+      format = spec_;
+    }
+
+    //*************************************************************************
+    /// Get a const reference to the format fmt.
+    //*************************************************************************
+    const TFormat& get_format() const
+    {
+      return format;
+    }
+
+    //*************************************************************************
+    /// Set the flush delegate.
+    //*************************************************************************
+    void set_flush(const flush_type& flush_function_)
+    {
+      flush_function = flush_function_;
+    }
+
+    //*************************************************************************
+    /// Passes the buffered text to the flush delegate and clears the buffer.
+    //*************************************************************************
+    void flush()
+    {
+      if (!text.empty())
+      {
+        if (flush_function.is_valid())
+        {
+          flush_function(TStringView(text.data(), text.size()));
+        }
+
+        flushed += text.size();
+        text.clear();
+      }
+    }
+
+    //*************************************************************************
+    /// The number of characters waiting to be flushed.
+    //*************************************************************************
+    size_type size() const
+    {
+      return text.size();
+    }
+
+    //*************************************************************************
+    /// The total number of characters written to the stream.
+    //*************************************************************************
+    size_t count() const
+    {
+      return flushed + text.size();
+    }
+
+    //*************************************************************************
+    /// Stream operators.
+    //*************************************************************************
+
+    //*********************************
+    /// TFormat
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, const TFormat& fmt)
+    {
+      ss.format = fmt;
+      return ss;
+    }
+
+    //*********************************
+    /// etl::base_spec from etl::setbase, etl::bin, etl::oct, etl::dec & etl::hex stream manipulators
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::base_spec fmt)
+    {
+      ss.format.base(fmt.base);
+      return ss;
+    }
+
+    //*********************************
+    /// etl::width_spec from etl::setw stream manipulator
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::width_spec fmt)
+    {
+      ss.format.width(fmt.width);
+      return ss;
+    }
+
+    //*********************************
+    /// etl::fill_spec from etl::setfill stream manipulator
+    //*********************************
+    template <typename TChar>
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::fill_spec<TChar> fmt)
+    {
+      ss.format.fill(fmt.fill);
+      return ss;
+    }
+
+    //*********************************
+    /// etl::precision_spec from etl::setprecision stream manipulator
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::precision_spec fmt)
+    {
+      ss.format.precision(fmt.precision);
+      return ss;
+    }
+
+    //*********************************
+    /// etl::boolalpha_spec from etl::boolalpha & etl::noboolalpha stream manipulators
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::boolalpha_spec fmt)
+    {
+      ss.format.boolalpha(fmt.boolalpha);
+      return ss;
+    }
+
+    //*********************************
+    /// etl::uppercase_spec from etl::uppercase & etl::nouppercase stream manipulators
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::uppercase_spec fmt)
+    {
+      ss.format.upper_case(fmt.upper_case);
+      return ss;
+    }
+
+    //*********************************
+    /// etl::showbase_spec from etl::showbase & etl::noshowbase stream manipulators
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::showbase_spec fmt)
+    {
+      ss.format.show_base(fmt.show_base);
+      return ss;
+    }
+
+    //*********************************
+    /// etl::shortest_spec from etl::shortest & etl::noshortest stream manipulators
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::shortest_spec fmt)
+    {
+      ss.format.shortest(fmt.shortest);
+      return ss;
+    }
+
+    //*********************************
+    /// etl::left_spec from etl::left stream manipulator
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::left_spec /*fmt*/)
+    {
+      ss.format.left();
+      return ss;
+    }
+
+    //*********************************
+    /// etl::right_spec from etl::left stream manipulator
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, etl::private_basic_format_spec::right_spec /*fmt*/)
+    {
+      ss.format.right();
+      return ss;
+    }
+
+    //*********************************
+    /// From a string view
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, TStringView view)
+    {
+      ss.write_view(view);
+      return ss;
+    }
+
+    //*********************************
+    /// From a character pointer to a string
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, pointer p)
+    {
+      ss.write_view(TStringView(p));
+      return ss;
+    }
+
+    //*********************************
+    /// From a const character pointer to a string
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, const_pointer p)
+    {
+      ss.write_view(TStringView(p));
+      return ss;
+    }
+
+    //*********************************
+    /// From a string interface
+    //*********************************
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, const TIString& t)
+    {
+      ss.write_view(TStringView(t.data(), t.size()));
+      return ss;
+    }
+
+    //*********************************
+    /// From a string
+    //*********************************
+    template <template <size_t> class TString, size_t SIZE>
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, const TString<SIZE>& t)
+    {
+      const TIString& itext = t;
+      ss.write_view(TStringView(itext.data(), itext.size()));
+      return ss;
+    }
+
+    //*********************************
+    /// From anything else
+    //*********************************
+    template <typename T>
+    friend basic_string_sink_stream& operator <<(basic_string_sink_stream& ss, const T& value)
+    {
+      ss.write_value(value);
+      return ss;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Writes a string, a buffer at a time.
+    /// Padded strings are written as values.
+    //*************************************************************************
+    void write_view(TStringView view)
+    {
+      if (format.get_width() > view.size())
+      {
+        write_value(view);
+      }
+      else
+      {
+        while (!view.empty())
+        {
+          const size_type length = etl::min(text.available(), size_type(view.size()));
+
+          text.append(view.data(), length);
+          view.remove_prefix(length);
+
+          flush_if_full();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the text of a value.
+    /// A full buffer may mean that the text was truncated, so the buffer is
+    /// restored and flushed, and the value formatted again.
+    //*************************************************************************
+    template <typename T>
+    void write_value(const T& value)
+    {
+      const size_type start = text.size();
+
+      etl::to_string(value, text, format, true);
+
+      if (text.full() && (start != 0U))
+      {
+        text.resize(start);
+        flush();
+        etl::to_string(value, text, format, true);
+      }
+
+      flush_if_full();
+    }
+
+    //*************************************************************************
+    /// Flushes the buffer if there is no more room.
+    //*************************************************************************
+    void flush_if_full()
+    {
+      if (text.full())
+      {
+        flush();
+      }
+    }
+
+    TIString&  text;
+    TFormat    format;
+    flush_type flush_function;
+    size_t     flushed;
+
+    basic_string_sink_stream(const basic_string_sink_stream&) ETL_DELETE;
+    basic_string_sink_stream& operator =(const basic_string_sink_stream&) ETL_DELETE;
+  };
+}
+
+#endif
@@ -0,0 +1,472 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include "platform.h"
+#include "cycle_counter.h"
+#include "histogram.h"
+#include "binary.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup benchmark benchmark
+/// Helpers for cycle count microbenchmarks, on hosts and bare metal.
+/// Times are read with ETL_CYCLE_COUNTER().
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Stops the compiler from optimising away the calculation of a value.
+  ///\ingroup benchmark
+  //***************************************************************************
+  template <typename T>
+  void do_not_optimize(const T& value)
+  {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    __asm__ __volatile__("" : : "r"(&value) : "memory");
+#else
+    const volatile char* volatile p = reinterpret_cast<const volatile char*>(&value);
+    (void)*p;
+#endif
+  }
+
+  //***************************************************************************
+  /// Stops the compiler from moving memory accesses across this point.
+  ///\ingroup benchmark
+  //***************************************************************************
+  inline void clobber_memory()
+  {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    __asm__ __volatile__("" : : : "memory");
+#endif
+  }
+
+  //***************************************************************************
+  /// The cycle counts of a set of runs.
+  ///\ingroup benchmark
+  //***************************************************************************
+  struct benchmark_result
+  {
+    benchmark_result()
+      : minimum(0xFFFFFFFFUL)
+      , maximum(0U)
+      , total(0U)
+      , runs(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds the cycle count of a run.
+    //*************************************************************************
+    void add(uint32_t cycles)
+    {
+      minimum = (cycles < minimum) ? cycles : minimum;
+      maximum = (cycles > maximum) ? cycles : maximum;
+      total  += cycles;
+      ++runs;
+    }
+
+    //*************************************************************************
+    /// The mean cycles per run.
+    //*************************************************************************
+    uint32_t mean() const
+    {
+      return (runs == 0U) ? 0U : static_cast<uint32_t>(total / runs);
+    }
+
+    //*************************************************************************
+    /// The cycles per item for the fastest run, where each run handles
+    /// 'items' items, scaled by 'scale'.
+    /// e.g. per_item(n, 1000) is the cycles per thousand items.
+    //*************************************************************************
+    uint32_t per_item(size_t items, uint32_t scale = 1U) const
+    {
+      return ((runs == 0U) || (items == 0U)) ? 0U : static_cast<uint32_t>((uint64_t(minimum) * scale) / items);
+    }
+
+    uint32_t minimum; ///< The fastest run.
+    uint32_t maximum; ///< The slowest run.
+    uint64_t total;   ///< The sum of all runs.
+    uint32_t runs;    ///< The number of runs.
+  };
+
+  namespace private_benchmark
+  {
+    //*************************************************************************
+    /// The cost of reading the counter.
+    //*************************************************************************
+    inline uint32_t counter_overhead()
+    {
+      uint32_t overhead = 0xFFFFFFFFUL;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        const uint32_t start = uint32_t(ETL_CYCLE_COUNTER());
+        etl::clobber_memory();
+        const uint32_t cycles = uint32_t(ETL_CYCLE_COUNTER()) - start;
+
+        overhead = (cycles < overhead) ? cycles : overhead;
+      }
+
+      return overhead;
+    }
+
+    //*************************************************************************
+    /// Times one call of 'function', less the cost of reading the counter.
+    //*************************************************************************
+    template <typename TFunction>
+    uint32_t time(TFunction& function, uint32_t overhead)
+    {
+      const uint32_t start = uint32_t(ETL_CYCLE_COUNTER());
+      etl::clobber_memory();
+      function();
+      etl::clobber_memory();
+      const uint32_t cycles = uint32_t(ETL_CYCLE_COUNTER()) - start;
+
+      return (cycles > overhead) ? (cycles - overhead) : 0U;
+    }
+  }
+
+  //***************************************************************************
+  /// Calls 'function' 'runs' times and returns the cycle counts.
+  /// The cost of reading the counter is subtracted from each run.
+  /// The minimum is the most repeatable figure for comparisons.
+  ///\ingroup benchmark
+  //***************************************************************************
+  template <typename TFunction>
+  etl::benchmark_result benchmark(TFunction function, uint32_t runs)
+  {
+    const uint32_t overhead = private_benchmark::counter_overhead();
+
+    etl::benchmark_result result;
+
+    for (uint32_t i = 0U; i < runs; ++i)
+    {
+      result.add(private_benchmark::time(function, overhead));
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Calls 'setup' then 'function' 'runs' times and returns the cycle counts
+  /// of 'function' only.
+  /// Use to restore state, such as emptying a container, between runs.
+  ///\ingroup benchmark
+  //***************************************************************************
+  template <typename TSetup, typename TFunction>
+  etl::benchmark_result benchmark(TSetup setup, TFunction function, uint32_t runs)
+  {
+    const uint32_t overhead = private_benchmark::counter_overhead();
+
+    etl::benchmark_result result;
+
+    for (uint32_t i = 0U; i < runs; ++i)
+    {
+      setup();
+      result.add(private_benchmark::time(function, overhead));
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// A timestamp carried with a message or event, for measuring the latency
+  /// from where it is published to where it is handled, across queues, buses,
+  /// brokers, routers and state machines.
+  ///\ingroup benchmark
+  //***************************************************************************
+  class latency_stamp
+  {
+  public:
+
+    latency_stamp()
+      : start(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Records the time now.
+    //*************************************************************************
+    void stamp()
+    {
+      start = uint32_t(ETL_CYCLE_COUNTER());
+    }
+
+    //*************************************************************************
+    /// The cycles since stamp() was called.
+    //*************************************************************************
+    uint32_t elapsed() const
+    {
+      return uint32_t(ETL_CYCLE_COUNTER()) - start;
+    }
+
+    //*************************************************************************
+    /// The recorded time.
+    //*************************************************************************
+    uint32_t value() const
+    {
+      return start;
+    }
+
+  private:
+
+    uint32_t start;
+  };
+
+  //***************************************************************************
+  /// A histogram of latencies, in power of two buckets.
+  /// Bucket 'n' counts the latencies that need 'n' bits, i.e. 2^(n-1) to
+  /// 2^n - 1. Bucket 0 counts latencies of zero.
+  ///\ingroup benchmark
+  //***************************************************************************
+  class latency_histogram
+  {
+  public:
+
+    typedef etl::histogram<uint8_t, uint32_t, 33U, 0> histogram_type;
+
+    latency_histogram()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Adds a latency.
+    //*************************************************************************
+    void add(uint32_t latency)
+    {
+      buckets.add(bucket(latency));
+
+      minimum = (latency < minimum) ? latency : minimum;
+      maximum = (latency > maximum) ? latency : maximum;
+      total  += latency;
+      ++counter;
+    }
+
+    //*************************************************************************
+    /// Gets an upper bound for the latency percentile, from 0 to 100.
+    /// Accurate to a power of two.
+    //*************************************************************************
+    uint32_t percentile(double percentile_) const
+    {
+      if (counter == 0U)
+      {
+        return 0U;
+      }
+
+      const uint8_t n = buckets.percentile(percentile_);
+
+      return (n == 0U) ? 0U : static_cast<uint32_t>(0xFFFFFFFFUL >> (32U - n));
+    }
+
+    //*************************************************************************
+    /// The number of latencies in bucket 'n'.
+    //*************************************************************************
+    uint32_t bucket_count(uint8_t n) const
+    {
+      return buckets[n];
+    }
+
+    //*************************************************************************
+    /// The lowest latency.
+    //*************************************************************************
+    uint32_t best_case() const
+    {
+      return (counter == 0U) ? 0U : minimum;
+    }
+
+    //*************************************************************************
+    /// The highest latency.
+    //*************************************************************************
+    uint32_t worst_case() const
+    {
+      return maximum;
+    }
+
+    //*************************************************************************
+    /// The mean latency.
+    //*************************************************************************
+    uint32_t mean() const
+    {
+      return (counter == 0U) ? 0U : static_cast<uint32_t>(total / counter);
+    }
+
+    //*************************************************************************
+    /// The number of latencies added.
+    //*************************************************************************
+    uint32_t count() const
+    {
+      return counter;
+    }
+
+    //*************************************************************************
+    /// Gets the histogram.
+    //*************************************************************************
+    const histogram_type& histogram() const
+    {
+      return buckets;
+    }
+
+    //*************************************************************************
+    /// Clears the latencies.
+    //*************************************************************************
+    void clear()
+    {
+      buckets.clear();
+      minimum = 0xFFFFFFFFUL;
+      maximum = 0U;
+      total   = 0U;
+      counter = 0U;
+    }
+
+    //*************************************************************************
+    /// The histogram bucket for a latency.
+    //*************************************************************************
+    static uint8_t bucket(uint32_t latency)
+    {
+      return (latency == 0U) ? 0U : static_cast<uint8_t>(32U - etl::count_leading_zeros(latency));
+    }
+
+  private:
+
+    histogram_type buckets;
+    uint32_t       minimum;
+    uint32_t       maximum;
+    uint64_t       total;
+    uint32_t       counter;
+  };
+
+  //***************************************************************************
+  /// End to end latencies for the VStages hops of a message chain.
+  /// e.g. ISR -> queue_spsc_isr -> message_bus -> message_router.
+  /// The publisher stamps a latency_stamp carried in the message, and each
+  /// hop records the cycles since the stamp under its stage number.
+  /// The throughput is measured over the window from start() to stop().
+  /// Records from one context at a time per stage.
+  ///\ingroup benchmark
+  //***************************************************************************
+  template <size_t VStages>
+  class latency_chain
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VStages > 0U, "Zero stages");
+
+    static ETL_CONSTANT size_t Stages = VStages;
+
+    latency_chain()
+      : window_start(0U)
+      , window_cycles(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Clears the latencies and starts the throughput window.
+    //*************************************************************************
+    void start()
+    {
+      for (size_t i = 0U; i < VStages; ++i)
+      {
+        stages[i].clear();
+      }
+
+      window_cycles = 0U;
+      window_start  = uint32_t(ETL_CYCLE_COUNTER());
+    }
+
+    //*************************************************************************
+    /// Ends the throughput window.
+    //*************************************************************************
+    void stop()
+    {
+      window_cycles = uint32_t(ETL_CYCLE_COUNTER()) - window_start;
+    }
+
+    //*************************************************************************
+    /// Records the latency of a message at a stage.
+    //*************************************************************************
+    void record(size_t stage, const etl::latency_stamp& stamp)
+    {
+      stages[stage].add(stamp.elapsed());
+    }
+
+    //*************************************************************************
+    /// Records a latency at a stage.
+    //*************************************************************************
+    void record(size_t stage, uint32_t latency)
+    {
+      stages[stage].add(latency);
+    }
+
+    //*************************************************************************
+    /// Gets the latencies for a stage.
+    //*************************************************************************
+    const etl::latency_histogram& operator [](size_t stage) const
+    {
+      return stages[stage];
+    }
+
+    //*************************************************************************
+    /// The cycles of the throughput window.
+    //*************************************************************************
+    uint32_t elapsed() const
+    {
+      return window_cycles;
+    }
+
+    //*************************************************************************
+    /// The window cycles per message reaching a stage, scaled by 'scale'.
+    /// e.g. cycles_per_message(n, 1000) is the cycles per thousand messages.
+    //*************************************************************************
+    uint32_t cycles_per_message(size_t stage, uint32_t scale = 1U) const
+    {
+      const uint32_t count = stages[stage].count();
+
+      return (count == 0U) ? 0U : static_cast<uint32_t>((uint64_t(window_cycles) * scale) / count);
+    }
+
+  private:
+
+    etl::latency_histogram stages[VStages];
+    uint32_t               window_start;
+    uint32_t               window_cycles;
+  };
+
+  template <size_t VStages>
+  ETL_CONSTANT size_t latency_chain<VStages>::Stages;
+}
+
+#endif
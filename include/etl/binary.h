@@ -900,6 +900,8 @@ namespace etl
   {
 #if ETL_CPP23_SUPPORTED && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return static_cast<uint_least8_t>(__builtin_popcount(value));
 #else
     uint32_t count = 0U;
 
@@ -923,6 +925,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return static_cast<uint_least8_t>(__builtin_popcount(value));
 #else
     uint32_t count = 0U;
 
@@ -946,6 +950,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return static_cast<uint_least8_t>(__builtin_popcount(value));
 #else
     uint32_t count = 0U;
 
@@ -971,6 +977,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return static_cast<uint_least8_t>(__builtin_popcountll(value));
 #else
     uint64_t count = 0U;
 
@@ -1093,6 +1101,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return (value == 0U) ? uint_least8_t(8U) : static_cast<uint_least8_t>(__builtin_ctz(value));
 #else
     uint_least8_t count = 0U;
 
@@ -1142,6 +1152,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return (value == 0U) ? uint_least8_t(16U) : static_cast<uint_least8_t>(__builtin_ctz(value));
 #else
     uint_least8_t count = 0U;
 
@@ -1196,6 +1208,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return (value == 0U) ? uint_least8_t(32U) : static_cast<uint_least8_t>(__builtin_ctz(value));
 #else
     uint_least8_t count = 0U;
 
@@ -1257,6 +1271,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return (value == 0U) ? uint_least8_t(64U) : static_cast<uint_least8_t>(__builtin_ctzll(value));
 #else
       uint_least8_t count = 0U;
 
@@ -1754,7 +1770,7 @@ namespace etl
     {
       count = 1U;
 
-      if ((value & 0xFFFFFFFFF0000000ULL) == 0U)
+      if ((value & 0xFFFFFFFF00000000ULL) == 0U)
       {
         value <<= 32U;
         count += 32U;
@@ -1809,7 +1825,7 @@ namespace etl
   {
     typedef typename etl::make_unsigned<T>::type unsigned_t;
 
-    return static_cast<T>(count_trailing_ones(static_cast<unsigned_t>(value)));
+    return static_cast<T>(count_leading_zeros(static_cast<unsigned_t>(value)));
   }
 
 #if ETL_USING_8BIT_TYPES
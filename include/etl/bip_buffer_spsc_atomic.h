@@ -48,6 +48,7 @@ SOFTWARE.
 #include "utility.h"
 #include "error_handler.h"
 #include "span.h"
+#include "array.h"
 #include "file_error_numbers.h"
 
 #include <stddef.h>
@@ -246,8 +247,8 @@ namespace etl
       }
       else // read_index > write_index
       {
-        // Doesn't fit
-        if ((write_index + *psize) >= read_index)
+        // Doesn't fit. Written so as not to overflow when *psize is the maximum.
+        if (*psize >= (read_index - write_index))
         {
           *psize = read_index - write_index - 1;
         }
@@ -336,6 +337,102 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    // Gets both of the readable blocks from one snapshot of the indexes.
+    // The second block, if any, always starts at 0.
+    // On entry, *psize1 holds the maximum total size.
+    //*************************************************************************
+    size_type get_read_reserve_segments(size_type* psize1, size_type* psize2)
+    {
+      size_type read_index  = read.load(etl::memory_order_relaxed);
+      size_type write_index = write.load(etl::memory_order_acquire);
+      size_type max_size    = *psize1;
+      size_type end_index   = write_index;
+      size_type size2       = 0;
+
+      if (read_index > write_index)
+      {
+        // Writer has wrapped around
+        size_type last_index = last.load(etl::memory_order_relaxed);
+
+        if (read_index == last_index)
+        {
+          // Reader reached the end, start read from 0
+          read_index = 0;
+        }
+        else
+        {
+          // The remaining buffer at the end, then the start
+          end_index = last_index;
+          size2     = write_index;
+        }
+      }
+
+      size_type size1 = end_index - read_index;
+
+      // Limit to max size
+      if (size1 >= max_size)
+      {
+        size1 = max_size;
+        size2 = 0;
+      }
+      else if (size2 > (max_size - size1))
+      {
+        size2 = max_size - size1;
+      }
+
+      *psize1 = size1;
+      *psize2 = size2;
+
+      return read_index;
+    }
+
+    //*************************************************************************
+    // Gets both of the writable blocks from one snapshot of the indexes.
+    // The second block, if any, always starts at 0.
+    // On entry, *psize1 holds the maximum total size.
+    //*************************************************************************
+    size_type get_write_reserve_segments(size_type* psize1, size_type* psize2)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type read_index  = read.load(etl::memory_order_acquire);
+      size_type max_size    = *psize1;
+      size_type size1;
+      size_type size2       = 0;
+
+      // No wraparound
+      if (write_index >= read_index)
+      {
+        size1 = capacity() - write_index;
+
+        // When wrapping, the write index cannot reach read index.
+        if (read_index > 0)
+        {
+          size2 = read_index - 1;
+        }
+      }
+      else // read_index > write_index
+      {
+        size1 = read_index - write_index - 1;
+      }
+
+      // Limit to max size
+      if (size1 >= max_size)
+      {
+        size1 = max_size;
+        size2 = 0;
+      }
+      else if (size2 > (max_size - size1))
+      {
+        size2 = max_size - size1;
+      }
+
+      *psize1 = size1;
+      *psize2 = size2;
+
+      return write_index;
+    }
+
   private:
 
     etl::atomic<size_type> read;
@@ -372,6 +469,8 @@ namespace etl
     using base_t::apply_read_reserve;
     using base_t::get_write_reserve;
     using base_t::apply_write_reserve;
+    using base_t::get_read_reserve_segments;
+    using base_t::get_write_reserve_segments;
 
   public:
 
@@ -382,6 +481,7 @@ namespace etl
     typedef T&&                        rvalue_reference;///< An rvalue_reference to the type used in the buffer.
 #endif
     typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the buffer.
+    typedef etl::array<span<T>, 2U>    segments_type;   ///< The two blocks of a scatter/gather reserve.
 
     using base_t::max_size;
 
@@ -441,6 +541,112 @@ namespace etl
       apply_write_reserve(windex, reserve.size());
     }
 
+    //*************************************************************************
+    // Reserves all of the readable memory (up to the max_reserve_size), as up
+    // to two blocks. The second block is empty unless the data wraps around.
+    //*************************************************************************
+    segments_type read_reserve_segments(size_type max_reserve_size = numeric_limits<size_type>::max())
+    {
+      size_type size1 = max_reserve_size;
+      size_type size2;
+      size_type rindex = get_read_reserve_segments(&size1, &size2);
+
+      segments_type segments = { { span<T>(p_buffer + rindex, size1), span<T>(p_buffer, size2) } };
+
+      return segments;
+    }
+
+    //*************************************************************************
+    // Commits the previously reserved read memory blocks.
+    // The blocks can be trimmed at the end before committing, but the second
+    // may only hold data if the first is committed whole.
+    // Throws bip_buffer_reserve_invalid
+    //*************************************************************************
+    void read_commit(const segments_type& reserve)
+    {
+      read_commit(reserve[0]);
+      read_commit(reserve[1]);
+    }
+
+    //*************************************************************************
+    // Commits the first n read values, that may span both blocks, such as
+    // after a partial writev or DMA transfer.
+    //*************************************************************************
+    void read_commit_size(size_type n)
+    {
+      size_type size1 = n;
+      size_type size2;
+      size_type rindex = get_read_reserve_segments(&size1, &size2);
+
+      apply_read_reserve(rindex, size1);
+      apply_read_reserve(0, size2);
+    }
+
+    //*************************************************************************
+    // Reserves all of the readable memory (up to the max_reserve_size), and
+    // describes it in an iovec like array. TIoVec needs 'iov_base' and
+    // 'iov_len' members, such as the POSIX 'struct iovec'. Lengths are in bytes.
+    // Commit with read_commit_size().
+    // Returns the number of entries used.
+    //*************************************************************************
+    template <typename TIoVec>
+    size_t read_reserve_iovec(TIoVec (&iov)[2], size_type max_reserve_size = numeric_limits<size_type>::max())
+    {
+      return to_iovec(read_reserve_segments(max_reserve_size), iov);
+    }
+
+    //*************************************************************************
+    // Reserves all of the writable memory (up to the max_reserve_size), as up
+    // to two blocks. The second block starts at the beginning of the buffer.
+    //*************************************************************************
+    segments_type write_reserve_segments(size_type max_reserve_size)
+    {
+      size_type size1 = max_reserve_size;
+      size_type size2;
+      size_type windex = get_write_reserve_segments(&size1, &size2);
+
+      segments_type segments = { { span<T>(p_buffer + windex, size1), span<T>(p_buffer, size2) } };
+
+      return segments;
+    }
+
+    //*************************************************************************
+    // Commits the previously reserved write memory blocks.
+    // The blocks can be trimmed at the end before committing.
+    // Throws bip_buffer_reserve_invalid
+    //*************************************************************************
+    void write_commit(const segments_type& reserve)
+    {
+      write_commit(reserve[0]);
+      write_commit(reserve[1]);
+    }
+
+    //*************************************************************************
+    // Commits the first n written values, that may span both blocks, such as
+    // after a partial readv or DMA transfer.
+    //*************************************************************************
+    void write_commit_size(size_type n)
+    {
+      size_type size1 = n;
+      size_type size2;
+      size_type windex = get_write_reserve_segments(&size1, &size2);
+
+      apply_write_reserve(windex, size1);
+      apply_write_reserve(0, size2);
+    }
+
+    //*************************************************************************
+    // Reserves all of the writable memory (up to the max_reserve_size), and
+    // describes it in an iovec like array, as read_reserve_iovec().
+    // Commit with write_commit_size().
+    // Returns the number of entries used.
+    //*************************************************************************
+    template <typename TIoVec>
+    size_t write_reserve_iovec(TIoVec (&iov)[2], size_type max_reserve_size)
+    {
+      return to_iovec(write_reserve_segments(max_reserve_size), iov);
+    }
+
     //*************************************************************************
     /// Clears the buffer, destructing any elements that haven't been read.
     //*************************************************************************
@@ -470,6 +676,27 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Describes the non-empty blocks in iov.
+    //*************************************************************************
+    template <typename TIoVec>
+    static size_t to_iovec(const segments_type& segments, TIoVec (&iov)[2])
+    {
+      size_t n = 0;
+
+      for (size_t i = 0; i < segments.size(); ++i)
+      {
+        if (!segments[i].empty())
+        {
+          iov[n].iov_base = static_cast<void*>(segments[i].data());
+          iov[n].iov_len  = segments[i].size() * sizeof(T);
+          ++n;
+        }
+      }
+
+      return n;
+    }
+
     // Disable copy construction and assignment.
     ibip_buffer_spsc_atomic(const ibip_buffer_spsc_atomic&) ETL_DELETE;
     ibip_buffer_spsc_atomic& operator =(const ibip_buffer_spsc_atomic&) ETL_DELETE;
@@ -43,6 +43,7 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 #include "private/minmax_push.h"
 
@@ -520,6 +521,50 @@ namespace etl
     size_t        bits_available;         ///< The number of bits still available in the bitstream buffer.
   };
 
+  namespace private_bit_stream
+  {
+    //*************************************************************************
+    /// The bits are read and written through a window of chars held in an
+    /// integral, rather than a chunk of each char at a time.
+    //*************************************************************************
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t window_type;
+#else
+    typedef uint32_t window_type;
+#endif
+
+    static ETL_CONSTANT uint_least8_t Window_Bits      = CHAR_BIT * sizeof(window_type);
+    static ETL_CONSTANT uint_least8_t Half_Window_Bits = Window_Bits / 2U;
+
+    //*************************************************************************
+    /// Loads a window of chars, the first char in the most significant bits.
+    /// Chars past the end of the buffer are read as zero.
+    //*************************************************************************
+    inline window_type load_window(const char* p, size_t length)
+    {
+      window_type window = 0U;
+
+      if (length >= sizeof(window_type))
+      {
+        memcpy(&window, p, sizeof(window_type));
+
+        if (etl::endianness::value() == etl::endian::little)
+        {
+          window = etl::reverse_bytes(window);
+        }
+      }
+      else
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          window |= window_type(static_cast<unsigned char>(p[i])) << ((sizeof(window_type) - 1U - i) * CHAR_BIT);
+        }
+      }
+
+      return window;
+    }
+  }
+
   //***************************************************************************
   /// Writes bits streams.
   //***************************************************************************
@@ -689,8 +734,8 @@ namespace etl
       {
         while (nbits > bits_available_in_char)
         {
-          step(bits_available_in_char);
           nbits -= bits_available_in_char;
+          step(bits_available_in_char);
         }
 
         if (nbits != 0U)
@@ -895,17 +940,20 @@ namespace etl
       }
 
       // Send the bits to the stream.
-      while (nbits != 0)
+      if (nbits != 0U)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-        nbits -= mask_width;
-        T mask = ((T(1U) << mask_width) - 1U) << nbits;
-
-        // Move chunk to lowest char bits.
-        // Chunks are never larger than one char.
-        T chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
+        const private_bit_stream::window_type bits = static_cast<private_bit_stream::window_type>(value);
 
-        write_chunk(static_cast<char>(chunk), mask_width);
+        // Will the bits and the used part of the current char overflow the window?
+        if ((nbits + (CHAR_BIT - bits_available_in_char)) > private_bit_stream::Window_Bits)
+        {
+          write_window(bits >> private_bit_stream::Half_Window_Bits, nbits - private_bit_stream::Half_Window_Bits);
+          write_window(bits, private_bit_stream::Half_Window_Bits);
+        }
+        else
+        {
+          write_window(bits, nbits);
+        }
       }
 
       if (callback.is_valid())
@@ -915,18 +963,36 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Write a data chunk to the stream
+    /// Write the lowest nbits of value to the stream, from one window of chars.
+    /// A partially used current char keeps its bits. Any other char written
+    /// is cleared first.
     //***************************************************************************
-    void write_chunk(char chunk, unsigned char nbits)
+    void write_window(private_bit_stream::window_type value, uint_least8_t nbits)
     {
-      // Clear if new byte.
-      if (bits_available_in_char == CHAR_BIT)
+      typedef private_bit_stream::window_type window_type;
+
+      const uint_least8_t used   = CHAR_BIT - bits_available_in_char;
+      const uint_least8_t total  = used + nbits;
+      const size_t        nchars = (total + CHAR_BIT - 1U) / CHAR_BIT;
+
+      char* p = pdata + char_index;
+
+      // Align the bits to follow the used part of the current char.
+      window_type window = (value << (private_bit_stream::Window_Bits - nbits)) >> used;
+
+      if (used != 0U)
       {
-        pdata[char_index] = 0U;
+        window |= window_type(static_cast<unsigned char>(*p)) << (private_bit_stream::Window_Bits - CHAR_BIT);
       }
 
-      pdata[char_index] |= chunk;
-      step(nbits);
+      for (size_t i = 0U; i < nchars; ++i)
+      {
+        p[i] = static_cast<char>(window >> (private_bit_stream::Window_Bits - CHAR_BIT - (i * CHAR_BIT)));
+      }
+
+      char_index            += total / CHAR_BIT;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - (total % CHAR_BIT));
+      bits_available        -= nbits;
     }
 
     //***************************************************************************
@@ -1268,14 +1334,20 @@ namespace etl
       uint_least8_t bits = nbits;
 
       // Get the bits from the stream.
-      while (nbits != 0)
+      if (nbits != 0U)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-
-        T chunk = get_chunk(mask_width);
+        // Will the bits and the used part of the current char overflow the window?
+        if ((nbits + (CHAR_BIT - bits_available_in_char)) > private_bit_stream::Window_Bits)
+        {
+          private_bit_stream::window_type upper = read_window(nbits - private_bit_stream::Half_Window_Bits);
+          private_bit_stream::window_type lower = read_window(private_bit_stream::Half_Window_Bits);
 
-        nbits -= mask_width;
-        value |= static_cast<T>(chunk << nbits);
+          value = static_cast<T>((upper << private_bit_stream::Half_Window_Bits) | lower);
+        }
+        else
+        {
+          value = static_cast<T>(read_window(nbits));
+        }
       }
 
       if (stream_endianness == etl::endian::little)
@@ -1293,29 +1365,20 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Get a data chunk from the stream
+    /// Read nbits from the stream, from one window of chars.
     //***************************************************************************
-    unsigned char get_chunk(unsigned char nbits)
+    private_bit_stream::window_type read_window(uint_least8_t nbits)
     {
-      unsigned char value = pdata[char_index];
-      value >>= (bits_available_in_char - nbits);
+      const uint_least8_t used  = CHAR_BIT - bits_available_in_char;
+      const uint_least8_t total = used + nbits;
 
-      unsigned char mask;
+      private_bit_stream::window_type window = private_bit_stream::load_window(pdata + char_index, length_chars - char_index);
 
-      if (nbits == CHAR_BIT)
-      {
-        mask = etl::integral_limits<unsigned char>::max;
-      }
-      else
-      {
-        mask = (1U << nbits) - 1;
-      }
-
-      value &= mask;
+      char_index            += total / CHAR_BIT;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - (total % CHAR_BIT));
+      bits_available        -= nbits;
 
-      step(nbits);
-
-      return value;
+      return (window << used) >> (private_bit_stream::Window_Bits - nbits);
     }
 
     //***************************************************************************
@@ -38,9 +38,13 @@ SOFTWARE.
 #include "binary.h"
 #include "log.h"
 #include "power.h"
+#include "alignment.h"
+#include "static_assert.h"
+
+#include <stdint.h>
 
 ///\defgroup bloom_filter bloom_filter
-/// A Bloom filter
+/// Bloom filters, with single bit, cache line blocked, or counting flags.
 ///\ingroup containers
 
 namespace etl
@@ -56,6 +60,47 @@ namespace etl
         return 0;
       }
     };
+
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t hash_type;
+#else
+    typedef uint32_t hash_type;
+#endif
+
+    //*************************************************************************
+    /// Mixes the bits of a hash, with the finaliser from MurmurHash3, so that
+    /// simple hashes such as the identity are acceptable.
+    //*************************************************************************
+    inline hash_type mix_hash(hash_type hash)
+    {
+#if ETL_USING_64BIT_TYPES
+      hash ^= hash >> 33U;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33U;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33U;
+#else
+      hash ^= hash >> 16U;
+      hash *= 0x85EBCA6BUL;
+      hash ^= hash >> 13U;
+      hash *= 0xC2B2AE35UL;
+      hash ^= hash >> 16U;
+#endif
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Requests a cache line, ahead of its use.
+    //*************************************************************************
+    inline void prefetch(const void* p)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(p);
+#else
+      (void)p;
+#endif
+    }
   }
 
   //***************************************************************************
@@ -184,6 +229,465 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
+
+  //***************************************************************************
+  /// A blocked Bloom filter.
+  /// Each key sets Number_Of_Bits bits, all within one 64 byte block, so
+  /// adding or testing a key touches a single cache line.
+  /// One hash selects the block, and the bits within it are derived from the
+  /// same hash by double hashing. The hash is mixed first, so simple hashes
+  /// such as the identity are acceptable.
+  ///\tparam Desired_Width  The desired number of bits. Rounded up to a whole number of blocks.
+  ///\tparam THash          The hash generator class. Must define <b>argument_type</b>.
+  ///\tparam Number_Of_Bits The number of bits set for each key. 1 to 16. Default 8.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t   Desired_Width,
+            typename THash,
+            size_t   Number_Of_Bits = 8U>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+    static ETL_CONSTANT size_t Words_Per_Block = 16U;
+    static ETL_CONSTANT size_t Bits_Per_Word   = 32U;
+
+#if ETL_USING_CPP11
+    static ETL_CONSTANT size_t Block_Alignment = 64U;
+#else
+    static ETL_CONSTANT size_t Block_Alignment = etl::alignment_of<uint32_t>::value;
+#endif
+
+    /// The number of keys hashed ahead of being tested by the batch exists().
+    static ETL_CONSTANT size_t Batch_Size = 8U;
+
+    ETL_STATIC_ASSERT((Number_Of_Bits > 0U) && (Number_Of_Bits <= 16U), "Number_Of_Bits must be 1 to 16");
+
+  public:
+
+    static ETL_CONSTANT size_t BLOCK_BITS = Words_Per_Block * Bits_Per_Word;
+    static ETL_CONSTANT size_t BLOCKS     = (Desired_Width + BLOCK_BITS - 1U) / BLOCK_BITS;
+    static ETL_CONSTANT size_t WIDTH      = BLOCKS * BLOCK_BITS;
+
+    ETL_STATIC_ASSERT(BLOCKS > 0U, "Zero width");
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      uint32_t* p = words();
+
+      for (size_t i = 0U; i < (BLOCKS * Words_Per_Block); ++i)
+      {
+        p[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      const hash_type hash = get_hash(key);
+
+      uint32_t* p_block = words() + (get_block(hash) * Words_Per_Block);
+
+      uint32_t position = uint32_t(hash) & (BLOCK_BITS - 1U);
+      uint32_t step     = get_step(hash);
+
+      for (size_t i = 0U; i < Number_Of_Bits; ++i)
+      {
+        p_block[position / Bits_Per_Word] |= uint32_t(1U) << (position % Bits_Per_Word);
+        position = (position + step) & (BLOCK_BITS - 1U);
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      return test(get_hash(key));
+    }
+
+    //***************************************************************************
+    /// Tests a range of keys, writing a bool for each to result.
+    /// The blocks for a batch of keys are prefetched before they are tested,
+    /// so that the cache misses overlap.
+    ///\return The end of the results.
+    //***************************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator exists(TInputIterator first, TInputIterator last, TOutputIterator result) const
+    {
+      hash_type hashes[Batch_Size];
+
+      while (first != last)
+      {
+        size_t n = 0U;
+
+        while ((n < Batch_Size) && (first != last))
+        {
+          hashes[n] = get_hash(*first);
+          private_bloom_filter::prefetch(words() + (get_block(hashes[n]) * Words_Per_Block));
+          ++first;
+          ++n;
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          *result = test(hashes[i]);
+          ++result;
+        }
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      const uint32_t* p = words();
+
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < (BLOCKS * Words_Per_Block); ++i)
+      {
+        n += etl::count_bits(p[i]);
+      }
+
+      return n;
+    }
+
+  private:
+
+    typedef private_bloom_filter::hash_type hash_type;
+
+    //***************************************************************************
+    /// Gets the mixed hash for the key.
+    /// The upper 32 bits select the block, the lower 18 the bits within it.
+    //***************************************************************************
+    static hash_type get_hash(parameter_t key)
+    {
+      return private_bloom_filter::mix_hash(hash_type(THash()(key)));
+    }
+
+    //***************************************************************************
+    /// Maps the hash to a block, without a division.
+    //***************************************************************************
+    static size_t get_block(hash_type hash)
+    {
+#if ETL_USING_64BIT_TYPES
+      return size_t(((hash >> 32U) * BLOCKS) >> 32U);
+#else
+      return size_t(hash % BLOCKS);
+#endif
+    }
+
+    //***************************************************************************
+    /// The step between the bits of a key. Odd, so the bits are distinct.
+    //***************************************************************************
+    static uint32_t get_step(hash_type hash)
+    {
+      return (uint32_t(hash >> 9U) & (BLOCK_BITS - 1U)) | 1U;
+    }
+
+    //***************************************************************************
+    /// Tests the bits for a hash.
+    //***************************************************************************
+    bool test(hash_type hash) const
+    {
+      const uint32_t* p_block = words() + (get_block(hash) * Words_Per_Block);
+
+      uint32_t position = uint32_t(hash) & (BLOCK_BITS - 1U);
+      uint32_t step     = get_step(hash);
+      uint32_t found    = 1U;
+
+      // Test all of the bits, rather than stopping at the first clear one, as the branch is unpredictable.
+      for (size_t i = 0U; i < Number_Of_Bits; ++i)
+      {
+        found &= p_block[position / Bits_Per_Word] >> (position % Bits_Per_Word);
+        position = (position + step) & (BLOCK_BITS - 1U);
+      }
+
+      return (found & 1U) != 0U;
+    }
+
+    //***************************************************************************
+    uint32_t* words()
+    {
+      return storage.template get_address<uint32_t>();
+    }
+
+    //***************************************************************************
+    const uint32_t* words() const
+    {
+      return storage.template get_address<uint32_t>();
+    }
+
+    /// The blocks of flags.
+    typename etl::aligned_storage<sizeof(uint32_t) * Words_Per_Block * BLOCKS, Block_Alignment>::type storage;
+  };
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Bits>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Bits>::BLOCK_BITS;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Bits>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Bits>::BLOCKS;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Bits>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Bits>::WIDTH;
+
+  //***************************************************************************
+  /// A counting Bloom filter.
+  /// Each flag is a four bit counter, so keys may be removed as well as added.
+  /// A key added more than once must be removed as many times.
+  /// A counter that reaches its maximum is never decremented, so removing
+  /// keys can never cause a false negative.
+  /// The positions of the counters for a key are derived from one hash by
+  /// double hashing. The hash is mixed first, so simple hashes such as the
+  /// identity are acceptable.
+  ///\tparam Desired_Width     The number of counters.
+  ///\tparam THash             The hash generator class. Must define <b>argument_type</b>.
+  ///\tparam Number_Of_Hashes  The number of counters for each key. Default 4.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t   Desired_Width,
+            typename THash,
+            size_t   Number_Of_Hashes = 4U>
+  class counting_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+    typedef private_bloom_filter::hash_type hash_type;
+
+    static ETL_CONSTANT uint8_t Counter_Max = 15U;
+
+    ETL_STATIC_ASSERT(Desired_Width > 0U, "Zero width");
+    ETL_STATIC_ASSERT(Desired_Width <= 0xFFFFFFFFUL, "Width too large");
+    ETL_STATIC_ASSERT(Number_Of_Hashes > 0U, "Zero hashes");
+
+  public:
+
+    static ETL_CONSTANT size_t WIDTH = Desired_Width;
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    counting_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Number_Of_Bytes; ++i)
+      {
+        counters[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      const hash_type hash = get_hash(key);
+
+      for (size_t i = 0U; i < Number_Of_Hashes; ++i)
+      {
+        const size_t index = get_index(hash, i);
+        const uint8_t value = get_counter(index);
+
+        if (value != Counter_Max)
+        {
+          set_counter(index, value + 1U);
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    ///\param  key The key to remove.
+    ///\return <b>true</b> if the key existed in the filter and was removed.
+    //***************************************************************************
+    bool remove(parameter_t key)
+    {
+      const hash_type hash = get_hash(key);
+
+      if (!test(hash))
+      {
+        return false;
+      }
+
+      for (size_t i = 0U; i < Number_Of_Hashes; ++i)
+      {
+        const size_t index = get_index(hash, i);
+        const uint8_t value = get_counter(index);
+
+        if (value != Counter_Max)
+        {
+          set_counter(index, value - 1U);
+        }
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      return test(get_hash(key));
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter counters that are not zero.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < WIDTH; ++i)
+      {
+        if (get_counter(i) != 0U)
+        {
+          ++n;
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    /// Two counters to a byte.
+    static ETL_CONSTANT size_t Number_Of_Bytes = (Desired_Width + 1U) / 2U;
+
+    //***************************************************************************
+    /// Gets the mixed hash for the key.
+    //***************************************************************************
+    static hash_type get_hash(parameter_t key)
+    {
+      return private_bloom_filter::mix_hash(hash_type(THash()(key)));
+    }
+
+    //***************************************************************************
+    /// Gets the index of the i'th counter for the hash.
+    /// The lower half of the hash is the start, the upper half the step.
+    /// Maps to the width with a multiply and shift, rather than a division.
+    //***************************************************************************
+    static size_t get_index(hash_type hash, size_t i)
+    {
+      const uint32_t start = uint32_t(hash);
+      const uint32_t step  = uint32_t(hash >> (sizeof(hash_type) * 4U)) | 1U;
+      const uint32_t value = uint32_t(start + (uint32_t(i) * step));
+
+#if ETL_USING_64BIT_TYPES
+      return size_t((uint64_t(value) * WIDTH) >> 32U);
+#else
+      return size_t(value % WIDTH);
+#endif
+    }
+
+    //***************************************************************************
+    /// Tests the counters for a hash.
+    //***************************************************************************
+    bool test(hash_type hash) const
+    {
+      for (size_t i = 0U; i < Number_Of_Hashes; ++i)
+      {
+        if (get_counter(get_index(hash, i)) == 0U)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    uint8_t get_counter(size_t index) const
+    {
+      return uint8_t((counters[index / 2U] >> ((index % 2U) * 4U)) & 0x0FU);
+    }
+
+    //***************************************************************************
+    void set_counter(size_t index, unsigned value)
+    {
+      const unsigned shift = unsigned((index % 2U) * 4U);
+      uint8_t& byte = counters[index / 2U];
+
+      byte = uint8_t((byte & ~(0x0FU << shift)) | (value << shift));
+    }
+
+    /// The counters.
+    uint8_t counters[Number_Of_Bytes];
+  };
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Hashes>
+  ETL_CONSTANT uint8_t counting_bloom_filter<Desired_Width, THash, Number_Of_Hashes>::Counter_Max;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Hashes>
+  ETL_CONSTANT size_t counting_bloom_filter<Desired_Width, THash, Number_Of_Hashes>::WIDTH;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Hashes>
+  ETL_CONSTANT size_t counting_bloom_filter<Desired_Width, THash, Number_Of_Hashes>::Number_Of_Bytes;
 }
 
 #endif
@@ -146,12 +146,12 @@ namespace etl
       //***************************************************
       /// Constructor for use by bresenham_line
       //***************************************************
-      const_iterator(bresenham_line<T>* pb)
+      const_iterator(bresenham_line* pb)
         : p_bresenham_line(pb)
       {
       }
 
-      bresenham_line<T>* p_bresenham_line;
+      bresenham_line* p_bresenham_line;
     };
 
     //***************************************************
@@ -204,7 +204,7 @@ namespace etl
     //***************************************************
     const_iterator begin()
     {
-      coordinate = first;
+      initialise(first.x, first.y, last.x, last.y);
 
       return const_iterator(this);
     }
@@ -278,7 +278,6 @@ namespace etl
       y_increment        = (last_y < first_y) ? -1 : 1;
       dx                 = (last_x < first_x) ? first_x - last_x : last_x - first_x;
       dy                 = (last_y < first_y) ? first_y - last_y : last_y - first_y;
-      do_minor_increment = false;
 
       if (y_is_major_axis())
       {
@@ -292,6 +291,8 @@ namespace etl
         balance = dy - dx;
         dx *= 2;
       }
+
+      do_minor_increment = (balance >= 0);
     }
 
     //***************************************************
@@ -355,7 +356,565 @@ namespace etl
     work_t     balance;
     bool       do_minor_increment;
   };
+
+  //***************************************************************************
+  /// A run of points, on one row or column, of a line.
+  /// A horizontal span covers x = start.x to start.x + length - 1 at start.y.
+  /// A vertical span covers y = start.y to start.y + length - 1 at start.x.
+  //***************************************************************************
+  template <typename T>
+  struct line_span
+  {
+    line_span()
+      : start()
+      , length(0U)
+      , horizontal(true)
+    {
+    }
+
+    line_span(etl::coordinate_2d<T> start_, size_t length_, bool horizontal_)
+      : start(start_)
+      , length(length_)
+      , horizontal(horizontal_)
+    {
+    }
+
+    friend bool operator ==(const line_span& lhs, const line_span& rhs)
+    {
+      return (lhs.start == rhs.start) && (lhs.length == rhs.length) && (lhs.horizontal == rhs.horizontal);
+    }
+
+    friend bool operator !=(const line_span& lhs, const line_span& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    etl::coordinate_2d<T> start;
+    size_t                length;
+    bool                  horizontal;
+  };
+
+  namespace private_bresenham_line
+  {
+    //*************************************************************************
+    /// The common part of the line span generators.
+    /// A line with a major axis delta of D and a minor axis delta of E has
+    /// E + 1 spans, each along the major axis. TDerived supplies the major
+    /// axis index at which each span after the first starts.
+    //*************************************************************************
+    template <typename TDerived, typename T, typename TWork>
+    class line_spans_base
+    {
+    public:
+
+      typedef etl::line_span<T>     value_type;
+      typedef size_t                size_type;
+      typedef ptrdiff_t             difference_type;
+      typedef value_type&           reference;
+      typedef const value_type&     const_reference;
+      typedef value_type*           pointer;
+      typedef const value_type*     const_pointer;
+
+      //***************************************************
+      /// Const Iterator
+      //***************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+      {
+      public:
+
+        friend class line_spans_base;
+
+        //***************************************************
+        /// Default constructor
+        //***************************************************
+        const_iterator()
+          : p_spans(ETL_NULLPTR)
+        {
+        }
+
+        //***************************************************
+        /// Copy constructor
+        //***************************************************
+        const_iterator(const const_iterator& other)
+          : p_spans(other.p_spans)
+        {
+        }
+
+        //***************************************************
+        /// Assignment operator
+        //***************************************************
+        const_iterator& operator =(const const_iterator& rhs)
+        {
+          p_spans = rhs.p_spans;
+
+          return *this;
+        }
+
+        //***************************************************
+        /// Pre-increment operator
+        //***************************************************
+        const_iterator& operator ++()
+        {
+          // Has the last span been reached?
+          if (p_spans->is_last_span())
+          {
+            // Mark it as an end iterator.
+            p_spans = ETL_NULLPTR;
+          }
+          else
+          {
+            p_spans->next_span();
+          }
+
+          return *this;
+        }
+
+        //***************************************************
+        /// De-reference operator
+        //***************************************************
+        value_type operator *() const
+        {
+          return p_spans->get_span();
+        }
+
+        //***************************************************
+        /// Equality operator
+        //***************************************************
+        friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.p_spans == rhs.p_spans;
+        }
+
+        //***************************************************
+        /// Inequality operator
+        //***************************************************
+        friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //***************************************************
+        /// Constructor for use by line_spans_base
+        //***************************************************
+        const_iterator(line_spans_base* ps)
+          : p_spans(ps)
+        {
+        }
+
+        line_spans_base* p_spans;
+      };
+
+      //***************************************************
+      /// Get a const_iterator to the first span.
+      /// Resets the span generator.
+      //***************************************************
+      const_iterator begin()
+      {
+        major_start = 0;
+        run         = 0;
+        next_start  = (minor_delta == 0) ? work_t(major_delta + 1) : static_cast<TDerived*>(this)->first_boundary();
+
+        return const_iterator(this);
+      }
+
+      //***************************************************
+      /// Get a const_iterator to one past the last span.
+      //***************************************************
+      const_iterator end() const
+      {
+        return const_iterator();
+      }
+
+      //***************************************************
+      /// Get the first coordinate.
+      //***************************************************
+      const etl::coordinate_2d<T>& front() const
+      {
+        return first;
+      }
+
+      //***************************************************
+      /// Get the last coordinate.
+      //***************************************************
+      const etl::coordinate_2d<T>& back() const
+      {
+        return last;
+      }
+
+      //***************************************************
+      /// Get the number of spans.
+      //***************************************************
+      size_t size() const
+      {
+        return size_t(minor_delta) + 1U;
+      }
+
+      //***************************************************
+      /// Returns true if the spans are horizontal.
+      //***************************************************
+      bool horizontal() const
+      {
+        return !y_is_major_axis;
+      }
+
+      //***************************************************
+      /// Equality operator
+      //***************************************************
+      friend bool operator ==(const line_spans_base& lhs, const line_spans_base& rhs)
+      {
+        return (lhs.front() == rhs.front()) && (lhs.back() == rhs.back());
+      }
+
+      //***************************************************
+      /// Inequality operator
+      //***************************************************
+      friend bool operator !=(const line_spans_base& lhs, const line_spans_base& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    protected:
+
+      typedef TWork work_t;
+
+      //***************************************************
+      /// Sets the line.
+      //***************************************************
+      void initialise(T first_x, T first_y, T last_x, T last_y)
+      {
+        first       = etl::coordinate_2d<T>(first_x, first_y);
+        last        = etl::coordinate_2d<T>(last_x,  last_y);
+        x_increment = (last_x < first_x) ? -1 : 1;
+        y_increment = (last_y < first_y) ? -1 : 1;
+
+        const work_t dx = (last_x < first_x) ? first_x - last_x : last_x - first_x;
+        const work_t dy = (last_y < first_y) ? first_y - last_y : last_y - first_y;
+
+        y_is_major_axis = (dx < dy);
+        major_delta     = y_is_major_axis ? dy : dx;
+        minor_delta     = y_is_major_axis ? dx : dy;
+        major_start     = 0;
+        next_start      = 0;
+        run             = 0;
+      }
+
+      etl::coordinate_2d<T> first;
+      etl::coordinate_2d<T> last;
+      work_t                major_delta;
+      work_t                minor_delta;
+
+    private:
+
+      //***************************************************
+      /// Returns true if the current span is the last.
+      //***************************************************
+      bool is_last_span() const
+      {
+        return run == minor_delta;
+      }
+
+      //***************************************************
+      /// Moves to the next span.
+      //***************************************************
+      void next_span()
+      {
+        major_start = next_start;
+        ++run;
+        next_start  = (run == minor_delta) ? work_t(major_delta + 1) : static_cast<TDerived*>(this)->next_boundary();
+      }
+
+      //***************************************************
+      /// Get the current span.
+      //***************************************************
+      value_type get_span() const
+      {
+        const work_t length = work_t(next_start - major_start);
+
+        // Start from the lowest coordinate of the run.
+        if (y_is_major_axis)
+        {
+          const T x = T(first.x + (x_increment * run));
+          const T y = (y_increment < 0) ? T(first.y - (next_start - 1)) : T(first.y + major_start);
+
+          return value_type(etl::coordinate_2d<T>(x, y), size_t(length), false);
+        }
+        else
+        {
+          const T x = (x_increment < 0) ? T(first.x - (next_start - 1)) : T(first.x + major_start);
+          const T y = T(first.y + (y_increment * run));
+
+          return value_type(etl::coordinate_2d<T>(x, y), size_t(length), true);
+        }
+      }
+
+      work_t x_increment;
+      work_t y_increment;
+      work_t major_start;
+      work_t next_start;
+      work_t run;
+      bool   y_is_major_axis;
+    };
+  }
+
+  //***************************************************************************
+  /// A pseudo-container that generates the horizontal or vertical spans of a
+  /// line, using the run-slice form of Bresenham's line algorithm.
+  /// The spans cover exactly the points generated by etl::bresenham_line.
+  /// Each span costs one addition and one comparison, rather than one per
+  /// point, so suits drivers that fill each span with one DMA transfer.
+  /// T is the type for the etl::coordinate_2d value type.
+  /// TWork is the internal working variable type. Default is int16_t.
+  //***************************************************************************
+  template <typename T, typename TWork = int16_t>
+  class bresenham_line_spans : public private_bresenham_line::line_spans_base<bresenham_line_spans<T, TWork>, T, TWork>
+  {
+  private:
+
+    typedef private_bresenham_line::line_spans_base<bresenham_line_spans<T, TWork>, T, TWork> base_t;
+    typedef typename base_t::work_t work_t;
+
+    friend class private_bresenham_line::line_spans_base<bresenham_line_spans<T, TWork>, T, TWork>;
+
+  public:
+
+    //***************************************************
+    /// Constructor.
+    //***************************************************
+    bresenham_line_spans()
+    {
+      initialise(T(0), T(0), T(0), T(0));
+    }
+
+    //***************************************************
+    /// Constructor.
+    /// Supplied first and last coordinates
+    //***************************************************
+    bresenham_line_spans(etl::coordinate_2d<T> first_, etl::coordinate_2d<T> last_)
+    {
+      initialise(first_.x, first_.y, last_.x, last_.y);
+    }
+
+    //***************************************************
+    /// Constructor.
+    /// Supplied first and last coordinates
+    //***************************************************
+    bresenham_line_spans(T first_x, T first_y, T last_x, T last_y)
+    {
+      initialise(first_x, first_y, last_x, last_y);
+    }
+
+    //***************************************************
+    /// Resets the line.
+    /// Supplied first and last coordinates
+    //***************************************************
+    void reset(etl::coordinate_2d<T> first_, etl::coordinate_2d<T> last_)
+    {
+      initialise(first_.x, first_.y, last_.x, last_.y);
+    }
+
+    //***************************************************
+    /// Resets the line.
+    /// Supplied first and last coordinates
+    //***************************************************
+    void reset(T first_x, T first_y, T last_x, T last_y)
+    {
+      initialise(first_x, first_y, last_x, last_y);
+    }
+
+  private:
+
+    //***************************************************
+    /// Sets the line.
+    /// The point at major axis index i is on run floor((2Ei + D) / 2D), so
+    /// run k starts at ceil(D(2k - 1) / 2E). The quotient and remainder of
+    /// the division are stepped by D / E and 2(D % E) for each run.
+    //***************************************************
+    void initialise(T first_x, T first_y, T last_x, T last_y)
+    {
+      base_t::initialise(first_x, first_y, last_x, last_y);
+
+      if (this->minor_delta != 0)
+      {
+        divisor        = work_t(this->minor_delta * 2);
+        step_quotient  = work_t(this->major_delta / this->minor_delta);
+        step_remainder = work_t((this->major_delta % this->minor_delta) * 2);
+      }
+      else
+      {
+        divisor        = 1;
+        step_quotient  = 0;
+        step_remainder = 0;
+      }
+    }
+
+    //***************************************************
+    /// Get the major axis index at which the second span starts.
+    //***************************************************
+    work_t first_boundary()
+    {
+      quotient  = work_t(this->major_delta / divisor);
+      remainder = work_t(this->major_delta % divisor);
+
+      return work_t(quotient + ((remainder != 0) ? 1 : 0));
+    }
+
+    //***************************************************
+    /// Get the major axis index at which the next span starts.
+    //***************************************************
+    work_t next_boundary()
+    {
+      quotient  = work_t(quotient + step_quotient);
+      remainder = work_t(remainder + step_remainder);
+
+      if (remainder >= divisor)
+      {
+        remainder = work_t(remainder - divisor);
+        ++quotient;
+      }
+
+      return work_t(quotient + ((remainder != 0) ? 1 : 0));
+    }
+
+    work_t divisor;
+    work_t step_quotient;
+    work_t step_remainder;
+    work_t quotient;
+    work_t remainder;
+  };
+
+  //***************************************************************************
+  /// A pseudo-container that generates the horizontal or vertical spans of a
+  /// line, using a fixed point digital differential analyser.
+  /// The length of each span is stepped by a fixed point inverse slope, so
+  /// each span costs one addition and one shift. Reset it for each line of a
+  /// batch; the slope costs one division per line.
+  /// The spans match etl::bresenham_line_spans while the minor axis delta is
+  /// small against 2^(VFraction_Bits / 2). For longer lines a span boundary
+  /// may be one point early.
+  /// T is the type for the etl::coordinate_2d value type.
+  /// TWork is the internal working variable type. Default is int16_t.
+  /// VFraction_Bits is the number of fractional bits of the slope. The major
+  /// axis delta shifted left by VFraction_Bits must fit in a uint32_t.
+  //***************************************************************************
+  template <typename T, typename TWork = int16_t, size_t VFraction_Bits = 16U>
+  class dda_line_spans : public private_bresenham_line::line_spans_base<dda_line_spans<T, TWork, VFraction_Bits>, T, TWork>
+  {
+  private:
+
+    typedef private_bresenham_line::line_spans_base<dda_line_spans<T, TWork, VFraction_Bits>, T, TWork> base_t;
+    typedef typename base_t::work_t work_t;
+
+    friend class private_bresenham_line::line_spans_base<dda_line_spans<T, TWork, VFraction_Bits>, T, TWork>;
+
+  public:
+
+    ETL_STATIC_ASSERT((VFraction_Bits > 0U) && (VFraction_Bits < 32U), "Fraction bits must be 1 to 31");
+
+    static ETL_CONSTANT size_t Fraction_Bits = VFraction_Bits;
+
+    //***************************************************
+    /// Constructor.
+    //***************************************************
+    dda_line_spans()
+    {
+      initialise(T(0), T(0), T(0), T(0));
+    }
+
+    //***************************************************
+    /// Constructor.
+    /// Supplied first and last coordinates
+    //***************************************************
+    dda_line_spans(etl::coordinate_2d<T> first_, etl::coordinate_2d<T> last_)
+    {
+      initialise(first_.x, first_.y, last_.x, last_.y);
+    }
+
+    //***************************************************
+    /// Constructor.
+    /// Supplied first and last coordinates
+    //***************************************************
+    dda_line_spans(T first_x, T first_y, T last_x, T last_y)
+    {
+      initialise(first_x, first_y, last_x, last_y);
+    }
+
+    //***************************************************
+    /// Resets the line.
+    /// Supplied first and last coordinates
+    //***************************************************
+    void reset(etl::coordinate_2d<T> first_, etl::coordinate_2d<T> last_)
+    {
+      initialise(first_.x, first_.y, last_.x, last_.y);
+    }
+
+    //***************************************************
+    /// Resets the line.
+    /// Supplied first and last coordinates
+    //***************************************************
+    void reset(T first_x, T first_y, T last_x, T last_y)
+    {
+      initialise(first_x, first_y, last_x, last_y);
+    }
+
+  private:
+
+    static ETL_CONSTANT uint32_t One = uint32_t(1UL) << VFraction_Bits;
+
+    //***************************************************
+    /// Sets the line.
+    /// Run k starts at ceil(D(2k - 1) / 2E), stepped by the inverse slope D / E.
+    //***************************************************
+    void initialise(T first_x, T first_y, T last_x, T last_y)
+    {
+      base_t::initialise(first_x, first_y, last_x, last_y);
+
+      if (this->minor_delta != 0)
+      {
+        const uint32_t major = uint32_t(this->major_delta) << VFraction_Bits;
+        const uint32_t minor = uint32_t(this->minor_delta);
+
+        first_position = major / (minor * 2U);
+        inverse_slope  = major / minor;
+      }
+      else
+      {
+        first_position = 0U;
+        inverse_slope  = 0U;
+      }
+    }
+
+    //***************************************************
+    /// Get the major axis index at which the second span starts.
+    //***************************************************
+    work_t first_boundary()
+    {
+      position = first_position;
+
+      return work_t((position + (One - 1U)) >> VFraction_Bits);
+    }
+
+    //***************************************************
+    /// Get the major axis index at which the next span starts.
+    //***************************************************
+    work_t next_boundary()
+    {
+      position += inverse_slope;
+
+      return work_t((position + (One - 1U)) >> VFraction_Bits);
+    }
+
+    uint32_t first_position;
+    uint32_t inverse_slope;
+    uint32_t position;
+  };
+
+  template <typename T, typename TWork, size_t VFraction_Bits>
+  ETL_CONSTANT size_t dda_line_spans<T, TWork, VFraction_Bits>::Fraction_Bits;
+
+  template <typename T, typename TWork, size_t VFraction_Bits>
+  ETL_CONSTANT uint32_t dda_line_spans<T, TWork, VFraction_Bits>::One;
 }
 
 #endif
-
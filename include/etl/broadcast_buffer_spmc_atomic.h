@@ -0,0 +1,548 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BROADCAST_BUFFER_SPMC_ATOMIC_INCLUDED
+#define ETL_BROADCAST_BUFFER_SPMC_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "power.h"
+#include "static_assert.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue
+  /// The base for a fixed capacity broadcast buffer, for one producer and
+  /// several consumers. Each value pushed is seen by every consumer.
+  /// Each consumer has its own read sequence, identified by an index.
+  /// The producer may not overwrite a value until all of the consumers have
+  /// popped it, so the slowest consumer gates the producer.
+  /// The consumers share the values, so only have const access to them.
+  /// \tparam T The type of value that the buffer holds.
+  //***************************************************************************
+  template <typename T>
+  class ibroadcast_buffer_spmc_atomic
+  {
+  private:
+
+    typedef uint32_t sequence_type;
+
+  public:
+
+    typedef T        value_type;      ///< The type stored in the buffer.
+    typedef T&       reference;       ///< A reference to the type used in the buffer.
+    typedef const T& const_reference; ///< A const reference to the type used in the buffer.
+#if ETL_USING_CPP11
+    typedef T&&      rvalue_reference;///< An rvalue_reference to the type used in the buffer.
+#endif
+    typedef size_t   size_type;       ///< The type used for determining the size of the buffer.
+
+    //*************************************************************************
+    /// Push a value to the buffer.
+    /// Must only be called from the producer thread.
+    /// \return <b>true</b> if the value was pushed, <b>false</b> if the slowest consumer has not made room.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      void* p_slot = claim_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot) T(value);
+        publish();
+
+        return true;
+      }
+
+      return false;
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_BROADCAST_BUFFER_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the buffer.
+    /// Must only be called from the producer thread.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      void* p_slot = claim_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot) T(etl::move(value));
+        publish();
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the buffer 'in place'.
+    /// Must only be called from the producer thread.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      void* p_slot = claim_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot) T(etl::forward<Args>(args)...);
+        publish();
+
+        return true;
+      }
+
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the buffer 'in place'.
+    /// Must only be called from the producer thread.
+    //*************************************************************************
+    bool emplace()
+    {
+      void* p_slot = claim_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot) T();
+        publish();
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the buffer 'in place'.
+    /// Must only be called from the producer thread.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      void* p_slot = claim_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot) T(value1);
+        publish();
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the buffer 'in place'.
+    /// Must only be called from the producer thread.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      void* p_slot = claim_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot) T(value1, value2);
+        publish();
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the buffer 'in place'.
+    /// Must only be called from the producer thread.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      void* p_slot = claim_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot) T(value1, value2, value3);
+        publish();
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the buffer 'in place'.
+    /// Must only be called from the producer thread.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      void* p_slot = claim_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot) T(value1, value2, value3, value4);
+        publish();
+
+        return true;
+      }
+
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Peek the oldest value that the consumer has not yet popped.
+    /// Must only be called from the consumer's thread, when the consumer is not empty.
+    //*************************************************************************
+    const_reference front(size_type consumer) const
+    {
+      sequence_type sequence = p_sequences[consumer].load(etl::memory_order_relaxed);
+
+      return p_buffer[sequence & mask];
+    }
+
+    //*************************************************************************
+    /// Pop a value for the consumer.
+    /// Must only be called from the consumer's thread.
+    /// \return <b>true</b> if a value was popped, <b>false</b> if the consumer was empty.
+    //*************************************************************************
+    bool pop(size_type consumer)
+    {
+      sequence_type sequence = p_sequences[consumer].load(etl::memory_order_relaxed);
+
+      if (sequence == cursor.load(etl::memory_order_acquire))
+      {
+        return false;
+      }
+
+      // Hands the slot back to the producer.
+      p_sequences[consumer].store(sequence + 1U, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a copy of a value for the consumer.
+    /// Must only be called from the consumer's thread.
+    /// \return <b>true</b> if a value was popped, <b>false</b> if the consumer was empty.
+    //*************************************************************************
+    bool pop(size_type consumer, reference value)
+    {
+      sequence_type sequence = p_sequences[consumer].load(etl::memory_order_relaxed);
+
+      if (sequence == cursor.load(etl::memory_order_acquire))
+      {
+        return false;
+      }
+
+      value = p_buffer[sequence & mask];
+
+      p_sequences[consumer].store(sequence + 1U, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// How many values the consumer has yet to pop.
+    /// Accurate from the consumer's thread, as a lower bound.
+    //*************************************************************************
+    size_type size(size_type consumer) const
+    {
+      sequence_type sequence = p_sequences[consumer].load(etl::memory_order_relaxed);
+
+      return static_cast<size_type>(cursor.load(etl::memory_order_acquire) - sequence);
+    }
+
+    //*************************************************************************
+    /// Checks if the consumer has no values to pop.
+    /// Accurate from the consumer's thread.
+    //*************************************************************************
+    bool empty(size_type consumer) const
+    {
+      return size(consumer) == 0U;
+    }
+
+    //*************************************************************************
+    /// How many values may be pushed before the slowest consumer gates the producer.
+    /// Accurate from the producer thread, as a lower bound.
+    //*************************************************************************
+    size_type available() const
+    {
+      sequence_type write = cursor.load(etl::memory_order_relaxed);
+
+      return capacity() - static_cast<size_type>(write - minimum_sequence(write));
+    }
+
+    //*************************************************************************
+    /// Checks if the producer is gated by the slowest consumer.
+    /// Accurate from the producer thread.
+    //*************************************************************************
+    bool full() const
+    {
+      return available() == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of consumers.
+    //*************************************************************************
+    size_type consumers() const
+    {
+      return n_consumers;
+    }
+
+    //*************************************************************************
+    /// The maximum number of values that the buffer can hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return static_cast<size_type>(mask) + 1U;
+    }
+
+    //*************************************************************************
+    /// The maximum number of values that the buffer can hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity();
+    }
+
+    //*************************************************************************
+    /// Clears the buffer for all consumers.
+    /// Must only be called when there is no possibility of concurrent access.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_type i = 0U; i < n_constructed; ++i)
+      {
+        p_buffer[i].~T();
+      }
+
+      for (size_type i = 0U; i < n_consumers; ++i)
+      {
+        p_sequences[i].store(0U, etl::memory_order_relaxed);
+      }
+
+      n_constructed = 0U;
+      gating        = 0U;
+      cursor.store(0U, etl::memory_order_release);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    ibroadcast_buffer_spmc_atomic(T* p_buffer_, size_type capacity_, etl::atomic<uint32_t>* p_sequences_, size_type n_consumers_)
+      : p_buffer(p_buffer_)
+      , p_sequences(p_sequences_)
+      , n_consumers(n_consumers_)
+      , mask(static_cast<sequence_type>(capacity_ - 1U))
+      , n_constructed(0U)
+      , gating(0U)
+      , cursor(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BROADCAST_BUFFER_SPMC_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibroadcast_buffer_spmc_atomic()
+    {
+    }
+#else
+    ~ibroadcast_buffer_spmc_atomic()
+    {
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Gets the slot for the next value, or ETL_NULLPTR if the slowest
+    /// consumer has not yet popped it. The old value in the slot is destroyed.
+    /// The consumer sequences are only read when the cached gating sequence
+    /// says that the buffer is full.
+    //*************************************************************************
+    void* claim_slot()
+    {
+      sequence_type write = cursor.load(etl::memory_order_relaxed);
+
+      if ((write - gating) > mask)
+      {
+        gating = minimum_sequence(write);
+
+        if ((write - gating) > mask)
+        {
+          return ETL_NULLPTR;
+        }
+      }
+
+      T* p_slot = &p_buffer[write & mask];
+
+      if (n_constructed < capacity())
+      {
+        ++n_constructed;
+      }
+      else
+      {
+        p_slot->~T();
+      }
+
+      return p_slot;
+    }
+
+    //*************************************************************************
+    /// Makes the claimed slot visible to the consumers.
+    //*************************************************************************
+    void publish()
+    {
+      cursor.store(cursor.load(etl::memory_order_relaxed) + 1U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// The sequence of the slowest consumer.
+    /// The acquire loads order the consumers' reads before the slots are reused.
+    //*************************************************************************
+    sequence_type minimum_sequence(sequence_type write) const
+    {
+      sequence_type most_behind = 0U;
+
+      for (size_type i = 0U; i < n_consumers; ++i)
+      {
+        sequence_type behind = write - p_sequences[i].load(etl::memory_order_acquire);
+
+        if (behind > most_behind)
+        {
+          most_behind = behind;
+        }
+      }
+
+      return write - most_behind;
+    }
+
+    // Disable copy construction and assignment.
+    ibroadcast_buffer_spmc_atomic(const ibroadcast_buffer_spmc_atomic&) ETL_DELETE;
+    ibroadcast_buffer_spmc_atomic& operator =(const ibroadcast_buffer_spmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    ibroadcast_buffer_spmc_atomic(ibroadcast_buffer_spmc_atomic&&) = delete;
+    ibroadcast_buffer_spmc_atomic& operator =(ibroadcast_buffer_spmc_atomic&&) = delete;
+#endif
+
+    T*                          p_buffer;      ///< The internal buffer.
+    etl::atomic<sequence_type>* p_sequences;   ///< The next sequence for each consumer.
+    const size_type             n_consumers;   ///< The number of consumers.
+    const sequence_type         mask;          ///< The capacity - 1.
+    size_type                   n_constructed; ///< The number of slots that hold a value. Owned by the producer.
+    sequence_type               gating;        ///< The last known sequence of the slowest consumer. Owned by the producer.
+    etl::atomic<sequence_type>  cursor;        ///< The next sequence to be published.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue
+  /// A fixed capacity broadcast buffer, for one producer and several consumers.
+  /// \tparam T           The type of value that the buffer holds.
+  /// \tparam SIZE        The maximum number of values. Must be a power of 2.
+  /// \tparam N_CONSUMERS The number of consumers.
+  //***************************************************************************
+  template <typename T, size_t SIZE, size_t N_CONSUMERS>
+  class broadcast_buffer_spmc_atomic : public etl::ibroadcast_buffer_spmc_atomic<T>
+  {
+  private:
+
+    typedef etl::ibroadcast_buffer_spmc_atomic<T> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<SIZE>::value, "SIZE must be a power of 2");
+    ETL_STATIC_ASSERT(SIZE <= 0x80000000UL, "SIZE too large");
+    ETL_STATIC_ASSERT(N_CONSUMERS > 0U, "There must be at least one consumer");
+
+    static ETL_CONSTANT size_type MAX_SIZE      = size_type(SIZE);
+    static ETL_CONSTANT size_type MAX_CONSUMERS = size_type(N_CONSUMERS);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    broadcast_buffer_spmc_atomic()
+      : base_t(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE, sequences, MAX_CONSUMERS)
+    {
+      // The consumer sequences are only constructed once the base is.
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~broadcast_buffer_spmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    /// The uninitialised buffer of T.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[SIZE];
+
+    /// The next sequence for each consumer.
+    etl::atomic<uint32_t> sequences[N_CONSUMERS];
+  };
+
+  template <typename T, size_t SIZE, size_t N_CONSUMERS>
+  ETL_CONSTANT typename broadcast_buffer_spmc_atomic<T, SIZE, N_CONSUMERS>::size_type broadcast_buffer_spmc_atomic<T, SIZE, N_CONSUMERS>::MAX_SIZE;
+
+  template <typename T, size_t SIZE, size_t N_CONSUMERS>
+  ETL_CONSTANT typename broadcast_buffer_spmc_atomic<T, SIZE, N_CONSUMERS>::size_type broadcast_buffer_spmc_atomic<T, SIZE, N_CONSUMERS>::MAX_CONSUMERS;
+}
+
+#endif
+
+#endif
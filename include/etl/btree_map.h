@@ -0,0 +1,2009 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "pool.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "debug_count.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+#include "private/comparator_is_transparent.h"
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map with the capacity defined at compile time, implemented as a B+tree.
+/// Each node holds up to NODE_SLOTS elements, so in-order iteration and range
+/// scans visit contiguous arrays, and the per-element overhead is a fraction
+/// of a pointer rather than the three pointers of a red-black tree node.
+/// The leaves are linked in key order.
+/// Insert and erase may move other elements, and invalidate all iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_exception : public etl::exception
+  {
+  public:
+
+    btree_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_full : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:full", ETL_BTREE_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_out_of_bounds : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:bounds", ETL_BTREE_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized btree_maps.
+  /// Can be used as a reference type for all btree_maps containing a specific
+  /// type with the same number of node slots.
+  ///
+  /// The leaves hold the elements. The internal nodes hold copies of keys as
+  /// separators, where child i holds the keys in [key[i - 1], key[i]).
+  /// All nodes except the root are kept at least half full.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t NODE_SLOTS_, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_map
+  {
+    ETL_STATIC_ASSERT(NODE_SLOTS_ >= 3U, "btree_map nodes must have at least 3 slots");
+
+  public:
+
+    typedef TKey                                  key_type;
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TMapped                               mapped_type;
+    typedef TKeyCompare                           key_compare;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&                          rvalue_reference;
+#endif
+    typedef value_type*                           pointer;
+    typedef const value_type*                     const_pointer;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    static ETL_CONSTANT size_t NODE_SLOTS = NODE_SLOTS_;
+
+    /// The minimum number of elements or keys in a node other than the root.
+    static ETL_CONSTANT size_t MIN_SLOTS = NODE_SLOTS_ / 2U;
+
+  protected:
+
+    struct internal_node_t;
+
+    //*************************************************************************
+    /// The common part of all nodes.
+    //*************************************************************************
+    struct node_t
+    {
+      node_t(bool is_leaf_)
+        : parent(ETL_NULLPTR)
+        , count(0U)
+        , is_leaf(is_leaf_)
+      {
+      }
+
+      internal_node_t* parent;
+      size_t           count; ///< The number of elements or keys.
+      bool             is_leaf;
+    };
+
+    //*************************************************************************
+    /// A leaf node, holding up to NODE_SLOTS elements.
+    //*************************************************************************
+    struct leaf_node_t : public node_t
+    {
+      leaf_node_t()
+        : node_t(true)
+        , prev(ETL_NULLPTR)
+        , next(ETL_NULLPTR)
+      {
+      }
+
+      value_type* values()
+      {
+        return reinterpret_cast<value_type*>(&values_buffer);
+      }
+
+      leaf_node_t* prev;
+      leaf_node_t* next;
+
+      typename etl::aligned_storage<sizeof(value_type) * NODE_SLOTS_, etl::alignment_of<value_type>::value>::type values_buffer;
+    };
+
+    //*************************************************************************
+    /// An internal node, holding up to NODE_SLOTS keys.
+    /// There is room for one more key and child, used while splitting.
+    //*************************************************************************
+    struct internal_node_t : public node_t
+    {
+      internal_node_t()
+        : node_t(false)
+      {
+      }
+
+      key_type* keys()
+      {
+        return reinterpret_cast<key_type*>(&keys_buffer);
+      }
+
+      node_t* children[NODE_SLOTS_ + 2U];
+
+      typename etl::aligned_storage<sizeof(key_type) * (NODE_SLOTS_ + 1U), etl::alignment_of<key_type>::value>::type keys_buffer;
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator ++();
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        if (p_leaf == ETL_NULLPTR)
+        {
+          p_leaf = p_map->p_last;
+          index  = p_leaf->count;
+        }
+        else if (index == 0U)
+        {
+          p_leaf = p_leaf->prev;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        operator --();
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      pointer operator &() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      pointer operator ->() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(ibtree_map* p_map_, leaf_node_t* p_leaf_, size_t index_)
+        : p_map(p_map_)
+        , p_leaf(p_leaf_)
+        , index(index_)
+      {
+      }
+
+      // Pointer to the map associated with this iterator.
+      ibtree_map* p_map;
+
+      // Pointer to the leaf. ETL_NULLPTR for end().
+      leaf_node_t* p_leaf;
+
+      // The index of the element in the leaf.
+      size_t index;
+    };
+
+    friend class iterator;
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree_map;
+
+      const_iterator()
+        : p_map(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      const_iterator(const typename ibtree_map::iterator& other)
+        : p_map(other.p_map)
+        , p_leaf(other.p_leaf)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator ++();
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        if (p_leaf == ETL_NULLPTR)
+        {
+          p_leaf = p_map->p_last;
+          index  = p_leaf->count;
+        }
+        else if (index == 0U)
+        {
+          p_leaf = p_leaf->prev;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        operator --();
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const ibtree_map* p_map_, leaf_node_t* p_leaf_, size_t index_)
+        : p_map(p_map_)
+        , p_leaf(p_leaf_)
+        , index(index_)
+      {
+      }
+
+      //*********************************
+      iterator to_iterator() const
+      {
+        return iterator(const_cast<ibtree_map*>(p_map), p_leaf, index);
+      }
+
+      // Pointer to the map associated with this iterator.
+      const ibtree_map* p_map;
+
+      // Pointer to the leaf. ETL_NULLPTR for end().
+      leaf_node_t* p_leaf;
+
+      // The index of the element in the leaf.
+      size_t index;
+    };
+
+    friend class const_iterator;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the btree_map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the btree_map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the btree_map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the btree_map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the btree_map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Gets the end of the btree_map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the btree_map.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the btree_map.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the btree_map.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the btree_map.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the btree_map.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the btree_map.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key does not exist.
+    /// If asserts or exceptions are enabled, emits btree_map_full if a new value is required and the map is full.
+    ///\param key The key.
+    ///\return A reference to the value at key 'key'.
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      iterator position;
+
+      if (!find_position(key, position))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(btree_map_full));
+
+        open_slot(position);
+        ::new (&*position) value_type(key, mapped_type());
+        close_slot(position);
+      }
+
+      return position->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key does not exist.
+    /// If asserts or exceptions are enabled, emits btree_map_full if a new value is required and the map is full.
+    ///\param key The key.
+    ///\return A reference to the value at key 'key'.
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      iterator position;
+
+      if (!find_position(key, position))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(btree_map_full));
+
+        open_slot(position);
+        ::new (&*position) value_type(etl::move(key), mapped_type());
+        close_slot(position);
+      }
+
+      return position->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits btree_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at key 'key'.
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits btree_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at key 'key'.
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      iterator position;
+
+      if (find_position(value.first, position))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(position, false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(btree_map_full), (ETL_OR_STD::pair<iterator, bool>(end(), false)));
+
+      open_slot(position);
+      ::new (&*position) value_type(value);
+      close_slot(position);
+
+      return ETL_OR_STD::pair<iterator, bool>(position, true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      iterator position;
+
+      if (find_position(value.first, position))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(position, false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(btree_map_full), (ETL_OR_STD::pair<iterator, bool>(end(), false)));
+
+      open_slot(position);
+      ::new (&*position) value_type(etl::move(value));
+      close_slot(position);
+
+      return ETL_OR_STD::pair<iterator, bool>(position, true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param position The position that would precede the value to insert. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param position The position that would precede the value to insert. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      iterator position;
+
+      if (!find_position(key, position))
+      {
+        return 0U;
+      }
+
+      erase_at(position);
+
+      return 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t erase(K&& key)
+    {
+      iterator position;
+
+      if (!find_position(key, position))
+      {
+        return 0U;
+      }
+
+      erase_at(position);
+
+      return 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element following the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      iterator position = i_element.to_iterator();
+
+      erase_at(position);
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed by last.
+    /// Erasing may move elements between nodes, so the number of elements to
+    /// erase is counted before erasing.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element following the erased ones.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      size_t n = static_cast<size_t>(etl::distance(first, last));
+
+      iterator position = first.to_iterator();
+
+      while (n-- != 0U)
+      {
+        erase_at(position);
+      }
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// Clears the btree_map.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_root != ETL_NULLPTR)
+      {
+        destroy_node(p_root);
+      }
+
+      p_root       = ETL_NULLPTR;
+      p_first      = ETL_NULLPTR;
+      p_last       = ETL_NULLPTR;
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      iterator position;
+
+      return find_position(key, position) ? position : end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      iterator position;
+
+      return find_position(key, position) ? position : end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      iterator position;
+
+      return find_position(key, position) ? const_iterator(position) : end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      iterator position;
+
+      return find_position(key, position) ? const_iterator(position) : end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      iterator position;
+
+      return find_position(key, position) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      iterator position;
+
+      return find_position(key, position) ? 1U : 0U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Check if the map contains the key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      iterator position;
+
+      return find_position(key, position);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      iterator position;
+
+      return find_position(key, position);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return bound(key, false);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return bound(key, false);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return bound(key, false);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return bound(key, false);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is considered to go after the key provided or end()
+    /// if no keys are considered to go after the key provided.
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      return bound(key, true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return bound(key, true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the container
+    /// whose key is considered to go after the key provided or end()
+    /// if no keys are considered to go after the key provided.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return bound(key, true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return bound(key, true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a range containing all elements with the key.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(bound(key, false), bound(key, true));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(bound(key, false), bound(key, true));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a range containing all elements with the key.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(bound(key, false), bound(key, true));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(bound(key, false), bound(key, true));
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (const ibtree_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (ibtree_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the current size of the btree_map.
+    ///\return The current size of the btree_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the btree_map.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the btree_map.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the btree_map.
+    ///\return The capacity of the btree_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the btree_map.
+    ///\return The maximum size of the btree_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_map(etl::ipool& leaf_pool_, etl::ipool& internal_pool_, size_t max_size_)
+      : p_root(ETL_NULLPTR)
+      , p_first(ETL_NULLPTR)
+      , p_last(ETL_NULLPTR)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+      , p_leaf_pool(&leaf_pool_)
+      , p_internal_pool(&internal_pool_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another btree_map.
+    //*************************************************************************
+    void move_from(ibtree_map& other)
+    {
+      clear();
+
+      iterator from = other.begin();
+
+      while (from != other.end())
+      {
+        insert(etl::move(*from));
+        ++from;
+      }
+
+      other.clear();
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    //*************************************************************************
+    /// Relocates an object from one slot to another uninitialised slot.
+    //*************************************************************************
+    template <typename T>
+    static void relocate(T* p_destination, T* p_source)
+    {
+      ::new (p_destination) T(ETL_MOVE(*p_source));
+      p_source->~T();
+    }
+
+    //*************************************************************************
+    /// The index of the child of an internal node that may contain key.
+    //*************************************************************************
+    template <typename K>
+    size_t child_index(internal_node_t* p_node, const K& key) const
+    {
+      key_type* p_keys = p_node->keys();
+
+      return static_cast<size_t>(etl::upper_bound(p_keys, p_keys + p_node->count, key, compare) - p_keys);
+    }
+
+    //*************************************************************************
+    /// The index of a child within its parent.
+    //*************************************************************************
+    static size_t index_in_parent(node_t* p_node)
+    {
+      internal_node_t* p_parent = p_node->parent;
+
+      size_t i = 0U;
+
+      while (p_parent->children[i] != p_node)
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The leaf that may contain key.
+    //*************************************************************************
+    template <typename K>
+    leaf_node_t* find_leaf(const K& key) const
+    {
+      node_t* p_node = p_root;
+
+      while (!p_node->is_leaf)
+      {
+        internal_node_t* p_internal = static_cast<internal_node_t*>(p_node);
+        p_node = p_internal->children[child_index(p_internal, key)];
+      }
+
+      return static_cast<leaf_node_t*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Finds the lower or upper bound of key within the leaf that may contain it.
+    //*************************************************************************
+    template <typename K>
+    size_t leaf_bound(leaf_node_t* p_leaf, const K& key, bool upper) const
+    {
+      value_type* p_values = p_leaf->values();
+
+      size_t first = 0U;
+      size_t n     = p_leaf->count;
+
+      while (n > 0U)
+      {
+        const size_t step = n / 2U;
+        const bool   go_right = upper ? !compare(key, p_values[first + step].first)
+                                      : compare(p_values[first + step].first, key);
+
+        if (go_right)
+        {
+          first += step + 1U;
+          n     -= step + 1U;
+        }
+        else
+        {
+          n = step;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Sets position to where key is, or where it would be inserted.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    template <typename K>
+    bool find_position(const K& key, iterator& position) const
+    {
+      position = iterator(const_cast<ibtree_map*>(this), ETL_NULLPTR, 0U);
+
+      if (p_root == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      leaf_node_t* p_leaf = find_leaf(key);
+      size_t       index  = leaf_bound(p_leaf, key, false);
+
+      position.p_leaf = p_leaf;
+      position.index  = index;
+
+      return (index != p_leaf->count) && !compare(key, p_leaf->values()[index].first);
+    }
+
+    //*************************************************************************
+    /// The lower or upper bound of key.
+    //*************************************************************************
+    template <typename K>
+    iterator bound(const K& key, bool upper) const
+    {
+      iterator position(const_cast<ibtree_map*>(this), ETL_NULLPTR, 0U);
+
+      if (p_root != ETL_NULLPTR)
+      {
+        leaf_node_t* p_leaf = find_leaf(key);
+        size_t       index  = leaf_bound(p_leaf, key, upper);
+
+        if (index == p_leaf->count)
+        {
+          // The following leaf starts at or after the next separator.
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        position.p_leaf = p_leaf;
+        position.index  = index;
+      }
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// Makes an uninitialised slot for a new element at position, splitting
+    /// the leaf if it is full. Updates position to refer to the slot.
+    //*************************************************************************
+    void open_slot(iterator& position)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        leaf_node_t* p_leaf = create_leaf();
+
+        p_root  = p_leaf;
+        p_first = p_leaf;
+        p_last  = p_leaf;
+
+        position.p_leaf = p_leaf;
+        position.index  = 0U;
+      }
+
+      leaf_node_t* p_leaf = position.p_leaf;
+
+      if (p_leaf->count == NODE_SLOTS)
+      {
+        leaf_node_t* p_right = split_leaf(p_leaf);
+
+        if (position.index > p_leaf->count)
+        {
+          position.index -= p_leaf->count;
+          position.p_leaf = p_right;
+          p_leaf          = p_right;
+        }
+      }
+
+      value_type* p_values = p_leaf->values();
+
+      for (size_t i = p_leaf->count; i > position.index; --i)
+      {
+        relocate(p_values + i, p_values + i - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Accounts for the element constructed in the slot at position.
+    //*************************************************************************
+    void close_slot(iterator& position)
+    {
+      ++position.p_leaf->count;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Erases the element at position, rebalancing the tree.
+    /// Updates position to refer to the following element.
+    //*************************************************************************
+    void erase_at(iterator& position)
+    {
+      leaf_node_t* p_leaf   = position.p_leaf;
+      value_type*  p_values = p_leaf->values();
+
+      p_values[position.index].~value_type();
+
+      for (size_t i = position.index + 1U; i < p_leaf->count; ++i)
+      {
+        relocate(p_values + i - 1U, p_values + i);
+      }
+
+      --p_leaf->count;
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      if (position.index == p_leaf->count)
+      {
+        position.p_leaf = p_leaf->next;
+        position.index  = 0U;
+      }
+
+      rebalance_leaf(p_leaf, position);
+    }
+
+    //*************************************************************************
+    /// Splits a full leaf, moving the upper elements to a new leaf.
+    ///\return The new leaf.
+    //*************************************************************************
+    leaf_node_t* split_leaf(leaf_node_t* p_leaf)
+    {
+      leaf_node_t* p_right = create_leaf();
+
+      const size_t keep = (NODE_SLOTS + 1U) / 2U;
+
+      for (size_t i = keep; i < p_leaf->count; ++i)
+      {
+        relocate(p_right->values() + (i - keep), p_leaf->values() + i);
+      }
+
+      p_right->count = p_leaf->count - keep;
+      p_leaf->count  = keep;
+
+      p_right->prev = p_leaf;
+      p_right->next = p_leaf->next;
+
+      if (p_leaf->next != ETL_NULLPTR)
+      {
+        p_leaf->next->prev = p_right;
+      }
+      else
+      {
+        p_last = p_right;
+      }
+
+      p_leaf->next = p_right;
+
+      insert_into_parent(p_leaf, p_right->values()[0].first, p_right);
+
+      return p_right;
+    }
+
+    //*************************************************************************
+    /// Inserts a separator and new right sibling in to the parent of p_left.
+    //*************************************************************************
+    void insert_into_parent(node_t* p_left, const key_type& key, node_t* p_right)
+    {
+      internal_node_t* p_parent = p_left->parent;
+
+      if (p_parent == ETL_NULLPTR)
+      {
+        // A new root.
+        p_parent = create_internal();
+
+        ::new (p_parent->keys()) key_type(key);
+        p_parent->children[0] = p_left;
+        p_parent->children[1] = p_right;
+        p_parent->count       = 1U;
+
+        p_left->parent  = p_parent;
+        p_right->parent = p_parent;
+        p_root          = p_parent;
+
+        return;
+      }
+
+      const size_t index  = index_in_parent(p_left);
+      key_type*    p_keys = p_parent->keys();
+
+      for (size_t i = p_parent->count; i > index; --i)
+      {
+        relocate(p_keys + i, p_keys + i - 1U);
+        p_parent->children[i + 1U] = p_parent->children[i];
+      }
+
+      ::new (p_keys + index) key_type(key);
+      p_parent->children[index + 1U] = p_right;
+      p_right->parent = p_parent;
+      ++p_parent->count;
+
+      if (p_parent->count > NODE_SLOTS)
+      {
+        split_internal(p_parent);
+      }
+    }
+
+    //*************************************************************************
+    /// Splits an over full internal node, moving the upper keys to a new node
+    /// and the middle key up to the parent.
+    //*************************************************************************
+    void split_internal(internal_node_t* p_node)
+    {
+      internal_node_t* p_right = create_internal();
+
+      const size_t keep   = p_node->count / 2U;
+      key_type*    p_keys = p_node->keys();
+
+      for (size_t i = keep + 1U; i < p_node->count; ++i)
+      {
+        relocate(p_right->keys() + (i - keep - 1U), p_keys + i);
+      }
+
+      for (size_t i = keep + 1U; i <= p_node->count; ++i)
+      {
+        node_t* p_child = p_node->children[i];
+
+        p_right->children[i - keep - 1U] = p_child;
+        p_child->parent = p_right;
+      }
+
+      p_right->count = p_node->count - keep - 1U;
+      p_node->count  = keep;
+
+      insert_into_parent(p_node, p_keys[keep], p_right);
+
+      p_keys[keep].~key_type();
+    }
+
+    //*************************************************************************
+    /// Restores the minimum occupancy of a leaf after an erase.
+    /// Keeps position referring to the same element.
+    //*************************************************************************
+    void rebalance_leaf(leaf_node_t* p_leaf, iterator& position)
+    {
+      if (p_leaf == p_root)
+      {
+        if (p_leaf->count == 0U)
+        {
+          release_leaf(p_leaf);
+
+          p_root  = ETL_NULLPTR;
+          p_first = ETL_NULLPTR;
+          p_last  = ETL_NULLPTR;
+        }
+
+        return;
+      }
+
+      if (p_leaf->count >= MIN_SLOTS)
+      {
+        return;
+      }
+
+      internal_node_t* p_parent = p_leaf->parent;
+      const size_t     index    = index_in_parent(p_leaf);
+
+      leaf_node_t* p_left  = (index > 0U)               ? static_cast<leaf_node_t*>(p_parent->children[index - 1U]) : ETL_NULLPTR;
+      leaf_node_t* p_right = (index < p_parent->count) ? static_cast<leaf_node_t*>(p_parent->children[index + 1U]) : ETL_NULLPTR;
+
+      value_type* p_values = p_leaf->values();
+
+      if ((p_left != ETL_NULLPTR) && (p_left->count > MIN_SLOTS))
+      {
+        // Borrow the last element of the left sibling.
+        for (size_t i = p_leaf->count; i > 0U; --i)
+        {
+          relocate(p_values + i, p_values + i - 1U);
+        }
+
+        --p_left->count;
+        relocate(p_values, p_left->values() + p_left->count);
+        ++p_leaf->count;
+
+        p_parent->keys()[index - 1U] = p_values[0].first;
+
+        if (position.p_leaf == p_leaf)
+        {
+          ++position.index;
+        }
+      }
+      else if ((p_right != ETL_NULLPTR) && (p_right->count > MIN_SLOTS))
+      {
+        // Borrow the first element of the right sibling.
+        value_type* p_right_values = p_right->values();
+
+        relocate(p_values + p_leaf->count, p_right_values);
+
+        for (size_t i = 1U; i < p_right->count; ++i)
+        {
+          relocate(p_right_values + i - 1U, p_right_values + i);
+        }
+
+        --p_right->count;
+
+        if (position.p_leaf == p_right)
+        {
+          if (position.index == 0U)
+          {
+            position.p_leaf = p_leaf;
+            position.index  = p_leaf->count;
+          }
+          else
+          {
+            --position.index;
+          }
+        }
+
+        ++p_leaf->count;
+
+        p_parent->keys()[index] = p_right_values[0].first;
+      }
+      else if (p_left != ETL_NULLPTR)
+      {
+        merge_leaves(p_left, p_leaf, index - 1U, position);
+      }
+      else
+      {
+        merge_leaves(p_leaf, p_right, index, position);
+      }
+    }
+
+    //*************************************************************************
+    /// Merges a leaf in to its left sibling.
+    //*************************************************************************
+    void merge_leaves(leaf_node_t* p_left, leaf_node_t* p_right, size_t separator, iterator& position)
+    {
+      for (size_t i = 0U; i < p_right->count; ++i)
+      {
+        relocate(p_left->values() + p_left->count + i, p_right->values() + i);
+      }
+
+      if (position.p_leaf == p_right)
+      {
+        position.p_leaf = p_left;
+        position.index += p_left->count;
+      }
+
+      p_left->count += p_right->count;
+
+      p_left->next = p_right->next;
+
+      if (p_right->next != ETL_NULLPTR)
+      {
+        p_right->next->prev = p_left;
+      }
+      else
+      {
+        p_last = p_left;
+      }
+
+      internal_node_t* p_parent = p_left->parent;
+
+      release_leaf(p_right);
+      remove_from_internal(p_parent, separator);
+      rebalance_internal(p_parent);
+    }
+
+    //*************************************************************************
+    /// Removes a separator and the child to its right from an internal node.
+    //*************************************************************************
+    void remove_from_internal(internal_node_t* p_node, size_t separator)
+    {
+      key_type* p_keys = p_node->keys();
+
+      p_keys[separator].~key_type();
+
+      for (size_t i = separator + 1U; i < p_node->count; ++i)
+      {
+        relocate(p_keys + i - 1U, p_keys + i);
+        p_node->children[i] = p_node->children[i + 1U];
+      }
+
+      --p_node->count;
+    }
+
+    //*************************************************************************
+    /// Restores the minimum occupancy of an internal node after a merge.
+    //*************************************************************************
+    void rebalance_internal(internal_node_t* p_node)
+    {
+      if (p_node == p_root)
+      {
+        if (p_node->count == 0U)
+        {
+          // The only child becomes the root.
+          p_root         = p_node->children[0];
+          p_root->parent = ETL_NULLPTR;
+
+          release_internal(p_node);
+        }
+
+        return;
+      }
+
+      if (p_node->count >= MIN_SLOTS)
+      {
+        return;
+      }
+
+      internal_node_t* p_parent = p_node->parent;
+      const size_t     index    = index_in_parent(p_node);
+
+      internal_node_t* p_left  = (index > 0U)               ? static_cast<internal_node_t*>(p_parent->children[index - 1U]) : ETL_NULLPTR;
+      internal_node_t* p_right = (index < p_parent->count) ? static_cast<internal_node_t*>(p_parent->children[index + 1U]) : ETL_NULLPTR;
+
+      key_type* p_keys        = p_node->keys();
+      key_type* p_parent_keys = p_parent->keys();
+
+      if ((p_left != ETL_NULLPTR) && (p_left->count > MIN_SLOTS))
+      {
+        // Rotate the last child of the left sibling through the parent.
+        for (size_t i = p_node->count; i > 0U; --i)
+        {
+          relocate(p_keys + i, p_keys + i - 1U);
+          p_node->children[i + 1U] = p_node->children[i];
+        }
+
+        p_node->children[1] = p_node->children[0];
+
+        ::new (p_keys) key_type(p_parent_keys[index - 1U]);
+
+        node_t* p_child = p_left->children[p_left->count];
+        p_node->children[0] = p_child;
+        p_child->parent     = p_node;
+        ++p_node->count;
+
+        --p_left->count;
+        p_parent_keys[index - 1U] = p_left->keys()[p_left->count];
+        p_left->keys()[p_left->count].~key_type();
+      }
+      else if ((p_right != ETL_NULLPTR) && (p_right->count > MIN_SLOTS))
+      {
+        // Rotate the first child of the right sibling through the parent.
+        key_type* p_right_keys = p_right->keys();
+
+        ::new (p_keys + p_node->count) key_type(p_parent_keys[index]);
+
+        node_t* p_child = p_right->children[0];
+        p_node->children[p_node->count + 1U] = p_child;
+        p_child->parent = p_node;
+        ++p_node->count;
+
+        p_parent_keys[index] = p_right_keys[0];
+        p_right_keys[0].~key_type();
+
+        for (size_t i = 1U; i < p_right->count; ++i)
+        {
+          relocate(p_right_keys + i - 1U, p_right_keys + i);
+        }
+
+        for (size_t i = 1U; i <= p_right->count; ++i)
+        {
+          p_right->children[i - 1U] = p_right->children[i];
+        }
+
+        --p_right->count;
+      }
+      else if (p_left != ETL_NULLPTR)
+      {
+        merge_internals(p_left, p_node, index - 1U);
+      }
+      else
+      {
+        merge_internals(p_node, p_right, index);
+      }
+    }
+
+    //*************************************************************************
+    /// Merges an internal node and the separator in to its left sibling.
+    //*************************************************************************
+    void merge_internals(internal_node_t* p_left, internal_node_t* p_right, size_t separator)
+    {
+      internal_node_t* p_parent = p_left->parent;
+      key_type*        p_keys   = p_left->keys();
+
+      ::new (p_keys + p_left->count) key_type(p_parent->keys()[separator]);
+
+      for (size_t i = 0U; i < p_right->count; ++i)
+      {
+        relocate(p_keys + p_left->count + 1U + i, p_right->keys() + i);
+      }
+
+      for (size_t i = 0U; i <= p_right->count; ++i)
+      {
+        node_t* p_child = p_right->children[i];
+
+        p_left->children[p_left->count + 1U + i] = p_child;
+        p_child->parent = p_left;
+      }
+
+      p_left->count += p_right->count + 1U;
+
+      release_internal(p_right);
+      remove_from_internal(p_parent, separator);
+      rebalance_internal(p_parent);
+    }
+
+    //*************************************************************************
+    /// Destroys a node and all of its descendants.
+    //*************************************************************************
+    void destroy_node(node_t* p_node)
+    {
+      if (p_node->is_leaf)
+      {
+        leaf_node_t* p_leaf = static_cast<leaf_node_t*>(p_node);
+
+        for (size_t i = 0U; i < p_leaf->count; ++i)
+        {
+          p_leaf->values()[i].~value_type();
+          ETL_DECREMENT_DEBUG_COUNT;
+        }
+
+        release_leaf(p_leaf);
+      }
+      else
+      {
+        internal_node_t* p_internal = static_cast<internal_node_t*>(p_node);
+
+        for (size_t i = 0U; i <= p_internal->count; ++i)
+        {
+          destroy_node(p_internal->children[i]);
+        }
+
+        for (size_t i = 0U; i < p_internal->count; ++i)
+        {
+          p_internal->keys()[i].~key_type();
+        }
+
+        release_internal(p_internal);
+      }
+    }
+
+    //*************************************************************************
+    leaf_node_t* create_leaf()
+    {
+      return ::new (p_leaf_pool->template allocate<leaf_node_t>()) leaf_node_t();
+    }
+
+    //*************************************************************************
+    internal_node_t* create_internal()
+    {
+      return ::new (p_internal_pool->template allocate<internal_node_t>()) internal_node_t();
+    }
+
+    //*************************************************************************
+    void release_leaf(leaf_node_t* p_leaf)
+    {
+      p_leaf->~leaf_node_t();
+      p_leaf_pool->release(p_leaf);
+    }
+
+    //*************************************************************************
+    void release_internal(internal_node_t* p_internal)
+    {
+      p_internal->~internal_node_t();
+      p_internal_pool->release(p_internal);
+    }
+
+    node_t*         p_root;
+    leaf_node_t*    p_first;
+    leaf_node_t*    p_last;
+    size_type       current_size;
+    const size_type CAPACITY;
+    etl::ipool*     p_leaf_pool;
+    etl::ipool*     p_internal_pool;
+    key_compare     compare;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_map()
+    {
+    }
+#else
+  protected:
+    ~ibtree_map()
+    {
+    }
+#endif
+  };
+
+  template <typename TKey, typename TMapped, const size_t NODE_SLOTS_, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree_map<TKey, TMapped, NODE_SLOTS_, TKeyCompare>::NODE_SLOTS;
+
+  template <typename TKey, typename TMapped, const size_t NODE_SLOTS_, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree_map<TKey, TMapped, NODE_SLOTS_, TKeyCompare>::MIN_SLOTS;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t NODE_SLOTS_, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_map<TKey, TMapped, NODE_SLOTS_, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, NODE_SLOTS_, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t NODE_SLOTS_, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_map<TKey, TMapped, NODE_SLOTS_, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, NODE_SLOTS_, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A btree_map implementation that uses fixed size node pools.
+  ///\tparam TKey        The key type.
+  ///\tparam TValue      The mapped type.
+  ///\tparam MAX_SIZE_   The maximum number of elements that can be stored.
+  ///\tparam NODE_SLOTS_ The number of elements in each node. Default = 16
+  ///\tparam TCompare    The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t NODE_SLOTS_ = 16U, typename TCompare = etl::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TValue, NODE_SLOTS_, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, NODE_SLOTS_, TCompare> base;
+
+    // All leaves other than the root hold at least MIN_SLOTS elements, and all
+    // internal nodes other than the root have at least MIN_SLOTS + 1 children.
+    static ETL_CONSTANT size_t MAX_LEAVES    = (MAX_SIZE_ / (NODE_SLOTS_ / 2U)) + 1U;
+    static ETL_CONSTANT size_t MAX_INTERNALS = (MAX_LEAVES / (NODE_SLOTS_ / 2U)) + 1U;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map(btree_map&& other)
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base::value_type> init)
+      : base(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator = (const btree_map& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map& operator = (btree_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The pool of leaf nodes.
+    etl::pool<typename base::leaf_node_t, MAX_LEAVES> leaf_pool;
+
+    /// The pool of internal nodes.
+    etl::pool<typename base::internal_node_t, MAX_INTERNALS> internal_pool;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t NODE_SLOTS_, typename TCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TValue, MAX_SIZE_, NODE_SLOTS_, TCompare>::MAX_SIZE;
+}
+
+#endif
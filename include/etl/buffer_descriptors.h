@@ -38,6 +38,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "cyclic_value.h"
 #include "algorithm.h"
+#include "atomic.h"
 
 #include <cstring>
 
@@ -299,6 +300,451 @@ namespace etl
 
   template <typename TBuffer, size_t BUFFER_SIZE_, size_t N_BUFFERS_, typename TFlag>
   ETL_CONSTANT typename buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TFlag>::size_type buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TFlag>::descriptor::MAX_SIZE;
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// The default cache maintenance for dma_buffer_descriptors.
+  /// Does nothing, for targets without a data cache, or buffers in non
+  /// cacheable memory.
+  //***************************************************************************
+  struct buffer_cache_none
+  {
+    static void clean(const void*, size_t)
+    {
+    }
+
+    static void invalidate(const void*, size_t)
+    {
+    }
+  };
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  //***************************************************************************
+  /// Cache maintenance for the Cortex-M7 data cache, using CMSIS.
+  /// Include the CMSIS device header before this header.
+  //***************************************************************************
+  struct buffer_cache_cmsis_dcache
+  {
+    static void clean(const void* p, size_t size)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t*)p, int32_t(size));
+    }
+
+    static void invalidate(const void* p, size_t size)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t*)p, int32_t(size));
+    }
+  };
+#endif
+
+  //***************************************************************************
+  /// dma_buffer_descriptors
+  /// A ring of N_BUFFERS_ buffers for zero copy transfers by DMA.
+  /// Each buffer is owned in turn by the pool, the CPU, the DMA, then the
+  /// CPU again when the transfer completes, and the owner is held atomically
+  /// in each descriptor.
+  /// The ring is lock free, for one CPU context that calls allocate, submit,
+  /// receive and release, and one DMA context, such as an interrupt, that
+  /// calls complete. Buffers must be submitted in the order that they were
+  /// allocated, and are completed in that order.
+  /// Each buffer is aligned to, and padded to, CACHE_LINE_ bytes, so that
+  /// cache maintenance of one buffer never affects another.
+  /// The data cache is cleaned when a buffer is submitted, and invalidated
+  /// when a completed buffer is received.
+  ///\tparam TCache A type with static clean(p, size) and invalidate(p, size).
+  //***************************************************************************
+  template <typename TBuffer, size_t BUFFER_SIZE_, size_t N_BUFFERS_, typename TCache = etl::buffer_cache_none, size_t CACHE_LINE_ = 32U>
+  class dma_buffer_descriptors
+  {
+  private:
+
+    struct descriptor_item;
+
+  public:
+
+    typedef TBuffer     value_type;
+    typedef value_type* pointer;
+    typedef size_t      size_type;
+
+    static ETL_CONSTANT size_type N_BUFFERS   = N_BUFFERS_;
+    static ETL_CONSTANT size_type BUFFER_SIZE = BUFFER_SIZE_;
+    static ETL_CONSTANT size_type CACHE_LINE  = CACHE_LINE_;
+
+    ETL_STATIC_ASSERT(N_BUFFERS_ > 0U, "Zero buffers");
+    ETL_STATIC_ASSERT((CACHE_LINE_ & (CACHE_LINE_ - 1U)) == 0U, "The cache line size must be a power of 2");
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TBuffer>::value, "The buffer type must be trivially copyable");
+
+    //*********************************
+    /// The owners of a buffer.
+    //*********************************
+    enum owner_type
+    {
+      Free,     ///< In the pool.
+      Cpu,      ///< Allocated or received by the CPU.
+      Dma,      ///< Submitted to the DMA.
+      Complete  ///< Completed by the DMA, waiting to be received or released.
+    };
+
+    //*********************************
+    /// Describes a buffer.
+    //*********************************
+    class descriptor
+    {
+    public:
+
+      friend class dma_buffer_descriptors;
+
+      static ETL_CONSTANT size_type MAX_SIZE = dma_buffer_descriptors::BUFFER_SIZE;
+
+      //*********************************
+      descriptor()
+        : pdesc_item(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      pointer data() const
+      {
+        assert(pdesc_item != ETL_NULLPTR);
+        return pdesc_item->pbuffer;
+      }
+
+      //*********************************
+      /// The length of the data, as set by submit or complete.
+      //*********************************
+      ETL_NODISCARD
+      size_type size() const
+      {
+        return pdesc_item->length;
+      }
+
+      //*********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR size_type max_size() const
+      {
+        return BUFFER_SIZE;
+      }
+
+      //*********************************
+      ETL_NODISCARD
+      owner_type get_owner() const
+      {
+        return owner_type(pdesc_item->owner.load(etl::memory_order_acquire));
+      }
+
+      //*********************************
+      ETL_NODISCARD
+      bool is_valid() const
+      {
+        return pdesc_item != ETL_NULLPTR;
+      }
+
+    private:
+
+      //*********************************
+      descriptor(descriptor_item* pdesc_item_)
+        : pdesc_item(pdesc_item_)
+      {
+      }
+
+      /// The pointer to the buffer descriptor.
+      descriptor_item* pdesc_item;
+    };
+
+    //*********************************
+    /// Describes a notification.
+    //*********************************
+    class notification
+    {
+    public:
+
+      //*********************************
+      notification()
+        : desc()
+        , count(0U)
+      {
+      }
+
+      //*********************************
+      notification(descriptor desc_, size_t count_)
+        : desc(desc_)
+        , count(count_)
+      {
+      }
+
+      //*********************************
+      ETL_NODISCARD
+      descriptor get_descriptor() const
+      {
+        return desc;
+      }
+
+      //*********************************
+      ETL_NODISCARD
+      size_t get_count() const
+      {
+        return count;
+      }
+
+    private:
+
+      descriptor desc;
+      size_t     count;
+    };
+
+    // The type of the callback function, called by complete.
+    typedef etl::delegate<void(notification)> callback_type;
+
+    //*********************************
+    dma_buffer_descriptors(callback_type callback_ = callback_type())
+      : callback(callback_)
+    {
+      for (size_t i = 0UL; i < N_BUFFERS; ++i)
+      {
+        descriptor_items[i].pbuffer = buffers[i].data;
+      }
+
+      clear();
+    }
+
+    //*********************************
+    void set_callback(const callback_type& callback_)
+    {
+      callback = callback_;
+    }
+
+    //*********************************
+    /// Returns all buffers to the pool.
+    /// Not safe while the DMA owns any buffers.
+    //*********************************
+    void clear()
+    {
+      for (size_t i = 0UL; i < N_BUFFERS; ++i)
+      {
+        descriptor_items[i].length = 0U;
+        descriptor_items[i].owner.store(uint_least8_t(Free), etl::memory_order_release);
+      }
+
+      allocate_index = 0U;
+      complete_index = 0U;
+      receive_index  = 0U;
+    }
+
+    //*********************************
+    ETL_NODISCARD
+    bool is_valid() const
+    {
+      return callback.is_valid();
+    }
+
+    //*********************************
+    /// CPU. Allocates the next buffer in the ring.
+    /// Returns an invalid descriptor if it is not free.
+    //*********************************
+    ETL_NODISCARD
+    descriptor allocate()
+    {
+      descriptor_item& item = descriptor_items[allocate_index];
+
+      if (item.owner.load(etl::memory_order_acquire) != uint_least8_t(Free))
+      {
+        return descriptor();
+      }
+
+      item.length = 0U;
+      item.owner.store(uint_least8_t(Cpu), etl::memory_order_relaxed);
+      allocate_index = next_index(allocate_index);
+
+      return descriptor(&item);
+    }
+
+    //*********************************
+    /// CPU. Hands a buffer to the DMA, after cleaning it from the cache.
+    /// For transmit, length is the length of the data.
+    /// For receive, length is the space for the DMA to fill.
+    ///\return 'false' if the CPU does not own the buffer.
+    //*********************************
+    bool submit(descriptor desc, size_t length = BUFFER_SIZE)
+    {
+      descriptor_item& item = *desc.pdesc_item;
+
+      if (item.owner.load(etl::memory_order_relaxed) != uint_least8_t(Cpu))
+      {
+        return false;
+      }
+
+      item.length = etl::min(length, size_t(BUFFER_SIZE));
+      TCache::clean(item.pbuffer, byte_size(BUFFER_SIZE));
+      item.owner.store(uint_least8_t(Dma), etl::memory_order_release);
+
+      return true;
+    }
+
+    //*********************************
+    /// DMA. Completes the oldest submitted buffer, then calls the callback.
+    /// For receive, length is the length of the data written by the DMA.
+    /// Returns an invalid descriptor if no buffer was submitted.
+    //*********************************
+    descriptor complete(size_t length)
+    {
+      descriptor_item& item = descriptor_items[complete_index];
+
+      if (item.owner.load(etl::memory_order_acquire) != uint_least8_t(Dma))
+      {
+        return descriptor();
+      }
+
+      // The CPU may reuse the buffer as soon as it is complete.
+      length      = etl::min(length, size_t(BUFFER_SIZE));
+      item.length = length;
+      item.owner.store(uint_least8_t(Complete), etl::memory_order_release);
+      complete_index = next_index(complete_index);
+
+      descriptor desc(&item);
+
+      notify(notification(desc, length));
+
+      return desc;
+    }
+
+    //*********************************
+    /// DMA. Completes the oldest submitted buffer, with the submitted length.
+    //*********************************
+    descriptor complete()
+    {
+      descriptor_item& item = descriptor_items[complete_index];
+
+      if (item.owner.load(etl::memory_order_acquire) != uint_least8_t(Dma))
+      {
+        return descriptor();
+      }
+
+      return complete(item.length);
+    }
+
+    //*********************************
+    /// CPU. Receives the oldest completed buffer, after invalidating its
+    /// data in the cache.
+    /// Returns an invalid descriptor if no buffer has completed.
+    //*********************************
+    ETL_NODISCARD
+    descriptor receive()
+    {
+      descriptor_item& item = descriptor_items[receive_index];
+
+      if (item.owner.load(etl::memory_order_acquire) != uint_least8_t(Complete))
+      {
+        return descriptor();
+      }
+
+      TCache::invalidate(item.pbuffer, byte_size(item.length));
+      item.owner.store(uint_least8_t(Cpu), etl::memory_order_relaxed);
+      receive_index = next_index(receive_index);
+
+      return descriptor(&item);
+    }
+
+    //*********************************
+    /// CPU. Returns a buffer owned by the CPU to the pool.
+    //*********************************
+    void release(descriptor desc)
+    {
+      if (desc.is_valid() && (desc.pdesc_item->owner.load(etl::memory_order_relaxed) == uint_least8_t(Cpu)))
+      {
+        desc.pdesc_item->owner.store(uint_least8_t(Free), etl::memory_order_release);
+      }
+    }
+
+    //*********************************
+    /// CPU. Returns a batch of buffers owned by the CPU to the pool.
+    //*********************************
+    void release(const descriptor* descriptors, size_t count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        release(descriptors[i]);
+      }
+    }
+
+    //*********************************
+    /// CPU. Returns all completed buffers to the pool, without receiving
+    /// them, such as after transmission.
+    ///\return The number of buffers released.
+    //*********************************
+    size_t release_completed()
+    {
+      size_t count = 0U;
+
+      while (descriptor_items[receive_index].owner.load(etl::memory_order_acquire) == uint_least8_t(Complete))
+      {
+        descriptor_items[receive_index].owner.store(uint_least8_t(Free), etl::memory_order_release);
+        receive_index = next_index(receive_index);
+        ++count;
+      }
+
+      return count;
+    }
+
+  private:
+
+    //*********************************
+    void notify(notification n)
+    {
+      // Do we have a valid callback?
+      if (callback.is_valid())
+      {
+        callback(n);
+      }
+    }
+
+    //*********************************
+    static size_t next_index(size_t index)
+    {
+      return (index == (N_BUFFERS - 1U)) ? 0U : (index + 1U);
+    }
+
+    //*********************************
+    static size_t byte_size(size_t length)
+    {
+      return length * sizeof(TBuffer);
+    }
+
+    //*********************************
+    struct descriptor_item
+    {
+      pointer                    pbuffer;
+      size_t                     length;
+      etl::atomic<uint_least8_t> owner;
+    };
+
+    //*********************************
+    /// A buffer, aligned and padded to the cache line size.
+    //*********************************
+    struct alignas(CACHE_LINE_) buffer_item
+    {
+      TBuffer data[BUFFER_SIZE_];
+    };
+
+    buffer_item     buffers[N_BUFFERS_];
+    callback_type   callback;
+    descriptor_item descriptor_items[N_BUFFERS_];
+    size_t          allocate_index;
+    size_t          complete_index;
+    size_t          receive_index;
+  };
+
+  template <typename TBuffer, size_t BUFFER_SIZE_, size_t N_BUFFERS_, typename TCache, size_t CACHE_LINE_>
+  ETL_CONSTANT typename dma_buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TCache, CACHE_LINE_>::size_type dma_buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TCache, CACHE_LINE_>::N_BUFFERS;
+
+  template <typename TBuffer, size_t BUFFER_SIZE_, size_t N_BUFFERS_, typename TCache, size_t CACHE_LINE_>
+  ETL_CONSTANT typename dma_buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TCache, CACHE_LINE_>::size_type dma_buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TCache, CACHE_LINE_>::BUFFER_SIZE;
+
+  template <typename TBuffer, size_t BUFFER_SIZE_, size_t N_BUFFERS_, typename TCache, size_t CACHE_LINE_>
+  ETL_CONSTANT typename dma_buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TCache, CACHE_LINE_>::size_type dma_buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TCache, CACHE_LINE_>::CACHE_LINE;
+
+  template <typename TBuffer, size_t BUFFER_SIZE_, size_t N_BUFFERS_, typename TCache, size_t CACHE_LINE_>
+  ETL_CONSTANT typename dma_buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TCache, CACHE_LINE_>::size_type dma_buffer_descriptors<TBuffer, BUFFER_SIZE_, N_BUFFERS_, TCache, CACHE_LINE_>::descriptor::MAX_SIZE;
+#endif
 }
 #endif
 #endif
@@ -45,12 +45,272 @@ SOFTWARE.
 #include "delegate.h"
 #include "exception.h"
 #include "error_handler.h"
+#include "binary.h"
+#include "smallest.h"
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 namespace etl
 {
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// Is there an etl::reverse_bytes for an unsigned integral of this size?
+    //*************************************************************************
+    template <size_t Size>
+    struct is_reversible_size : etl::bool_constant<(Size == 2U) || (Size == 4U)>
+    {
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct is_reversible_size<8U> : etl::bool_constant<true>
+    {
+    };
+#endif
+
+    //*************************************************************************
+    /// Copies a range of values between the stream and memory, reversing the
+    /// bytes of each value if the stream endianness is not native.
+    /// The reversal goes through an unsigned integral of the same size, as a
+    /// loop of etl::reverse_bytes is one that compilers will vectorise.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<is_reversible_size<sizeof(T)>::value, void>::type
+      copy_values(const char* source, char* destination, size_t count, bool reverse)
+    {
+      if (reverse)
+      {
+        typedef typename etl::smallest_uint_for_bits<sizeof(T) * CHAR_BIT>::type uint_t;
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          uint_t value;
+          memcpy(&value, source, sizeof(T));
+          value = etl::reverse_bytes(value);
+          memcpy(destination, &value, sizeof(T));
+
+          source      += sizeof(T);
+          destination += sizeof(T);
+        }
+      }
+      else
+      {
+        memcpy(destination, source, count * sizeof(T));
+      }
+    }
+
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<!is_reversible_size<sizeof(T)>::value, void>::type
+      copy_values(const char* source, char* destination, size_t count, bool reverse)
+    {
+      if (reverse && (sizeof(T) != 1U))
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          etl::reverse_copy(source, source + sizeof(T), destination);
+
+          source      += sizeof(T);
+          destination += sizeof(T);
+        }
+      }
+      else
+      {
+        memcpy(destination, source, count * sizeof(T));
+      }
+    }
+
+    //*************************************************************************
+    /// The most bytes in the LEB128 encoding of a T.
+    //*************************************************************************
+    template <typename T>
+    struct varint_max_size : etl::integral_constant<size_t, (etl::integral_limits<T>::bits + 6U) / 7U>
+    {
+    };
+
+    //*************************************************************************
+    /// The number of bytes in the LEB128 encoding of a value.
+    //*************************************************************************
+    inline size_t varint_size(uint64_t value)
+    {
+      size_t size = 1U;
+
+      while (value >= 0x80U)
+      {
+        value >>= 7U;
+        ++size;
+      }
+
+      return size;
+    }
+
+    //*************************************************************************
+    /// Encodes a value as LEB128. There must be room for varint_size(value)
+    /// bytes.
+    //*************************************************************************
+    inline void encode_varint(uint64_t value, char* p)
+    {
+      while (value >= 0x80U)
+      {
+        *p++ = static_cast<char>(static_cast<uint8_t>(value | 0x80U));
+        value >>= 7U;
+      }
+
+      *p = static_cast<char>(static_cast<uint8_t>(value));
+    }
+
+    //*************************************************************************
+    /// Decodes an LEB128 value of at most 'max_size' bytes from the first
+    /// 'available' bytes.
+    /// When 8 bytes are available, encodings of up to 8 bytes are decoded
+    /// from one 64 bit load, without a branch per byte. The terminating byte
+    /// is the lowest with a clear top bit, and the 7 bit groups are then
+    /// gathered with constant shifts.
+    /// Returns the number of bytes, or 0 if the encoding is truncated or too
+    /// long.
+    //*************************************************************************
+    inline size_t decode_varint(const char* p, size_t available, size_t max_size, uint64_t& value)
+    {
+      if (available >= 8U)
+      {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+
+        if (etl::endianness::value() == etl::endian::big)
+        {
+          word = etl::reverse_bytes(word);
+        }
+
+        const uint64_t ends = ~word & 0x8080808080808080ULL;
+
+        if (ends != 0U)
+        {
+          const size_t size = (static_cast<size_t>(etl::count_trailing_zeros(ends)) / 8U) + 1U;
+
+          if (size < 8U)
+          {
+            word &= (uint64_t(1U) << (8U * size)) - 1U;
+          }
+
+          value = ((word        & 0x000000000000007FULL) |
+                   ((word >> 1U) & 0x0000000000003F80ULL) |
+                   ((word >> 2U) & 0x00000000001FC000ULL) |
+                   ((word >> 3U) & 0x000000000FE00000ULL) |
+                   ((word >> 4U) & 0x00000007F0000000ULL) |
+                   ((word >> 5U) & 0x000003F800000000ULL) |
+                   ((word >> 6U) & 0x0001FC0000000000ULL) |
+                   ((word >> 7U) & 0x00FE000000000000ULL));
+
+          return (size <= max_size) ? size : 0U;
+        }
+      }
+
+      value = 0U;
+
+      const size_t limit = (available < max_size) ? available : max_size;
+
+      for (size_t i = 0U; i < limit; ++i)
+      {
+        const uint8_t byte = static_cast<uint8_t>(p[i]);
+
+        value |= uint64_t(byte & 0x7FU) << (7U * i);
+
+        if ((byte & 0x80U) == 0U)
+        {
+          return i + 1U;
+        }
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Whether a decoded value fits in a T.
+    //*************************************************************************
+    template <typename T>
+    bool varint_fits(uint64_t value, const char* p_last)
+    {
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      if (etl::integral_limits<unsigned_t>::bits < 64U)
+      {
+        return value <= uint64_t(etl::integral_limits<unsigned_t>::max);
+      }
+      else
+      {
+        // The tenth byte of a 64 bit value may only hold the top bit.
+        return (p_last == ETL_NULLPTR) || (static_cast<uint8_t>(*p_last) <= 1U);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Maps a signed value to an unsigned value, so that values near zero,
+  /// of either sign, are small. 0, -1, 1, -2 map to 0, 1, 2, 3.
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value, typename etl::make_unsigned<T>::type>::type
+    zigzag_encode(T value)
+  {
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    return static_cast<unsigned_t>(static_cast<unsigned_t>(static_cast<unsigned_t>(value) << 1U) ^ ((value < 0) ? unsigned_t(~unsigned_t(0U)) : unsigned_t(0U)));
+  }
+
+  //***************************************************************************
+  /// Maps an unsigned value back to the signed value given to zigzag_encode.
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, typename etl::make_signed<T>::type>::type
+    zigzag_decode(T value)
+  {
+    typedef typename etl::make_signed<T>::type signed_t;
+
+    return static_cast<signed_t>(static_cast<T>(static_cast<T>(value >> 1U) ^ static_cast<T>(T(0U) - static_cast<T>(value & 1U))));
+  }
+
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// The unsigned value to encode. Signed values are zigzag encoded.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR typename etl::enable_if<etl::is_signed<T>::value, uint64_t>::type
+      to_varint(T value)
+    {
+      return uint64_t(etl::zigzag_encode(value));
+    }
+
+    template <typename T>
+    ETL_CONSTEXPR typename etl::enable_if<etl::is_unsigned<T>::value, uint64_t>::type
+      to_varint(T value)
+    {
+      return uint64_t(value);
+    }
+
+    //*************************************************************************
+    /// The value from the decoded unsigned value.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR typename etl::enable_if<etl::is_signed<T>::value, T>::type
+      from_varint(uint64_t value)
+    {
+      return etl::zigzag_decode(static_cast<typename etl::make_unsigned<T>::type>(value));
+    }
+
+    template <typename T>
+    ETL_CONSTEXPR typename etl::enable_if<etl::is_unsigned<T>::value, T>::type
+      from_varint(uint64_t value)
+    {
+      return static_cast<T>(value);
+    }
+  }
+
   //***************************************************************************
   /// Encodes a byte stream.
   //***************************************************************************
@@ -181,13 +441,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const etl::span<T>& range)
     {
-      typename etl::span<T>::iterator itr = range.begin();
-
-      while (itr != range.end())
-      {
-        to_bytes(*itr);
-        ++itr;
-      }
+      range_to_bytes(range.data(), range.size());
     }
 
     //***************************************************************************
@@ -214,11 +468,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const T* start, size_t length)
     {
-      while (length-- != 0U)
-      {
-        to_bytes(*start);
-        ++start;
-      }
+      range_to_bytes(start, length);
     }
 
     //***************************************************************************
@@ -238,6 +488,75 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Write an integral value to the stream as an LEB128 varint.
+    /// Signed values are zigzag encoded first.
+    /// The stream endianness does not apply.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      write_varint_unchecked(T value)
+    {
+      varint_to_bytes(private_byte_stream::to_varint(value));
+    }
+
+    //***************************************************************************
+    /// Write an integral value to the stream as an LEB128 varint.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      write_varint(T value)
+    {
+      const uint64_t u = private_byte_stream::to_varint(value);
+
+      bool success = (available_bytes() >= private_byte_stream::varint_size(u));
+
+      if (success)
+      {
+        varint_to_bytes(u);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Write a range of integral values to the stream as LEB128 varints.
+    /// Writes all of them, or none if they do not fit.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      write_varint(const etl::span<T>& range)
+    {
+      size_t size = 0U;
+
+      for (size_t i = 0U; i < range.size(); ++i)
+      {
+        size += private_byte_stream::varint_size(private_byte_stream::to_varint(range[i]));
+      }
+
+      bool success = (available_bytes() >= size);
+
+      if (success)
+      {
+        for (size_t i = 0U; i < range.size(); ++i)
+        {
+          varint_to_bytes(private_byte_stream::to_varint(range[i]));
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// The number of bytes in the LEB128 varint encoding of a value.
+    //***************************************************************************
+    template <typename T>
+    static typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+      varint_size(T value)
+    {
+      return private_byte_stream::varint_size(private_byte_stream::to_varint(value));
+    }
+
     //***************************************************************************
     /// Skip n items of T, if the total space is available.
     /// Returns <b>true</b> if the skip was possible.
@@ -456,6 +775,36 @@ namespace etl
       step(sizeof(T));
     }
 
+    //*********************************
+    void varint_to_bytes(uint64_t value)
+    {
+      private_byte_stream::encode_varint(value, pcurrent);
+      step(private_byte_stream::varint_size(value));
+    }
+
+    //*********************************
+    /// Writes the range in one copy, unless there is a callback to call for each value.
+    //*********************************
+    template <typename T>
+    void range_to_bytes(const T* start, size_t length)
+    {
+      if (callback.is_valid())
+      {
+        while (length-- != 0U)
+        {
+          to_bytes(*start);
+          ++start;
+        }
+      }
+      else
+      {
+        const bool reverse = (stream_endianness != etl::endianness::value());
+
+        private_byte_stream::copy_values<T>(reinterpret_cast<const char*>(start), pcurrent, length, reverse);
+        pcurrent += (length * sizeof(T));
+      }
+    }
+
     //*********************************
     void step(size_t n)
     {
@@ -635,12 +984,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(etl::span<T> range)
     {
-      typename etl::span<T>::iterator destination = range.begin();
-
-      while (destination != range.end())
-      {
-        *destination++ = from_bytes<T>();
-      }
+      range_from_bytes(range.data(), range.size());
 
       return etl::span<const T>(range.begin(), range.end());
     }
@@ -668,12 +1012,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(T* start,  size_t length)
     {
-      T* destination = start;
-
-      for (size_t i = 0; i < length; ++i)
-      {
-        *destination++ = from_bytes<T>();
-      }
+      range_from_bytes(start, length);
 
       return etl::span<const T>(start, length);
     }
@@ -694,6 +1033,70 @@ namespace etl
       return etl::optional<etl::span<const T> >();
     }
 
+    //***************************************************************************
+    /// Read an LEB128 varint integral value from the stream.
+    /// Signed values are zigzag decoded.
+    /// The stream must hold a valid encoding.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, T>::type
+      read_varint_unchecked()
+    {
+      uint64_t value = 0U;
+
+      pcurrent += private_byte_stream::decode_varint(pcurrent, available_bytes(), private_byte_stream::varint_max_size<T>::value, value);
+
+      return private_byte_stream::from_varint<T>(value);
+    }
+
+    //***************************************************************************
+    /// Read an LEB128 varint integral value from the stream.
+    /// Returns an empty optional, and does not move, if the encoding is
+    /// truncated, or too long or too large for T.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::optional<T> >::type
+      read_varint()
+    {
+      etl::optional<T> result;
+
+      uint64_t value = 0U;
+
+      if (varint_from_bytes<T>(value))
+      {
+        result = private_byte_stream::from_varint<T>(value);
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Read a range of LEB128 varint integral values from the stream.
+    /// Reads all of them, or returns an empty optional and does not move.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::optional<etl::span<const T> > >::type
+      read_varint(etl::span<T> range)
+    {
+      const char* const pstart = pcurrent;
+
+      for (size_t i = 0U; i < range.size(); ++i)
+      {
+        uint64_t value = 0U;
+
+        if (!varint_from_bytes<T>(value))
+        {
+          pcurrent = pstart;
+
+          return etl::optional<etl::span<const T> >();
+        }
+
+        range[i] = private_byte_stream::from_varint<T>(value);
+      }
+
+      return etl::optional<etl::span<const T> >(etl::span<const T>(range.begin(), range.end()));
+    }
+
     //***************************************************************************
     /// Skip n items of T, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -838,6 +1241,33 @@ namespace etl
       return value;
     }
 
+    //*********************************
+    template <typename T>
+    bool varint_from_bytes(uint64_t& value)
+    {
+      const size_t size = private_byte_stream::decode_varint(pcurrent, available_bytes(), private_byte_stream::varint_max_size<T>::value, value);
+
+      const char* p_last = (size == private_byte_stream::varint_max_size<uint64_t>::value) ? (pcurrent + size - 1U) : ETL_NULLPTR;
+
+      if ((size != 0U) && private_byte_stream::varint_fits<T>(value, p_last))
+      {
+        pcurrent += size;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*********************************
+    template <typename T>
+    void range_from_bytes(T* start, size_t length)
+    {
+      const bool reverse = (stream_endianness != etl::endianness::value());
+
+      private_byte_stream::copy_values<T>(pcurrent, reinterpret_cast<char*>(start), length, reverse);
+      pcurrent += (length * sizeof(T));
+    }
+
     //*********************************
     void copy_value(const char* source, char* destination, size_t length) const
     {
@@ -30,6 +30,8 @@ SOFTWARE.
 #define ETL_CALLBACK_TIMER_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
+#include "latency_monitor.h"
 #include "algorithm.h"
 #include "nullptr.h"
 #include "function.h"
@@ -95,6 +97,7 @@ namespace etl
       : p_callback(ETL_NULLPTR),
         period(0),
         delta(etl::timer::state::Inactive),
+        slack(0),
         id(etl::timer::id::NO_TIMER),
         previous(etl::timer::id::NO_TIMER),
         next(etl::timer::id::NO_TIMER),
@@ -113,6 +116,7 @@ namespace etl
       : p_callback(reinterpret_cast<void*>(p_callback_)),
         period(period_),
         delta(etl::timer::state::Inactive),
+        slack(0),
         id(id_),
         previous(etl::timer::id::NO_TIMER),
         next(etl::timer::id::NO_TIMER),
@@ -131,6 +135,7 @@ namespace etl
       : p_callback(reinterpret_cast<void*>(&callback_)),
         period(period_),
         delta(etl::timer::state::Inactive),
+        slack(0),
         id(id_),
         previous(etl::timer::id::NO_TIMER),
         next(etl::timer::id::NO_TIMER),
@@ -149,6 +154,7 @@ namespace etl
             : p_callback(reinterpret_cast<void*>(&callback_)),
               period(period_),
               delta(etl::timer::state::Inactive),
+              slack(0),
               id(id_),
               previous(etl::timer::id::NO_TIMER),
               next(etl::timer::id::NO_TIMER),
@@ -176,6 +182,7 @@ namespace etl
     void*                 p_callback;
     uint32_t              period;
     uint32_t              delta;
+    uint32_t              slack;
     etl::timer::id::type  id;
     uint_least8_t         previous;
     uint_least8_t         next;
@@ -564,23 +571,44 @@ namespace etl
 
           if (has_active)
           {
-            while (has_active && (count >= active_list.front().delta))
+            bool has_expired = false;
+
+            // Timers that are due, and then any timers within their slack of being due.
+            while (has_active && ((count >= active_list.front().delta) ||
+                                  (has_expired && ((active_list.front().delta - count) <= active_list.front().slack))))
             {
               etl::callback_timer_data& timer = active_list.front();
 
-              count -= timer.delta;
+              // The time from now that the timer was due.
+              uint32_t due = timer.delta;
 
-              active_list.remove(timer.id, true);
+              if (count >= due)
+              {
+                count -= due;
+                due = 0U;
+                has_expired = true;
+
+                active_list.remove(timer.id, true);
+              }
+              else
+              {
+                // Fire early, leaving the time for the following timers unchanged.
+                active_list.remove(timer.id, false);
+              }
 
               if (timer.repeating)
               {
-                // Reinsert the timer.
-                timer.delta = timer.period;
+                // Reinsert the timer, keeping its phase if fired early.
+                timer.delta = timer.period + due;
                 active_list.insert(timer.id);
               }
 
+              ETL_TRACE(etl::trace_event::timer_expired, this, timer.id);
+
               if (timer.p_callback != ETL_NULLPTR)
               {
+                ETL_LATENCY_SCOPE(etl::latency_domain::timer, timer.id);
+
                 if (timer.cbk_type == callback_timer_data::C_CALLBACK)
                 {
                   // Call the C callback.
@@ -708,6 +736,31 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    /// Sets a timer's slack.
+    /// When another timer expires, this timer will also fire in the same tick
+    /// if it is due within 'slack_' ticks. The default is zero.
+    /// Lets timers that are close together share one wake-up.
+    //*******************************************
+    bool set_slack(etl::timer::id::type id_, uint32_t slack_)
+    {
+      if (is_valid_timer_id(id_))
+      {
+        etl::callback_timer_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          ETL_DISABLE_TIMER_UPDATES;
+          timer.slack = slack_;
+          ETL_ENABLE_TIMER_UPDATES;
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
     //*******************************************
     /// Check if there is an active timer.
     //*******************************************
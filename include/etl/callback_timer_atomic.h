@@ -30,11 +30,15 @@ SOFTWARE.
 #define ETL_CALLBACK_TIMER_ATOMIC_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
+#include "latency_monitor.h"
 #include "algorithm.h"
 #include "nullptr.h"
 #include "function.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "integral_limits.h"
+#include "type_traits.h"
 #include "error_handler.h"
 #include "placement_new.h"
 #include "delegate.h"
@@ -46,18 +50,25 @@ namespace etl
   //***************************************************************************
   /// Interface for callback timer
   //***************************************************************************
-  template <typename TSemaphore>
+  template <typename TSemaphore, typename TTick = uint32_t>
   class icallback_timer_atomic
   {
   public:
 
     typedef etl::delegate<void(void)> callback_type;
 
+    ETL_STATIC_ASSERT(etl::is_unsigned<TTick>::value, "TTick must be an unsigned integral type");
+
+    typedef TTick tick_type;
+
+    static ETL_CONSTANT tick_type Inactive           = etl::integral_limits<tick_type>::max; ///< The delta of an inactive timer.
+    static ETL_CONSTANT tick_type No_Active_Interval = etl::integral_limits<tick_type>::max; ///< Returned by time_to_next() when no timer is active.
+
     //*******************************************
     /// Register a timer.
     //*******************************************
     etl::timer::id::type register_timer(callback_type callback_,
-                                        uint32_t   period_,
+                                        tick_type  period_,
                                         bool       repeating_)
     {
         etl::timer::id::type id = etl::timer::id::NO_TIMER;
@@ -139,6 +150,7 @@ namespace etl
     {
       ++process_semaphore;
       active_list.clear();
+      carried_count = 0U;
       --process_semaphore;
 
       for (uint8_t i = 0U; i < MAX_TIMERS; ++i)
@@ -155,12 +167,16 @@ namespace etl
     // Returns true if the tick was processed,
     // false if not.
     //*******************************************
-    bool tick(uint32_t count)
+    bool tick(tick_type count)
     {
       if (enabled)
       {
         if (process_semaphore == 0U)
         {
+          // Include any time left over from a deferred tick.
+          count += carried_count;
+          carried_count = 0U;
+
           // We have something to do?
           bool has_active = !active_list.empty();
 
@@ -174,8 +190,12 @@ namespace etl
 
               active_list.remove(timer.id, true);
 
+              ETL_TRACE(etl::trace_event::timer_expired, this, timer.id);
+
               if (timer.callback.is_valid())
               {
+                ETL_LATENCY_SCOPE(etl::latency_domain::timer, timer.id);
+
                 // Call the delegate callback.
                 timer.callback();
               }
@@ -204,6 +224,101 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last call to 'tick'.
+    // Does not call the callbacks. The ids of the expired timers are written
+    // to 'expired', so that they may be dispatched later from thread context.
+    // At most 'max_expired' ids are written. Any time that cannot be processed,
+    // because the output is full or the timer is busy, is carried over to the
+    // next call of 'tick'.
+    // Returns the number of ids written.
+    //*******************************************
+    template <typename TOutputIterator>
+    size_t tick(tick_type count, TOutputIterator expired, size_t max_expired)
+    {
+      size_t n_expired = 0U;
+
+      if (enabled)
+      {
+        count += carried_count;
+        carried_count = 0U;
+
+        if (process_semaphore == 0U)
+        {
+          // We have something to do?
+          bool has_active = !active_list.empty();
+
+          while (has_active && (n_expired < max_expired) && (count >= active_list.front().delta))
+          {
+            timer_data& timer = active_list.front();
+
+            count -= timer.delta;
+
+            active_list.remove(timer.id, true);
+
+            *expired = timer.id;
+            ++expired;
+            ++n_expired;
+
+            if (timer.repeating)
+            {
+              // Reinsert the timer.
+              timer.delta = timer.period;
+              active_list.insert(timer.id);
+            }
+
+            has_active = !active_list.empty();
+          }
+
+          if (has_active)
+          {
+            timer_data& timer = active_list.front();
+
+            if (count >= timer.delta)
+            {
+              // The output is full. The front timer is due now, so carry the rest over.
+              count -= timer.delta;
+              timer.delta = 0U;
+              carried_count = count;
+            }
+            else
+            {
+              // Subtract any remainder from the next due timeout.
+              timer.delta -= count;
+            }
+          }
+        }
+        else
+        {
+          carried_count = count;
+        }
+      }
+
+      return n_expired;
+    }
+
+    //*******************************************
+    /// Calls the callback of a timer.
+    /// Used to dispatch the ids returned by the deferred 'tick'.
+    /// Returns <b>true</b> if the timer is registered and has a callback.
+    //*******************************************
+    bool dispatch(etl::timer::id::type id_) const
+    {
+      if (is_valid_timer_id(id_))
+      {
+        const timer_data& timer = timer_array[id_];
+
+        if ((timer.id != etl::timer::id::NO_TIMER) && timer.callback.is_valid())
+        {
+          timer.callback();
+          return true;
+        }
+      }
+
+      return false;
+    }
+
     //*******************************************
     /// Starts a timer.
     //*******************************************
@@ -220,7 +335,7 @@ namespace etl
         if (timer.id != etl::timer::id::NO_TIMER)
         {
           // Has a valid period.
-          if (timer.period != etl::timer::state::Inactive)
+          if (timer.period != Inactive)
           {
             ++process_semaphore;
             if (timer.is_active())
@@ -272,7 +387,7 @@ namespace etl
     //*******************************************
     /// Sets a timer's period.
     //*******************************************
-    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    bool set_period(etl::timer::id::type id_, tick_type period_)
     {
       if (stop(id_))
       {
@@ -311,11 +426,11 @@ namespace etl
 
     //*******************************************
     /// Get the time to the next timer event.
-    /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+    /// Returns No_Active_Interval if there is no active timer.
     //*******************************************
-    uint32_t time_to_next() const
+    tick_type time_to_next() const
     {
-      uint32_t delta = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+      tick_type delta = No_Active_Interval;
 
       ++process_semaphore;
       if (!active_list.empty())
@@ -365,7 +480,7 @@ namespace etl
       timer_data()
         : callback()
         , period(0U)
-        , delta(etl::timer::state::Inactive)
+        , delta(Inactive)
         , id(etl::timer::id::NO_TIMER)
         , previous(etl::timer::id::NO_TIMER)
         , next(etl::timer::id::NO_TIMER)
@@ -378,11 +493,11 @@ namespace etl
       //*******************************************
       timer_data(etl::timer::id::type id_,
                  callback_type        callback_,
-                 uint32_t             period_,
+                 tick_type            period_,
                  bool                 repeating_)
         : callback(callback_)
         , period(period_)
-        , delta(etl::timer::state::Inactive)
+        , delta(Inactive)
         , id(id_)
         , previous(etl::timer::id::NO_TIMER)
         , next(etl::timer::id::NO_TIMER)
@@ -395,7 +510,7 @@ namespace etl
       //*******************************************
       bool is_active() const
       {
-        return delta != etl::timer::state::Inactive;
+        return delta != Inactive;
       }
 
       //*******************************************
@@ -403,12 +518,12 @@ namespace etl
       //*******************************************
       void set_inactive()
       {
-        delta = etl::timer::state::Inactive;
+        delta = Inactive;
       }
 
       callback_type        callback;
-      uint32_t             period;
-      uint32_t             delta;
+      tick_type            period;
+      tick_type            delta;
       etl::timer::id::type id;
       uint_least8_t        previous;
       uint_least8_t        next;
@@ -429,6 +544,7 @@ namespace etl
       , active_list(timer_array_)
       , enabled(false)
       , process_semaphore(0U)
+      , carried_count(0U)
       , number_of_registered_timers(0U)
       , MAX_TIMERS(MAX_TIMERS_)
     {
@@ -566,7 +682,7 @@ namespace etl
 
         timer.previous = etl::timer::id::NO_TIMER;
         timer.next = etl::timer::id::NO_TIMER;
-        timer.delta = etl::timer::state::Inactive;
+        timer.delta = Inactive;
       }
 
       //*******************************
@@ -636,6 +752,7 @@ namespace etl
 
     bool enabled;
     mutable TSemaphore process_semaphore;
+    tick_type carried_count; ///< Time not yet processed by a deferred tick.
     uint_least8_t number_of_registered_timers;
 
   public:
@@ -643,11 +760,17 @@ namespace etl
     const uint_least8_t MAX_TIMERS;
   };
 
+  template <typename TSemaphore, typename TTick>
+  ETL_CONSTANT typename icallback_timer_atomic<TSemaphore, TTick>::tick_type icallback_timer_atomic<TSemaphore, TTick>::Inactive;
+
+  template <typename TSemaphore, typename TTick>
+  ETL_CONSTANT typename icallback_timer_atomic<TSemaphore, TTick>::tick_type icallback_timer_atomic<TSemaphore, TTick>::No_Active_Interval;
+
   //***************************************************************************
   /// The callback timer
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_, typename TSemaphore>
-  class callback_timer_atomic : public etl::icallback_timer_atomic<TSemaphore>
+  template <uint_least8_t MAX_TIMERS_, typename TSemaphore, typename TTick = uint32_t>
+  class callback_timer_atomic : public etl::icallback_timer_atomic<TSemaphore, TTick>
   {
   public:
 
@@ -657,13 +780,13 @@ namespace etl
     /// Constructor.
     //*******************************************
     callback_timer_atomic()
-      : icallback_timer_atomic<TSemaphore>(timer_array, MAX_TIMERS_)
+      : icallback_timer_atomic<TSemaphore, TTick>(timer_array, MAX_TIMERS_)
     {
     }
 
   private:
 
-    typename etl::icallback_timer_atomic<TSemaphore>::timer_data timer_array[MAX_TIMERS_];
+    typename etl::icallback_timer_atomic<TSemaphore, TTick>::timer_data timer_array[MAX_TIMERS_];
   };
 }
 
@@ -30,11 +30,15 @@ SOFTWARE.
 #define ETL_CALLBACK_TIMER_INTERRUPT_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
+#include "latency_monitor.h"
 #include "algorithm.h"
 #include "nullptr.h"
 #include "delegate.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "integral_limits.h"
+#include "type_traits.h"
 #include "error_handler.h"
 #include "placement_new.h"
 
@@ -45,18 +49,25 @@ namespace etl
   //***************************************************************************
   /// Interface for callback timer
   //***************************************************************************
-  template <typename TInterruptGuard>
+  template <typename TInterruptGuard, typename TTick = uint32_t>
   class icallback_timer_interrupt
   {
   public:
 
     typedef etl::delegate<void(void)> callback_type;
 
+    ETL_STATIC_ASSERT(etl::is_unsigned<TTick>::value, "TTick must be an unsigned integral type");
+
+    typedef TTick tick_type;
+
+    static ETL_CONSTANT tick_type Inactive           = etl::integral_limits<tick_type>::max; ///< The delta of an inactive timer.
+    static ETL_CONSTANT tick_type No_Active_Interval = etl::integral_limits<tick_type>::max; ///< Returned by time_to_next() when no timer is active.
+
     //*******************************************
     /// Register a timer.
     //*******************************************
     etl::timer::id::type register_timer(const callback_type& callback_,
-                                        uint32_t             period_,
+                                        tick_type            period_,
                                         bool                 repeating_)
     {
       etl::timer::id::type id = etl::timer::id::NO_TIMER;
@@ -160,7 +171,7 @@ namespace etl
     // Returns true if the tick was processed,
     // false if not.
     //*******************************************
-    bool tick(uint32_t count)
+    bool tick(tick_type count)
     {
       if (enabled)
       {
@@ -177,8 +188,12 @@ namespace etl
 
             active_list.remove(timer.id, true);
 
+            ETL_TRACE(etl::trace_event::timer_expired, this, timer.id);
+
             if (timer.callback.is_valid())
             {
+              ETL_LATENCY_SCOPE(etl::latency_domain::timer, timer.id);
+
               timer.callback();
             }
 
@@ -221,7 +236,7 @@ namespace etl
         if (timer.id != etl::timer::id::NO_TIMER)
         {
           // Has a valid period.
-          if (timer.period != etl::timer::state::Inactive)
+          if (timer.period != Inactive)
           {
             TInterruptGuard guard;
             (void)guard; // Silence 'unused variable warnings.
@@ -275,7 +290,7 @@ namespace etl
     //*******************************************
     /// Sets a timer's period.
     //*******************************************
-    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    bool set_period(etl::timer::id::type id_, tick_type period_)
     {
       if (stop(id_))
       {
@@ -312,11 +327,11 @@ namespace etl
 
     //*******************************************
     /// Get the time to the next timer event.
-    /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+    /// Returns No_Active_Interval if there is no active timer.
     //*******************************************
-    uint32_t time_to_next() const
+    tick_type time_to_next() const
     {
-      uint32_t delta = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+      tick_type delta = No_Active_Interval;
 
       TInterruptGuard guard;
       (void)guard; // Silence 'unused variable warnings.
@@ -366,7 +381,7 @@ namespace etl
       timer_data()
         : callback()
         , period(0U)
-        , delta(etl::timer::state::Inactive)
+        , delta(Inactive)
         , id(etl::timer::id::NO_TIMER)
         , previous(etl::timer::id::NO_TIMER)
         , next(etl::timer::id::NO_TIMER)
@@ -379,11 +394,11 @@ namespace etl
       //*******************************************
       timer_data(etl::timer::id::type id_,
                  callback_type        callback_,
-                 uint32_t             period_,
+                 tick_type            period_,
                  bool                 repeating_)
         : callback(callback_)
         , period(period_)
-        , delta(etl::timer::state::Inactive)
+        , delta(Inactive)
         , id(id_)
         , previous(etl::timer::id::NO_TIMER)
         , next(etl::timer::id::NO_TIMER)
@@ -396,7 +411,7 @@ namespace etl
       //*******************************************
       bool is_active() const
       {
-        return delta != etl::timer::state::Inactive;
+        return delta != Inactive;
       }
 
       //*******************************************
@@ -404,12 +419,12 @@ namespace etl
       //*******************************************
       void set_inactive()
       {
-        delta = etl::timer::state::Inactive;
+        delta = Inactive;
       }
 
       callback_type        callback;
-      uint32_t             period;
-      uint32_t             delta;
+      tick_type            period;
+      tick_type            delta;
       etl::timer::id::type id;
       uint_least8_t        previous;
       uint_least8_t        next;
@@ -566,7 +581,7 @@ namespace etl
 
         timer.previous = etl::timer::id::NO_TIMER;
         timer.next     = etl::timer::id::NO_TIMER;
-        timer.delta    = etl::timer::state::Inactive;
+        timer.delta    = Inactive;
       }
 
       //*******************************
@@ -642,29 +657,35 @@ namespace etl
     const uint_least8_t MAX_TIMERS;
   };
 
+  template <typename TInterruptGuard, typename TTick>
+  ETL_CONSTANT typename icallback_timer_interrupt<TInterruptGuard, TTick>::tick_type icallback_timer_interrupt<TInterruptGuard, TTick>::Inactive;
+
+  template <typename TInterruptGuard, typename TTick>
+  ETL_CONSTANT typename icallback_timer_interrupt<TInterruptGuard, TTick>::tick_type icallback_timer_interrupt<TInterruptGuard, TTick>::No_Active_Interval;
+
   //***************************************************************************
   /// The callback timer
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_, typename TInterruptGuard>
-  class callback_timer_interrupt : public etl::icallback_timer_interrupt<TInterruptGuard>
+  template <uint_least8_t MAX_TIMERS_, typename TInterruptGuard, typename TTick = uint32_t>
+  class callback_timer_interrupt : public etl::icallback_timer_interrupt<TInterruptGuard, TTick>
   {
   public:
 
     ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254U, "No more than 254 timers are allowed");
 
-    typedef typename icallback_timer_interrupt<TInterruptGuard>::callback_type callback_type;
+    typedef typename icallback_timer_interrupt<TInterruptGuard, TTick>::callback_type callback_type;
 
     //*******************************************
     /// Constructor.
     //*******************************************
     callback_timer_interrupt()
-      : icallback_timer_interrupt<TInterruptGuard>(timer_array, MAX_TIMERS_)
+      : icallback_timer_interrupt<TInterruptGuard, TTick>(timer_array, MAX_TIMERS_)
     {
     }
 
   private:
 
-    typename icallback_timer_interrupt<TInterruptGuard>::timer_data timer_array[MAX_TIMERS_];
+    typename icallback_timer_interrupt<TInterruptGuard, TTick>::timer_data timer_array[MAX_TIMERS_];
   };
 }
 
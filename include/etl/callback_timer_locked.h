@@ -30,6 +30,8 @@ SOFTWARE.
 #define ETL_CALLBACK_TIMER_LOCKED_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
+#include "latency_monitor.h"
 #include "algorithm.h"
 #include "nullptr.h"
 #include "delegate.h"
@@ -37,11 +39,58 @@ SOFTWARE.
 #include "timer.h"
 #include "error_handler.h"
 #include "placement_new.h"
+#include "queue_mpmc_atomic.h"
 
 #include <stdint.h>
 
 namespace etl
 {
+  namespace private_callback_timer_locked
+  {
+    //*************************************************************************
+    /// A start or stop request, queued for the next tick.
+    //*************************************************************************
+    struct command
+    {
+      enum type
+      {
+        Start,
+        Start_Immediate,
+        Stop
+      };
+
+      etl::timer::id::type id;
+      uint_least8_t        action;
+    };
+
+#if ETL_HAS_ATOMIC
+    typedef etl::iqueue_mpmc_atomic<command> icommand_queue;
+
+    //*************************************************************************
+    /// The storage for the command queue, if commands are deferred.
+    //*************************************************************************
+    template <size_t COMMAND_QUEUE_SIZE_>
+    struct command_storage
+    {
+      icommand_queue* get()
+      {
+        return &queue;
+      }
+
+      etl::queue_mpmc_atomic<command, COMMAND_QUEUE_SIZE_> queue;
+    };
+
+    template <>
+    struct command_storage<0U>
+    {
+      icommand_queue* get()
+      {
+        return ETL_NULLPTR;
+      }
+    };
+#endif
+  }
+
   //***************************************************************************
   /// Interface for callback timer
   //***************************************************************************
@@ -140,6 +189,15 @@ namespace etl
     {
       lock();
       active_list.clear();
+#if ETL_HAS_ATOMIC
+      if (pcommands != ETL_NULLPTR)
+      {
+        // Discard any deferred commands.
+        while (pcommands->pop())
+        {
+        }
+      }
+#endif
       unlock();
 
       for (uint8_t i = 0U; i < MAX_TIMERS; ++i)
@@ -153,6 +211,7 @@ namespace etl
     //*******************************************
     // Called by the timer service to indicate the
     // amount of time that has elapsed since the last successful call to 'tick'.
+    // Any deferred start and stop commands are applied first.
     // Returns true if the tick was processed,
     // false if not.
     //*******************************************
@@ -162,6 +221,8 @@ namespace etl
       {
         if (try_lock())
         {
+          apply_commands();
+
           // We have something to do?
           bool has_active = !active_list.empty();
 
@@ -175,8 +236,12 @@ namespace etl
 
               active_list.remove(timer.id, true);
 
+              ETL_TRACE(etl::trace_event::timer_expired, this, timer.id);
+
               if (timer.callback.is_valid())
               {
+                ETL_LATENCY_SCOPE(etl::latency_domain::timer, timer.id);
+
                 timer.callback();
               }
 
@@ -208,6 +273,8 @@ namespace etl
 
     //*******************************************
     /// Starts a timer.
+    /// If commands are deferred then the start is queued for the next tick,
+    /// without locking, and false is returned if the queue is full.
     //*******************************************
     bool start(etl::timer::id::type id_, bool immediate_ = false)
     {
@@ -224,6 +291,11 @@ namespace etl
           // Has a valid period.
           if (timer.period != etl::timer::state::Inactive)
           {
+            if (is_deferred())
+            {
+              return push_command(id_, immediate_ ? command_type::Start_Immediate : command_type::Start);
+            }
+
             lock();
             if (timer.is_active())
             {
@@ -244,6 +316,8 @@ namespace etl
 
     //*******************************************
     /// Stops a timer.
+    /// If commands are deferred then the stop is queued for the next tick,
+    /// without locking, and false is returned if the queue is full.
     //*******************************************
     bool stop(etl::timer::id::type id_)
     {
@@ -257,6 +331,11 @@ namespace etl
         // Registered timer?
         if (timer.id != etl::timer::id::NO_TIMER)
         {
+          if (is_deferred())
+          {
+            return push_command(id_, command_type::Stop);
+          }
+
           if (timer.is_active())
           {
             lock();
@@ -299,6 +378,18 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    /// Are start and stop commands queued for the next tick?
+    //*******************************************
+    bool is_deferred() const
+    {
+#if ETL_HAS_ATOMIC
+      return pcommands != ETL_NULLPTR;
+#else
+      return false;
+#endif
+    }
+
     //*******************************************
     /// Sets the lock and unlock delegates.
     //*******************************************
@@ -369,6 +460,8 @@ namespace etl
 
   protected:
 
+    typedef private_callback_timer_locked::command command_type;
+
     //*************************************************************************
     /// The configuration of a timer.
     struct timer_data
@@ -441,10 +534,23 @@ namespace etl
         active_list(timer_array_),
         enabled(false),
         number_of_registered_timers(0U),
+#if ETL_HAS_ATOMIC
+        pcommands(ETL_NULLPTR),
+#endif
         MAX_TIMERS(MAX_TIMERS_)
     {
     }
 
+#if ETL_HAS_ATOMIC
+    //*******************************************
+    /// Sets the queue for deferred start and stop commands.
+    //*******************************************
+    void set_command_queue(private_callback_timer_locked::icommand_queue* pcommands_)
+    {
+      pcommands = pcommands_;
+    }
+#endif
+
   private:
 
     //*************************************************************************
@@ -639,6 +745,58 @@ namespace etl
       return (id_ < MAX_TIMERS);
     }
 
+    //*******************************************
+    /// Queues a command for the next tick.
+    //*******************************************
+    bool push_command(etl::timer::id::type id_, uint_least8_t action_)
+    {
+#if ETL_HAS_ATOMIC
+      command_type cmd;
+      cmd.id     = id_;
+      cmd.action = action_;
+
+      return pcommands->push(cmd);
+#else
+      (void)id_;
+      (void)action_;
+      return false;
+#endif
+    }
+
+    //*******************************************
+    /// Applies the queued commands to the active list.
+    /// Called from tick, with the lock held.
+    //*******************************************
+    void apply_commands()
+    {
+#if ETL_HAS_ATOMIC
+      if (pcommands != ETL_NULLPTR)
+      {
+        command_type cmd;
+
+        while (pcommands->pop(cmd))
+        {
+          timer_data& timer = timer_array[cmd.id];
+
+          // Still registered?
+          if (timer.id != etl::timer::id::NO_TIMER)
+          {
+            if (timer.is_active())
+            {
+              active_list.remove(timer.id, false);
+            }
+
+            if ((cmd.action != command_type::Stop) && (timer.period != etl::timer::state::Inactive))
+            {
+              timer.delta = (cmd.action == command_type::Start_Immediate) ? 0U : timer.period;
+              active_list.insert(timer.id);
+            }
+          }
+        }
+      }
+#endif
+    }
+
     // The array of timer data structures.
     timer_data* const timer_array;
 
@@ -652,6 +810,10 @@ namespace etl
     lock_type     lock;     ///< The callback that locks.
     unlock_type   unlock;   ///< The callback that unlocks.
 
+#if ETL_HAS_ATOMIC
+    private_callback_timer_locked::icommand_queue* pcommands; ///< The deferred commands, or null.
+#endif
+
   public:
 
     const uint_least8_t MAX_TIMERS;
@@ -659,13 +821,21 @@ namespace etl
 
   //***************************************************************************
   /// The callback timer
+  ///\tparam MAX_TIMERS_         The maximum number of timers.
+  ///\tparam COMMAND_QUEUE_SIZE_ If not zero, start and stop do not lock. They
+  /// push a command to a lock free queue of this size, which is applied at the
+  /// start of the next tick, so only the tick's context changes the active
+  /// list. Requires atomics.
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_>
+  template <uint_least8_t MAX_TIMERS_, size_t COMMAND_QUEUE_SIZE_ = 0U>
   class callback_timer_locked : public etl::icallback_timer_locked
   {
   public:
 
     ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254U, "No more than 254 timers are allowed");
+#if !ETL_HAS_ATOMIC
+    ETL_STATIC_ASSERT(COMMAND_QUEUE_SIZE_ == 0U, "Deferred commands require atomics");
+#endif
 
     typedef icallback_timer_locked::callback_type callback_type;
     typedef icallback_timer_locked::try_lock_type try_lock_type;
@@ -678,6 +848,9 @@ namespace etl
     callback_timer_locked()
       : icallback_timer_locked(timer_array, MAX_TIMERS_)
     {
+#if ETL_HAS_ATOMIC
+      this->set_command_queue(commands.get());
+#endif
     }
 
     //*******************************************
@@ -687,11 +860,18 @@ namespace etl
       : icallback_timer_locked(timer_array, MAX_TIMERS_)
     {
       this->set_locks(try_lock_, lock_, unlock_);
+#if ETL_HAS_ATOMIC
+      this->set_command_queue(commands.get());
+#endif
     }
 
   private:
 
     timer_data timer_array[MAX_TIMERS_];
+
+#if ETL_HAS_ATOMIC
+    private_callback_timer_locked::command_storage<COMMAND_QUEUE_SIZE_> commands;
+#endif
   };
 }
 
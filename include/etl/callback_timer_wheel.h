@@ -0,0 +1,692 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+
+#include "platform.h"
+#include "trace.h"
+#include "latency_monitor.h"
+#include "nullptr.h"
+#include "delegate.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "error_handler.h"
+#include "placement_new.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for callback timer using a hierarchical timing wheel.
+  /// Has the same interface as etl::icallback_timer_interrupt, but start and
+  /// stop are O(1) and tick is amortised O(1) per elapsed tick, regardless of
+  /// the number of active timers.
+  /// A large tick count skips directly over the periods that hold no expiries,
+  /// so the timer may be driven tickless, by sleeping for time_to_next() and
+  /// then calling tick() with the time actually elapsed.
+  /// The wheel has six levels of 64 slots. A timer is held in the level that
+  /// covers its remaining time, and moves down a level each time the level
+  /// below completes a revolution.
+  //***************************************************************************
+  template <typename TInterruptGuard>
+  class icallback_timer_wheel
+  {
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(const callback_type& callback_,
+                                        uint32_t             period_,
+                                        bool                 repeating_)
+    {
+      etl::timer::id::type id = etl::timer::id::NO_TIMER;
+
+      bool is_space = (number_of_registered_timers < MAX_TIMERS);
+
+      if (is_space)
+      {
+        // Search for the free space.
+        for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+        {
+          timer_data& timer = timer_array[i];
+
+          if (timer.id == etl::timer::id::NO_TIMER)
+          {
+            TInterruptGuard guard;
+            (void)guard; // Silence 'unused variable warnings.
+
+            // Create in-place.
+            new (&timer) timer_data(i, callback_, period_, repeating_);
+            ++number_of_registered_timers;
+            id = i;
+            break;
+          }
+        }
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            TInterruptGuard guard;
+            (void)guard; // Silence 'unused variable warnings.
+
+            remove(timer);
+          }
+
+          // Reset in-place.
+          new (&timer) timer_data();
+          --number_of_registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      {
+        TInterruptGuard guard;
+        (void)guard; // Silence 'unused variable warnings.
+
+        for (uint_least16_t i = 0U; i < Number_Of_Slots; ++i)
+        {
+          slots[i] = etl::timer::id::NO_TIMER;
+        }
+
+        for (uint_least16_t i = 0U; i < Number_Of_Levels; ++i)
+        {
+          timers_in_level[i] = 0U;
+        }
+
+        number_of_active_timers     = 0U;
+        number_of_registered_timers = 0U;
+      }
+
+      for (uint8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) timer_data();
+      }
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        // Timers that were started with no delay since the last tick.
+        expire_slot(current_time);
+
+        while ((count != 0U) && (number_of_active_timers != 0U))
+        {
+          uint32_t step = ticks_to_next_event();
+
+          if (step > count)
+          {
+            step = count;
+          }
+
+          current_time += step;
+          count        -= step;
+
+          cascade();
+          expire_slot(current_time);
+        }
+
+        // Nothing left to expire, so skip the remainder in one step.
+        current_time += count;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::Inactive)
+          {
+            TInterruptGuard guard;
+            (void)guard; // Silence 'unused variable warnings.
+
+            if (timer.is_active())
+            {
+              remove(timer);
+            }
+
+            timer.expiry = current_time + (immediate_ ? 0U : timer.period);
+            insert(timer);
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            TInterruptGuard guard;
+            (void)guard; // Silence 'unused variable warnings.
+
+            remove(timer);
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Check if there is an active timer.
+    //*******************************************
+    bool has_active_timer() const
+    {
+      TInterruptGuard guard;
+      (void)guard; // Silence 'unused variable warnings.
+      return number_of_active_timers != 0U;
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event.
+    /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+    /// Searches the timers, so is O(MAX_TIMERS).
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      uint32_t delta = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+
+      TInterruptGuard guard;
+      (void)guard; // Silence 'unused variable warnings.
+
+      for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        const timer_data& timer = timer_array[i];
+
+        if (timer.is_active())
+        {
+          uint32_t remaining = timer.expiry - current_time;
+
+          if (remaining < delta)
+          {
+            delta = remaining;
+          }
+        }
+      }
+
+      return delta;
+    }
+
+    //*******************************************
+    /// Checks if a timer is currently active.
+    /// Returns <b>true</b> if the timer is active, otherwise <b>false</b>.
+    //*******************************************
+    bool is_active(etl::timer::id::type id_) const
+    {
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        TInterruptGuard guard;
+        (void)guard;  // Silence 'unused variable warnings.
+
+        const timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          return timer.is_active();
+        }
+      }
+
+      return false;
+    }
+
+  protected:
+
+    static ETL_CONSTANT uint_least16_t Slot_Bits       = 6U;
+    static ETL_CONSTANT uint_least16_t Slots_Per_Level = 1U << Slot_Bits;
+    static ETL_CONSTANT uint_least16_t Number_Of_Levels = 6U; // 6 x 6 bits covers a uint32_t.
+    static ETL_CONSTANT uint_least16_t Number_Of_Slots = Slots_Per_Level * Number_Of_Levels;
+    static ETL_CONSTANT uint_least16_t No_Slot         = 0xFFFFU;
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    struct timer_data
+    {
+      //*******************************************
+      timer_data()
+        : callback()
+        , period(0U)
+        , expiry(0U)
+        , slot(No_Slot)
+        , id(etl::timer::id::NO_TIMER)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(true)
+      {
+      }
+
+      //*******************************************
+      /// ETL delegate callback
+      //*******************************************
+      timer_data(etl::timer::id::type id_,
+                 callback_type        callback_,
+                 uint32_t             period_,
+                 bool                 repeating_)
+        : callback(callback_)
+        , period(period_)
+        , expiry(0U)
+        , slot(No_Slot)
+        , id(id_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(repeating_)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return slot != No_Slot;
+      }
+
+      //*******************************************
+      /// Sets the timer to the inactive state.
+      //*******************************************
+      void set_inactive()
+      {
+        slot = No_Slot;
+      }
+
+      callback_type        callback;
+      uint32_t             period;
+      uint32_t             expiry;
+      uint_least16_t       slot;
+      etl::timer::id::type id;
+      uint_least8_t        previous;
+      uint_least8_t        next;
+      bool                 repeating;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other) ETL_DELETE;
+      timer_data& operator =(const timer_data& other) ETL_DELETE;
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel(timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
+      : timer_array(timer_array_)
+      , current_time(0U)
+      , enabled(false)
+      , number_of_active_timers(0U)
+      , number_of_registered_timers(0U)
+      , MAX_TIMERS(MAX_TIMERS_)
+    {
+      for (uint_least16_t i = 0U; i < Number_Of_Slots; ++i)
+      {
+        slots[i] = etl::timer::id::NO_TIMER;
+      }
+
+      for (uint_least16_t i = 0U; i < Number_Of_Levels; ++i)
+      {
+        timers_in_level[i] = 0U;
+      }
+    }
+
+  private:
+
+    //*******************************************
+    /// Check that the timer id is valid.
+    //*******************************************
+    bool is_valid_timer_id(etl::timer::id::type id_) const
+    {
+      return (id_ < MAX_TIMERS);
+    }
+
+    //*******************************************
+    /// Gets the slot for an expiry time.
+    /// The level is the one that covers the time remaining.
+    //*******************************************
+    uint_least16_t slot_for(uint32_t expiry) const
+    {
+      const uint32_t remaining = expiry - current_time;
+
+      uint_least16_t level = 0U;
+
+      while ((level < (Number_Of_Levels - 1U)) && ((remaining >> (Slot_Bits * (level + 1U))) != 0U))
+      {
+        ++level;
+      }
+
+      return uint_least16_t((level * Slots_Per_Level) + ((expiry >> (Slot_Bits * level)) & (Slots_Per_Level - 1U)));
+    }
+
+    //*******************************************
+    /// Adds the timer to the front of its slot.
+    //*******************************************
+    void insert(timer_data& timer)
+    {
+      const uint_least16_t slot = slot_for(timer.expiry);
+
+      timer.slot     = slot;
+      timer.previous = etl::timer::id::NO_TIMER;
+      timer.next     = slots[slot];
+
+      if (timer.next != etl::timer::id::NO_TIMER)
+      {
+        timer_array[timer.next].previous = timer.id;
+      }
+
+      slots[slot] = timer.id;
+      ++timers_in_level[slot / Slots_Per_Level];
+      ++number_of_active_timers;
+    }
+
+    //*******************************************
+    /// Unlinks the timer from its slot.
+    //*******************************************
+    void remove(timer_data& timer)
+    {
+      if (timer.previous == etl::timer::id::NO_TIMER)
+      {
+        slots[timer.slot] = timer.next;
+      }
+      else
+      {
+        timer_array[timer.previous].next = timer.next;
+      }
+
+      if (timer.next != etl::timer::id::NO_TIMER)
+      {
+        timer_array[timer.next].previous = timer.previous;
+      }
+
+      --timers_in_level[timer.slot / Slots_Per_Level];
+      --number_of_active_timers;
+
+      timer.previous = etl::timer::id::NO_TIMER;
+      timer.next     = etl::timer::id::NO_TIMER;
+      timer.set_inactive();
+    }
+
+    //*******************************************
+    /// Gets the number of ticks until the wheel next needs attention.
+    /// If the lowest occupied level is above zero then nothing can expire or
+    /// cascade until the start of its next slot.
+    //*******************************************
+    uint32_t ticks_to_next_event() const
+    {
+      uint_least16_t level = 0U;
+
+      while (timers_in_level[level] == 0U)
+      {
+        ++level;
+      }
+
+      if (level == 0U)
+      {
+        return 1U;
+      }
+
+      const uint32_t span = uint32_t(1U) << (Slot_Bits * level);
+
+      return span - (current_time & (span - 1U));
+    }
+
+    //*******************************************
+    /// Moves the timers in the upper level slots that are now in range
+    /// down to the lower levels.
+    //*******************************************
+    void cascade()
+    {
+      for (uint_least16_t level = 1U; level < Number_Of_Levels; ++level)
+      {
+        // Has the level below completed a revolution?
+        if (((current_time >> (Slot_Bits * (level - 1U))) & (Slots_Per_Level - 1U)) != 0U)
+        {
+          break;
+        }
+
+        const uint_least16_t slot = uint_least16_t((level * Slots_Per_Level) + ((current_time >> (Slot_Bits * level)) & (Slots_Per_Level - 1U)));
+
+        // Timers always move to a lower level, so never return to this slot.
+        while (slots[slot] != etl::timer::id::NO_TIMER)
+        {
+          timer_data& timer = timer_array[slots[slot]];
+
+          remove(timer);
+          insert(timer);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Calls the timers that expire at 'time'.
+    //*******************************************
+    void expire_slot(uint32_t time)
+    {
+      const uint_least16_t slot = uint_least16_t(time & (Slots_Per_Level - 1U));
+
+      while (slots[slot] != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[slots[slot]];
+
+        remove(timer);
+
+        if (timer.repeating)
+        {
+          // Reinsert the timer, always at least one tick on.
+          timer.expiry = time + ((timer.period != 0U) ? timer.period : 1U);
+          insert(timer);
+        }
+
+        ETL_TRACE(etl::trace_event::timer_expired, this, timer.id);
+
+        if (timer.callback.is_valid())
+        {
+          ETL_LATENCY_SCOPE(etl::latency_domain::timer, timer.id);
+
+          timer.callback();
+        }
+      }
+    }
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The head of the list of timers in each slot.
+    etl::timer::id::type slots[Number_Of_Slots];
+
+    // The number of timers in each level.
+    uint_least8_t timers_in_level[Number_Of_Levels];
+
+    uint32_t current_time;
+
+    bool enabled;
+    uint_least8_t number_of_active_timers;
+    uint_least8_t number_of_registered_timers;
+
+  public:
+
+    const uint_least8_t MAX_TIMERS;
+  };
+
+  template <typename TInterruptGuard>
+  ETL_CONSTANT uint_least16_t icallback_timer_wheel<TInterruptGuard>::Slot_Bits;
+
+  template <typename TInterruptGuard>
+  ETL_CONSTANT uint_least16_t icallback_timer_wheel<TInterruptGuard>::Slots_Per_Level;
+
+  template <typename TInterruptGuard>
+  ETL_CONSTANT uint_least16_t icallback_timer_wheel<TInterruptGuard>::Number_Of_Levels;
+
+  template <typename TInterruptGuard>
+  ETL_CONSTANT uint_least16_t icallback_timer_wheel<TInterruptGuard>::Number_Of_Slots;
+
+  template <typename TInterruptGuard>
+  ETL_CONSTANT uint_least16_t icallback_timer_wheel<TInterruptGuard>::No_Slot;
+
+  //***************************************************************************
+  /// The callback timer
+  //***************************************************************************
+  template <uint_least8_t MAX_TIMERS_, typename TInterruptGuard>
+  class callback_timer_wheel : public etl::icallback_timer_wheel<TInterruptGuard>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254U, "No more than 254 timers are allowed");
+
+    typedef typename icallback_timer_wheel<TInterruptGuard>::callback_type callback_type;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : icallback_timer_wheel<TInterruptGuard>(timer_array, MAX_TIMERS_)
+    {
+    }
+
+  private:
+
+    typename icallback_timer_wheel<TInterruptGuard>::timer_data timer_array[MAX_TIMERS_];
+  };
+}
+
+#endif
@@ -30,6 +30,7 @@ SOFTWARE.
 #include "platform.h"
 #include "binary.h"
 #include "frame_check_sequence.h"
+#include "private/checksum_simd.h"
 
 #include <stdint.h>
 
@@ -56,6 +57,64 @@ namespace etl
       return sum + value;
     }
 
+    //*********************************
+    /// Adds a block, summing the bytes of each word in 16 bit lanes.
+    T add(T sum, const uint8_t* p_data, size_t length) const
+    {
+      typedef private_frame_check_sequence::word_access word_access;
+      typedef word_access::word_type                    word_type;
+
+      // 0x00FF00FF...
+      const word_type Lane_Mask = word_type(word_type(~word_type(0U)) / 0xFFFFU) * 0xFFU;
+      // Each word adds at most 2 x 255 to a 16 bit lane.
+      const size_t Max_Words = 0xFFFFU / (2U * 0xFFU);
+
+      size_t head = word_access::head_length(p_data, length);
+      length -= head;
+
+      while (head != 0U)
+      {
+        sum += *p_data++;
+        --head;
+      }
+
+#if ETL_CHECKSUM_USING_SIMD
+      sum += T(private_checksum::simd_sum(p_data, length));
+#endif
+
+      while (length >= sizeof(word_type))
+      {
+        size_t words = length / sizeof(word_type);
+        words  = (words > Max_Words) ? Max_Words : words;
+        length -= words * sizeof(word_type);
+
+        word_type lanes = 0U;
+
+        while (words != 0U)
+        {
+          const word_type word = word_access::load(p_data);
+
+          lanes  += (word & Lane_Mask) + ((word >> 8U) & Lane_Mask);
+          p_data += sizeof(word_type);
+          --words;
+        }
+
+        while (lanes != 0U)
+        {
+          sum   += T(lanes & 0xFFFFU);
+          lanes >>= 16U;
+        }
+      }
+
+      while (length != 0U)
+      {
+        sum += *p_data++;
+        --length;
+      }
+
+      return sum;
+    }
+
     T final(T sum) const
     {
       return sum;
@@ -104,6 +163,51 @@ namespace etl
       return sum ^ value;
     }
 
+    //*********************************
+    /// Adds a block, combining whole words before folding to a byte.
+    T add(T sum, const uint8_t* p_data, size_t length) const
+    {
+      typedef private_frame_check_sequence::word_access word_access;
+      typedef word_access::word_type                    word_type;
+
+      size_t head = word_access::head_length(p_data, length);
+      length -= head;
+
+      while (head != 0U)
+      {
+        sum ^= *p_data++;
+        --head;
+      }
+
+#if ETL_CHECKSUM_USING_SIMD
+      sum ^= private_checksum::simd_xor(p_data, length);
+#endif
+
+      word_type combined = 0U;
+
+      while (length >= sizeof(word_type))
+      {
+        combined ^= word_access::load(p_data);
+        p_data   += sizeof(word_type);
+        length   -= sizeof(word_type);
+      }
+
+      for (size_t shift = (sizeof(word_type) * 8U) / 2U; shift >= 8U; shift /= 2U)
+      {
+        combined ^= combined >> shift;
+      }
+
+      sum ^= uint8_t(combined);
+
+      while (length != 0U)
+      {
+        sum ^= *p_data++;
+        --length;
+      }
+
+      return sum;
+    }
+
     T final(T sum) const
     {
       return sum;
@@ -152,6 +256,44 @@ namespace etl
       return sum ^ etl::parity(value);
     }
 
+    //*********************************
+    /// Adds a block. The parity of the bytes is the parity of their XOR.
+    T add(T sum, const uint8_t* p_data, size_t length) const
+    {
+      typedef private_frame_check_sequence::word_access word_access;
+      typedef word_access::word_type                    word_type;
+
+      word_type combined = 0U;
+
+      size_t head = word_access::head_length(p_data, length);
+      length -= head;
+
+      while (head != 0U)
+      {
+        combined ^= *p_data++;
+        --head;
+      }
+
+#if ETL_CHECKSUM_USING_SIMD
+      combined ^= private_checksum::simd_xor(p_data, length);
+#endif
+
+      while (length >= sizeof(word_type))
+      {
+        combined ^= word_access::load(p_data);
+        p_data   += sizeof(word_type);
+        length   -= sizeof(word_type);
+      }
+
+      while (length != 0U)
+      {
+        combined ^= *p_data++;
+        --length;
+      }
+
+      return sum ^ etl::parity(combined);
+    }
+
     T final(T sum) const
     {
       return sum;
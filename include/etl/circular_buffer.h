@@ -41,6 +41,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "static_assert.h"
 #include "initializer_list.h"
+#include "span.h"
 
 namespace etl
 {
@@ -147,6 +148,15 @@ namespace etl
     {
     }
 
+    //*************************************************************************
+    /// Wraps an index that is less than twice the buffer size.
+    /// Avoids the division of a modulo.
+    //*************************************************************************
+    size_type wrap(size_type index) const
+    {
+      return (index >= buffer_size) ? (index - buffer_size) : index;
+    }
+
     //*************************************************************************
     void increment_in()
     {
@@ -251,7 +261,7 @@ namespace etl
       //*************************************************************************
       reference operator [](size_t index)
       {
-        return pbuffer[(current + index) % picb->buffer_size];
+        return picb->pbuffer[picb->wrap(current + index)];
       }
 
       //*************************************************************************
@@ -259,7 +269,7 @@ namespace etl
       //*************************************************************************
       const_reference operator [](size_t index) const
       {
-        return pbuffer[(current + index) % picb->buffer_size];
+        return picb->pbuffer[picb->wrap(current + index)];
       }
 
       //*************************************************************************
@@ -325,8 +335,7 @@ namespace etl
       //*************************************************************************
       iterator& operator +=(int n)
       {
-        current += size_type(picb->buffer_size + n);
-        current %= picb->buffer_size;
+        current = picb->wrap(current + size_type((n >= 0) ? n : (int(picb->buffer_size) + n)));
 
         return (*this);
       }
@@ -550,7 +559,7 @@ namespace etl
       //*************************************************************************
       const_reference operator [](size_t index) const
       {
-        return pbuffer[(current + index) % picb->buffer_size];
+        return picb->pbuffer[picb->wrap(current + index)];
       }
 
       //*************************************************************************
@@ -616,8 +625,7 @@ namespace etl
       //*************************************************************************
       const_iterator& operator +=(int n)
       {
-        current += size_type(picb->buffer_size + n);
-        current %= picb->buffer_size;
+        current = picb->wrap(current + size_type((n >= 0) ? n : (int(picb->buffer_size) + n)));
 
         return (*this);
       }
@@ -888,7 +896,7 @@ namespace etl
     //*************************************************************************
     reference operator [](size_t index)
     {
-      return pbuffer[(out + index) % buffer_size];
+      return pbuffer[wrap(out + index)];
     }
 
     //*************************************************************************
@@ -897,7 +905,7 @@ namespace etl
     //*************************************************************************
     const_reference operator [](size_t index) const
     {
-      return pbuffer[(out + index) % buffer_size];
+      return pbuffer[wrap(out + index)];
     }
 
     //*************************************************************************
@@ -950,15 +958,13 @@ namespace etl
 
     //*************************************************************************
     /// Push a buffer from an iterator range.
+    /// If the buffer is filled then the oldest items are overwritten.
+    /// Random access ranges are copied in, at most, two blocks.
     //*************************************************************************
     template <typename TIterator>
     void push(TIterator first, const TIterator& last)
     {
-      while (first != last)
-      {
-        push(*first);
-        ++first;
-      }
+      push_range(first, last, typename etl::iterator_traits<TIterator>::iterator_category());
     }
 
     //*************************************************************************
@@ -974,15 +980,66 @@ namespace etl
 
     //*************************************************************************
     /// pop(n)
+    /// Asserts an error if there are fewer than n items.
     //*************************************************************************
     void pop(size_type n)
     {
-      while (n-- != 0U)
+      ETL_ASSERT_OR_RETURN(n <= size(), ETL_ERROR(circular_buffer_empty));
+
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
+      {
+        out += n;
+
+        if (out >= buffer_size)
+        {
+          out -= buffer_size;
+        }
+
+        ETL_SUBTRACT_DEBUG_COUNT(n);
+      }
+      else
       {
-        pop();
+        while (n-- != 0U)
+        {
+          pop();
+        }
       }
     }
 
+    //*************************************************************************
+    /// The first contiguous block of items, from the front.
+    //*************************************************************************
+    etl::span<T> array_one()
+    {
+      return etl::span<T>(pbuffer + out, (in >= out) ? (in - out) : (buffer_size - out));
+    }
+
+    //*************************************************************************
+    /// The first contiguous block of items, from the front.
+    //*************************************************************************
+    etl::span<const T> array_one() const
+    {
+      return etl::span<const T>(pbuffer + out, (in >= out) ? (in - out) : (buffer_size - out));
+    }
+
+    //*************************************************************************
+    /// The second contiguous block of items, to the back.
+    /// Empty unless the items wrap around the end of the buffer.
+    //*************************************************************************
+    etl::span<T> array_two()
+    {
+      return etl::span<T>(pbuffer, (in >= out) ? 0U : in);
+    }
+
+    //*************************************************************************
+    /// The second contiguous block of items, to the back.
+    /// Empty unless the items wrap around the end of the buffer.
+    //*************************************************************************
+    etl::span<const T> array_two() const
+    {
+      return etl::span<const T>(pbuffer, (in >= out) ? 0U : in);
+    }
+
     //*************************************************************************
     /// Clears the buffer.
     //*************************************************************************
@@ -1089,6 +1146,55 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Pushes an input range, one item at a time.
+    //*************************************************************************
+    template <typename TIterator>
+    void push_range(TIterator first, const TIterator& last, ETL_OR_STD::input_iterator_tag)
+    {
+      while (first != last)
+      {
+        push(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Pushes a random access range, in at most two blocks.
+    /// Only the items that will remain are copied.
+    //*************************************************************************
+    template <typename TIterator>
+    void push_range(TIterator first, const TIterator& last, ETL_OR_STD::random_access_iterator_tag)
+    {
+      size_type n = static_cast<size_type>(etl::distance(first, last));
+
+      if (n > max_size())
+      {
+        first += static_cast<difference_type>(n - max_size());
+        n = max_size();
+      }
+
+      // Forget about the oldest items.
+      if (n > available())
+      {
+        pop(n - available());
+      }
+
+      const size_type run = ((buffer_size - in) < n) ? (buffer_size - in) : n;
+
+      etl::uninitialized_copy(first, first + static_cast<difference_type>(run), pbuffer + in);
+      etl::uninitialized_copy(first + static_cast<difference_type>(run), last, pbuffer);
+
+      in += n;
+
+      if (in >= buffer_size)
+      {
+        in -= buffer_size;
+      }
+
+      ETL_ADD_DEBUG_COUNT(n);
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
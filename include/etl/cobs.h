@@ -0,0 +1,725 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COBS_INCLUDED
+#define ETL_COBS_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "iterator.h"
+#include "delegate.h"
+#include "span.h"
+
+#include "private/framing.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup cobs cobs
+/// Consistent Overhead Byte Stuffing framing.
+/// Each frame is encoded without zero bytes and ends with a zero delimiter.
+/// See https://en.wikipedia.org/wiki/Consistent_Overhead_Byte_Stuffing
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// COBS constants.
+  ///\ingroup cobs
+  //***************************************************************************
+  struct cobs
+  {
+    /// The frame delimiter.
+    static ETL_CONSTANT uint8_t Delimiter = 0x00U;
+
+    /// The most data bytes in a block.
+    static ETL_CONSTANT size_t Max_Block = 254U;
+
+    //*************************************************************************
+    /// The largest encoding of 'length' bytes, with the delimiter.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t max_encoded_size(size_t length)
+    {
+      return length + (length / Max_Block) + 2U;
+    }
+  };
+
+  //***************************************************************************
+  /// COBS encoder.
+  /// Bytes are collected into blocks of up to 254 bytes, which are written
+  /// to the output buffer as each zero, or the 254th byte, arrives.
+  /// Pointer ranges find each zero word at a time and copy the runs between.
+  /// If there is a callback, it is called with each full output buffer and,
+  /// on flush, with the rest of the frame and then an empty span.
+  ///\ingroup cobs
+  //***************************************************************************
+  class icobs_encoder
+  {
+  public:
+
+    typedef private_framing::output_buffer::span_type     span_type;
+    typedef private_framing::output_buffer::callback_type callback_type;
+
+    //*************************************************************************
+    /// Encodes a byte.
+    //*************************************************************************
+    template <typename T>
+    bool encode(T value)
+    {
+      ETL_STATIC_ASSERT(etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), "Input type must be an 8 bit integral");
+
+      add(static_cast<uint8_t>(value));
+
+      return !error();
+    }
+
+    //*************************************************************************
+    /// Encodes a range of bytes.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool encode(TInputIterator input_begin, size_t input_length)
+    {
+      typedef typename etl::iterator_traits<TInputIterator>::value_type value_type;
+
+      ETL_STATIC_ASSERT(etl::is_integral<value_type>::value && (etl::integral_limits<value_type>::bits == 8U), "Input type must be an 8 bit integral");
+
+      add_range(input_begin, input_length, etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value>());
+
+      return !error();
+    }
+
+    //*************************************************************************
+    /// Encodes a range of bytes.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool encode(TInputIterator input_begin, TInputIterator input_end)
+    {
+      return encode(input_begin, static_cast<size_t>(etl::distance(input_begin, input_end)));
+    }
+
+    //*************************************************************************
+    /// Encodes a range of bytes and ends the frame.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool encode_final(TInputIterator input_begin, size_t input_length)
+    {
+      return encode(input_begin, input_length) && flush();
+    }
+
+    //*************************************************************************
+    /// Encodes a range of bytes and ends the frame.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool encode_final(TInputIterator input_begin, TInputIterator input_end)
+    {
+      return encode(input_begin, input_end) && flush();
+    }
+
+    //*************************************************************************
+    /// Ends the frame. Writes the last block and the delimiter.
+    //*************************************************************************
+    bool flush()
+    {
+      write_block((block_length == cobs::Max_Block) ? 0xFFU : static_cast<uint8_t>(block_length + 1U));
+      output.push(cobs::Delimiter, true);
+
+      if (!error() && output.callback.is_valid())
+      {
+        if (output.length != 0U)
+        {
+          output.callback(output.span());
+        }
+
+        // Indicate the end of the frame.
+        output.callback(span_type());
+
+        output.length = 0U;
+      }
+
+      return !error();
+    }
+
+    //*************************************************************************
+    /// Resets the encoder.
+    //*************************************************************************
+    void restart()
+    {
+      block_length      = 0U;
+      output.length     = 0U;
+      output.overflowed = false;
+    }
+
+    //*************************************************************************
+    /// The beginning of the output buffer.
+    //*************************************************************************
+    const uint8_t* begin() const
+    {
+      return output.p_buffer;
+    }
+
+    //*************************************************************************
+    /// The end of the output buffer.
+    /// Only useful if a callback has not been set or called.
+    //*************************************************************************
+    const uint8_t* end() const
+    {
+      return output.p_buffer + output.length;
+    }
+
+    //*************************************************************************
+    /// The size of the output.
+    /// Only useful if a callback has not been set or called.
+    //*************************************************************************
+    size_t size() const
+    {
+      return output.length;
+    }
+
+    //*************************************************************************
+    /// The size of the output buffer.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return output.max_size;
+    }
+
+    //*************************************************************************
+    /// A span of the output.
+    /// Only useful if a callback has not been set or called.
+    //*************************************************************************
+    span_type span() const
+    {
+      return output.span();
+    }
+
+    //*************************************************************************
+    /// Whether the output buffer has overflowed.
+    //*************************************************************************
+    bool overflow() const
+    {
+      return output.overflowed;
+    }
+
+    //*************************************************************************
+    /// Whether an error was detected.
+    //*************************************************************************
+    bool error() const
+    {
+      return overflow();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icobs_encoder(uint8_t* p_output_buffer_, size_t output_buffer_max_size_, callback_type callback_)
+      : block()
+      , block_length(0U)
+      , output(p_output_buffer_, output_buffer_max_size_, callback_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a byte to the frame.
+    //*************************************************************************
+    void add(uint8_t value)
+    {
+      if (block_length == cobs::Max_Block)
+      {
+        write_block(0xFFU);
+      }
+
+      if (value == 0U)
+      {
+        write_block(static_cast<uint8_t>(block_length + 1U));
+      }
+      else
+      {
+        block[1U + block_length++] = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    void add_range(TInputIterator input, size_t length, etl::false_type)
+    {
+      while (length-- != 0U)
+      {
+        add(static_cast<uint8_t>(*input));
+        ++input;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, copying the runs between zeros.
+    //*************************************************************************
+    template <typename TInputIterator>
+    void add_range(TInputIterator input, size_t length, etl::true_type)
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(input);
+
+      while (length != 0U)
+      {
+        if (block_length == cobs::Max_Block)
+        {
+          write_block(0xFFU);
+        }
+
+        const size_t room  = cobs::Max_Block - block_length;
+        const size_t limit = (length < room) ? length : room;
+        const size_t run   = private_framing::find_byte(p, limit, 0U);
+
+        memcpy(block + 1U + block_length, p, run);
+
+        block_length += run;
+        p            += run;
+        length       -= run;
+
+        if (run < limit)
+        {
+          // A zero.
+          write_block(static_cast<uint8_t>(block_length + 1U));
+          ++p;
+          --length;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the block with its code to the output.
+    //*************************************************************************
+    void write_block(uint8_t code)
+    {
+      block[0] = code;
+      output.push(block, block_length + 1U, true);
+      block_length = 0U;
+    }
+
+    uint8_t                        block[1U + cobs::Max_Block];
+    size_t                         block_length;
+    private_framing::output_buffer output;
+  };
+
+  //***************************************************************************
+  /// COBS encoder with an output buffer of Buffer_Size bytes.
+  ///\ingroup cobs
+  //***************************************************************************
+  template <size_t Buffer_Size>
+  class cobs_encoder : public icobs_encoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Buffer_Size > 0U, "Buffer size must be greater than 0");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cobs_encoder()
+      : icobs_encoder(output_buffer, Buffer_Size, callback_type())
+      , output_buffer()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a callback for the output.
+    //*************************************************************************
+    cobs_encoder(callback_type callback_)
+      : icobs_encoder(output_buffer, Buffer_Size, callback_)
+      , output_buffer()
+    {
+    }
+
+  private:
+
+    /// The internal output buffer.
+    uint8_t output_buffer[Buffer_Size];
+  };
+
+  //***************************************************************************
+  /// COBS decoder.
+  /// Decodes a stream of frames. A frame ends with a zero delimiter.
+  /// If there is a callback, it is called with each complete frame.
+  /// Otherwise decoding stops after each complete frame, which stays in the
+  /// buffer until the next call to decode.
+  /// A frame that is malformed, or too large for the buffer, is dropped at
+  /// its delimiter, and decode returns false.
+  /// Pointer ranges find each zero word at a time and copy the runs of data.
+  ///\ingroup cobs
+  //***************************************************************************
+  class icobs_decoder
+  {
+  public:
+
+    typedef private_framing::output_buffer::span_type     span_type;
+    typedef private_framing::output_buffer::callback_type callback_type;
+
+    //*************************************************************************
+    /// Decodes a byte.
+    //*************************************************************************
+    template <typename T>
+    bool decode(T value)
+    {
+      ETL_STATIC_ASSERT(etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), "Input type must be an 8 bit integral");
+
+      return add(static_cast<uint8_t>(value));
+    }
+
+    //*************************************************************************
+    /// Decodes a range of bytes.
+    /// Without a callback, stops after a complete frame.
+    /// Returns false if a frame was dropped.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool decode(TInputIterator input_begin, size_t input_length)
+    {
+      typedef typename etl::iterator_traits<TInputIterator>::value_type value_type;
+
+      ETL_STATIC_ASSERT(etl::is_integral<value_type>::value && (etl::integral_limits<value_type>::bits == 8U), "Input type must be an 8 bit integral");
+
+      consumed = 0U;
+
+      return add_range(input_begin, input_length, etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Decodes a range of bytes.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool decode(TInputIterator input_begin, TInputIterator input_end)
+    {
+      return decode(input_begin, static_cast<size_t>(etl::distance(input_begin, input_end)));
+    }
+
+    //*************************************************************************
+    /// The number of bytes used by the last range decode.
+    /// Less than the length if it stopped after a complete frame.
+    //*************************************************************************
+    size_t used() const
+    {
+      return consumed;
+    }
+
+    //*************************************************************************
+    /// Whether the buffer holds a complete frame.
+    /// Only set if there is no callback.
+    //*************************************************************************
+    bool complete() const
+    {
+      return frame_complete;
+    }
+
+    //*************************************************************************
+    /// Resets the decoder.
+    //*************************************************************************
+    void restart()
+    {
+      reset_frame();
+      output.length  = 0U;
+      frame_complete = false;
+    }
+
+    //*************************************************************************
+    /// The beginning of the frame.
+    //*************************************************************************
+    const uint8_t* begin() const
+    {
+      return output.p_buffer;
+    }
+
+    //*************************************************************************
+    /// The end of the frame.
+    //*************************************************************************
+    const uint8_t* end() const
+    {
+      return output.p_buffer + output.length;
+    }
+
+    //*************************************************************************
+    /// The size of the frame, or of the frame so far.
+    //*************************************************************************
+    size_t size() const
+    {
+      return output.length;
+    }
+
+    //*************************************************************************
+    /// The size of the frame buffer.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return output.max_size;
+    }
+
+    //*************************************************************************
+    /// A span of the frame.
+    //*************************************************************************
+    span_type span() const
+    {
+      return output.span();
+    }
+
+    //*************************************************************************
+    /// Whether the current frame is too large for the buffer.
+    //*************************************************************************
+    bool overflow() const
+    {
+      return output.overflowed;
+    }
+
+    //*************************************************************************
+    /// Whether the current frame is malformed.
+    //*************************************************************************
+    bool invalid() const
+    {
+      return malformed;
+    }
+
+    //*************************************************************************
+    /// Whether an error was detected in the current frame.
+    //*************************************************************************
+    bool error() const
+    {
+      return overflow() || invalid();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icobs_decoder(uint8_t* p_buffer_, size_t buffer_max_size_, callback_type callback_)
+      : output(p_buffer_, buffer_max_size_, callback_)
+      , remaining(0U)
+      , consumed(0U)
+      , pending_zero(false)
+      , in_frame(false)
+      , malformed(false)
+      , frame_complete(false)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a byte. Returns false if it ended a frame that was dropped.
+    //*************************************************************************
+    bool add(uint8_t value)
+    {
+      if (frame_complete)
+      {
+        output.length  = 0U;
+        frame_complete = false;
+      }
+
+      if (value == cobs::Delimiter)
+      {
+        return end_frame();
+      }
+
+      if (remaining == 0U)
+      {
+        // A code byte.
+        if (pending_zero)
+        {
+          output.push(0U, false);
+        }
+
+        remaining    = static_cast<size_t>(value - 1U);
+        pending_zero = (value != 0xFFU);
+        in_frame     = true;
+      }
+      else
+      {
+        output.push(value, false);
+        --remaining;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool add_range(TInputIterator input, size_t length, etl::false_type)
+    {
+      bool success = true;
+
+      while ((length != 0U) && !(frame_complete && (consumed != 0U)))
+      {
+        success = add(static_cast<uint8_t>(*input)) && success;
+        ++input;
+        ++consumed;
+        --length;
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, copying the runs of data.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool add_range(TInputIterator input, size_t length, etl::true_type)
+    {
+      const uint8_t* const p_begin = reinterpret_cast<const uint8_t*>(input);
+      const uint8_t*       p       = p_begin;
+
+      bool success = true;
+
+      while ((length != 0U) && !(frame_complete && (p != p_begin)))
+      {
+        if ((remaining == 0U) || (*p == cobs::Delimiter) || frame_complete)
+        {
+          success = add(*p) && success;
+          ++p;
+          --length;
+        }
+        else
+        {
+          const size_t limit = (length < remaining) ? length : remaining;
+          const size_t run   = private_framing::find_byte(p, limit, cobs::Delimiter);
+
+          output.push(p, run, false);
+
+          remaining -= run;
+          p         += run;
+          length    -= run;
+        }
+      }
+
+      consumed = static_cast<size_t>(p - p_begin);
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Ends a frame. Returns false if it was dropped.
+    //*************************************************************************
+    bool end_frame()
+    {
+      if (!in_frame)
+      {
+        // Consecutive delimiters.
+        return true;
+      }
+
+      malformed = malformed || (remaining != 0U);
+
+      const bool success = !error();
+
+      if (success)
+      {
+        if (output.callback.is_valid())
+        {
+          output.callback(output.span());
+          output.length = 0U;
+        }
+        else
+        {
+          frame_complete = true;
+        }
+      }
+      else
+      {
+        output.length = 0U;
+      }
+
+      reset_frame();
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Resets the state for a new frame.
+    //*************************************************************************
+    void reset_frame()
+    {
+      remaining         = 0U;
+      pending_zero      = false;
+      in_frame          = false;
+      malformed         = false;
+      output.overflowed = false;
+    }
+
+    private_framing::output_buffer output;
+    size_t                         remaining;
+    size_t                         consumed;
+    bool                           pending_zero;
+    bool                           in_frame;
+    bool                           malformed;
+    bool                           frame_complete;
+  };
+
+  //***************************************************************************
+  /// COBS decoder for frames of up to Buffer_Size bytes.
+  ///\ingroup cobs
+  //***************************************************************************
+  template <size_t Buffer_Size>
+  class cobs_decoder : public icobs_decoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Buffer_Size > 0U, "Buffer size must be greater than 0");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cobs_decoder()
+      : icobs_decoder(frame_buffer, Buffer_Size, callback_type())
+      , frame_buffer()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a callback for each frame.
+    //*************************************************************************
+    cobs_decoder(callback_type callback_)
+      : icobs_decoder(frame_buffer, Buffer_Size, callback_)
+      , frame_buffer()
+    {
+    }
+
+  private:
+
+    /// The internal frame buffer.
+    uint8_t frame_buffer[Buffer_Size];
+  };
+}
+
+#endif
@@ -0,0 +1,1275 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COMPRESSED_BITMAP_INCLUDED
+#define ETL_COMPRESSED_BITMAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "bitset.h"
+#include "ipool.h"
+#include "pool.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+///\defgroup compressed_bitmap compressed_bitmap
+/// A set of 32 bit values, stored as a compressed bitmap in the style of
+/// Roaring bitmaps.
+/// The values are split into chunks of 65536, by their upper 16 bits. Sparse
+/// chunks store their lower 16 bits in a sorted array. Dense chunks use an
+/// 8 KB bitmap, allocated from a pool. The capacity is fixed at compile time.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the compressed_bitmap.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  class compressed_bitmap_exception : public etl::exception
+  {
+  public:
+
+    compressed_bitmap_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the compressed_bitmap.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  class compressed_bitmap_full : public etl::compressed_bitmap_exception
+  {
+  public:
+
+    compressed_bitmap_full(string_type file_name_, numeric_type line_number_)
+      : etl::compressed_bitmap_exception(ETL_ERROR_TEXT("compressed_bitmap:full", ETL_COMPRESSED_BITMAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized compressed_bitmaps.
+  /// Each chunk has an array container, a sorted block in the shared array
+  /// storage, or a bitmap container from the pool.
+  /// A chunk moves to a bitmap when it has more than Array_Max values, and
+  /// back to an array when it has fewer than Bitmap_Min, if there is room.
+  /// If not, the chunk stays as it is, so either may hold any number of values.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  class icompressed_bitmap
+  {
+  public:
+
+    typedef uint32_t value_type;
+    typedef size_t   size_type;
+
+    /// The bitmap container for one chunk.
+    typedef etl::bitset<65536U, uint32_t> bitmap_type;
+
+    static ETL_CONSTANT size_t Chunk_Shift = 16U;
+    static ETL_CONSTANT size_t Array_Max   = 4096U;
+    static ETL_CONSTANT size_t Bitmap_Min  = 2048U;
+
+    //*************************************************************************
+    /// A chunk of 65536 values.
+    /// array_begin is the index of the chunk's values in the array storage,
+    /// or where they would be for a bitmap chunk.
+    //*************************************************************************
+    struct chunk_type
+    {
+      bitmap_type* pbitmap;
+      size_t       array_begin;
+      uint32_t     cardinality;
+      uint16_t     key;
+    };
+
+    //*************************************************************************
+    /// A forward iterator that visits the values in ascending order.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class icompressed_bitmap;
+
+      //*********************************
+      const_iterator()
+        : p_owner(ETL_NULLPTR)
+        , chunk(0U)
+        , position(0U)
+      {
+      }
+
+      //*********************************
+      icompressed_bitmap::value_type operator *() const
+      {
+        typedef icompressed_bitmap::value_type result_type;
+
+        const chunk_type& c = p_owner->p_chunks[chunk];
+
+        const size_t low = (c.pbitmap != ETL_NULLPTR) ? position : p_owner->p_values[c.array_begin + position];
+
+        return (result_type(c.key) << Chunk_Shift) | result_type(low);
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        const chunk_type& c = p_owner->p_chunks[chunk];
+
+        if (c.pbitmap != ETL_NULLPTR)
+        {
+          position = c.pbitmap->find_next(true, position + 1U);
+
+          if (position == bitmap_type::npos)
+          {
+            next_chunk();
+          }
+        }
+        else if (++position == c.cardinality)
+        {
+          next_chunk();
+        }
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      //*********************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.chunk == rhs.chunk) && (lhs.position == rhs.position);
+      }
+
+      //*********************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const icompressed_bitmap* p_owner_, size_t chunk_)
+        : p_owner(p_owner_)
+        , chunk(chunk_)
+        , position(0U)
+      {
+        first_in_chunk();
+      }
+
+      //*********************************
+      void next_chunk()
+      {
+        ++chunk;
+        position = 0U;
+        first_in_chunk();
+      }
+
+      //*********************************
+      void first_in_chunk()
+      {
+        if ((chunk < p_owner->chunk_count) && (p_owner->p_chunks[chunk].pbitmap != ETL_NULLPTR))
+        {
+          position = p_owner->p_chunks[chunk].pbitmap->find_first(true);
+        }
+      }
+
+      const icompressed_bitmap* p_owner;
+      size_t                    chunk;
+      size_t                    position;
+    };
+
+    //*************************************************************************
+    /// Adds a value.
+    /// If asserts or exceptions are enabled, emits compressed_bitmap_full if
+    /// there is no room for it.
+    ///\return <b>true</b> if the value is in the set.
+    //*************************************************************************
+    bool set(value_type value)
+    {
+      const uint16_t key = uint16_t(value >> Chunk_Shift);
+      const uint16_t low = uint16_t(value);
+
+      size_t index = find_chunk(key);
+
+      if ((index == chunk_count) || (p_chunks[index].key != key))
+      {
+        if ((chunk_count == max_chunk_count) || ((value_count == max_value_count) && (available_bitmaps() == 0U)))
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(compressed_bitmap_full));
+          return false;
+        }
+
+        insert_chunk(index, key);
+      }
+
+      if (!add_to_chunk(index, low))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(compressed_bitmap_full));
+        return false;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Adds a range of values.
+    /// If asserts or exceptions are enabled, emits compressed_bitmap_full if
+    /// there is no room for them.
+    //*************************************************************************
+    template <typename TIterator>
+    void set(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        if (!set(value_type(*first)))
+        {
+          return;
+        }
+
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes a value.
+    //*************************************************************************
+    void reset(value_type value)
+    {
+      const uint16_t key = uint16_t(value >> Chunk_Shift);
+      const uint16_t low = uint16_t(value);
+
+      const size_t index = find_chunk(key);
+
+      if ((index == chunk_count) || (p_chunks[index].key != key))
+      {
+        return;
+      }
+
+      chunk_type& c = p_chunks[index];
+
+      if (c.pbitmap != ETL_NULLPTR)
+      {
+        if (c.pbitmap->test(low))
+        {
+          c.pbitmap->reset(low);
+          --c.cardinality;
+          --total;
+        }
+      }
+      else
+      {
+        uint16_t* p_begin = p_values + c.array_begin;
+        uint16_t* p_end   = p_begin + c.cardinality;
+        uint16_t* p       = etl::lower_bound(p_begin, p_end, low);
+
+        if ((p != p_end) && (*p == low))
+        {
+          erase_values(index, size_t(p - p_begin), 1U);
+          --c.cardinality;
+          --total;
+        }
+      }
+
+      tidy_chunk(index);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the value is in the set.
+    //*************************************************************************
+    bool test(value_type value) const
+    {
+      const uint16_t key = uint16_t(value >> Chunk_Shift);
+      const uint16_t low = uint16_t(value);
+
+      const size_t index = find_chunk(key);
+
+      if ((index == chunk_count) || (p_chunks[index].key != key))
+      {
+        return false;
+      }
+
+      const chunk_type& c = p_chunks[index];
+
+      if (c.pbitmap != ETL_NULLPTR)
+      {
+        return c.pbitmap->test(low);
+      }
+
+      return etl::binary_search(p_values + c.array_begin, p_values + c.array_begin + c.cardinality, low);
+    }
+
+    //*************************************************************************
+    /// Removes all of the values.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < chunk_count; ++i)
+      {
+        release_bitmap(p_chunks[i]);
+      }
+
+      chunk_count = 0U;
+      value_count = 0U;
+      total       = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values in the set.
+    //*************************************************************************
+    size_t count() const
+    {
+      return total;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the set is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return total == 0U;
+    }
+
+    //*************************************************************************
+    /// Iterators over the values, in ascending order.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    const_iterator end() const
+    {
+      return const_iterator(this, chunk_count);
+    }
+
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// The number of chunks in use, and the maximum.
+    //*************************************************************************
+    size_t chunks() const
+    {
+      return chunk_count;
+    }
+
+    size_t max_chunks() const
+    {
+      return max_chunk_count;
+    }
+
+    //*************************************************************************
+    /// The number of values in the array containers, and the maximum.
+    //*************************************************************************
+    size_t array_values() const
+    {
+      return value_count;
+    }
+
+    size_t max_array_values() const
+    {
+      return max_value_count;
+    }
+
+    //*************************************************************************
+    /// The number of bitmap containers that can still be allocated.
+    //*************************************************************************
+    size_t available_bitmaps() const
+    {
+      return (p_pool != ETL_NULLPTR) ? p_pool->available() : 0U;
+    }
+
+    //*************************************************************************
+    /// Adds the values of other. Chunks are merged a container at a time.
+    /// If asserts or exceptions are enabled, emits compressed_bitmap_full if
+    /// there is no room. The values added until then are kept.
+    //*************************************************************************
+    icompressed_bitmap& operator |=(const icompressed_bitmap& other)
+    {
+      if (&other == this)
+      {
+        return *this;
+      }
+
+      size_t index = 0U;
+
+      for (size_t other_index = 0U; other_index < other.chunk_count; ++other_index)
+      {
+        const chunk_type& oc = other.p_chunks[other_index];
+
+        while ((index < chunk_count) && (p_chunks[index].key < oc.key))
+        {
+          ++index;
+        }
+
+        if ((index == chunk_count) || (p_chunks[index].key != oc.key))
+        {
+          if (chunk_count == max_chunk_count)
+          {
+            ETL_ASSERT_FAIL(ETL_ERROR(compressed_bitmap_full));
+            return *this;
+          }
+
+          insert_chunk(index, oc.key);
+        }
+
+        const bool added = union_chunk(index, other, oc);
+
+        tidy_chunk(index);
+
+        if (!added)
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(compressed_bitmap_full));
+          return *this;
+        }
+
+        if ((index < chunk_count) && (p_chunks[index].key == oc.key))
+        {
+          ++index;
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Keeps only the values that are also in other.
+    /// Chunks are intersected a container at a time.
+    //*************************************************************************
+    icompressed_bitmap& operator &=(const icompressed_bitmap& other)
+    {
+      if (&other == this)
+      {
+        return *this;
+      }
+
+      size_t other_index = 0U;
+      size_t index       = 0U;
+
+      while (index < chunk_count)
+      {
+        const uint16_t key = p_chunks[index].key;
+
+        while ((other_index < other.chunk_count) && (other.p_chunks[other_index].key < key))
+        {
+          ++other_index;
+        }
+
+        if ((other_index == other.chunk_count) || (other.p_chunks[other_index].key != key))
+        {
+          total -= p_chunks[index].cardinality;
+          erase_chunk(index);
+        }
+        else
+        {
+          intersect_chunk(index, other, other.p_chunks[other_index]);
+
+          if (tidy_chunk(index))
+          {
+            ++index;
+          }
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    icompressed_bitmap& operator =(const icompressed_bitmap& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        *this |= rhs;
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_chunks_        The chunk storage.
+    ///\param max_chunks_      The number of chunks.
+    ///\param p_values_        The array container storage.
+    ///\param max_values_      The number of array values.
+    ///\param p_pool_          The pool of bitmap_type, or null for none.
+    //*************************************************************************
+    icompressed_bitmap(chunk_type* p_chunks_, size_t max_chunks_, uint16_t* p_values_, size_t max_values_, etl::ipool* p_pool_)
+      : p_chunks(p_chunks_)
+      , p_values(p_values_)
+      , p_pool(p_pool_)
+      , chunk_count(0U)
+      , value_count(0U)
+      , total(0U)
+      , max_chunk_count(max_chunks_)
+      , max_value_count(max_values_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    icompressed_bitmap(const icompressed_bitmap&);
+
+    //*************************************************************************
+    /// The index of the chunk with the key, or where it would be inserted.
+    //*************************************************************************
+    size_t find_chunk(uint16_t key) const
+    {
+      size_t first = 0U;
+      size_t count = chunk_count;
+
+      while (count != 0U)
+      {
+        const size_t half = count / 2U;
+
+        if (p_chunks[first + half].key < key)
+        {
+          first += half + 1U;
+          count -= half + 1U;
+        }
+        else
+        {
+          count = half;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Inserts an empty array chunk. There must be a free chunk.
+    //*************************************************************************
+    void insert_chunk(size_t index, uint16_t key)
+    {
+      const size_t array_begin = (index < chunk_count) ? p_chunks[index].array_begin : value_count;
+
+      etl::copy_backward(p_chunks + index, p_chunks + chunk_count, p_chunks + chunk_count + 1U);
+      ++chunk_count;
+
+      chunk_type& c = p_chunks[index];
+      c.pbitmap     = ETL_NULLPTR;
+      c.array_begin = array_begin;
+      c.cardinality = 0U;
+      c.key         = key;
+    }
+
+    //*************************************************************************
+    /// Removes a chunk, releasing its container.
+    //*************************************************************************
+    void erase_chunk(size_t index)
+    {
+      chunk_type& c = p_chunks[index];
+
+      if (c.pbitmap != ETL_NULLPTR)
+      {
+        release_bitmap(c);
+      }
+      else
+      {
+        erase_values(index, 0U, c.cardinality);
+      }
+
+      etl::copy(p_chunks + index + 1U, p_chunks + chunk_count, p_chunks + index);
+      --chunk_count;
+    }
+
+    //*************************************************************************
+    /// Removes the chunk if it is empty, or changes a sparse bitmap chunk to
+    /// an array.
+    ///\return <b>true</b> if the chunk is still there.
+    //*************************************************************************
+    bool tidy_chunk(size_t index)
+    {
+      chunk_type& c = p_chunks[index];
+
+      if (c.cardinality == 0U)
+      {
+        erase_chunk(index);
+        return false;
+      }
+
+      if ((c.pbitmap != ETL_NULLPTR) && (c.cardinality < Bitmap_Min))
+      {
+        to_array(index);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Opens a gap of n values at offset in the chunk's array.
+    /// There must be room.
+    //*************************************************************************
+    void insert_values(size_t index, size_t offset, size_t n)
+    {
+      uint16_t* p = p_values + p_chunks[index].array_begin + offset;
+
+      memmove(p + n, p, (value_count - size_t(p - p_values)) * sizeof(uint16_t));
+      value_count += n;
+
+      for (size_t i = index + 1U; i < chunk_count; ++i)
+      {
+        p_chunks[i].array_begin += n;
+      }
+    }
+
+    //*************************************************************************
+    /// Closes a gap of n values at offset in the chunk's array.
+    //*************************************************************************
+    void erase_values(size_t index, size_t offset, size_t n)
+    {
+      uint16_t* p = p_values + p_chunks[index].array_begin + offset;
+
+      memmove(p, p + n, (value_count - size_t(p - p_values) - n) * sizeof(uint16_t));
+      value_count -= n;
+
+      for (size_t i = index + 1U; i < chunk_count; ++i)
+      {
+        p_chunks[i].array_begin -= n;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves an array chunk to a bitmap.
+    ///\return <b>false</b> if there are no free bitmaps.
+    //*************************************************************************
+    bool to_bitmap(size_t index)
+    {
+      if (available_bitmaps() == 0U)
+      {
+        return false;
+      }
+
+      chunk_type& c = p_chunks[index];
+
+      bitmap_type* pbitmap = ::new (p_pool->allocate<bitmap_type>()) bitmap_type();
+
+      const uint16_t* p = p_values + c.array_begin;
+
+      for (size_t i = 0U; i < c.cardinality; ++i)
+      {
+        pbitmap->set(p[i]);
+      }
+
+      erase_values(index, 0U, c.cardinality);
+      c.pbitmap = pbitmap;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves a bitmap chunk to an array.
+    ///\return <b>false</b> if there is no room in the array storage.
+    //*************************************************************************
+    bool to_array(size_t index)
+    {
+      chunk_type& c = p_chunks[index];
+
+      if ((max_value_count - value_count) < c.cardinality)
+      {
+        return false;
+      }
+
+      insert_values(index, 0U, c.cardinality);
+
+      uint16_t* p = p_values + c.array_begin;
+
+      for (size_t bit = c.pbitmap->find_first(true); bit != bitmap_type::npos; bit = c.pbitmap->find_next(true, bit + 1U))
+      {
+        *p++ = uint16_t(bit);
+      }
+
+      release_bitmap(c);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns a chunk's bitmap to the pool.
+    //*************************************************************************
+    void release_bitmap(chunk_type& c)
+    {
+      if (c.pbitmap != ETL_NULLPTR)
+      {
+        p_pool->release(c.pbitmap);
+        c.pbitmap = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a value to a chunk.
+    ///\return <b>false</b> if there is no room.
+    //*************************************************************************
+    bool add_to_chunk(size_t index, uint16_t low)
+    {
+      chunk_type& c = p_chunks[index];
+
+      if (c.pbitmap == ETL_NULLPTR)
+      {
+        uint16_t* p_begin = p_values + c.array_begin;
+        uint16_t* p_end   = p_begin + c.cardinality;
+        uint16_t* p       = etl::lower_bound(p_begin, p_end, low);
+
+        if ((p != p_end) && (*p == low))
+        {
+          return true;
+        }
+
+        // Prefer a bitmap once the array is large, or when the array storage is full.
+        const bool wants_bitmap = (c.cardinality >= Array_Max) || (value_count == max_value_count);
+
+        if (!wants_bitmap || !to_bitmap(index))
+        {
+          if (value_count == max_value_count)
+          {
+            return false;
+          }
+
+          const size_t offset = size_t(p - p_begin);
+
+          insert_values(index, offset, 1U);
+          p_values[c.array_begin + offset] = low;
+          ++c.cardinality;
+          ++total;
+
+          return true;
+        }
+      }
+
+      if (!c.pbitmap->test(low))
+      {
+        c.pbitmap->set(low);
+        ++c.cardinality;
+        ++total;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Adds the values of another chunk to a chunk.
+    ///\return <b>false</b> if there was no room for all of them.
+    //*************************************************************************
+    bool union_chunk(size_t index, const icompressed_bitmap& other, const chunk_type& oc)
+    {
+      chunk_type& c = p_chunks[index];
+
+      const uint32_t old_cardinality = c.cardinality;
+
+      if (c.pbitmap == ETL_NULLPTR)
+      {
+        if (oc.pbitmap == ETL_NULLPTR)
+        {
+          // Array with array. Merge in place, from the back, if the result fits.
+          const uint16_t* p_other = other.p_values + oc.array_begin;
+          const uint16_t* p_this  = p_values + c.array_begin;
+
+          size_t extra = 0U;
+          size_t i     = 0U;
+
+          for (size_t j = 0U; j < oc.cardinality; ++j)
+          {
+            while ((i < c.cardinality) && (p_this[i] < p_other[j]))
+            {
+              ++i;
+            }
+
+            if ((i == c.cardinality) || (p_this[i] != p_other[j]))
+            {
+              ++extra;
+            }
+          }
+
+          const bool has_room = (extra <= (max_value_count - value_count));
+
+          bool in_array = has_room && ((c.cardinality + extra) <= Array_Max);
+
+          if (!in_array && !to_bitmap(index))
+          {
+            if (!has_room)
+            {
+              return false;
+            }
+
+            in_array = true;
+          }
+
+          if (in_array)
+          {
+            insert_values(index, c.cardinality, extra);
+
+            uint16_t* p_write = p_values + c.array_begin + c.cardinality + extra;
+            uint16_t* p_read  = p_values + c.array_begin + c.cardinality;
+            size_t    j       = oc.cardinality;
+
+            while (j != 0U)
+            {
+              if ((p_read != (p_values + c.array_begin)) && (p_read[-1] >= p_other[j - 1U]))
+              {
+                if (p_read[-1] == p_other[j - 1U])
+                {
+                  --j;
+                }
+
+                *--p_write = *--p_read;
+              }
+              else
+              {
+                *--p_write = p_other[--j];
+              }
+            }
+
+            c.cardinality += uint32_t(extra);
+            total         += extra;
+
+            return true;
+          }
+        }
+        else if (!to_bitmap(index))
+        {
+          // No bitmap to merge into, so add them one at a time.
+          for (size_t bit = oc.pbitmap->find_first(true); bit != bitmap_type::npos; bit = oc.pbitmap->find_next(true, bit + 1U))
+          {
+            if (!add_to_chunk(index, uint16_t(bit)))
+            {
+              return false;
+            }
+          }
+
+          return true;
+        }
+      }
+
+      if (oc.pbitmap != ETL_NULLPTR)
+      {
+        *c.pbitmap |= *oc.pbitmap;
+        c.cardinality = uint32_t(c.pbitmap->count());
+      }
+      else
+      {
+        const uint16_t* p_other = other.p_values + oc.array_begin;
+
+        for (size_t j = 0U; j < oc.cardinality; ++j)
+        {
+          if (!c.pbitmap->test(p_other[j]))
+          {
+            c.pbitmap->set(p_other[j]);
+            ++c.cardinality;
+          }
+        }
+      }
+
+      total += c.cardinality - old_cardinality;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Keeps the values of a chunk that are also in another chunk.
+    //*************************************************************************
+    void intersect_chunk(size_t index, const icompressed_bitmap& other, const chunk_type& oc)
+    {
+      chunk_type& c = p_chunks[index];
+
+      const uint32_t old_cardinality = c.cardinality;
+
+      if (c.pbitmap == ETL_NULLPTR)
+      {
+        // Filter the array in place.
+        uint16_t* p = p_values + c.array_begin;
+        size_t    n = 0U;
+
+        if (oc.pbitmap != ETL_NULLPTR)
+        {
+          for (size_t i = 0U; i < c.cardinality; ++i)
+          {
+            if (oc.pbitmap->test(p[i]))
+            {
+              p[n++] = p[i];
+            }
+          }
+        }
+        else
+        {
+          const uint16_t* p_other = other.p_values + oc.array_begin;
+          size_t          j       = 0U;
+
+          for (size_t i = 0U; (i < c.cardinality) && (j < oc.cardinality); ++i)
+          {
+            while ((j < oc.cardinality) && (p_other[j] < p[i]))
+            {
+              ++j;
+            }
+
+            if ((j < oc.cardinality) && (p_other[j] == p[i]))
+            {
+              p[n++] = p[i];
+            }
+          }
+        }
+
+        erase_values(index, n, c.cardinality - n);
+        c.cardinality = uint32_t(n);
+      }
+      else if (oc.pbitmap != ETL_NULLPTR)
+      {
+        *c.pbitmap &= *oc.pbitmap;
+        c.cardinality = uint32_t(c.pbitmap->count());
+      }
+      else
+      {
+        // The result is a subset of the other array.
+        const uint16_t* p_other = other.p_values + oc.array_begin;
+
+        size_t n = 0U;
+
+        for (size_t j = 0U; j < oc.cardinality; ++j)
+        {
+          n += c.pbitmap->test(p_other[j]) ? 1U : 0U;
+        }
+
+        if (n <= (max_value_count - value_count))
+        {
+          insert_values(index, 0U, n);
+
+          uint16_t* p = p_values + c.array_begin;
+
+          for (size_t j = 0U; j < oc.cardinality; ++j)
+          {
+            if (c.pbitmap->test(p_other[j]))
+            {
+              *p++ = p_other[j];
+            }
+          }
+
+          release_bitmap(c);
+        }
+        else
+        {
+          // No room for an array, so mask the bitmap a word at a time.
+          bitmap_type::span_type words = c.pbitmap->span();
+
+          const size_t Word_Shift = etl::log2<bitmap_type::Bits_Per_Element>::value;
+
+          size_t j = 0U;
+
+          for (size_t w = 0U; w < words.size(); ++w)
+          {
+            bitmap_type::element_type mask = 0U;
+
+            while ((j < oc.cardinality) && ((size_t(p_other[j]) >> Word_Shift) == w))
+            {
+              mask |= bitmap_type::element_type(1U) << (p_other[j] & (bitmap_type::Bits_Per_Element - 1U));
+              ++j;
+            }
+
+            words[w] &= mask;
+          }
+        }
+
+        c.cardinality = uint32_t(n);
+      }
+
+      total -= old_cardinality - c.cardinality;
+    }
+
+    chunk_type*  p_chunks;
+    uint16_t*    p_values;
+    etl::ipool*  p_pool;
+    size_t       chunk_count;
+    size_t       value_count;
+    size_t       total;
+    const size_t max_chunk_count;
+    const size_t max_value_count;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_COMPRESSED_BITMAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~icompressed_bitmap()
+    {
+    }
+#else
+  protected:
+    ~icompressed_bitmap()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  inline bool operator ==(const etl::icompressed_bitmap& lhs, const etl::icompressed_bitmap& rhs)
+  {
+    return (lhs.count() == rhs.count()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  inline bool operator !=(const etl::icompressed_bitmap& lhs, const etl::icompressed_bitmap& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  namespace private_compressed_bitmap
+  {
+    //*************************************************************************
+    /// The bitmap pool for a compressed_bitmap, if it has one.
+    //*************************************************************************
+    template <size_t Max_Bitmaps>
+    struct bitmap_pool
+    {
+      typedef etl::pool<etl::icompressed_bitmap::bitmap_type, Max_Bitmaps> type;
+
+      static etl::ipool* address(type& pool)
+      {
+        return &pool;
+      }
+    };
+
+    template <>
+    struct bitmap_pool<0U>
+    {
+      struct type
+      {
+      };
+
+      static etl::ipool* address(type&)
+      {
+        return ETL_NULLPTR;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A compressed_bitmap with its own storage.
+  ///\tparam Max_Chunks       The number of chunks of 65536 values that may be used.
+  ///\tparam Max_Array_Values The number of values held by all of the array containers.
+  ///\tparam Max_Bitmaps      The number of 8 KB bitmap containers. May be zero.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  template <size_t Max_Chunks, size_t Max_Array_Values, size_t Max_Bitmaps = 0U>
+  class compressed_bitmap : public etl::icompressed_bitmap
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Chunks > 0U, "Zero chunks");
+    ETL_STATIC_ASSERT(Max_Array_Values > 0U, "Zero array values");
+
+    typedef etl::icompressed_bitmap base;
+
+    static ETL_CONSTANT size_t MAX_CHUNKS       = Max_Chunks;
+    static ETL_CONSTANT size_t MAX_ARRAY_VALUES = Max_Array_Values;
+    static ETL_CONSTANT size_t MAX_BITMAPS      = Max_Bitmaps;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    compressed_bitmap()
+      : base(chunk_buffer, Max_Chunks, value_buffer, Max_Array_Values, etl::private_compressed_bitmap::bitmap_pool<Max_Bitmaps>::address(bitmap_pool))
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    compressed_bitmap(const compressed_bitmap& other)
+      : base(chunk_buffer, Max_Chunks, value_buffer, Max_Array_Values, etl::private_compressed_bitmap::bitmap_pool<Max_Bitmaps>::address(bitmap_pool))
+    {
+      base::operator =(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~compressed_bitmap()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    compressed_bitmap& operator =(const compressed_bitmap& rhs)
+    {
+      base::operator =(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment from any compressed_bitmap.
+    //*************************************************************************
+    compressed_bitmap& operator =(const base& rhs)
+    {
+      base::operator =(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    chunk_type chunk_buffer[Max_Chunks];
+    uint16_t   value_buffer[Max_Array_Values];
+
+    typename etl::private_compressed_bitmap::bitmap_pool<Max_Bitmaps>::type bitmap_pool;
+  };
+
+  template <size_t Max_Chunks, size_t Max_Array_Values, size_t Max_Bitmaps>
+  ETL_CONSTANT size_t compressed_bitmap<Max_Chunks, Max_Array_Values, Max_Bitmaps>::MAX_CHUNKS;
+
+  template <size_t Max_Chunks, size_t Max_Array_Values, size_t Max_Bitmaps>
+  ETL_CONSTANT size_t compressed_bitmap<Max_Chunks, Max_Array_Values, Max_Bitmaps>::MAX_ARRAY_VALUES;
+
+  template <size_t Max_Chunks, size_t Max_Array_Values, size_t Max_Bitmaps>
+  ETL_CONSTANT size_t compressed_bitmap<Max_Chunks, Max_Array_Values, Max_Bitmaps>::MAX_BITMAPS;
+
+  //***************************************************************************
+  /// A compressed_bitmap that takes its bitmaps from an external pool, which
+  /// may be shared with other compressed_bitmaps.
+  /// The pool must hold items of etl::icompressed_bitmap::bitmap_type.
+  ///\tparam Max_Chunks       The number of chunks of 65536 values that may be used.
+  ///\tparam Max_Array_Values The number of values held by all of the array containers.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  template <size_t Max_Chunks, size_t Max_Array_Values>
+  class compressed_bitmap_ext : public etl::icompressed_bitmap
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Chunks > 0U, "Zero chunks");
+    ETL_STATIC_ASSERT(Max_Array_Values > 0U, "Zero array values");
+
+    typedef etl::icompressed_bitmap base;
+
+    static ETL_CONSTANT size_t MAX_CHUNKS       = Max_Chunks;
+    static ETL_CONSTANT size_t MAX_ARRAY_VALUES = Max_Array_Values;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit compressed_bitmap_ext(etl::ipool& pool)
+      : base(chunk_buffer, Max_Chunks, value_buffer, Max_Array_Values, &pool)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor, taking the bitmaps from pool.
+    //*************************************************************************
+    compressed_bitmap_ext(const compressed_bitmap_ext& other, etl::ipool& pool)
+      : base(chunk_buffer, Max_Chunks, value_buffer, Max_Array_Values, &pool)
+    {
+      base::operator =(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~compressed_bitmap_ext()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    compressed_bitmap_ext& operator =(const compressed_bitmap_ext& rhs)
+    {
+      base::operator =(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment from any compressed_bitmap.
+    //*************************************************************************
+    compressed_bitmap_ext& operator =(const base& rhs)
+    {
+      base::operator =(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    // Disable copy construction without a pool.
+    compressed_bitmap_ext(const compressed_bitmap_ext&);
+
+    chunk_type chunk_buffer[Max_Chunks];
+    uint16_t   value_buffer[Max_Array_Values];
+  };
+
+  template <size_t Max_Chunks, size_t Max_Array_Values>
+  ETL_CONSTANT size_t compressed_bitmap_ext<Max_Chunks, Max_Array_Values>::MAX_CHUNKS;
+
+  template <size_t Max_Chunks, size_t Max_Array_Values>
+  ETL_CONSTANT size_t compressed_bitmap_ext<Max_Chunks, Max_Array_Values>::MAX_ARRAY_VALUES;
+}
+
+#endif
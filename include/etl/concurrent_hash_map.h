@@ -0,0 +1,652 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONCURRENT_HASH_MAP_INCLUDED
+#define ETL_CONCURRENT_HASH_MAP_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "spin_mutex.h"
+#include "functional.h"
+#include "hash.h"
+#include "power.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup concurrent_hash_map concurrent_hash_map
+/// A hash map that may be used from several threads or cores at once, with
+/// the capacity defined at compile time.
+/// The table is split in to stripes, each with its own lock and sequence
+/// number. Updates lock only their stripe. Lookups take no lock; they read
+/// optimistically and retry if the stripe's sequence number shows that an
+/// update overlapped, as etl::seqlock does.
+///\ingroup containers
+//*****************************************************************************
+
+//*****************************************************************************
+/// The default spacing of the stripes.
+//*****************************************************************************
+#if !defined(ETL_CONCURRENT_HASH_MAP_CACHE_LINE_SIZE)
+  #define ETL_CONCURRENT_HASH_MAP_CACHE_LINE_SIZE 64
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the concurrent_hash_map.
+  ///\ingroup concurrent_hash_map
+  //***************************************************************************
+  class concurrent_hash_map_exception : public etl::exception
+  {
+  public:
+
+    concurrent_hash_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the concurrent_hash_map.
+  ///\ingroup concurrent_hash_map
+  //***************************************************************************
+  class concurrent_hash_map_full : public etl::concurrent_hash_map_exception
+  {
+  public:
+
+    concurrent_hash_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::concurrent_hash_map_exception(ETL_ERROR_TEXT("concurrent_hash_map:full", ETL_CONCURRENT_HASH_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A concurrent hash map.
+  /// Keys and mapped values must be trivially copyable. They are held as
+  /// arrays of atomic words, so optimistic reads are free of data races.
+  /// Lookups return copies of the mapped values.
+  /// Each stripe is an open addressed table of Slots_Per_Stripe slots, filled
+  /// to at most three quarters. The stripes are sized for 1.5 times their
+  /// share of MAX_SIZE_, so a badly skewed hash may fill a stripe first.
+  ///\tparam TKey      The key type.
+  ///\tparam TMapped   The mapped type.
+  ///\tparam MAX_SIZE_ The number of entries to size the table for.
+  ///\tparam VStripes  The number of independently locked stripes.
+  ///\tparam THash     The hash function.
+  ///\tparam TKeyEqual The key equality function.
+  ///\tparam TMutex    The stripe lock. Any type with lock() and unlock().
+  ///\ingroup concurrent_hash_map
+  //***************************************************************************
+  template <typename TKey,
+            typename TMapped,
+            const size_t MAX_SIZE_,
+            size_t VStripes = 16U,
+            typename THash = etl::hash<TKey>,
+            typename TKeyEqual = etl::equal_to<TKey>,
+            typename TMutex = etl::spin_mutex,
+            size_t VCache_Line_Size = ETL_CONCURRENT_HASH_MAP_CACHE_LINE_SIZE>
+  class concurrent_hash_map
+  {
+  public:
+
+#if ETL_USING_STL && ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TKey>::value, "TKey must be trivially copyable");
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TMapped>::value, "TMapped must be trivially copyable");
+#endif
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "concurrent_hash_map: zero capacity");
+    ETL_STATIC_ASSERT(VStripes > 0U, "concurrent_hash_map: zero stripes");
+
+    typedef TKey      key_type;
+    typedef TMapped   mapped_type;
+    typedef THash     hasher;
+    typedef TKeyEqual key_equal;
+    typedef TMutex    mutex_type;
+    typedef size_t    size_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE         = MAX_SIZE_;
+    static ETL_CONSTANT size_t Stripes          = VStripes;
+    static ETL_CONSTANT size_t Slots_Per_Stripe = etl::power_of_2_round_up<2U * ((MAX_SIZE_ + VStripes - 1U) / VStripes)>::value;
+    static ETL_CONSTANT size_t Stripe_Capacity  = Slots_Per_Stripe - (Slots_Per_Stripe / 4U);
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    concurrent_hash_map(const THash& hash_ = THash(), const TKeyEqual& equal_ = TKeyEqual())
+      : hash_function(hash_)
+      , equal_function(equal_)
+    {
+      for (size_t s = 0U; s < VStripes; ++s)
+      {
+        stripes[s].sequence.store(0U, etl::memory_order_relaxed);
+        stripes[s].count.store(0U, etl::memory_order_relaxed);
+      }
+
+      for (size_t i = 0U; i < (VStripes * Slots_Per_Stripe * Slot_Words); ++i)
+      {
+        words[i].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the value mapped to a key, without locking.
+    /// Falls back to locking the stripe if updates keep overlapping.
+    ///\return <b>true</b> if the key was found, with the value copied to 'mapped'.
+    //*************************************************************************
+    bool find(const TKey& key, TMapped& mapped) const
+    {
+      const uint32_t h      = hash_of(key);
+      stripe_t&      stripe = stripes[stripe_index(h)];
+
+      for (size_t attempt = 0U; attempt < Optimistic_Attempts; ++attempt)
+      {
+        const uint32_t before = stripe.sequence.load(etl::memory_order_acquire);
+
+        if ((before & 1U) == 0U)
+        {
+          const size_t slot  = locate(h, key);
+          const bool   found = (slot != Not_Found);
+
+          if (found)
+          {
+            read_mapped(slot, mapped);
+          }
+
+          etl::atomic_thread_fence(etl::memory_order_acquire);
+
+          if (stripe.sequence.load(etl::memory_order_relaxed) == before)
+          {
+            return found;
+          }
+        }
+
+        ETL_SPIN_PAUSE();
+      }
+
+      // Wait for the writers.
+      stripe.mutex.lock();
+
+      const size_t slot  = locate(h, key);
+      const bool   found = (slot != Not_Found);
+
+      if (found)
+      {
+        read_mapped(slot, mapped);
+      }
+
+      stripe.mutex.unlock();
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key, without locking.
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      TMapped mapped;
+
+      return find(key, mapped);
+    }
+
+    //*************************************************************************
+    /// Inserts a value, if the key is not already in the map.
+    /// If asserts or exceptions are enabled, emits concurrent_hash_map_full if
+    /// the key's stripe is full.
+    ///\return <b>true</b> if the value was inserted.
+    //*************************************************************************
+    bool insert(const TKey& key, const TMapped& mapped)
+    {
+      return insert_entry(key, mapped, false);
+    }
+
+    //*************************************************************************
+    /// Inserts a value, or assigns it if the key is already in the map.
+    /// If asserts or exceptions are enabled, emits concurrent_hash_map_full if
+    /// the key's stripe is full.
+    ///\return <b>true</b> if the key is in the map.
+    //*************************************************************************
+    bool insert_or_assign(const TKey& key, const TMapped& mapped)
+    {
+      return insert_entry(key, mapped, true);
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with a reference to a copy of the value mapped to the
+    /// key, then stores the copy. The stripe is locked throughout.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    template <typename TFunction>
+    bool update(const TKey& key, TFunction function)
+    {
+      const uint32_t h      = hash_of(key);
+      stripe_t&      stripe = stripes[stripe_index(h)];
+
+      stripe.mutex.lock();
+
+      const size_t slot = locate(h, key);
+
+      if (slot != Not_Found)
+      {
+        TMapped mapped;
+        read_mapped(slot, mapped);
+
+        function(mapped);
+
+        begin_write(stripe);
+        write_mapped(slot, mapped);
+        end_write(stripe);
+      }
+
+      stripe.mutex.unlock();
+
+      return (slot != Not_Found);
+    }
+
+    //*************************************************************************
+    /// Erases a key.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    bool erase(const TKey& key)
+    {
+      const uint32_t h      = hash_of(key);
+      const size_t   s      = stripe_index(h);
+      stripe_t&      stripe = stripes[s];
+
+      stripe.mutex.lock();
+
+      size_t hole = locate(h, key);
+
+      if (hole != Not_Found)
+      {
+        begin_write(stripe);
+
+        // Shift back the entries after the hole that may move in to it, so
+        // that no probe sequence is broken.
+        const size_t first = s * Slots_Per_Stripe;
+        size_t       next  = hole;
+
+        for (;;)
+        {
+          next = first + (((next - first) + 1U) & Slot_Mask);
+
+          const uint32_t tag = tag_word(next).load(etl::memory_order_relaxed);
+
+          if (tag == 0U)
+          {
+            break;
+          }
+
+          const size_t home = first + start_index(tag);
+
+          if (((next - home) & Slot_Mask) >= ((next - hole) & Slot_Mask))
+          {
+            copy_slot(next, hole);
+            hole = next;
+          }
+        }
+
+        tag_word(hole).store(0U, etl::memory_order_relaxed);
+        stripe.count.store(stripe.count.load(etl::memory_order_relaxed) - 1U, etl::memory_order_relaxed);
+
+        end_write(stripe);
+      }
+
+      stripe.mutex.unlock();
+
+      return (hole != Not_Found);
+    }
+
+    //*************************************************************************
+    /// Erases all the entries.
+    /// Each stripe is cleared in turn, not all at once.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t s = 0U; s < VStripes; ++s)
+      {
+        stripe_t& stripe = stripes[s];
+
+        stripe.mutex.lock();
+        begin_write(stripe);
+
+        for (size_t i = 0U; i < Slots_Per_Stripe; ++i)
+        {
+          tag_word((s * Slots_Per_Stripe) + i).store(0U, etl::memory_order_relaxed);
+        }
+
+        stripe.count.store(0U, etl::memory_order_relaxed);
+
+        end_write(stripe);
+        stripe.mutex.unlock();
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the number of entries.
+    /// Updates made during the call may or may not be included.
+    //*************************************************************************
+    size_t size() const
+    {
+      size_t total = 0U;
+
+      for (size_t s = 0U; s < VStripes; ++s)
+      {
+        total += stripes[s].count.load(etl::memory_order_relaxed);
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Checks if the map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the number of entries the map is sized for.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  private:
+
+    enum
+    {
+      Key_Words           = (sizeof(TKey) + sizeof(uint32_t) - 1U) / sizeof(uint32_t),
+      Mapped_Words        = (sizeof(TMapped) + sizeof(uint32_t) - 1U) / sizeof(uint32_t),
+      Slot_Words          = 1U + Key_Words + Mapped_Words,
+      Slot_Mask           = Slots_Per_Stripe - 1U,
+      Optimistic_Attempts = 4U
+    };
+
+    static ETL_CONSTANT size_t Not_Found = ~size_t(0U);
+
+    //*************************************************************************
+    /// A stripe's lock, sequence number and count, padded to a cache line.
+    //*************************************************************************
+    struct stripe_header_t
+    {
+      TMutex                mutex;
+      etl::atomic<uint32_t> sequence;
+      etl::atomic<uint32_t> count;
+    };
+
+    struct stripe_t : public stripe_header_t
+    {
+      char padding[VCache_Line_Size - (sizeof(stripe_header_t) % VCache_Line_Size)];
+    };
+
+    //*************************************************************************
+    /// The hash, mixed so that the stripe and the start slot come from
+    /// unrelated bits.
+    //*************************************************************************
+    uint32_t hash_of(const TKey& key) const
+    {
+      uint64_t h = static_cast<uint64_t>(hash_function(key));
+
+      return static_cast<uint32_t>(h ^ (h >> 32U)) * 0x9E3779B9UL;
+    }
+
+    //*************************************************************************
+    static size_t stripe_index(uint32_t h)
+    {
+      return static_cast<size_t>(((h * 0x85EBCA6BUL) >> 16U) % VStripes);
+    }
+
+    //*************************************************************************
+    /// The slot in the stripe where the key's probe starts.
+    /// Bit 0 is not used, as it is always set in the tag.
+    //*************************************************************************
+    static size_t start_index(uint32_t tag)
+    {
+      return static_cast<size_t>(tag >> 1U) & Slot_Mask;
+    }
+
+    //*************************************************************************
+    /// A non-zero tag for an occupied slot.
+    //*************************************************************************
+    static uint32_t tag_of(uint32_t h)
+    {
+      return h | 1U;
+    }
+
+    //*************************************************************************
+    etl::atomic<uint32_t>& tag_word(size_t slot) const
+    {
+      return words[slot * Slot_Words];
+    }
+
+    //*************************************************************************
+    /// Finds the slot holding the key.
+    /// The number of probes is bounded, so a read overlapping an update
+    /// always ends.
+    //*************************************************************************
+    size_t locate(uint32_t h, const TKey& key) const
+    {
+      const uint32_t tag   = tag_of(h);
+      const size_t   first = stripe_index(h) * Slots_Per_Stripe;
+      size_t         index = start_index(tag);
+
+      for (size_t probe = 0U; probe < Slots_Per_Stripe; ++probe)
+      {
+        const size_t   slot      = first + index;
+        const uint32_t slot_tag = tag_word(slot).load(etl::memory_order_relaxed);
+
+        if (slot_tag == 0U)
+        {
+          return Not_Found;
+        }
+
+        if (slot_tag == tag)
+        {
+          TKey slot_key;
+          read_key(slot, slot_key);
+
+          if (equal_function(slot_key, key))
+          {
+            return slot;
+          }
+        }
+
+        index = (index + 1U) & Slot_Mask;
+      }
+
+      return Not_Found;
+    }
+
+    //*************************************************************************
+    bool insert_entry(const TKey& key, const TMapped& mapped, bool assign)
+    {
+      const uint32_t h      = hash_of(key);
+      const size_t   s      = stripe_index(h);
+      stripe_t&      stripe = stripes[s];
+
+      stripe.mutex.lock();
+
+      const size_t slot = locate(h, key);
+
+      if (slot != Not_Found)
+      {
+        if (assign)
+        {
+          begin_write(stripe);
+          write_mapped(slot, mapped);
+          end_write(stripe);
+        }
+
+        stripe.mutex.unlock();
+
+        return assign;
+      }
+
+      const uint32_t count = stripe.count.load(etl::memory_order_relaxed);
+
+      if (count >= Stripe_Capacity)
+      {
+        stripe.mutex.unlock();
+        ETL_ASSERT_FAIL(ETL_ERROR(concurrent_hash_map_full));
+
+        return false;
+      }
+
+      // Find the first empty slot in the key's probe sequence.
+      const uint32_t tag   = tag_of(h);
+      const size_t   first = s * Slots_Per_Stripe;
+      size_t         index = start_index(tag);
+
+      while (tag_word(first + index).load(etl::memory_order_relaxed) != 0U)
+      {
+        index = (index + 1U) & Slot_Mask;
+      }
+
+      const size_t empty_slot = first + index;
+
+      begin_write(stripe);
+      write_words(empty_slot * Slot_Words + 1U, &key, sizeof(TKey), Key_Words);
+      write_mapped(empty_slot, mapped);
+      tag_word(empty_slot).store(tag, etl::memory_order_relaxed);
+      stripe.count.store(count + 1U, etl::memory_order_relaxed);
+      end_write(stripe);
+
+      stripe.mutex.unlock();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Marks the start and end of an update, so that overlapping reads retry.
+    //*************************************************************************
+    static void begin_write(stripe_t& stripe)
+    {
+      const uint32_t sequence = stripe.sequence.load(etl::memory_order_relaxed);
+
+      // Odd while writing.
+      stripe.sequence.store(sequence + 1U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+    }
+
+    static void end_write(stripe_t& stripe)
+    {
+      stripe.sequence.store(stripe.sequence.load(etl::memory_order_relaxed) + 1U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    void read_key(size_t slot, TKey& key) const
+    {
+      read_words(slot * Slot_Words + 1U, &key, sizeof(TKey), Key_Words);
+    }
+
+    void read_mapped(size_t slot, TMapped& mapped) const
+    {
+      read_words(slot * Slot_Words + 1U + Key_Words, &mapped, sizeof(TMapped), Mapped_Words);
+    }
+
+    void write_mapped(size_t slot, const TMapped& mapped)
+    {
+      write_words(slot * Slot_Words + 1U + Key_Words, &mapped, sizeof(TMapped), Mapped_Words);
+    }
+
+    void copy_slot(size_t from, size_t to)
+    {
+      for (size_t i = 0U; i < Slot_Words; ++i)
+      {
+        words[(to * Slot_Words) + i].store(words[(from * Slot_Words) + i].load(etl::memory_order_relaxed), etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    void read_words(size_t index, void* object, size_t object_size, size_t n) const
+    {
+      uint32_t buffer[(Key_Words > Mapped_Words) ? Key_Words : Mapped_Words];
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        buffer[i] = words[index + i].load(etl::memory_order_relaxed);
+      }
+
+      memcpy(object, buffer, object_size);
+    }
+
+    void write_words(size_t index, const void* object, size_t object_size, size_t n)
+    {
+      uint32_t buffer[(Key_Words > Mapped_Words) ? Key_Words : Mapped_Words];
+
+      buffer[n - 1U] = 0U;
+      memcpy(buffer, object, object_size);
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        words[index + i].store(buffer[i], etl::memory_order_relaxed);
+      }
+    }
+
+    concurrent_hash_map(const concurrent_hash_map&) ETL_DELETE;
+    concurrent_hash_map& operator =(const concurrent_hash_map&) ETL_DELETE;
+
+    THash     hash_function;
+    TKeyEqual equal_function;
+
+    mutable stripe_t              stripes[VStripes];
+    mutable etl::atomic<uint32_t> words[VStripes * Slots_Per_Stripe * Slot_Words];
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, size_t VStripes, typename THash, typename TKeyEqual, typename TMutex, size_t VCache_Line_Size>
+  ETL_CONSTANT size_t concurrent_hash_map<TKey, TMapped, MAX_SIZE_, VStripes, THash, TKeyEqual, TMutex, VCache_Line_Size>::MAX_SIZE;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, size_t VStripes, typename THash, typename TKeyEqual, typename TMutex, size_t VCache_Line_Size>
+  ETL_CONSTANT size_t concurrent_hash_map<TKey, TMapped, MAX_SIZE_, VStripes, THash, TKeyEqual, TMutex, VCache_Line_Size>::Stripes;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, size_t VStripes, typename THash, typename TKeyEqual, typename TMutex, size_t VCache_Line_Size>
+  ETL_CONSTANT size_t concurrent_hash_map<TKey, TMapped, MAX_SIZE_, VStripes, THash, TKeyEqual, TMutex, VCache_Line_Size>::Slots_Per_Stripe;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, size_t VStripes, typename THash, typename TKeyEqual, typename TMutex, size_t VCache_Line_Size>
+  ETL_CONSTANT size_t concurrent_hash_map<TKey, TMapped, MAX_SIZE_, VStripes, THash, TKeyEqual, TMutex, VCache_Line_Size>::Stripe_Capacity;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, size_t VStripes, typename THash, typename TKeyEqual, typename TMutex, size_t VCache_Line_Size>
+  ETL_CONSTANT size_t concurrent_hash_map<TKey, TMapped, MAX_SIZE_, VStripes, THash, TKeyEqual, TMutex, VCache_Line_Size>::Not_Found;
+}
+
+#endif
+#endif
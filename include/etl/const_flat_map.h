@@ -0,0 +1,486 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONST_FLAT_MAP_INCLUDED
+#define ETL_CONST_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "iterator.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "static_assert.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup const_flat_map const_flat_map
+/// A read only map that is sorted when it is constructed, so that a constexpr
+/// map is built by the compiler and may be placed in ROM.
+/// e.g.
+///   constexpr etl::const_flat_map<int, char, 3> map{{ {3, 'c'}, {1, 'a'}, {2, 'b'} }};
+/// Has search of O(logN).
+/// Duplicate keys are not allowed. A constexpr map with duplicate keys does
+/// not compile.
+/// Requires C++14.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_USING_CPP14
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the const_flat_map.
+  ///\ingroup const_flat_map
+  //***************************************************************************
+  class const_flat_map_exception : public etl::exception
+  {
+  public:
+
+    const_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the const_flat_map.
+  ///\ingroup const_flat_map
+  //***************************************************************************
+  class const_flat_map_out_of_bounds : public etl::const_flat_map_exception
+  {
+  public:
+
+    const_flat_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::const_flat_map_exception(ETL_ERROR_TEXT("const_flat_map:bounds", ETL_CONST_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Duplicate key exception for the const_flat_map.
+  ///\ingroup const_flat_map
+  //***************************************************************************
+  class const_flat_map_duplicate_key : public etl::const_flat_map_exception
+  {
+  public:
+
+    const_flat_map_duplicate_key(string_type file_name_, numeric_type line_number_)
+      : etl::const_flat_map_exception(ETL_ERROR_TEXT("const_flat_map:duplicate", ETL_CONST_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_const_flat_map
+  {
+    //*************************************************************************
+    /// Reports a duplicate key.
+    /// Not constexpr, so that constructing a constexpr map with a duplicate
+    /// key is a compile error.
+    //*************************************************************************
+    inline void duplicate_key()
+    {
+      ETL_ASSERT_FAIL(ETL_ERROR(etl::const_flat_map_duplicate_key));
+    }
+  }
+
+  //***************************************************************************
+  /// A read only flat map, sorted on construction.
+  ///\ingroup const_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t VSize, typename TKeyCompare = etl::less<TKey> >
+  class const_flat_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize != 0U, "const_flat_map must not be empty");
+
+    typedef TKey                              key_type;
+    typedef TMapped                           mapped_type;
+    typedef ETL_OR_STD::pair<TKey, TMapped>   value_type;
+    typedef TKeyCompare                       key_compare;
+    typedef const value_type&                 const_reference;
+    typedef const value_type*                 const_pointer;
+    typedef const value_type*                 const_iterator;
+    typedef const_iterator                    iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator            reverse_iterator;
+    typedef size_t                            size_type;
+    typedef ptrdiff_t                         difference_type;
+
+    typedef const key_type&    const_key_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    static ETL_CONSTANT size_t Max_Size = VSize;
+
+    //*************************************************************************
+    /// Constructs from an array of values, in any order.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_flat_map(const value_type (&values)[VSize])
+      : const_flat_map(sort(values), etl::make_index_sequence<VSize>())
+    {
+    }
+
+    //*************************************************************************
+    /// Iterators, in key order.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const
+    {
+      return elements;
+    }
+
+    ETL_CONSTEXPR14 const_iterator cbegin() const
+    {
+      return elements;
+    }
+
+    ETL_CONSTEXPR14 const_iterator end() const
+    {
+      return elements + VSize;
+    }
+
+    ETL_CONSTEXPR14 const_iterator cend() const
+    {
+      return elements + VSize;
+    }
+
+    ETL_CONSTEXPR17 const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    ETL_CONSTEXPR17 const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    ETL_CONSTEXPR17 const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    ETL_CONSTEXPR17 const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the value for a key.
+    /// If asserts or exceptions are enabled, emits an etl::const_flat_map_out_of_bounds
+    /// if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_mapped_reference at(const_key_reference key) const
+    {
+      return at_key(key);
+    }
+
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 const_mapped_reference at(const K& key) const
+    {
+      return at_key(key);
+    }
+
+    //*************************************************************************
+    /// Finds a key. Returns end() if it is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const_key_reference key) const
+    {
+      return find_key(key);
+    }
+
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 const_iterator find(const K& key) const
+    {
+      return find_key(key);
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains a key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const_key_reference key) const
+    {
+      return find_key(key) != end();
+    }
+
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 bool contains(const K& key) const
+    {
+      return find_key(key) != end();
+    }
+
+    //*************************************************************************
+    /// Counts the elements with a key. Either 0 or 1.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type count(const_key_reference key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 size_type count(const K& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the first element with a key not less than 'key'.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator lower_bound(const_key_reference key) const
+    {
+      return lower_bound_key(key);
+    }
+
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 const_iterator lower_bound(const K& key) const
+    {
+      return lower_bound_key(key);
+    }
+
+    //*************************************************************************
+    /// Gets the first element with a key greater than 'key'.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator upper_bound(const_key_reference key) const
+    {
+      return upper_bound_key(key);
+    }
+
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 const_iterator upper_bound(const K& key) const
+    {
+      return upper_bound_key(key);
+    }
+
+    //*************************************************************************
+    /// Gets the range of elements with a key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound_key(key), upper_bound_key(key));
+    }
+
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound_key(key), upper_bound_key(key));
+    }
+
+    //*************************************************************************
+    /// Size and capacity.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type size() const
+    {
+      return VSize;
+    }
+
+    ETL_CONSTEXPR14 size_type max_size() const
+    {
+      return VSize;
+    }
+
+    ETL_CONSTEXPR14 bool empty() const
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// Gets the key compare function.
+    //*************************************************************************
+    ETL_CONSTEXPR14 key_compare key_comp() const
+    {
+      return key_compare();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Pointers to the values, in key order.
+    //*************************************************************************
+    struct order
+    {
+      const value_type* p[VSize];
+    };
+
+    //*************************************************************************
+    /// Orders the values by key with a heap sort and checks for duplicates.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 order sort(const value_type (&values)[VSize])
+    {
+      order result{};
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        result.p[i] = &values[i];
+      }
+
+      for (size_t i = VSize / 2U; i != 0U; --i)
+      {
+        sift_down(result, i - 1U, VSize);
+      }
+
+      for (size_t n = VSize - 1U; n != 0U; --n)
+      {
+        const value_type* temp = result.p[0];
+        result.p[0] = result.p[n];
+        result.p[n] = temp;
+
+        sift_down(result, 0U, n);
+      }
+
+      for (size_t i = 1U; i < VSize; ++i)
+      {
+        if (!key_compare()(result.p[i - 1U]->first, result.p[i]->first))
+        {
+          private_const_flat_map::duplicate_key();
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Restores the max heap below 'i', for a heap of 'n' values.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 void sift_down(order& heap, size_t i, size_t n)
+    {
+      while ((2U * i) + 1U < n)
+      {
+        size_t child = (2U * i) + 1U;
+
+        if (((child + 1U) < n) && key_compare()(heap.p[child]->first, heap.p[child + 1U]->first))
+        {
+          ++child;
+        }
+
+        if (!key_compare()(heap.p[i]->first, heap.p[child]->first))
+        {
+          return;
+        }
+
+        const value_type* temp = heap.p[i];
+        heap.p[i]     = heap.p[child];
+        heap.p[child] = temp;
+
+        i = child;
+      }
+    }
+
+    //*************************************************************************
+    /// Copies the values in key order.
+    //*************************************************************************
+    template <size_t... Indices>
+    ETL_CONSTEXPR14 const_flat_map(const order& sorted, etl::index_sequence<Indices...>)
+      : elements{ value_type(sorted.p[Indices]->first, sorted.p[Indices]->second)... }
+    {
+    }
+
+    //*************************************************************************
+    template <typename K>
+    ETL_CONSTEXPR14 const_iterator lower_bound_key(const K& key) const
+    {
+      size_t first = 0U;
+      size_t count = VSize;
+
+      while (count != 0U)
+      {
+        const size_t step = count / 2U;
+
+        if (key_compare()(elements[first + step].first, key))
+        {
+          first += step + 1U;
+          count -= step + 1U;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return elements + first;
+    }
+
+    //*************************************************************************
+    template <typename K>
+    ETL_CONSTEXPR14 const_iterator upper_bound_key(const K& key) const
+    {
+      size_t first = 0U;
+      size_t count = VSize;
+
+      while (count != 0U)
+      {
+        const size_t step = count / 2U;
+
+        if (!key_compare()(key, elements[first + step].first))
+        {
+          first += step + 1U;
+          count -= step + 1U;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return elements + first;
+    }
+
+    //*************************************************************************
+    template <typename K>
+    ETL_CONSTEXPR14 const_iterator find_key(const K& key) const
+    {
+      const_iterator itr = lower_bound_key(key);
+
+      return ((itr != end()) && !key_compare()(key, itr->first)) ? itr : end();
+    }
+
+    //*************************************************************************
+    template <typename K>
+    ETL_CONSTEXPR14 const_mapped_reference at_key(const K& key) const
+    {
+      const_iterator itr = find_key(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(etl::const_flat_map_out_of_bounds));
+
+      return itr->second;
+    }
+
+    value_type elements[VSize];
+  };
+
+  template <typename TKey, typename TMapped, size_t VSize, typename TKeyCompare>
+  ETL_CONSTANT size_t const_flat_map<TKey, TMapped, VSize, TKeyCompare>::Max_Size;
+}
+
+#endif
+#endif
@@ -0,0 +1,449 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONST_UNORDERED_MAP_INCLUDED
+#define ETL_CONST_UNORDERED_MAP_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "smallest.h"
+#include "string_view.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup const_unordered_map const_unordered_map
+/// A read only hash map that is laid out when it is constructed, so that a
+/// constexpr map is built by the compiler and may be placed in ROM.
+/// e.g.
+///   constexpr etl::const_unordered_map<int, char, 3> map{{ {3, 'c'}, {1, 'a'}, {2, 'b'} }};
+/// The values are stored grouped by bucket, with no empty slots, and each
+/// bucket is found through a table of offsets.
+/// The hash must be constexpr to construct a constexpr map. The default,
+/// etl::const_hash, supports integral and enum keys and etl::basic_string_view.
+/// Duplicate keys are not allowed. A constexpr map with duplicate keys does
+/// not compile.
+/// Requires C++14.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_USING_CPP14
+
+namespace etl
+{
+  //***************************************************************************
+  /// A constexpr hash for integral and enum keys.
+  ///\ingroup const_unordered_map
+  //***************************************************************************
+  template <typename T, typename = void>
+  struct const_hash;
+
+  template <typename T>
+  struct const_hash<T, etl::enable_if_t<etl::is_integral<T>::value || etl::is_enum<T>::value> >
+  {
+    ETL_CONSTEXPR14 size_t operator ()(T value) const
+    {
+      // Fibonacci hashing, with the high bits folded down so that the low
+      // bits depend on all of the key.
+      size_t hash = static_cast<size_t>(static_cast<uint64_t>(value) * 0x9E3779B97F4A7C15ULL);
+
+      return hash ^ (hash >> (sizeof(size_t) * 4U));
+    }
+  };
+
+  //***************************************************************************
+  /// A constexpr FNV-1a hash for string views.
+  ///\ingroup const_unordered_map
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  struct const_hash<etl::basic_string_view<T, TTraits>, void>
+  {
+    ETL_CONSTEXPR14 size_t operator ()(const etl::basic_string_view<T, TTraits>& view) const
+    {
+      uint32_t hash = 2166136261UL;
+
+      for (size_t i = 0U; i < view.size(); ++i)
+      {
+        hash ^= static_cast<uint32_t>(view[i]);
+        hash *= 16777619UL;
+      }
+
+      return static_cast<size_t>(hash);
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for the const_unordered_map.
+  ///\ingroup const_unordered_map
+  //***************************************************************************
+  class const_unordered_map_exception : public etl::exception
+  {
+  public:
+
+    const_unordered_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the const_unordered_map.
+  ///\ingroup const_unordered_map
+  //***************************************************************************
+  class const_unordered_map_out_of_bounds : public etl::const_unordered_map_exception
+  {
+  public:
+
+    const_unordered_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::const_unordered_map_exception(ETL_ERROR_TEXT("const_unordered_map:bounds", ETL_CONST_UNORDERED_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Duplicate key exception for the const_unordered_map.
+  ///\ingroup const_unordered_map
+  //***************************************************************************
+  class const_unordered_map_duplicate_key : public etl::const_unordered_map_exception
+  {
+  public:
+
+    const_unordered_map_duplicate_key(string_type file_name_, numeric_type line_number_)
+      : etl::const_unordered_map_exception(ETL_ERROR_TEXT("const_unordered_map:duplicate", ETL_CONST_UNORDERED_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_const_unordered_map
+  {
+    //*************************************************************************
+    /// Reports a duplicate key.
+    /// Not constexpr, so that constructing a constexpr map with a duplicate
+    /// key is a compile error.
+    //*************************************************************************
+    inline void duplicate_key()
+    {
+      ETL_ASSERT_FAIL(ETL_ERROR(etl::const_unordered_map_duplicate_key));
+    }
+  }
+
+  //***************************************************************************
+  /// A read only hash map, laid out on construction.
+  ///\ingroup const_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t VSize, size_t VBuckets = VSize, typename THash = etl::const_hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class const_unordered_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize != 0U, "const_unordered_map must not be empty");
+    ETL_STATIC_ASSERT(VBuckets != 0U, "const_unordered_map must have buckets");
+
+    typedef TKey                            key_type;
+    typedef TMapped                         mapped_type;
+    typedef ETL_OR_STD::pair<TKey, TMapped> value_type;
+    typedef THash                           hasher;
+    typedef TKeyEqual                       key_equal;
+    typedef const value_type&               const_reference;
+    typedef const value_type*               const_pointer;
+    typedef const value_type*               const_iterator;
+    typedef const_iterator                  iterator;
+    typedef const_iterator                  const_local_iterator;
+    typedef const_local_iterator            local_iterator;
+    typedef size_t                          size_type;
+    typedef ptrdiff_t                       difference_type;
+
+    typedef const key_type&    const_key_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    static ETL_CONSTANT size_t Max_Size    = VSize;
+    static ETL_CONSTANT size_t Max_Buckets = VBuckets;
+
+    //*************************************************************************
+    /// Constructs from an array of values.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_unordered_map(const value_type (&values)[VSize])
+      : const_unordered_map(arrange(values), etl::make_index_sequence<VSize>())
+    {
+    }
+
+    //*************************************************************************
+    /// Iterators, in bucket order.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const
+    {
+      return elements;
+    }
+
+    ETL_CONSTEXPR14 const_iterator cbegin() const
+    {
+      return elements;
+    }
+
+    ETL_CONSTEXPR14 const_iterator end() const
+    {
+      return elements + VSize;
+    }
+
+    ETL_CONSTEXPR14 const_iterator cend() const
+    {
+      return elements + VSize;
+    }
+
+    //*************************************************************************
+    /// Bucket iterators.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_local_iterator begin(size_t i) const
+    {
+      return elements + offsets[i];
+    }
+
+    ETL_CONSTEXPR14 const_local_iterator cbegin(size_t i) const
+    {
+      return elements + offsets[i];
+    }
+
+    ETL_CONSTEXPR14 const_local_iterator end(size_t i) const
+    {
+      return elements + offsets[i + 1U];
+    }
+
+    ETL_CONSTEXPR14 const_local_iterator cend(size_t i) const
+    {
+      return elements + offsets[i + 1U];
+    }
+
+    //*************************************************************************
+    /// Gets the value for a key.
+    /// If asserts or exceptions are enabled, emits an etl::const_unordered_map_out_of_bounds
+    /// if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(etl::const_unordered_map_out_of_bounds));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Finds a key. Returns end() if it is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const_key_reference key) const
+    {
+      const size_t index = bucket(key);
+
+      for (const_iterator itr = begin(index); itr != end(index); ++itr)
+      {
+        if (key_equal()(itr->first, key))
+        {
+          return itr;
+        }
+      }
+
+      return end();
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains a key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const_key_reference key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Counts the elements with a key. Either 0 or 1.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type count(const_key_reference key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the range of elements with a key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator itr = find(key);
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(itr, (itr == end()) ? itr : itr + 1);
+    }
+
+    //*************************************************************************
+    /// Gets the bucket for a key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type bucket(const_key_reference key) const
+    {
+      return hasher()(key) % VBuckets;
+    }
+
+    //*************************************************************************
+    /// Gets the number of elements in a bucket.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type bucket_size(size_t i) const
+    {
+      return offsets[i + 1U] - offsets[i];
+    }
+
+    //*************************************************************************
+    /// Size and capacity.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type size() const
+    {
+      return VSize;
+    }
+
+    ETL_CONSTEXPR14 size_type max_size() const
+    {
+      return VSize;
+    }
+
+    ETL_CONSTEXPR14 bool empty() const
+    {
+      return false;
+    }
+
+    ETL_CONSTEXPR14 size_type bucket_count() const
+    {
+      return VBuckets;
+    }
+
+    ETL_CONSTEXPR14 size_type max_bucket_count() const
+    {
+      return VBuckets;
+    }
+
+    ETL_CONSTEXPR14 float load_factor() const
+    {
+      return static_cast<float>(VSize) / static_cast<float>(VBuckets);
+    }
+
+    //*************************************************************************
+    /// Gets the hash and key equality functions.
+    //*************************************************************************
+    ETL_CONSTEXPR14 hasher hash_function() const
+    {
+      return hasher();
+    }
+
+    ETL_CONSTEXPR14 key_equal key_eq() const
+    {
+      return key_equal();
+    }
+
+  private:
+
+    typedef typename etl::smallest_uint_for_value<VSize>::type offset_type;
+
+    //*************************************************************************
+    /// Pointers to the values, grouped by bucket, and the start of each bucket.
+    //*************************************************************************
+    struct layout
+    {
+      const value_type* p[VSize];
+      offset_type       offsets[VBuckets + 1U];
+    };
+
+    //*************************************************************************
+    /// Groups the values by bucket and checks for duplicates.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 layout arrange(const value_type (&values)[VSize])
+    {
+      layout result{};
+
+      // Count the values in each bucket.
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        ++result.offsets[(hasher()(values[i].first) % VBuckets) + 1U];
+      }
+
+      // The start of each bucket.
+      for (size_t b = 0U; b < VBuckets; ++b)
+      {
+        result.offsets[b + 1U] += result.offsets[b];
+      }
+
+      // Place the values, using the next free position in each bucket.
+      offset_type next[VBuckets] = {};
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        const size_t b = hasher()(values[i].first) % VBuckets;
+        const size_t position = result.offsets[b] + next[b]++;
+
+        for (size_t j = result.offsets[b]; j < position; ++j)
+        {
+          if (key_equal()(result.p[j]->first, values[i].first))
+          {
+            private_const_unordered_map::duplicate_key();
+          }
+        }
+
+        result.p[position] = &values[i];
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Copies the values in bucket order.
+    //*************************************************************************
+    template <size_t... Indices>
+    ETL_CONSTEXPR14 const_unordered_map(const layout& arranged, etl::index_sequence<Indices...>)
+      : elements{ value_type(arranged.p[Indices]->first, arranged.p[Indices]->second)... }
+      , offsets{}
+    {
+      for (size_t b = 0U; b <= VBuckets; ++b)
+      {
+        offsets[b] = arranged.offsets[b];
+      }
+    }
+
+    value_type  elements[VSize];
+    offset_type offsets[VBuckets + 1U];
+  };
+
+  template <typename TKey, typename TMapped, size_t VSize, size_t VBuckets, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t const_unordered_map<TKey, TMapped, VSize, VBuckets, THash, TKeyEqual>::Max_Size;
+
+  template <typename TKey, typename TMapped, size_t VSize, size_t VBuckets, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t const_unordered_map<TKey, TMapped, VSize, VBuckets, THash, TKeyEqual>::Max_Buckets;
+}
+
+#endif
+#endif
@@ -0,0 +1,500 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COROUTINE_TASK_INCLUDED
+#define ETL_COROUTINE_TASK_INCLUDED
+
+#include "platform.h"
+
+#if ETL_USING_CPP20 && ETL_USING_STL && defined(__cpp_impl_coroutine)
+
+#include "nullptr.h"
+#include "task.h"
+#include "ipool.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <coroutine>
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup coroutine_task coroutine_task
+/// Tasks for etl::scheduler that are written as C++20 coroutines.
+/// The coroutine returns an etl::co_task, and suspends at co_await points
+/// until there is something for it to do. The scheduler only resumes it when
+/// the condition that it awaits is met, so a hand written state machine is
+/// not needed.
+/// The coroutine frames are allocated from an etl::ipool, set by
+/// etl::co_task::set_frame_pool(), so there is no heap allocation.
+///\ingroup etl
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for coroutine_task.
+  //***************************************************************************
+  class coroutine_task_exception : public etl::task_exception
+  {
+  public:
+
+    coroutine_task_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::task_exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A coroutine exited with an exception.
+  //***************************************************************************
+  class coroutine_task_unhandled_exception : public etl::coroutine_task_exception
+  {
+  public:
+
+    coroutine_task_unhandled_exception(string_type file_name_, numeric_type line_number_)
+      : etl::coroutine_task_exception(ETL_ERROR_TEXT("coroutine task:unhandled exception", ETL_COROUTINE_TASK_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A coroutine frame could not be allocated.
+  //***************************************************************************
+  class coroutine_task_no_frame : public etl::coroutine_task_exception
+  {
+  public:
+
+    coroutine_task_no_frame(string_type file_name_, numeric_type line_number_)
+      : etl::coroutine_task_exception(ETL_ERROR_TEXT("coroutine task:no frame", ETL_COROUTINE_TASK_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The return type of a coroutine that is run by an etl::coroutine_task.
+  /// Owns the coroutine frame.
+  //***************************************************************************
+  class co_task
+  {
+  public:
+
+    //*************************************************************************
+    /// The coroutine promise.
+    //*************************************************************************
+    struct promise_type
+    {
+      //*******************************************
+      co_task get_return_object() noexcept
+      {
+        return co_task(std::coroutine_handle<promise_type>::from_promise(*this));
+      }
+
+      //*******************************************
+      static co_task get_return_object_on_allocation_failure() noexcept
+      {
+        return co_task();
+      }
+
+      //*******************************************
+      /// Allocates the frame from the frame pool.
+      /// Returns ETL_NULLPTR if there is no pool or it is full.
+      //*******************************************
+      static void* operator new(size_t size) noexcept
+      {
+        if ((p_frame_pool == ETL_NULLPTR) || p_frame_pool->full())
+        {
+          return ETL_NULLPTR;
+        }
+
+        return p_frame_pool->allocate(size);
+      }
+
+      //*******************************************
+      static void operator delete(void* p_frame) noexcept
+      {
+        p_frame_pool->release(p_frame);
+      }
+
+      //*******************************************
+      /// The coroutine first runs when the scheduler calls it.
+      //*******************************************
+      std::suspend_always initial_suspend() noexcept
+      {
+        return std::suspend_always();
+      }
+
+      //*******************************************
+      /// The frame is destroyed by the co_task.
+      //*******************************************
+      std::suspend_always final_suspend() noexcept
+      {
+        return std::suspend_always();
+      }
+
+      //*******************************************
+      void return_void() noexcept
+      {
+      }
+
+      //*******************************************
+      void unhandled_exception()
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::coroutine_task_unhandled_exception));
+      }
+
+      //*******************************************
+      /// Records what the coroutine is waiting for.
+      /// p_ready is called with p_context to check if it can be resumed.
+      //*******************************************
+      void wait_for(bool (*p_ready_)(const void*), const void* p_context_) noexcept
+      {
+        p_ready   = p_ready_;
+        p_context = p_context_;
+      }
+
+      //*******************************************
+      /// Checks if the coroutine can be resumed.
+      //*******************************************
+      bool is_ready() const
+      {
+        return (p_ready == ETL_NULLPTR) || p_ready(p_context);
+      }
+
+      //*******************************************
+      void clear_wait() noexcept
+      {
+        p_ready   = ETL_NULLPTR;
+        p_context = ETL_NULLPTR;
+      }
+
+    private:
+
+      bool (*p_ready)(const void*) = ETL_NULLPTR;
+      const void* p_context        = ETL_NULLPTR;
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    //*************************************************************************
+    /// Sets the pool that the coroutine frames are allocated from.
+    /// The items must be large enough for the largest frame.
+    //*************************************************************************
+    static void set_frame_pool(etl::ipool& pool) noexcept
+    {
+      p_frame_pool = &pool;
+    }
+
+    //*************************************************************************
+    /// Default constructor. Has no coroutine.
+    //*************************************************************************
+    co_task() noexcept
+      : handle()
+    {
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    co_task(co_task&& other) noexcept
+      : handle(other.handle)
+    {
+      other.handle = handle_type();
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    co_task& operator =(co_task&& other) noexcept
+    {
+      if (this != &other)
+      {
+        destroy();
+        handle       = other.handle;
+        other.handle = handle_type();
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor. Destroys the coroutine frame.
+    //*************************************************************************
+    ~co_task()
+    {
+      destroy();
+    }
+
+    //*************************************************************************
+    /// Checks if there is a coroutine.
+    //*************************************************************************
+    bool is_valid() const noexcept
+    {
+      return static_cast<bool>(handle);
+    }
+
+    //*************************************************************************
+    /// Checks if the coroutine has finished.
+    //*************************************************************************
+    bool done() const noexcept
+    {
+      return !handle || handle.done();
+    }
+
+    //*************************************************************************
+    /// Checks if the coroutine can be resumed.
+    //*************************************************************************
+    bool is_ready() const
+    {
+      return !done() && handle.promise().is_ready();
+    }
+
+    //*************************************************************************
+    /// Resumes the coroutine until it next suspends.
+    //*************************************************************************
+    void resume()
+    {
+      if (!done())
+      {
+        handle.promise().clear_wait();
+        handle.resume();
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    explicit co_task(handle_type handle_) noexcept
+      : handle(handle_)
+    {
+    }
+
+    //*************************************************************************
+    void destroy() noexcept
+    {
+      if (handle)
+      {
+        handle.destroy();
+        handle = handle_type();
+      }
+    }
+
+    co_task(const co_task&) = delete;
+    co_task& operator =(const co_task&) = delete;
+
+    handle_type handle;
+
+    static inline etl::ipool* p_frame_pool = ETL_NULLPTR;
+  };
+
+  //***************************************************************************
+  /// A task that runs a coroutine.
+  /// Reports work when its coroutine can be resumed, and resumes it when
+  /// called to process work.
+  //***************************************************************************
+  class coroutine_task : public etl::task
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    coroutine_task(etl::task_priority_t priority, etl::co_task&& coroutine_)
+      : etl::task(priority)
+      , coroutine(etl::move(coroutine_))
+    {
+      ETL_ASSERT(coroutine.is_valid(), ETL_ERROR(etl::coroutine_task_no_frame));
+    }
+
+    //*************************************************************************
+    /// Returns 1 if the coroutine can be resumed, otherwise 0.
+    //*************************************************************************
+    uint32_t task_request_work() const override
+    {
+      return coroutine.is_ready() ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Resumes the coroutine until its next co_await.
+    //*************************************************************************
+    void task_process_work() override
+    {
+      coroutine.resume();
+    }
+
+    //*************************************************************************
+    /// Checks if the coroutine has finished.
+    //*************************************************************************
+    bool done() const
+    {
+      return coroutine.done();
+    }
+
+  private:
+
+    etl::co_task coroutine;
+  };
+
+  namespace private_coroutine_task
+  {
+    //*************************************************************************
+    /// The common part of the awaiters.
+    /// TAwaiter must have a 'bool is_ready() const' member.
+    //*************************************************************************
+    template <typename TAwaiter>
+    struct awaiter_base
+    {
+      bool await_ready() const
+      {
+        return static_cast<const TAwaiter&>(*this).is_ready();
+      }
+
+      void await_suspend(etl::co_task::handle_type handle) noexcept
+      {
+        handle.promise().wait_for(&ready, static_cast<const TAwaiter*>(this));
+      }
+
+    private:
+
+      static bool ready(const void* p_awaiter)
+      {
+        return static_cast<const TAwaiter*>(p_awaiter)->is_ready();
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Suspends the coroutine until the scheduler next calls it.
+  /// co_await etl::co_reschedule();
+  //***************************************************************************
+  struct co_reschedule
+  {
+    bool await_ready() const noexcept
+    {
+      return false;
+    }
+
+    void await_suspend(etl::co_task::handle_type) noexcept
+    {
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Suspends the coroutine until the predicate returns true.
+  /// co_await etl::co_wait_until([&] { return button.pressed(); });
+  //***************************************************************************
+  template <typename TPredicate>
+  struct co_wait_until : public private_coroutine_task::awaiter_base<co_wait_until<TPredicate> >
+  {
+    explicit co_wait_until(TPredicate predicate_)
+      : predicate(etl::move(predicate_))
+    {
+    }
+
+    bool is_ready() const
+    {
+      return predicate();
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+    TPredicate predicate;
+  };
+
+  //***************************************************************************
+  /// Suspends the coroutine until a number of ticks have passed.
+  /// 'now' is a tick counter, such as one incremented by a timer interrupt.
+  /// Unsigned counters may wrap.
+  /// co_await etl::co_delay(systick_count, 100U);
+  //***************************************************************************
+  template <typename TTick>
+  struct co_delay : public private_coroutine_task::awaiter_base<co_delay<TTick> >
+  {
+    co_delay(const volatile TTick& now_, TTick ticks_)
+      : now(now_)
+      , start(now_)
+      , ticks(ticks_)
+    {
+    }
+
+    bool is_ready() const
+    {
+      return static_cast<TTick>(now - start) >= ticks;
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+    const volatile TTick& now;
+    const TTick           start;
+    const TTick           ticks;
+  };
+
+  //***************************************************************************
+  /// Suspends the coroutine until the queue has a value, then pops it.
+  /// TQueue must have empty(), front() and pop(), such as etl::queue or
+  /// etl::queue_spsc_atomic.
+  /// value_type value = co_await etl::co_pop(queue);
+  //***************************************************************************
+  template <typename TQueue>
+  struct co_pop : public private_coroutine_task::awaiter_base<co_pop<TQueue> >
+  {
+    explicit co_pop(TQueue& queue_)
+      : queue(queue_)
+    {
+    }
+
+    bool is_ready() const
+    {
+      return !queue.empty();
+    }
+
+    typename TQueue::value_type await_resume()
+    {
+      typename TQueue::value_type value = etl::move(queue.front());
+      queue.pop();
+
+      return value;
+    }
+
+    TQueue& queue;
+  };
+}
+
+#endif
+#endif
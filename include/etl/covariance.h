@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_sums.h"
 
 #include <stdint.h>
 
@@ -131,9 +133,18 @@ namespace etl
     //*********************************
     void add(TInput value1, TInput value2)
     {
-      inner_product += TCalc(value1 * value2);
-      sum1          += TCalc(value1);
-      sum2          += TCalc(value2);
+      if (counter == 0U)
+      {
+        shift1 = private_statistics::get_shift<calc_t>(value1);
+        shift2 = private_statistics::get_shift<calc_t>(value2);
+      }
+
+      const calc_t deviation1 = calc_t(value1) - shift1;
+      const calc_t deviation2 = calc_t(value2) - shift2;
+
+      inner_product += deviation1 * deviation2;
+      sum1          += deviation1;
+      sum2          += deviation2;
       ++counter;
       recalculate = true;
     }
@@ -152,6 +163,32 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a pair of spans of values.
+    /// values2 must be at least as long as values1.
+    /// Faster than adding the values one pair at a time.
+    //*********************************
+    void add(etl::span<const TInput> values1, etl::span<const TInput> values2)
+    {
+      if (values1.empty())
+      {
+        return;
+      }
+
+      if (counter == 0U)
+      {
+        shift1 = private_statistics::get_shift<calc_t>(values1[0]);
+        shift2 = private_statistics::get_shift<calc_t>(values2[0]);
+      }
+
+      private_statistics::accumulate_products(values1.data(), values2.data(), values1.size(),
+                                              shift1, shift2,
+                                              sum1, sum2, inner_product);
+
+      counter += uint32_t(values1.size());
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -171,6 +208,15 @@ namespace etl
       add(first1, last1, first2);
     }
 
+    //*********************************
+    /// operator ()
+    /// Add a pair of spans of values.
+    //*********************************
+    void operator ()(etl::span<const TInput> values1, etl::span<const TInput> values2)
+    {
+      add(values1, values2);
+    }
+
     //*********************************
     /// Get the covariance.
     //*********************************
@@ -218,6 +264,8 @@ namespace etl
       inner_product    = calc_t(0);
       sum1             = calc_t(0);
       sum2             = calc_t(0);
+      shift1           = calc_t(0);
+      shift2           = calc_t(0);
       counter          = 0U;
       covariance_value = 0.0;
       recalculate      = true;
@@ -228,6 +276,8 @@ namespace etl
     calc_t   inner_product;
     calc_t   sum1;
     calc_t   sum2;
+    calc_t   shift1;
+    calc_t   shift2;
     uint32_t counter;
     mutable double covariance_value;
     mutable bool   recalculate;
@@ -0,0 +1,245 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CPU_FEATURES_INCLUDED
+#define ETL_CPU_FEATURES_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+
+//*****************************************************************************
+/// Run time CPU feature detection, for kernels that select their code path
+/// when first called rather than when compiled.
+///  - x86:    cpuid, with xgetbv to check that the OS saves the AVX registers.
+///  - Others: the instruction sets the target was compiled for.
+/// A feature that the target was compiled for is always reported as present.
+/// ETL_HAS_CPUID is 1 if the features are detected at run time.
+//*****************************************************************************
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+  #include <cpuid.h>
+  #define ETL_HAS_CPUID 1
+  #define ETL_CPUID_USING_GCC
+#elif defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+  #include <intrin.h>
+  #define ETL_HAS_CPUID 1
+  #define ETL_CPUID_USING_MSVC
+#else
+  #define ETL_HAS_CPUID 0
+#endif
+
+//*****************************************************************************
+/// Marks a function as compiled for an instruction set that the rest of the
+/// translation unit is not, so that it may be selected at run time.
+/// e.g. ETL_CPU_TARGET("avx2") void sum_avx2(const int* p, size_t n);
+/// Empty for compilers that do not support it.
+//*****************************************************************************
+#if !defined(ETL_CPU_TARGET)
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+    #define ETL_CPU_TARGET(name) __attribute__((target(name)))
+  #else
+    #define ETL_CPU_TARGET(name)
+  #endif
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The instruction set extensions available on the CPU.
+  //***************************************************************************
+  struct cpu_features
+  {
+    bool sse2;
+    bool ssse3;
+    bool sse42;
+    bool pclmul;
+    bool avx2;
+    bool neon;
+    bool mve;
+    bool arm_dsp;
+    bool arm_crc32;
+    bool arm_pmull;
+  };
+
+  namespace private_cpu_features
+  {
+#if ETL_HAS_CPUID
+    //*************************************************************************
+    /// Runs cpuid for a leaf and sub-leaf.
+    /// Returns false if the leaf is not supported.
+    //*************************************************************************
+    inline bool cpuid(uint32_t leaf, uint32_t subleaf, uint32_t (&regs)[4])
+    {
+  #if defined(ETL_CPUID_USING_GCC)
+      if (__get_cpuid_max(0U, ETL_NULLPTR) < leaf)
+      {
+        return false;
+      }
+
+      __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+  #else
+      int info[4];
+
+      __cpuid(info, 0);
+
+      if (static_cast<uint32_t>(info[0]) < leaf)
+      {
+        return false;
+      }
+
+      __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+
+      regs[0] = static_cast<uint32_t>(info[0]);
+      regs[1] = static_cast<uint32_t>(info[1]);
+      regs[2] = static_cast<uint32_t>(info[2]);
+      regs[3] = static_cast<uint32_t>(info[3]);
+  #endif
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads the low word of the extended control register XCR0.
+    /// Only valid if cpuid reports OSXSAVE.
+    //*************************************************************************
+    inline uint32_t read_xcr0()
+    {
+  #if defined(ETL_CPUID_USING_GCC)
+      uint32_t eax;
+      uint32_t edx;
+      __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0U));
+
+      return eax;
+  #else
+      return static_cast<uint32_t>(_xgetbv(0U));
+  #endif
+    }
+#endif
+
+    //*************************************************************************
+    /// Detects the features.
+    //*************************************************************************
+    inline etl::cpu_features detect()
+    {
+      etl::cpu_features features;
+
+      features.sse2      = etl::traits::using_sse2;
+      features.ssse3     = etl::traits::using_ssse3;
+      features.sse42     = etl::traits::using_sse42;
+      features.pclmul    = etl::traits::using_pclmul;
+      features.avx2      = etl::traits::using_avx2;
+      features.neon      = etl::traits::using_neon;
+      features.mve       = etl::traits::using_mve;
+      features.arm_dsp   = etl::traits::using_arm_dsp;
+      features.arm_crc32 = etl::traits::using_arm_crc32;
+      features.arm_pmull = etl::traits::using_arm_pmull;
+
+#if ETL_HAS_CPUID
+      uint32_t regs[4];
+
+      if (cpuid(1U, 0U, regs))
+      {
+        const uint32_t ecx = regs[2];
+        const uint32_t edx = regs[3];
+
+        features.sse42  = features.sse42  || ((ecx & (1UL << 20U)) != 0U);
+        features.pclmul = features.pclmul || ((ecx & (1UL << 1U))  != 0U);
+
+  #if !defined(ETL_NO_SIMD)
+        features.sse2   = features.sse2   || ((edx & (1UL << 26U)) != 0U);
+        features.ssse3  = features.ssse3  || ((ecx & (1UL << 9U))  != 0U);
+
+        // AVX2 also needs the OS to save the YMM registers.
+        const bool os_saves_ymm = ((ecx & (1UL << 27U)) != 0U) && // OSXSAVE
+                                  ((ecx & (1UL << 28U)) != 0U) && // AVX
+                                  ((read_xcr0() & 0x06U) == 0x06U);
+
+        if (os_saves_ymm && cpuid(7U, 0U, regs))
+        {
+          features.avx2 = features.avx2 || ((regs[1] & (1UL << 5U)) != 0U);
+        }
+  #else
+        (void)edx;
+  #endif
+      }
+#endif
+
+      return features;
+    }
+  }
+
+  //***************************************************************************
+  /// Gets the features of the CPU.
+  /// Detected on the first call and cached.
+  //***************************************************************************
+  inline const etl::cpu_features& get_cpu_features()
+  {
+    static const etl::cpu_features features = private_cpu_features::detect();
+
+    return features;
+  }
+
+  //***************************************************************************
+  /// Selects a kernel for the CPU on the first call and caches it.
+  /// TFunction is the function pointer type.
+  /// Resolver returns the kernel to use for the features.
+  /// e.g.
+  /// sum_t resolve_sum(const etl::cpu_features& f) { return f.avx2 ? sum_avx2 : sum_scalar; }
+  /// int total = etl::cpu_dispatch<sum_t, resolve_sum>::get()(p, n);
+  //***************************************************************************
+  template <typename TFunction, TFunction (*Resolver)(const etl::cpu_features&)>
+  class cpu_dispatch
+  {
+  public:
+
+    typedef TFunction function_type;
+
+    //*********************************
+    /// Gets the kernel.
+    //*********************************
+    static function_type get()
+    {
+      static const function_type function = Resolver(etl::get_cpu_features());
+
+      return function;
+    }
+  };
+
+  namespace traits
+  {
+    static ETL_CONSTANT bool has_cpuid = (ETL_HAS_CPUID == 1);
+  }
+}
+
+#undef ETL_CPUID_USING_GCC
+#undef ETL_CPUID_USING_MSVC
+
+#endif
@@ -0,0 +1,394 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CUCKOO_FILTER_INCLUDED
+#define ETL_CUCKOO_FILTER_INCLUDED
+
+#include "platform.h"
+#include "parameter_type.h"
+#include "bloom_filter.h"
+#include "power.h"
+#include "smallest.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+///\defgroup cuckoo_filter cuckoo_filter
+/// A cuckoo filter.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A cuckoo filter.
+  /// Stores a fingerprint of each key in one of two buckets of four slots,
+  /// moving fingerprints to their alternate bucket to make room.
+  /// Unlike a Bloom filter, keys may be removed, and for false positive rates
+  /// under about 3% it uses fewer bits per key.
+  /// The false positive rate is about 8 / 2^Fingerprint_Bits.
+  /// A key added more than once must be removed as many times, and only keys
+  /// that were added may be removed.
+  /// The hash is mixed first, so simple hashes such as the identity are acceptable.
+  ///\tparam N                The number of keys that the filter must be able to hold.
+  ///\tparam Fingerprint_Bits The number of bits in each fingerprint. 4 to 16.
+  ///\tparam THash            The hash generator class. Must define <b>argument_type</b>.
+  ///\ingroup cuckoo_filter
+  //***************************************************************************
+  template <size_t   N,
+            size_t   Fingerprint_Bits,
+            typename THash>
+  class cuckoo_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+    typedef private_bloom_filter::hash_type hash_type;
+    typedef typename etl::smallest_uint_for_bits<Fingerprint_Bits>::type fingerprint_type;
+
+    ETL_STATIC_ASSERT(N > 0U, "Zero capacity");
+    ETL_STATIC_ASSERT((Fingerprint_Bits >= 4U) && (Fingerprint_Bits <= 16U), "Fingerprint_Bits must be 4 to 16");
+
+    static ETL_CONSTANT size_t Bucket_Size = 4U;
+    static ETL_CONSTANT size_t Max_Kicks   = 500U;
+
+    /// Allows for a load factor of 95%.
+    static ETL_CONSTANT size_t Min_Buckets = (N + (N / 19U) + Bucket_Size) / Bucket_Size;
+
+  public:
+
+    /// The number of buckets. A power of 2, so the alternate bucket may be found from either.
+    static ETL_CONSTANT size_t BUCKETS = etl::power_of_2_round_up<Min_Buckets>::value;
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    cuckoo_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < (BUCKETS * Bucket_Size); ++i)
+      {
+        slots[i] = 0U;
+      }
+
+      number_of_keys = 0U;
+      victim_used    = false;
+      victim_index   = 0U;
+      victim         = 0U;
+      random         = 0x9E3779B9UL;
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param  key The key to add.
+    ///\return <b>true</b> if the key was added, <b>false</b> if the filter is full.
+    //***************************************************************************
+    bool add(parameter_t key)
+    {
+      if (victim_used)
+      {
+        return false;
+      }
+
+      const hash_type hash = get_hash(key);
+
+      insert(get_index(hash), get_fingerprint(hash));
+      ++number_of_keys;
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    ///\param  key The key to remove.
+    ///\return <b>true</b> if the key existed in the filter and was removed.
+    //***************************************************************************
+    bool remove(parameter_t key)
+    {
+      const hash_type        hash        = get_hash(key);
+      const fingerprint_type fingerprint = get_fingerprint(hash);
+      const size_t           index1      = get_index(hash);
+      const size_t           index2      = get_alternate_index(index1, fingerprint);
+
+      if (erase_from(index1, fingerprint) || erase_from(index2, fingerprint))
+      {
+        --number_of_keys;
+
+        // There is now room for the victim.
+        if (victim_used)
+        {
+          victim_used = false;
+          insert(victim_index, victim);
+        }
+
+        return true;
+      }
+
+      if (victim_used && (victim == fingerprint) && ((victim_index == index1) || (victim_index == index2)))
+      {
+        victim_used = false;
+        --number_of_keys;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      const hash_type        hash        = get_hash(key);
+      const fingerprint_type fingerprint = get_fingerprint(hash);
+      const size_t           index1      = get_index(hash);
+      const size_t           index2      = get_alternate_index(index1, fingerprint);
+
+      if (victim_used && (victim == fingerprint) && ((victim_index == index1) || (victim_index == index2)))
+      {
+        return true;
+      }
+
+      return contains(index1, fingerprint) || contains(index2, fingerprint);
+    }
+
+    //***************************************************************************
+    /// Returns the number of keys in the filter.
+    //***************************************************************************
+    size_t size() const
+    {
+      return number_of_keys;
+    }
+
+    //***************************************************************************
+    /// Returns the number of keys that the filter was sized for.
+    //***************************************************************************
+    size_t capacity() const
+    {
+      return N;
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if the filter is empty.
+    //***************************************************************************
+    bool empty() const
+    {
+      return number_of_keys == 0U;
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if the filter is full.
+    /// A filter becomes full when a fingerprint cannot be moved to a free slot.
+    /// This is rare below the capacity.
+    //***************************************************************************
+    bool full() const
+    {
+      return victim_used;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of slots used. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100U * number_of_keys) / (BUCKETS * Bucket_Size);
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Gets the mixed hash for the key.
+    //***************************************************************************
+    static hash_type get_hash(parameter_t key)
+    {
+      return private_bloom_filter::mix_hash(hash_type(THash()(key)));
+    }
+
+    //***************************************************************************
+    /// The bucket index, from the lower bits of the hash.
+    //***************************************************************************
+    static size_t get_index(hash_type hash)
+    {
+      return size_t(hash) & (BUCKETS - 1U);
+    }
+
+    //***************************************************************************
+    /// The fingerprint, from the upper bits of the hash. Never zero, as zero
+    /// marks an empty slot.
+    //***************************************************************************
+    static fingerprint_type get_fingerprint(hash_type hash)
+    {
+      const fingerprint_type fingerprint = fingerprint_type(hash >> ((sizeof(hash_type) * 8U) - Fingerprint_Bits));
+
+      return (fingerprint == 0U) ? fingerprint_type(1U) : fingerprint;
+    }
+
+    //***************************************************************************
+    /// The other bucket for a fingerprint. Each bucket is the alternate of the other.
+    //***************************************************************************
+    static size_t get_alternate_index(size_t index, fingerprint_type fingerprint)
+    {
+      return (index ^ size_t(uint32_t(fingerprint) * 0x5BD1E995UL)) & (BUCKETS - 1U);
+    }
+
+    //***************************************************************************
+    /// Inserts a fingerprint at index or its alternate, moving others if both
+    /// buckets are full. The fingerprint left over after Max_Kicks moves is kept
+    /// as the victim.
+    //***************************************************************************
+    void insert(size_t index, fingerprint_type fingerprint)
+    {
+      if (insert_into(index, fingerprint))
+      {
+        return;
+      }
+
+      index = get_alternate_index(index, fingerprint);
+
+      for (size_t kick = 0U; kick < Max_Kicks; ++kick)
+      {
+        if (insert_into(index, fingerprint))
+        {
+          return;
+        }
+
+        // Swap with a random slot, and move its fingerprint to its alternate bucket.
+        fingerprint_type&      slot    = slots[(index * Bucket_Size) + (next_random() % Bucket_Size)];
+        const fingerprint_type evicted = slot;
+        slot        = fingerprint;
+        fingerprint = evicted;
+
+        index = get_alternate_index(index, fingerprint);
+      }
+
+      victim_used  = true;
+      victim_index = index;
+      victim       = fingerprint;
+    }
+
+    //***************************************************************************
+    /// Inserts a fingerprint in a free slot of the bucket.
+    //***************************************************************************
+    bool insert_into(size_t index, fingerprint_type fingerprint)
+    {
+      fingerprint_type* p_bucket = slots + (index * Bucket_Size);
+
+      for (size_t i = 0U; i < Bucket_Size; ++i)
+      {
+        if (p_bucket[i] == 0U)
+        {
+          p_bucket[i] = fingerprint;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Erases one copy of a fingerprint from the bucket.
+    //***************************************************************************
+    bool erase_from(size_t index, fingerprint_type fingerprint)
+    {
+      fingerprint_type* p_bucket = slots + (index * Bucket_Size);
+
+      for (size_t i = 0U; i < Bucket_Size; ++i)
+      {
+        if (p_bucket[i] == fingerprint)
+        {
+          p_bucket[i] = 0U;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Tests the bucket for a fingerprint. Tests every slot, as the branch is unpredictable.
+    //***************************************************************************
+    bool contains(size_t index, fingerprint_type fingerprint) const
+    {
+      const fingerprint_type* p_bucket = slots + (index * Bucket_Size);
+
+      bool found = false;
+
+      for (size_t i = 0U; i < Bucket_Size; ++i)
+      {
+        found |= (p_bucket[i] == fingerprint);
+      }
+
+      return found;
+    }
+
+    //***************************************************************************
+    /// The xorshift32 generator, to choose the slot to move.
+    //***************************************************************************
+    uint32_t next_random()
+    {
+      random ^= random << 13U;
+      random ^= random >> 17U;
+      random ^= random << 5U;
+
+      return random;
+    }
+
+    fingerprint_type slots[BUCKETS * Bucket_Size];
+    size_t           number_of_keys;
+    size_t           victim_index;
+    fingerprint_type victim;
+    bool             victim_used;
+    uint32_t         random;
+  };
+
+  template <size_t N, size_t Fingerprint_Bits, typename THash>
+  ETL_CONSTANT size_t cuckoo_filter<N, Fingerprint_Bits, THash>::Bucket_Size;
+
+  template <size_t N, size_t Fingerprint_Bits, typename THash>
+  ETL_CONSTANT size_t cuckoo_filter<N, Fingerprint_Bits, THash>::Max_Kicks;
+
+  template <size_t N, size_t Fingerprint_Bits, typename THash>
+  ETL_CONSTANT size_t cuckoo_filter<N, Fingerprint_Bits, THash>::Min_Buckets;
+
+  template <size_t N, size_t Fingerprint_Bits, typename THash>
+  ETL_CONSTANT size_t cuckoo_filter<N, Fingerprint_Bits, THash>::BUCKETS;
+}
+
+#endif
@@ -0,0 +1,108 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CYCLE_COUNTER_INCLUDED
+#define ETL_CYCLE_COUNTER_INCLUDED
+
+#include "platform.h"
+
+#include <stdint.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <time.h>
+#endif
+
+//*****************************************************************************
+/// A free running 32 bit counter for timestamps and latency measurements.
+/// Defaults to the target's cycle counter, where one is known.
+///  - x86:       rdtsc.
+///  - AArch64:   cntvct_el0.
+///  - Cortex-M:  DWT CYCCNT, which the application must enable.
+///  - POSIX:     clock_gettime(CLOCK_MONOTONIC), in nanoseconds.
+/// Define ETL_CYCLE_COUNTER() to provide another source.
+/// ETL_HAS_CYCLE_COUNTER is 0 if there is no source.
+//*****************************************************************************
+#if !defined(ETL_CYCLE_COUNTER)
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+    #define ETL_CYCLE_COUNTER() static_cast<uint32_t>(__builtin_ia32_rdtsc())
+  #elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && defined(__aarch64__)
+    #define ETL_CYCLE_COUNTER() etl::private_cycle_counter::read_cntvct()
+  #elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+    #define ETL_CYCLE_COUNTER() (*reinterpret_cast<volatile uint32_t*>(0xE0001004UL))
+  #elif defined(__unix__) || defined(__APPLE__)
+    #define ETL_CYCLE_COUNTER() etl::private_cycle_counter::read_monotonic_clock()
+  #endif
+#endif
+
+#if defined(ETL_CYCLE_COUNTER)
+  #define ETL_HAS_CYCLE_COUNTER 1
+#else
+  #define ETL_HAS_CYCLE_COUNTER 0
+  #define ETL_CYCLE_COUNTER() 0U
+#endif
+
+namespace etl
+{
+  namespace private_cycle_counter
+  {
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && defined(__aarch64__)
+    //*************************************************************************
+    /// Reads the AArch64 virtual counter.
+    //*************************************************************************
+    inline uint32_t read_cntvct()
+    {
+      uint64_t value;
+      __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+
+      return static_cast<uint32_t>(value);
+    }
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+    //*************************************************************************
+    /// Reads the monotonic clock in nanoseconds.
+    //*************************************************************************
+    inline uint32_t read_monotonic_clock()
+    {
+      struct timespec now;
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      return static_cast<uint32_t>((static_cast<uint64_t>(now.tv_sec) * 1000000000ULL) + static_cast<uint64_t>(now.tv_nsec));
+    }
+#endif
+  }
+
+  namespace traits
+  {
+    static ETL_CONSTANT bool has_cycle_counter = (ETL_HAS_CYCLE_COUNTER == 1);
+  }
+}
+
+#endif
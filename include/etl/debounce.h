@@ -33,7 +33,11 @@ SOFTWARE.
 
 #include "platform.h"
 #include "static_assert.h"
+#include "log.h"
+#include "integral_limits.h"
+#include "type_traits.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace etl
@@ -582,6 +586,189 @@ namespace etl
     count_t hold_count;
     count_t repeat_count;
   };
+
+  //***************************************************************************
+  /// A bank of VInputs two state debouncers, for VInputs digital inputs.
+  /// An input changes state when it has differed from its state for
+  /// VValid_Count consecutive samples, as with etl::debounce<VValid_Count>.
+  /// The counters are bit sliced, as vertical counters, with each word of
+  /// inputs updated at once by bitwise operations. Bit 'b' of sample word
+  /// 'w' is input (w * bits in TWord) + b.
+  ///	param VInputs      The number of inputs.
+  ///	param VValid_Count The number of samples for a valid state.
+  ///	param TWord        The unsigned word type for the inputs. Default uint32_t.
+  //***************************************************************************
+  template <size_t VInputs, const uint16_t VValid_Count, typename TWord = uint32_t>
+  class debounce_bank
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VInputs > 0U, "Zero inputs");
+    ETL_STATIC_ASSERT(VValid_Count > 0U, "Zero valid count");
+    ETL_STATIC_ASSERT(etl::is_unsigned<TWord>::value, "The word type must be unsigned");
+
+    typedef TWord word_type;
+
+    static ETL_CONSTANT size_t Inputs       = VInputs;
+    static ETL_CONSTANT size_t Word_Bits    = etl::integral_limits<TWord>::bits;
+    static ETL_CONSTANT size_t Words        = (VInputs + Word_Bits - 1U) / Word_Bits;
+    static ETL_CONSTANT size_t Counter_Bits = etl::log2<VValid_Count>::value + 1U;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param initial_state The initial state of all inputs. Default = false.
+    //*************************************************************************
+    debounce_bank(bool initial_state = false)
+    {
+      reset(initial_state);
+    }
+
+    //*************************************************************************
+    /// Sets the state of all inputs and clears the counters.
+    //*************************************************************************
+    void reset(bool initial_state = false)
+    {
+      for (size_t w = 0U; w < Words; ++w)
+      {
+        state[w]   = initial_state ? word_mask(w) : TWord(0);
+        changed[w] = TWord(0);
+
+        for (size_t b = 0U; b < Counter_Bits; ++b)
+        {
+          counter[w][b] = TWord(0);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a new sample for every input.
+    ///\param samples Words words of samples.
+    ///\return 'true' if any input changed state.
+    //*************************************************************************
+    bool add(const TWord* samples)
+    {
+      TWord any = TWord(0);
+
+      for (size_t w = 0U; w < Words; ++w)
+      {
+        any |= add(w, samples[w]);
+      }
+
+      return (any != TWord(0));
+    }
+
+    //*************************************************************************
+    /// Adds a new sample for the inputs in one word.
+    ///\param w       The index of the word.
+    ///\param samples The samples.
+    ///\return The mask of the inputs that changed state.
+    //*************************************************************************
+    TWord add(size_t w, TWord samples)
+    {
+      TWord* c = counter[w];
+
+      // Count the inputs that differ from their state. Clear the others.
+      const TWord differs = (samples ^ state[w]) & word_mask(w);
+
+      TWord carry = differs;
+
+      for (size_t b = 0U; b < Counter_Bits; ++b)
+      {
+        const TWord next_carry = c[b] & carry;
+
+        c[b]  = (c[b] ^ carry) & differs;
+        carry = next_carry;
+      }
+
+      // The inputs whose counts have reached the valid count.
+      TWord valid = differs;
+
+      for (size_t b = 0U; b < Counter_Bits; ++b)
+      {
+        valid &= ((VValid_Count >> b) & 1U) ? c[b] : TWord(~c[b]);
+      }
+
+      for (size_t b = 0U; b < Counter_Bits; ++b)
+      {
+        c[b] &= TWord(~valid);
+      }
+
+      state[w]  ^= valid;
+      changed[w] = valid;
+
+      return valid;
+    }
+
+    //*************************************************************************
+    /// Gets the state of an input.
+    ///\return 'true' if the input is in the set state.
+    //*************************************************************************
+    bool is_set(size_t input) const
+    {
+      return (state[input / Word_Bits] & bit(input)) != TWord(0);
+    }
+
+    //*************************************************************************
+    /// Gets the change state of an input.
+    ///\return 'true' if the input changed state on the last sample.
+    //*************************************************************************
+    bool has_changed(size_t input) const
+    {
+      return (changed[input / Word_Bits] & bit(input)) != TWord(0);
+    }
+
+    //*************************************************************************
+    /// Gets the states of the inputs in a word.
+    //*************************************************************************
+    TWord get_state(size_t w) const
+    {
+      return state[w];
+    }
+
+    //*************************************************************************
+    /// Gets the mask of the inputs in a word that changed state on the last sample.
+    //*************************************************************************
+    TWord get_changed(size_t w) const
+    {
+      return changed[w];
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The mask of the inputs in a word.
+    //*************************************************************************
+    static TWord word_mask(size_t w)
+    {
+      const size_t used = VInputs - (w * Word_Bits);
+
+      return (used >= Word_Bits) ? TWord(~TWord(0)) : TWord((TWord(1) << used) - 1U);
+    }
+
+    //*************************************************************************
+    /// The bit for an input, in its word.
+    //*************************************************************************
+    static TWord bit(size_t input)
+    {
+      return TWord(TWord(1) << (input % Word_Bits));
+    }
+
+    TWord state[Words];
+    TWord changed[Words];
+    TWord counter[Words][Counter_Bits];
+  };
+
+  template <size_t VInputs, const uint16_t VValid_Count, typename TWord>
+  ETL_CONSTANT size_t debounce_bank<VInputs, VValid_Count, TWord>::Inputs;
+
+  template <size_t VInputs, const uint16_t VValid_Count, typename TWord>
+  ETL_CONSTANT size_t debounce_bank<VInputs, VValid_Count, TWord>::Word_Bits;
+
+  template <size_t VInputs, const uint16_t VValid_Count, typename TWord>
+  ETL_CONSTANT size_t debounce_bank<VInputs, VValid_Count, TWord>::Words;
+
+  template <size_t VInputs, const uint16_t VValid_Count, typename TWord>
+  ETL_CONSTANT size_t debounce_bank<VInputs, VValid_Count, TWord>::Counter_Bits;
 }
 
 #endif
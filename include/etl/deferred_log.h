@@ -0,0 +1,405 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DEFERRED_LOG_INCLUDED
+#define ETL_DEFERRED_LOG_INCLUDED
+
+#include "platform.h"
+#include "bip_buffer_spsc_atomic.h"
+
+#if ETL_HAS_ATOMIC && ETL_USING_CPP11
+
+#include "atomic.h"
+#include "span.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "memory_model.h"
+#include "utility.h"
+#include "format.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup deferred_log deferred_log
+/// A logger that captures a message ID and the raw bytes of its arguments,
+/// leaving the formatting until later, off the time critical path, or to a host.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup deferred_log
+  /// The header of each record in the log buffer.
+  /// A record is the header followed by the bytes of each argument, in order,
+  /// in native byte order and without padding.
+  //***************************************************************************
+  struct deferred_log_header
+  {
+    uint16_t id;     ///< The message ID.
+    uint16_t length; ///< The number of bytes of arguments that follow.
+  };
+
+  //***************************************************************************
+  ///\ingroup deferred_log
+  /// A record read from the log.
+  //***************************************************************************
+  class deferred_log_record
+  {
+  public:
+
+    //*********************************
+    deferred_log_record()
+      : record_id(0U)
+      , record_arguments()
+    {
+    }
+
+    //*********************************
+    deferred_log_record(uint16_t id_, etl::span<const char> arguments_)
+      : record_id(id_)
+      , record_arguments(arguments_)
+    {
+    }
+
+    //*********************************
+    /// The message ID.
+    //*********************************
+    uint16_t id() const
+    {
+      return record_id;
+    }
+
+    //*********************************
+    /// The bytes of the arguments.
+    //*********************************
+    etl::span<const char> arguments() const
+    {
+      return record_arguments;
+    }
+
+  private:
+
+    uint16_t              record_id;
+    etl::span<const char> record_arguments;
+  };
+
+  namespace private_deferred_log
+  {
+    //*********************************
+    template <typename... TArgs>
+    struct total_size;
+
+    template <>
+    struct total_size<>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <typename T, typename... TArgs>
+    struct total_size<T, TArgs...>
+    {
+      static ETL_CONSTANT size_t value = sizeof(T) + total_size<TArgs...>::value;
+    };
+
+    //*********************************
+    /// The offset of argument Index in a record.
+    //*********************************
+    template <size_t Index, typename... TArgs>
+    struct offset_of;
+
+    template <typename T, typename... TArgs>
+    struct offset_of<0U, T, TArgs...>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <size_t Index, typename T, typename... TArgs>
+    struct offset_of<Index, T, TArgs...>
+    {
+      static ETL_CONSTANT size_t value = sizeof(T) + offset_of<Index - 1U, TArgs...>::value;
+    };
+
+    //*********************************
+    template <typename... TArgs>
+    struct are_trivially_copyable;
+
+    template <>
+    struct are_trivially_copyable<>
+    {
+      static ETL_CONSTANT bool value = true;
+    };
+
+    template <typename T, typename... TArgs>
+    struct are_trivially_copyable<T, TArgs...>
+    {
+      static ETL_CONSTANT bool value = etl::is_trivially_copyable<T>::value && !etl::is_array<T>::value && are_trivially_copyable<TArgs...>::value;
+    };
+
+    //*********************************
+    inline char* write_arguments(char* p)
+    {
+      return p;
+    }
+
+    template <typename T, typename... TArgs>
+    char* write_arguments(char* p, const T& value, const TArgs&... args)
+    {
+      memcpy(p, &value, sizeof(T));
+
+      return write_arguments(p + sizeof(T), args...);
+    }
+
+    //*********************************
+    template <typename T>
+    T read_argument(const char* p)
+    {
+      T value;
+      memcpy(&value, p, sizeof(T));
+
+      return value;
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup deferred_log
+  /// A deferred logger for one producer and one consumer.
+  /// log() copies the message ID and the arguments into the buffer, and
+  /// costs no more than a reserve, a copy and a commit. If the buffer has no
+  /// room, the record is dropped and counted.
+  /// The consumer reads the records with front() and pop(), and may format
+  /// them with etl::deferred_log_message, or pass the bytes to a host.
+  /// Arguments must be trivially copyable. Pointers, including strings, are
+  /// captured as pointers, so must still be valid when the record is read.
+  /// \tparam Memory_Model The memory model of the bip buffer.
+  //***************************************************************************
+  template <const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class deferred_logger
+  {
+  public:
+
+    typedef etl::ibip_buffer_spsc_atomic<char, Memory_Model> buffer_type;
+    typedef typename buffer_type::size_type                  size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit deferred_logger(buffer_type& buffer_)
+      : buffer(buffer_)
+      , dropped(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Logs a message ID and its arguments.
+    /// Call from the producer only.
+    /// \return true if logged, false if dropped because the buffer was full.
+    //*************************************************************************
+    template <typename... TArgs>
+    bool log(uint16_t id, const TArgs&... args)
+    {
+      ETL_STATIC_ASSERT((private_deferred_log::are_trivially_copyable<TArgs...>::value), "Arguments must be trivially copyable");
+
+      static ETL_CONSTANT size_t Arguments_Size = private_deferred_log::total_size<TArgs...>::value;
+      static ETL_CONSTANT size_t Record_Size    = sizeof(deferred_log_header) + Arguments_Size;
+
+      ETL_STATIC_ASSERT(Arguments_Size <= etl::integral_limits<uint16_t>::max, "Arguments too large");
+
+      etl::span<char> reserve = buffer.write_reserve_optimal(size_type(Record_Size));
+
+      if (reserve.size() < Record_Size)
+      {
+        dropped.fetch_add(1U, etl::memory_order_relaxed);
+        return false;
+      }
+
+      const deferred_log_header header = { id, uint16_t(Arguments_Size) };
+
+      memcpy(reserve.data(), &header, sizeof(header));
+      private_deferred_log::write_arguments(reserve.data() + sizeof(header), args...);
+
+      buffer.write_commit(reserve.first(Record_Size));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the oldest record, without removing it.
+    /// Call from the consumer only.
+    /// \return false if there are no records.
+    //*************************************************************************
+    bool front(deferred_log_record& record)
+    {
+      etl::span<char> reserve = buffer.read_reserve();
+
+      if (reserve.size() < sizeof(deferred_log_header))
+      {
+        return false;
+      }
+
+      deferred_log_header header;
+      memcpy(&header, reserve.data(), sizeof(header));
+
+      record = deferred_log_record(header.id, etl::span<const char>(reserve.data() + sizeof(header), header.length));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes the oldest record.
+    /// Call from the consumer only.
+    //*************************************************************************
+    void pop()
+    {
+      etl::span<char> reserve = buffer.read_reserve();
+
+      if (reserve.size() >= sizeof(deferred_log_header))
+      {
+        deferred_log_header header;
+        memcpy(&header, reserve.data(), sizeof(header));
+
+        buffer.read_commit(reserve.first(sizeof(header) + header.length));
+      }
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no records.
+    //*************************************************************************
+    bool empty() const
+    {
+      return buffer.empty();
+    }
+
+    //*************************************************************************
+    /// The number of records dropped because the buffer was full.
+    //*************************************************************************
+    size_t dropped_count() const
+    {
+      return dropped.load(etl::memory_order_relaxed);
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    deferred_logger(const deferred_logger&) ETL_DELETE;
+    deferred_logger& operator =(const deferred_logger&) ETL_DELETE;
+
+    buffer_type&        buffer;
+    etl::atomic<size_t> dropped;
+  };
+
+#if ETL_USING_CPP14
+  //***************************************************************************
+  ///\ingroup deferred_log
+  /// A log message with its ID, argument types and format string.
+  /// \code
+  /// constexpr etl::deferred_log_message<int, float> Speed(1U, "Motor {} speed {:.1f}");
+  ///
+  /// Speed.log(logger, motor, speed);  // Producer
+  ///
+  /// Speed.format(text, record);       // Consumer
+  /// \endcode
+  //***************************************************************************
+  template <typename... TArgs>
+  class deferred_log_message
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    constexpr deferred_log_message(uint16_t id_, const etl::format_string<TArgs...>& format_)
+      : message_id(id_)
+      , message_format(format_)
+    {
+    }
+
+    //*************************************************************************
+    /// The message ID.
+    //*************************************************************************
+    constexpr uint16_t id() const
+    {
+      return message_id;
+    }
+
+    //*************************************************************************
+    /// Logs the message. Call from the producer only.
+    /// \return true if logged, false if dropped because the buffer was full.
+    //*************************************************************************
+    template <size_t Memory_Model>
+    bool log(etl::deferred_logger<Memory_Model>& logger, const etl::type_identity_t<TArgs>&... args) const
+    {
+      return logger.log(message_id, args...);
+    }
+
+    //*************************************************************************
+    /// Returns true if the record holds this message.
+    //*************************************************************************
+    bool is_for(const etl::deferred_log_record& record) const
+    {
+      return (record.id() == message_id) &&
+             (record.arguments().size() == private_deferred_log::total_size<TArgs...>::value);
+    }
+
+    //*************************************************************************
+    /// Appends the formatted message to str.
+    /// \return false, leaving str unchanged, if the record is for a different message.
+    //*************************************************************************
+    bool format(etl::istring& str, const etl::deferred_log_record& record) const
+    {
+      if (!is_for(record))
+      {
+        return false;
+      }
+
+      format_arguments(str, record.arguments().data(), etl::make_index_sequence<sizeof...(TArgs)>());
+
+      return true;
+    }
+
+  private:
+
+    //*************************************************************************
+    template <size_t... Indices>
+    void format_arguments(etl::istring& str, const char* p, etl::index_sequence<Indices...>) const
+    {
+      (void)p;
+
+      etl::format_to(str, message_format, private_deferred_log::read_argument<TArgs>(p + private_deferred_log::offset_of<Indices, TArgs...>::value)...);
+    }
+
+    uint16_t                      message_id;
+    etl::format_string<TArgs...> message_format;
+  };
+#endif
+}
+
+#endif
+#endif
@@ -72,6 +72,14 @@ namespace etl
 
   //*********************************************************************
   /// The object that is being observed.
+  /// Observers are etl::delegate<void(TNotification)>, held contiguously, so
+  /// that notification is a loop of indirect calls with no virtual dispatch.
+  /// Enabled observers are kept at the front of the list, so disabled
+  /// observers cost nothing to skip.
+  /// Adding an observer returns a handle. Removing, enabling or disabling by
+  /// handle is O(1); observers are swapped rather than shifted, so the order
+  /// of notification is not the order in which they were added.
+  ///\tparam TNotification The notification type.
   ///\tparam MAX_OBSERVERS The maximum number of observers that can be accommodated.
   ///\ingroup observer
   //*********************************************************************
@@ -84,66 +92,105 @@ namespace etl
 
   private:
 
-    //***********************************
-    // Item stored in the observer list.
-    //***********************************
-    struct observer_item
+    typedef etl::vector<observer_type, MAX_OBSERVERS> Observer_List;
+
+  public:
+
+    typedef size_t        size_type;
+    typedef TNotification notification_type;
+
+    //*****************************************************************
+    /// Identifies an observer in the list.
+    /// Stays valid until the observer is removed or the list is cleared,
+    /// after which it may be reused for another observer.
+    //*****************************************************************
+    class handle
     {
-      observer_item(observer_type observer_)
-        : observer(observer_)
-        , enabled(true)
+    public:
+
+      //***************************************
+      /// Constructs an invalid handle.
+      //***************************************
+      handle()
+        : index(MAX_OBSERVERS)
       {
       }
 
-      observer_type observer;
-      bool          enabled;
-    };
+      //***************************************
+      /// Was the handle returned for an observer?
+      //***************************************
+      bool is_valid() const
+      {
+        return index < MAX_OBSERVERS;
+      }
 
-    //***********************************
-    // How to compare an observer with an observer list item.
-    //***********************************
-    struct compare_observers
-    {
-      compare_observers(observer_type& observer_)
-        : observer(&observer_)
+      friend bool operator ==(const handle& lhs, const handle& rhs)
       {
+        return lhs.index == rhs.index;
       }
 
-      bool operator ()(const observer_item& item) const
+      friend bool operator !=(const handle& lhs, const handle& rhs)
       {
-        return observer == item.observer;
+        return lhs.index != rhs.index;
       }
 
-      observer_type observer;
-    };
+    private:
 
-    typedef etl::vector<observer_item, MAX_OBSERVERS> Observer_List;
+      friend class delegate_observable;
 
-  public:
+      explicit handle(size_type index_)
+        : index(index_)
+      {
+      }
 
-    typedef size_t        size_type;
-    typedef TNotification notification_type;
+      size_type index;
+    };
+
+    //*****************************************************************
+    /// Constructor.
+    //*****************************************************************
+    delegate_observable()
+      : number_enabled(0U)
+    {
+      for (size_type i = 0U; i < MAX_OBSERVERS; ++i)
+      {
+        handles[i]   = i;
+        positions[i] = i;
+      }
+    }
 
     //*****************************************************************
     /// Add an observer to the list.
-    /// If asserts or exceptions are enabled then an etl::observable_observer_list_full
+    /// The observer is enabled.
+    /// If asserts or exceptions are enabled then an etl::delegate_observer_list_full
     /// is emitted if the observer list is already full.
     ///\param observer A reference to the observer.
+    ///\return The handle of the observer, or an invalid handle if the list is full.
+    /// If the observer is already in the list then its existing handle is returned.
     //*****************************************************************
-    void add_observer(observer_type& observer)
+    handle add_observer(const observer_type& observer)
     {
-		  // See if we already have it in our list.
-      typename Observer_List::iterator i_observer_item = find_observer(observer);
+      // See if we already have it in our list.
+      typename Observer_List::iterator i_observer = find_observer(observer);
 
-		  // Not there?
-      if (i_observer_item == observer_list.end())
+      // Already there?
+      if (i_observer != observer_list.end())
       {
-        // Is there enough room?
-        ETL_ASSERT_OR_RETURN(!observer_list.full(), ETL_ERROR(etl::observer_list_full));
-
-        // Add it.
-        observer_list.push_back(observer_item(observer));
+        return handle(handles[etl::distance(observer_list.begin(), i_observer)]);
       }
+
+      // Is there enough room?
+      ETL_ASSERT_OR_RETURN_VALUE(!observer_list.full(), ETL_ERROR(etl::delegate_observer_list_full), handle());
+
+      const size_type position = observer_list.size();
+
+      observer_list.push_back(observer);
+
+      // Swap it with the first disabled observer.
+      swap_positions(position, number_enabled);
+      ++number_enabled;
+
+      return handle(handles[number_enabled - 1U]);
     }
 
     //*****************************************************************
@@ -151,16 +198,33 @@ namespace etl
     ///\param observer A reference to the observer.
     ///\return <b>true</b> if the observer was removed, <b>false</b> if not.
     //*****************************************************************
-    bool remove_observer(observer_type& observer)
+    bool remove_observer(const observer_type& observer)
     {
       // See if we have it in our list.
-      typename Observer_List::iterator i_observer_item = find_observer(observer);
+      typename Observer_List::iterator i_observer = find_observer(observer);
 
       // Found it?
-      if (i_observer_item != observer_list.end())
+      if (i_observer != observer_list.end())
+      {
+        remove_at(size_type(etl::distance(observer_list.begin(), i_observer)));
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*****************************************************************
+    /// Remove the observer with the handle from the list, in O(1).
+    ///\param h The handle returned by add_observer.
+    ///\return <b>true</b> if the observer was removed, <b>false</b> if the handle is not in use.
+    //*****************************************************************
+    bool remove_observer(handle h)
+    {
+      if (is_in_use(h))
       {
-        // Erase it.
-        observer_list.erase(i_observer_item);
+        remove_at(positions[h.index]);
         return true;
       }
       else
@@ -171,42 +235,67 @@ namespace etl
 
     //*****************************************************************
     /// Enable an observer
+    /// An enabled observer is moved to the last enabled position.
     ///\param observer A reference to the observer.
     ///\param state    <b>true</b> to enable, <b>false</b> to disable. Default is enable.
     //*****************************************************************
-    void enable_observer(observer_type& observer, bool state = true)
+    void enable_observer(const observer_type& observer, bool state = true)
     {
       // See if we have it in our list.
-      typename Observer_List::iterator i_observer_item = find_observer(observer);
+      typename Observer_List::iterator i_observer = find_observer(observer);
 
       // Found it?
-      if (i_observer_item != observer_list.end())
+      if (i_observer != observer_list.end())
       {
-        i_observer_item->enabled = state;
+        enable_at(size_type(etl::distance(observer_list.begin(), i_observer)), state);
       }
     }
 
     //*****************************************************************
-    /// Disable an observer
+    /// Enable the observer with the handle, in O(1).
+    ///\param h     The handle returned by add_observer.
+    ///\param state <b>true</b> to enable, <b>false</b> to disable. Default is enable.
     //*****************************************************************
-    void disable_observer(observer_type& observer)
+    void enable_observer(handle h, bool state = true)
     {
-      // See if we have it in our list.
-      typename Observer_List::iterator i_observer_item = find_observer(observer);
-
-      // Found it?
-      if (i_observer_item != observer_list.end())
+      if (is_in_use(h))
       {
-        i_observer_item->enabled = false;
+        enable_at(positions[h.index], state);
       }
     }
 
+    //*****************************************************************
+    /// Disable an observer
+    //*****************************************************************
+    void disable_observer(const observer_type& observer)
+    {
+      enable_observer(observer, false);
+    }
+
+    //*****************************************************************
+    /// Disable the observer with the handle, in O(1).
+    //*****************************************************************
+    void disable_observer(handle h)
+    {
+      enable_observer(h, false);
+    }
+
+    //*****************************************************************
+    /// Is the handle that of an observer in the list?
+    //*****************************************************************
+    bool has_observer(handle h) const
+    {
+      return is_in_use(h);
+    }
+
     //*****************************************************************
     /// Clear all observers from the list.
+    /// All handles become invalid.
     //*****************************************************************
     void clear_observers()
     {
       observer_list.clear();
+      number_enabled = 0U;
     }
 
     //*****************************************************************
@@ -218,28 +307,33 @@ namespace etl
     }
 
     //*****************************************************************
-    /// Notify all of the observers, sending them the notification.
-    ///\tparam TNotification The notification type.
+    /// Returns the number of enabled observers.
+    //*****************************************************************
+    size_type number_of_enabled_observers() const
+    {
+      return number_enabled;
+    }
+
+    //*****************************************************************
+    /// Notify all of the enabled observers, sending them the notification.
+    /// Observers must not be added or removed during notification.
     ///\param n The notification.
     //*****************************************************************
     void notify_observers(TNotification n)
     {
-      typename Observer_List::iterator i_observer_item = observer_list.begin();
+      const observer_type* p_observer = observer_list.data();
+      const observer_type* p_end      = p_observer + number_enabled;
 
-      while (i_observer_item != observer_list.end())
+      while (p_observer != p_end)
       {
-        if (i_observer_item->enabled)
-        {
-          i_observer_item->p_observer->notification(n);
-        }
-
-        ++i_observer_item;
+        (*p_observer)(n);
+        ++p_observer;
       }
     }
 
   protected:
 
-    ~observable()
+    ~delegate_observable()
     {
     }
 
@@ -249,13 +343,88 @@ namespace etl
     /// Find an observer in the list.
     /// Returns the end of the list if not found.
     //*****************************************************************
-    typename Observer_List::iterator find_observer(observer_type& observer_)
+    typename Observer_List::iterator find_observer(const observer_type& observer)
+    {
+      return etl::find(observer_list.begin(), observer_list.end(), observer);
+    }
+
+    //*****************************************************************
+    /// Is the handle that of an observer in the list?
+    //*****************************************************************
+    bool is_in_use(handle h) const
+    {
+      return h.is_valid() &&
+             (positions[h.index] < observer_list.size()) &&
+             (handles[positions[h.index]] == h.index);
+    }
+
+    //*****************************************************************
+    /// Swaps the observers at two positions, along with their handles.
+    //*****************************************************************
+    void swap_positions(size_type a, size_type b)
+    {
+      if (a != b)
+      {
+        using ETL_OR_STD::swap;
+
+        swap(observer_list[a], observer_list[b]);
+        swap(handles[a], handles[b]);
+
+        positions[handles[a]] = a;
+        positions[handles[b]] = b;
+      }
+    }
+
+    //*****************************************************************
+    /// Removes the observer at the position.
+    /// It is swapped to the end of the enabled observers, if enabled, then
+    /// to the end of the list. Its handle is left after the end of the list,
+    /// ready for reuse.
+    //*****************************************************************
+    void remove_at(size_type position)
+    {
+      if (position < number_enabled)
+      {
+        --number_enabled;
+        swap_positions(position, number_enabled);
+        position = number_enabled;
+      }
+
+      swap_positions(position, observer_list.size() - 1U);
+      observer_list.pop_back();
+    }
+
+    //*****************************************************************
+    /// Enables or disables the observer at the position.
+    //*****************************************************************
+    void enable_at(size_type position, bool state)
     {
-      return etl::find_if(observer_list.begin(), observer_list.end(), compare_observers(observer_));
+      if (state && (position >= number_enabled))
+      {
+        // Make it the last enabled observer.
+        swap_positions(position, number_enabled);
+        ++number_enabled;
+      }
+      else if (!state && (position < number_enabled))
+      {
+        // Make it the first disabled observer.
+        --number_enabled;
+        swap_positions(position, number_enabled);
+      }
     }
 
-    /// The list of observers.
+    /// The list of observers. Enabled observers come first.
     Observer_List observer_list;
+
+    /// The handle of the observer at each position.
+    /// Those after the end of the list are free.
+    size_type handles[MAX_OBSERVERS];
+
+    /// The position of the observer for each handle.
+    size_type positions[MAX_OBSERVERS];
+
+    /// The number of enabled observers.
+    size_type number_enabled;
   };
 }
 
@@ -90,6 +90,85 @@ namespace etl
   };
 #endif
 
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// An indexed service with a dispatch table that is built at compile time.
+  /// The table is a constexpr array of function pointers, so it may be placed
+  /// in ROM, needs no initialisation at startup, and a call is one indexed
+  /// indirect call.
+  /// \tparam Offset    The lowest id value.
+  /// \tparam Unhandled The function to call for ids that are out of range.
+  /// \tparam Handlers  The functions for ids Offset to Offset + sizeof...(Handlers) - 1.
+  ///\code
+  /// typedef etl::static_delegate_service<16, unhandled_irq, uart_irq, spi_irq, timer_irq> irq_service;
+  /// irq_service::call(irq_number);
+  ///\endcode
+  //***************************************************************************
+  template <size_t Offset, void (*Unhandled)(size_t), void (*... Handlers)(size_t)>
+  class static_delegate_service
+  {
+  public:
+
+    typedef void (*function_type)(size_t);
+
+    static ETL_CONSTANT size_t Range = sizeof...(Handlers);
+
+    ETL_STATIC_ASSERT(Range > 0U, "No handlers");
+
+    //*************************************************************************
+    /// Executes the function for the index.
+    /// Compile time assert if the id is out of range.
+    /// \tparam Id The id of the function.
+    //*************************************************************************
+    template <size_t Id>
+    static void call()
+    {
+      ETL_STATIC_ASSERT(Id < (Offset + Range), "Callback Id out of range");
+      ETL_STATIC_ASSERT(Id >= Offset,          "Callback Id out of range");
+
+      table[Id - Offset](Id);
+    }
+
+    //*************************************************************************
+    /// Executes the function for the index.
+    /// Calls the 'unhandled' function if the id is out of range.
+    /// \param id Id of the function.
+    //*************************************************************************
+    static void call(size_t id)
+    {
+      // Ids below Offset wrap to large values, so one compare checks both ends.
+      const size_t index = id - Offset;
+
+      if (index < Range)
+      {
+        table[index](id);
+      }
+      else
+      {
+        Unhandled(id);
+      }
+    }
+
+    //*************************************************************************
+    /// Executes the function for the index, which must be in range.
+    /// \param id Id of the function.
+    //*************************************************************************
+    static void call_unchecked(size_t id)
+    {
+      table[id - Offset](id);
+    }
+
+    /// The dispatch table.
+    static ETL_CONSTEXPR const function_type table[Range] = { Handlers... };
+  };
+
+  template <size_t Offset, void (*Unhandled)(size_t), void (*... Handlers)(size_t)>
+  ETL_CONSTANT size_t static_delegate_service<Offset, Unhandled, Handlers...>::Range;
+
+  template <size_t Offset, void (*Unhandled)(size_t), void (*... Handlers)(size_t)>
+  ETL_CONSTEXPR const typename static_delegate_service<Offset, Unhandled, Handlers...>::function_type static_delegate_service<Offset, Unhandled, Handlers...>::table[];
+#endif
+
   //***************************************************************************
   /// An indexed delegate service.
   /// \tparam Range  The number of delegates to handle.
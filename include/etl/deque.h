@@ -43,6 +43,7 @@ SOFTWARE.
 #include "type_traits.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -247,6 +248,9 @@ namespace etl
       friend class ideque;
       friend class const_iterator;
 
+      /// Marks the iterator as segmented. See etl::is_segmented_iterator.
+      typedef pointer segment_pointer;
+
       //***************************************************
       iterator()
         : index(0)
@@ -455,6 +459,38 @@ namespace etl
         return p_buffer;
       }
 
+      //***************************************************
+      /// The address of the current element.
+      //***************************************************
+      segment_pointer segment_begin() const
+      {
+        return &p_buffer[index];
+      }
+
+      //***************************************************
+      /// The number of contiguous elements from this one, up to
+      /// 'last' or the end of the buffer, whichever is nearer.
+      //***************************************************
+      size_t segment_size(const iterator& last) const
+      {
+        if (last.index < index)
+        {
+          return p_deque->BUFFER_SIZE - static_cast<size_t>(index);
+        }
+        else
+        {
+          return static_cast<size_t>(last.index - index);
+        }
+      }
+
+      //***************************************************
+      /// Moves forward by n elements.
+      //***************************************************
+      void segment_advance(size_t n)
+      {
+        *this += static_cast<difference_type>(n);
+      }
+
       //***************************************************
       void swap(iterator& other)
       {
@@ -500,6 +536,9 @@ namespace etl
 
       friend class ideque;
 
+      /// Marks the iterator as segmented. See etl::is_segmented_iterator.
+      typedef const_pointer segment_pointer;
+
       //***************************************************
       const_iterator()
         : index(0)
@@ -716,6 +755,38 @@ namespace etl
         return p_buffer;
       }
 
+      //***************************************************
+      /// The address of the current element.
+      //***************************************************
+      segment_pointer segment_begin() const
+      {
+        return &p_buffer[index];
+      }
+
+      //***************************************************
+      /// The number of contiguous elements from this one, up to
+      /// 'last' or the end of the buffer, whichever is nearer.
+      //***************************************************
+      size_t segment_size(const const_iterator& last) const
+      {
+        if (last.index < index)
+        {
+          return p_deque->BUFFER_SIZE - static_cast<size_t>(index);
+        }
+        else
+        {
+          return static_cast<size_t>(last.index - index);
+        }
+      }
+
+      //***************************************************
+      /// Moves forward by n elements.
+      //***************************************************
+      void segment_advance(size_t n)
+      {
+        *this += static_cast<difference_type>(n);
+      }
+
       //***************************************************
       void swap(const_iterator& other)
       {
@@ -878,6 +949,42 @@ namespace etl
       return *(_end - 1);
     }
 
+    //*************************************************************************
+    /// Gets the first contiguous run of elements, from the front.
+    /// The deque's contents are first_span() followed by second_span().
+    //*************************************************************************
+    etl::span<T> first_span()
+    {
+      return etl::span<T>(p_buffer + _begin.index, first_span_size());
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous run of elements, from the front.
+    /// The deque's contents are first_span() followed by second_span().
+    //*************************************************************************
+    etl::span<const T> first_span() const
+    {
+      return etl::span<const T>(p_buffer + _begin.index, first_span_size());
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous run of elements, from the start of the buffer.
+    /// Empty if the elements do not wrap around the end of the buffer.
+    //*************************************************************************
+    etl::span<T> second_span()
+    {
+      return etl::span<T>(p_buffer, current_size - first_span_size());
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous run of elements, from the start of the buffer.
+    /// Empty if the elements do not wrap around the end of the buffer.
+    //*************************************************************************
+    etl::span<const T> second_span() const
+    {
+      return etl::span<const T>(p_buffer, current_size - first_span_size());
+    }
+
     //*************************************************************************
     /// Gets an iterator to the beginning of the deque.
     //*************************************************************************
@@ -1012,6 +1119,11 @@ namespace etl
         create_element_back(value);
         position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        ::new (&(*position)) T(value);
+      }
       else
       {
         // Are we closer to the front?
@@ -1065,6 +1177,11 @@ namespace etl
         create_element_back(etl::move(value));
         position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        ::new (&(*position)) T(etl::move(value));
+      }
       else
       {
         // Are we closer to the front?
@@ -1127,6 +1244,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1194,6 +1316,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1259,6 +1386,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1324,6 +1456,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1389,6 +1526,11 @@ namespace etl
         ETL_INCREMENT_DEBUG_COUNT;
           position = _end - 1;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(position, 1U);
+        p = etl::addressof(*position);
+      }
       else
       {
         // Are we closer to the front?
@@ -1456,6 +1598,11 @@ namespace etl
 
         position = _end - n;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(iterator(insert_position.index, *this, p_buffer), n);
+        etl::uninitialized_fill_n(position, n, value);
+      }
       else
       {
         // Non-const insert iterator.
@@ -1567,6 +1714,11 @@ namespace etl
 
         position = _end - n;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        position = open_gap(iterator(insert_position.index, *this, p_buffer), size_t(n));
+        etl::uninitialized_copy(range_begin, range_end, position);
+      }
       else
       {
         // Non-const insert iterator.
@@ -1664,6 +1816,11 @@ namespace etl
         destroy_element_back();
         position = end();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        (*position).~T();
+        position = close_gap(position, 1U);
+      }
       else
       {
         // Are we closer to the front?
@@ -1718,6 +1875,11 @@ namespace etl
 
         position = end();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy(position, position + length);
+        position = close_gap(position, length);
+      }
       else
       {
         // Copy the smallest number of items.
@@ -2189,6 +2351,14 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// The number of elements from the front to the end of the buffer or the back.
+    //*********************************************************************
+    size_t first_span_size() const
+    {
+      return etl::min(current_size, BUFFER_SIZE - static_cast<size_t>(_begin.index));
+    }
+
     //*********************************************************************
     /// Create a new element with a default value at the front.
     //*********************************************************************
@@ -2304,6 +2474,109 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*********************************************************************
+    /// Relocates count elements from index 'from' to index 'to', first to
+    /// last, a contiguous run at a time. For trivially relocatable types.
+    //*********************************************************************
+    void relocate_forward(size_t from, size_t to, size_t count)
+    {
+      while (count != 0U)
+      {
+        const size_t n = etl::min(count, etl::min(BUFFER_SIZE - from, BUFFER_SIZE - to));
+
+        etl::trivially_relocate(p_buffer + from, p_buffer + from + n, p_buffer + to);
+
+        from   = (from + n == BUFFER_SIZE) ? 0U : from + n;
+        to     = (to + n == BUFFER_SIZE) ? 0U : to + n;
+        count -= n;
+      }
+    }
+
+    //*********************************************************************
+    /// Relocates count elements ending at index 'from_end' to end at index
+    /// 'to_end', last to first, a contiguous run at a time.
+    /// For trivially relocatable types.
+    //*********************************************************************
+    void relocate_backward(size_t from_end, size_t to_end, size_t count)
+    {
+      while (count != 0U)
+      {
+        from_end = (from_end == 0U) ? BUFFER_SIZE : from_end;
+        to_end   = (to_end == 0U) ? BUFFER_SIZE : to_end;
+
+        const size_t n = etl::min(count, etl::min(from_end, to_end));
+
+        from_end -= n;
+        to_end   -= n;
+        count    -= n;
+
+        etl::trivially_relocate(p_buffer + from_end, p_buffer + from_end + n, p_buffer + to_end);
+      }
+    }
+
+    //*********************************************************************
+    /// Opens a gap of n unconstructed elements before position, by
+    /// relocating the elements on the shorter side of it.
+    /// For trivially relocatable types.
+    ///\return An iterator to the start of the gap.
+    //*********************************************************************
+    iterator open_gap(iterator position, size_t n)
+    {
+      const size_t n_before = static_cast<size_t>(distance(_begin, position));
+      const size_t n_after  = current_size - n_before;
+
+      if (n_before < n_after)
+      {
+        const iterator new_begin = _begin - difference_type(n);
+
+        relocate_forward(size_t(_begin.index), size_t(new_begin.index), n_before);
+        _begin = new_begin;
+        position -= difference_type(n);
+      }
+      else
+      {
+        const iterator new_end = _end + difference_type(n);
+
+        relocate_backward(size_t(_end.index), size_t(new_end.index), n_after);
+        _end = new_end;
+      }
+
+      current_size += n;
+      ETL_ADD_DEBUG_COUNT(n);
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Closes a gap of n destroyed elements at position, by relocating
+    /// the elements on the shorter side of it.
+    /// For trivially relocatable types.
+    ///\return An iterator to the element that followed the gap.
+    //*********************************************************************
+    iterator close_gap(iterator position, size_t n)
+    {
+      const size_t   n_before = static_cast<size_t>(distance(_begin, position));
+      const size_t   n_after  = current_size - n_before - n;
+      const iterator gap_end  = position + difference_type(n);
+
+      if (n_before < n_after)
+      {
+        relocate_backward(size_t(position.index), size_t(gap_end.index), n_before);
+        _begin += difference_type(n);
+        position = gap_end;
+      }
+      else
+      {
+        relocate_forward(size_t(gap_end.index), size_t(position.index), n_after);
+        _end -= difference_type(n);
+      }
+
+      current_size -= n;
+      ETL_SUBTRACT_DEBUG_COUNT(n);
+
+      return position;
+    }
+
     //*************************************************************************
     /// Measures the distance between two iterators.
     //*************************************************************************
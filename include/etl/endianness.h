@@ -34,7 +34,9 @@ SOFTWARE.
 #include "platform.h"
 #include "enum_type.h"
 #include "binary.h"
+#include "private/byteswap_simd.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #if ETL_USING_CPP20 && ETL_USING_STL
@@ -187,6 +189,43 @@ namespace etl
       return value;
     }
   }
+
+  //***************************************************************************
+  /// Copies the values in the range to the destination, reversing the bytes
+  /// of each. Uses vector byte shuffles for 16, 32 and 64 bit types, where
+  /// available.
+  /// The destination may be 'begin', but must not otherwise overlap the range.
+  /// Returns the end of the destination.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value, T*>::type
+    byteswap_copy(const T* begin, const T* end, T* destination)
+  {
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    const unsigned_t* p_source      = reinterpret_cast<const unsigned_t*>(begin);
+    unsigned_t*       p_destination = reinterpret_cast<unsigned_t*>(destination);
+    size_t            n             = static_cast<size_t>(end - begin);
+
+    etl::private_byteswap::simd_byteswap(p_source, p_destination, n);
+
+    while (n-- != 0U)
+    {
+      *p_destination++ = etl::reverse_bytes(*p_source++);
+    }
+
+    return destination + (end - begin);
+  }
+
+  //***************************************************************************
+  /// Reverses the bytes of each value in the range.
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value, void>::type
+    byteswap_in_place(T* begin, T* end)
+  {
+    etl::byteswap_copy(static_cast<const T*>(begin), static_cast<const T*>(end), begin);
+  }
 }
 
 #endif
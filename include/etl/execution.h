@@ -0,0 +1,735 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EXECUTION_INCLUDED
+#define ETL_EXECUTION_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "atomic.h"
+#include "iterator.h"
+#include "functional.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup execution execution
+/// Parallel versions of algorithms, run on a fixed set of worker threads.
+/// The range is split in to chunks, which the calling thread and the
+/// workers take in turn. Nothing is allocated.
+/// The iterators must be random access.
+///\ingroup utilities
+
+//*****************************************************************************
+/// The most chunks that a range is split in to.
+//*****************************************************************************
+#if !defined(ETL_EXECUTION_MAX_CHUNKS)
+  #define ETL_EXECUTION_MAX_CHUNKS 64
+#endif
+
+namespace etl
+{
+  namespace execution
+  {
+    //*************************************************************************
+    /// Runs the chunks of a job on the calling thread and a fixed set of
+    /// worker threads.
+    /// Each worker thread calls help() in its idle loop, or from a scheduler
+    /// task. One thread at a time may call run().
+    ///\ingroup execution
+    //*************************************************************************
+    class worker_pool
+    {
+    public:
+
+      typedef void (*chunk_function)(void* context, size_t chunk);
+
+      //***********************************************************************
+      /// Constructor.
+      ///\param n_workers_ The number of worker threads that call help().
+      //***********************************************************************
+      explicit worker_pool(size_t n_workers_)
+        : n_workers(n_workers_)
+        , function(ETL_NULLPTR)
+        , context(ETL_NULLPTR)
+        , n_chunks(0U)
+        , next(0U)
+        , done(0U)
+        , helpers(0U)
+        , active(false)
+      {
+      }
+
+      //***********************************************************************
+      /// The number of threads that run chunks, including the caller of run().
+      //***********************************************************************
+      size_t concurrency() const
+      {
+        return n_workers + 1U;
+      }
+
+      //***********************************************************************
+      /// Calls function(context, chunk) for each chunk from 0 to n_chunks_ - 1,
+      /// on this thread and any helping workers.
+      /// Returns when all of the chunks have completed.
+      //***********************************************************************
+      void run(chunk_function function_, void* context_, size_t n_chunks_)
+      {
+        if (n_chunks_ == 0U)
+        {
+          return;
+        }
+
+        function = function_;
+        context  = context_;
+        n_chunks = n_chunks_;
+        next.store(0U, etl::memory_order_relaxed);
+        done.store(0U, etl::memory_order_relaxed);
+
+        // Let the workers in.
+        active.store(true, etl::memory_order_seq_cst);
+
+        work();
+
+        while (done.load(etl::memory_order_acquire) != n_chunks_)
+        {
+          // Wait for the chunks taken by the workers.
+        }
+
+        // Wait for the workers to leave before the job can change.
+        active.store(false, etl::memory_order_seq_cst);
+
+        while (helpers.load(etl::memory_order_seq_cst) != 0U)
+        {
+        }
+      }
+
+      //***********************************************************************
+      /// Runs chunks of the current job, if there is one.
+      /// Call repeatedly from each worker thread.
+      ///\return <b>true</b> if any chunks were run.
+      //***********************************************************************
+      bool help()
+      {
+        bool worked = false;
+
+        helpers.fetch_add(1U, etl::memory_order_seq_cst);
+
+        if (active.load(etl::memory_order_seq_cst))
+        {
+          worked = work();
+        }
+
+        helpers.fetch_sub(1U, etl::memory_order_release);
+
+        return worked;
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Runs chunks until there are none left to take.
+      //***********************************************************************
+      bool work()
+      {
+        bool worked = false;
+
+        for (;;)
+        {
+          const size_t chunk = next.fetch_add(1U, etl::memory_order_relaxed);
+
+          if (chunk >= n_chunks)
+          {
+            break;
+          }
+
+          function(context, chunk);
+          done.fetch_add(1U, etl::memory_order_release);
+          worked = true;
+        }
+
+        return worked;
+      }
+
+      worker_pool(const worker_pool&) ETL_DELETE;
+      worker_pool& operator =(const worker_pool&) ETL_DELETE;
+
+      const size_t        n_workers;
+      chunk_function      function;
+      void*               context;
+      size_t              n_chunks;
+      etl::atomic<size_t> next;    ///< The next chunk to take.
+      etl::atomic<size_t> done;    ///< The number of chunks completed.
+      etl::atomic<size_t> helpers; ///< The number of workers in help().
+      etl::atomic<bool>   active;  ///< Is there a job?
+    };
+
+    //*************************************************************************
+    /// The parallel execution policy.
+    ///\ingroup execution
+    //*************************************************************************
+    class parallel_policy
+    {
+    public:
+
+      //***********************************************************************
+      /// Constructor.
+      ///\param pool_           The pool to run on.
+      ///\param min_chunk_size_ The fewest elements worth running as a chunk.
+      //***********************************************************************
+      parallel_policy(etl::execution::worker_pool& pool_, size_t min_chunk_size_)
+        : pool(pool_)
+        , min_chunk_size((min_chunk_size_ == 0U) ? 1U : min_chunk_size_)
+      {
+      }
+
+      //***********************************************************************
+      /// The number of chunks for a range of n elements.
+      //***********************************************************************
+      size_t chunks_for(size_t n) const
+      {
+        // Several chunks per thread, so that uneven chunks balance out.
+        size_t chunks = pool.concurrency() * 4U;
+
+        chunks = etl::min(chunks, n / min_chunk_size);
+        chunks = etl::min(chunks, size_t(ETL_EXECUTION_MAX_CHUNKS));
+
+        return (chunks == 0U) ? ((n == 0U) ? 0U : 1U) : chunks;
+      }
+
+      etl::execution::worker_pool& pool;
+      const size_t                 min_chunk_size;
+    };
+
+    //*************************************************************************
+    /// Makes a parallel execution policy for a pool.
+    ///\ingroup execution
+    //*************************************************************************
+    inline etl::execution::parallel_policy par(etl::execution::worker_pool& pool, size_t min_chunk_size = 1024U)
+    {
+      return etl::execution::parallel_policy(pool, min_chunk_size);
+    }
+  }
+
+  namespace private_execution
+  {
+    //*************************************************************************
+    /// The offset of the start of a chunk.
+    //*************************************************************************
+    inline size_t chunk_start(size_t n, size_t chunks, size_t chunk)
+    {
+      const size_t base      = n / chunks;
+      const size_t remainder = n % chunks;
+
+      return (chunk * base) + etl::min(chunk, remainder);
+    }
+
+    //*************************************************************************
+    /// The common parts of a job over a range.
+    //*************************************************************************
+    template <typename TIterator>
+    struct range_job
+    {
+      range_job(TIterator first_, size_t n_, size_t chunks_)
+        : first(first_)
+        , n(n_)
+        , chunks(chunks_)
+      {
+      }
+
+      TIterator begin(size_t chunk) const
+      {
+        return first + chunk_start(n, chunks, chunk);
+      }
+
+      TIterator end(size_t chunk) const
+      {
+        return first + chunk_start(n, chunks, chunk + 1U);
+      }
+
+      size_t offset(size_t chunk) const
+      {
+        return chunk_start(n, chunks, chunk);
+      }
+
+      TIterator    first;
+      const size_t n;
+      const size_t chunks;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TFunction>
+    struct for_each_job : public range_job<TIterator>
+    {
+      for_each_job(TIterator first_, size_t n_, size_t chunks_, TFunction& function_)
+        : range_job<TIterator>(first_, n_, chunks_)
+        , function(function_)
+      {
+      }
+
+      static void run(void* context, size_t chunk)
+      {
+        for_each_job& job = *static_cast<for_each_job*>(context);
+
+        etl::for_each(job.begin(chunk), job.end(chunk), job.function);
+      }
+
+      TFunction& function;
+    };
+
+    //*************************************************************************
+    template <typename TIteratorIn, typename TIteratorOut, typename TUnaryOperation>
+    struct transform_job : public range_job<TIteratorIn>
+    {
+      transform_job(TIteratorIn first_, size_t n_, size_t chunks_, TIteratorOut d_first_, TUnaryOperation& operation_)
+        : range_job<TIteratorIn>(first_, n_, chunks_)
+        , d_first(d_first_)
+        , operation(operation_)
+      {
+      }
+
+      static void run(void* context, size_t chunk)
+      {
+        transform_job& job = *static_cast<transform_job*>(context);
+
+        etl::transform(job.begin(chunk), job.end(chunk), job.d_first + job.offset(chunk), job.operation);
+      }
+
+      TIteratorOut     d_first;
+      TUnaryOperation& operation;
+    };
+
+    //*************************************************************************
+    template <typename TIteratorIn, typename TIteratorOut>
+    struct copy_job : public range_job<TIteratorIn>
+    {
+      copy_job(TIteratorIn first_, size_t n_, size_t chunks_, TIteratorOut d_first_)
+        : range_job<TIteratorIn>(first_, n_, chunks_)
+        , d_first(d_first_)
+      {
+      }
+
+      static void run(void* context, size_t chunk)
+      {
+        copy_job& job = *static_cast<copy_job*>(context);
+
+        etl::copy(job.begin(chunk), job.end(chunk), job.d_first + job.offset(chunk));
+      }
+
+      TIteratorOut d_first;
+    };
+
+    //*************************************************************************
+    /// Sorts each chunk, or merges pairs of sorted runs 'width' chunks wide.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    struct sort_job : public range_job<TIterator>
+    {
+      sort_job(TIterator first_, size_t n_, size_t chunks_, TCompare& compare_)
+        : range_job<TIterator>(first_, n_, chunks_)
+        , compare(compare_)
+        , width(0U)
+      {
+      }
+
+      static void sort(void* context, size_t chunk)
+      {
+        sort_job& job = *static_cast<sort_job*>(context);
+
+        etl::sort(job.begin(chunk), job.end(chunk), job.compare);
+      }
+
+      static void merge(void* context, size_t pair)
+      {
+        sort_job& job = *static_cast<sort_job*>(context);
+
+        const size_t left   = pair * 2U * job.width;
+        const size_t middle = etl::min(left + job.width, job.chunks);
+        const size_t right  = etl::min(left + (2U * job.width), job.chunks);
+
+        etl::inplace_merge(job.begin(left), job.begin(middle), job.begin(right), job.compare);
+      }
+
+      TCompare& compare;
+      size_t    width;
+    };
+
+    //*************************************************************************
+    /// Holds the result of each chunk of a reduction.
+    //*************************************************************************
+    template <typename T>
+    class partial_results
+    {
+    public:
+
+      partial_results()
+        : count(0U)
+      {
+      }
+
+      ~partial_results()
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          p()[i].~T();
+        }
+      }
+
+      void set_count(size_t count_)
+      {
+        count = count_;
+      }
+
+      void construct(size_t chunk, const T& value)
+      {
+        ::new (p() + chunk) T(value);
+      }
+
+      T& operator [](size_t chunk)
+      {
+        return p()[chunk];
+      }
+
+    private:
+
+      T* p()
+      {
+        return reinterpret_cast<T*>(&buffer);
+      }
+
+      typename etl::aligned_storage<sizeof(T) * ETL_EXECUTION_MAX_CHUNKS, etl::alignment_of<T>::value>::type buffer;
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// Reduces each chunk. Chunk 0 starts with the initial value and the
+    /// others start with their first transformed element.
+    //*************************************************************************
+    template <typename TIterator, typename T, typename TReduce, typename TTransform>
+    struct reduce_job : public range_job<TIterator>
+    {
+      reduce_job(TIterator first_, size_t n_, size_t chunks_, const T& init_, TReduce& reduce_, TTransform& transform_, partial_results<T>& results_)
+        : range_job<TIterator>(first_, n_, chunks_)
+        , init(init_)
+        , reduce(reduce_)
+        , transform(transform_)
+        , results(results_)
+      {
+      }
+
+      static void run(void* context, size_t chunk)
+      {
+        reduce_job& job = *static_cast<reduce_job*>(context);
+
+        TIterator       itr  = job.begin(chunk);
+        const TIterator last = job.end(chunk);
+
+        T sum = (chunk == 0U) ? job.init : T(job.transform(*itr++));
+
+        while (itr != last)
+        {
+          sum = job.reduce(ETL_MOVE(sum), job.transform(*itr));
+          ++itr;
+        }
+
+        job.results.construct(chunk, sum);
+      }
+
+      const T&            init;
+      TReduce&            reduce;
+      TTransform&         transform;
+      partial_results<T>& results;
+    };
+
+    //*************************************************************************
+    /// As reduce_job, transforming pairs of elements from two ranges.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename T, typename TReduce, typename TTransform>
+    struct reduce2_job : public range_job<TIterator1>
+    {
+      reduce2_job(TIterator1 first1_, size_t n_, size_t chunks_, TIterator2 first2_, const T& init_, TReduce& reduce_, TTransform& transform_, partial_results<T>& results_)
+        : range_job<TIterator1>(first1_, n_, chunks_)
+        , first2(first2_)
+        , init(init_)
+        , reduce(reduce_)
+        , transform(transform_)
+        , results(results_)
+      {
+      }
+
+      static void run(void* context, size_t chunk)
+      {
+        reduce2_job& job = *static_cast<reduce2_job*>(context);
+
+        TIterator1       itr1 = job.begin(chunk);
+        const TIterator1 last = job.end(chunk);
+        TIterator2       itr2 = job.first2 + job.offset(chunk);
+
+        T sum = (chunk == 0U) ? job.init : T(job.transform(*itr1++, *itr2++));
+
+        while (itr1 != last)
+        {
+          sum = job.reduce(ETL_MOVE(sum), job.transform(*itr1, *itr2));
+          ++itr1;
+          ++itr2;
+        }
+
+        job.results.construct(chunk, sum);
+      }
+
+      TIterator2          first2;
+      const T&            init;
+      TReduce&            reduce;
+      TTransform&         transform;
+      partial_results<T>& results;
+    };
+
+    //*************************************************************************
+    /// The identity transformation.
+    //*************************************************************************
+    struct identity
+    {
+      template <typename T>
+      const T& operator ()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Runs a reduction job and combines the chunk results in order.
+    //*************************************************************************
+    template <typename TJob, typename T, typename TReduce>
+    T run_reduction(const etl::execution::parallel_policy& policy, TJob& job, partial_results<T>& results, TReduce& reduce)
+    {
+      policy.pool.run(&TJob::run, &job, job.chunks);
+      results.set_count(job.chunks);
+
+      T sum = results[0];
+
+      for (size_t i = 1U; i < job.chunks; ++i)
+      {
+        sum = reduce(ETL_MOVE(sum), results[i]);
+      }
+
+      return sum;
+    }
+  }
+
+  //***************************************************************************
+  /// Parallel for_each.
+  /// 'function' is called from several threads at once.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void for_each(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TFunction function)
+  {
+    const size_t n = size_t(etl::distance(first, last));
+
+    typedef private_execution::for_each_job<TIterator, TFunction> job_t;
+
+    job_t job(first, n, policy.chunks_for(n), function);
+
+    policy.pool.run(&job_t::run, &job, job.chunks);
+  }
+
+  //***************************************************************************
+  /// Parallel transform.
+  /// 'operation' is called from several threads at once.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIteratorIn, typename TIteratorOut, typename TUnaryOperation>
+  TIteratorOut transform(const etl::execution::parallel_policy& policy, TIteratorIn first, TIteratorIn last, TIteratorOut d_first, TUnaryOperation operation)
+  {
+    const size_t n = size_t(etl::distance(first, last));
+
+    typedef private_execution::transform_job<TIteratorIn, TIteratorOut, TUnaryOperation> job_t;
+
+    job_t job(first, n, policy.chunks_for(n), d_first, operation);
+
+    policy.pool.run(&job_t::run, &job, job.chunks);
+
+    return d_first + n;
+  }
+
+  //***************************************************************************
+  /// Parallel copy. The ranges must not overlap.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIteratorIn, typename TIteratorOut>
+  TIteratorOut copy(const etl::execution::parallel_policy& policy, TIteratorIn first, TIteratorIn last, TIteratorOut d_first)
+  {
+    const size_t n = size_t(etl::distance(first, last));
+
+    typedef private_execution::copy_job<TIteratorIn, TIteratorOut> job_t;
+
+    job_t job(first, n, policy.chunks_for(n), d_first);
+
+    policy.pool.run(&job_t::run, &job, job.chunks);
+
+    return d_first + n;
+  }
+
+  //***************************************************************************
+  /// Parallel sort.
+  /// Sorts the chunks in parallel, then merges pairs of runs in parallel,
+  /// without a buffer. The last merges involve fewer threads.
+  /// Not stable.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, TCompare compare)
+  {
+    const size_t n = size_t(etl::distance(first, last));
+
+    typedef private_execution::sort_job<TIterator, TCompare> job_t;
+
+    job_t job(first, n, policy.chunks_for(n), compare);
+
+    policy.pool.run(&job_t::sort, &job, job.chunks);
+
+    for (job.width = 1U; job.width < job.chunks; job.width *= 2U)
+    {
+      const size_t pairs = (job.chunks + (2U * job.width) - 1U) / (2U * job.width);
+
+      policy.pool.run(&job_t::merge, &job, pairs);
+    }
+  }
+
+  //***************************************************************************
+  /// Parallel sort.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(const etl::execution::parallel_policy& policy, TIterator first, TIterator last)
+  {
+    etl::sort(policy, first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Parallel accumulate.
+  /// The chunks are summed in parallel and the sums are added in order, so
+  /// 'operation' must be associative. Floating point results may differ
+  /// slightly from etl::accumulate.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T accumulate(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    const size_t n = size_t(etl::distance(first, last));
+
+    if (n == 0U)
+    {
+      return init;
+    }
+
+    private_execution::identity           transform;
+    private_execution::partial_results<T> results;
+
+    private_execution::reduce_job<TIterator, T, TBinaryOperation, private_execution::identity>
+      job(first, n, policy.chunks_for(n), init, operation, transform, results);
+
+    return private_execution::run_reduction(policy, job, results, operation);
+  }
+
+  //***************************************************************************
+  /// Parallel accumulate.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T accumulate(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, T init)
+  {
+    return etl::accumulate(policy, first, last, init, etl::plus<T>());
+  }
+
+  //***************************************************************************
+  /// Parallel transform_reduce of one range.
+  /// 'reduce' must be associative.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TReduce, typename TTransform>
+  T transform_reduce(const etl::execution::parallel_policy& policy, TIterator first, TIterator last, T init, TReduce reduce, TTransform transform)
+  {
+    const size_t n = size_t(etl::distance(first, last));
+
+    if (n == 0U)
+    {
+      return init;
+    }
+
+    private_execution::partial_results<T> results;
+
+    private_execution::reduce_job<TIterator, T, TReduce, TTransform>
+      job(first, n, policy.chunks_for(n), init, reduce, transform, results);
+
+    return private_execution::run_reduction(policy, job, results, reduce);
+  }
+
+  //***************************************************************************
+  /// Parallel transform_reduce of two ranges.
+  /// 'reduce' must be associative.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T, typename TReduce, typename TTransform>
+  T transform_reduce(const etl::execution::parallel_policy& policy, TIterator1 first1, TIterator1 last1, TIterator2 first2, T init, TReduce reduce, TTransform transform)
+  {
+    const size_t n = size_t(etl::distance(first1, last1));
+
+    if (n == 0U)
+    {
+      return init;
+    }
+
+    private_execution::partial_results<T> results;
+
+    private_execution::reduce2_job<TIterator1, TIterator2, T, TReduce, TTransform>
+      job(first1, n, policy.chunks_for(n), first2, init, reduce, transform, results);
+
+    return private_execution::run_reduction(policy, job, results, reduce);
+  }
+
+  //***************************************************************************
+  /// Parallel inner product, as transform_reduce with plus and multiplies.
+  ///\ingroup execution
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T>
+  T transform_reduce(const etl::execution::parallel_policy& policy, TIterator1 first1, TIterator1 last1, TIterator2 first2, T init)
+  {
+    return etl::transform_reduce(policy, first1, last1, first2, init, etl::plus<T>(), etl::multiplies<T>());
+  }
+}
+
+#endif
+#endif
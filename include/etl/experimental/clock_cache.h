@@ -0,0 +1,318 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CLOCK_CACHE_INCLUDED
+#define ETL_CLOCK_CACHE_INCLUDED
+
+#include "../platform.h"
+#include "../pool.h"
+#include "../hash.h"
+#include "../functional.h"
+#include "../static_assert.h"
+#include "icache.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  ///**************************************************************************
+  /// A fixed capacity CLOCK, or 'second chance', cache.
+  /// An approximation of 'least recently used' where a hit only sets a flag,
+  /// so hits are cheaper than for etl::lru_cache.
+  /// When full, a miss sweeps the 'hand' around the values, clearing the flags,
+  /// and evicts the first value that was not used since the last sweep.
+  /// It is written to the store first if it was changed while 'write back'.
+  ///**************************************************************************
+  template <typename TKey, typename TValue, size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class clock_cache : public etl::icache<TKey, TValue>
+  {
+  private:
+
+    typedef etl::icache<TKey, TValue> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "Zero capacity cache");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    ///************************************************************************
+    /// Constructor.
+    ///************************************************************************
+    clock_cache()
+      : hand(0U)
+    {
+    }
+
+    ///************************************************************************
+    /// Destructor.
+    /// Writes any changed values to the store.
+    ///************************************************************************
+    ~clock_cache()
+    {
+      clear();
+    }
+
+    ///************************************************************************
+    /// Reads a value, from the store on a miss.
+    ///************************************************************************
+    const TValue& read(const TKey& key) ETL_OVERRIDE
+    {
+      node_t* p_node = index.find(key);
+
+      if (p_node == ETL_NULLPTR)
+      {
+        p_node = add(key, this->load(key));
+      }
+      else
+      {
+        p_node->referenced = true;
+      }
+
+      return p_node->value;
+    }
+
+    ///************************************************************************
+    /// Writes a value.
+    /// If 'write through' the value is also written to the store now.
+    ///************************************************************************
+    void write(const TKey& key, const TValue& value) ETL_OVERRIDE
+    {
+      node_t* p_node = index.find(key);
+
+      if (p_node == ETL_NULLPTR)
+      {
+        p_node = add(key, value);
+      }
+      else
+      {
+        p_node->value      = value;
+        p_node->referenced = true;
+      }
+
+      if (this->write_through)
+      {
+        this->store(key, value);
+      }
+      else
+      {
+        p_node->dirty = true;
+      }
+    }
+
+    ///************************************************************************
+    /// Writes all changed values to the store.
+    ///************************************************************************
+    void flush() ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < pool.size(); ++i)
+      {
+        write_back(*slots[i]);
+      }
+    }
+
+    ///************************************************************************
+    /// Checks if the key is cached. Does not mark it as used.
+    ///************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return index.find(key) != ETL_NULLPTR;
+    }
+
+    ///************************************************************************
+    /// Removes a value from the cache, writing it to the store if changed.
+    /// Returns true if it was cached.
+    ///************************************************************************
+    bool erase(const TKey& key)
+    {
+      node_t* p_node = index.find(key);
+
+      if (p_node == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      // Move the last slot into the gap.
+      size_t last = pool.size() - 1U;
+      size_t slot = p_node->slot;
+
+      evict(*p_node);
+
+      if (slot != last)
+      {
+        slots[slot]       = slots[last];
+        slots[slot]->slot = slot;
+      }
+
+      if (hand >= pool.size())
+      {
+        hand = 0U;
+      }
+
+      return true;
+    }
+
+    ///************************************************************************
+    /// Removes all of the values, writing any changed ones to the store.
+    ///************************************************************************
+    void clear()
+    {
+      while (!pool.empty())
+      {
+        evict(*slots[pool.size() - 1U]);
+      }
+
+      hand = 0U;
+    }
+
+    ///************************************************************************
+    /// The number of cached values.
+    ///************************************************************************
+    size_t size() const
+    {
+      return pool.size();
+    }
+
+    ///************************************************************************
+    /// The capacity of the cache.
+    ///************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    ///************************************************************************
+    /// Checks if the cache is empty.
+    ///************************************************************************
+    bool empty() const
+    {
+      return pool.empty();
+    }
+
+    ///************************************************************************
+    /// Checks if the cache is full.
+    ///************************************************************************
+    bool full() const
+    {
+      return pool.full();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A cached value.
+    //*************************************************************************
+    struct node_t
+    {
+      node_t(const TKey& key_, const TValue& value_, size_t slot_)
+        : key(key_)
+        , value(value_)
+        , slot(slot_)
+        , referenced(false)
+        , dirty(false)
+        , p_next_in_bucket(ETL_NULLPTR)
+      {
+      }
+
+      TKey    key;
+      TValue  value;
+      size_t  slot;
+      bool    referenced;
+      bool    dirty;
+      node_t* p_next_in_bucket;
+    };
+
+    //*************************************************************************
+    /// Adds a new value, evicting if full.
+    //*************************************************************************
+    node_t* add(const TKey& key, const TValue& value)
+    {
+      size_t slot = pool.size();
+
+      if (pool.full())
+      {
+        // Give each referenced value a second chance.
+        while (slots[hand]->referenced)
+        {
+          slots[hand]->referenced = false;
+          hand = (hand + 1U) % MAX_SIZE;
+        }
+
+        slot = hand;
+        evict(*slots[slot]);
+        hand = (hand + 1U) % MAX_SIZE;
+      }
+
+      node_t* p_node = pool.create(key, value, slot);
+
+      slots[slot] = p_node;
+      index.insert(p_node);
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Writes the value to the store if it has been changed.
+    //*************************************************************************
+    void write_back(node_t& node)
+    {
+      if (node.dirty)
+      {
+        this->store(node.key, node.value);
+        node.dirty = false;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the value, writing it back first if changed.
+    //*************************************************************************
+    void evict(node_t& node)
+    {
+      write_back(node);
+      index.erase(&node);
+      pool.destroy(&node);
+    }
+
+    node_t*                     slots[MAX_SIZE]; ///< The values, in the order that the hand visits them.
+    size_t                      hand;            ///< The next slot to consider for eviction.
+    etl::pool<node_t, MAX_SIZE> pool;            ///< The storage for the values.
+
+    etl::private_cache::hash_index<node_t, TKey, MAX_SIZE, THash, TKeyEqual> index; ///< Finds values by key.
+
+    // Disabled.
+    clock_cache(const clock_cache&);
+    clock_cache& operator =(const clock_cache&);
+  };
+
+  template <typename TKey, typename TValue, size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t clock_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+}
+
+#endif
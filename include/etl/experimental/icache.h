@@ -28,20 +28,46 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 ******************************************************************************/
 
-//*****************************************************************************
-#error  This header is in development. Do not use.
-//*****************************************************************************
-
 #ifndef __ETL_ICACHE__
 #define __ETL_ICACHE__
 
-#include "platform.h"
-#include "delegate.h"
+#include "../platform.h"
+#include "../delegate.h"
+#include "../exception.h"
+#include "../error_handler.h"
+#include "../utility.h"
+#include "../file_error_numbers.h"
 
-#include <utility>
+#include <stddef.h>
 
 namespace etl
 {
+  ///**************************************************************************
+  /// Exception for the caches.
+  ///**************************************************************************
+  class cache_exception : public etl::exception
+  {
+  public:
+
+    cache_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  ///**************************************************************************
+  /// A value was not in the cache and there is no read function.
+  ///**************************************************************************
+  class cache_no_read_function : public etl::cache_exception
+  {
+  public:
+
+    cache_no_read_function(string_type file_name_, numeric_type line_number_)
+      : cache_exception(ETL_ERROR_TEXT("cache:no read function", ETL_CACHE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
   ///**************************************************************************
   /// The base class for all caches.
   ///**************************************************************************
@@ -50,65 +76,172 @@ namespace etl
   {
   public:
 
+    typedef TKey   key_type;
+    typedef TValue value_type;
+
+    typedef ETL_OR_STD::pair<TKey, TValue> key_value_t;
+
+    typedef etl::delegate<TValue(const TKey&)>      read_delegate_t;  ///< Reads the value for a key from the store.
+    typedef etl::delegate<void(const key_value_t&)> write_delegate_t; ///< Writes a key and value to the store.
+
     ///************************************************************************
     /// Constructor.
     /// By default, 'write_through' is set to true.
     ///************************************************************************
     icache()
       : write_through(true),
-        read_store(nullptr),
-        write_store(nullptr)
+        read_store(),
+        write_store()
     {
     }
 
     ///************************************************************************
     /// Destructor.
-    /// Flushes the cache if necessary.
+    /// The derived cache must flush itself, as flush() is not callable from here.
     ///************************************************************************
     virtual ~icache()
     {
-      if (!write_through)
-      {
-        flush();
-      }
     }
 
     ///************************************************************************
     /// Sets the function that reads from the store.
     ///************************************************************************
-    void set_read_function(etl::delegate<key_value_t&(void)> reader_)
+    void set_read_function(read_delegate_t reader_)
     {
-      read_store = reader;
+      read_store = reader_;
     }
 
     ///************************************************************************
     /// Sets the function that writes to the store.
     ///************************************************************************
-    void set_write_function(etl::delegate<void(const key_value_t&)> writer_)
+    void set_write_function(write_delegate_t writer_)
     {
-      write_store = writer;
+      write_store = writer_;
     }
 
     ///************************************************************************
-    /// Sets the 'write through'' flag.
+    /// Sets the 'write through' flag.
+    /// Clearing it makes the cache 'write back'. Changed values are then only
+    /// written to the store when evicted, flushed, or the cache is destroyed.
     ///************************************************************************
     void set_write_through(bool write_through_)
     {
       write_through = write_through_;
     }
 
-    virtual const T& read(const TKey& key) const = 0;             ///< Reads from the cache. May read from the store using read_store.
+    ///************************************************************************
+    /// Gets the 'write through' flag.
+    ///************************************************************************
+    bool is_write_through() const
+    {
+      return write_through;
+    }
+
+    virtual const TValue& read(const TKey& key) = 0;              ///< Reads from the cache. May read from the store using read_store.
     virtual void write(const TKey& key, const TValue& value) = 0; ///< Writes to the cache. May write to the store using write_store.
     virtual void flush() = 0;                                     ///< The overridden function should write all changed values to the store.
 
   protected:
 
-    typedef ETL_OR_STD::pair<TKey, TValue> key_value_t;
+    ///************************************************************************
+    /// Reads a value from the store.
+    ///************************************************************************
+    TValue load(const TKey& key) const
+    {
+      ETL_ASSERT(read_store.is_valid(), ETL_ERROR(cache_no_read_function));
+
+      return read_store(key);
+    }
+
+    ///************************************************************************
+    /// Writes a value to the store, if there is a write function.
+    ///************************************************************************
+    void store(const TKey& key, const TValue& value) const
+    {
+      if (write_store.is_valid())
+      {
+        write_store(key_value_t(key, value));
+      }
+    }
 
     bool write_through; ///< If true, the cache should write changed items back to the store immediately. If false then a flush() or destruct will be required.
 
-    etl::delegate<key_value_t&(void)>*       read_store;  ///< A function that will read a value from the store into the cache.
-    etl::delegate<void(const key_value_t&)>* write_store; ///< A function that will write a value from the cache into the store.
+    read_delegate_t  read_store;  ///< A function that will read a value from the store into the cache.
+    write_delegate_t write_store; ///< A function that will write a value from the cache into the store.
+  };
+
+  namespace private_cache
+  {
+    ///************************************************************************
+    /// A chained hash index of cache nodes.
+    /// TNode must have 'key' and 'p_next_in_bucket' members.
+    ///************************************************************************
+    template <typename TNode, typename TKey, size_t Buckets, typename THash, typename TKeyEqual>
+    class hash_index
+    {
+    public:
+
+      hash_index()
+      {
+        clear();
+      }
+
+      //*********************************
+      TNode* find(const TKey& key) const
+      {
+        TNode* p_node = buckets[bucket(key)];
+
+        while ((p_node != ETL_NULLPTR) && !key_equal(p_node->key, key))
+        {
+          p_node = p_node->p_next_in_bucket;
+        }
+
+        return p_node;
+      }
+
+      //*********************************
+      void insert(TNode* p_node)
+      {
+        TNode*& p_head = buckets[bucket(p_node->key)];
+
+        p_node->p_next_in_bucket = p_head;
+        p_head = p_node;
+      }
+
+      //*********************************
+      void erase(TNode* p_node)
+      {
+        TNode** pp_node = &buckets[bucket(p_node->key)];
+
+        while (*pp_node != p_node)
+        {
+          pp_node = &(*pp_node)->p_next_in_bucket;
+        }
+
+        *pp_node = p_node->p_next_in_bucket;
+      }
+
+      //*********************************
+      void clear()
+      {
+        for (size_t i = 0U; i < Buckets; ++i)
+        {
+          buckets[i] = ETL_NULLPTR;
+        }
+      }
+
+    private:
+
+      //*********************************
+      size_t bucket(const TKey& key) const
+      {
+        return static_cast<size_t>(key_hash(key)) % Buckets;
+      }
+
+      TNode*    buckets[Buckets];
+      THash     key_hash;
+      TKeyEqual key_equal;
+    };
   }
 }
 
@@ -0,0 +1,306 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LRU_CACHE_INCLUDED
+#define ETL_LRU_CACHE_INCLUDED
+
+#include "../platform.h"
+#include "../pool.h"
+#include "../intrusive_links.h"
+#include "../hash.h"
+#include "../functional.h"
+#include "../static_assert.h"
+#include "icache.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  ///**************************************************************************
+  /// A fixed capacity 'least recently used' cache.
+  /// Values are found through a hash index and kept in order of use on an
+  /// intrusive list, so read and write are O(1).
+  /// When full, a miss evicts the least recently used value, writing it to
+  /// the store first if it was changed while 'write back'.
+  ///**************************************************************************
+  template <typename TKey, typename TValue, size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class lru_cache : public etl::icache<TKey, TValue>
+  {
+  private:
+
+    typedef etl::icache<TKey, TValue> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "Zero capacity cache");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    ///************************************************************************
+    /// Constructor.
+    ///************************************************************************
+    lru_cache()
+    {
+      recency.etl_previous = &recency;
+      recency.etl_next     = &recency;
+    }
+
+    ///************************************************************************
+    /// Destructor.
+    /// Writes any changed values to the store.
+    ///************************************************************************
+    ~lru_cache()
+    {
+      clear();
+    }
+
+    ///************************************************************************
+    /// Reads a value, from the store on a miss.
+    /// The value becomes the most recently used.
+    ///************************************************************************
+    const TValue& read(const TKey& key) ETL_OVERRIDE
+    {
+      node_t* p_node = index.find(key);
+
+      if (p_node == ETL_NULLPTR)
+      {
+        p_node = add(key, this->load(key));
+      }
+      else
+      {
+        touch(*p_node);
+      }
+
+      return p_node->value;
+    }
+
+    ///************************************************************************
+    /// Writes a value.
+    /// The value becomes the most recently used.
+    /// If 'write through' the value is also written to the store now.
+    ///************************************************************************
+    void write(const TKey& key, const TValue& value) ETL_OVERRIDE
+    {
+      node_t* p_node = index.find(key);
+
+      if (p_node == ETL_NULLPTR)
+      {
+        p_node = add(key, value);
+      }
+      else
+      {
+        p_node->value = value;
+        touch(*p_node);
+      }
+
+      if (this->write_through)
+      {
+        this->store(key, value);
+      }
+      else
+      {
+        p_node->dirty = true;
+      }
+    }
+
+    ///************************************************************************
+    /// Writes all changed values to the store.
+    ///************************************************************************
+    void flush() ETL_OVERRIDE
+    {
+      link_type* p_link = recency.etl_next;
+
+      while (p_link != &recency)
+      {
+        write_back(*static_cast<node_t*>(p_link));
+        p_link = p_link->etl_next;
+      }
+    }
+
+    ///************************************************************************
+    /// Checks if the key is cached. Does not change the order of use.
+    ///************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return index.find(key) != ETL_NULLPTR;
+    }
+
+    ///************************************************************************
+    /// Removes a value from the cache, writing it to the store if changed.
+    /// Returns true if it was cached.
+    ///************************************************************************
+    bool erase(const TKey& key)
+    {
+      node_t* p_node = index.find(key);
+
+      if (p_node == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      evict(*p_node);
+
+      return true;
+    }
+
+    ///************************************************************************
+    /// Removes all of the values, writing any changed ones to the store.
+    ///************************************************************************
+    void clear()
+    {
+      while (recency.etl_next != &recency)
+      {
+        evict(*static_cast<node_t*>(recency.etl_next));
+      }
+    }
+
+    ///************************************************************************
+    /// The number of cached values.
+    ///************************************************************************
+    size_t size() const
+    {
+      return pool.size();
+    }
+
+    ///************************************************************************
+    /// The capacity of the cache.
+    ///************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    ///************************************************************************
+    /// Checks if the cache is empty.
+    ///************************************************************************
+    bool empty() const
+    {
+      return pool.empty();
+    }
+
+    ///************************************************************************
+    /// Checks if the cache is full.
+    ///************************************************************************
+    bool full() const
+    {
+      return pool.full();
+    }
+
+  private:
+
+    typedef etl::bidirectional_link<0> link_type;
+
+    //*************************************************************************
+    /// A cached value.
+    //*************************************************************************
+    struct node_t : public link_type
+    {
+      node_t(const TKey& key_, const TValue& value_)
+        : key(key_)
+        , value(value_)
+        , dirty(false)
+        , p_next_in_bucket(ETL_NULLPTR)
+      {
+      }
+
+      TKey    key;
+      TValue  value;
+      bool    dirty;
+      node_t* p_next_in_bucket;
+    };
+
+    //*************************************************************************
+    /// Adds a new, most recently used, value, evicting if full.
+    //*************************************************************************
+    node_t* add(const TKey& key, const TValue& value)
+    {
+      if (pool.full())
+      {
+        evict(*static_cast<node_t*>(recency.etl_previous));
+      }
+
+      node_t* p_node = pool.create(key, value);
+
+      index.insert(p_node);
+      etl::link_splice<link_type>(recency, *p_node);
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Makes the value the most recently used.
+    //*************************************************************************
+    void touch(node_t& node)
+    {
+      if (recency.etl_next != &node)
+      {
+        node.unlink();
+        etl::link_splice<link_type>(recency, node);
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the value to the store if it has been changed.
+    //*************************************************************************
+    void write_back(node_t& node)
+    {
+      if (node.dirty)
+      {
+        this->store(node.key, node.value);
+        node.dirty = false;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the value, writing it back first if changed.
+    //*************************************************************************
+    void evict(node_t& node)
+    {
+      write_back(node);
+      index.erase(&node);
+      node.unlink();
+      pool.destroy(&node);
+    }
+
+    link_type                   recency; ///< The list of values. Most recently used first.
+    etl::pool<node_t, MAX_SIZE> pool;    ///< The storage for the values.
+
+    etl::private_cache::hash_index<node_t, TKey, MAX_SIZE, THash, TKeyEqual> index; ///< Finds values by key.
+
+    // Disabled.
+    lru_cache(const lru_cache&);
+    lru_cache& operator =(const lru_cache&);
+  };
+
+  template <typename TKey, typename TValue, size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lru_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+}
+
+#endif
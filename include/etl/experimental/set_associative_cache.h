@@ -0,0 +1,382 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SET_ASSOCIATIVE_CACHE_INCLUDED
+#define ETL_SET_ASSOCIATIVE_CACHE_INCLUDED
+
+#include "../platform.h"
+#include "../memory.h"
+#include "../hash.h"
+#include "../functional.h"
+#include "../static_assert.h"
+#include "../placement_new.h"
+#include "icache.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  ///**************************************************************************
+  /// A fixed size, N way, set associative cache.
+  /// A key hashes to one set of WAYS values, held inline, so a lookup compares
+  /// at most WAYS keys and follows no pointers.
+  /// Each way has an age. The least recently used way of the set is replaced
+  /// on a miss, being written to the store first if it was changed while
+  /// 'write back'.
+  ///**************************************************************************
+  template <typename TKey, typename TValue, size_t SETS_, size_t WAYS_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class set_associative_cache : public etl::icache<TKey, TValue>
+  {
+  private:
+
+    typedef etl::icache<TKey, TValue> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(SETS_ > 0U, "Zero sets");
+    ETL_STATIC_ASSERT((WAYS_ > 0U) && (WAYS_ <= 255U), "Ways must be 1 to 255");
+
+    static ETL_CONSTANT size_t SETS     = SETS_;
+    static ETL_CONSTANT size_t WAYS     = WAYS_;
+    static ETL_CONSTANT size_t MAX_SIZE = SETS_ * WAYS_;
+
+    ///************************************************************************
+    /// Constructor.
+    ///************************************************************************
+    set_associative_cache()
+      : current_size(0U)
+    {
+      for (size_t set = 0U; set < SETS; ++set)
+      {
+        for (size_t way = 0U; way < WAYS; ++way)
+        {
+          info[set][way].age   = static_cast<uint8_t>(way);
+          info[set][way].valid = false;
+          info[set][way].dirty = false;
+        }
+      }
+    }
+
+    ///************************************************************************
+    /// Destructor.
+    /// Writes any changed values to the store.
+    ///************************************************************************
+    ~set_associative_cache()
+    {
+      clear();
+    }
+
+    ///************************************************************************
+    /// Reads a value, from the store on a miss.
+    ///************************************************************************
+    const TValue& read(const TKey& key) ETL_OVERRIDE
+    {
+      const size_t set = set_of(key);
+      size_t       way = find_way(set, key);
+
+      if (way == WAYS)
+      {
+        way = replace(set, key, this->load(key));
+      }
+
+      touch(set, way);
+
+      return entry(set, way).value;
+    }
+
+    ///************************************************************************
+    /// Writes a value.
+    /// If 'write through' the value is also written to the store now.
+    ///************************************************************************
+    void write(const TKey& key, const TValue& value) ETL_OVERRIDE
+    {
+      const size_t set = set_of(key);
+      size_t       way = find_way(set, key);
+
+      if (way == WAYS)
+      {
+        way = replace(set, key, value);
+      }
+      else
+      {
+        entry(set, way).value = value;
+      }
+
+      touch(set, way);
+
+      if (this->write_through)
+      {
+        this->store(key, value);
+      }
+      else
+      {
+        info[set][way].dirty = true;
+      }
+    }
+
+    ///************************************************************************
+    /// Writes all changed values to the store.
+    ///************************************************************************
+    void flush() ETL_OVERRIDE
+    {
+      for (size_t set = 0U; set < SETS; ++set)
+      {
+        for (size_t way = 0U; way < WAYS; ++way)
+        {
+          write_back(set, way);
+        }
+      }
+    }
+
+    ///************************************************************************
+    /// Checks if the key is cached. Does not change the ages.
+    ///************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find_way(set_of(key), key) != WAYS;
+    }
+
+    ///************************************************************************
+    /// Removes a value from the cache, writing it to the store if changed.
+    /// Returns true if it was cached.
+    ///************************************************************************
+    bool erase(const TKey& key)
+    {
+      const size_t set = set_of(key);
+      const size_t way = find_way(set, key);
+
+      if (way == WAYS)
+      {
+        return false;
+      }
+
+      evict(set, way);
+
+      return true;
+    }
+
+    ///************************************************************************
+    /// Removes all of the values, writing any changed ones to the store.
+    ///************************************************************************
+    void clear()
+    {
+      for (size_t set = 0U; set < SETS; ++set)
+      {
+        for (size_t way = 0U; way < WAYS; ++way)
+        {
+          if (info[set][way].valid)
+          {
+            evict(set, way);
+          }
+        }
+      }
+    }
+
+    ///************************************************************************
+    /// The number of cached values.
+    ///************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    ///************************************************************************
+    /// The capacity of the cache.
+    ///************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    ///************************************************************************
+    /// Checks if the cache is empty.
+    ///************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A cached key and value.
+    //*************************************************************************
+    struct entry_t
+    {
+      entry_t(const TKey& key_, const TValue& value_)
+        : key(key_)
+        , value(value_)
+      {
+      }
+
+      TKey   key;
+      TValue value;
+    };
+
+    //*************************************************************************
+    /// The state of a way.
+    /// The ages of a set are always a permutation of 0 to WAYS - 1.
+    //*************************************************************************
+    struct info_t
+    {
+      uint8_t age;
+      bool    valid;
+      bool    dirty;
+    };
+
+    //*************************************************************************
+    size_t set_of(const TKey& key) const
+    {
+      return static_cast<size_t>(key_hash(key)) % SETS;
+    }
+
+    //*************************************************************************
+    entry_t& entry(size_t set, size_t way)
+    {
+      return entries[static_cast<int>((set * WAYS) + way)];
+    }
+
+    //*************************************************************************
+    const entry_t& entry(size_t set, size_t way) const
+    {
+      return entries[static_cast<int>((set * WAYS) + way)];
+    }
+
+    //*************************************************************************
+    /// The way holding the key, or WAYS if not cached.
+    //*************************************************************************
+    size_t find_way(size_t set, const TKey& key) const
+    {
+      for (size_t way = 0U; way < WAYS; ++way)
+      {
+        if (info[set][way].valid && key_equal(entry(set, way).key, key))
+        {
+          return way;
+        }
+      }
+
+      return WAYS;
+    }
+
+    //*************************************************************************
+    /// Makes the way the youngest in its set.
+    //*************************************************************************
+    void touch(size_t set, size_t way)
+    {
+      const uint8_t age = info[set][way].age;
+
+      for (size_t i = 0U; i < WAYS; ++i)
+      {
+        info[set][i].age += static_cast<uint8_t>(info[set][i].age < age);
+      }
+
+      info[set][way].age = 0U;
+    }
+
+    //*************************************************************************
+    /// Stores a new value in the oldest way of the set.
+    //*************************************************************************
+    size_t replace(size_t set, const TKey& key, const TValue& value)
+    {
+      size_t victim = 0U;
+
+      for (size_t way = 0U; way < WAYS; ++way)
+      {
+        if (!info[set][way].valid)
+        {
+          victim = way;
+          break;
+        }
+
+        if (info[set][way].age == (WAYS - 1U))
+        {
+          victim = way;
+        }
+      }
+
+      if (info[set][victim].valid)
+      {
+        evict(set, victim);
+      }
+
+      ::new (&entry(set, victim)) entry_t(key, value);
+      info[set][victim].valid = true;
+      ++current_size;
+
+      return victim;
+    }
+
+    //*************************************************************************
+    /// Writes the value to the store if it has been changed.
+    //*************************************************************************
+    void write_back(size_t set, size_t way)
+    {
+      if (info[set][way].dirty)
+      {
+        this->store(entry(set, way).key, entry(set, way).value);
+        info[set][way].dirty = false;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the value, writing it back first if changed.
+    /// The way keeps its age.
+    //*************************************************************************
+    void evict(size_t set, size_t way)
+    {
+      write_back(set, way);
+      entry(set, way).~entry_t();
+      info[set][way].valid = false;
+      --current_size;
+    }
+
+    etl::uninitialized_buffer_of<entry_t, MAX_SIZE> entries;          ///< The values, WAYS per set.
+    info_t                                         info[SETS][WAYS];  ///< The state of each way.
+    size_t                                         current_size;      ///< The number of cached values.
+    THash                                          key_hash;
+    TKeyEqual                                      key_equal;
+
+    // Disabled.
+    set_associative_cache(const set_associative_cache&);
+    set_associative_cache& operator =(const set_associative_cache&);
+  };
+
+  template <typename TKey, typename TValue, size_t SETS_, size_t WAYS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t set_associative_cache<TKey, TValue, SETS_, WAYS_, THash, TKeyEqual>::SETS;
+
+  template <typename TKey, typename TValue, size_t SETS_, size_t WAYS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t set_associative_cache<TKey, TValue, SETS_, WAYS_, THash, TKeyEqual>::WAYS;
+
+  template <typename TKey, typename TValue, size_t SETS_, size_t WAYS_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t set_associative_cache<TKey, TValue, SETS_, WAYS_, THash, TKeyEqual>::MAX_SIZE;
+}
+
+#endif
@@ -0,0 +1,1009 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EYTZINGER_SET_INCLUDED
+#define ETL_EYTZINGER_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "binary.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup eytzinger_set eytzinger_set
+/// A set with the capacity defined at compile time, with the elements stored
+/// in Eytzinger (breadth first binary tree) order.
+/// The first levels of the tree are always adjacent in memory and the children
+/// of a node are adjacent to each other, so searches are cache and prefetch
+/// friendly and branch free. Suited to tables that are built once and then
+/// searched many times.
+/// Has insertion of O(NlogN) and search of O(logN).
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the eytzinger_set.
+  ///\ingroup eytzinger_set
+  //***************************************************************************
+  class eytzinger_set_exception : public etl::exception
+  {
+  public:
+
+    eytzinger_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the eytzinger_set.
+  ///\ingroup eytzinger_set
+  //***************************************************************************
+  class eytzinger_set_full : public etl::eytzinger_set_exception
+  {
+  public:
+
+    eytzinger_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::eytzinger_set_exception(ETL_ERROR_TEXT("eytzinger_set:full", ETL_EYTZINGER_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized eytzinger_sets.
+  /// Can be used as a reference type for all eytzinger_sets containing a specific type.
+  /// Node k of the tree (1 based) is stored at index k - 1, with its children at nodes 2k and 2k + 1.
+  /// The iterators visit the elements in sorted order.
+  ///\ingroup eytzinger_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare = etl::less<T> >
+  class ieytzinger_set
+  {
+  public:
+
+    typedef T                 key_type;
+    typedef T                 value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    typedef const key_type&   const_key_reference;
+
+    //*************************************************************************
+    /// A bidirectional iterator that visits the elements in sorted order.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ieytzinger_set;
+
+      //*********************************
+      const_iterator()
+        : p_buffer(ETL_NULLPTR)
+        , n(0U)
+        , k(0U)
+      {
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return p_buffer[k - 1U];
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &p_buffer[k - 1U];
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        if (((2U * k) + 1U) <= n)
+        {
+          // The leftmost node of the right subtree.
+          k = (2U * k) + 1U;
+          k = ieytzinger_set::leftmost(k, n);
+        }
+        else
+        {
+          // Up past the nodes for which we are in the right subtree.
+          k >>= (etl::count_trailing_ones(k) + 1U);
+        }
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator ++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator --()
+      {
+        if (k == 0U)
+        {
+          // From end() to the rightmost node.
+          k = ieytzinger_set::rightmost(1U, n);
+        }
+        else if ((2U * k) <= n)
+        {
+          // The rightmost node of the left subtree.
+          k = ieytzinger_set::rightmost(2U * k, n);
+        }
+        else
+        {
+          // Up past the nodes for which we are in the left subtree.
+          k >>= (etl::count_trailing_zeros(k) + 1U);
+        }
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        operator --();
+        return temp;
+      }
+
+      //*********************************
+      /// The index of the element in the underlying storage.
+      /// end() has an index of size().
+      //*********************************
+      size_t index() const
+      {
+        return (k == 0U) ? n : k - 1U;
+      }
+
+      //*********************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_buffer == rhs.p_buffer) && (lhs.k == rhs.k);
+      }
+
+      //*********************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const value_type* p_buffer_, size_t n_, size_t k_)
+        : p_buffer(p_buffer_)
+        , n(n_)
+        , k(k_)
+      {
+      }
+
+      const value_type* p_buffer;
+      size_t            n;
+      size_t            k; ///< The 1 based node index. 0 for end().
+    };
+
+    typedef const_iterator iterator;
+
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator                       reverse_iterator;
+
+    //*********************************************************************
+    /// Returns a const_iterator to the smallest element.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return iterator_at(current_size == 0U ? 0U : leftmost(1U, current_size));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the eytzinger_set.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return iterator_at(0U);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the smallest element.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the eytzinger_set.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the largest element.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the reverse end of the eytzinger_set.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the largest element.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the reverse end of the eytzinger_set.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a pointer to the elements, in Eytzinger order.
+    //*********************************************************************
+    const value_type* data() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the eytzinger_set.
+    /// If asserts or exceptions are enabled, emits eytzinger_set_full if the eytzinger_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the eytzinger_set.
+    /// The layout is rebuilt after each insertion. Prefer inserting a range.
+    /// If asserts or exceptions are enabled, emits eytzinger_set_full if the eytzinger_set is already full.
+    ///\param value The value to insert.
+    ///\return <b>true</b> if the value was inserted.
+    //*********************************************************************
+    bool insert(const_reference value)
+    {
+      if (contains(value))
+      {
+        return false;
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(eytzinger_set_full), false);
+
+      ::new (p_buffer + current_size) value_type(value);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      rebuild();
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the eytzinger_set.
+    /// The layout is rebuilt once, after all of the values have been added.
+    /// If asserts or exceptions are enabled, emits eytzinger_set_full if the eytzinger_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        if (full())
+        {
+          // Make room by removing any duplicates added so far.
+          rebuild();
+
+          if (full())
+          {
+            ETL_ASSERT_FAIL(ETL_ERROR(eytzinger_set_full));
+            break;
+          }
+        }
+
+        ::new (p_buffer + current_size) value_type(*first);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+        ++first;
+      }
+
+      rebuild();
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      const_iterator itr = find(key);
+
+      if (itr == end())
+      {
+        return 0U;
+      }
+
+      erase_index(itr.index());
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Clears the eytzinger_set.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        p_buffer[i].~value_type();
+        ETL_DECREMENT_DEBUG_COUNT;
+      }
+
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return iterator_at(find_node(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return iterator_at(find_node(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_node(key) != 0U) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_node(key) != 0U) ? 1U : 0U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Check if the set contains the key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_node(key) != 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_node(key) != 0U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return iterator_at(lower_bound_node(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return iterator_at(lower_bound_node(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return iterator_at(upper_bound_node(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return iterator_at(upper_bound_node(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ieytzinger_set& operator = (const ieytzinger_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the eytzinger_set.
+    ///\return The current size of the eytzinger_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the eytzinger_set.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the eytzinger_set.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the eytzinger_set.
+    ///\return The capacity of the eytzinger_set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the eytzinger_set.
+    ///\return The maximum size of the eytzinger_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Returns the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return compare;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    ///\param p_buffer_  The element storage.
+    ///\param p_placed_  Storage for CAPACITY bits, used when building the layout.
+    ///\param capacity_  The maximum number of elements.
+    //*********************************************************************
+    ieytzinger_set(value_type* p_buffer_, uint_least8_t* p_placed_, size_t capacity_)
+      : p_buffer(p_buffer_)
+      , p_placed(p_placed_)
+      , current_size(0U)
+      , CAPACITY(capacity_)
+    {
+    }
+
+    //*********************************************************************
+    /// Copies the elements of another eytzinger_set.
+    /// As they are already in order, no comparisons are made.
+    //*********************************************************************
+    void copy_from(const ieytzinger_set& other)
+    {
+      clear();
+
+      ETL_ASSERT_OR_RETURN(other.size() <= CAPACITY, ETL_ERROR(eytzinger_set_full));
+
+      for (size_t i = 0U; i < other.size(); ++i)
+      {
+        ::new (p_buffer + i) value_type(other.p_buffer[i]);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+
+  private:
+
+    // Disable copy construction.
+    ieytzinger_set(const ieytzinger_set&);
+
+    //*********************************************************************
+    /// The leftmost node of the subtree rooted at k.
+    //*********************************************************************
+    static size_t leftmost(size_t k, size_t n)
+    {
+      while ((2U * k) <= n)
+      {
+        k = 2U * k;
+      }
+
+      return k;
+    }
+
+    //*********************************************************************
+    /// The rightmost node of the subtree rooted at k.
+    //*********************************************************************
+    static size_t rightmost(size_t k, size_t n)
+    {
+      while (((2U * k) + 1U) <= n)
+      {
+        k = (2U * k) + 1U;
+      }
+
+      return k;
+    }
+
+    //*********************************************************************
+    /// The number of nodes in the subtree rooted at k.
+    //*********************************************************************
+    static size_t subtree_size(size_t k, size_t n)
+    {
+      size_t count = 0U;
+      size_t low   = k;
+      size_t high  = k;
+
+      while (low <= n)
+      {
+        count += ((high < n) ? high : n) - low + 1U;
+        low    = 2U * low;
+        high   = (2U * high) + 1U;
+      }
+
+      return count;
+    }
+
+    //*********************************************************************
+    /// The sorted order rank of node k.
+    //*********************************************************************
+    static size_t rank_of(size_t k, size_t n)
+    {
+      size_t rank = subtree_size(2U * k, n);
+
+      while (k > 1U)
+      {
+        // A right child follows its parent and its parent's left subtree.
+        if ((k & 1U) != 0U)
+        {
+          rank += subtree_size(k - 1U, n) + 1U;
+        }
+
+        k >>= 1U;
+      }
+
+      return rank;
+    }
+
+    //*********************************************************************
+    /// The node of the first element that is not less than key, or 0.
+    /// Descends a full path through the tree without branching on the
+    /// comparison, then backs up to the last node where it went left.
+    //*********************************************************************
+    template <typename K>
+    size_t lower_bound_node(const K& key) const
+    {
+      size_t k = 1U;
+
+      while (k <= current_size)
+      {
+        k = (2U * k) + (compare(p_buffer[k - 1U], key) ? 1U : 0U);
+      }
+
+      return k >> (etl::count_trailing_ones(k) + 1U);
+    }
+
+    //*********************************************************************
+    /// The node of the first element that is greater than key, or 0.
+    //*********************************************************************
+    template <typename K>
+    size_t upper_bound_node(const K& key) const
+    {
+      size_t k = 1U;
+
+      while (k <= current_size)
+      {
+        k = (2U * k) + (compare(key, p_buffer[k - 1U]) ? 0U : 1U);
+      }
+
+      return k >> (etl::count_trailing_ones(k) + 1U);
+    }
+
+    //*********************************************************************
+    /// The node of the element equal to key, or 0.
+    //*********************************************************************
+    template <typename K>
+    size_t find_node(const K& key) const
+    {
+      const size_t k = lower_bound_node(key);
+
+      return ((k != 0U) && !compare(key, p_buffer[k - 1U])) ? k : 0U;
+    }
+
+    //*********************************************************************
+    const_iterator iterator_at(size_t k) const
+    {
+      return const_iterator(p_buffer, current_size, k);
+    }
+
+    //*********************************************************************
+    /// Erases the element at the storage index and rebuilds the layout.
+    //*********************************************************************
+    void erase_index(size_t index)
+    {
+      const size_t last = current_size - 1U;
+
+      if (index != last)
+      {
+        p_buffer[index] = ETL_MOVE(p_buffer[last]);
+      }
+
+      p_buffer[last].~value_type();
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      rebuild();
+    }
+
+    //*********************************************************************
+    /// Sorts the elements, removes duplicates, then permutes them in to
+    /// Eytzinger order by following the cycles of the permutation.
+    //*********************************************************************
+    void rebuild()
+    {
+      etl::sort(p_buffer, p_buffer + current_size, compare);
+
+      remove_duplicates();
+
+      const size_t n = current_size;
+
+      for (size_t i = 0U; i < ((n + 7U) / 8U); ++i)
+      {
+        p_placed[i] = 0U;
+      }
+
+      for (size_t start = 0U; start < n; ++start)
+      {
+        if (is_placed(start))
+        {
+          continue;
+        }
+
+        set_placed(start);
+
+        size_t source = rank_of(start + 1U, n);
+
+        if (source != start)
+        {
+          value_type temp(ETL_MOVE(p_buffer[start]));
+          size_t destination = start;
+
+          while (source != start)
+          {
+            p_buffer[destination] = ETL_MOVE(p_buffer[source]);
+            set_placed(source);
+            destination = source;
+            source      = rank_of(source + 1U, n);
+          }
+
+          p_buffer[destination] = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Removes adjacent equivalent elements from the sorted elements.
+    //*********************************************************************
+    void remove_duplicates()
+    {
+      if (current_size < 2U)
+      {
+        return;
+      }
+
+      size_t result = 0U;
+
+      for (size_t i = 1U; i < current_size; ++i)
+      {
+        if (compare(p_buffer[result], p_buffer[i]))
+        {
+          ++result;
+
+          if (result != i)
+          {
+            p_buffer[result] = ETL_MOVE(p_buffer[i]);
+          }
+        }
+      }
+
+      const size_t new_size = result + 1U;
+
+      for (size_t i = new_size; i < current_size; ++i)
+      {
+        p_buffer[i].~value_type();
+        ETL_DECREMENT_DEBUG_COUNT;
+      }
+
+      current_size = new_size;
+    }
+
+    //*********************************************************************
+    bool is_placed(size_t index) const
+    {
+      return (p_placed[index / 8U] & (1U << (index % 8U))) != 0U;
+    }
+
+    //*********************************************************************
+    void set_placed(size_t index)
+    {
+      p_placed[index / 8U] |= static_cast<uint_least8_t>(1U << (index % 8U));
+    }
+
+    value_type*     p_buffer;
+    uint_least8_t*  p_placed;
+    size_type       current_size;
+    const size_type CAPACITY;
+    key_compare     compare;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_EYTZINGER_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ieytzinger_set()
+    {
+    }
+#else
+  protected:
+    ~ieytzinger_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first eytzinger_set.
+  ///\param rhs Reference to the second eytzinger_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup eytzinger_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator ==(const etl::ieytzinger_set<T, TKeyCompare>& lhs, const etl::ieytzinger_set<T, TKeyCompare>& rhs)
+  {
+    // Equal sets of the same size have the same layout.
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first eytzinger_set.
+  ///\param rhs Reference to the second eytzinger_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup eytzinger_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator !=(const etl::ieytzinger_set<T, TKeyCompare>& lhs, const etl::ieytzinger_set<T, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// An eytzinger_set implementation that uses a fixed size buffer.
+  ///\tparam T         The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<T>
+  ///\ingroup eytzinger_set
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T> >
+  class eytzinger_set : public etl::ieytzinger_set<T, TCompare>
+  {
+  private:
+
+    typedef etl::ieytzinger_set<T, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    eytzinger_set()
+      : base(reinterpret_cast<T*>(&buffer), placed, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    eytzinger_set(const eytzinger_set& other)
+      : base(reinterpret_cast<T*>(&buffer), placed, MAX_SIZE)
+    {
+      this->copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    /// The values do not have to be sorted.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    eytzinger_set(TIterator first, TIterator last)
+      : base(reinterpret_cast<T*>(&buffer), placed, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    eytzinger_set(std::initializer_list<T> init)
+      : base(reinterpret_cast<T*>(&buffer), placed, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~eytzinger_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    eytzinger_set& operator = (const eytzinger_set& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    /// The elements, in Eytzinger order.
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+
+    /// Marks the elements that have been placed while building the layout.
+    uint_least8_t placed[(MAX_SIZE_ + 7U) / 8U];
+  };
+
+  template <typename T, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t eytzinger_set<T, MAX_SIZE_, TCompare>::MAX_SIZE;
+}
+
+#endif
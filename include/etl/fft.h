@@ -0,0 +1,500 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FFT_INCLUDED
+#define ETL_FFT_INCLUDED
+
+#include "platform.h"
+#include "fixed.h"
+#include "math.h"
+#include "power.h"
+#include "math_constants.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+///\defgroup fft fft
+/// Fixed size fast Fourier transforms, for floating point and etl::fixed values.
+/// With C++14 the twiddle factors are calculated at compile time, into a
+/// constant table. Before C++14 they are calculated on first use.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// A complex value, with the layout of std::complex and of the interleaved
+  /// buffers used by CMSIS-DSP.
+  ///\ingroup fft
+  //***************************************************************************
+  template <typename T>
+  struct fft_complex
+  {
+    T real;
+    T imag;
+  };
+
+  namespace private_fft
+  {
+    //*************************************************************************
+    /// Scales values down by 2^shift between passes.
+    /// Floating point values are not scaled.
+    //*************************************************************************
+    template <typename T>
+    struct scaling
+    {
+      static ETL_CONSTANT bool Is_Scaled = false;
+
+      static T apply(T value, size_t)
+      {
+        return value;
+      }
+
+      static T divide(T value, size_t shift)
+      {
+        return value * T(1.0 / double(1UL << shift));
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT bool scaling<T>::Is_Scaled;
+
+    //*************************************************************************
+    /// Fixed point values are scaled, so that no pass can overflow.
+    //*************************************************************************
+    template <size_t VInteger_Bits, size_t VFraction_Bits>
+    struct scaling<etl::fixed<VInteger_Bits, VFraction_Bits> >
+    {
+      typedef etl::fixed<VInteger_Bits, VFraction_Bits> fixed_type;
+      typedef typename fixed_type::wide_type             wide_type;
+
+      static ETL_CONSTANT bool Is_Scaled = true;
+
+      static fixed_type apply(fixed_type value, size_t shift)
+      {
+        return divide(value, shift);
+      }
+
+      static fixed_type divide(fixed_type value, size_t shift)
+      {
+        return fixed_type::from_wide(etl::private_fixed::round_shift<wide_type>(wide_type(value.raw()), shift));
+      }
+    };
+
+    template <size_t VInteger_Bits, size_t VFraction_Bits>
+    ETL_CONSTANT bool scaling<etl::fixed<VInteger_Bits, VFraction_Bits> >::Is_Scaled;
+
+    //*************************************************************************
+    /// Complex arithmetic.
+    //*************************************************************************
+    template <typename T>
+    etl::fft_complex<T> make_complex(T real, T imag)
+    {
+      etl::fft_complex<T> result;
+      result.real = real;
+      result.imag = imag;
+
+      return result;
+    }
+
+    template <typename T>
+    etl::fft_complex<T> add(const etl::fft_complex<T>& lhs, const etl::fft_complex<T>& rhs)
+    {
+      return make_complex<T>(lhs.real + rhs.real, lhs.imag + rhs.imag);
+    }
+
+    template <typename T>
+    etl::fft_complex<T> subtract(const etl::fft_complex<T>& lhs, const etl::fft_complex<T>& rhs)
+    {
+      return make_complex<T>(lhs.real - rhs.real, lhs.imag - rhs.imag);
+    }
+
+    template <typename T>
+    etl::fft_complex<T> multiply(const etl::fft_complex<T>& lhs, const etl::fft_complex<T>& rhs)
+    {
+      return make_complex<T>((lhs.real * rhs.real) - (lhs.imag * rhs.imag),
+                             (lhs.real * rhs.imag) + (lhs.imag * rhs.real));
+    }
+
+    template <typename T>
+    etl::fft_complex<T> conjugate(const etl::fft_complex<T>& value)
+    {
+      return make_complex<T>(value.real, -value.imag);
+    }
+
+    template <typename T>
+    etl::fft_complex<T> scale(const etl::fft_complex<T>& value, size_t shift)
+    {
+      return make_complex<T>(scaling<T>::apply(value.real, shift), scaling<T>::apply(value.imag, shift));
+    }
+
+    template <typename T>
+    etl::fft_complex<T> divide(const etl::fft_complex<T>& value, size_t shift)
+    {
+      return make_complex<T>(scaling<T>::divide(value.real, shift), scaling<T>::divide(value.imag, shift));
+    }
+
+    //*************************************************************************
+    /// Sine and cosine, by Taylor series, for 0 <= x <= pi / 4.
+    //*************************************************************************
+    inline ETL_CONSTEXPR14 double sine(double x)
+    {
+      const double x2 = x * x;
+
+      double term = x;
+      double sum  = x;
+
+      for (int i = 2; i <= 20; i += 2)
+      {
+        term = -term * x2 / double(i * (i + 1));
+        sum += term;
+      }
+
+      return sum;
+    }
+
+    inline ETL_CONSTEXPR14 double cosine(double x)
+    {
+      const double x2 = x * x;
+
+      double term = 1.0;
+      double sum  = 1.0;
+
+      for (int i = 1; i <= 19; i += 2)
+      {
+        term = -term * x2 / double(i * (i + 1));
+        sum += term;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// The twiddle factors e^(-2.pi.j.i / VSize), for i from 0 to 3.VSize / 4,
+    /// which are all that the radix 4 passes use.
+    //*************************************************************************
+    template <size_t VSize, typename T>
+    struct twiddle_table
+    {
+      static ETL_CONSTANT size_t Length = (3U * VSize) / 4U;
+
+      etl::fft_complex<T> values[Length];
+    };
+
+    template <size_t VSize, typename T>
+    ETL_CONSTANT size_t twiddle_table<VSize, T>::Length;
+
+    //*************************************************************************
+    /// Calculates the twiddle factors.
+    /// The angle is reduced to the first octant exactly, with integers, so
+    /// that symmetric factors have identical values.
+    //*************************************************************************
+    template <size_t VSize, typename T>
+    ETL_CONSTEXPR14 twiddle_table<VSize, T> make_twiddle_table()
+    {
+      twiddle_table<VSize, T> table = {};
+
+      for (size_t i = 0U; i < twiddle_table<VSize, T>::Length; ++i)
+      {
+        // The angle is (quadrant + (remainder / VSize)) * pi / 2.
+        const size_t quadrant  = (4U * i) / VSize;
+        const size_t remainder = (4U * i) - (quadrant * VSize);
+
+        double s = 0.0;
+        double c = 0.0;
+
+        if ((2U * remainder) <= VSize)
+        {
+          const double x = (double(remainder) * etl::math::pi) / (2.0 * double(VSize));
+          s = sine(x);
+          c = cosine(x);
+        }
+        else
+        {
+          const double x = (double(VSize - remainder) * etl::math::pi) / (2.0 * double(VSize));
+          s = cosine(x);
+          c = sine(x);
+        }
+
+        double real = c;
+        double imag = s;
+
+        if (quadrant == 1U)
+        {
+          real = -s;
+          imag = c;
+        }
+        else if (quadrant == 2U)
+        {
+          real = -c;
+          imag = -s;
+        }
+
+        table.values[i].real = T(real);
+        table.values[i].imag = T(-imag);
+      }
+
+      return table;
+    }
+
+    //*************************************************************************
+    /// The twiddle factors for a size.
+    //*************************************************************************
+    template <size_t VSize, typename T>
+    struct twiddles
+    {
+      typedef twiddle_table<VSize, T> table_type;
+
+#if ETL_USING_CPP14
+      static constexpr table_type table = make_twiddle_table<VSize, T>();
+
+      static const table_type& get()
+      {
+        return table;
+      }
+#else
+      static const table_type& get()
+      {
+        static const table_type table = make_twiddle_table<VSize, T>();
+
+        return table;
+      }
+#endif
+    };
+
+#if ETL_USING_CPP14
+    template <size_t VSize, typename T>
+    constexpr twiddle_table<VSize, T> twiddles<VSize, T>::table;
+#endif
+  }
+
+  //***************************************************************************
+  /// A fast Fourier transform of VSize points.
+  /// Decimation in time, in place, with radix 4 passes and, for sizes that
+  /// are not a power of 4, one radix 2 pass.
+  /// The forward transform is not scaled, and the inverse is scaled by
+  /// 1 / VSize, except that for etl::fixed values each pass is scaled down to
+  /// avoid overflow, so every transform is scaled by 1 / VSize. The
+  /// magnitudes of the fixed point inputs must then be less than one.
+  ///\tparam VSize The number of points. A power of 2, of at least 4.
+  ///\tparam T     The value type. float, double or etl::fixed. Default float.
+  ///\ingroup fft
+  //***************************************************************************
+  template <size_t VSize, typename T = float>
+  class fft
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<VSize>::value && (VSize >= 4U), "The size must be a power of 2, of at least 4");
+
+    typedef T                   value_type;
+    typedef etl::fft_complex<T> complex_type;
+
+    static ETL_CONSTANT size_t Size = VSize;
+
+    //*************************************************************************
+    /// The forward transform, in place.
+    //*************************************************************************
+    static void forward(complex_type (&data)[VSize])
+    {
+      transform(data, VSize, 1U);
+    }
+
+    //*************************************************************************
+    /// The inverse transform, in place.
+    //*************************************************************************
+    static void inverse(complex_type (&data)[VSize])
+    {
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        data[i] = private_fft::conjugate(data[i]);
+      }
+
+      transform(data, VSize, 1U);
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        data[i] = private_fft::conjugate(data[i]);
+      }
+
+      if (!private_fft::scaling<T>::Is_Scaled)
+      {
+        const T reciprocal = T(1.0 / double(VSize));
+
+        for (size_t i = 0U; i < VSize; ++i)
+        {
+          data[i].real = data[i].real * reciprocal;
+          data[i].imag = data[i].imag * reciprocal;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The forward transform of real values.
+    /// Outputs the first VSize / 2 + 1 values of the transform. The rest are
+    /// their complex conjugates.
+    /// Uses a complex transform of half the size.
+    //*************************************************************************
+    static void forward_real(const T (&input)[VSize], complex_type (&output)[(VSize / 2U) + 1U])
+    {
+      const size_t half = VSize / 2U;
+
+      for (size_t i = 0U; i < half; ++i)
+      {
+        output[i] = private_fft::make_complex<T>(input[2U * i], input[(2U * i) + 1U]);
+      }
+
+      transform(output, half, 2U);
+
+      const typename private_fft::twiddles<VSize, T>::table_type& w = private_fft::twiddles<VSize, T>::get();
+
+      // The fixed point transform is scaled by one more halving, to give 1 / VSize.
+      const size_t shift = private_fft::scaling<T>::Is_Scaled ? 1U : 0U;
+
+      const complex_type z0 = private_fft::scale(output[0], shift);
+
+      output[0]    = private_fft::make_complex<T>(z0.real + z0.imag, T(0));
+      output[half] = private_fft::make_complex<T>(z0.real - z0.imag, T(0));
+
+      // Splits the half size transform into the even and odd transforms, for
+      // the pairs k and half - k together, as each needs both values.
+      for (size_t k = 1U; k <= (half / 2U); ++k)
+      {
+        const size_t m = half - k;
+
+        const complex_type zk = private_fft::divide(output[k], shift + 1U);
+        const complex_type zm = private_fft::divide(output[m], shift + 1U);
+
+        output[k] = split(zk, zm, w.values[k]);
+
+        if (m != k)
+        {
+          output[m] = split(zm, zk, w.values[m]);
+        }
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// X[k] from Z[k] / 2 and Z[half - k] / 2.
+    /// X[k] = E + W.O, where E = (Z[k] + Z*[half - k]) / 2 and
+    /// O = -j.(Z[k] - Z*[half - k]) / 2.
+    //*************************************************************************
+    static complex_type split(const complex_type& zk, const complex_type& zm, const complex_type& w)
+    {
+      const complex_type even       = private_fft::add(zk, private_fft::conjugate(zm));
+      const complex_type difference = private_fft::subtract(zk, private_fft::conjugate(zm));
+      const complex_type odd        = private_fft::make_complex<T>(difference.imag, -difference.real);
+
+      return private_fft::add(even, private_fft::multiply(w, odd));
+    }
+
+    //*************************************************************************
+    /// The forward transform of n points, using every stride'th twiddle factor.
+    //*************************************************************************
+    static void transform(complex_type* data, size_t n, size_t stride)
+    {
+      const typename private_fft::twiddles<VSize, T>::table_type& w = private_fft::twiddles<VSize, T>::get();
+
+      // Bit reversed order.
+      for (size_t i = 1U, j = 0U; i < n; ++i)
+      {
+        size_t bit = n >> 1U;
+
+        for (; (j & bit) != 0U; bit >>= 1U)
+        {
+          j ^= bit;
+        }
+
+        j ^= bit;
+
+        if (i < j)
+        {
+          const complex_type temp = data[i];
+          data[i] = data[j];
+          data[j] = temp;
+        }
+      }
+
+      size_t m = 1U;
+
+      // A radix 2 pass, if there are an odd number of radix 2 stages.
+      if ((etl::ilog2(n) & 1U) != 0U)
+      {
+        for (size_t i = 0U; i < n; i += 2U)
+        {
+          const complex_type a = private_fft::scale(data[i],      1U);
+          const complex_type b = private_fft::scale(data[i + 1U], 1U);
+
+          data[i]      = private_fft::add(a, b);
+          data[i + 1U] = private_fft::subtract(a, b);
+        }
+
+        m = 2U;
+      }
+
+      // Radix 4 passes, each combining two radix 2 stages, with three twiddle
+      // multiplies for every four points instead of four.
+      for (; (4U * m) <= n; m *= 4U)
+      {
+        const size_t step = stride * (n / (4U * m));
+
+        for (size_t group = 0U; group < n; group += 4U * m)
+        {
+          for (size_t k = 0U; k < m; ++k)
+          {
+            complex_type* p = data + group + k;
+
+            const complex_type a = private_fft::scale(p[0U], 2U);
+            const complex_type b = private_fft::multiply(w.values[2U * k * step], private_fft::scale(p[m], 2U));
+            const complex_type c = private_fft::multiply(w.values[k * step],      private_fft::scale(p[2U * m], 2U));
+            const complex_type d = private_fft::multiply(w.values[3U * k * step], private_fft::scale(p[3U * m], 2U));
+
+            const complex_type t0 = private_fft::add(a, b);
+            const complex_type t1 = private_fft::subtract(a, b);
+            const complex_type t2 = private_fft::add(c, d);
+            const complex_type t3 = private_fft::subtract(c, d);
+
+            // t1 -/+ j.t3
+            p[0U]     = private_fft::add(t0, t2);
+            p[m]      = private_fft::make_complex<T>(t1.real + t3.imag, t1.imag - t3.real);
+            p[2U * m] = private_fft::subtract(t0, t2);
+            p[3U * m] = private_fft::make_complex<T>(t1.real - t3.imag, t1.imag + t3.real);
+          }
+        }
+      }
+    }
+  };
+
+  template <size_t VSize, typename T>
+  ETL_CONSTANT size_t fft<VSize, T>::Size;
+}
+
+#endif
@@ -103,5 +103,30 @@ SOFTWARE.
 #define ETL_EXPECTED_FILE_ID "70"
 #define ETL_ALIGNMENT_FILE_ID "71"
 #define ETL_BASE64_FILE_ID "72"
+#define ETL_FLAT_UNORDERED_MAP_FILE_ID "73"
+#define ETL_INLINE_FLAT_MAP_FILE_ID "74"
+#define ETL_EYTZINGER_SET_FILE_ID "75"
+#define ETL_BTREE_MAP_FILE_ID "76"
+#define ETL_MESSAGE_BROKER_FILE_ID "77"
+#define ETL_ASYNC_MESSAGE_BUS_FILE_ID "78"
+#define ETL_DELEGATE_OBSERVER_FILE_ID "79"
+#define ETL_FORMAT_FILE_ID "80"
+#define ETL_COMPRESSED_BITMAP_FILE_ID "81"
+#define ETL_SOA_VECTOR_FILE_ID "82"
+#define ETL_RADIX_HEAP_FILE_ID "83"
+#define ETL_UNROLLED_LIST_FILE_ID "84"
+#define ETL_INTRUSIVE_SET_FILE_ID "85"
+#define ETL_CACHE_FILE_ID "86"
+#define ETL_COROUTINE_TASK_FILE_ID "87"
+#define ETL_INPLACE_FUNCTION_FILE_ID "88"
+#define ETL_FILTER_FILE_ID "89"
+#define ETL_CONST_FLAT_MAP_FILE_ID "90"
+#define ETL_CONST_UNORDERED_MAP_FILE_ID "91"
+#define ETL_INTERVAL_MAP_FILE_ID "92"
+#define ETL_RADIX_TREE_FILE_ID "93"
+#define ETL_SLOT_MAP_FILE_ID "94"
+#define ETL_PACKED_VECTOR_FILE_ID "95"
+#define ETL_CONCURRENT_HASH_MAP_FILE_ID "96"
+#define ETL_STRING_BUILDER_FILE_ID "97"
 
 #endif
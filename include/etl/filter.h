@@ -0,0 +1,512 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FILTER_INCLUDED
+#define ETL_FILTER_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "fixed.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "sort_network.h"
+#include "private/filter_simd.h"
+
+#include <stddef.h>
+
+///\defgroup filter filter
+/// FIR, IIR and median filters, for per sample or block processing.
+/// For fixed point filters use etl::fixed as the value type.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for filter exceptions.
+  ///\ingroup filter
+  //***************************************************************************
+  class filter_exception : public etl::exception
+  {
+  public:
+
+    filter_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the output of a block is smaller than the input.
+  ///\ingroup filter
+  //***************************************************************************
+  class filter_output_too_small : public etl::filter_exception
+  {
+  public:
+
+    filter_output_too_small(string_type file_name_, numeric_type line_number_)
+      : filter_exception(ETL_ERROR_TEXT("filter:output too small", ETL_FILTER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_filter
+  {
+    //*************************************************************************
+    /// The sum of the products of two arrays.
+    /// Vectorised for float and double where available.
+    //*************************************************************************
+    template <typename T>
+    T dot_product(const T* a, const T* b, size_t length)
+    {
+      T sum = T(0);
+
+      simd_dot_product(a, b, length, sum);
+
+      while (length-- != 0U)
+      {
+        sum += *a++ * *b++;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// The sum of the products of two arrays of fixed point values.
+    /// Summed exactly, and vectorised, for types of up to 16 bits.
+    //*************************************************************************
+    template <size_t VInteger_Bits, size_t VFraction_Bits>
+    etl::fixed<VInteger_Bits, VFraction_Bits> dot_product(const etl::fixed<VInteger_Bits, VFraction_Bits>* a,
+                                                          const etl::fixed<VInteger_Bits, VFraction_Bits>* b,
+                                                          size_t                                           length)
+    {
+      return etl::fixed_dot_product(a, b, length);
+    }
+  }
+
+  //***************************************************************************
+  /// A finite impulse response filter with VTaps coefficients.
+  /// Coefficient 0 applies to the newest sample.
+  /// Each sample is stored twice in a delay line of twice the length, so
+  /// that the last VTaps samples are always contiguous, newest first, and
+  /// each output is a single dot product with the coefficients.
+  ///\tparam T     The sample and coefficient type.
+  ///\tparam VTaps The number of coefficients.
+  ///\ingroup filter
+  //***************************************************************************
+  template <typename T, size_t VTaps>
+  class fir_filter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VTaps > 0U, "Zero taps");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t Taps = VTaps;
+
+    //*************************************************************************
+    /// Constructor.
+    /// All coefficients are zero.
+    //*************************************************************************
+    fir_filter()
+    {
+      for (size_t i = 0U; i < VTaps; ++i)
+      {
+        coefficients[i] = T(0);
+      }
+
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit fir_filter(const T (&coefficients_)[VTaps])
+    {
+      set_coefficients(coefficients_);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients.
+    /// The samples in the delay line are kept.
+    //*************************************************************************
+    void set_coefficients(const T (&coefficients_)[VTaps])
+    {
+      for (size_t i = 0U; i < VTaps; ++i)
+      {
+        coefficients[i] = coefficients_[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the coefficients.
+    //*************************************************************************
+    etl::span<const T, VTaps> get_coefficients() const
+    {
+      return etl::span<const T, VTaps>(coefficients, VTaps);
+    }
+
+    //*************************************************************************
+    /// Clears the delay line.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < (2U * VTaps); ++i)
+      {
+        delay_line[i] = T(0);
+      }
+
+      newest = 0U;
+    }
+
+    //*************************************************************************
+    /// Filters a sample.
+    //*************************************************************************
+    T process(T sample)
+    {
+      newest = (newest == 0U) ? (VTaps - 1U) : (newest - 1U);
+
+      delay_line[newest]         = sample;
+      delay_line[newest + VTaps] = sample;
+
+      return private_filter::dot_product(coefficients, delay_line + newest, VTaps);
+    }
+
+    //*************************************************************************
+    /// Filters a block of samples.
+    /// The input and output may be the same.
+    //*************************************************************************
+    void process(etl::span<const T> input, etl::span<T> output)
+    {
+      ETL_ASSERT_OR_RETURN(output.size() >= input.size(), ETL_ERROR(etl::filter_output_too_small));
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        output[i] = process(input[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// operator ()
+    /// Filters a sample.
+    //*************************************************************************
+    T operator ()(T sample)
+    {
+      return process(sample);
+    }
+
+  private:
+
+    T      coefficients[VTaps];
+    T      delay_line[2U * VTaps];
+    size_t newest;
+  };
+
+  template <typename T, size_t VTaps>
+  ETL_CONSTANT size_t fir_filter<T, VTaps>::Taps;
+
+  //***************************************************************************
+  /// The coefficients of a biquad section, normalised so that a0 is 1.
+  /// y[n] = b0.x[n] + b1.x[n-1] + b2.x[n-2] - a1.y[n-1] - a2.y[n-2]
+  ///\ingroup filter
+  //***************************************************************************
+  template <typename T>
+  struct biquad_coefficients
+  {
+    T b0;
+    T b1;
+    T b2;
+    T a1;
+    T a2;
+  };
+
+  //***************************************************************************
+  /// An infinite impulse response filter, as a cascade of VStages biquad
+  /// sections in transposed direct form II.
+  /// Blocks are processed one section at a time, so the coefficients and
+  /// state of a section stay in registers, with the same results as
+  /// processing them one sample at a time.
+  ///\tparam T       The sample and coefficient type.
+  ///\tparam VStages The number of biquad sections.
+  ///\ingroup filter
+  //***************************************************************************
+  template <typename T, size_t VStages>
+  class iir_filter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VStages > 0U, "Zero stages");
+
+    typedef T                           value_type;
+    typedef etl::biquad_coefficients<T> coefficients_type;
+
+    static ETL_CONSTANT size_t Stages = VStages;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Each section passes samples through unchanged.
+    //*************************************************************************
+    iir_filter()
+    {
+      for (size_t i = 0U; i < VStages; ++i)
+      {
+        stages[i].coefficients.b0 = T(1);
+        stages[i].coefficients.b1 = T(0);
+        stages[i].coefficients.b2 = T(0);
+        stages[i].coefficients.a1 = T(0);
+        stages[i].coefficients.a2 = T(0);
+      }
+
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit iir_filter(const coefficients_type (&coefficients_)[VStages])
+    {
+      set_coefficients(coefficients_);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients of all sections.
+    /// The state of the sections is kept.
+    //*************************************************************************
+    void set_coefficients(const coefficients_type (&coefficients_)[VStages])
+    {
+      for (size_t i = 0U; i < VStages; ++i)
+      {
+        stages[i].coefficients = coefficients_[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the coefficients of a section.
+    //*************************************************************************
+    const coefficients_type& get_coefficients(size_t stage) const
+    {
+      return stages[stage].coefficients;
+    }
+
+    //*************************************************************************
+    /// Clears the state of all sections.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < VStages; ++i)
+      {
+        stages[i].d1 = T(0);
+        stages[i].d2 = T(0);
+      }
+    }
+
+    //*************************************************************************
+    /// Filters a sample.
+    //*************************************************************************
+    T process(T sample)
+    {
+      for (size_t i = 0U; i < VStages; ++i)
+      {
+        sample = stages[i].process(sample);
+      }
+
+      return sample;
+    }
+
+    //*************************************************************************
+    /// Filters a block of samples.
+    /// The input and output may be the same.
+    //*************************************************************************
+    void process(etl::span<const T> input, etl::span<T> output)
+    {
+      ETL_ASSERT_OR_RETURN(output.size() >= input.size(), ETL_ERROR(etl::filter_output_too_small));
+
+      const size_t length = input.size();
+
+      stages[0].process(input.data(), output.data(), length);
+
+      for (size_t i = 1U; i < VStages; ++i)
+      {
+        stages[i].process(output.data(), output.data(), length);
+      }
+    }
+
+    //*************************************************************************
+    /// operator ()
+    /// Filters a sample.
+    //*************************************************************************
+    T operator ()(T sample)
+    {
+      return process(sample);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A biquad section.
+    //*************************************************************************
+    struct stage
+    {
+      //*********************************
+      T process(T x)
+      {
+        const T y = (coefficients.b0 * x) + d1;
+
+        d1 = (coefficients.b1 * x) - (coefficients.a1 * y) + d2;
+        d2 = (coefficients.b2 * x) - (coefficients.a2 * y);
+
+        return y;
+      }
+
+      //*********************************
+      void process(const T* input, T* output, size_t length)
+      {
+        const coefficients_type c = coefficients;
+
+        T s1 = d1;
+        T s2 = d2;
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          const T x = input[i];
+          const T y = (c.b0 * x) + s1;
+
+          s1 = (c.b1 * x) - (c.a1 * y) + s2;
+          s2 = (c.b2 * x) - (c.a2 * y);
+
+          output[i] = y;
+        }
+
+        d1 = s1;
+        d2 = s2;
+      }
+
+      coefficients_type coefficients;
+      T                 d1;
+      T                 d2;
+    };
+
+    stage stages[VStages];
+  };
+
+  template <typename T, size_t VStages>
+  ETL_CONSTANT size_t iir_filter<T, VStages>::Stages;
+
+  //***************************************************************************
+  /// A median filter over the last VWindow samples.
+  /// Removes impulse noise while keeping edges. The median is found with a
+  /// sorting network for small windows.
+  /// The window starts filled with zeros.
+  ///\tparam T       The sample type.
+  ///\tparam VWindow The number of samples in the window. Usually odd.
+  ///\ingroup filter
+  //***************************************************************************
+  template <typename T, size_t VWindow>
+  class median_filter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VWindow > 0U, "Zero window");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t Window = VWindow;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    median_filter()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Clears the window.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < VWindow; ++i)
+      {
+        window[i] = T(0);
+      }
+
+      oldest = 0U;
+    }
+
+    //*************************************************************************
+    /// Filters a sample.
+    //*************************************************************************
+    T process(T sample)
+    {
+      window[oldest] = sample;
+      oldest = (oldest == (VWindow - 1U)) ? 0U : (oldest + 1U);
+
+      // The order of the samples does not change the median.
+      return etl::median_of<VWindow>(window);
+    }
+
+    //*************************************************************************
+    /// Filters a block of samples.
+    /// The input and output may be the same.
+    //*************************************************************************
+    void process(etl::span<const T> input, etl::span<T> output)
+    {
+      ETL_ASSERT_OR_RETURN(output.size() >= input.size(), ETL_ERROR(etl::filter_output_too_small));
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        output[i] = process(input[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// operator ()
+    /// Filters a sample.
+    //*************************************************************************
+    T operator ()(T sample)
+    {
+      return process(sample);
+    }
+
+  private:
+
+    T      window[VWindow];
+    size_t oldest;
+  };
+
+  template <typename T, size_t VWindow>
+  ETL_CONSTANT size_t median_filter<T, VWindow>::Window;
+}
+
+#endif
@@ -0,0 +1,585 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_INCLUDED
+#define ETL_FIXED_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "smallest.h"
+#include "binary.h"
+#include "static_assert.h"
+#include "private/fixed_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "private/minmax_push.h"
+
+///\defgroup fixed fixed
+/// Signed fixed point numbers with saturating arithmetic.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_fixed
+  {
+    //*************************************************************************
+    /// Clamps a value to a range.
+    //*************************************************************************
+    template <typename TWide>
+    ETL_CONSTEXPR TWide clamp(TWide value, TWide minimum, TWide maximum)
+    {
+      return (value < minimum) ? minimum : ((value > maximum) ? maximum : value);
+    }
+
+    //*************************************************************************
+    /// Divides by 2^shift, rounding to nearest, with ties away from zero.
+    //*************************************************************************
+    template <typename TWide>
+    ETL_CONSTEXPR TWide round_shift(TWide value, size_t shift)
+    {
+      return (shift == 0U) ? value
+                           : ((value >= 0) ?  TWide((value + (TWide(1) << (shift - 1U))) >> shift)
+                                           : TWide(-((-value + (TWide(1) << (shift - 1U))) >> shift)));
+    }
+  }
+
+  //***************************************************************************
+  /// A signed fixed point number, with VInteger_Bits integer bits and
+  /// VFraction_Bits fraction bits, plus a sign bit.
+  /// e.g. fixed<0, 15> is Q15 and fixed<15, 16> is Q15.16.
+  /// Stored in the smallest integer that holds all of the bits, up to 32.
+  /// Arithmetic saturates at the limits of the type instead of wrapping.
+  /// Multiplication rounds to nearest. Division truncates towards zero.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  class fixed
+  {
+  public:
+
+    static ETL_CONSTANT size_t Integer_Bits  = VInteger_Bits;
+    static ETL_CONSTANT size_t Fraction_Bits = VFraction_Bits;
+    static ETL_CONSTANT size_t Total_Bits    = VInteger_Bits + VFraction_Bits + 1U;
+
+    ETL_STATIC_ASSERT(Total_Bits <= 32U, "A fixed point number may have at most 32 bits");
+
+    /// The type that holds the value.
+    typedef typename etl::smallest_int_for_bits<Total_Bits>::type value_type;
+
+    /// The type that holds the intermediate results of arithmetic.
+    typedef typename etl::conditional<(Total_Bits <= 16U), int32_t, int64_t>::type wide_type;
+
+    /// The largest raw value.
+    static ETL_CONSTANT wide_type Raw_Max = wide_type((wide_type(1) << (Total_Bits - 1U)) - 1);
+
+    /// The smallest raw value.
+    static ETL_CONSTANT wide_type Raw_Min = wide_type(-Raw_Max - 1);
+
+    /// The raw value of one, which may be out of range.
+    static ETL_CONSTANT wide_type Raw_One = wide_type(wide_type(1) << VFraction_Bits);
+
+    //*************************************************************************
+    /// Default constructor. The value is zero.
+    //*************************************************************************
+    ETL_CONSTEXPR fixed()
+      : value(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from an integer, saturating at the limits.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit fixed(int integer)
+      : value(value_type((wide_type(integer) < (Raw_Min / Raw_One)) ? Raw_Min :
+                         (wide_type(integer) > (Raw_Max / Raw_One)) ? Raw_Max : wide_type(integer) * Raw_One))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a float, rounding to nearest and saturating at the limits.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit fixed(float floating)
+      : value(from_floating(double(floating)))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a double, rounding to nearest and saturating at the limits.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit fixed(double floating)
+      : value(from_floating(floating))
+    {
+    }
+
+    //*************************************************************************
+    /// Makes a fixed point number from a raw value.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed from_raw(value_type raw_value)
+    {
+      return fixed(raw_value, raw_tag());
+    }
+
+    //*************************************************************************
+    /// Makes a fixed point number from a wide raw value, saturating at the limits.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed from_wide(wide_type raw_value)
+    {
+      return fixed(value_type(etl::private_fixed::clamp<wide_type>(raw_value, Raw_Min, Raw_Max)), raw_tag());
+    }
+
+    //*************************************************************************
+    /// The largest value.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed max()
+    {
+      return from_raw(value_type(Raw_Max));
+    }
+
+    //*************************************************************************
+    /// The smallest value.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed min()
+    {
+      return from_raw(value_type(Raw_Min));
+    }
+
+    //*************************************************************************
+    /// The smallest positive value.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed epsilon()
+    {
+      return from_raw(value_type(1));
+    }
+
+    //*************************************************************************
+    /// The raw value.
+    //*************************************************************************
+    ETL_CONSTEXPR value_type raw() const
+    {
+      return value;
+    }
+
+    //*************************************************************************
+    /// The integer part, truncated towards zero.
+    //*************************************************************************
+    ETL_CONSTEXPR int to_int() const
+    {
+      return int(wide_type(value) / Raw_One);
+    }
+
+    //*************************************************************************
+    /// The value as a float.
+    //*************************************************************************
+    ETL_CONSTEXPR float to_float() const
+    {
+      return float(value) / float(Raw_One);
+    }
+
+    //*************************************************************************
+    /// The value as a double.
+    //*************************************************************************
+    ETL_CONSTEXPR double to_double() const
+    {
+      return double(value) / double(Raw_One);
+    }
+
+    //*************************************************************************
+    /// Unary minus. -min() saturates to max().
+    //*************************************************************************
+    ETL_CONSTEXPR fixed operator -() const
+    {
+      return from_wide(-wide_type(value));
+    }
+
+    //*************************************************************************
+    /// Saturating addition.
+    //*************************************************************************
+    friend ETL_CONSTEXPR fixed operator +(fixed lhs, fixed rhs)
+    {
+      return from_wide(wide_type(lhs.value) + wide_type(rhs.value));
+    }
+
+    //*************************************************************************
+    /// Saturating subtraction.
+    //*************************************************************************
+    friend ETL_CONSTEXPR fixed operator -(fixed lhs, fixed rhs)
+    {
+      return from_wide(wide_type(lhs.value) - wide_type(rhs.value));
+    }
+
+    //*************************************************************************
+    /// Saturating multiplication, rounded to nearest.
+    //*************************************************************************
+    friend ETL_CONSTEXPR fixed operator *(fixed lhs, fixed rhs)
+    {
+      return from_wide(etl::private_fixed::round_shift<wide_type>(wide_type(lhs.value) * wide_type(rhs.value), VFraction_Bits));
+    }
+
+    //*************************************************************************
+    /// Saturating division, truncated towards zero.
+    /// Division by zero saturates to max() or min(), by the sign of lhs.
+    //*************************************************************************
+    friend ETL_CONSTEXPR fixed operator /(fixed lhs, fixed rhs)
+    {
+      return (rhs.value == 0) ? ((lhs.value < 0) ? min() : max())
+                              : from_wide((wide_type(lhs.value) * Raw_One) / wide_type(rhs.value));
+    }
+
+    //*************************************************************************
+    fixed& operator +=(fixed rhs)
+    {
+      *this = *this + rhs;
+      return *this;
+    }
+
+    //*************************************************************************
+    fixed& operator -=(fixed rhs)
+    {
+      *this = *this - rhs;
+      return *this;
+    }
+
+    //*************************************************************************
+    fixed& operator *=(fixed rhs)
+    {
+      *this = *this * rhs;
+      return *this;
+    }
+
+    //*************************************************************************
+    fixed& operator /=(fixed rhs)
+    {
+      *this = *this / rhs;
+      return *this;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator ==(fixed lhs, fixed rhs) { return lhs.value == rhs.value; }
+    friend ETL_CONSTEXPR bool operator !=(fixed lhs, fixed rhs) { return lhs.value != rhs.value; }
+    friend ETL_CONSTEXPR bool operator <(fixed lhs, fixed rhs)  { return lhs.value < rhs.value; }
+    friend ETL_CONSTEXPR bool operator <=(fixed lhs, fixed rhs) { return lhs.value <= rhs.value; }
+    friend ETL_CONSTEXPR bool operator >(fixed lhs, fixed rhs)  { return lhs.value > rhs.value; }
+    friend ETL_CONSTEXPR bool operator >=(fixed lhs, fixed rhs) { return lhs.value >= rhs.value; }
+
+  private:
+
+    struct raw_tag {};
+
+    //*************************************************************************
+    ETL_CONSTEXPR fixed(value_type raw_value, raw_tag)
+      : value(raw_value)
+    {
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR value_type from_floating(double floating)
+    {
+      return (floating != floating)                                   ? value_type(0) :
+             ((floating * double(Raw_One)) >= double(Raw_Max))        ? value_type(Raw_Max) :
+             ((floating * double(Raw_One)) <= double(Raw_Min))        ? value_type(Raw_Min) :
+             (floating >= 0.0) ? value_type(wide_type((floating * double(Raw_One)) + 0.5))
+                               : value_type(wide_type((floating * double(Raw_One)) - 0.5));
+    }
+
+    value_type value;
+  };
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  ETL_CONSTANT size_t fixed<VInteger_Bits, VFraction_Bits>::Integer_Bits;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  ETL_CONSTANT size_t fixed<VInteger_Bits, VFraction_Bits>::Fraction_Bits;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  ETL_CONSTANT size_t fixed<VInteger_Bits, VFraction_Bits>::Total_Bits;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  ETL_CONSTANT typename fixed<VInteger_Bits, VFraction_Bits>::wide_type fixed<VInteger_Bits, VFraction_Bits>::Raw_Max;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  ETL_CONSTANT typename fixed<VInteger_Bits, VFraction_Bits>::wide_type fixed<VInteger_Bits, VFraction_Bits>::Raw_Min;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  ETL_CONSTANT typename fixed<VInteger_Bits, VFraction_Bits>::wide_type fixed<VInteger_Bits, VFraction_Bits>::Raw_One;
+
+  /// Common formats.
+  typedef etl::fixed<0, 7>   q7_t;
+  typedef etl::fixed<0, 15>  q15_t;
+  typedef etl::fixed<0, 31>  q31_t;
+  typedef etl::fixed<15, 16> q15_16_t;
+
+  //***************************************************************************
+  /// The absolute value. abs(min()) saturates to max().
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  ETL_CONSTEXPR etl::fixed<VInteger_Bits, VFraction_Bits> fixed_abs(etl::fixed<VInteger_Bits, VFraction_Bits> value)
+  {
+    return (value.raw() < 0) ? -value : value;
+  }
+
+  //***************************************************************************
+  /// The square root, rounded down. Negative values return zero.
+  /// Calculated digit by digit, with no multiplication or division.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  etl::fixed<VInteger_Bits, VFraction_Bits> fixed_sqrt(etl::fixed<VInteger_Bits, VFraction_Bits> value)
+  {
+    typedef etl::fixed<VInteger_Bits, VFraction_Bits>                     fixed_type;
+    typedef typename etl::make_unsigned<typename fixed_type::wide_type>::type uwide_type;
+
+    if (value.raw() <= 0)
+    {
+      return fixed_type();
+    }
+
+    // The square root of raw * 2^Fraction_Bits is the raw result.
+    uwide_type remainder = uwide_type(value.raw()) << VFraction_Bits;
+    uwide_type root      = 0U;
+    uwide_type bit       = uwide_type(1U) << ((sizeof(uwide_type) * 8U) - 2U);
+
+    while (bit > remainder)
+    {
+      bit >>= 2U;
+    }
+
+    while (bit != 0U)
+    {
+      if (remainder >= (root + bit))
+      {
+        remainder -= root + bit;
+        root = (root >> 1U) + bit;
+      }
+      else
+      {
+        root >>= 1U;
+      }
+
+      bit >>= 2U;
+    }
+
+    return fixed_type::from_wide(typename fixed_type::wide_type(root));
+  }
+
+  //***************************************************************************
+  /// The reciprocal, 1 / value, saturating at the limits.
+  /// Calculated by Newton-Raphson iteration, with no division, for targets
+  /// without a hardware divider. Accurate to within one or two of the least
+  /// significant bit. Zero returns max().
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  etl::fixed<VInteger_Bits, VFraction_Bits> fixed_reciprocal(etl::fixed<VInteger_Bits, VFraction_Bits> value)
+  {
+    typedef etl::fixed<VInteger_Bits, VFraction_Bits> fixed_type;
+
+    if (value.raw() == 0)
+    {
+      return fixed_type::max();
+    }
+
+    const bool     negative  = (value.raw() < 0);
+    const uint32_t magnitude = negative ? uint32_t(-int64_t(value.raw())) : uint32_t(value.raw());
+
+    // Normalise to m, in [0.5, 1) as Q0.32, where magnitude = m * 2^width.
+    const int      width = int(32U - etl::count_leading_zeros(magnitude));
+    const uint64_t m     = uint64_t(magnitude) << (32 - width);
+
+    // The initial estimate for 1/m, 48/17 - 32/17 m, is within 1/17.
+    // y is Q2.30.
+    uint64_t y = 3031741621ULL - ((2021161080ULL * m) >> 32U);
+
+    // Each iteration, y = y(2 - my), doubles the number of correct bits.
+    for (int i = 0; i < 3; ++i)
+    {
+      const uint64_t my = (m * y) >> 32U;           // Q2.30
+      y = (y * ((uint64_t(1U) << 31U) - my)) >> 30U; // Q2.30
+    }
+
+    // 1/value = (1/m) * 2^(Fraction_Bits - width), so the raw result is
+    // y * 2^(2 * Fraction_Bits - width - 30).
+    const int shift = (2 * int(VFraction_Bits)) - width - 30;
+
+    int64_t result;
+
+    if (shift >= 0)
+    {
+      // y is less than 2^32, so any larger shift saturates.
+      result = (shift > 31) ? (int64_t(1) << 62) : int64_t(y << shift);
+    }
+    else
+    {
+      result = (-shift > 32) ? 0 : int64_t((y + (uint64_t(1U) << (-shift - 1))) >> -shift);
+    }
+
+    result = negative ? -result : result;
+
+    return fixed_type::from_wide(typename fixed_type::wide_type(etl::private_fixed::clamp<int64_t>(result, fixed_type::Raw_Min, fixed_type::Raw_Max)));
+  }
+
+  //***************************************************************************
+  /// Saturating addition of two arrays, result[i] = a[i] + b[i].
+  /// Uses packed saturating instructions for 16 bit types, where available.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  void fixed_add(const etl::fixed<VInteger_Bits, VFraction_Bits>* a,
+                 const etl::fixed<VInteger_Bits, VFraction_Bits>* b,
+                 etl::fixed<VInteger_Bits, VFraction_Bits>*       result,
+                 size_t                                           length)
+  {
+    typedef etl::fixed<VInteger_Bits, VFraction_Bits> fixed_type;
+    typedef typename fixed_type::value_type           value_type;
+
+    const value_type* p_a      = reinterpret_cast<const value_type*>(a);
+    const value_type* p_b      = reinterpret_cast<const value_type*>(b);
+    value_type*       p_result = reinterpret_cast<value_type*>(result);
+
+    etl::private_fixed::simd_add(p_a, p_b, p_result, length);
+
+    while (length-- != 0U)
+    {
+      *p_result++ = (fixed_type::from_raw(*p_a++) + fixed_type::from_raw(*p_b++)).raw();
+    }
+  }
+
+  //***************************************************************************
+  /// Saturating subtraction of two arrays, result[i] = a[i] - b[i].
+  /// Uses packed saturating instructions for 16 bit types, where available.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  void fixed_subtract(const etl::fixed<VInteger_Bits, VFraction_Bits>* a,
+                      const etl::fixed<VInteger_Bits, VFraction_Bits>* b,
+                      etl::fixed<VInteger_Bits, VFraction_Bits>*       result,
+                      size_t                                           length)
+  {
+    typedef etl::fixed<VInteger_Bits, VFraction_Bits> fixed_type;
+    typedef typename fixed_type::value_type           value_type;
+
+    const value_type* p_a      = reinterpret_cast<const value_type*>(a);
+    const value_type* p_b      = reinterpret_cast<const value_type*>(b);
+    value_type*       p_result = reinterpret_cast<value_type*>(result);
+
+    etl::private_fixed::simd_subtract(p_a, p_b, p_result, length);
+
+    while (length-- != 0U)
+    {
+      *p_result++ = (fixed_type::from_raw(*p_a++) - fixed_type::from_raw(*p_b++)).raw();
+    }
+  }
+
+  //***************************************************************************
+  /// Saturating multiplication of two arrays, result[i] = a[i] * b[i].
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  void fixed_multiply(const etl::fixed<VInteger_Bits, VFraction_Bits>* a,
+                      const etl::fixed<VInteger_Bits, VFraction_Bits>* b,
+                      etl::fixed<VInteger_Bits, VFraction_Bits>*       result,
+                      size_t                                           length)
+  {
+    for (size_t i = 0U; i < length; ++i)
+    {
+      result[i] = a[i] * b[i];
+    }
+  }
+
+  //***************************************************************************
+  /// Saturating multiplication of an array by a gain, result[i] = a[i] * gain.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  void fixed_scale(const etl::fixed<VInteger_Bits, VFraction_Bits>* a,
+                   etl::fixed<VInteger_Bits, VFraction_Bits>        gain,
+                   etl::fixed<VInteger_Bits, VFraction_Bits>*       result,
+                   size_t                                           length)
+  {
+    for (size_t i = 0U; i < length; ++i)
+    {
+      result[i] = a[i] * gain;
+    }
+  }
+
+  //***************************************************************************
+  /// The dot product of two arrays, the sum of a[i] * b[i].
+  /// For types of up to 16 bits the products are summed exactly, using packed
+  /// multiply accumulate instructions where available, such as SMLALD on
+  /// Cortex-M4/M7, and only the result is rounded and saturated.
+  /// Wider products are rounded before they are summed.
+  ///\ingroup fixed
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits>
+  etl::fixed<VInteger_Bits, VFraction_Bits> fixed_dot_product(const etl::fixed<VInteger_Bits, VFraction_Bits>* a,
+                                                              const etl::fixed<VInteger_Bits, VFraction_Bits>* b,
+                                                              size_t                                           length)
+  {
+    typedef etl::fixed<VInteger_Bits, VFraction_Bits> fixed_type;
+    typedef typename fixed_type::value_type           value_type;
+
+    const value_type* p_a = reinterpret_cast<const value_type*>(a);
+    const value_type* p_b = reinterpret_cast<const value_type*>(b);
+
+    int64_t sum = 0;
+
+    if (fixed_type::Total_Bits <= 16U)
+    {
+      etl::private_fixed::simd_dot_product(p_a, p_b, length, sum);
+
+      while (length-- != 0U)
+      {
+        sum += int64_t(*p_a++) * int64_t(*p_b++);
+      }
+
+      sum = etl::private_fixed::round_shift<int64_t>(sum, VFraction_Bits);
+    }
+    else
+    {
+      // Saturate the sum while accumulating, as the products may be up to 62 bits.
+      const int64_t limit = int64_t(1) << 61U;
+
+      while (length-- != 0U)
+      {
+        const int64_t product = etl::private_fixed::round_shift<int64_t>(int64_t(*p_a++) * int64_t(*p_b++), VFraction_Bits);
+
+        sum = etl::private_fixed::clamp<int64_t>(sum + product, -limit, limit);
+      }
+    }
+
+    return fixed_type::from_wide(typename fixed_type::wide_type(etl::private_fixed::clamp<int64_t>(sum, fixed_type::Raw_Min, fixed_type::Raw_Max)));
+  }
+}
+
+#include "private/minmax_pop.h"
+
+#endif
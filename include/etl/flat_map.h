@@ -323,12 +323,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -400,19 +395,32 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
+    /// The new values are appended, sorted once and merged with the existing
+    /// values, rather than each being shifted into place.
+    /// Values whose keys are already in the flat_map are not inserted.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      insert_range(first, last, true);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values that is already sorted by key, with no
+    /// duplicate keys, to the flat_map.
+    /// The new values are appended and merged with the existing values.
+    /// Values whose keys are already in the flat_map are not inserted.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_range(first, last, false);
     }
 
     //*************************************************************************
@@ -704,6 +712,34 @@ namespace etl
       refmap_t::clear();
     }
 
+    //*************************************************************************
+    /// Clears the flat_map incrementally.
+    /// Erases up to 'budget' elements from the back, so that clearing a large
+    /// flat_map may be spread over several calls. Erasing from the back moves
+    /// no other elements.
+    ///\param budget The maximum number of elements to erase.
+    ///\return <b>true</b> if the flat_map is now empty.
+    //*************************************************************************
+    bool clear_some(size_t budget)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<value_type>::value)
+      {
+        clear();
+      }
+      else
+      {
+        while ((budget != 0U) && !empty())
+        {
+          iterator itr = end();
+          --itr;
+          erase(itr);
+          --budget;
+        }
+      }
+
+      return empty();
+    }
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -899,7 +935,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        assign(rhs.cbegin(), rhs.cend());
+        assign_sorted_unique(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -982,6 +1018,26 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Assigns a range of values that is already sorted by key, with no
+    /// duplicate keys, to the flat_map.
+    /// The values are appended without comparing keys.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted_unique(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        append_value(*first);
+        ++first;
+      }
+    }
+
 #if ETL_USING_CPP11
     //*************************************************************************
     /// Move a flat_map.
@@ -1074,6 +1130,74 @@ namespace etl
       return refmap_t::insert_at(i_element, *pvalue);
     }
 
+    //*************************************************************************
+    /// Creates a copy of the value at the end of the lookup, without ordering it.
+    //*************************************************************************
+    template <typename TValueType>
+    void append_value(const TValueType& value)
+    {
+      ETL_ASSERT(!refmap_t::full(), ETL_ERROR(flat_map_full));
+
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new (pvalue) value_type(value);
+      ETL_INCREMENT_DEBUG_COUNT;
+      refmap_t::append_unordered(*pvalue);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    /// Values are appended and then ordered as a batch. If the flat_map fills
+    /// then the batch is ordered early, as it may contain duplicates.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert_range(TIterator first, TIterator last, bool sort_values)
+    {
+      size_t n_ordered = size();
+
+      while (first != last)
+      {
+        if (refmap_t::full())
+        {
+          n_ordered = order_appended(n_ordered, sort_values);
+        }
+
+        if (!refmap_t::contains_ordered((*first).first, n_ordered))
+        {
+          append_value(*first);
+        }
+
+        ++first;
+      }
+
+      order_appended(n_ordered, sort_values);
+    }
+
+    //*************************************************************************
+    /// Orders the values appended after the first n_ordered, destroying any
+    /// with duplicate keys, and merges them with the ordered values.
+    ///\return The new number of ordered values.
+    //*************************************************************************
+    size_t order_appended(size_t n_ordered, bool sort_values)
+    {
+      if (sort_values)
+      {
+        iterator i_duplicate = refmap_t::sort_appended(n_ordered);
+
+        for (iterator itr = i_duplicate; itr != end(); ++itr)
+        {
+          itr->~value_type();
+          storage.release(etl::addressof(*itr));
+          ETL_DECREMENT_DEBUG_COUNT;
+        }
+
+        refmap_t::erase(i_duplicate, end());
+      }
+
+      refmap_t::merge_appended(n_ordered);
+
+      return size();
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1145,7 +1269,7 @@ namespace etl
     flat_map(const flat_map& other)
       : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
     {
-      this->assign(other.cbegin(), other.cend());
+      this->assign_sorted_unique(other.cbegin(), other.cend());
     }
 
 #if ETL_USING_CPP11
@@ -1175,6 +1299,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted by key,
+    /// with no duplicate keys. No key comparisons are made.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_map(etl::sorted_unique_t, TIterator first, TIterator last)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->assign_sorted_unique(first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -1201,7 +1339,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        this->assign(rhs.cbegin(), rhs.cend());
+        this->assign_sorted_unique(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
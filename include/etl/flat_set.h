@@ -36,6 +36,7 @@ SOFTWARE.
 #include "pool.h"
 #include "placement_new.h"
 #include "nth_type.h"
+#include "utility.h"
 #include "type_traits.h"
 #include "initializer_list.h"
 
@@ -214,12 +215,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -300,19 +296,32 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_set.
+    /// The new values are appended, sorted once and merged with the existing
+    /// values, rather than each being shifted into place.
+    /// Values that are already in the flat_set are not inserted.
     /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      insert_range(first, last, true);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values that is already sorted, with no duplicates,
+    /// to the flat_set.
+    /// The new values are appended and merged with the existing values.
+    /// Values that are already in the flat_set are not inserted.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_range(first, last, false);
     }
 
     //*************************************************************************
@@ -834,7 +843,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        assign(rhs.cbegin(), rhs.cend());
+        assign_sorted_unique(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -917,6 +926,26 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Assigns a range of values that is already sorted, with no duplicates,
+    /// to the flat_set.
+    /// The values are appended without comparing them.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted_unique(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        append_value(*first);
+        ++first;
+      }
+    }
+
 #if ETL_USING_CPP11
     //*************************************************************************
     /// Move a flat_set.
@@ -956,6 +985,74 @@ namespace etl
     /// Internal debugging.
     ETL_DECLARE_DEBUG_COUNT;
 
+    //*************************************************************************
+    /// Creates a copy of the value at the end of the lookup, without ordering it.
+    //*************************************************************************
+    template <typename TValueType>
+    void append_value(const TValueType& value)
+    {
+      ETL_ASSERT(!refset_t::full(), ETL_ERROR(flat_set_full));
+
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new (pvalue) value_type(value);
+      ETL_INCREMENT_DEBUG_COUNT;
+      refset_t::append_unordered(*pvalue);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    /// Values are appended and then ordered as a batch. If the flat_set fills
+    /// then the batch is ordered early, as it may contain duplicates.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert_range(TIterator first, TIterator last, bool sort_values)
+    {
+      size_t n_ordered = size();
+
+      while (first != last)
+      {
+        if (refset_t::full())
+        {
+          n_ordered = order_appended(n_ordered, sort_values);
+        }
+
+        if (!refset_t::contains_ordered(*first, n_ordered))
+        {
+          append_value(*first);
+        }
+
+        ++first;
+      }
+
+      order_appended(n_ordered, sort_values);
+    }
+
+    //*************************************************************************
+    /// Orders the values appended after the first n_ordered, destroying any
+    /// duplicates, and merges them with the ordered values.
+    ///\return The new number of ordered values.
+    //*************************************************************************
+    size_t order_appended(size_t n_ordered, bool sort_values)
+    {
+      if (sort_values)
+      {
+        iterator i_duplicate = refset_t::sort_appended(n_ordered);
+
+        for (iterator itr = i_duplicate; itr != end(); ++itr)
+        {
+          itr->~value_type();
+          storage.release(etl::addressof(*itr));
+          ETL_DECREMENT_DEBUG_COUNT;
+        }
+
+        refset_t::erase(i_duplicate, end());
+      }
+
+      refset_t::merge_appended(n_ordered);
+
+      return size();
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1026,7 +1123,7 @@ namespace etl
     flat_set(const flat_set& other)
       : etl::iflat_set<T, TCompare>(lookup, storage)
     {
-      this->assign(other.cbegin(), other.cend());
+      this->assign_sorted_unique(other.cbegin(), other.cend());
     }
 
 #if ETL_USING_CPP11
@@ -1056,6 +1153,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted, with no
+    /// duplicates. No comparisons are made.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_set(etl::sorted_unique_t, TIterator first, TIterator last)
+      : etl::iflat_set<T, TCompare>(lookup, storage)
+    {
+      this->assign_sorted_unique(first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -1082,7 +1193,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        this->assign(rhs.cbegin(), rhs.cend());
+        this->assign_sorted_unique(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -0,0 +1,1568 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_UNORDERED_MAP_INCLUDED
+#define ETL_FLAT_UNORDERED_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "power.h"
+#include "binary.h"
+#include "alignment.h"
+#include "memory.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+#include "span.h"
+#include "nth_type.h"
+#include "private/hash_table_group.h"
+#include "private/unordered_bucket.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup flat_unordered_map flat_unordered_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+/// Elements are stored inline in a single array of slots, with a parallel
+/// array of control bytes in the style of a 'Swiss table'.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_exception : public etl::exception
+  {
+  public:
+
+    flat_unordered_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_full : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:full", ETL_FLAT_UNORDERED_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_out_of_range : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:range", ETL_FLAT_UNORDERED_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_iterator : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:iterator", ETL_FLAT_UNORDERED_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_flat_unordered_map
+  {
+    //*************************************************************************
+    /// Mixes the hash so that weak hashes, such as the identity hash used for
+    /// integral keys, spread over all of the groups.
+    //*************************************************************************
+    template <size_t Size = sizeof(size_t)>
+    struct hash_mixer
+    {
+      static ETL_CONSTANT size_t H2_Shift = 25U;
+
+      static size_t mix(size_t hash)
+      {
+        hash *= 0x9E3779B1UL;
+        return hash ^ (hash >> 16U);
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct hash_mixer<8U>
+    {
+      static ETL_CONSTANT size_t H2_Shift = 57U;
+
+      static size_t mix(size_t hash)
+      {
+        hash *= size_t(0x9E3779B97F4A7C15ULL);
+        return hash ^ (hash >> 32U);
+      }
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_unordered_map.
+  /// Can be used as a reference type for all flat_unordered_map containing a specific type.
+  /// Inserting may compact deleted slots, which invalidates iterators.
+  /// Erasing only invalidates iterators to the erased element.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TGroup = etl::hash_table_group_default>
+  class iflat_unordered_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+  protected:
+
+    typedef private_hash_table::control              control;
+    typedef TGroup                                   group_t;
+    typedef private_flat_unordered_map::hash_mixer<> hash_mixer;
+    typedef typename group_t::mask_type              mask_type;
+
+  public:
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, T>
+    {
+    public:
+
+      typedef typename etl::iterator<ETL_OR_STD::forward_iterator_tag, T>::value_type value_type;
+      typedef typename iflat_unordered_map::key_type        key_type;
+      typedef typename iflat_unordered_map::mapped_type     mapped_type;
+      typedef typename iflat_unordered_map::hasher          hasher;
+      typedef typename iflat_unordered_map::key_equal       key_equal;
+      typedef typename iflat_unordered_map::reference       reference;
+      typedef typename iflat_unordered_map::const_reference const_reference;
+      typedef typename iflat_unordered_map::pointer         pointer;
+      typedef typename iflat_unordered_map::const_pointer   const_pointer;
+      typedef typename iflat_unordered_map::size_type       size_type;
+
+      friend class iflat_unordered_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pcontrol(ETL_NULLPTR)
+        , pcontrol_end(ETL_NULLPTR)
+        , pslot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pcontrol(other.pcontrol)
+        , pcontrol_end(other.pcontrol_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        // Search for the next full slot.
+        do
+        {
+          ++pcontrol;
+          ++pslot;
+        } while ((pcontrol != pcontrol_end) && !control::is_full(*pcontrol));
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        pcontrol     = other.pcontrol;
+        pcontrol_end = other.pcontrol_end;
+        pslot        = other.pslot;
+        return *this;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return *pslot;
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pcontrol == rhs.pcontrol;
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(const int8_t* pcontrol_, const int8_t* pcontrol_end_, pointer pslot_)
+        : pcontrol(pcontrol_)
+        , pcontrol_end(pcontrol_end_)
+        , pslot(pslot_)
+      {
+      }
+
+      const int8_t* pcontrol;
+      const int8_t* pcontrol_end;
+      pointer       pslot;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>
+    {
+    public:
+
+      typedef typename etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>::value_type value_type;
+      typedef typename iflat_unordered_map::key_type        key_type;
+      typedef typename iflat_unordered_map::mapped_type     mapped_type;
+      typedef typename iflat_unordered_map::hasher          hasher;
+      typedef typename iflat_unordered_map::key_equal       key_equal;
+      typedef typename iflat_unordered_map::reference       reference;
+      typedef typename iflat_unordered_map::const_reference const_reference;
+      typedef typename iflat_unordered_map::pointer         pointer;
+      typedef typename iflat_unordered_map::const_pointer   const_pointer;
+      typedef typename iflat_unordered_map::size_type       size_type;
+
+      friend class iflat_unordered_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pcontrol(ETL_NULLPTR)
+        , pcontrol_end(ETL_NULLPTR)
+        , pslot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iflat_unordered_map::iterator& other)
+        : pcontrol(other.pcontrol)
+        , pcontrol_end(other.pcontrol_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pcontrol(other.pcontrol)
+        , pcontrol_end(other.pcontrol_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        // Search for the next full slot.
+        do
+        {
+          ++pcontrol;
+          ++pslot;
+        } while ((pcontrol != pcontrol_end) && !control::is_full(*pcontrol));
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        pcontrol     = other.pcontrol;
+        pcontrol_end = other.pcontrol_end;
+        pslot        = other.pslot;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return *pslot;
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pcontrol == rhs.pcontrol;
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const int8_t* pcontrol_, const int8_t* pcontrol_end_, const_pointer pslot_)
+        : pcontrol(pcontrol_)
+        , pcontrol_end(pcontrol_end_)
+        , pslot(pslot_)
+      {
+      }
+
+      const int8_t* pcontrol;
+      const int8_t* pcontrol_end;
+      const_pointer pslot;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the flat_unordered_map.
+    ///\return An iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      size_t index = first_full_slot();
+
+      return iterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_unordered_map.
+    ///\return A const iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      size_t index = first_full_slot();
+
+      return const_iterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_unordered_map.
+    ///\return A const iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the flat_unordered_map.
+    ///\return An iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(pcontrol + number_of_slots, pcontrol + number_of_slots, pslots + number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_unordered_map.
+    ///\return A const iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(pcontrol + number_of_slots, pcontrol + number_of_slots, pslots + number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_unordered_map.
+    ///\return A const iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots in the table.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of slots in the table.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      const size_t hash  = hash_mixer::mix(key_hash_function(key));
+      size_t       index = find_index(key, hash);
+
+      // Doesn't exist, so add a new one.
+      if (index == number_of_slots)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_unordered_map_full));
+
+        index = prepare_insert(hash);
+        ::new ((void*)etl::addressof(pslots[index])) value_type(etl::move(key), mapped_type());
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      const size_t hash  = hash_mixer::mix(key_hash_function(key));
+      size_t       index = find_index(key, hash);
+
+      // Doesn't exist, so add a new one.
+      if (index == number_of_slots)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_unordered_map_full));
+
+        index = prepare_insert(hash);
+        ::new ((void*)etl::addressof(pslots[index])) value_type(key, mapped_type());
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_unordered_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      size_t index = find_index(key, hash_mixer::mix(key_hash_function(key)));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(flat_unordered_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_unordered_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      size_t index = find_index(key, hash_mixer::mix(key_hash_function(key)));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(flat_unordered_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_unordered_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(flat_unordered_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      const size_t hash  = hash_mixer::mix(key_hash_function(key_value_pair.first));
+      size_t       index = find_index(key_value_pair.first, hash);
+      bool         inserted = false;
+
+      // Not already there?
+      if (index == number_of_slots)
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(flat_unordered_map_full), ETL_OR_STD::make_pair(end(), false));
+
+        index = prepare_insert(hash);
+        ::new ((void*)etl::addressof(pslots[index])) value_type(key_value_pair);
+        ETL_INCREMENT_DEBUG_COUNT;
+        inserted = true;
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), inserted);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      const size_t hash  = hash_mixer::mix(key_hash_function(key_value_pair.first));
+      size_t       index = find_index(key_value_pair.first, hash);
+      bool         inserted = false;
+
+      // Not already there?
+      if (index == number_of_slots)
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(flat_unordered_map_full), ETL_OR_STD::make_pair(end(), false));
+
+        index = prepare_insert(hash);
+        ::new ((void*)etl::addressof(pslots[index])) value_type(etl::move(key_value_pair));
+        ETL_INCREMENT_DEBUG_COUNT;
+        inserted = true;
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), inserted);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      size_t index = find_index(key, hash_mixer::mix(key_hash_function(key)));
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      erase_slot(index);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param ielement Iterator to the element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      const size_t index = size_t(ielement.pslot - pslots);
+
+      iterator inext = make_iterator(index);
+      ++inext;
+
+      erase_slot(index);
+
+      return inext;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing everything?
+      if ((first_ == cbegin()) && (last_ == cend()))
+      {
+        clear();
+        return end();
+      }
+
+      // Erasing does not move the other elements, so 'last' stays valid.
+      while (first_ != last_)
+      {
+        first_ = erase(first_);
+      }
+
+      return make_iterator(size_t(last_.pslot - pslots));
+    }
+
+    //*************************************************************************
+    /// Clears the flat_unordered_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key, hash_mixer::mix(key_hash_function(key))) == number_of_slots) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return make_iterator(find_index(key, hash_mixer::mix(key_hash_function(key))));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return make_iterator(find_index(key, hash_mixer::mix(key_hash_function(key))));
+    }
+
+    //*********************************************************************
+    /// Finds a batch of keys, such as those from a burst of packets.
+    /// All of the keys are hashed and their first groups prefetched before
+    /// any are matched, which hides much of the memory latency of a large table.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator for each key; end() if it does not exist.
+    ///\return The number of keys found.
+    //*********************************************************************
+    size_t find_batch(etl::span<const key_type> keys, etl::span<iterator> results)
+    {
+      return find_batch_slots(keys, results);
+    }
+
+    //*********************************************************************
+    /// Finds a batch of keys, such as those from a burst of packets.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator for each key; end() if it does not exist.
+    ///\return The number of keys found.
+    //*********************************************************************
+    size_t find_batch(etl::span<const key_type> keys, etl::span<const_iterator> results) const
+    {
+      return find_batch_slots(keys, results);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the flat_unordered_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return number_of_elements;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_unordered_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_unordered_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_unordered_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return number_of_elements == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_unordered_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return number_of_elements == max_elements;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_elements - number_of_elements;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_unordered_map& operator = (const iflat_unordered_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_unordered_map& operator = (iflat_unordered_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_unordered_map(value_type* pslots_, int8_t* pcontrol_, size_t number_of_slots_, size_t max_elements_, hasher key_hash_function_, key_equal key_equal_function_)
+      : pslots(pslots_)
+      , pcontrol(pcontrol_)
+      , number_of_slots(number_of_slots_)
+      , max_elements(max_elements_)
+      , number_of_elements(0U)
+      , number_of_deleted(0U)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+    }
+
+    //*********************************************************************
+    /// Initialise the flat_unordered_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (control::is_full(pcontrol[i]))
+          {
+            pslots[i].~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+        }
+      }
+
+      etl::fill_n(pcontrol, number_of_slots, int8_t(control::Empty));
+
+      number_of_elements = 0U;
+      number_of_deleted  = 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator b, iterator e)
+    {
+      while (b != e)
+      {
+        iterator temp = b;
+        ++temp;
+        insert(etl::move(*b));
+        b = temp;
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// The number of groups is a power of 2.
+    //*********************************************************************
+    size_t group_mask() const
+    {
+      return (number_of_slots / group_t::Width) - 1U;
+    }
+
+    //*********************************************************************
+    /// Gets the 7 bit hash fragment stored in the control byte.
+    //*********************************************************************
+    static int8_t get_h2(size_t hash)
+    {
+      return int8_t((hash >> hash_mixer::H2_Shift) & 0x7FU);
+    }
+
+    //*********************************************************************
+    /// Finds the slot holding the key.
+    /// Groups are probed in a triangular sequence, which visits every group.
+    ///\return The slot index or number_of_slots if not found.
+    //*********************************************************************
+    size_t find_index(const_key_reference key, size_t hash) const
+    {
+      const int8_t h2    = get_h2(hash);
+      const size_t mask  = group_mask();
+      size_t       group = hash & mask;
+
+      for (size_t probe = 1U; probe <= (mask + 1U); ++probe)
+      {
+        const size_t  first_slot = group * group_t::Width;
+        const group_t g(pcontrol + first_slot);
+
+        mask_type matches = g.match(h2);
+
+        while (matches != 0U)
+        {
+          const size_t index = first_slot + group_t::lowest_index(matches);
+
+          if (key_equal_function(key, pslots[index].first))
+          {
+            return index;
+          }
+
+          matches &= (matches - 1U);
+        }
+
+        // An empty slot ends the probe sequence.
+        if (g.match_empty() != 0U)
+        {
+          break;
+        }
+
+        group = (group + probe) & mask;
+      }
+
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Finds the slots for a span of keys.
+    /// The keys are hashed in batches and the control bytes and slots of the
+    /// first group of each are requested, before any of them are matched.
+    //*********************************************************************
+    template <typename TIterator>
+    size_t find_batch_slots(etl::span<const key_type> keys, etl::span<TIterator> results) const
+    {
+      ETL_ASSERT(results.size() >= keys.size(), ETL_ERROR(flat_unordered_map_out_of_range));
+
+      const size_t n_keys = etl::min(keys.size(), results.size());
+      const size_t mask   = group_mask();
+
+      size_t hashes[private_unordered::find_batch::Size];
+      size_t n_found = 0U;
+
+      for (size_t base = 0U; base < n_keys; base += private_unordered::find_batch::Size)
+      {
+        const size_t n = etl::min(size_t(private_unordered::find_batch::Size), n_keys - base);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          hashes[i] = hash_mixer::mix(key_hash_function(keys[base + i]));
+
+          const size_t first_slot = (hashes[i] & mask) * group_t::Width;
+
+          private_unordered::prefetch(pcontrol + first_slot);
+          private_unordered::prefetch(pslots + first_slot);
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const size_t index = find_index(keys[base + i], hashes[i]);
+
+          results[base + i] = TIterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+
+          if (index != number_of_slots)
+          {
+            ++n_found;
+          }
+        }
+      }
+
+      return n_found;
+    }
+
+    //*********************************************************************
+    /// Finds the first empty or deleted slot in the probe sequence.
+    //*********************************************************************
+    size_t find_free_index(size_t hash) const
+    {
+      const size_t mask  = group_mask();
+      size_t       group = hash & mask;
+      size_t       probe = 1U;
+
+      mask_type matches = group_t(pcontrol + (group * group_t::Width)).match_empty_or_deleted();
+
+      // There is always free space, as the table is never allowed to fill.
+      while (matches == 0U)
+      {
+        group   = (group + probe) & mask;
+        matches = group_t(pcontrol + (group * group_t::Width)).match_empty_or_deleted();
+        ++probe;
+      }
+
+      return (group * group_t::Width) + group_t::lowest_index(matches);
+    }
+
+    //*********************************************************************
+    /// Reserves a slot for a new element with the hash.
+    ///\return The index of the slot.
+    //*********************************************************************
+    size_t prepare_insert(size_t hash)
+    {
+      size_t index = find_free_index(hash);
+
+      if (pcontrol[index] == control::Deleted)
+      {
+        --number_of_deleted;
+      }
+      else if ((number_of_elements + number_of_deleted) >= max_load())
+      {
+        // Too many deleted slots are lengthening the probe sequences.
+        drop_deleted();
+        index = find_free_index(hash);
+      }
+
+      pcontrol[index] = get_h2(hash);
+      ++number_of_elements;
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// The maximum number of full and deleted slots, 7/8 of the total.
+    //*********************************************************************
+    size_t max_load() const
+    {
+      return number_of_slots - (number_of_slots / 8U);
+    }
+
+    //*********************************************************************
+    /// Erases the element at the slot.
+    //*********************************************************************
+    void erase_slot(size_t index)
+    {
+      pslots[index].~value_type();
+      ETL_DECREMENT_DEBUG_COUNT;
+      --number_of_elements;
+
+      // If the group has never been full then no probe sequence has passed
+      // through it, and the slot can be marked as empty.
+      const size_t first_slot = index - (index % group_t::Width);
+
+      if (group_t(pcontrol + first_slot).match_empty() != 0U)
+      {
+        pcontrol[index] = control::Empty;
+      }
+      else
+      {
+        pcontrol[index] = control::Deleted;
+        ++number_of_deleted;
+      }
+    }
+
+    //*********************************************************************
+    /// Rehashes the table in place to reclaim the deleted slots.
+    //*********************************************************************
+    void drop_deleted()
+    {
+      // Deleted becomes empty and full becomes deleted, marking the elements that still need to be placed.
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        pcontrol[i] = control::is_full(pcontrol[i]) ? int8_t(control::Deleted) : int8_t(control::Empty);
+      }
+
+      size_t i = 0U;
+
+      while (i < number_of_slots)
+      {
+        if (pcontrol[i] != control::Deleted)
+        {
+          ++i;
+          continue;
+        }
+
+        const size_t hash   = hash_mixer::mix(key_hash_function(pslots[i].first));
+        const size_t target = find_free_index(hash);
+
+        if ((target / group_t::Width) == (i / group_t::Width))
+        {
+          // Already in the first free group of its probe sequence.
+          pcontrol[i] = get_h2(hash);
+          ++i;
+        }
+        else if (pcontrol[target] == control::Empty)
+        {
+          relocate(target, i);
+          pcontrol[target] = get_h2(hash);
+          pcontrol[i]      = control::Empty;
+          ++i;
+        }
+        else
+        {
+          // The target holds an element still to be placed.
+          // Swap and then place the element that is now in slot i.
+          swap_slots(target, i);
+          pcontrol[target] = get_h2(hash);
+        }
+      }
+
+      number_of_deleted = 0U;
+    }
+
+    //*********************************************************************
+    /// Moves the element in slot 'from' to the unused slot 'to'.
+    //*********************************************************************
+    void relocate(size_t to, size_t from)
+    {
+#if ETL_USING_CPP11
+      ::new ((void*)etl::addressof(pslots[to])) value_type(etl::move(pslots[from]));
+#else
+      ::new ((void*)etl::addressof(pslots[to])) value_type(pslots[from]);
+#endif
+      pslots[from].~value_type();
+    }
+
+    //*********************************************************************
+    /// Swaps the elements in two slots.
+    //*********************************************************************
+    void swap_slots(size_t a, size_t b)
+    {
+      typename etl::aligned_storage<sizeof(value_type), etl::alignment_of<value_type>::value>::type temp;
+
+      value_type* ptemp = reinterpret_cast<value_type*>(&temp);
+
+#if ETL_USING_CPP11
+      ::new ((void*)ptemp) value_type(etl::move(pslots[a]));
+#else
+      ::new ((void*)ptemp) value_type(pslots[a]);
+#endif
+      pslots[a].~value_type();
+      relocate(a, b);
+#if ETL_USING_CPP11
+      ::new ((void*)etl::addressof(pslots[b])) value_type(etl::move(*ptemp));
+#else
+      ::new ((void*)etl::addressof(pslots[b])) value_type(*ptemp);
+#endif
+      ptemp->~value_type();
+    }
+
+    //*********************************************************************
+    /// Finds the first full slot.
+    //*********************************************************************
+    size_t first_full_slot() const
+    {
+      size_t index = 0U;
+
+      if (!empty())
+      {
+        while (!control::is_full(pcontrol[index]))
+        {
+          ++index;
+        }
+      }
+      else
+      {
+        index = number_of_slots;
+      }
+
+      return index;
+    }
+
+    //*********************************************************************
+    iterator make_iterator(size_t index)
+    {
+      return iterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+    }
+
+    //*********************************************************************
+    const_iterator make_iterator(size_t index) const
+    {
+      return const_iterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+    }
+
+    // Disable copy construction.
+    iflat_unordered_map(const iflat_unordered_map&);
+
+    /// The slots that hold the elements.
+    value_type* pslots;
+
+    /// The control bytes, one per slot.
+    int8_t* pcontrol;
+
+    /// The number of slots. A power of 2.
+    const size_t number_of_slots;
+
+    /// The maximum number of elements.
+    const size_t max_elements;
+
+    /// The number of full and deleted slots.
+    size_t number_of_elements;
+    size_t number_of_deleted;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_UNORDERED_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_unordered_map()
+    {
+    }
+#else
+  protected:
+    ~iflat_unordered_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first flat_unordered_map.
+  ///\param rhs Reference to the second flat_unordered_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual, typename TGroup>
+  bool operator ==(const etl::iflat_unordered_map<TKey, T, THash, TKeyEqual, TGroup>& lhs,
+                   const etl::iflat_unordered_map<TKey, T, THash, TKeyEqual, TGroup>& rhs)
+  {
+    const bool sizes_match = (lhs.size() == rhs.size());
+    bool elements_match = true;
+
+    typedef typename etl::iflat_unordered_map<TKey, T, THash, TKeyEqual, TGroup>::const_iterator itr_t;
+
+    if (sizes_match)
+    {
+      itr_t l_begin = lhs.begin();
+      itr_t l_end   = lhs.end();
+
+      while ((l_begin != l_end) && elements_match)
+      {
+        // See if the lhs key exists in the rhs.
+        itr_t ir = rhs.find(l_begin->first);
+
+        elements_match = (ir != rhs.end()) && (ir->second == l_begin->second);
+
+        ++l_begin;
+      }
+    }
+
+    return (sizes_match && elements_match);
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_unordered_map.
+  ///\param rhs Reference to the second flat_unordered_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual, typename TGroup>
+  bool operator !=(const etl::iflat_unordered_map<TKey, T, THash, TKeyEqual, TGroup>& lhs,
+                   const etl::iflat_unordered_map<TKey, T, THash, TKeyEqual, TGroup>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_unordered_map implementation that uses a fixed size buffer.
+  /// The number of slots is a power of 2, sized so that the table is never more than 7/8 full.
+  /// TGroup selects how groups of control bytes are matched; one of
+  /// etl::hash_table_group_scalar, etl::hash_table_group_sse2 or etl::hash_table_group_neon.
+  /// The default is the fastest available for the target.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TGroup = etl::hash_table_group_default>
+  class flat_unordered_map : public etl::iflat_unordered_map<TKey, TValue, THash, TKeyEqual, TGroup>
+  {
+  private:
+
+    typedef iflat_unordered_map<TKey, TValue, THash, TKeyEqual, TGroup> base;
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "Zero capacity flat_unordered_map");
+
+    static ETL_CONSTANT size_t MIN_SLOTS = ((MAX_SIZE_ * 8U) + 6U) / 7U;
+
+  public:
+
+    typedef typename base::value_type value_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+    static ETL_CONSTANT size_t SLOTS    = etl::power_of_2_round_up<(MIN_SLOTS < TGroup::Width) ? TGroup::Width : MIN_SLOTS>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<value_type*>(&buffer), control, SLOTS, MAX_SIZE_, hash, equal)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_unordered_map(const flat_unordered_map& other)
+      : base(reinterpret_cast<value_type*>(&buffer), control, SLOTS, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      base::initialise();
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_unordered_map(flat_unordered_map&& other)
+      : base(reinterpret_cast<value_type*>(&buffer), control, SLOTS, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      base::initialise();
+
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_unordered_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<value_type*>(&buffer), control, SLOTS, MAX_SIZE_, hash, equal)
+    {
+      base::initialise();
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<value_type*>(&buffer), control, SLOTS, MAX_SIZE_, hash, equal)
+    {
+      base::initialise();
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_unordered_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_unordered_map& operator = (const flat_unordered_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_unordered_map& operator = (flat_unordered_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The slots that hold the elements.
+    typename etl::aligned_storage<sizeof(value_type) * SLOTS, etl::alignment_of<value_type>::value>::type buffer;
+
+    /// The control bytes.
+    int8_t control[SLOTS];
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  flat_unordered_map(TPairs...) -> flat_unordered_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                      typename etl::nth_type_t<0, TPairs...>::second_type,
+                                                      sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... TPairs>
+  constexpr auto make_flat_unordered_map(TPairs&&... pairs) -> etl::flat_unordered_map<TKey, T, sizeof...(TPairs), THash, TKeyEqual>
+  {
+    return { etl::forward<TPairs>(pairs)... };
+  }
+#endif
+}
+
+#endif
@@ -0,0 +1,768 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FORMAT_INCLUDED
+#define ETL_FORMAT_INCLUDED
+
+///\ingroup string
+
+#include "platform.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "string.h"
+#include "string_view.h"
+#include "format_spec.h"
+#include "private/to_string_helper.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP14
+
+// Format strings are always parsed by the compiler from C++20.
+#if ETL_USING_CPP20 && !defined(ETL_FORCE_NO_ADVANCED_CPP)
+  #define ETL_FORMAT_STRING_CONSTRUCTOR consteval
+#else
+  #define ETL_FORMAT_STRING_CONSTRUCTOR constexpr
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for format exceptions.
+  ///\ingroup string
+  //***************************************************************************
+  class format_exception : public etl::exception
+  {
+  public:
+
+    format_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception raised when a format string is invalid.
+  /// Only raised at run time for format strings parsed at run time.
+  ///\ingroup string
+  //***************************************************************************
+  class format_invalid_string : public etl::format_exception
+  {
+  public:
+
+    format_invalid_string(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:invalid string", ETL_FORMAT_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_format
+  {
+    //***************************************************************************
+    /// How an argument type is formatted.
+    //***************************************************************************
+    enum argument_kind
+    {
+      Kind_Bool,
+      Kind_Char,
+      Kind_Integral,
+      Kind_Floating_Point,
+      Kind_String,
+      Kind_Pointer,
+      Kind_Unsupported
+    };
+
+    //***************************************************************************
+    /// The kind of an argument type.
+    //***************************************************************************
+    template <typename T>
+    constexpr argument_kind kind_of()
+    {
+      typedef typename etl::decay<T>::type type;
+
+      return etl::is_same<type, bool>::value                                  ? Kind_Bool
+           : etl::is_same<type, char>::value                                  ? Kind_Char
+           : etl::is_integral<type>::value                                    ? Kind_Integral
+           : etl::is_floating_point<type>::value                              ? Kind_Floating_Point
+           : etl::is_same<type, const char*>::value                           ? Kind_String
+           : etl::is_same<type, char*>::value                                 ? Kind_String
+           : etl::is_same<type, etl::string_view>::value                      ? Kind_String
+           : etl::is_base_of<etl::istring, type>::value                       ? Kind_String
+           : etl::is_pointer<type>::value                                     ? Kind_Pointer
+           : Kind_Unsupported;
+    }
+
+    //***************************************************************************
+    /// Returns true if all of the argument types can be formatted.
+    //***************************************************************************
+    template <typename... TArgs>
+    constexpr bool are_supported()
+    {
+      const argument_kind kinds[] = { Kind_Bool, kind_of<TArgs>()... };
+
+      for (size_t i = 0U; i < (sizeof...(TArgs) + 1U); ++i)
+      {
+        if (kinds[i] == Kind_Unsupported)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Selects the overload that formats an argument kind.
+    //***************************************************************************
+    template <argument_kind Kind>
+    struct kind_tag
+    {
+    };
+
+    //***************************************************************************
+    /// Called for an invalid format string.
+    /// Not constexpr, so an invalid string parsed by the compiler fails to compile.
+    //***************************************************************************
+    inline void invalid_format_string()
+    {
+      ETL_ASSERT_FAIL(ETL_ERROR(etl::format_invalid_string));
+    }
+
+    //***************************************************************************
+    /// A replacement field and the literal text that precedes it.
+    //***************************************************************************
+    struct field
+    {
+      constexpr field()
+        : text_offset(0U)
+        , text_length(0U)
+        , has_escapes(false)
+        , has_precision(false)
+        , is_zero_padded(false)
+        , type('\0')
+        , spec()
+      {
+      }
+
+      size_t           text_offset;    ///< The start of the preceding text.
+      size_t           text_length;    ///< The length of the preceding text.
+      bool             has_escapes;    ///< The preceding text contains '{{' or '}}'.
+      bool             has_precision;  ///< A precision was specified.
+      bool             is_zero_padded; ///< Pad with zeros after any sign or base prefix.
+      char             type;           ///< The presentation type, or '\0' for the default.
+      etl::format_spec spec;           ///< The format applied to the argument.
+    };
+
+    //***************************************************************************
+    /// Appends literal text, replacing '{{' and '}}' with '{' and '}'.
+    //***************************************************************************
+    inline void append_text(etl::istring& str, const char* text, size_t length, bool has_escapes)
+    {
+      if (!has_escapes)
+      {
+        str.append(text, length);
+        return;
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        str.push_back(text[i]);
+
+        if ((text[i] == '{') || (text[i] == '}'))
+        {
+          // Skip the second of the pair.
+          ++i;
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Inserts zeros after any sign and base prefix to pad to the field width.
+    //***************************************************************************
+    inline void add_zero_padding(etl::istring& str, size_t start, const field& f)
+    {
+      const size_t width  = f.spec.get_width();
+      const size_t length = str.size() - start;
+
+      if (length >= width)
+      {
+        return;
+      }
+
+      size_t digits = start;
+
+      if ((digits < str.size()) && (str[digits] == '-'))
+      {
+        ++digits;
+      }
+
+      if (f.spec.is_show_base() && (f.spec.get_base() != 10U) && ((digits + 1U) < str.size()) && (str[digits] == '0'))
+      {
+        // 0x, 0b or the octal 0.
+        digits += (f.spec.get_base() == 8U) ? 1U : 2U;
+      }
+
+      str.insert(str.begin() + digits, width - length, '0');
+    }
+
+    //***************************************************************************
+    /// The text of a string argument.
+    //***************************************************************************
+    inline etl::string_view to_view(const char* value)
+    {
+      return etl::string_view(value);
+    }
+
+    inline etl::string_view to_view(etl::string_view value)
+    {
+      return value;
+    }
+
+    inline etl::string_view to_view(const etl::istring& value)
+    {
+      return etl::string_view(value.data(), value.size());
+    }
+
+    //***************************************************************************
+    /// Formats a bool as true or false, or as an integer.
+    //***************************************************************************
+    template <typename T>
+    void format_argument(etl::istring& str, const field& f, const T& value, kind_tag<Kind_Bool>)
+    {
+      etl::private_to_string::add_boolean(bool(value), str, f.spec, true);
+    }
+
+    //***************************************************************************
+    /// Formats an integral.
+    //***************************************************************************
+    template <typename T>
+    void format_argument(etl::istring& str, const field& f, const T& value, kind_tag<Kind_Integral>)
+    {
+      // Types wider than 32 bits use the 64 bit conversion.
+      typedef typename etl::conditional<etl::is_signed<T>::value, int32_t, uint32_t>::type type32_t;
+#if ETL_USING_64BIT_TYPES
+      typedef typename etl::conditional<etl::is_signed<T>::value, int64_t, uint64_t>::type type64_t;
+      typedef typename etl::conditional<(sizeof(T) > sizeof(type32_t)), type64_t, type32_t>::type type;
+#else
+      typedef type32_t type;
+#endif
+
+      const size_t start = str.size();
+
+      if (f.is_zero_padded)
+      {
+        etl::format_spec spec = f.spec;
+
+        etl::private_to_string::add_integral(type(value), str, spec.width(0U), true, etl::is_negative(value));
+        add_zero_padding(str, start, f);
+      }
+      else
+      {
+        etl::private_to_string::add_integral(type(value), str, f.spec, true, etl::is_negative(value));
+      }
+    }
+
+    //***************************************************************************
+    /// Formats a char as a character, or as an integer.
+    //***************************************************************************
+    template <typename T>
+    void format_argument(etl::istring& str, const field& f, const T& value, kind_tag<Kind_Char>)
+    {
+      if ((f.type == '\0') || (f.type == 'c'))
+      {
+        const char c = value;
+
+        etl::private_to_string::add_string_view(etl::string_view(&c, 1U), str, f.spec, true);
+      }
+      else
+      {
+        format_argument(str, f, static_cast<int>(value), kind_tag<Kind_Integral>());
+      }
+    }
+
+    //***************************************************************************
+    /// Formats a floating point value.
+    //***************************************************************************
+    template <typename T>
+    void format_argument(etl::istring& str, const field& f, const T& value, kind_tag<Kind_Floating_Point>)
+    {
+      const size_t start = str.size();
+
+      if (f.is_zero_padded)
+      {
+        etl::format_spec spec = f.spec;
+
+        etl::private_to_string::add_floating_point(value, str, spec.width(0U), true);
+        add_zero_padding(str, start, f);
+      }
+      else
+      {
+        etl::private_to_string::add_floating_point(value, str, f.spec, true);
+      }
+    }
+
+    //***************************************************************************
+    /// Formats a string, truncated to the precision, if specified.
+    //***************************************************************************
+    template <typename T>
+    void format_argument(etl::istring& str, const field& f, const T& value, kind_tag<Kind_String>)
+    {
+      etl::string_view view = to_view(value);
+
+      if (f.has_precision && (view.size() > f.spec.get_precision()))
+      {
+        view = view.substr(0U, f.spec.get_precision());
+      }
+
+      etl::private_to_string::add_string_view(view, str, f.spec, true);
+    }
+
+    //***************************************************************************
+    /// Formats a pointer in hexadecimal.
+    //***************************************************************************
+    template <typename T>
+    void format_argument(etl::istring& str, const field& f, const T& value, kind_tag<Kind_Pointer>)
+    {
+      etl::private_to_string::add_pointer(value, str, f.spec, true);
+    }
+  }
+
+  //***************************************************************************
+  /// A format string for the argument types TArgs, parsed when constructed.
+  /// Replacement fields have the form {} or {:[[fill]align][#][0][width][.precision][type]}.
+  /// align      '<' left or '>' right. Text is left aligned by default, numbers right.
+  /// #          Show the base prefix of binary, octal and hexadecimal integers.
+  /// 0          Pad with zeros after any sign and base prefix.
+  /// .precision Digits after the radix point, or the maximum length of a string.
+  /// type       b B o d x X for integrals, bool and char.
+  ///            c for char, s for bool and strings, f for floating point, p for pointers.
+  /// Floating point values without a precision use the shortest round trip
+  /// format, if available. '{{' and '}}' are literal braces.
+  /// From C++20 the string is always parsed by the compiler, and an invalid
+  /// string fails to compile. Before C++20 the same is guaranteed by
+  /// declaring the format_string constexpr.
+  ///\ingroup string
+  //***************************************************************************
+  template <typename... TArgs>
+  class format_string
+  {
+  public:
+
+    static constexpr size_t Number_Of_Arguments = sizeof...(TArgs);
+
+    //*************************************************************************
+    /// Parses a string literal.
+    //*************************************************************************
+    template <size_t Length>
+    ETL_FORMAT_STRING_CONSTRUCTOR format_string(const char (&text_)[Length])
+      : p_text(text_)
+      , fields()
+      , is_valid_string(true)
+    {
+      parse(Length - 1U);
+    }
+
+    //*************************************************************************
+    /// The replacement field for an argument, or the trailing text when
+    /// index == Number_Of_Arguments.
+    //*************************************************************************
+    constexpr const private_format::field& field(size_t index) const
+    {
+      return fields[index];
+    }
+
+    //*************************************************************************
+    /// The original text.
+    //*************************************************************************
+    constexpr const char* text() const
+    {
+      return p_text;
+    }
+
+    //*************************************************************************
+    /// Returns false if the string could not be parsed.
+    //*************************************************************************
+    constexpr bool is_valid() const
+    {
+      return is_valid_string;
+    }
+
+  private:
+
+    //*************************************************************************
+    constexpr void fail()
+    {
+      is_valid_string = false;
+      private_format::invalid_format_string();
+    }
+
+    //*************************************************************************
+    static constexpr bool is_digit(char c)
+    {
+      return (c >= '0') && (c <= '9');
+    }
+
+    //*************************************************************************
+    /// Reads a number of up to 255.
+    //*************************************************************************
+    constexpr uint32_t parse_number(size_t& i, size_t length)
+    {
+      uint32_t value = 0U;
+
+      while ((i < length) && is_digit(p_text[i]))
+      {
+        value = (value * 10U) + uint32_t(p_text[i] - '0');
+        ++i;
+
+        if (value > 255U)
+        {
+          fail();
+          return 0U;
+        }
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    static constexpr void set_alignment(private_format::field& f, char align)
+    {
+      if (align == '<')
+      {
+        f.spec.left();
+      }
+      else
+      {
+        f.spec.right();
+      }
+    }
+
+    //*************************************************************************
+    /// Parses the format specification after the ':' of a field.
+    //*************************************************************************
+    constexpr void parse_spec(size_t& i, size_t length, private_format::field& f)
+    {
+      // [[fill]align]
+      if (((i + 1U) < length) && ((p_text[i + 1U] == '<') || (p_text[i + 1U] == '>')) &&
+          (p_text[i] != '{') && (p_text[i] != '}'))
+      {
+        f.spec.fill(p_text[i]);
+        set_alignment(f, p_text[i + 1U]);
+        i += 2U;
+      }
+      else if ((i < length) && ((p_text[i] == '<') || (p_text[i] == '>')))
+      {
+        set_alignment(f, p_text[i]);
+        ++i;
+      }
+      else if ((i < length) && ((p_text[i] == '^') || (p_text[i] == '+') || (p_text[i] == ' ')))
+      {
+        // Centring and sign options are not supported.
+        fail();
+        return;
+      }
+
+      // #
+      if ((i < length) && (p_text[i] == '#'))
+      {
+        f.spec.show_base(true);
+        ++i;
+      }
+
+      // 0
+      if ((i < length) && (p_text[i] == '0'))
+      {
+        f.is_zero_padded = true;
+        ++i;
+      }
+
+      // width
+      f.spec.width(parse_number(i, length));
+
+      // .precision
+      if ((i < length) && (p_text[i] == '.'))
+      {
+        ++i;
+
+        if ((i >= length) || !is_digit(p_text[i]))
+        {
+          fail();
+          return;
+        }
+
+        f.has_precision = true;
+        f.spec.precision(parse_number(i, length));
+      }
+
+      // type
+      if ((i < length) && (p_text[i] != '}'))
+      {
+        f.type = p_text[i];
+        ++i;
+      }
+    }
+
+    //*************************************************************************
+    /// Checks the presentation type against the argument, and completes the spec.
+    //*************************************************************************
+    constexpr void apply_type(private_format::field& f, private_format::argument_kind kind, bool is_aligned)
+    {
+      using namespace etl::private_format;
+
+      const char t = f.type;
+
+      const bool is_integer_type = (t == 'b') || (t == 'B') || (t == 'o') || (t == 'd') || (t == 'x') || (t == 'X');
+      const bool is_text         = ((kind == Kind_Bool)   && ((t == '\0') || (t == 's'))) ||
+                                   ((kind == Kind_Char)   && ((t == '\0') || (t == 'c'))) ||
+                                   (kind == Kind_String);
+
+      bool is_valid_type = false;
+
+      switch (kind)
+      {
+        case Kind_Bool:
+        {
+          is_valid_type = is_text || is_integer_type;
+          f.spec.boolalpha(is_text);
+          break;
+        }
+
+        case Kind_Char:
+        case Kind_Integral:
+        {
+          is_valid_type = is_text || (t == '\0') || is_integer_type;
+          break;
+        }
+
+        case Kind_Floating_Point:
+        {
+          is_valid_type = (t == '\0') || (t == 'f');
+
+          if (!f.has_precision)
+          {
+#if ETL_HAS_SHORTEST_FLOAT_FORMAT
+            f.spec.shortest(true);
+#else
+            f.spec.precision(6U);
+#endif
+          }
+          break;
+        }
+
+        case Kind_String:
+        {
+          is_valid_type = (t == '\0') || (t == 's');
+          break;
+        }
+
+        case Kind_Pointer:
+        {
+          is_valid_type = (t == '\0') || (t == 'p');
+          f.spec.hex().show_base(true);
+          break;
+        }
+
+        default:
+        {
+          break;
+        }
+      }
+
+      if (!is_valid_type ||
+          (f.is_zero_padded && (is_text || (kind == Kind_Pointer))) ||
+          (f.has_precision && (kind != Kind_Floating_Point) && (kind != Kind_String)))
+      {
+        fail();
+        return;
+      }
+
+      if (is_integer_type)
+      {
+        f.spec.base((t == 'b') || (t == 'B') ? 2U : (t == 'o') ? 8U : (t == 'd') ? 10U : 16U);
+        f.spec.upper_case((t == 'B') || (t == 'X'));
+      }
+
+      if (is_text && !is_aligned)
+      {
+        f.spec.left();
+      }
+    }
+
+    //*************************************************************************
+    /// Splits the string into literal text and replacement fields.
+    //*************************************************************************
+    constexpr void parse(size_t length)
+    {
+      constexpr private_format::argument_kind kinds[Number_Of_Arguments + 1U] = { private_format::kind_of<TArgs>()..., private_format::Kind_Unsupported };
+
+      size_t index       = 0U;
+      size_t text_start  = 0U;
+      bool   has_escapes = false;
+      size_t i           = 0U;
+
+      while (i < length)
+      {
+        const char c = p_text[i];
+
+        if ((c == '{') || (c == '}'))
+        {
+          if (((i + 1U) < length) && (p_text[i + 1U] == c))
+          {
+            // A literal brace.
+            has_escapes = true;
+            i += 2U;
+            continue;
+          }
+
+          if ((c == '}') || (index == Number_Of_Arguments))
+          {
+            fail();
+            return;
+          }
+
+          private_format::field& f = fields[index];
+
+          f.text_offset = text_start;
+          f.text_length = i - text_start;
+          f.has_escapes = has_escapes;
+
+          ++i;
+
+          bool is_aligned = false;
+
+          if ((i < length) && (p_text[i] == ':'))
+          {
+            ++i;
+            is_aligned = ((i < length) && ((p_text[i] == '<') || (p_text[i] == '>'))) ||
+                         (((i + 1U) < length) && ((p_text[i + 1U] == '<') || (p_text[i + 1U] == '>')));
+            parse_spec(i, length, f);
+          }
+
+          if ((i >= length) || (p_text[i] != '}') || !is_valid_string)
+          {
+            fail();
+            return;
+          }
+
+          apply_type(f, kinds[index], is_aligned);
+
+          ++i;
+          ++index;
+          text_start  = i;
+          has_escapes = false;
+        }
+        else
+        {
+          ++i;
+        }
+      }
+
+      if (index != Number_Of_Arguments)
+      {
+        fail();
+        return;
+      }
+
+      fields[Number_Of_Arguments].text_offset = text_start;
+      fields[Number_Of_Arguments].text_length = length - text_start;
+      fields[Number_Of_Arguments].has_escapes = has_escapes;
+    }
+
+    const char*            p_text;
+    private_format::field  fields[Number_Of_Arguments + 1U];
+    bool                   is_valid_string;
+  };
+
+  template <typename... TArgs>
+  constexpr size_t format_string<TArgs...>::Number_Of_Arguments;
+
+  namespace private_format
+  {
+    //***************************************************************************
+    /// Appends the text before the field, then the argument.
+    //***************************************************************************
+    template <typename TFormat, typename T>
+    void format_field(etl::istring& str, const TFormat& fmt, size_t index, const T& value)
+    {
+      const field& f = fmt.field(index);
+
+      append_text(str, fmt.text() + f.text_offset, f.text_length, f.has_escapes);
+      format_argument(str, f, value, kind_tag<kind_of<T>()>());
+    }
+
+    //***************************************************************************
+    template <typename TFormat, size_t... Indices, typename... TArgs>
+    void format_fields(etl::istring& str, const TFormat& fmt, etl::index_sequence<Indices...>, const TArgs&... args)
+    {
+      (void)fmt;
+      (void)str;
+
+      int expand[] = { 0, (format_field(str, fmt, Indices, args), 0)... };
+      (void)expand;
+    }
+  }
+
+  //***************************************************************************
+  /// Appends the arguments to str, as described by the format string.
+  /// \code
+  /// etl::format_to(text, "{} = {:#06x}", name, value);
+  /// \endcode
+  /// The format string is parsed into a sequence of format specs for the
+  /// etl::to_string conversions, so formatting does no parsing.
+  ///\ingroup string
+  //***************************************************************************
+  template <typename... TArgs>
+  etl::istring& format_to(etl::istring& str, const etl::format_string<etl::type_identity_t<TArgs>...>& fmt, const TArgs&... args)
+  {
+    ETL_STATIC_ASSERT((private_format::are_supported<TArgs...>()), "Unsupported argument type");
+
+    if (fmt.is_valid())
+    {
+      typedef etl::format_string<etl::type_identity_t<TArgs>...> format_type;
+
+      private_format::format_fields(str, fmt, etl::make_index_sequence<sizeof...(TArgs)>(), args...);
+
+      const private_format::field& trailing = fmt.field(format_type::Number_Of_Arguments);
+
+      private_format::append_text(str, fmt.text() + trailing.text_offset, trailing.text_length, trailing.has_escapes);
+    }
+
+    return str;
+  }
+}
+
+#undef ETL_FORMAT_STRING_CONSTRUCTOR
+
+#endif
+#endif
@@ -32,6 +32,7 @@ SOFTWARE.
 #include "iterator.h"
 
 #include <stdint.h>
+#include <string.h>
 
 ETL_STATIC_ASSERT(ETL_USING_8BIT_TYPES, "This file does not currently support targets with no 8bit type");
 
@@ -86,6 +87,71 @@ namespace etl
 
       TFrame_Check_Sequence* p_fcs;
     };
+
+    //***************************************************
+    /// has_block_add
+    /// Detects whether a policy supplies
+    /// value_type add(value_type, const uint8_t*, size_t) const
+    //***************************************************
+    template <typename TPolicy>
+    class has_block_add
+    {
+    private:
+
+      typedef char yes;
+      struct no { char x[2]; };
+
+      typedef typename TPolicy::value_type value_type;
+
+      template <typename U>
+      static yes test(char(*)[sizeof(static_cast<value_type (U::*)(value_type, const uint8_t*, size_t) const>(&U::add))]);
+
+      template <typename U>
+      static no test(...);
+
+    public:
+
+      static ETL_CONSTANT bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
+
+    template <typename TPolicy>
+    ETL_CONSTANT bool has_block_add<TPolicy>::value;
+
+    //***************************************************
+    /// word_access
+    /// Helpers for policies that process a block of data
+    /// a word at a time.
+    //***************************************************
+    struct word_access
+    {
+#if ETL_USING_64BIT_TYPES && ETL_PLATFORM_64BIT
+      typedef uint64_t word_type;
+#else
+      typedef uint32_t word_type;
+#endif
+
+      //***********************************
+      /// The number of bytes before p_data is word aligned, limited to length.
+      //***********************************
+      static size_t head_length(const uint8_t* p_data, size_t length)
+      {
+        const size_t misalignment = static_cast<size_t>(reinterpret_cast<uintptr_t>(p_data) % sizeof(word_type));
+        const size_t head         = (misalignment == 0U) ? 0U : sizeof(word_type) - misalignment;
+
+        return (head < length) ? head : length;
+      }
+
+      //***********************************
+      /// Loads a word. Compiles to a single load when p_data is aligned.
+      //***********************************
+      static word_type load(const uint8_t* p_data)
+      {
+        word_type word;
+        memcpy(&word, p_data, sizeof(word_type));
+
+        return word;
+      }
+    };
   }
 
   //***************************************************************************
@@ -144,11 +210,9 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin);
-        ++begin;
-      }
+      typedef etl::integral_constant<bool, etl::is_segmented_iterator<TIterator>::value> is_segmented;
+
+      add_iterators(begin, end, is_segmented());
     }
 
     //*************************************************************************
@@ -159,6 +223,21 @@ namespace etl
       frame_check = policy.add(frame_check, value_);
     }
 
+    //*************************************************************************
+    /// Adds a block of memory.
+    /// Policies that supply a block add process it in one call.
+    /// \param p_data Pointer to the data.
+    /// \param length The number of bytes.
+    //*************************************************************************
+    void add(const void* p_data, size_t length)
+    {
+      typedef etl::integral_constant<bool, private_frame_check_sequence::has_block_add<policy_type>::value> use_block_add;
+
+      const uint8_t* p_begin = static_cast<const uint8_t*>(p_data);
+
+      add_range(p_begin, p_begin + length, use_block_add());
+    }
+
     //*************************************************************************
     /// Gets the FCS value.
     //*************************************************************************
@@ -185,6 +264,56 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range that is not segmented.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_iterators(TIterator begin, const TIterator end, etl::false_type)
+    {
+      typedef etl::integral_constant<bool, etl::is_pointer<TIterator>::value &&
+                                           private_frame_check_sequence::has_block_add<policy_type>::value> use_block_add;
+
+      add_range(begin, end, use_block_add());
+    }
+
+    //*************************************************************************
+    /// Adds a segmented range, one contiguous segment at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_iterators(TIterator begin, const TIterator end, etl::true_type)
+    {
+      while (begin != end)
+      {
+        const size_t n = begin.segment_size(end);
+        typename TIterator::segment_pointer p = begin.segment_begin();
+
+        add(p, p + n);
+        begin.segment_advance(n);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin);
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range in one call to the policy's block add.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      frame_check = policy.add(frame_check, reinterpret_cast<const uint8_t*>(begin), size_t(end - begin));
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
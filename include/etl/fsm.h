@@ -52,6 +52,7 @@ SOFTWARE.
 #define ETL_FSM_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
 #include "array.h"
 #include "nullptr.h"
 #include "error_handler.h"
@@ -287,7 +288,8 @@ namespace etl
       p_context(ETL_NULLPTR),
       p_parent(ETL_NULLPTR),
       p_active_child(ETL_NULLPTR),
-      p_default_child(ETL_NULLPTR)
+      p_default_child(ETL_NULLPTR),
+      depth(0U)
     {
     }
 
@@ -332,6 +334,9 @@ namespace etl
     // A pointer to the default active child.
     ifsm_state* p_default_child;
 
+    // The depth of this state in the hierarchy. Cached by the HFSM when it starts.
+    etl::fsm_state_id_t depth;
+
     // Disabled.
     ifsm_state(const ifsm_state&);
     ifsm_state& operator =(const ifsm_state&);
@@ -429,6 +434,7 @@ namespace etl
           {
             p_state->on_exit_state();
             p_state = p_next_state;
+            ETL_TRACE(etl::trace_event::fsm_transition, this, p_state->get_state_id());
 
             next_state_id = p_state->on_enter_state();
 
@@ -451,6 +457,19 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Handles a batch of messages, in order.
+    /// A class that overrides receive(const etl::imessage&) must also
+    /// override this.
+    //*******************************************
+    void receive(message_span_t messages) ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        fsm::receive(*messages[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -624,899 +643,15 @@ namespace etl
   template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_, typename... TMessageTypes>
   ETL_CONSTANT etl::fsm_state_id_t fsm_state<TContext, TDerived, STATE_ID_, TMessageTypes...>::STATE_ID;
 
-#else
+#endif
+}
+
+#if !ETL_USING_CPP17 || defined(ETL_FSM_FORCE_CPP03_IMPLEMENTATION)
 //*************************************************************************************************
 // For C++14 and below.
 //*************************************************************************************************
-  //***************************************************************************
-  // The definition for all 16 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1 = void, typename T2 = void, typename T3 = void, typename T4 = void,
-            typename T5 = void, typename T6 = void, typename T7 = void, typename T8 = void,
-            typename T9 = void, typename T10 = void, typename T11 = void, typename T12 = void,
-            typename T13 = void, typename T14 = void, typename T15 = void, typename T16 = void>
-  class fsm_state : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
-        case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
-        case T12::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T12&>(message)); break;
-        case T13::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T13&>(message)); break;
-        case T14::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T14&>(message)); break;
-        case T15::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T15&>(message)); break;
-        case T16::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T16&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 15 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12,
-            typename T13, typename T14, typename T15>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
-        case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
-        case T12::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T12&>(message)); break;
-        case T13::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T13&>(message)); break;
-        case T14::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T14&>(message)); break;
-        case T15::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T15&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 14 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12,
-            typename T13, typename T14>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
-        case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
-        case T12::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T12&>(message)); break;
-        case T13::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T13&>(message)); break;
-        case T14::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T14&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 13 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12,
-            typename T13>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
-        case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
-        case T12::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T12&>(message)); break;
-        case T13::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T13&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 12 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
-        case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
-        case T12::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T12&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 11 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
-        case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 10 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 9 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, T9, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 8 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 7 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, void, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 6 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, void, void, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 5 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, void, void, void, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 4 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, void, void, void, void, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 3 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, void, void, void, void, void, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 2 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, T2, void, void, void, void, void, void, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 1 message type.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1>
-  class fsm_state<TContext, TDerived, STATE_ID_, T1, void, void, void, void, void, void, void, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      etl::fsm_state_id_t new_state_id;
-      etl::message_id_t event_id = message.get_message_id();
-
-      switch (event_id)
-      {
-        case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
-      }
-
-      return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 0 message types.
-  //***************************************************************************
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_>
-  class fsm_state<TContext, TDerived, STATE_ID_, void, void, void, void, void, void, void, void, void, void, void, void, void, void, void, void> : public ifsm_state
-  {
-  public:
-
-    static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;
-
-    fsm_state()
-      : ifsm_state(STATE_ID)
-    {
-    }
-
-  protected:
-
-    ~fsm_state()
-    {
-    }
-
-    TContext& get_fsm_context() const
-    {
-      return static_cast<TContext&>(ifsm_state::get_fsm_context());
-    }
-  private:
-
-    etl::fsm_state_id_t process_event(const etl::imessage& message)
-    {
-      return p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);
-    }
-  };
-
-  template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12,
-            typename T13, typename T14, typename T15, typename T16>
-  ETL_CONSTANT etl::fsm_state_id_t fsm_state<TContext, TDerived, STATE_ID_, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::STATE_ID;
+  #include "private/fsm_legacy.h"
 #endif
-}
 
 #include "private/minmax_pop.h"
 
@@ -0,0 +1,305 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FUSED_FCS_INCLUDED
+#define ETL_FUSED_FCS_INCLUDED
+
+#include "platform.h"
+#include "frame_check_sequence.h"
+#include "type_traits.h"
+#include "iterator.h"
+#include "nth_type.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if ETL_USING_CPP11
+
+//*****************************************************************************
+/// The number of bytes passed to each frame check sequence in turn.
+/// Small enough that the block is still in the data cache when the last one
+/// reads it.
+//*****************************************************************************
+#if !defined(ETL_FUSED_FCS_BLOCK_SIZE)
+  #define ETL_FUSED_FCS_BLOCK_SIZE 512U
+#endif
+
+///\ingroup frame_check_sequence
+
+namespace etl
+{
+  namespace private_fused_fcs
+  {
+    //***************************************************
+    /// Gets the frame check sequence type for T.
+    /// T may be a frame check sequence, such as etl::crc32,
+    /// or a policy, which is wrapped in etl::frame_check_sequence.
+    //***************************************************
+    template <typename T, typename = void>
+    struct fcs_type
+    {
+      typedef etl::frame_check_sequence<T> type;
+    };
+
+    template <typename T>
+    struct fcs_type<T, typename etl::enable_if<etl::is_base_of<etl::frame_check_sequence<typename T::policy_type>, T>::value>::type>
+    {
+      typedef T type;
+    };
+
+    //***************************************************
+    /// Holds the frame check sequences.
+    //***************************************************
+    template <typename... TFcs>
+    struct fcs_list;
+
+    template <>
+    struct fcs_list<>
+    {
+      void reset()
+      {
+      }
+
+      void add(uint8_t)
+      {
+      }
+
+      void add(const uint8_t*, size_t)
+      {
+      }
+    };
+
+    template <typename THead, typename... TTail>
+    struct fcs_list<THead, TTail...> : public fcs_list<TTail...>
+    {
+      typedef fcs_list<TTail...> base_t;
+
+      void reset()
+      {
+        head.reset();
+        base_t::reset();
+      }
+
+      void add(uint8_t value)
+      {
+        head.add(value);
+        base_t::add(value);
+      }
+
+      void add(const uint8_t* p_data, size_t length)
+      {
+        head.add(p_data, length);
+        base_t::add(p_data, length);
+      }
+
+      THead head;
+    };
+
+    //***************************************************
+    /// Gets the Nth frame check sequence from the list.
+    //***************************************************
+    template <size_t N>
+    struct fcs_get
+    {
+      template <typename THead, typename... TTail>
+      static const typename etl::nth_type<N - 1U, TTail...>::type& get(const fcs_list<THead, TTail...>& list)
+      {
+        return fcs_get<N - 1U>::get(static_cast<const fcs_list<TTail...>&>(list));
+      }
+    };
+
+    template <>
+    struct fcs_get<0U>
+    {
+      template <typename THead, typename... TTail>
+      static const THead& get(const fcs_list<THead, TTail...>& list)
+      {
+        return list.head;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Calculates several frame check sequences in one pass over the data.
+  /// Each type may be a frame check sequence, such as etl::crc32,
+  /// etl::checksum<uint16_t> or etl::fnv_1a_32, or a frame check sequence policy.
+  /// Contiguous data is passed to each in turn in blocks of
+  /// ETL_FUSED_FCS_BLOCK_SIZE bytes, so that each reads it from the cache.
+  ///\tparam TFcs The frame check sequences or policies.
+  ///\ingroup frame_check_sequence
+  //***************************************************************************
+  template <typename... TFcs>
+  class fused_fcs
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TFcs) != 0U, "No frame check sequences");
+
+    /// The number of frame check sequences.
+    static ETL_CONSTANT size_t Size = sizeof...(TFcs);
+
+    /// The type of the Nth frame check sequence.
+    template <size_t N>
+    using fcs_type = typename etl::nth_type<N, typename private_fused_fcs::fcs_type<TFcs>::type...>::type;
+
+    /// The value type of the Nth frame check sequence.
+    template <size_t N>
+    using value_type = typename fcs_type<N>::value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fused_fcs()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    fused_fcs(TIterator begin, const TIterator end)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets all of the frame check sequences to their initial state.
+    //*************************************************************************
+    void reset()
+    {
+      fcs.reset();
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// Ranges of pointers are added in blocks.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template <typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
+
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// \param value The uint8_t to add to all of the frame check sequences.
+    //*************************************************************************
+    void add(uint8_t value)
+    {
+      fcs.add(value);
+    }
+
+    //*************************************************************************
+    /// Adds a block of memory.
+    /// \param p_data Pointer to the data.
+    /// \param length The number of bytes.
+    //*************************************************************************
+    void add(const void* p_data, size_t length)
+    {
+      const uint8_t* p = static_cast<const uint8_t*>(p_data);
+
+      while (length != 0U)
+      {
+        const size_t block_length = (length < Block_Size) ? length : size_t(Block_Size);
+
+        fcs.add(p, block_length);
+
+        p      += block_length;
+        length -= block_length;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the Nth frame check sequence.
+    //*************************************************************************
+    template <size_t N>
+    const fcs_type<N>& get() const
+    {
+      ETL_STATIC_ASSERT(N < Size, "Index out of range");
+
+      return private_fused_fcs::fcs_get<N>::get(fcs);
+    }
+
+    //*************************************************************************
+    /// Gets the value of the Nth frame check sequence.
+    //*************************************************************************
+    template <size_t N>
+    value_type<N> value() const
+    {
+      return get<N>().value();
+    }
+
+  private:
+
+    enum
+    {
+      Block_Size = ETL_FUSED_FCS_BLOCK_SIZE
+    };
+
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        fcs.add(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range in blocks.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      add(static_cast<const void*>(begin), size_t(end - begin));
+    }
+
+    private_fused_fcs::fcs_list<typename private_fused_fcs::fcs_type<TFcs>::type...> fcs;
+  };
+
+  template <typename... TFcs>
+  ETL_CONSTANT size_t fused_fcs<TFcs...>::Size;
+}
+
+#endif
+
+#endif
@@ -64,6 +64,7 @@ cog.outl("//********************************************************************
 #define ETL_FSM_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
 #include "array.h"
 #include "nullptr.h"
 #include "error_handler.h"
@@ -313,7 +314,8 @@ namespace etl
       p_context(ETL_NULLPTR),
       p_parent(ETL_NULLPTR),
       p_active_child(ETL_NULLPTR),
-      p_default_child(ETL_NULLPTR)
+      p_default_child(ETL_NULLPTR),
+      depth(0U)
     {
     }
 
@@ -358,6 +360,9 @@ namespace etl
     // A pointer to the default active child.
     ifsm_state* p_default_child;
 
+    // The depth of this state in the hierarchy. Cached by the HFSM when it starts.
+    etl::fsm_state_id_t depth;
+
     // Disabled.
     ifsm_state(const ifsm_state&);
     ifsm_state& operator =(const ifsm_state&);
@@ -455,6 +460,7 @@ namespace etl
           {
             p_state->on_exit_state();
             p_state = p_next_state;
+            ETL_TRACE(etl::trace_event::fsm_transition, this, p_state->get_state_id());
 
             next_state_id = p_state->on_enter_state();
 
@@ -477,6 +483,19 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Handles a batch of messages, in order.
+    /// A class that overrides receive(const etl::imessage&) must also
+    /// override this.
+    //*******************************************
+    void receive(message_span_t messages) ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        fsm::receive(*messages[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -650,203 +669,15 @@ namespace etl
   template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_, typename... TMessageTypes>
   ETL_CONSTANT etl::fsm_state_id_t fsm_state<TContext, TDerived, STATE_ID_, TMessageTypes...>::STATE_ID;
 
-#else
+#endif
+}
+
+#if !ETL_USING_CPP17 || defined(ETL_FSM_FORCE_CPP03_IMPLEMENTATION)
 //*************************************************************************************************
 // For C++14 and below.
 //*************************************************************************************************
-  /*[[[cog
-  import cog
-  ################################################
-  # The first definition for all of the events.
-  ################################################
-  cog.outl("//***************************************************************************")
-  cog.outl("// The definition for all %s message types." % Handlers)
-  cog.outl("//***************************************************************************")
-  cog.outl("template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_, ")
-  cog.out("          ")
-  for n in range(1, int(Handlers)):
-      cog.out("typename T%s = void, " % n)
-      if n % 4 == 0:
-          cog.outl("")
-          cog.out("          ")
-  cog.outl("typename T%s = void>" % Handlers)
-  cog.outl("class fsm_state : public ifsm_state")
-  cog.outl("{")
-  cog.outl("public:")
-  cog.outl("")
-  cog.outl("  static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;")
-  cog.outl("")
-  cog.outl("  fsm_state()")
-  cog.outl("    : ifsm_state(STATE_ID)")
-  cog.outl("  {")
-  cog.outl("  }")
-  cog.outl("")
-  cog.outl("protected:")
-  cog.outl("")
-  cog.outl("  ~fsm_state()")
-  cog.outl("  {")
-  cog.outl("  }")
-  cog.outl("")
-  cog.outl("  TContext& get_fsm_context() const")
-  cog.outl("  {")
-  cog.outl("    return static_cast<TContext&>(ifsm_state::get_fsm_context());")
-  cog.outl("  }")
-  cog.outl("")
-  cog.outl("private:")
-  cog.outl("")
-  cog.outl("  etl::fsm_state_id_t process_event(const etl::imessage& message)")
-  cog.outl("  {")
-  cog.outl("    etl::fsm_state_id_t new_state_id;")
-  cog.outl("    etl::message_id_t event_id = message.get_message_id();")
-  cog.outl("")
-  cog.outl("    switch (event_id)")
-  cog.outl("    {")
-  for n in range(1, int(Handlers) + 1):
-      cog.out("      case T%d::ID:" % n)
-      cog.out(" new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T%d&>(message));" % n)
-      cog.outl(" break;")
-  cog.out("      default:")
-  cog.out(" new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);")
-  cog.outl(" break;")
-  cog.outl("    }")
-  cog.outl("")
-  cog.outl("    return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);")
-  cog.outl("  }")
-  cog.outl("};")
-
-  ####################################
-  # All of the other specialisations.
-  ####################################
-  for n in range(int(Handlers) - 1, 0, -1):
-      cog.outl("")
-      cog.outl("//***************************************************************************")
-      if n == 1:
-          cog.outl("// Specialisation for %d message type." % n)
-      else:
-          cog.outl("// Specialisation for %d message types." % n)
-      cog.outl("//***************************************************************************")
-      cog.outl("template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_, ")
-      cog.out("          ")
-      for t in range(1, n):
-          cog.out("typename T%d, " % t)
-          if t % 4 == 0:
-              cog.outl("")
-              cog.out("          ")
-      cog.outl("typename T%d>" % n)
-      cog.out("class fsm_state<TContext, TDerived, STATE_ID_, ")
-      for t in range(1, n + 1):
-          cog.out("T%d, " % t)
-      if t % 16 == 0:
-          cog.outl("")
-          cog.out("               ")
-      for t in range(n + 1, int(Handlers)):
-          cog.out("void, ")
-      if t % 16 == 0:
-          cog.outl("")
-          cog.out("               ")
-      cog.outl("void> : public ifsm_state")
-      cog.outl("{")
-      cog.outl("public:")
-      cog.outl("")
-      cog.outl("  static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;")
-      cog.outl("")
-      cog.outl("  fsm_state()")
-      cog.outl("    : ifsm_state(STATE_ID)")
-      cog.outl("  {")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("protected:")
-      cog.outl("")
-      cog.outl("  ~fsm_state()")
-      cog.outl("  {")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  TContext& get_fsm_context() const")
-      cog.outl("  {")
-      cog.outl("    return static_cast<TContext&>(ifsm_state::get_fsm_context());")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("private:")
-      cog.outl("")
-      cog.outl("  etl::fsm_state_id_t process_event(const etl::imessage& message)")
-      cog.outl("  {")
-      cog.outl("    etl::fsm_state_id_t new_state_id;")
-      cog.outl("    etl::message_id_t event_id = message.get_message_id();")
-      cog.outl("")
-      cog.outl("    switch (event_id)")
-      cog.outl("    {")
-      for n in range(1, n + 1):
-          cog.out("      case T%d::ID:" % n)
-          cog.out(" new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T%d&>(message));" % n)
-          cog.outl(" break;")
-      cog.out("      default:")
-      cog.out(" new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);")
-      cog.outl(" break;")
-      cog.outl("    }")
-      cog.outl("")
-      cog.outl("    return (new_state_id != Pass_To_Parent) ? new_state_id : (p_parent ? p_parent->process_event(message) : No_State_Change);")
-      cog.outl("  }")
-      cog.outl("};")
-  ####################################
-  # Specialisation for zero messages.
-  ####################################
-  cog.outl("")
-  cog.outl("//***************************************************************************")
-  cog.outl("// Specialisation for 0 message types.")
-  cog.outl("//***************************************************************************")
-  cog.outl("template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_>")
-  cog.out("class fsm_state<TContext, TDerived, STATE_ID_, ")
-  for t in range(1, int(Handlers)):
-      cog.out("void, ")
-  if t % 16 == 0:
-      cog.outl("")
-      cog.out("               ")
-  cog.outl("void> : public ifsm_state")
-  cog.outl("{")
-  cog.outl("public:")
-  cog.outl("")
-  cog.outl("  static ETL_CONSTANT etl::fsm_state_id_t STATE_ID = STATE_ID_;")
-  cog.outl("")
-  cog.outl("  fsm_state()")
-  cog.outl("    : ifsm_state(STATE_ID)")
-  cog.outl("  {")
-  cog.outl("  }")
-  cog.outl("")
-  cog.outl("protected:")
-  cog.outl("")
-  cog.outl("  ~fsm_state()")
-  cog.outl("  {")
-  cog.outl("  }")
-  cog.outl("")
-  cog.outl("  TContext& get_fsm_context() const")
-  cog.outl("  {")
-  cog.outl("    return static_cast<TContext&>(ifsm_state::get_fsm_context());")
-  cog.outl("  }")
-  cog.outl("private:")
-  cog.outl("")
-  cog.outl("  etl::fsm_state_id_t process_event(const etl::imessage& message)")
-  cog.outl("  {")
-  cog.outl("    return p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);")
-  cog.outl("  }")
-  cog.outl("};")
-
-  cog.outl("")
-  cog.outl("template <typename TContext, typename TDerived, etl::fsm_state_id_t STATE_ID_, ")
-  cog.out("          ")
-  for n in range(1, int(Handlers)):
-      cog.out("typename T%s, " % n)
-      if n % 4 == 0:
-          cog.outl("")
-          cog.out("          ")
-  cog.outl("typename T%s>" % Handlers)
-  cog.out("ETL_CONSTANT etl::fsm_state_id_t fsm_state<TContext, TDerived, STATE_ID_, ")
-  for n in range(1, int(Handlers)):
-      cog.out("T%s, " % n)
-  cog.outl("T%s>::STATE_ID;" % Handlers)
-  ]]]*/
-  /*[[[end]]]*/
+  #include "private/fsm_legacy.h"
 #endif
-}
 
 #include "private/minmax_pop.h"
 
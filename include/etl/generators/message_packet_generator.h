@@ -71,6 +71,7 @@ cog.outl("//********************************************************************
 #include "error_handler.h"
 #include "static_assert.h"
 #include "largest.h"
+#include "smallest.h"
 #include "alignment.h"
 #include "utility.h"
 
@@ -81,6 +82,8 @@ namespace etl
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
   //***************************************************************************
   // The definition for all message types.
+  // Copy, move and destroy are dispatched through a table of functions for
+  // each type, indexed by the position of the type in the list.
   //***************************************************************************
   template <typename... TMessageTypes>
   class message_packet
@@ -97,12 +100,16 @@ namespace etl
     template <typename T>
     static constexpr bool IsIMessage = etl::is_same_v<remove_const_t<etl::remove_reference_t<T>>, etl::imessage>;
 
+    typedef typename etl::smallest_uint_for_value<sizeof...(TMessageTypes)>::type index_type;
+
+    static constexpr index_type No_Index = sizeof...(TMessageTypes);
+
   public:
 
     //********************************************
 #include "private/diagnostic_uninitialized_push.h"
     message_packet()
-      : valid(false)
+      : index(No_Index)
     {
     }
 #include "private/diagnostic_pop.h"
@@ -113,21 +120,16 @@ namespace etl
 #include "private/diagnostic_uninitialized_push.h"
     template <typename T, typename = typename etl::enable_if<IsIMessage<T> || IsInMessageList<T>, int>::type>
     explicit message_packet(T&& msg)
-      : valid(true)
+      : index(No_Index)
     {
       if constexpr (IsIMessage<T>)
       {
         if (accepts(msg))
         {
           add_new_message(etl::forward<T>(msg));
-          valid = true;
-        }
-        else
-        {
-          valid = false;
         }
 
-        ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));
+        ETL_ASSERT(is_valid(), ETL_ERROR(unhandled_message_exception));
       }
       else if constexpr (IsInMessageList<T>)
       {
@@ -140,50 +142,45 @@ namespace etl
     }
 #include "private/diagnostic_pop.h"
 
+    //********************************************
+    /// Constructs the message in place.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename TMessage, typename... TArgs>
+    explicit message_packet(etl::in_place_type_t<TMessage>, TArgs&&... args)
+      : index(index_of_type<TMessage>())
+    {
+      ETL_STATIC_ASSERT(IsInMessageList<TMessage>, "Message not in packet type list");
+
+      void* p = data;
+      new (p) TMessage(etl::forward<TArgs>(args)...);
+    }
+#include "private/diagnostic_pop.h"
+
     //**********************************************
     message_packet(const message_packet& other)
     {
-      valid = other.is_valid();
-
-      if (valid)
-      {
-        add_new_message(other.get());
-      }
+      copy_message(other);
     }
 
 #if ETL_USING_CPP11
     //**********************************************
     message_packet(message_packet&& other)
     {
-      valid = other.is_valid();
-
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
+      move_message(other);
     }
 #endif
 
     //**********************************************
     void copy(const message_packet& other)
     {
-      valid = other.is_valid();
-
-      if (valid)
-      {
-        add_new_message(other.get());
-      }
+      copy_message(other);
     }
 
     //**********************************************
     void copy(message_packet&& other)
     {
-      valid = other.is_valid();
-
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
+      move_message(other);
     }
 
     //**********************************************
@@ -191,11 +188,7 @@ namespace etl
     message_packet& operator =(const message_packet& rhs)
     {
       delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(rhs.get());
-      }
+      copy_message(rhs);
 
       return *this;
     }
@@ -206,11 +199,7 @@ namespace etl
     message_packet& operator =(message_packet&& rhs)
     {
       delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
+      move_message(rhs);
 
       return *this;
     }
@@ -237,8 +226,28 @@ namespace etl
     //********************************************
     bool is_valid() const
     {
-      return valid;
+      return index != No_Index;
+    }
+
+    //********************************************
+    /// Destroys the current message, if any, and constructs a new one in place.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT(IsInMessageList<TMessage>, "Message not in packet type list");
+
+      delete_current_message();
+      index = No_Index;
+
+      void* p = data;
+      TMessage* pmsg = new (p) TMessage(etl::forward<TArgs>(args)...);
+      index = index_of_type<TMessage>();
+
+      return *pmsg;
     }
+#include "private/diagnostic_pop.h"
 
     //**********************************************
     static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
@@ -276,6 +285,67 @@ namespace etl
 
   private:
 
+    //**********************************************
+    /// The operations for a message type.
+    //**********************************************
+    struct operations
+    {
+      void (*copy_construct)(void* p, const etl::imessage& msg);
+      void (*move_construct)(void* p, etl::imessage& msg);
+      void (*destroy)(void* p);
+    };
+
+    //**********************************************
+    template <typename TMessage>
+    static void copy_construct(void* p, const etl::imessage& msg)
+    {
+      new (p) TMessage(static_cast<const TMessage&>(msg));
+    }
+
+    //**********************************************
+    template <typename TMessage>
+    static void move_construct(void* p, etl::imessage& msg)
+    {
+      new (p) TMessage(static_cast<TMessage&&>(msg));
+    }
+
+    //**********************************************
+    template <typename TMessage>
+    static void destroy(void* p)
+    {
+      static_cast<TMessage*>(p)->~TMessage();
+    }
+
+    /// The operations for each type, in type list order.
+    static constexpr operations Operations[sizeof...(TMessageTypes)] =
+    {
+      { &copy_construct<TMessageTypes>, &move_construct<TMessageTypes>, &destroy<TMessageTypes> }...
+    };
+
+    //**********************************************
+    /// The position of TMessage in the type list.
+    //**********************************************
+    template <typename TMessage>
+    static constexpr index_type index_of_type()
+    {
+      index_type i = 0U;
+      ((etl::is_same_v<etl::remove_const_t<etl::remove_reference_t<TMessage>>, TMessageTypes> ? true : (++i, false)) || ...);
+
+      return i;
+    }
+
+    //**********************************************
+    /// The position of the type with the message id in the type list.
+    /// Returns No_Index if not in the list.
+    //**********************************************
+    static index_type index_of_id(etl::message_id_t id)
+    {
+      index_type i = 0U;
+      ((TMessageTypes::ID == id ? true : (++i, false)) || ...);
+
+      return i;
+    }
+
     //**********************************************
     template <etl::message_id_t Id1, etl::message_id_t Id2>
     static bool accepts_message()
@@ -294,11 +364,35 @@ namespace etl
 #include "private/diagnostic_uninitialized_push.h"
     void delete_current_message()
     {
-      if (valid)
+      if (is_valid())
       {
-        etl::imessage* pmsg = static_cast<etl::imessage*>(data);
+        Operations[index].destroy(data);
+      }
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    void copy_message(const message_packet& other)
+    {
+      index = other.index;
+
+      if (is_valid())
+      {
+        Operations[index].copy_construct(data, other.get());
+      }
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    void move_message(message_packet& other)
+    {
+      index = other.index;
 
-        pmsg->~imessage();
+      if (is_valid())
+      {
+        Operations[index].move_construct(data, other.get());
       }
     }
 #include "private/diagnostic_pop.h"
@@ -306,13 +400,23 @@ namespace etl
     //********************************************
     void add_new_message(const etl::imessage& msg)
     {
-      (add_new_message_type<TMessageTypes>(msg) || ...);
+      index = index_of_id(msg.get_message_id());
+
+      if (is_valid())
+      {
+        Operations[index].copy_construct(data, msg);
+      }
     }
 
     //********************************************
     void add_new_message(etl::imessage&& msg)
     {
-      (add_new_message_type<TMessageTypes>(etl::move(msg)) || ...);
+      index = index_of_id(msg.get_message_id());
+
+      if (is_valid())
+      {
+        Operations[index].move_construct(data, msg);
+      }
     }
 
 #include "private/diagnostic_uninitialized_push.h"
@@ -324,683 +428,24 @@ namespace etl
       add_new_message_type(TMessage&& msg)
     {
       void* p = data;
-      new (p) etl::remove_reference_t<TMessage>((etl::forward<TMessage>(msg)));
+      new (p) etl::remove_const_t<etl::remove_reference_t<TMessage>>((etl::forward<TMessage>(msg)));
+      index = index_of_type<TMessage>();
     }
 #include "private/diagnostic_pop.h"
 
-#include "private/diagnostic_uninitialized_push.h"
-    //********************************************
-    template <typename TType>
-    bool add_new_message_type(const etl::imessage& msg)
-    {
-      if (TType::ID == msg.get_message_id())
-      {
-        void* p = data;
-        new (p) TType(static_cast<const TType&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
-#include "private/diagnostic_pop.h"
-
-    //********************************************
-    template <typename TType>
-    bool add_new_message_type(etl::imessage&& msg)
-    {
-      if (TType::ID == msg.get_message_id())
-      {
-        void* p = data;
-        new (p) TType(static_cast<TType&&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
-
     typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
-    bool valid;
+    index_type index;
   };
 
-#else
-
-  /*[[[cog
-    import cog
-
-    ################################################
-    def generate_accepts_return(n):
-        cog.out("    return")
-        for i in range(1, n + 1):
-            cog.out(" T%d::ID == id" % i)
-            if i < n:
-                cog.out(" ||")
-                if i % 4 == 0:
-                    cog.outl("")
-                    cog.out("          ")
-        cog.outl(";")
-
-    ################################################
-    def generate_accepts_return_compile_time(n):
-        cog.out("    return")
-        for i in range(1, n + 1):
-            cog.out(" T%d::ID == Id" % i)
-            if i < n:
-                cog.out(" ||")
-                if i % 4 == 0:
-                    cog.outl("")
-                    cog.out("          ")
-        cog.outl(";")
-
-    ################################################
-    def generate_accepts_return_compile_time_TMessage(n):
-        cog.out("    return")
-        for i in range(1, n + 1):
-            cog.out(" T%d::ID == TMessage::ID" % i)
-            if i < n:
-                cog.out(" ||")
-                if i % 4 == 0:
-                    cog.outl("")
-                    cog.out("          ")
-        cog.outl(";")
-
-    ################################################
-    def generate_static_assert_cpp03(n):
-        cog.outl("    // Not etl::message_packet, not etl::imessage and in typelist.")
-        cog.out("    static const bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<")
-        for i in range(1, n):
-            cog.out("T%d, " % i)
-        cog.outl("T%s> >::value &&" % n)
-        cog.outl("                                 !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&")
-        cog.out("                                 etl::is_one_of<typename etl::remove_cvref<TMessage>::type,")
-        for i in range(1, n):
-            cog.out("T%d, " % i)
-        cog.outl("T%s>::value);" % n)
-        cog.outl("")
-        cog.outl("    ETL_STATIC_ASSERT(Enabled, \"Message not in packet type list\");")
-
-    ################################################
-    def generate_static_assert_cpp11(n):
-        cog.outl("    // Not etl::message_packet, not etl::imessage and in typelist.")
-        cog.out("    static constexpr bool Enabled = (!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<")
-        for i in range(1, n):
-            cog.out("T%d, " % i)
-        cog.outl("T%s> >::value &&" % n)
-        cog.outl("                                     !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&")
-        cog.out("                                     etl::is_one_of<typename etl::remove_cvref<TMessage>::type,")
-        for i in range(1, n):
-            cog.out("T%d, " % i)
-        cog.outl("T%s>::value);" % n)
-        cog.outl("")
-        cog.outl("    ETL_STATIC_ASSERT(Enabled, \"Message not in packet type list\");")
-
-    ################################################
-    # The first definition for all of the messages.
-    ################################################
-    cog.outl("//***************************************************************************")
-    cog.outl("// The definition for all %s message types." % Handlers)
-    cog.outl("//***************************************************************************")
-    cog.out("template <")
-    cog.out("typename T1, ")
-    for n in range(2, int(Handlers)):
-        cog.out("typename T%s = void, " % n)
-        if n % 4 == 0:
-            cog.outl("")
-            cog.out("          ")
-    cog.outl("typename T%s = void>" % int(Handlers))
-    cog.outl("class message_packet")
-    cog.outl("{")
-    cog.outl("public:")
-    cog.outl("")
-    cog.outl("  //********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  message_packet()")
-    cog.outl("    : valid(false)")
-    cog.outl("  {")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("")
-    cog.outl("  //********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  explicit message_packet(const etl::imessage& msg)")
-    cog.outl("  {")
-    cog.outl("    if (accepts(msg))")
-    cog.outl("    {")
-    cog.outl("      add_new_message(msg);")
-    cog.outl("      valid = true;")
-    cog.outl("    }")
-    cog.outl("    else")
-    cog.outl("    {")
-    cog.outl("      valid = false;")
-    cog.outl("    }")
-    cog.outl("")
-    cog.outl("    ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-    cog.outl("  //********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  explicit message_packet(etl::imessage&& msg)")
-    cog.outl("  {")
-    cog.outl("    if (accepts(msg))")
-    cog.outl("    {")
-    cog.outl("      add_new_message(etl::move(msg));")
-    cog.outl("      valid = true;")
-    cog.outl("    }")
-    cog.outl("    else")
-    cog.outl("    {")
-    cog.outl("      valid = false;")
-    cog.outl("    }")
-    cog.outl("")
-    cog.outl("    ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#endif")
-    cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)")
-    cog.outl("  //********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.out("  template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<")
-    for n in range(1, int(Handlers)):
-        cog.out("T%s, " % n)
-    cog.outl("T%s> >::value &&" % int(Handlers))
-    cog.outl("                                                                  !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&")
-    cog.out("                                                                  !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, ")
-    for n in range(1, int(Handlers)):
-        cog.out("T%s, " % n)
-    cog.outl("T%s>::value, int>::type>" % int(Handlers))
-    cog.outl("  explicit message_packet(TMessage&& /*msg*/)")
-    cog.outl("    : valid(true)")
-    cog.outl("  {")
-    generate_static_assert_cpp11(int(Handlers))
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#else")
-    cog.outl("  //********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  template <typename TMessage>")
-    cog.out("  explicit message_packet(const TMessage& /*msg*/, typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<")
-    for n in range(1, int(Handlers)):
-        cog.out("T%s, " % n)
-    cog.outl("T%s> >::value &&" % int(Handlers))
-    cog.outl("                                                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&")
-    cog.out("                                                                       !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, ")
-    for n in range(1, int(Handlers)):
-        cog.out("T%s, " % n)
-    cog.outl("T%s>::value, int>::type = 0)" % int(Handlers))
-    cog.outl("    : valid(true)")
-    cog.outl("  {")
-    generate_static_assert_cpp03(int(Handlers))
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#endif")
-    cog.outl("")
-    cog.outl("  //**********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  message_packet(const message_packet& other)")
-    cog.outl("    : valid(other.is_valid())")
-    cog.outl("  {")
-    cog.outl("    if (valid)")
-    cog.outl("    {")
-    cog.outl("      add_new_message(other.get());")
-    cog.outl("    }")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-    cog.outl("  //**********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  message_packet(message_packet&& other)")
-    cog.outl("    : valid(other.is_valid())")
-    cog.outl("  {")
-    cog.outl("    if (valid)")
-    cog.outl("    {")
-    cog.outl("      add_new_message(etl::move(other.get()));")
-    cog.outl("    }")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#endif")
-    cog.outl("")
-    cog.outl("  //**********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  message_packet& operator =(const message_packet& rhs)")
-    cog.outl("  {")
-    cog.outl("    delete_current_message();")
-    cog.outl("    valid = rhs.is_valid();")
-    cog.outl("    if (valid)")
-    cog.outl("    {")
-    cog.outl("      add_new_message(rhs.get());")
-    cog.outl("    }")
-    cog.outl("")
-    cog.outl("    return *this;")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-    cog.outl("  //**********************************************")
-    cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  message_packet& operator =(message_packet&& rhs)")
-    cog.outl("  {")
-    cog.outl("    delete_current_message();")
-    cog.outl("    valid = rhs.is_valid();")
-    cog.outl("    if (valid)")
-    cog.outl("    {")
-    cog.outl("      add_new_message(etl::move(rhs.get()));")
-    cog.outl("    }")
-    cog.outl("")
-    cog.outl("    return *this;")
-    cog.outl("  }")
-    cog.outl("#include \"private/diagnostic_pop.h\"")
-    cog.outl("#endif")
-    cog.outl("")
-    cog.outl("  //********************************************")
-    cog.outl("  ~message_packet()")
-    cog.outl("  {")
-    cog.outl("    delete_current_message();")
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("  //********************************************")
-    cog.outl("  etl::imessage& get() ETL_NOEXCEPT")
-    cog.outl("  {")
-    cog.outl("    return *static_cast<etl::imessage*>(data);")
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("  //********************************************")
-    cog.outl("  const etl::imessage& get() const ETL_NOEXCEPT")
-    cog.outl("  {")
-    cog.outl("    return *static_cast<const etl::imessage*>(data);")
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("  //********************************************")
-    cog.outl("  bool is_valid() const")
-    cog.outl("  {")
-    cog.outl("    return valid;")
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("  //**********************************************")
-    cog.outl("  static ETL_CONSTEXPR bool accepts(etl::message_id_t id)")
-    cog.outl("  {")
-    generate_accepts_return(int(Handlers))
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("  //**********************************************")
-    cog.outl("  static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)")
-    cog.outl("  {")
-    cog.outl("    return accepts(msg.get_message_id());")
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("  //**********************************************")
-    cog.outl("  template <etl::message_id_t Id>")
-    cog.outl("  static ETL_CONSTEXPR bool accepts()")
-    cog.outl("  {")
-    generate_accepts_return_compile_time(int(Handlers))
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("  //**********************************************")
-    cog.outl("  template <typename TMessage>")
-    cog.outl("  static ETL_CONSTEXPR")
-    cog.outl("  typename etl::enable_if<etl::is_base_of<etl::imessage, TMessage>::value, bool>::type")
-    cog.outl("    accepts()")
-    cog.outl("  {")
-    generate_accepts_return_compile_time_TMessage(int(Handlers))
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("  enum")
-    cog.outl("  {")
-    cog.out("    SIZE      = etl::largest<")
-    for n in range(1, int(Handlers)):
-        cog.out("T%d, " % n)
-    cog.outl("T%s>::size," % int(Handlers))
-    cog.out("    ALIGNMENT = etl::largest<")
-    for n in range(1, int(Handlers)):
-        cog.out("T%d, " % n)
-    cog.outl("T%s>::alignment" % int(Handlers))
-    cog.outl("  };")
-    cog.outl("")
-    cog.outl("private:")
-    cog.outl("")
-    cog.outl("  //********************************************")
-    cog.outl("  #include \"private/diagnostic_uninitialized_push.h\"")
-    cog.outl("  void delete_current_message()")
-    cog.outl("  {")
-    cog.outl("    if (valid)")
-    cog.outl("    {")
-    cog.outl("      etl::imessage* pmsg = static_cast<etl::imessage*>(data);")
-    cog.outl("")
-    cog.outl("      pmsg->~imessage();")
-    cog.outl("    }")
-    cog.outl("  }")
-    cog.outl("  #include \"private/diagnostic_pop.h\"")
-    cog.outl("")
-    cog.outl("  //********************************************")
-    cog.outl("  void add_new_message(const etl::imessage& msg)")
-    cog.outl("  {")
-    cog.outl("    const size_t id = msg.get_message_id();")
-    cog.outl("    void* p = data;")
-    cog.outl("")
-    cog.outl("    switch (id)")
-    cog.outl("    {")
-    for n in range(1, int(Handlers) + 1):
-        cog.outl("      case T%d::ID: ::new (p) T%d(static_cast<const T%d&>(msg)); break;" %(n, n, n))
-    cog.outl("      default: ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception)); break;")
-    cog.outl("    }")
-    cog.outl("  }")
-    cog.outl("")
-    cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-    cog.outl("  //********************************************")
-    cog.outl("  void add_new_message(etl::imessage&& msg)")
-    cog.outl("  {")
-    cog.outl("    const size_t id = msg.get_message_id();")
-    cog.outl("    void* p = data;")
-    cog.outl("")
-    cog.outl("    switch (id)")
-    cog.outl("    {")
-    for n in range(1, int(Handlers) + 1):
-        cog.outl("      case T%d::ID: ::new (p) T%d(static_cast<T%d&&>(msg)); break;" %(n, n, n))
-    cog.outl("      default: ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception)); break;")
-    cog.outl("    }")
-    cog.outl("  }")
-    cog.outl("#endif")
-    cog.outl("")
-    cog.outl("  typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;")
-    cog.outl("  bool valid;")
-    cog.outl("};")
-
-    ####################################
-    # All of the other specialisations.
-    ####################################
-    for n in range(int(Handlers) - 1, 0, -1):
-        cog.outl("")
-        cog.outl("//***************************************************************************")
-        if n == 1:
-            cog.outl("// Specialisation for %d message type." % n)
-        else:
-            cog.outl("// Specialisation for %d message types." % n)
-        cog.outl("//***************************************************************************")
-        cog.out("template <")
-        for t in range(1, n):
-            cog.out("typename T%s, " % t)
-            if t % 4 == 0:
-                cog.outl("")
-                cog.out("          ")
-        cog.outl("typename T%s>" % n)
-        cog.out("class message_packet<")
-        for t in range(1, n + 1):
-            cog.out("T%d, " % t)
-            if t % 16 == 0:
-                cog.outl("")
-                cog.out("               ")
-        for t in range(n + 1, int(Handlers)):
-            cog.out("void, ")
-            if t % 16 == 0:
-                cog.outl("")
-                cog.out("               ")
-        cog.outl("void>")
-        cog.outl("{")
-        cog.outl("public:")
-        cog.outl("")
-        cog.outl("  //********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  message_packet()")
-        cog.outl("    : valid(false)")
-        cog.outl("  {")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("")
-        cog.outl("  //********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  explicit message_packet(const etl::imessage& msg)")
-        cog.outl("  {")
-        cog.outl("    if (accepts(msg))")
-        cog.outl("    {")
-        cog.outl("      add_new_message(msg);")
-        cog.outl("      valid = true;")
-        cog.outl("    }")
-        cog.outl("    else")
-        cog.outl("    {")
-        cog.outl("      valid = false;")
-        cog.outl("    }")
-        cog.outl("")
-        cog.outl("    ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-        cog.outl("  //********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  explicit message_packet(etl::imessage&& msg)")
-        cog.outl("  {")
-        cog.outl("    if (accepts(msg))")
-        cog.outl("    {")
-        cog.outl("      add_new_message(etl::move(msg));")
-        cog.outl("      valid = true;")
-        cog.outl("    }")
-        cog.outl("    else")
-        cog.outl("    {")
-        cog.outl("      valid = false;")
-        cog.outl("    }")
-        cog.outl("")
-        cog.outl("    ETL_ASSERT(valid, ETL_ERROR(unhandled_message_exception));")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#endif")
-        cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(ETL_COMPILER_GREEN_HILLS)")
-        cog.outl("  //********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.out("  template <typename TMessage, typename = typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<")
-        for t in range(1, n):
-            cog.out("T%s, " % t)
-        cog.outl("T%s> >::value &&" % n)
-        cog.outl("                                                                  !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&")
-        cog.out("                                                                  !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, ")
-        for t in range(1, n):
-            cog.out("T%s, " % t)
-        cog.outl("T%s>::value, int>::type>" % n)
-        cog.outl("  explicit message_packet(TMessage&& /*msg*/)")
-        cog.outl("    : valid(true)")
-        cog.outl("  {")
-        generate_static_assert_cpp11(n)
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#else")
-        cog.outl("  //********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  template <typename TMessage>")
-        cog.out("  explicit message_packet(const TMessage& /*msg*/, typename etl::enable_if<!etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::message_packet<")
-        for t in range(1, n):
-            cog.out("T%s, " % t)
-        cog.outl("T%s> >::value &&" % n)
-        cog.outl("                                                                       !etl::is_same<typename etl::remove_cvref<TMessage>::type, etl::imessage>::value &&")
-        cog.out("                                                                       !etl::is_one_of<typename etl::remove_cvref<TMessage>::type, ")
-        for t in range(1, n):
-            cog.out("T%s, " % t)
-        cog.outl("T%s>::value, int>::type = 0)" % n)
-        cog.outl("    : valid(true)")
-        cog.outl("  {")
-        generate_static_assert_cpp03(n)
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#endif")
-        cog.outl("")
-        cog.outl("  //**********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  message_packet(const message_packet& other)")
-        cog.outl("    : valid(other.is_valid())")
-        cog.outl("  {")
-        cog.outl("    if (valid)")
-        cog.outl("    {")
-        cog.outl("      add_new_message(other.get());")
-        cog.outl("    }")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-        cog.outl("  //**********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  message_packet(message_packet&& other)")
-        cog.outl("    : valid(other.is_valid())")
-        cog.outl("  {")
-        cog.outl("    if (valid)")
-        cog.outl("    {")
-        cog.outl("      add_new_message(etl::move(other.get()));")
-        cog.outl("    }")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#endif")
-        cog.outl("")
-        cog.outl("  //**********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  message_packet& operator =(const message_packet& rhs)")
-        cog.outl("  {")
-        cog.outl("    delete_current_message();")
-        cog.outl("    valid = rhs.is_valid();")
-        cog.outl("    if (valid)")
-        cog.outl("    {")
-        cog.outl("      add_new_message(rhs.get());")
-        cog.outl("    }")
-        cog.outl("")
-        cog.outl("    return *this;")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-        cog.outl("  //**********************************************")
-        cog.outl("#include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  message_packet& operator =(message_packet&& rhs)")
-        cog.outl("  {")
-        cog.outl("    delete_current_message();")
-        cog.outl("    valid = rhs.is_valid();")
-        cog.outl("    if (valid)")
-        cog.outl("    {")
-        cog.outl("      add_new_message(etl::move(rhs.get()));")
-        cog.outl("    }")
-        cog.outl("")
-        cog.outl("    return *this;")
-        cog.outl("  }")
-        cog.outl("#include \"private/diagnostic_pop.h\"")
-        cog.outl("#endif")
-        cog.outl("")
-        cog.outl("  //********************************************")
-        cog.outl("  ~message_packet()")
-        cog.outl("  {")
-        cog.outl("    delete_current_message();")
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("  //********************************************")
-        cog.outl("  etl::imessage& get() ETL_NOEXCEPT")
-        cog.outl("  {")
-        cog.outl("    return *static_cast<etl::imessage*>(data);")
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("  //********************************************")
-        cog.outl("  const etl::imessage& get() const ETL_NOEXCEPT")
-        cog.outl("  {")
-        cog.outl("    return *static_cast<const etl::imessage*>(data);")
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("  //********************************************")
-        cog.outl("  bool is_valid() const")
-        cog.outl("  {")
-        cog.outl("    return valid;")
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("  //**********************************************")
-        cog.outl("  static ETL_CONSTEXPR bool accepts(etl::message_id_t id)")
-        cog.outl("  {")
-        generate_accepts_return(n)
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("  //**********************************************")
-        cog.outl("  static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)")
-        cog.outl("  {")
-        cog.outl("    return accepts(msg.get_message_id());")
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("  //**********************************************")
-        cog.outl("  template <etl::message_id_t Id>")
-        cog.outl("  static ETL_CONSTEXPR bool accepts()")
-        cog.outl("  {")
-        generate_accepts_return_compile_time(n)
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("  //**********************************************")
-        cog.outl("  template <typename TMessage>")
-        cog.outl("  static ETL_CONSTEXPR")
-        cog.outl("  typename etl::enable_if<etl::is_base_of<etl::imessage, TMessage>::value, bool>::type")
-        cog.outl("    accepts()")
-        cog.outl("  {")
-        generate_accepts_return_compile_time_TMessage(n)
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("  enum")
-        cog.outl("  {")
-        cog.out("    SIZE      = etl::largest<")
-        for t in range(1, n):
-            cog.out("T%d, " % t)
-        cog.outl("T%s>::size," % n)
-        cog.out("    ALIGNMENT = etl::largest<")
-        for t in range(1, n):
-            cog.out("T%d, " % t)
-        cog.outl("T%s>::alignment" % n)
-        cog.outl("  };")
-        cog.outl("")
-        cog.outl("private:")
-        cog.outl("")
-        cog.outl("  //********************************************")
-        cog.outl("  #include \"private/diagnostic_uninitialized_push.h\"")
-        cog.outl("  void delete_current_message()")
-        cog.outl("  {")
-        cog.outl("    if (valid)")
-        cog.outl("    {")
-        cog.outl("      etl::imessage* pmsg = static_cast<etl::imessage*>(data);")
-        cog.outl("")
-        cog.outl("      pmsg->~imessage();")
-        cog.outl("    }")
-        cog.outl("  }")
-        cog.outl("  #include \"private/diagnostic_pop.h\"")
-        cog.outl("")
-        cog.outl("  //********************************************")
-        cog.outl("  void add_new_message(const etl::imessage& msg)")
-        cog.outl("  {")
-        cog.outl("    const size_t id = msg.get_message_id();")
-        cog.outl("    void* p = data;")
-        cog.outl("")
-        cog.outl("    switch (id)")
-        cog.outl("    {")
-        for t in range(1, n + 1):
-            cog.outl("      case T%d::ID: ::new (p) T%d(static_cast<const T%d&>(msg)); break;" %(t, t, t))
-        cog.outl("      default: break;")
-        cog.outl("    }")
-        cog.outl("  }")
-        cog.outl("")
-        cog.outl("#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
-        cog.outl("  //********************************************")
-        cog.outl("  void add_new_message(etl::imessage&& msg)")
-        cog.outl("  {")
-        cog.outl("    const size_t id = msg.get_message_id();")
-        cog.outl("    void* p = data;")
-        cog.outl("")
-        cog.outl("    switch (id)")
-        cog.outl("    {")
-        for t in range(1, n + 1):
-            cog.outl("      case T%d::ID: ::new (p) T%d(static_cast<T%d&&>(msg)); break;" %(t, t, t))
-        cog.outl("      default: break;")
-        cog.outl("    }")
-        cog.outl("  }")
-        cog.outl("#endif")
-        cog.outl("")
-        cog.outl("  typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;")
-        cog.outl("  bool valid;")
-        cog.outl("};")
-  ]]]*/
-  /*[[[end]]]*/
 #endif
 }
+
+#if !ETL_USING_CPP17 || defined(ETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
+//*************************************************************************************************
+// For C++14 and below.
+//*************************************************************************************************
+  #include "private/message_packet_legacy.h"
+#endif
 #else
   #error "etl::message_packet is not compatible with non-virtual etl::imessage"
 #endif
@@ -66,6 +66,7 @@ cog.outl("//********************************************************************
 #include "platform.h"
 #include "message.h"
 #include "shared_message.h"
+#include "span.h"
 #if ETL_HAS_VIRTUAL_MESSAGES
   #include "message_packet.h"
 #endif
@@ -77,6 +78,8 @@ cog.outl("//********************************************************************
 #include "nullptr.h"
 #include "placement_new.h"
 #include "successor.h"
+#include "trace.h"
+#include "latency_monitor.h"
 #include "type_traits.h"
 
 #include <stdint.h>
@@ -123,6 +126,8 @@ namespace etl
   {
   public:
 
+    typedef etl::span<const etl::imessage* const> message_span_t;
+
     virtual ~imessage_router() {}
     virtual void receive(const etl::imessage&) = 0;
     virtual bool accepts(etl::message_id_t) const = 0;
@@ -154,6 +159,27 @@ namespace etl
       }
     }
 
+    //********************************************
+    /// Receives a batch of messages, in order.
+    /// Override to handle the batch in one call.
+    //********************************************
+    virtual void receive(message_span_t messages)
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        receive(*messages[i]);
+      }
+    }
+
+    //********************************************
+    virtual void receive(etl::message_router_id_t destination_router_id, message_span_t messages)
+    {
+      if ((destination_router_id == get_message_router_id()) || (destination_router_id == imessage_router::ALL_MESSAGE_ROUTERS))
+      {
+        receive(messages);
+      }
+    }
+
     //********************************************
     bool accepts(const etl::imessage& msg) const
     {
@@ -416,6 +442,127 @@ namespace etl
 // For C++17 and above.
 //*************************************************************************************************
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_message_router
+  {
+    //***************************************************************************
+    /// A compile time lookup from message id to handler.
+    /// Uses a jump table indexed by id if the ids are dense enough,
+    /// otherwise a binary search of the sorted ids.
+    /// If an id appears more than once, the first handler is used.
+    //***************************************************************************
+    template <typename THandler, etl::message_id_t... Ids>
+    class message_id_lookup
+    {
+    private:
+
+      //********************************************
+      /// Finds the lowest or highest id.
+      //********************************************
+      static constexpr etl::message_id_t find_id(bool lowest)
+      {
+        const etl::message_id_t ids[] = { Ids... };
+
+        etl::message_id_t result = ids[0];
+
+        for (etl::message_id_t id : ids)
+        {
+          if (lowest ? (id < result) : (id > result))
+          {
+            result = id;
+          }
+        }
+
+        return result;
+      }
+
+    public:
+
+      static constexpr size_t            Number_Of_Ids = sizeof...(Ids);
+      static constexpr etl::message_id_t Min_Id        = find_id(true);
+      static constexpr etl::message_id_t Max_Id        = find_id(false);
+      static constexpr size_t            Range         = size_t(Max_Id - Min_Id) + 1U;
+      static constexpr bool              Is_Dense      = (Range <= (4U * Number_Of_Ids));
+
+      //********************************************
+      constexpr message_id_lookup(const THandler (&handlers_)[Number_Of_Ids])
+        : table()
+        , sorted_ids()
+        , sorted_handlers()
+      {
+        const etl::message_id_t ids[Number_Of_Ids] = { Ids... };
+
+        if constexpr (Is_Dense)
+        {
+          // Fill in reverse, so that the first of any duplicates wins.
+          for (size_t i = Number_Of_Ids; i != 0U; --i)
+          {
+            table[ids[i - 1U] - Min_Id] = handlers_[i - 1U];
+          }
+        }
+        else
+        {
+          // A stable insertion sort, so that the first of any duplicates wins.
+          for (size_t i = 0U; i < Number_Of_Ids; ++i)
+          {
+            size_t j = i;
+
+            while ((j != 0U) && (sorted_ids[j - 1U] > ids[i]))
+            {
+              sorted_ids[j]      = sorted_ids[j - 1U];
+              sorted_handlers[j] = sorted_handlers[j - 1U];
+              --j;
+            }
+
+            sorted_ids[j]      = ids[i];
+            sorted_handlers[j] = handlers_[i];
+          }
+        }
+      }
+
+      //********************************************
+      /// Returns the handler for the id, or ETL_NULLPTR if there is none.
+      //********************************************
+      constexpr THandler find(etl::message_id_t id) const
+      {
+        if constexpr (Is_Dense)
+        {
+          const size_t index = size_t(id) - size_t(Min_Id);
+
+          return ((id >= Min_Id) && (index < Range)) ? table[index] : ETL_NULLPTR;
+        }
+        else
+        {
+          size_t first = 0U;
+          size_t count = Number_Of_Ids;
+
+          // Lower bound.
+          while (count != 0U)
+          {
+            const size_t step = count / 2U;
+
+            if (sorted_ids[first + step] < id)
+            {
+              first += step + 1U;
+              count -= step + 1U;
+            }
+            else
+            {
+              count = step;
+            }
+          }
+
+          return ((first < Number_Of_Ids) && (sorted_ids[first] == id)) ? sorted_handlers[first] : ETL_NULLPTR;
+        }
+      }
+
+    private:
+
+      THandler          table[Is_Dense ? Range : 1U];
+      etl::message_id_t sorted_ids[Is_Dense ? 1U : Number_Of_Ids];
+      THandler          sorted_handlers[Is_Dense ? 1U : Number_Of_Ids];
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
   //***************************************************************************
@@ -459,9 +606,17 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      ETL_TRACE(etl::trace_event::message_receive, this, msg.get_message_id());
+
+      const handler_type handler = find_handler(msg.get_message_id());
+
+      if (handler != ETL_NULLPTR)
+      {
+        ETL_LATENCY_SCOPE(etl::latency_domain::message, msg.get_message_id());
 
-      if (!was_handled)
+        handler(*this, msg);
+      }
+      else
       {
         if (has_successor())
         {
@@ -479,6 +634,9 @@ namespace etl
     {
       if constexpr (etl::is_one_of<TMessage, TMessageTypes...>::value)
       {
+        ETL_TRACE(etl::trace_event::message_receive, this, TMessage::ID);
+        ETL_LATENCY_SCOPE(etl::latency_domain::message, TMessage::ID);
+
         static_cast<TDerived*>(this)->on_receive(msg);
       }
       else
@@ -499,7 +657,12 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if (find_handler(id) != ETL_NULLPTR)
+      {
+        return true;
+      }
+
+      return has_successor() && get_successor().accepts(id);
     }
 
     //********************************************
@@ -522,377 +685,43 @@ namespace etl
 
   private:
 
+    typedef void (*handler_type)(message_router&, const etl::imessage&);
+
+    //********************************************
+    /// Calls on_receive for the concrete message type.
     //********************************************
     template <typename TMessage>
-    bool receive_message_type(const etl::imessage& msg)
+    static void dispatch(message_router& router, const etl::imessage& msg)
     {
-      if (TMessage::ID == msg.get_message_id())
-      {
-        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
     }
 
     //********************************************
-    template <typename TMessage>
-    bool accepts_type(etl::message_id_t id) const
+    /// Finds the handler for a message id.
+    //********************************************
+    static handler_type find_handler(etl::message_id_t id)
     {
-      if (TMessage::ID == id)
+      if constexpr (sizeof...(TMessageTypes) == 0U)
       {
-        return true;
+        (void)id;
+        return ETL_NULLPTR;
       }
       else
       {
-        if (has_successor())
-        {
-          return get_successor().accepts(id);
-        }
-        else
-        {
-          return false;
-        }
+        static constexpr private_message_router::message_id_lookup<handler_type, TMessageTypes::ID...> lookup({ &dispatch<TMessageTypes>... });
+
+        return lookup.find(id);
       }
     }
   };
-#else
+#endif
+}
+
+#if !ETL_USING_CPP17 || defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
 //*************************************************************************************************
 // For C++14 and below.
 //*************************************************************************************************
-  /*[[[cog
-      import cog
-      ################################################
-      # The first definition for all of the messages.
-      ################################################
-      cog.outl("//***************************************************************************")
-      cog.outl("// The definition for all %s message types." % Handlers)
-      cog.outl("//***************************************************************************")
-      cog.outl("template <typename TDerived,")
-      cog.out("          ")
-      cog.out("typename T1, ")
-      for n in range(2, int(Handlers)):
-          cog.out("typename T%s = void, " % n)
-          if n % 4 == 0:
-              cog.outl("")
-              cog.out("          ")
-      cog.outl("typename T%s = void>" % int(Handlers))
-      cog.out("class message_router")
-      cog.outl("  : public imessage_router")
-      cog.outl("{")
-      cog.outl("public:")
-      cog.outl("")
-      cog.outl("#if ETL_HAS_VIRTUAL_MESSAGES")
-      cog.out("  typedef etl::message_packet<")
-      for n in range(1, int(Handlers)):
-          cog.out("T%s, " % n)
-      cog.outl(" T%s> message_packet;" % int(Handlers))
-      cog.outl("#endif")
-      cog.outl("")
-      cog.outl("  //**********************************************")
-      cog.outl("  message_router(etl::message_router_id_t id_)")
-      cog.outl("    : imessage_router(id_)")
-      cog.outl("  {")
-      cog.outl("    ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  //**********************************************")
-      cog.outl("  message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)")
-      cog.outl("    : imessage_router(id_, successor_)")
-      cog.outl("  {")
-      cog.outl("    ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  //**********************************************")
-      cog.outl("  message_router()")
-      cog.outl("    : imessage_router(etl::imessage_router::MESSAGE_ROUTER)")
-      cog.outl("  {")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  //**********************************************")
-      cog.outl("  message_router(etl::imessage_router& successor_)")
-      cog.outl("    : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)")
-      cog.outl("  {")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  //**********************************************")
-      cog.outl("  using etl::imessage_router::receive;")
-      cog.outl("")
-      cog.outl("  void receive(const etl::imessage& msg) ETL_OVERRIDE")
-      cog.outl("  {")
-      cog.outl("    const etl::message_id_t id = msg.get_message_id();")
-      cog.outl("")
-      cog.outl("    switch (id)")
-      cog.outl("    {")
-      for n in range(1, int(Handlers) + 1):
-          cog.out("      case T%d::ID:" % n)
-          cog.out(" static_cast<TDerived*>(this)->on_receive(static_cast<const T%d&>(msg));" % n)
-          cog.outl(" break;")
-      cog.outl("      default:")
-      cog.outl("      {")
-      cog.outl("         if (has_successor())")
-      cog.outl("         {")
-      cog.outl("           get_successor().receive(msg);")
-      cog.outl("         }")
-      cog.outl("         else")
-      cog.outl("         {")
-      cog.outl("           static_cast<TDerived*>(this)->on_receive_unknown(msg);")
-      cog.outl("         }")
-      cog.outl("         break;")
-      cog.outl("      }")
-      cog.outl("    }")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  template <typename TMessage>")
-      cog.out("  typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, ")
-      for n in range(1, int(Handlers)):
-          cog.out("T%s, " % n)
-      cog.outl("T%s>::value, void>::type" % int(Handlers))
-      cog.outl("    receive(const TMessage& msg)")
-      cog.outl("  {")
-      cog.outl("    static_cast<TDerived*>(this)->on_receive(msg);")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  template <typename TMessage>")
-      cog.out("  typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, ")
-      for n in range(1, int(Handlers)):
-          cog.out("T%s, " % n)
-      cog.outl("T%s>::value, void>::type" % int(Handlers))
-      cog.outl("    receive(const TMessage& msg)")
-      cog.outl("  {")
-      cog.outl("    if (has_successor())")
-      cog.outl("    {")
-      cog.outl("      get_successor().receive(msg);")
-      cog.outl("    }")
-      cog.outl("    else")
-      cog.outl("    {")
-      cog.outl("      static_cast<TDerived*>(this)->on_receive_unknown(msg);")
-      cog.outl("    }")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  //**********************************************")
-      cog.outl("  using imessage_router::accepts;")
-      cog.outl("")
-      cog.outl("  bool accepts(etl::message_id_t id) const ETL_OVERRIDE")
-      cog.outl("  {")
-      cog.outl("    switch (id)")
-      cog.outl("    {")
-      cog.out("      ")
-      for n in range(1, int(Handlers) + 1):
-          cog.out("case T%d::ID: " % n)
-          if n % 8 == 0:
-              cog.outl("")
-              cog.out("      ")
-      cog.outl("  return true;")
-      cog.outl("      default:")
-      cog.outl("      {")
-      cog.outl("        if (has_successor())")
-      cog.outl("        {")
-      cog.outl("          return get_successor().accepts(id);")
-      cog.outl("        }")
-      cog.outl("        else")
-      cog.outl("        {")
-      cog.outl("          return false;")
-      cog.outl("        }")
-      cog.outl("      }")
-      cog.outl("    }")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  //********************************************")
-      cog.outl("  ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE")
-      cog.outl("  {")
-      cog.outl("    return false;")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  //********************************************")
-      cog.outl("  bool is_producer() const ETL_OVERRIDE")
-      cog.outl("  {")
-      cog.outl("    return true;")
-      cog.outl("  }")
-      cog.outl("")
-      cog.outl("  //********************************************")
-      cog.outl("  bool is_consumer() const ETL_OVERRIDE")
-      cog.outl("  {")
-      cog.outl("    return true;")
-      cog.outl("  }")
-      cog.outl("};")
-
-      ####################################
-      # All of the other specialisations.
-      ####################################
-      for n in range(int(Handlers) - 1, 0, -1):
-          cog.outl("")
-          cog.outl("//***************************************************************************")
-          if n == 1:
-              cog.outl("// Specialisation for %d message type." % n)
-          else:
-              cog.outl("// Specialisation for %d message types." % n)
-          cog.outl("//***************************************************************************")
-          cog.outl("template <typename TDerived, ")
-          cog.out("          ")
-          for t in range(1, n):
-              cog.out("typename T%d, " % t)
-              if t % 4 == 0:
-                  cog.outl("")
-                  cog.out("          ")
-          cog.outl("typename T%d>" % n)
-          cog.out("class message_router<TDerived, ")
-          for t in range(1, n + 1):
-              cog.out("T%d, " % t)
-              if t % 16 == 0:
-                  cog.outl("")
-                  cog.out("               ")
-          for t in range(n + 1, int(Handlers)):
-              cog.out("void, ")
-              if t % 16 == 0:
-                  cog.outl("")
-                  cog.out("               ")
-          cog.outl("void>")
-          cog.outl(" : public imessage_router")
-          cog.outl("{")
-          cog.outl("public:")
-          cog.outl("")
-          cog.outl("#if ETL_HAS_VIRTUAL_MESSAGES")
-          cog.out("  typedef etl::message_packet<")
-          for t in range(1, n):
-              cog.out("T%s, " % t)
-          cog.outl(" T%s> message_packet;" % n)
-          cog.outl("#endif")
-          cog.outl("")
-          cog.outl("  //**********************************************")
-          cog.outl("  message_router(etl::message_router_id_t id_)")
-          cog.outl("    : imessage_router(id_)")
-          cog.outl("  {")
-          cog.outl("    ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  //**********************************************")
-          cog.outl("  message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)")
-          cog.outl("    : imessage_router(id_, successor_)")
-          cog.outl("  {")
-          cog.outl("    ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  //**********************************************")
-          cog.outl("  message_router()")
-          cog.outl("    : imessage_router(etl::imessage_router::MESSAGE_ROUTER)")
-          cog.outl("  {")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  //**********************************************")
-          cog.outl("  message_router(etl::imessage_router& successor_)")
-          cog.outl("    : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)")
-          cog.outl("  {")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  //**********************************************")
-          cog.outl("  using etl::imessage_router::receive;")
-          cog.outl("")
-          cog.outl("  void receive(const etl::imessage& msg) ETL_OVERRIDE")
-          cog.outl("  {")
-          cog.outl("    const size_t id = msg.get_message_id();")
-          cog.outl("")
-          cog.outl("    switch (id)")
-          cog.outl("    {")
-          for t in range(1, n + 1):
-              cog.out("      case T%d::ID:" % t)
-              cog.out(" static_cast<TDerived*>(this)->on_receive(static_cast<const T%d&>(msg));" % t)
-              cog.outl(" break;")
-          cog.outl("      default:")
-          cog.outl("      {")
-          cog.outl("         if (has_successor())")
-          cog.outl("         {")
-          cog.outl("           get_successor().receive(msg);")
-          cog.outl("         }")
-          cog.outl("         else")
-          cog.outl("         {")
-          cog.outl("           static_cast<TDerived*>(this)->on_receive_unknown(msg);")
-          cog.outl("         }")
-          cog.outl("         break;")
-          cog.outl("      }")
-          cog.outl("    }")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  template <typename TMessage>")
-          cog.out("  typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, ")
-          for t in range(1, n):
-              cog.out("T%s, " % t)
-          cog.outl("T%s>::value, void>::type" % n)
-          cog.outl("    receive(const TMessage& msg)")
-          cog.outl("  {")
-          cog.outl("    static_cast<TDerived*>(this)->on_receive(msg);")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  template <typename TMessage>")
-          cog.out("  typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, ")
-          for t in range(1, n):
-              cog.out("T%s, " % t)
-          cog.outl("T%s>::value, void>::type" % n)
-          cog.outl("    receive(const TMessage& msg)")
-          cog.outl("  {")
-          cog.outl("    if (has_successor())")
-          cog.outl("    {")
-          cog.outl("      get_successor().receive(msg);")
-          cog.outl("    }")
-          cog.outl("    else")
-          cog.outl("    {")
-          cog.outl("      static_cast<TDerived*>(this)->on_receive_unknown(msg);")
-          cog.outl("    }")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("")
-          cog.outl("  //**********************************************")
-          cog.outl("  using imessage_router::accepts;")
-          cog.outl("")
-          cog.outl("  bool accepts(etl::message_id_t id) const ETL_OVERRIDE")
-          cog.outl("  {")
-          cog.outl("    switch (id)")
-          cog.outl("    {")
-          cog.out("      ")
-          for t in range(1, n + 1):
-              cog.out("case T%d::ID: " % t)
-              if t % 8 == 0:
-                  cog.outl("")
-                  cog.out("      ")
-          cog.outl("")
-          cog.outl("        return true;")
-          cog.outl("      default:")
-          cog.outl("      {")
-          cog.outl("        if (has_successor())")
-          cog.outl("        {")
-          cog.outl("          return get_successor().accepts(id);")
-          cog.outl("        }")
-          cog.outl("        else")
-          cog.outl("        {")
-          cog.outl("          return false;")
-          cog.outl("        }")
-          cog.outl("      }")
-          cog.outl("    }")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  //********************************************")
-          cog.outl("  ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE")
-          cog.outl("  {")
-          cog.outl("    return false;")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  //********************************************")
-          cog.outl("  bool is_producer() const ETL_OVERRIDE")
-          cog.outl("  {")
-          cog.outl("    return true;")
-          cog.outl("  }")
-          cog.outl("")
-          cog.outl("  //********************************************")
-          cog.outl("  bool is_consumer() const ETL_OVERRIDE")
-          cog.outl("  {")
-          cog.outl("    return true;")
-          cog.outl("  }")
-          cog.outl("};")
-  ]]]*/
-  /*[[[end]]]*/
+  #include "private/message_router_legacy.h"
 #endif
-}
 
 #endif
@@ -49,6 +49,9 @@ namespace etl
 {
   //*************************************************************************
   /// A templated abstract pool implementation that uses a fixed size pool.
+  /// Each item is aligned to VAlignment and padded to a multiple of it.
+  /// An alignment of a cache line therefore stops items from sharing a line.
+  /// Alignments above that of the fundamental types require C++11.
   ///\ingroup pool
   //*************************************************************************
   template <size_t VTypeSize, size_t VAlignment, size_t VSize>
@@ -82,6 +85,21 @@ namespace etl
       return ipool::allocate<U>();
     }
 
+    //*************************************************************************
+    /// Allocate storage for count objects from the pool, in one step.
+    /// Either all count items are allocated, or none are.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    size_t allocate_n(size_t count, TOutputIterator out)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool::allocate_n<U>(count, out);
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
@@ -206,6 +224,7 @@ namespace etl
   //*************************************************************************
   /// A templated abstract pool implementation that uses a fixed size pool.
   /// The storage for the pool is supplied externally.
+  /// Each item is aligned and padded as for etl::generic_pool.
   ///\ingroup pool
   //*************************************************************************
   template <size_t VTypeSize, size_t VAlignment>
@@ -250,6 +269,21 @@ namespace etl
       return ipool::allocate<U>();
     }
 
+    //*************************************************************************
+    /// Allocate storage for count objects from the pool, in one step.
+    /// Either all count items are allocated, or none are.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    size_t allocate_n(size_t count, TOutputIterator out)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool::allocate_n<U>(count, out);
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
@@ -40,6 +40,7 @@ SOFTWARE.
 #include "type_traits.h"
 #include "static_assert.h"
 #include "math.h"
+#include "smallest.h"
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -90,6 +91,108 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Folds an integral value of up to 32 bits to a size_t.
+    /// Multiply-xorshift, so that every bit of the value affects the result.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<(sizeof(T) <= sizeof(uint32_t)), size_t>::type
+    fold_integer(T v)
+    {
+      uint32_t h = static_cast<uint32_t>(v);
+
+      h ^= h >> 16U;
+      h *= 0x45D9F3BUL;
+      h ^= h >> 16U;
+
+      return static_cast<size_t>(h);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Folds a 64 bit integral value to a size_t, when size_t is narrower.
+    /// Multiply-xorshift, so that every bit of the value affects the result.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<(sizeof(T) == sizeof(uint64_t)), size_t>::type
+    fold_integer(T v)
+    {
+      uint64_t h = static_cast<uint64_t>(v);
+
+      h ^= h >> 32U;
+      h *= 0xD6E8FEB86659FD93ULL;
+      h ^= h >> 32U;
+
+      return static_cast<size_t>(h ^ (h >> 16U));
+    }
+#endif
+
+    //*************************************************************************
+    /// Folds the bit pattern of a value to a size_t.
+    /// Used for floating point and pointer values that are not the same
+    /// size as a size_t.
+    //*************************************************************************
+    template <typename T>
+    size_t fold_bits(T v)
+    {
+      typedef typename etl::smallest_uint_for_bits<sizeof(T) * CHAR_BIT>::type bits_t;
+
+      union
+      {
+        bits_t b;
+        T      v;
+      } u;
+
+      u.b = 0U;
+      u.v = v;
+
+      return fold_integer(u.b);
+    }
+
+    //*************************************************************************
+    /// Strong avalanche finaliser (murmur3 fmix32).
+    /// Every bit of the input affects every bit of the result, so the low bits
+    /// may be used to index a power of 2 sized table.
+    //*************************************************************************
+    template <size_t Size = sizeof(size_t)>
+    struct avalanche
+    {
+      static size_t mix(size_t hash)
+      {
+        uint32_t h = static_cast<uint32_t>(hash);
+
+        h ^= h >> 16U;
+        h *= 0x85EBCA6BUL;
+        h ^= h >> 13U;
+        h *= 0xC2B2AE35UL;
+        h ^= h >> 16U;
+
+        return static_cast<size_t>(h);
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Strong avalanche finaliser (murmur3 fmix64).
+    //*************************************************************************
+    template <>
+    struct avalanche<8U>
+    {
+      static size_t mix(size_t hash)
+      {
+        uint64_t h = static_cast<uint64_t>(hash);
+
+        h ^= h >> 33U;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33U;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33U;
+
+        return static_cast<size_t>(h);
+      }
+    };
+#endif
+
     //*************************************************************************
     /// Primary definition of base hash class, by default is poisoned
     //*************************************************************************
@@ -201,8 +304,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -223,8 +325,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -245,8 +346,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -267,8 +367,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -289,8 +388,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -311,8 +409,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -333,8 +430,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -355,8 +451,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -377,8 +472,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_integer(v);
       }
     }
   };
@@ -392,6 +486,11 @@ namespace etl
   {
     size_t operator ()(float v) const
     {
+      if (etl::is_zero(v))
+      { // -0.0 and 0.0 are represented differently at bit level
+        v = 0.0f;
+      }
+
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR(sizeof(size_t) == sizeof(v))
       {
@@ -401,18 +500,13 @@ namespace etl
           float  v;
         } u;
 
-        if (etl::is_zero(v))
-        { // -0.0 and 0.0 are represented differently at bit level
-          v = 0.0f;
-        }
         u.v = v;
 
         return u.s;
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_bits(v);
       }
     }
   };
@@ -426,6 +520,11 @@ namespace etl
   {
     size_t  operator ()(double v) const
     {
+      if (etl::is_zero(v))
+      { // -0.0 and 0.0 are represented differently at bit level
+        v = 0.0;
+      }
+
       // If it's the same size as a size_t.
       if ETL_IF_CONSTEXPR(sizeof(size_t) == sizeof(v))
       {
@@ -435,18 +534,13 @@ namespace etl
           double v;
         } u;
 
-        if (etl::is_zero(v))
-        { // -0.0 and 0.0 are represented differently at bit level
-          v = 0.0;
-        }
         u.v = v;
 
         return u.s;
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_bits(v);
       }
     }
   };
@@ -509,8 +603,7 @@ namespace etl
       }
       else
       {
-        uint8_t* p = reinterpret_cast<uint8_t*>(&v);
-        return private_hash::generic_hash<size_t>(p, p + sizeof(v));
+        return private_hash::fold_bits(v);
       }
     }
   };
@@ -536,6 +629,31 @@ namespace etl
       }
     };
   }
+
+  //***************************************************************************
+  /// A hash with strong avalanche.
+  /// Applies a finaliser to the result of THash, so that keys that only differ
+  /// in their upper bits, such as integers or aligned pointers, are spread over
+  /// the low bits. Use for tables that are indexed by masking with a power of 2.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename T, typename THash = etl::hash<T> >
+  struct avalanche_hash
+  {
+    size_t operator ()(const T& v) const
+    {
+      return private_hash::avalanche<>::mix(THash()(v));
+    }
+  };
+
+  //***************************************************************************
+  /// Applies the strong avalanche finaliser to a hash value.
+  ///\ingroup hash
+  //***************************************************************************
+  inline size_t hash_avalanche(size_t hash)
+  {
+    return private_hash::avalanche<>::mix(hash);
+  }
 }
 
 #include "private/diagnostic_pop.h"
@@ -65,6 +65,8 @@ namespace etl
         p_state = state_list[0];
         ETL_ASSERT(p_state != ETL_NULLPTR, ETL_ERROR(etl::fsm_null_state_exception));
 
+        cache_depths();
+
         if (call_on_enter_state)
         {
           etl::fsm_state_id_t next_state = do_enters(ETL_NULLPTR, p_state, true);
@@ -131,6 +133,17 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Handles a batch of messages, in order.
+    //*******************************************
+    void receive(message_span_t messages) ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        hfsm::receive(*messages[i]);
+      }
+    }
+
   private:
 
     //*******************************************
@@ -163,8 +176,17 @@ namespace etl
 
     //*******************************************
     /// Find the depth of the state.
+    /// Uses the depth cached when the HFSM was started.
+    //*******************************************
+    static size_t get_depth(const etl::ifsm_state* s)
+    {
+      return s->depth;
+    }
+
+    //*******************************************
+    /// Walk to the root to find the depth of the state.
     //*******************************************
-    static size_t get_depth(etl::ifsm_state* s)
+    static size_t find_depth(const etl::ifsm_state* s)
     {
       size_t depth = 0UL;
 
@@ -177,6 +199,19 @@ namespace etl
       return depth;
     }
 
+    //*******************************************
+    /// Caches the depth of every state, so that the common ancestor of
+    /// a transition can be found without walking each state to the root.
+    /// The state hierarchy must not change after the HFSM has started.
+    //*******************************************
+    void cache_depths()
+    {
+      for (etl::fsm_state_id_t i = 0U; i < number_of_states; ++i)
+      {
+        state_list[i]->depth = etl::fsm_state_id_t(find_depth(state_list[i]));
+      }
+    }
+
     //*******************************************
     /// Align the depths of the states.
     //*******************************************
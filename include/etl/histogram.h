@@ -40,6 +40,8 @@ SOFTWARE.
 #include "type_traits.h"
 #include "integral_limits.h"
 
+#include <math.h>
+
 namespace etl
 {
   namespace private_histogram
@@ -96,6 +98,7 @@ namespace etl
       void clear()
       {
         accumulator.fill(TCount(0));
+        cumulative_valid = false;
       }
 
       //*********************************
@@ -124,7 +127,65 @@ namespace etl
 
     protected:
 
+      //*********************************
+      /// Constructor.
+      //*********************************
+      histogram_common()
+        : cumulative_valid(false)
+      {
+      }
+
+      //*********************************
+      /// Marks the cumulative counts as out of date.
+      //*********************************
+      void invalidate_cumulative()
+      {
+        cumulative_valid = false;
+      }
+
+      //*********************************
+      /// The offset of the bin that holds the percentile.
+      /// The nearest rank method: the first bin at which the cumulative
+      /// count reaches percentile% of the total.
+      /// The cumulative counts are updated, if out of date, then searched.
+      /// If the histogram is empty, returns 0.
+      //*********************************
+      size_t percentile_offset(double percentile) const
+      {
+        if (!cumulative_valid)
+        {
+          size_t total = 0U;
+
+          for (size_t i = 0U; i < Max_Size; ++i)
+          {
+            total += size_t(accumulator[i]);
+            cumulative[i] = total;
+          }
+
+          cumulative_valid = true;
+        }
+
+        const size_t total = cumulative[Max_Size - 1U];
+
+        if (total == 0U)
+        {
+          return 0U;
+        }
+
+        percentile = (percentile < 0.0) ? 0.0 : ((percentile > 100.0) ? 100.0 : percentile);
+
+        size_t rank = size_t(ceil((percentile * double(total)) / 100.0));
+        rank = (rank == 0U) ? 1U : ((rank > total) ? total : rank);
+
+        return size_t(etl::lower_bound(cumulative.begin(), cumulative.end(), rank) - cumulative.begin());
+      }
+
       etl::array<TCount, Max_Size> accumulator;
+
+    private:
+
+      mutable etl::array<size_t, Max_Size> cumulative;
+      mutable bool                         cumulative_valid;
     };
 
     template <typename TCount, size_t Max_Size_>
@@ -190,6 +251,7 @@ namespace etl
     histogram& operator =(const histogram& rhs)
     {
       this->accumulator = rhs.accumulator;
+      this->invalidate_cumulative();
 
       return *this;
     }
@@ -201,6 +263,7 @@ namespace etl
     histogram& operator =(histogram&& rhs)
     {
       this->accumulator = etl::move(rhs.accumulator);
+      this->invalidate_cumulative();
 
       return *this;
     }
@@ -212,6 +275,7 @@ namespace etl
     void add(key_type key)
     {
       ++this->accumulator[key - Start_Index];
+      this->invalidate_cumulative();
     }
 
     //*********************************
@@ -222,9 +286,11 @@ namespace etl
     {
       while (first != last)
       {
-        add(*first);
+        ++this->accumulator[*first - Start_Index];
         ++first;
       }
+
+      this->invalidate_cumulative();
     }
 
     //*********************************
@@ -251,6 +317,19 @@ namespace etl
     {
       return this->accumulator[key - Start_Index];
     }
+
+    //*********************************
+    /// The key of the percentile, from 0 to 100.
+    /// The nearest rank method: the lowest key at which the cumulative
+    /// count reaches percentile% of the total.
+    /// The cumulative counts are recalculated on the first query after the
+    /// histogram changes, so consecutive queries cost O(log Max_Size).
+    /// If the histogram is empty, returns the first key.
+    //*********************************
+    key_type percentile(double percentile_) const
+    {
+      return key_type(Start_Index + int32_t(this->percentile_offset(percentile_)));
+    }
   };
 
   //***************************************************************************
@@ -294,6 +373,7 @@ namespace etl
     /// Copy constructor
     //*********************************
     histogram(const histogram& other)
+      : start_index(other.start_index)
     {
       this->accumulator = other.accumulator;
     }
@@ -303,6 +383,7 @@ namespace etl
     /// Move constructor
     //*********************************
     histogram(histogram&& other)
+      : start_index(other.start_index)
     {
       this->accumulator = etl::move(other.accumulator);
     }
@@ -314,6 +395,8 @@ namespace etl
     histogram& operator =(const histogram& rhs)
     {
       this->accumulator = rhs.accumulator;
+      this->invalidate_cumulative();
+      start_index = rhs.start_index;
 
       return *this;
     }
@@ -325,6 +408,8 @@ namespace etl
     histogram& operator =(histogram&& rhs)
     {
       this->accumulator = etl::move(rhs.accumulator);
+      this->invalidate_cumulative();
+      start_index = rhs.start_index;
 
       return *this;
     }
@@ -336,6 +421,7 @@ namespace etl
     void add(key_type key)
     {
       ++this->accumulator[key - start_index];
+      this->invalidate_cumulative();
     }
 
     //*********************************
@@ -346,9 +432,11 @@ namespace etl
     {
       while (first != last)
       {
-        add(*first);
+        ++this->accumulator[*first - start_index];
         ++first;
       }
+
+      this->invalidate_cumulative();
     }
 
     //*********************************
@@ -376,6 +464,19 @@ namespace etl
       return this->accumulator[key - start_index];
     }
 
+    //*********************************
+    /// The key of the percentile, from 0 to 100.
+    /// The nearest rank method: the lowest key at which the cumulative
+    /// count reaches percentile% of the total.
+    /// The cumulative counts are recalculated on the first query after the
+    /// histogram changes, so consecutive queries cost O(log Max_Size).
+    /// If the histogram is empty, returns the first key.
+    //*********************************
+    key_type percentile(double percentile_) const
+    {
+      return key_type(start_index + this->percentile_offset(percentile_));
+    }
+
   private:
 
     key_type start_index;
@@ -481,7 +582,7 @@ namespace etl
     //*********************************
     const_iterator end() const
     {
-      return accumulator.begin();
+      return accumulator.end();
     }
 
     //*********************************
@@ -489,7 +590,7 @@ namespace etl
     //*********************************
     const_iterator cend() const
     {
-      return accumulator.cbegin();
+      return accumulator.cend();
     }
 
     //*********************************
@@ -549,6 +650,46 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// The key of the percentile, from 0 to 100.
+    /// The nearest rank method: the lowest key at which the cumulative
+    /// count reaches percentile% of the total.
+    /// O(size()), as there are only as many bins as keys seen.
+    /// If the histogram is empty, returns a default constructed key.
+    //*********************************
+    key_type percentile(double percentile_) const
+    {
+      const size_t total = count();
+
+      if (total == 0U)
+      {
+        return key_type();
+      }
+
+      percentile_ = (percentile_ < 0.0) ? 0.0 : ((percentile_ > 100.0) ? 100.0 : percentile_);
+
+      size_t rank = size_t(ceil((percentile_ * double(total)) / 100.0));
+      rank = (rank == 0U) ? 1U : ((rank > total) ? total : rank);
+
+      size_t cumulative = 0U;
+
+      const_iterator itr = accumulator.begin();
+
+      while (itr != accumulator.end())
+      {
+        cumulative += size_t((*itr).second);
+
+        if (cumulative >= rank)
+        {
+          break;
+        }
+
+        ++itr;
+      }
+
+      return (*itr).first;
+    }
+
     //*********************************
     /// Clear the histogram.
     //*********************************
@@ -578,13 +719,13 @@ namespace etl
     //*********************************
     size_t count() const
     {
-      count_type sum = count_type(0);
+      size_t sum = 0U;
 
       const_iterator itr = accumulator.begin();
 
       while (itr != accumulator.end())
       {
-        sum += (*itr).second;
+        sum += size_t((*itr).second);
         ++itr;
       }
 
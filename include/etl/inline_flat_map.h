@@ -0,0 +1,1597 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INLINE_FLAT_MAP_INCLUDED
+#define ETL_INLINE_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "memory.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+#include "nth_type.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup inline_flat_map inline_flat_map
+/// A flat_map with the capacity defined at compile time.
+/// The keys are stored contiguously in a sorted array, with the mapped values
+/// in a parallel array, so that a search only touches the keys.
+/// Has insertion of O(N) and search of O(logN).
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the inline_flat_map.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  class inline_flat_map_exception : public etl::exception
+  {
+  public:
+
+    inline_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the inline_flat_map.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  class inline_flat_map_full : public etl::inline_flat_map_exception
+  {
+  public:
+
+    inline_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::inline_flat_map_exception(ETL_ERROR_TEXT("inline_flat_map:full", ETL_INLINE_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the inline_flat_map.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  class inline_flat_map_out_of_bounds : public etl::inline_flat_map_exception
+  {
+  public:
+
+    inline_flat_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::inline_flat_map_exception(ETL_ERROR_TEXT("inline_flat_map:bounds", ETL_INLINE_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized inline_flat_maps.
+  /// Can be used as a reference type for all inline_flat_maps containing a specific type.
+  /// As the keys and mapped values are held in separate arrays, the iterators
+  /// return a proxy holding references to the key and mapped value, in the
+  /// same way as C++23's std::flat_map.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class iinline_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKey                                  key_type;
+    typedef TMapped                               mapped_type;
+    typedef TKeyCompare                           key_compare;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    //*************************************************************************
+    /// The proxy for a reference to an element.
+    //*************************************************************************
+    class reference
+    {
+    public:
+
+      reference(const key_type& first_, mapped_type& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      operator value_type() const
+      {
+        return value_type(first, second);
+      }
+
+      const key_type& first;
+      mapped_type&    second;
+    };
+
+    //*************************************************************************
+    /// The proxy for a const reference to an element.
+    //*************************************************************************
+    class const_reference
+    {
+    public:
+
+      const_reference(const key_type& first_, const mapped_type& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      const_reference(const reference& other)
+        : first(other.first)
+        , second(other.second)
+      {
+      }
+
+      operator value_type() const
+      {
+        return value_type(first, second);
+      }
+
+      const key_type&    first;
+      const mapped_type& second;
+    };
+
+    //*************************************************************************
+    /// The proxy for a pointer to an element.
+    /// Holds the reference proxy so that operator -> can return its address.
+    //*************************************************************************
+    template <typename TReference>
+    class arrow_proxy
+    {
+    public:
+
+      explicit arrow_proxy(const TReference& reference_)
+        : proxy(reference_)
+      {
+      }
+
+      const TReference* operator ->() const
+      {
+        return &proxy;
+      }
+
+    private:
+
+      TReference proxy;
+    };
+
+    typedef arrow_proxy<reference>       pointer;
+    typedef arrow_proxy<const_reference> const_pointer;
+
+    class const_iterator;
+
+    //*************************************************************************
+    class iterator
+    {
+    public:
+
+      typedef ETL_OR_STD::random_access_iterator_tag iterator_category;
+      typedef typename iinline_flat_map::value_type      value_type;
+      typedef typename iinline_flat_map::difference_type difference_type;
+      typedef typename iinline_flat_map::pointer         pointer;
+      typedef typename iinline_flat_map::reference       reference;
+
+      friend class iinline_flat_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pkey(ETL_NULLPTR)
+        , pmapped(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return reference(*pkey, *pmapped);
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return pointer(operator *());
+      }
+
+      //*********************************
+      reference operator [](difference_type n) const
+      {
+        return reference(pkey[n], pmapped[n]);
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        ++pkey;
+        ++pmapped;
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator ++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator --()
+      {
+        --pkey;
+        --pmapped;
+        return *this;
+      }
+
+      //*********************************
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        operator --();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator +=(difference_type n)
+      {
+        pkey    += n;
+        pmapped += n;
+        return *this;
+      }
+
+      //*********************************
+      iterator& operator -=(difference_type n)
+      {
+        pkey    -= n;
+        pmapped -= n;
+        return *this;
+      }
+
+      //*********************************
+      friend iterator operator +(iterator lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      //*********************************
+      friend iterator operator +(difference_type n, iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      //*********************************
+      friend iterator operator -(iterator lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      //*********************************
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pkey - rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pkey == rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //*********************************
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pkey < rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      //*********************************
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //*********************************
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(const key_type* pkey_, mapped_type* pmapped_)
+        : pkey(pkey_)
+        , pmapped(pmapped_)
+      {
+      }
+
+      const key_type* pkey;
+      mapped_type*    pmapped;
+    };
+
+    //*************************************************************************
+    class const_iterator
+    {
+    public:
+
+      typedef ETL_OR_STD::random_access_iterator_tag iterator_category;
+      typedef typename iinline_flat_map::value_type      value_type;
+      typedef typename iinline_flat_map::difference_type difference_type;
+      typedef typename iinline_flat_map::const_pointer   pointer;
+      typedef typename iinline_flat_map::const_reference reference;
+
+      friend class iinline_flat_map;
+
+      //*********************************
+      const_iterator()
+        : pkey(ETL_NULLPTR)
+        , pmapped(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iinline_flat_map::iterator& other)
+        : pkey(other.pkey)
+        , pmapped(other.pmapped)
+      {
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return reference(*pkey, *pmapped);
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return pointer(operator *());
+      }
+
+      //*********************************
+      reference operator [](difference_type n) const
+      {
+        return reference(pkey[n], pmapped[n]);
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        ++pkey;
+        ++pmapped;
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator ++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator --()
+      {
+        --pkey;
+        --pmapped;
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        operator --();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator +=(difference_type n)
+      {
+        pkey    += n;
+        pmapped += n;
+        return *this;
+      }
+
+      //*********************************
+      const_iterator& operator -=(difference_type n)
+      {
+        pkey    -= n;
+        pmapped -= n;
+        return *this;
+      }
+
+      //*********************************
+      friend const_iterator operator +(const_iterator lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      //*********************************
+      friend const_iterator operator +(difference_type n, const_iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      //*********************************
+      friend const_iterator operator -(const_iterator lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      //*********************************
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pkey - rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pkey == rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //*********************************
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pkey < rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      //*********************************
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //*********************************
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const key_type* pkey_, const mapped_type* pmapped_)
+        : pkey(pkey_)
+        , pmapped(pmapped_)
+      {
+      }
+
+      const key_type*    pkey;
+      const mapped_type* pmapped;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the inline_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(pkeys, pmapped);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the inline_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(pkeys, pmapped);
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the inline_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(pkeys + current_size, pmapped + current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the inline_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(pkeys + current_size, pmapped + current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the inline_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the inline_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns a reverse_iterator to the reverse beginning of the inline_flat_map.
+    //*********************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the inline_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse_iterator to the reverse end of the inline_flat_map.
+    //*********************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the reverse end of the inline_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the inline_flat_map.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the reverse end of the inline_flat_map.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a pointer to the sorted array of keys.
+    //*********************************************************************
+    const key_type* keys() const
+    {
+      return pkeys;
+    }
+
+    //*********************************************************************
+    /// Returns a pointer to the array of mapped values, in key order.
+    //*********************************************************************
+    mapped_type* values()
+    {
+      return pmapped;
+    }
+
+    //*********************************************************************
+    /// Returns a const pointer to the array of mapped values, in key order.
+    //*********************************************************************
+    const mapped_type* values() const
+    {
+      return pmapped;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key does not exist.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if a new value is required and the map is full.
+    ///\param key The key.
+    ///\return A reference to the value at key 'key'.
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      size_t index = lower_bound_index(key);
+
+      if (!has_key_at(index, key))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(inline_flat_map_full));
+
+        open_at(index);
+        ::new (pkeys + index) key_type(key);
+        ::new (pmapped + index) mapped_type();
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pmapped[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key does not exist.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if a new value is required and the map is full.
+    ///\param key The key.
+    ///\return A reference to the value at key 'key'.
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      size_t index = lower_bound_index(key);
+
+      if (!has_key_at(index, key))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(inline_flat_map_full));
+
+        open_at(index);
+        ::new (pkeys + index) key_type(etl::move(key));
+        ::new (pmapped + index) mapped_type();
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pmapped[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at key 'key'.
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      size_t index = lower_bound_index(key);
+
+      ETL_ASSERT(has_key_at(index, key), ETL_ERROR(inline_flat_map_out_of_bounds));
+
+      return pmapped[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      size_t index = lower_bound_index(key);
+
+      ETL_ASSERT(has_key_at(index, key), ETL_ERROR(inline_flat_map_out_of_bounds));
+
+      return pmapped[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at key 'key'.
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      size_t index = lower_bound_index(key);
+
+      ETL_ASSERT(has_key_at(index, key), ETL_ERROR(inline_flat_map_out_of_bounds));
+
+      return pmapped[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      size_t index = lower_bound_index(key);
+
+      ETL_ASSERT(has_key_at(index, key), ETL_ERROR(inline_flat_map_out_of_bounds));
+
+      return pmapped[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the inline_flat_map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the inline_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the inline_flat_map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the inline_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& value)
+    {
+      return emplace(value.first, value.second);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the inline_flat_map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the inline_flat_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the inline_flat_map.
+    /// Ranges that are sorted by key are appended without moving any elements.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the inline_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        emplace((*first).first, (*first).second);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Emplaces a value to the inline_flat_map.
+    /// The mapped value is only constructed if the key does not already exist.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the inline_flat_map is already full.
+    ///\param key  The key.
+    ///\param args The arguments used to construct the mapped value.
+    //*********************************************************************
+    template <typename TKeyType, typename... TArgs>
+    ETL_OR_STD::pair<iterator, bool> emplace(TKeyType&& key, TArgs&&... args)
+    {
+      size_t index = lower_bound_index(key);
+
+      if (has_key_at(index, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(inline_flat_map_full), (ETL_OR_STD::pair<iterator, bool>(end(), false)));
+
+      open_at(index);
+      ::new (pkeys + index) key_type(etl::forward<TKeyType>(key));
+      ::new (pmapped + index) mapped_type(etl::forward<TArgs>(args)...);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), true);
+    }
+#else
+    //*********************************************************************
+    /// Emplaces a value to the inline_flat_map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the inline_flat_map is already full.
+    ///\param key    The key.
+    ///\param mapped The mapped value.
+    //*********************************************************************
+    template <typename TKeyType, typename TMappedType>
+    ETL_OR_STD::pair<iterator, bool> emplace(const TKeyType& key, const TMappedType& mapped)
+    {
+      size_t index = lower_bound_index(key);
+
+      if (has_key_at(index, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(inline_flat_map_full), (ETL_OR_STD::pair<iterator, bool>(end(), false)));
+
+      open_at(index);
+      ::new (pkeys + index) key_type(key);
+      ::new (pmapped + index) mapped_type(mapped);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      size_t index = lower_bound_index(key);
+
+      if (!has_key_at(index, key))
+      {
+        return 0U;
+      }
+
+      erase_range(index, index + 1U);
+
+      return 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t erase(K&& key)
+    {
+      size_t index = lower_bound_index(key);
+
+      if (!has_key_at(index, key))
+      {
+        return 0U;
+      }
+
+      erase_range(index, index + 1U);
+
+      return 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element following the erased one.
+    //*********************************************************************
+    iterator erase(iterator i_element)
+    {
+      size_t index = index_of(i_element.pkey);
+
+      erase_range(index, index + 1U);
+
+      return iterator_at(index);
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element following the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      size_t index = index_of(i_element.pkey);
+
+      erase_range(index, index + 1U);
+
+      return iterator_at(index);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element following the erased ones.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      size_t index = index_of(first.pkey);
+
+      erase_range(index, index_of(last.pkey));
+
+      return iterator_at(index);
+    }
+
+    //*************************************************************************
+    /// Clears the inline_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      erase_range(0U, current_size);
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      size_t index = lower_bound_index(key);
+
+      return has_key_at(index, key) ? iterator_at(index) : end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      size_t index = lower_bound_index(key);
+
+      return has_key_at(index, key) ? iterator_at(index) : end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      size_t index = lower_bound_index(key);
+
+      return has_key_at(index, key) ? const_iterator_at(index) : end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      size_t index = lower_bound_index(key);
+
+      return has_key_at(index, key) ? const_iterator_at(index) : end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return has_key_at(lower_bound_index(key), key) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return has_key_at(lower_bound_index(key), key) ? 1U : 0U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Check if the map contains the key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return has_key_at(lower_bound_index(key), key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return has_key_at(lower_bound_index(key), key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return iterator_at(lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator_at(lower_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return const_iterator_at(lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator_at(lower_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      return iterator_at(upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator_at(upper_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return const_iterator_at(upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator_at(upper_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      size_t index = lower_bound_index(key);
+
+      return ETL_OR_STD::pair<iterator, iterator>(iterator_at(index), iterator_at(has_key_at(index, key) ? index + 1U : index));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      size_t index = lower_bound_index(key);
+
+      return ETL_OR_STD::pair<iterator, iterator>(iterator_at(index), iterator_at(has_key_at(index, key) ? index + 1U : index));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      size_t index = lower_bound_index(key);
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(const_iterator_at(index), const_iterator_at(has_key_at(index, key) ? index + 1U : index));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      size_t index = lower_bound_index(key);
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(const_iterator_at(index), const_iterator_at(has_key_at(index, key) ? index + 1U : index));
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iinline_flat_map& operator = (const iinline_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iinline_flat_map& operator = (iinline_flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the current size of the inline_flat_map.
+    ///\return The current size of the inline_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the inline_flat_map.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the inline_flat_map.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the inline_flat_map.
+    ///\return The capacity of the inline_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the inline_flat_map.
+    ///\return The maximum size of the inline_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iinline_flat_map(key_type* pkeys_, mapped_type* pmapped_, size_t capacity_)
+      : pkeys(pkeys_)
+      , pmapped(pmapped_)
+      , current_size(0U)
+      , CAPACITY(capacity_)
+    {
+    }
+
+    //*********************************************************************
+    /// Copies the elements of another inline_flat_map.
+    /// As they are already in order, no comparisons are made.
+    //*********************************************************************
+    void copy_from(const iinline_flat_map& other)
+    {
+      clear();
+
+      ETL_ASSERT_OR_RETURN(other.size() <= CAPACITY, ETL_ERROR(inline_flat_map_full));
+
+      for (size_t i = 0U; i < other.size(); ++i)
+      {
+        ::new (pkeys + i) key_type(other.pkeys[i]);
+        ::new (pmapped + i) mapped_type(other.pmapped[i]);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Moves the elements of another inline_flat_map.
+    /// As they are already in order, no comparisons are made.
+    //*********************************************************************
+    void move_from(iinline_flat_map& other)
+    {
+      clear();
+
+      ETL_ASSERT_OR_RETURN(other.size() <= CAPACITY, ETL_ERROR(inline_flat_map_full));
+
+      for (size_t i = 0U; i < other.size(); ++i)
+      {
+        ::new (pkeys + i) key_type(etl::move(other.pkeys[i]));
+        ::new (pmapped + i) mapped_type(etl::move(other.pmapped[i]));
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      other.clear();
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    iinline_flat_map(const iinline_flat_map&);
+
+    //*********************************************************************
+    template <typename K>
+    size_t lower_bound_index(const K& key) const
+    {
+      return static_cast<size_t>(etl::lower_bound(pkeys, pkeys + current_size, key, compare) - pkeys);
+    }
+
+    //*********************************************************************
+    template <typename K>
+    size_t upper_bound_index(const K& key) const
+    {
+      return static_cast<size_t>(etl::upper_bound(pkeys, pkeys + current_size, key, compare) - pkeys);
+    }
+
+    //*********************************************************************
+    /// Checks whether the key at the lower bound index is equal to key.
+    //*********************************************************************
+    template <typename K>
+    bool has_key_at(size_t index, const K& key) const
+    {
+      return (index != current_size) && !compare(key, pkeys[index]);
+    }
+
+    //*********************************************************************
+    size_t index_of(const key_type* pkey) const
+    {
+      return static_cast<size_t>(pkey - pkeys);
+    }
+
+    //*********************************************************************
+    iterator iterator_at(size_t index)
+    {
+      return iterator(pkeys + index, pmapped + index);
+    }
+
+    //*********************************************************************
+    const_iterator const_iterator_at(size_t index) const
+    {
+      return const_iterator(pkeys + index, pmapped + index);
+    }
+
+    //*********************************************************************
+    /// Moves the elements from index up by one, leaving the storage at index
+    /// unconstructed. Does not change current_size.
+    //*********************************************************************
+    void open_at(size_t index)
+    {
+      if (index != current_size)
+      {
+        const size_t last = current_size - 1U;
+
+        ::new (pkeys + current_size) key_type(ETL_MOVE(pkeys[last]));
+        ::new (pmapped + current_size) mapped_type(ETL_MOVE(pmapped[last]));
+
+        etl::move_backward(pkeys + index, pkeys + last, pkeys + current_size);
+        etl::move_backward(pmapped + index, pmapped + last, pmapped + current_size);
+
+        pkeys[index].~key_type();
+        pmapped[index].~mapped_type();
+      }
+    }
+
+    //*********************************************************************
+    /// Erases the elements in the index range [first, last).
+    //*********************************************************************
+    void erase_range(size_t first, size_t last)
+    {
+      if (first == last)
+      {
+        return;
+      }
+
+      etl::move(pkeys + last, pkeys + current_size, pkeys + first);
+      etl::move(pmapped + last, pmapped + current_size, pmapped + first);
+
+      const size_t new_size = current_size - (last - first);
+
+      for (size_t i = new_size; i < current_size; ++i)
+      {
+        pkeys[i].~key_type();
+        pmapped[i].~mapped_type();
+        ETL_DECREMENT_DEBUG_COUNT;
+      }
+
+      current_size = new_size;
+    }
+
+    key_type*       pkeys;
+    mapped_type*    pmapped;
+    size_type       current_size;
+    const size_type CAPACITY;
+    key_compare     compare;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INLINE_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinline_flat_map()
+    {
+    }
+#else
+  protected:
+    ~iinline_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first inline_flat_map.
+  ///\param rhs Reference to the second inline_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::iinline_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::iinline_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) &&
+           etl::equal(lhs.keys(), lhs.keys() + lhs.size(), rhs.keys()) &&
+           etl::equal(lhs.values(), lhs.values() + lhs.size(), rhs.values());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first inline_flat_map.
+  ///\param rhs Reference to the second inline_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::iinline_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::iinline_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// An inline_flat_map implementation that uses fixed size buffers.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The mapped type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class inline_flat_map : public etl::iinline_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::iinline_flat_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    inline_flat_map()
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TValue*>(&mapped_buffer), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    inline_flat_map(const inline_flat_map& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TValue*>(&mapped_buffer), MAX_SIZE)
+    {
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    inline_flat_map(inline_flat_map&& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TValue*>(&mapped_buffer), MAX_SIZE)
+    {
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    inline_flat_map(TIterator first, TIterator last)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TValue*>(&mapped_buffer), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    inline_flat_map(std::initializer_list<typename base::value_type> init)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TValue*>(&mapped_buffer), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inline_flat_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    inline_flat_map& operator = (const inline_flat_map& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    inline_flat_map& operator = (inline_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted keys.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE_, etl::alignment_of<TKey>::value>::type key_buffer;
+
+    /// The mapped values, in key order.
+    typename etl::aligned_storage<sizeof(TValue) * MAX_SIZE_, etl::alignment_of<TValue>::value>::type mapped_buffer;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t inline_flat_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  inline_flat_map(TPairs...) -> inline_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                typename etl::nth_type_t<0, TPairs...>::second_type,
+                                                sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename... TPairs>
+  constexpr auto make_inline_flat_map(TPairs&&... pairs) -> etl::inline_flat_map<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return { etl::forward<TPairs>(pairs)... };
+  }
+#endif
+}
+
+#endif
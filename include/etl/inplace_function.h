@@ -0,0 +1,458 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INPLACE_FUNCTION_INCLUDED
+#define ETL_INPLACE_FUNCTION_INCLUDED
+
+#include "platform.h"
+
+#if ETL_USING_CPP11
+
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "placement_new.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+
+///\defgroup inplace_function inplace_function
+/// A callable wrapper that stores the callable object inside itself.
+/// Unlike etl::delegate, which only refers to a callable, an inplace_function
+/// owns a copy of it, so capturing lambdas need not outlive it. Unlike
+/// std::function, it never allocates. A callable that does not fit the
+/// capacity is a compile time error.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for inplace_function exceptions.
+  //***************************************************************************
+  class inplace_function_exception : public etl::exception
+  {
+  public:
+
+    inplace_function_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an empty inplace_function is called.
+  //***************************************************************************
+  class inplace_function_uninitialised : public etl::inplace_function_exception
+  {
+  public:
+
+    inplace_function_uninitialised(string_type file_name_, numeric_type line_number_)
+      : inplace_function_exception(ETL_ERROR_TEXT("inplace_function:uninitialised", ETL_INPLACE_FUNCTION_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an inplace_function holding a move only
+  /// callable is copied.
+  //***************************************************************************
+  class inplace_function_not_copyable : public etl::inplace_function_exception
+  {
+  public:
+
+    inplace_function_not_copyable(string_type file_name_, numeric_type line_number_)
+      : inplace_function_exception(ETL_ERROR_TEXT("inplace_function:not copyable", ETL_INPLACE_FUNCTION_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  /// The default capacity of an inplace_function, in bytes.
+  static ETL_CONSTANT size_t inplace_function_default_capacity = 4U * sizeof(void*);
+
+  //*************************************************************************
+  /// Declaration.
+  //*************************************************************************
+  template <typename TSignature, size_t Capacity = etl::inplace_function_default_capacity, size_t Alignment = etl::alignment_of<void*>::value>
+  class inplace_function;
+
+  namespace private_inplace_function
+  {
+    //*************************************************************************
+    /// The operations for a stored callable type.
+    /// One constant instance exists for each type that is stored.
+    //*************************************************************************
+    template <typename TReturn, typename... TParams>
+    struct operations
+    {
+      TReturn (*invoke)(void* p_object, TParams&&... args);
+      void    (*copy)(void* p_destination, const void* p_source);     ///< ETL_NULLPTR if the callable is move only.
+      void    (*move)(void* p_destination, void* p_source) ETL_NOEXCEPT; ///< Moves, then destroys the source.
+      void    (*destroy)(void* p_object) ETL_NOEXCEPT;
+    };
+
+    //*************************************************************************
+    /// The copy operation, or ETL_NULLPTR for move only callables.
+    //*************************************************************************
+    template <typename TCallable, bool Is_Copyable>
+    struct copier
+    {
+      static void copy(void* p_destination, const void* p_source)
+      {
+        ::new (p_destination) TCallable(*static_cast<const TCallable*>(p_source));
+      }
+
+      static constexpr void (*function)(void*, const void*) = &copy;
+    };
+
+    template <typename TCallable, bool Is_Copyable>
+    constexpr void (*copier<TCallable, Is_Copyable>::function)(void*, const void*);
+
+    template <typename TCallable>
+    struct copier<TCallable, false>
+    {
+      static constexpr void (*function)(void*, const void*) = ETL_NULLPTR;
+    };
+
+    template <typename TCallable>
+    constexpr void (*copier<TCallable, false>::function)(void*, const void*);
+
+    //*************************************************************************
+    template <typename TCallable, typename TReturn, typename... TParams>
+    struct stub
+    {
+      static TReturn invoke(void* p_object, TParams&&... args)
+      {
+        return (*static_cast<TCallable*>(p_object))(etl::forward<TParams>(args)...);
+      }
+
+      static void move(void* p_destination, void* p_source) ETL_NOEXCEPT
+      {
+        TCallable& source = *static_cast<TCallable*>(p_source);
+
+        ::new (p_destination) TCallable(etl::move(source));
+        source.~TCallable();
+      }
+
+      static void destroy(void* p_object) ETL_NOEXCEPT
+      {
+        static_cast<TCallable*>(p_object)->~TCallable();
+      }
+
+      static constexpr operations<TReturn, TParams...> ops =
+      {
+        &invoke,
+        copier<TCallable, etl::is_copy_constructible<TCallable>::value>::function,
+        &move,
+        &destroy
+      };
+    };
+
+    template <typename TCallable, typename TReturn, typename... TParams>
+    constexpr operations<TReturn, TParams...> stub<TCallable, TReturn, TParams...>::ops;
+
+    //*************************************************************************
+    template <typename T>
+    struct is_inplace_function : etl::false_type
+    {
+    };
+
+    template <typename TSignature, size_t Capacity, size_t Alignment>
+    struct is_inplace_function<etl::inplace_function<TSignature, Capacity, Alignment> > : etl::true_type
+    {
+    };
+  }
+
+  //*************************************************************************
+  /// Specialisation.
+  /// \tparam Capacity  The number of bytes available for the callable.
+  /// \tparam Alignment The alignment of the storage.
+  //*************************************************************************
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  class inplace_function<TReturn(TParams...), Capacity, Alignment>
+  {
+  public:
+
+    typedef TReturn result_type;
+
+    static ETL_CONSTANT size_t capacity  = Capacity;
+    static ETL_CONSTANT size_t alignment = Alignment;
+
+    //*************************************************************************
+    /// Default constructor. Empty.
+    //*************************************************************************
+    inplace_function() ETL_NOEXCEPT
+      : p_ops(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from nullptr. Empty.
+    //*************************************************************************
+    inplace_function(etl::nullptr_t) ETL_NOEXCEPT
+      : p_ops(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a callable object, such as a lambda or function pointer.
+    /// The callable is copied or moved into the storage.
+    //*************************************************************************
+    template <typename TCallable,
+              typename TDecayed = typename etl::decay<TCallable>::type,
+              typename = typename etl::enable_if<!private_inplace_function::is_inplace_function<TDecayed>::value &&
+                                                 !etl::is_same<TDecayed, etl::nullptr_t>::value>::type>
+    inplace_function(TCallable&& callable)
+      : p_ops(ETL_NULLPTR)
+    {
+      construct<TDecayed>(etl::forward<TCallable>(callable));
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Asserts inplace_function_not_copyable if the callable is move only.
+    //*************************************************************************
+    inplace_function(const inplace_function& other)
+      : p_ops(ETL_NULLPTR)
+    {
+      copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Move constructor. The other is left empty.
+    /// The callable's move constructor should not throw.
+    //*************************************************************************
+    inplace_function(inplace_function&& other) ETL_NOEXCEPT
+      : p_ops(ETL_NULLPTR)
+    {
+      move_from(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inplace_function()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    //*************************************************************************
+    inplace_function& operator =(const inplace_function& rhs)
+    {
+      if (this != &rhs)
+      {
+        reset();
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment. The other is left empty.
+    //*************************************************************************
+    inplace_function& operator =(inplace_function&& rhs) ETL_NOEXCEPT
+    {
+      if (this != &rhs)
+      {
+        reset();
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign a callable object.
+    //*************************************************************************
+    template <typename TCallable,
+              typename TDecayed = typename etl::decay<TCallable>::type,
+              typename = typename etl::enable_if<!private_inplace_function::is_inplace_function<TDecayed>::value &&
+                                                 !etl::is_same<TDecayed, etl::nullptr_t>::value>::type>
+    inplace_function& operator =(TCallable&& callable)
+    {
+      reset();
+      construct<TDecayed>(etl::forward<TCallable>(callable));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign nullptr. Makes it empty.
+    //*************************************************************************
+    inplace_function& operator =(etl::nullptr_t) ETL_NOEXCEPT
+    {
+      reset();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Calls the callable.
+    /// Asserts inplace_function_uninitialised if empty.
+    //*************************************************************************
+    TReturn operator()(TParams... args) const
+    {
+      ETL_ASSERT(is_valid(), ETL_ERROR(etl::inplace_function_uninitialised));
+
+      return p_ops->invoke(storage_pointer(), etl::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    /// Checks if it holds a callable.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool is_valid() const ETL_NOEXCEPT
+    {
+      return p_ops != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks if it holds a callable.
+    //*************************************************************************
+    explicit operator bool() const ETL_NOEXCEPT
+    {
+      return is_valid();
+    }
+
+    //*************************************************************************
+    /// Checks if the callable can be copied.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool is_copyable() const ETL_NOEXCEPT
+    {
+      return !is_valid() || (p_ops->copy != ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Destroys the callable, making it empty.
+    //*************************************************************************
+    void reset() ETL_NOEXCEPT
+    {
+      if (p_ops != ETL_NULLPTR)
+      {
+        p_ops->destroy(storage_pointer());
+        p_ops = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    /// Swaps with another.
+    //*************************************************************************
+    void swap(inplace_function& other) ETL_NOEXCEPT
+    {
+      inplace_function temp(etl::move(other));
+      other = etl::move(*this);
+      *this = etl::move(temp);
+    }
+
+    //*************************************************************************
+    friend bool operator ==(const inplace_function& lhs, etl::nullptr_t) ETL_NOEXCEPT
+    {
+      return !lhs.is_valid();
+    }
+
+    //*************************************************************************
+    friend bool operator !=(const inplace_function& lhs, etl::nullptr_t) ETL_NOEXCEPT
+    {
+      return lhs.is_valid();
+    }
+
+  private:
+
+    typedef private_inplace_function::operations<TReturn, TParams...> operations_t;
+
+    //*************************************************************************
+    template <typename TDecayed, typename TCallable>
+    void construct(TCallable&& callable)
+    {
+      ETL_STATIC_ASSERT(sizeof(TDecayed) <= Capacity, "Callable is too large for the inplace_function");
+      ETL_STATIC_ASSERT((Alignment % etl::alignment_of<TDecayed>::value) == 0U, "Callable is over aligned for the inplace_function");
+
+      ::new (storage_pointer()) TDecayed(etl::forward<TCallable>(callable));
+      p_ops = &private_inplace_function::stub<TDecayed, TReturn, TParams...>::ops;
+    }
+
+    //*************************************************************************
+    void copy_from(const inplace_function& other)
+    {
+      if (other.p_ops != ETL_NULLPTR)
+      {
+        ETL_ASSERT_OR_RETURN(other.p_ops->copy != ETL_NULLPTR, ETL_ERROR(etl::inplace_function_not_copyable));
+
+        other.p_ops->copy(storage_pointer(), other.storage_pointer());
+        p_ops = other.p_ops;
+      }
+    }
+
+    //*************************************************************************
+    void move_from(inplace_function& other) ETL_NOEXCEPT
+    {
+      if (other.p_ops != ETL_NULLPTR)
+      {
+        other.p_ops->move(storage_pointer(), other.storage_pointer());
+        p_ops       = other.p_ops;
+        other.p_ops = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    void* storage_pointer() const ETL_NOEXCEPT
+    {
+      return const_cast<void*>(static_cast<const void*>(&storage));
+    }
+
+    typename etl::aligned_storage<Capacity, Alignment>::type storage;
+    const operations_t*                                      p_ops;
+  };
+
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  ETL_CONSTANT size_t inplace_function<TReturn(TParams...), Capacity, Alignment>::capacity;
+
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  ETL_CONSTANT size_t inplace_function<TReturn(TParams...), Capacity, Alignment>::alignment;
+
+  //*************************************************************************
+  /// Swaps two inplace_functions.
+  //*************************************************************************
+  template <typename TSignature, size_t Capacity, size_t Alignment>
+  void swap(etl::inplace_function<TSignature, Capacity, Alignment>& lhs, etl::inplace_function<TSignature, Capacity, Alignment>& rhs) ETL_NOEXCEPT
+  {
+    lhs.swap(rhs);
+  }
+}
+
+#endif
+#endif
@@ -42,6 +42,8 @@ namespace etl
 {
   //***************************************************************************
   /// Inherit from this to count instances of a type.
+  /// TCounter may be an integral type, an etl::atomic or an
+  /// etl::sharded_counter.
   ///\ingroup reference
   //***************************************************************************
   template <typename T, typename TCounter = int32_t>
@@ -107,7 +109,7 @@ namespace etl
     //*************************************************************************
     static counter_type& current_instance_count()
     {
-      static counter_type counter = { 0 };
+      static counter_type counter(0);
       return counter;
     }
   };
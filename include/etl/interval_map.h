@@ -0,0 +1,837 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTERVAL_MAP_INCLUDED
+#define ETL_INTERVAL_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup interval_map interval_map
+/// A map from half open ranges of keys, [lower, upper), to values, with the
+/// capacity defined at compile time.
+/// The ranges are stored contiguously, sorted and without overlaps.
+/// Assigning a value to a range overwrites the parts of any ranges that it
+/// overlaps, and merges it with neighbouring ranges that have an equal value.
+/// Has assignment of O(N) and lookup of O(logN).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the interval_map.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_exception : public etl::exception
+  {
+  public:
+
+    interval_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the interval_map.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_full : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::interval_map_exception(ETL_ERROR_TEXT("interval_map:full", ETL_INTERVAL_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the interval_map.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_out_of_bounds : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::interval_map_exception(ETL_ERROR_TEXT("interval_map:bounds", ETL_INTERVAL_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized interval_maps.
+  /// Can be used as a reference type for all interval_maps containing a specific type.
+  /// The mapped type must be equality comparable, so that ranges can be merged.
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class iinterval_map
+  {
+  public:
+
+    typedef TKey               key_type;
+    typedef TMapped            mapped_type;
+    typedef TKeyCompare        key_compare;
+    typedef size_t             size_type;
+    typedef ptrdiff_t          difference_type;
+    typedef const key_type&    const_key_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    //*************************************************************************
+    /// A range of keys, [lower, upper), and its value.
+    //*************************************************************************
+    struct value_type
+    {
+      value_type(const_key_reference lower_, const_key_reference upper_, const_mapped_reference mapped_)
+        : lower(lower_)
+        , upper(upper_)
+        , mapped(mapped_)
+      {
+      }
+
+      key_type    lower;  ///< The first key in the range.
+      key_type    upper;  ///< One past the last key in the range.
+      mapped_type mapped; ///< The value for the range.
+    };
+
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+    typedef const_iterator    iterator;
+
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator                       reverse_iterator;
+
+    //*********************************************************************
+    /// Returns a const_iterator to the lowest range.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the interval_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the lowest range.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the interval_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the highest range.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the reverse end of the interval_map.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the highest range.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return rbegin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_reverse_iterator to the reverse end of the interval_map.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return rend();
+    }
+
+    //*********************************************************************
+    /// Assigns a value to the keys [lower, upper).
+    /// Overwrites the parts of the existing ranges that overlap, and merges
+    /// with the neighbouring ranges that have an equal value.
+    /// Does nothing if the range is empty.
+    /// If asserts or exceptions are enabled, emits interval_map_full if the
+    /// interval_map does not have enough free space. The interval_map is
+    /// not changed.
+    ///\return <b>true</b> if the value was assigned.
+    //*********************************************************************
+    bool assign(const_key_reference lower, const_key_reference upper, const_mapped_reference value)
+    {
+      if (!compare(lower, upper))
+      {
+        return true;
+      }
+
+      // The ranges that overlap [lower, upper) are [first, last).
+      size_t first = first_ending_after(lower);
+      size_t last  = first_starting_at_or_after(upper, first);
+
+      key_type new_lower = lower;
+      key_type new_upper = upper;
+
+      bool keep_left  = false;
+      bool keep_right = false;
+
+      // The start of the first overlapped range.
+      if ((first != last) && compare(p_buffer[first].lower, lower))
+      {
+        if (p_buffer[first].mapped == value)
+        {
+          new_lower = p_buffer[first].lower;
+        }
+        else
+        {
+          keep_left = true;
+        }
+      }
+      else if ((first != 0U) && keys_are_equal(p_buffer[first - 1U].upper, lower) && (p_buffer[first - 1U].mapped == value))
+      {
+        // Merge with the range that ends at lower.
+        --first;
+        new_lower = p_buffer[first].lower;
+      }
+
+      // The end of the last overlapped range.
+      if ((first != last) && compare(upper, p_buffer[last - 1U].upper))
+      {
+        if (p_buffer[last - 1U].mapped == value)
+        {
+          new_upper = p_buffer[last - 1U].upper;
+        }
+        else
+        {
+          keep_right = true;
+        }
+      }
+      else if ((last != current_size) && keys_are_equal(p_buffer[last].lower, upper) && (p_buffer[last].mapped == value))
+      {
+        // Merge with the range that starts at upper.
+        new_upper = p_buffer[last].upper;
+        ++last;
+      }
+
+      if (keep_left && keep_right && (last - first) == 1U)
+      {
+        // Splits one range in to three.
+        ETL_ASSERT_OR_RETURN_VALUE((current_size + 2U) <= CAPACITY, ETL_ERROR(interval_map_full), false);
+
+        const size_t old_size = current_size;
+        open_gap(first + 1U, 2U);
+        set(first + 2U, old_size, upper, p_buffer[first].upper, p_buffer[first].mapped);
+        set(first + 1U, old_size, new_lower, new_upper, value);
+        p_buffer[first].upper = lower;
+
+        return true;
+      }
+
+      // Trim the overlapped ranges that are kept.
+      if (keep_left)
+      {
+        p_buffer[first].upper = lower;
+        ++first;
+      }
+
+      if (keep_right)
+      {
+        p_buffer[last - 1U].lower = upper;
+        --last;
+      }
+
+      // Replace [first, last) with the new range.
+      if (first == last)
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(interval_map_full), false);
+
+        const size_t old_size = current_size;
+        open_gap(first, 1U);
+        set(first, old_size, new_lower, new_upper, value);
+      }
+      else
+      {
+        set(first, current_size, new_lower, new_upper, value);
+        close_gap(first + 1U, last - first - 1U);
+      }
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Removes the keys [lower, upper) from the interval_map.
+    /// Does nothing if the range is empty.
+    /// If asserts or exceptions are enabled, emits interval_map_full if a
+    /// range must be split and the interval_map is full. The interval_map
+    /// is not changed.
+    ///\return <b>true</b> if the keys were removed.
+    //*********************************************************************
+    bool erase(const_key_reference lower, const_key_reference upper)
+    {
+      if (!compare(lower, upper))
+      {
+        return true;
+      }
+
+      size_t first = first_ending_after(lower);
+      size_t last  = first_starting_at_or_after(upper, first);
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      const bool keep_left  = compare(p_buffer[first].lower, lower);
+      const bool keep_right = compare(upper, p_buffer[last - 1U].upper);
+
+      if (keep_left && keep_right && (last - first) == 1U)
+      {
+        // Splits one range in to two.
+        ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(interval_map_full), false);
+
+        const size_t old_size = current_size;
+        open_gap(first + 1U, 1U);
+        set(first + 1U, old_size, upper, p_buffer[first].upper, p_buffer[first].mapped);
+        p_buffer[first].upper = lower;
+
+        return true;
+      }
+
+      if (keep_left)
+      {
+        p_buffer[first].upper = lower;
+        ++first;
+      }
+
+      if (keep_right)
+      {
+        p_buffer[last - 1U].lower = upper;
+        --last;
+      }
+
+      close_gap(first, last - first);
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Erases a range.
+    ///\return An iterator to the range after the erased one.
+    //*********************************************************************
+    const_iterator erase(const_iterator position)
+    {
+      const size_t index = size_t(position - p_buffer);
+
+      close_gap(index, 1U);
+
+      return p_buffer + index;
+    }
+
+    //*********************************************************************
+    /// Finds the range that contains a key.
+    ///\return An iterator to the range, or end() if the key is not in a range.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      // The last range that starts at or before the key.
+      size_t first = 0U;
+      size_t count = current_size;
+
+      while (count > 0U)
+      {
+        const size_t step = count / 2U;
+
+        if (compare(key, p_buffer[first + step].lower))
+        {
+          count = step;
+        }
+        else
+        {
+          first += step + 1U;
+          count -= step + 1U;
+        }
+      }
+
+      if ((first != 0U) && compare(key, p_buffer[first - 1U].upper))
+      {
+        return p_buffer + first - 1U;
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Checks if a key is in a range.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find(key) != end();
+    }
+
+    //*********************************************************************
+    /// Gets the value for a key.
+    /// If asserts or exceptions are enabled, emits interval_map_out_of_bounds
+    /// if the key is not in a range.
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(interval_map_out_of_bounds));
+
+      return itr->mapped;
+    }
+
+    //*********************************************************************
+    /// Gets the ranges that overlap the keys [lower, upper).
+    ///\return A pair of iterators to the first range and one past the last.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> overlapping(const_key_reference lower, const_key_reference upper) const
+    {
+      if (!compare(lower, upper))
+      {
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(end(), end());
+      }
+
+      const size_t first = first_ending_after(lower);
+      const size_t last  = first_starting_at_or_after(upper, first);
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(p_buffer + first, p_buffer + last);
+    }
+
+    //*************************************************************************
+    /// Clears the interval_map.
+    //*************************************************************************
+    void clear()
+    {
+      close_gap(0U, current_size);
+    }
+
+    //*************************************************************************
+    /// Gets the number of ranges.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the interval_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the interval_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of ranges.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of ranges.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the number of ranges that can still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iinterval_map& operator =(const iinterval_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    ///\param p_buffer_  The range storage.
+    ///\param capacity_  The maximum number of ranges.
+    //*********************************************************************
+    iinterval_map(value_type* p_buffer_, size_t capacity_)
+      : p_buffer(p_buffer_)
+      , current_size(0U)
+      , CAPACITY(capacity_)
+    {
+    }
+
+    //*********************************************************************
+    /// Copies the ranges of another interval_map.
+    //*********************************************************************
+    void copy_from(const iinterval_map& other)
+    {
+      clear();
+
+      ETL_ASSERT_OR_RETURN(other.size() <= CAPACITY, ETL_ERROR(interval_map_full));
+
+      for (size_t i = 0U; i < other.size(); ++i)
+      {
+        ::new (p_buffer + i) value_type(other.p_buffer[i]);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+
+  private:
+
+    // Disable copy construction.
+    iinterval_map(const iinterval_map&);
+
+    //*********************************************************************
+    /// Compares keys for equivalence.
+    //*********************************************************************
+    bool keys_are_equal(const_key_reference lhs, const_key_reference rhs) const
+    {
+      return !compare(lhs, rhs) && !compare(rhs, lhs);
+    }
+
+    //*********************************************************************
+    /// The index of the first range that ends after the key.
+    //*********************************************************************
+    size_t first_ending_after(const_key_reference key) const
+    {
+      size_t first = 0U;
+      size_t count = current_size;
+
+      while (count > 0U)
+      {
+        const size_t step = count / 2U;
+
+        if (compare(key, p_buffer[first + step].upper))
+        {
+          count = step;
+        }
+        else
+        {
+          first += step + 1U;
+          count -= step + 1U;
+        }
+      }
+
+      return first;
+    }
+
+    //*********************************************************************
+    /// The index of the first range, from 'first', that starts at or after
+    /// the key.
+    //*********************************************************************
+    size_t first_starting_at_or_after(const_key_reference key, size_t first) const
+    {
+      size_t count = current_size - first;
+
+      while (count > 0U)
+      {
+        const size_t step = count / 2U;
+
+        if (compare(p_buffer[first + step].lower, key))
+        {
+          first += step + 1U;
+          count -= step + 1U;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    //*********************************************************************
+    /// Moves the ranges from 'index' up by 'count'.
+    /// The slots in the gap that were at or above the old size are not
+    /// constructed.
+    //*********************************************************************
+    void open_gap(size_t index, size_t count)
+    {
+      const size_t old_size = current_size;
+
+      for (size_t i = old_size; i > index; --i)
+      {
+        const size_t source      = i - 1U;
+        const size_t destination = source + count;
+
+        if (destination >= old_size)
+        {
+          ::new (p_buffer + destination) value_type(ETL_MOVE(p_buffer[source]));
+          ETL_INCREMENT_DEBUG_COUNT;
+        }
+        else
+        {
+          p_buffer[destination] = ETL_MOVE(p_buffer[source]);
+        }
+      }
+
+      // The gap slots at or above the old size are counted as they are set.
+      const size_t end_of_gap = index + count;
+
+      current_size = (end_of_gap > old_size) ? (old_size + count) - (end_of_gap - old_size) : old_size + count;
+    }
+
+    //*********************************************************************
+    /// Sets the range at 'index' after a call to open_gap().
+    //*********************************************************************
+    void set(size_t index, size_t old_size, const_key_reference lower, const_key_reference upper, const_mapped_reference value)
+    {
+      if (index < old_size)
+      {
+        p_buffer[index].lower  = lower;
+        p_buffer[index].upper  = upper;
+        p_buffer[index].mapped = value;
+      }
+      else
+      {
+        ::new (p_buffer + index) value_type(lower, upper, value);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+
+    //*********************************************************************
+    /// Removes 'count' ranges from 'index'.
+    //*********************************************************************
+    void close_gap(size_t index, size_t count)
+    {
+      if (count == 0U)
+      {
+        return;
+      }
+
+      for (size_t i = index + count; i < current_size; ++i)
+      {
+        p_buffer[i - count] = ETL_MOVE(p_buffer[i]);
+      }
+
+      for (size_t i = current_size - count; i < current_size; ++i)
+      {
+        p_buffer[i].~value_type();
+        ETL_DECREMENT_DEBUG_COUNT;
+      }
+
+      current_size -= count;
+    }
+
+    value_type*     p_buffer;
+    size_type       current_size;
+    const size_type CAPACITY;
+    key_compare     compare;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INTERVAL_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinterval_map()
+    {
+    }
+#else
+  protected:
+    ~iinterval_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first interval_map.
+  ///\param rhs Reference to the second interval_map.
+  ///\return <b>true</b> if the maps have the same ranges and values, otherwise <b>false</b>
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::iinterval_map<TKey, TMapped, TKeyCompare>& lhs, const etl::iinterval_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    TKeyCompare compare;
+
+    typename etl::iinterval_map<TKey, TMapped, TKeyCompare>::const_iterator l = lhs.begin();
+    typename etl::iinterval_map<TKey, TMapped, TKeyCompare>::const_iterator r = rhs.begin();
+
+    for (; l != lhs.end(); ++l, ++r)
+    {
+      if (compare(l->lower, r->lower) || compare(r->lower, l->lower) ||
+          compare(l->upper, r->upper) || compare(r->upper, l->upper) ||
+          !(l->mapped == r->mapped))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first interval_map.
+  ///\param rhs Reference to the second interval_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::iinterval_map<TKey, TMapped, TKeyCompare>& lhs, const etl::iinterval_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// An interval_map implementation that uses a fixed size buffer.
+  ///\tparam TKey      The key type.
+  ///\tparam TMapped   The mapped type.
+  ///\tparam MAX_SIZE_ The maximum number of ranges that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class interval_map : public etl::iinterval_map<TKey, TMapped, TCompare>
+  {
+  private:
+
+    typedef etl::iinterval_map<TKey, TMapped, TCompare> base;
+
+  public:
+
+    typedef typename base::value_type value_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    interval_map()
+      : base(reinterpret_cast<value_type*>(&buffer), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    interval_map(const interval_map& other)
+      : base(reinterpret_cast<value_type*>(&buffer), MAX_SIZE)
+    {
+      this->copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~interval_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    interval_map& operator = (const interval_map& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    /// The ranges, in key order.
+    typename etl::aligned_storage<sizeof(value_type) * MAX_SIZE_, etl::alignment_of<value_type>::value>::type buffer;
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t interval_map<TKey, TMapped, MAX_SIZE_, TCompare>::MAX_SIZE;
+}
+
+#endif
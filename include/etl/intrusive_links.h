@@ -1320,6 +1320,83 @@ namespace etl
   {
     return node->is_linked();
   }
+
+  //***************************************************************************
+  /// A red-black tree link.
+  /// Used by etl::intrusive_set and etl::intrusive_multiset.
+  //***************************************************************************
+  template <size_t ID_>
+  struct rb_tree_link
+  {
+      enum
+      {
+        ID = ID_,
+      };
+
+      //***********************************
+      rb_tree_link()
+        : etl_parent(ETL_NULLPTR)
+        , etl_left(ETL_NULLPTR)
+        , etl_right(ETL_NULLPTR)
+        , etl_red(false)
+      {
+      }
+
+      //***********************************
+      rb_tree_link(const rb_tree_link& other)
+        : etl_parent(other.etl_parent)
+        , etl_left(other.etl_left)
+        , etl_right(other.etl_right)
+        , etl_red(other.etl_red)
+      {
+      }
+
+      //***********************************
+      rb_tree_link& operator =(const rb_tree_link& other)
+      {
+        etl_parent = other.etl_parent;
+        etl_left   = other.etl_left;
+        etl_right  = other.etl_right;
+        etl_red    = other.etl_red;
+
+        return *this;
+      }
+
+      //***********************************
+      void clear()
+      {
+        etl_parent = ETL_NULLPTR;
+        etl_left   = ETL_NULLPTR;
+        etl_right  = ETL_NULLPTR;
+        etl_red    = false;
+      }
+
+      //***********************************
+      /// Every linked node has a parent, as the root's parent is the tree's header.
+      //***********************************
+      bool is_linked() const
+      {
+        return etl_parent != ETL_NULLPTR;
+      }
+
+      rb_tree_link* etl_parent;
+      rb_tree_link* etl_left;
+      rb_tree_link* etl_right;
+      bool          etl_red;
+  };
+
+  //***********************************
+  template <typename TLink>
+  struct is_rb_tree_link
+  {
+    static ETL_CONSTANT bool value = etl::is_same<TLink, etl::rb_tree_link<TLink::ID> >::value;
+  };
+
+  //***********************************
+#if ETL_USING_CPP17
+  template <typename TLink>
+  inline constexpr bool is_rb_tree_link_v = etl::is_rb_tree_link<TLink>::value;
+#endif
 }
 
 #endif
@@ -0,0 +1,255 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_MPSC_QUEUE_INCLUDED
+#define ETL_INTRUSIVE_MPSC_QUEUE_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "nullptr.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A forward link with an atomic next pointer.
+  /// Used by etl::intrusive_mpsc_queue.
+  //***************************************************************************
+  template <size_t ID_>
+  struct atomic_forward_link
+  {
+    enum
+    {
+      ID = ID_,
+    };
+
+    //***********************************
+    atomic_forward_link()
+      : etl_next(ETL_NULLPTR)
+    {
+    }
+
+    //***********************************
+    /// Copying a link does not copy the linkage.
+    //***********************************
+    atomic_forward_link(const atomic_forward_link&)
+      : etl_next(ETL_NULLPTR)
+    {
+    }
+
+    //***********************************
+    /// Assigning a link does not change the linkage.
+    //***********************************
+    atomic_forward_link& operator =(const atomic_forward_link&)
+    {
+      return *this;
+    }
+
+    //***********************************
+    void clear()
+    {
+      etl_next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+    }
+
+    //***********************************
+    ETL_NODISCARD
+    atomic_forward_link* get_next() const
+    {
+      return etl_next.load(etl::memory_order_acquire);
+    }
+
+    etl::atomic<atomic_forward_link*> etl_next;
+  };
+
+  //***********************************
+  template <typename TLink>
+  struct is_atomic_forward_link
+  {
+    static ETL_CONSTANT bool value = etl::is_same<TLink, etl::atomic_forward_link<TLink::ID> >::value;
+  };
+
+  //***********************************
+#if ETL_USING_CPP17
+  template <typename TLink>
+  inline constexpr bool is_atomic_forward_link_v = etl::is_atomic_forward_link<TLink>::value;
+#endif
+
+  //***************************************************************************
+  ///\ingroup queue
+  /// An unbounded, intrusive, lock-free queue for multiple producers and a
+  /// single consumer. Stores elements derived from etl::atomic_forward_link.
+  /// push() may be called from any thread and costs one atomic exchange.
+  /// pop() must only be called from the consumer thread.
+  /// Values are not copied, and must outlive their time in the queue.
+  /// A value must not be pushed again until it has been popped.
+  /// \tparam TValue The type of value that the queue holds.
+  /// \tparam TLink  The link type that the value is derived from.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_mpsc_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_atomic_forward_link<TLink>::value, "TLink must be an etl::atomic_forward_link");
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_mpsc_queue()
+      : p_head(&stub)
+      , p_tail(&stub)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// May be called from any thread.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(link_type& value)
+    {
+      value.etl_next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+
+      link_type* p_previous = p_head.exchange(&value, etl::memory_order_acq_rel);
+
+      // Until this store, the consumer sees the queue end at p_previous.
+      p_previous->etl_next.store(&value, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Removes the oldest value from the queue.
+    /// Must only be called from the consumer thread.
+    /// \return A pointer to the value, or ETL_NULLPTR if the queue is empty,
+    /// or if the oldest value is still being pushed.
+    //*************************************************************************
+    pointer pop()
+    {
+      link_type* p_front = p_tail;
+      link_type* p_next  = next_of(p_front);
+
+      if (p_front == &stub)
+      {
+        if (p_next == ETL_NULLPTR)
+        {
+          // Empty.
+          return ETL_NULLPTR;
+        }
+
+        // Step over the stub.
+        p_tail  = p_next;
+        p_front = p_next;
+        p_next  = next_of(p_next);
+      }
+
+      if (p_next != ETL_NULLPTR)
+      {
+        p_tail = p_next;
+
+        return to_value(p_front);
+      }
+
+      if (p_front != p_head.load(etl::memory_order_acquire))
+      {
+        // A producer has claimed the back but not yet linked it.
+        return ETL_NULLPTR;
+      }
+
+      // p_front is the last value. Put the stub behind it so that it can be unlinked.
+      push(stub);
+
+      p_next = next_of(p_front);
+
+      if (p_next != ETL_NULLPTR)
+      {
+        p_tail = p_next;
+
+        return to_value(p_front);
+      }
+
+      // Another producer got in before the stub.
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks if the queue is in the empty state.
+    /// Accurate from the consumer thread when no pushes are in progress.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (p_tail == &stub) && (stub.etl_next.load(etl::memory_order_acquire) == ETL_NULLPTR);
+    }
+
+  private:
+
+    //*************************************************************************
+    //*************************************************************************
+    static link_type* next_of(link_type* p_link)
+    {
+      return p_link->etl_next.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    //*************************************************************************
+    static pointer to_value(link_type* p_link)
+    {
+      p_link->clear();
+
+      return static_cast<pointer>(p_link);
+    }
+
+    // Disable copy construction and assignment.
+    intrusive_mpsc_queue(const intrusive_mpsc_queue&) ETL_DELETE;
+    intrusive_mpsc_queue& operator = (const intrusive_mpsc_queue& rhs) ETL_DELETE;
+
+    etl::atomic<link_type*> p_head; ///< The most recently pushed link. Shared by the producers.
+    link_type*              p_tail; ///< The oldest link. Owned by the consumer.
+    link_type               stub;   ///< Keeps the list non-empty while values come and go.
+  };
+}
+
+#endif
+#endif
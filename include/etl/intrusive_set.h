@@ -0,0 +1,1472 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_SET_INCLUDED
+#define ETL_INTRUSIVE_SET_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "intrusive_links.h"
+#include "static_assert.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup intrusive_set intrusive_set
+/// Ordered intrusive containers, implemented as red-black trees.
+/// The values are linked through an etl::rb_tree_link<ID> base, so inserting
+/// and erasing take O(log n) time and never allocate.
+/// etl::intrusive_set holds unique values and etl::intrusive_multiset allows
+/// equivalent values, which keep their order of insertion.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the intrusive_set.
+  ///\ingroup intrusive_set
+  //***************************************************************************
+  class intrusive_set_exception : public exception
+  {
+  public:
+
+    intrusive_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the intrusive_set.
+  ///\ingroup intrusive_set
+  //***************************************************************************
+  class intrusive_set_empty : public intrusive_set_exception
+  {
+  public:
+
+    intrusive_set_empty(string_type file_name_, numeric_type line_number_)
+      : intrusive_set_exception(ETL_ERROR_TEXT("intrusive_set:empty", ETL_INTRUSIVE_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Already linked exception for the intrusive_set.
+  ///\ingroup intrusive_set
+  //***************************************************************************
+  class intrusive_set_value_is_already_linked : public intrusive_set_exception
+  {
+  public:
+
+    intrusive_set_value_is_already_linked(string_type file_name_, numeric_type line_number_)
+      : intrusive_set_exception(ETL_ERROR_TEXT("intrusive_set:value is already linked", ETL_INTRUSIVE_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Base for the intrusive_set and intrusive_multiset.
+  /// Holds the tree and the red-black balancing, which only use the links.
+  ///\ingroup intrusive_set
+  ///\note TLink must be a base of TValue.
+  //***************************************************************************
+  template <typename TValue, typename TLink, typename TCompare>
+  class intrusive_set_base
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_rb_tree_link<TLink>::value, "TLink must be an etl::rb_tree_link");
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    typedef TValue node_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef TValue            key_type;
+    typedef TCompare          key_compare;
+    typedef TCompare          value_compare;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class intrusive_set_base;
+      friend class const_iterator;
+
+      iterator()
+        : p_value(ETL_NULLPTR)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_value(other.p_value)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        p_value = intrusive_set_base::next_link(p_value);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        p_value = intrusive_set_base::next_link(p_value);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        p_value = intrusive_set_base::previous_link(p_value);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        p_value = intrusive_set_base::previous_link(p_value);
+        return temp;
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_value = other.p_value;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+#include "private/diagnostic_null_dereference_push.h"
+        return *static_cast<pointer>(p_value);
+#include "private/diagnostic_pop.h"
+      }
+
+      pointer operator &() const
+      {
+        return static_cast<pointer>(p_value);
+      }
+
+      pointer operator ->() const
+      {
+        return static_cast<pointer>(p_value);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_value == rhs.p_value;
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(link_type* value)
+        : p_value(value)
+      {
+      }
+
+      link_type* p_value;
+    };
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class intrusive_set_base;
+
+      const_iterator()
+        : p_value(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const typename intrusive_set_base::iterator& other)
+        : p_value(other.p_value)
+      {
+      }
+
+      const_iterator(const const_iterator& other)
+        : p_value(other.p_value)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        p_value = intrusive_set_base::next_link(p_value);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        p_value = intrusive_set_base::next_link(p_value);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        p_value = intrusive_set_base::previous_link(p_value);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        p_value = intrusive_set_base::previous_link(p_value);
+        return temp;
+      }
+
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_value = other.p_value;
+        return *this;
+      }
+
+      const_reference operator *() const
+      {
+        return *static_cast<const_pointer>(p_value);
+      }
+
+      const_pointer operator &() const
+      {
+        return static_cast<const_pointer>(p_value);
+      }
+
+      const_pointer operator ->() const
+      {
+        return static_cast<const_pointer>(p_value);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_value == rhs.p_value;
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const link_type* value)
+        : p_value(const_cast<link_type*>(value))
+      {
+      }
+
+      link_type* p_value;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(header.etl_left);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(header.etl_left);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(header.etl_left);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(&header);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(&header);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(&header);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the set.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the set.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the set.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the set.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the set.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the set.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the first, lowest, value.
+    //*************************************************************************
+    reference front()
+    {
+      return *static_cast<pointer>(header.etl_left);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the first, lowest, value.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return *static_cast<const_pointer>(header.etl_left);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the last, highest, value.
+    //*************************************************************************
+    reference back()
+    {
+      return *static_cast<pointer>(header.etl_right);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the last, highest, value.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return *static_cast<const_pointer>(header.etl_right);
+    }
+
+    //*************************************************************************
+    /// Removes the first, lowest, value.
+    //*************************************************************************
+    void pop_front()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(intrusive_set_empty));
+#endif
+      remove_link(header.etl_left);
+    }
+
+    //*************************************************************************
+    /// Removes the last, highest, value.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(intrusive_set_empty));
+#endif
+      remove_link(header.etl_right);
+    }
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      iterator next(position.p_value);
+      ++next;
+
+      remove_link(position.p_value);
+
+      return next;
+    }
+
+    //*************************************************************************
+    /// Erases a range of values.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      while (first != last)
+      {
+        first = erase(first);
+      }
+
+      return iterator(last.p_value);
+    }
+
+    //*************************************************************************
+    /// Erases the specified node.
+    /// Returns the next node, or ETL_NULLPTR if the node was not in this set
+    /// or was the last in the set.
+    //*************************************************************************
+    node_type* erase(node_type& node)
+    {
+      link_type* p_link = &node;
+
+      if (!is_link_in_tree(p_link))
+      {
+        return ETL_NULLPTR;
+      }
+
+      link_type* p_next = next_link(p_link);
+
+      remove_link(p_link);
+
+      return (p_next == &header) ? ETL_NULLPTR : static_cast<node_type*>(p_next);
+    }
+
+    //*************************************************************************
+    /// Clears the set, unlinking all of the values.
+    //*************************************************************************
+    void clear()
+    {
+      // Unlink the leaves, working up from the bottom of the tree.
+      link_type* p_link = header.etl_parent;
+
+      while (p_link != ETL_NULLPTR)
+      {
+        if (p_link->etl_left != ETL_NULLPTR)
+        {
+          p_link = p_link->etl_left;
+        }
+        else if (p_link->etl_right != ETL_NULLPTR)
+        {
+          p_link = p_link->etl_right;
+        }
+        else
+        {
+          link_type* p_parent = p_link->etl_parent;
+
+          p_link->clear();
+
+          if (p_parent == &header)
+          {
+            p_link = ETL_NULLPTR;
+          }
+          else
+          {
+            if (p_parent->etl_left == p_link)
+            {
+              p_parent->etl_left = ETL_NULLPTR;
+            }
+            else
+            {
+              p_parent->etl_right = ETL_NULLPTR;
+            }
+
+            p_link = p_parent;
+          }
+        }
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Finds the first value equivalent to the key.
+    /// The key may be a value_type, or any type that key_compare can compare with one.
+    //*************************************************************************
+    template <typename TKey>
+    iterator find(const TKey& key)
+    {
+      link_type* p_link = lower_bound_link(key);
+
+      return ((p_link == &header) || compare(key, *static_cast<const_pointer>(p_link))) ? end() : iterator(p_link);
+    }
+
+    //*************************************************************************
+    /// Finds the first value equivalent to the key.
+    //*************************************************************************
+    template <typename TKey>
+    const_iterator find(const TKey& key) const
+    {
+      const link_type* p_link = lower_bound_link(key);
+
+      return ((p_link == &header) || compare(key, *static_cast<const_pointer>(p_link))) ? end() : const_iterator(p_link);
+    }
+
+    //*************************************************************************
+    /// Finds the first value that is not less than the key.
+    //*************************************************************************
+    template <typename TKey>
+    iterator lower_bound(const TKey& key)
+    {
+      return iterator(lower_bound_link(key));
+    }
+
+    //*************************************************************************
+    /// Finds the first value that is not less than the key.
+    //*************************************************************************
+    template <typename TKey>
+    const_iterator lower_bound(const TKey& key) const
+    {
+      return const_iterator(lower_bound_link(key));
+    }
+
+    //*************************************************************************
+    /// Finds the first value that is greater than the key.
+    //*************************************************************************
+    template <typename TKey>
+    iterator upper_bound(const TKey& key)
+    {
+      return iterator(upper_bound_link(key));
+    }
+
+    //*************************************************************************
+    /// Finds the first value that is greater than the key.
+    //*************************************************************************
+    template <typename TKey>
+    const_iterator upper_bound(const TKey& key) const
+    {
+      return const_iterator(upper_bound_link(key));
+    }
+
+    //*************************************************************************
+    /// Finds the range of values equivalent to the key.
+    //*************************************************************************
+    template <typename TKey>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const TKey& key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Finds the range of values equivalent to the key.
+    //*************************************************************************
+    template <typename TKey>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const TKey& key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Counts the values equivalent to the key.
+    //*************************************************************************
+    template <typename TKey>
+    size_t count(const TKey& key) const
+    {
+      return static_cast<size_t>(etl::distance(lower_bound(key), upper_bound(key)));
+    }
+
+    //*************************************************************************
+    /// Checks if the set contains a value equivalent to the key.
+    //*************************************************************************
+    template <typename TKey>
+    bool contains(const TKey& key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Returns true if the set has no values.
+    //*************************************************************************
+    bool empty() const
+    {
+      return header.etl_parent == ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return comparison;
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return comparison;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_set_base()
+      : current_size(0U)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit intrusive_set_base(const TCompare& compare_)
+      : current_size(0U)
+      , comparison(compare_)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_set_base()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Finds the parent of a new value, and whether it goes to the left.
+    /// Equivalent values go after those already in the set.
+    /// Returns ETL_NULLPTR if the set is empty.
+    //*************************************************************************
+    link_type* find_insert_parent(const_reference value, bool& left) const
+    {
+      link_type* p_parent = ETL_NULLPTR;
+      link_type* p_link   = header.etl_parent;
+
+      left = true;
+
+      while (p_link != ETL_NULLPTR)
+      {
+        p_parent = p_link;
+        left     = compare(value, *static_cast<const_pointer>(p_link));
+        p_link   = left ? p_link->etl_left : p_link->etl_right;
+      }
+
+      return p_parent;
+    }
+
+    //*************************************************************************
+    /// Links a new value as a child of p_parent, then rebalances.
+    //*************************************************************************
+    void insert_link(link_type* p_parent, bool left, link_type* p_link)
+    {
+      p_link->etl_left   = ETL_NULLPTR;
+      p_link->etl_right  = ETL_NULLPTR;
+      p_link->etl_red    = true;
+
+      if (p_parent == ETL_NULLPTR)
+      {
+        p_link->etl_parent = &header;
+        header.etl_parent  = p_link;
+        header.etl_left    = p_link;
+        header.etl_right   = p_link;
+      }
+      else
+      {
+        p_link->etl_parent = p_parent;
+
+        if (left)
+        {
+          p_parent->etl_left = p_link;
+
+          if (p_parent == header.etl_left)
+          {
+            header.etl_left = p_link;
+          }
+        }
+        else
+        {
+          p_parent->etl_right = p_link;
+
+          if (p_parent == header.etl_right)
+          {
+            header.etl_right = p_link;
+          }
+        }
+      }
+
+      rebalance_after_insert(p_link);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// The comparison. Takes two references, of the key or value type.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool compare(const T1& lhs, const T2& rhs) const
+    {
+      return comparison(lhs, rhs);
+    }
+
+    /// The link that acts as the end of the set.
+    /// Its parent is the root, and its left and right are the first and last values.
+    link_type header;
+
+    size_t current_size; ///< Counts the number of values in the set.
+
+    //*************************************************************************
+    /// An iterator to a linked value.
+    //*************************************************************************
+    iterator to_iterator(link_type* p_link)
+    {
+      return iterator(p_link);
+    }
+
+  private:
+
+    TCompare comparison; ///< The value comparison.
+
+    //*************************************************************************
+    /// Sets the set to empty.
+    /// The header is red, so that it can be told apart from the root.
+    //*************************************************************************
+    void initialise()
+    {
+      header.etl_parent = ETL_NULLPTR;
+      header.etl_left   = &header;
+      header.etl_right  = &header;
+      header.etl_red    = true;
+      current_size      = 0U;
+    }
+
+    //*************************************************************************
+    /// Checks that the link is in this tree, by walking up to the header.
+    //*************************************************************************
+    bool is_link_in_tree(const link_type* p_link) const
+    {
+      if (!p_link->is_linked())
+      {
+        return false;
+      }
+
+      while (p_link->etl_parent->etl_parent != p_link)
+      {
+        p_link = p_link->etl_parent;
+      }
+
+      // p_link is now the root of this tree, or of another.
+      return p_link->etl_parent == &header;
+    }
+
+    //*************************************************************************
+    /// The link for the first value that is not less than the key.
+    //*************************************************************************
+    template <typename TKey>
+    link_type* lower_bound_link(const TKey& key) const
+    {
+      link_type* p_result = const_cast<link_type*>(&header);
+      link_type* p_link   = header.etl_parent;
+
+      while (p_link != ETL_NULLPTR)
+      {
+        if (compare(*static_cast<const_pointer>(p_link), key))
+        {
+          p_link = p_link->etl_right;
+        }
+        else
+        {
+          p_result = p_link;
+          p_link   = p_link->etl_left;
+        }
+      }
+
+      return p_result;
+    }
+
+    //*************************************************************************
+    /// The link for the first value that is greater than the key.
+    //*************************************************************************
+    template <typename TKey>
+    link_type* upper_bound_link(const TKey& key) const
+    {
+      link_type* p_result = const_cast<link_type*>(&header);
+      link_type* p_link   = header.etl_parent;
+
+      while (p_link != ETL_NULLPTR)
+      {
+        if (compare(key, *static_cast<const_pointer>(p_link)))
+        {
+          p_result = p_link;
+          p_link   = p_link->etl_left;
+        }
+        else
+        {
+          p_link = p_link->etl_right;
+        }
+      }
+
+      return p_result;
+    }
+
+    //*************************************************************************
+    /// The next link in order. The next of the last value is the header.
+    //*************************************************************************
+    static link_type* next_link(link_type* p_link)
+    {
+      if (p_link->etl_right != ETL_NULLPTR)
+      {
+        p_link = p_link->etl_right;
+
+        while (p_link->etl_left != ETL_NULLPTR)
+        {
+          p_link = p_link->etl_left;
+        }
+      }
+      else
+      {
+        link_type* p_parent = p_link->etl_parent;
+
+        while (p_link == p_parent->etl_right)
+        {
+          p_link   = p_parent;
+          p_parent = p_parent->etl_parent;
+        }
+
+        // When the root is the last value, p_link has reached the header.
+        if (p_link->etl_right != p_parent)
+        {
+          p_link = p_parent;
+        }
+      }
+
+      return p_link;
+    }
+
+    //*************************************************************************
+    /// The previous link in order. The previous of the header is the last value.
+    //*************************************************************************
+    static link_type* previous_link(link_type* p_link)
+    {
+      if (p_link->etl_red && (p_link->etl_parent != ETL_NULLPTR) && (p_link->etl_parent->etl_parent == p_link))
+      {
+        // The header.
+        p_link = p_link->etl_right;
+      }
+      else if (p_link->etl_left != ETL_NULLPTR)
+      {
+        p_link = p_link->etl_left;
+
+        while (p_link->etl_right != ETL_NULLPTR)
+        {
+          p_link = p_link->etl_right;
+        }
+      }
+      else
+      {
+        link_type* p_parent = p_link->etl_parent;
+
+        while (p_link == p_parent->etl_left)
+        {
+          p_link   = p_parent;
+          p_parent = p_parent->etl_parent;
+        }
+
+        p_link = p_parent;
+      }
+
+      return p_link;
+    }
+
+    //*************************************************************************
+    /// Replaces the parent's link to p_old with p_new.
+    //*************************************************************************
+    void replace_child(link_type* p_old, link_type* p_new)
+    {
+      link_type* p_parent = p_old->etl_parent;
+
+      if (p_parent == &header)
+      {
+        header.etl_parent = p_new;
+      }
+      else if (p_parent->etl_left == p_old)
+      {
+        p_parent->etl_left = p_new;
+      }
+      else
+      {
+        p_parent->etl_right = p_new;
+      }
+    }
+
+    //*************************************************************************
+    /// Rotates the subtree at p_link to the left.
+    //*************************************************************************
+    void rotate_left(link_type* p_link)
+    {
+      link_type* p_right = p_link->etl_right;
+
+      p_link->etl_right = p_right->etl_left;
+
+      if (p_right->etl_left != ETL_NULLPTR)
+      {
+        p_right->etl_left->etl_parent = p_link;
+      }
+
+      replace_child(p_link, p_right);
+      p_right->etl_parent = p_link->etl_parent;
+      p_right->etl_left   = p_link;
+      p_link->etl_parent  = p_right;
+    }
+
+    //*************************************************************************
+    /// Rotates the subtree at p_link to the right.
+    //*************************************************************************
+    void rotate_right(link_type* p_link)
+    {
+      link_type* p_left = p_link->etl_left;
+
+      p_link->etl_left = p_left->etl_right;
+
+      if (p_left->etl_right != ETL_NULLPTR)
+      {
+        p_left->etl_right->etl_parent = p_link;
+      }
+
+      replace_child(p_link, p_left);
+      p_left->etl_parent = p_link->etl_parent;
+      p_left->etl_right  = p_link;
+      p_link->etl_parent = p_left;
+    }
+
+    //*************************************************************************
+    /// Restores the red-black properties after linking a red leaf.
+    //*************************************************************************
+    void rebalance_after_insert(link_type* p_link)
+    {
+      while ((p_link != header.etl_parent) && p_link->etl_parent->etl_red)
+      {
+        link_type* p_parent      = p_link->etl_parent;
+        link_type* p_grandparent = p_parent->etl_parent;
+
+        if (p_parent == p_grandparent->etl_left)
+        {
+          link_type* p_uncle = p_grandparent->etl_right;
+
+          if ((p_uncle != ETL_NULLPTR) && p_uncle->etl_red)
+          {
+            p_parent->etl_red      = false;
+            p_uncle->etl_red       = false;
+            p_grandparent->etl_red = true;
+            p_link = p_grandparent;
+          }
+          else
+          {
+            if (p_link == p_parent->etl_right)
+            {
+              rotate_left(p_parent);
+              p_parent = p_link;
+            }
+
+            p_parent->etl_red      = false;
+            p_grandparent->etl_red = true;
+            rotate_right(p_grandparent);
+            break;
+          }
+        }
+        else
+        {
+          link_type* p_uncle = p_grandparent->etl_left;
+
+          if ((p_uncle != ETL_NULLPTR) && p_uncle->etl_red)
+          {
+            p_parent->etl_red      = false;
+            p_uncle->etl_red       = false;
+            p_grandparent->etl_red = true;
+            p_link = p_grandparent;
+          }
+          else
+          {
+            if (p_link == p_parent->etl_left)
+            {
+              rotate_right(p_parent);
+              p_parent = p_link;
+            }
+
+            p_parent->etl_red      = false;
+            p_grandparent->etl_red = true;
+            rotate_left(p_grandparent);
+            break;
+          }
+        }
+      }
+
+      header.etl_parent->etl_red = false;
+    }
+
+    //*************************************************************************
+    /// Unlinks a value and restores the red-black properties.
+    //*************************************************************************
+    void remove_link(link_type* p_link)
+    {
+      link_type* p_child;
+      link_type* p_child_parent;
+      bool       removed_red;
+
+      if ((p_link->etl_left != ETL_NULLPTR) && (p_link->etl_right != ETL_NULLPTR))
+      {
+        // Two children: the successor takes the place, and colour, of p_link.
+        link_type* p_successor = p_link->etl_right;
+
+        while (p_successor->etl_left != ETL_NULLPTR)
+        {
+          p_successor = p_successor->etl_left;
+        }
+
+        p_child     = p_successor->etl_right;
+        removed_red = p_successor->etl_red;
+
+        if (p_successor == p_link->etl_right)
+        {
+          p_child_parent = p_successor;
+        }
+        else
+        {
+          p_child_parent = p_successor->etl_parent;
+          p_child_parent->etl_left = p_child;
+
+          if (p_child != ETL_NULLPTR)
+          {
+            p_child->etl_parent = p_child_parent;
+          }
+
+          p_successor->etl_right = p_link->etl_right;
+          p_successor->etl_right->etl_parent = p_successor;
+        }
+
+        replace_child(p_link, p_successor);
+        p_successor->etl_parent = p_link->etl_parent;
+        p_successor->etl_left   = p_link->etl_left;
+        p_successor->etl_left->etl_parent = p_successor;
+        p_successor->etl_red    = p_link->etl_red;
+      }
+      else
+      {
+        // At most one child, which takes the place of p_link.
+        p_child        = (p_link->etl_left != ETL_NULLPTR) ? p_link->etl_left : p_link->etl_right;
+        p_child_parent = p_link->etl_parent;
+        removed_red    = p_link->etl_red;
+
+        replace_child(p_link, p_child);
+
+        if (p_child != ETL_NULLPTR)
+        {
+          p_child->etl_parent = p_child_parent;
+        }
+
+        if (header.etl_left == p_link)
+        {
+          header.etl_left = (p_child != ETL_NULLPTR) ? leftmost(p_child) : p_child_parent;
+        }
+
+        if (header.etl_right == p_link)
+        {
+          header.etl_right = (p_child != ETL_NULLPTR) ? rightmost(p_child) : p_child_parent;
+        }
+      }
+
+      if (!removed_red)
+      {
+        rebalance_after_remove(p_child, p_child_parent);
+      }
+
+      p_link->clear();
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Restores the red-black properties after removing a black link,
+    /// where p_link, which may be ETL_NULLPTR, has one black too few.
+    //*************************************************************************
+    void rebalance_after_remove(link_type* p_link, link_type* p_parent)
+    {
+      while ((p_link != header.etl_parent) && ((p_link == ETL_NULLPTR) || !p_link->etl_red))
+      {
+        if (p_link == p_parent->etl_left)
+        {
+          link_type* p_sibling = p_parent->etl_right;
+
+          if (p_sibling->etl_red)
+          {
+            p_sibling->etl_red = false;
+            p_parent->etl_red  = true;
+            rotate_left(p_parent);
+            p_sibling = p_parent->etl_right;
+          }
+
+          if (!is_red(p_sibling->etl_left) && !is_red(p_sibling->etl_right))
+          {
+            p_sibling->etl_red = true;
+            p_link   = p_parent;
+            p_parent = p_parent->etl_parent;
+          }
+          else
+          {
+            if (!is_red(p_sibling->etl_right))
+            {
+              p_sibling->etl_left->etl_red = false;
+              p_sibling->etl_red = true;
+              rotate_right(p_sibling);
+              p_sibling = p_parent->etl_right;
+            }
+
+            p_sibling->etl_red = p_parent->etl_red;
+            p_parent->etl_red  = false;
+            p_sibling->etl_right->etl_red = false;
+            rotate_left(p_parent);
+            p_link = header.etl_parent;
+          }
+        }
+        else
+        {
+          link_type* p_sibling = p_parent->etl_left;
+
+          if (p_sibling->etl_red)
+          {
+            p_sibling->etl_red = false;
+            p_parent->etl_red  = true;
+            rotate_right(p_parent);
+            p_sibling = p_parent->etl_left;
+          }
+
+          if (!is_red(p_sibling->etl_left) && !is_red(p_sibling->etl_right))
+          {
+            p_sibling->etl_red = true;
+            p_link   = p_parent;
+            p_parent = p_parent->etl_parent;
+          }
+          else
+          {
+            if (!is_red(p_sibling->etl_left))
+            {
+              p_sibling->etl_right->etl_red = false;
+              p_sibling->etl_red = true;
+              rotate_left(p_sibling);
+              p_sibling = p_parent->etl_left;
+            }
+
+            p_sibling->etl_red = p_parent->etl_red;
+            p_parent->etl_red  = false;
+            p_sibling->etl_left->etl_red = false;
+            rotate_right(p_parent);
+            p_link = header.etl_parent;
+          }
+        }
+      }
+
+      if (p_link != ETL_NULLPTR)
+      {
+        p_link->etl_red = false;
+      }
+    }
+
+    //*************************************************************************
+    /// Is the link red? Missing links are black.
+    //*************************************************************************
+    static bool is_red(const link_type* p_link)
+    {
+      return (p_link != ETL_NULLPTR) && p_link->etl_red;
+    }
+
+    //*************************************************************************
+    /// The lowest link in a subtree.
+    //*************************************************************************
+    static link_type* leftmost(link_type* p_link)
+    {
+      while (p_link->etl_left != ETL_NULLPTR)
+      {
+        p_link = p_link->etl_left;
+      }
+
+      return p_link;
+    }
+
+    //*************************************************************************
+    /// The highest link in a subtree.
+    //*************************************************************************
+    static link_type* rightmost(link_type* p_link)
+    {
+      while (p_link->etl_right != ETL_NULLPTR)
+      {
+        p_link = p_link->etl_right;
+      }
+
+      return p_link;
+    }
+
+    // Disabled.
+    intrusive_set_base(const intrusive_set_base& other);
+    intrusive_set_base& operator = (const intrusive_set_base& rhs);
+  };
+
+  //***************************************************************************
+  /// An intrusive set, of unique values.
+  ///\ingroup intrusive_set
+  ///\note TLink must be a base of TValue.
+  //***************************************************************************
+  template <typename TValue, typename TLink, typename TCompare = etl::less<TValue> >
+  class intrusive_set : public etl::intrusive_set_base<TValue, TLink, TCompare>
+  {
+  private:
+
+    typedef etl::intrusive_set_base<TValue, TLink, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::link_type      link_type;
+    typedef typename base_t::value_type     value_type;
+    typedef typename base_t::iterator       iterator;
+    typedef typename base_t::const_iterator const_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_set()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a comparison.
+    //*************************************************************************
+    explicit intrusive_set(const TCompare& compare_)
+      : base_t(compare_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_set(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_set()
+    {
+    }
+
+    //*************************************************************************
+    /// Inserts a value, unless an equivalent value is already in the set.
+    /// Returns an iterator to the value in the set, and true if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type& value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!static_cast<link_type&>(value).is_linked(), ETL_ERROR(intrusive_set_value_is_already_linked), ETL_OR_STD::make_pair(this->end(), false));
+
+      iterator existing = this->lower_bound(value);
+
+      if ((existing != this->end()) && !this->compare(value, *existing))
+      {
+        return ETL_OR_STD::make_pair(existing, false);
+      }
+
+      bool left;
+      link_type* p_parent = this->find_insert_parent(value, left);
+      this->insert_link(p_parent, left, &value);
+
+      return ETL_OR_STD::make_pair(this->to_iterator(&value), true);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+  private:
+
+    // Disabled.
+    intrusive_set(const intrusive_set& other);
+    intrusive_set& operator = (const intrusive_set& rhs);
+  };
+
+  //***************************************************************************
+  /// An intrusive multiset.
+  /// Equivalent values are kept in the order that they were inserted.
+  ///\ingroup intrusive_set
+  ///\note TLink must be a base of TValue.
+  //***************************************************************************
+  template <typename TValue, typename TLink, typename TCompare = etl::less<TValue> >
+  class intrusive_multiset : public etl::intrusive_set_base<TValue, TLink, TCompare>
+  {
+  private:
+
+    typedef etl::intrusive_set_base<TValue, TLink, TCompare> base_t;
+
+  public:
+
+    typedef typename base_t::link_type      link_type;
+    typedef typename base_t::value_type     value_type;
+    typedef typename base_t::iterator       iterator;
+    typedef typename base_t::const_iterator const_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_multiset()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a comparison.
+    //*************************************************************************
+    explicit intrusive_multiset(const TCompare& compare_)
+      : base_t(compare_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range
+    //*************************************************************************
+    template <typename TIterator>
+    intrusive_multiset(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_multiset()
+    {
+    }
+
+    //*************************************************************************
+    /// Inserts a value after any equivalent values.
+    /// Returns an iterator to the value.
+    //*************************************************************************
+    iterator insert(value_type& value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!static_cast<link_type&>(value).is_linked(), ETL_ERROR(intrusive_set_value_is_already_linked), this->end());
+
+      bool left;
+      link_type* p_parent = this->find_insert_parent(value, left);
+      this->insert_link(p_parent, left, &value);
+
+      return this->to_iterator(&value);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+  private:
+
+    // Disabled.
+    intrusive_multiset(const intrusive_multiset& other);
+    intrusive_multiset& operator = (const intrusive_multiset& rhs);
+  };
+}
+
+#endif
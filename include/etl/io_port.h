@@ -40,6 +40,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "utility.h"
 #include "static_assert.h"
+#include "span.h"
 
 #include <stdint.h>
 
@@ -50,6 +51,52 @@ namespace etl
 
   namespace private_io_port
   {
+    //***************************************************************************
+    /// Reads n values from one port address, four accesses per pass.
+    //***************************************************************************
+    template <typename T>
+    void read_burst(volatile const T* address, T* p, size_t n)
+    {
+      while (n >= 4U)
+      {
+        p[0] = *address;
+        p[1] = *address;
+        p[2] = *address;
+        p[3] = *address;
+        p += 4U;
+        n -= 4U;
+      }
+
+      while (n != 0U)
+      {
+        *p++ = *address;
+        --n;
+      }
+    }
+
+    //***************************************************************************
+    /// Writes n values to one port address, four accesses per pass.
+    //***************************************************************************
+    template <typename T>
+    void write_burst(volatile T* address, const T* p, size_t n)
+    {
+      while (n >= 4U)
+      {
+        *address = p[0];
+        *address = p[1];
+        *address = p[2];
+        *address = p[3];
+        p += 4U;
+        n -= 4U;
+      }
+
+      while (n != 0U)
+      {
+        *address = *p++;
+        --n;
+      }
+    }
+
     //***************************************************************************
     /// Common io_port iterator implementation
     //***************************************************************************
@@ -307,6 +354,25 @@ namespace etl
       return *reinterpret_cast<const_pointer>(Address);
     }
 
+    //**********************************
+    /// Burst read.
+    /// Reads data.size() values from the port, such as a FIFO register.
+    //**********************************
+    void read(etl::span<value_type> data) const
+    {
+      etl::private_io_port::read_burst(get_address(), data.data(), data.size());
+    }
+
+    //**********************************
+    /// Burst read, handed to a transfer such as a DMA channel.
+    /// Calls transfer.read(get_address(), data).
+    //**********************************
+    template <typename TTransfer>
+    void read(etl::span<value_type> data, TTransfer& transfer) const
+    {
+      transfer.read(get_address(), data);
+    }
+
     //**********************************
     /// Write.
     //**********************************
@@ -315,6 +381,25 @@ namespace etl
       *reinterpret_cast<pointer>(Address) = value_;
     }
 
+    //**********************************
+    /// Burst write.
+    /// Writes data.size() values to the port, such as a FIFO register.
+    //**********************************
+    void write(etl::span<const value_type> data)
+    {
+      etl::private_io_port::write_burst(get_address(), data.data(), data.size());
+    }
+
+    //**********************************
+    /// Burst write, handed to a transfer such as a DMA channel.
+    /// Calls transfer.write(get_address(), data).
+    //**********************************
+    template <typename TTransfer>
+    void write(etl::span<const value_type> data, TTransfer& transfer)
+    {
+      transfer.write(get_address(), data);
+    }
+
     //**********************************
     /// Write.
     //**********************************
@@ -469,6 +554,25 @@ namespace etl
       return *reinterpret_cast<const_pointer>(Address);
     }
 
+    //**********************************
+    /// Burst read.
+    /// Reads data.size() values from the port, such as a FIFO register.
+    //**********************************
+    void read(etl::span<value_type> data) const
+    {
+      etl::private_io_port::read_burst(get_address(), data.data(), data.size());
+    }
+
+    //**********************************
+    /// Burst read, handed to a transfer such as a DMA channel.
+    /// Calls transfer.read(get_address(), data).
+    //**********************************
+    template <typename TTransfer>
+    void read(etl::span<value_type> data, TTransfer& transfer) const
+    {
+      transfer.read(get_address(), data);
+    }
+
     //**********************************
     /// Get the IO port address.
     //**********************************
@@ -536,6 +640,25 @@ namespace etl
       *reinterpret_cast<pointer>(Address) = value_;
     }
 
+    //**********************************
+    /// Burst write.
+    /// Writes data.size() values to the port, such as a FIFO register.
+    //**********************************
+    void write(etl::span<const value_type> data)
+    {
+      etl::private_io_port::write_burst(get_address(), data.data(), data.size());
+    }
+
+    //**********************************
+    /// Burst write, handed to a transfer such as a DMA channel.
+    /// Calls transfer.write(get_address(), data).
+    //**********************************
+    template <typename TTransfer>
+    void write(etl::span<const value_type> data, TTransfer& transfer)
+    {
+      transfer.write(get_address(), data);
+    }
+
     //**********************************
     /// Get the IO port address.
     //**********************************
@@ -637,6 +760,35 @@ namespace etl
       *reinterpret_cast<pointer>(Address) = shadow_value;
     }
 
+    //**********************************
+    /// Burst write.
+    /// Writes data.size() values to the port, such as a FIFO register.
+    /// The shadow value is the last value written.
+    //**********************************
+    void write(etl::span<const value_type> data)
+    {
+      if (!data.empty())
+      {
+        shadow_value = data.back();
+        etl::private_io_port::write_burst(get_address(), data.data(), data.size());
+      }
+    }
+
+    //**********************************
+    /// Burst write, handed to a transfer such as a DMA channel.
+    /// Calls transfer.write(get_address(), data).
+    /// The shadow value is the last value written.
+    //**********************************
+    template <typename TTransfer>
+    void write(etl::span<const value_type> data, TTransfer& transfer)
+    {
+      if (!data.empty())
+      {
+        shadow_value = data.back();
+        transfer.write(get_address(), data);
+      }
+    }
+
     //**********************************
     /// Write.
     //**********************************
@@ -911,6 +1063,25 @@ namespace etl
       return *address;
     }
 
+    //**********************************
+    /// Burst read.
+    /// Reads data.size() values from the port, such as a FIFO register.
+    //**********************************
+    void read(etl::span<value_type> data) const
+    {
+      etl::private_io_port::read_burst(get_address(), data.data(), data.size());
+    }
+
+    //**********************************
+    /// Burst read, handed to a transfer such as a DMA channel.
+    /// Calls transfer.read(get_address(), data).
+    //**********************************
+    template <typename TTransfer>
+    void read(etl::span<value_type> data, TTransfer& transfer) const
+    {
+      transfer.read(get_address(), data);
+    }
+
     //**********************************
     /// Write.
     //**********************************
@@ -919,6 +1090,25 @@ namespace etl
       *address = value_;
     }
 
+    //**********************************
+    /// Burst write.
+    /// Writes data.size() values to the port, such as a FIFO register.
+    //**********************************
+    void write(etl::span<const value_type> data)
+    {
+      etl::private_io_port::write_burst(get_address(), data.data(), data.size());
+    }
+
+    //**********************************
+    /// Burst write, handed to a transfer such as a DMA channel.
+    /// Calls transfer.write(get_address(), data).
+    //**********************************
+    template <typename TTransfer>
+    void write(etl::span<const value_type> data, TTransfer& transfer)
+    {
+      transfer.write(get_address(), data);
+    }
+
     //**********************************
     /// Write.
     //**********************************
@@ -1033,6 +1223,25 @@ namespace etl
       return *address;
     }
 
+    //**********************************
+    /// Burst read.
+    /// Reads data.size() values from the port, such as a FIFO register.
+    //**********************************
+    void read(etl::span<value_type> data) const
+    {
+      etl::private_io_port::read_burst(get_address(), data.data(), data.size());
+    }
+
+    //**********************************
+    /// Burst read, handed to a transfer such as a DMA channel.
+    /// Calls transfer.read(get_address(), data).
+    //**********************************
+    template <typename TTransfer>
+    void read(etl::span<value_type> data, TTransfer& transfer) const
+    {
+      transfer.read(get_address(), data);
+    }
+
   private:
 
     /// Write disabled.
@@ -1133,6 +1342,25 @@ namespace etl
       *address = value_;
     }
 
+    //**********************************
+    /// Burst write.
+    /// Writes data.size() values to the port, such as a FIFO register.
+    //**********************************
+    void write(etl::span<const value_type> data)
+    {
+      etl::private_io_port::write_burst(get_address(), data.data(), data.size());
+    }
+
+    //**********************************
+    /// Burst write, handed to a transfer such as a DMA channel.
+    /// Calls transfer.write(get_address(), data).
+    //**********************************
+    template <typename TTransfer>
+    void write(etl::span<const value_type> data, TTransfer& transfer)
+    {
+      transfer.write(get_address(), data);
+    }
+
     //**********************************
     /// Write.
     //**********************************
@@ -1342,6 +1570,35 @@ namespace etl
       *address     = shadow_value;
     }
 
+    //**********************************
+    /// Burst write.
+    /// Writes data.size() values to the port, such as a FIFO register.
+    /// The shadow value is the last value written.
+    //**********************************
+    void write(etl::span<const value_type> data)
+    {
+      if (!data.empty())
+      {
+        shadow_value = data.back();
+        etl::private_io_port::write_burst(get_address(), data.data(), data.size());
+      }
+    }
+
+    //**********************************
+    /// Burst write, handed to a transfer such as a DMA channel.
+    /// Calls transfer.write(get_address(), data).
+    /// The shadow value is the last value written.
+    //**********************************
+    template <typename TTransfer>
+    void write(etl::span<const value_type> data, TTransfer& transfer)
+    {
+      if (!data.empty())
+      {
+        shadow_value = data.back();
+        transfer.write(get_address(), data);
+      }
+    }
+
     //**********************************
     /// Write.
     //**********************************
@@ -32,6 +32,7 @@ SOFTWARE.
 #define ETL_IPOOL_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
 #include "error_handler.h"
 #include "exception.h"
 #include "static_assert.h"
@@ -95,6 +96,36 @@ namespace etl
     {}
   };
 
+  //***************************************************************************
+  /// Usage statistics for a pool.
+  /// Only recorded if ETL_POOL_STATISTICS is defined.
+  /// Define ETL_POOL_STATISTICS_TIME() as an expression returning a uint32_t
+  /// time stamp to record when the high-water mark was reached.
+  ///\ingroup pool
+  //***************************************************************************
+  struct pool_statistics
+  {
+    pool_statistics()
+    {
+      clear();
+    }
+
+    void clear()
+    {
+      high_water_mark = 0U;
+      high_water_time = 0U;
+      allocations     = 0U;
+      releases        = 0U;
+      failures        = 0U;
+    }
+
+    uint32_t high_water_mark; ///< The most items that have been allocated at once.
+    uint32_t high_water_time; ///< The time stamp when the high-water mark was last raised.
+    uint32_t allocations;     ///< The number of items allocated.
+    uint32_t releases;        ///< The number of items released.
+    uint32_t failures;        ///< The number of allocations that failed.
+  };
+
   //***************************************************************************
   ///\ingroup pool
   //***************************************************************************
@@ -120,6 +151,20 @@ namespace etl
       return reinterpret_cast<T*>(allocate_item());
     }
 
+    //*************************************************************************
+    /// Allocate storage of a size that is only known at run time, such as a
+    /// coroutine frame.
+    /// If asserts or exceptions are enabled and the size is larger than an item,
+    /// an etl::pool_element_size is thrown. If there are no more free items an
+    /// etl::pool_no_allocation if thrown. Otherwise a null pointer is returned.
+    //*************************************************************************
+    void* allocate(size_t size)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(size <= Item_Size, ETL_ERROR(etl::pool_element_size), ETL_NULLPTR);
+
+      return allocate_item();
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create default.
@@ -242,11 +287,123 @@ namespace etl
       release_item((char*)p);
     }
 
+    //*************************************************************************
+    /// Allocate storage for count objects from the pool, in one step.
+    /// Either all count items are allocated, or none are.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// \param count The number of items to allocate.
+    /// \param out   An output iterator that receives a 'T*' for each item.
+    /// \return The number of items allocated. Either count or 0.
+    //*************************************************************************
+    template <typename T, typename TOutputIterator>
+    size_t allocate_n(size_t count, TOutputIterator out)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      if (count > available())
+      {
+        record_failure();
+        ETL_ASSERT_FAIL_AND_RETURN_VALUE(ETL_ERROR(etl::pool_no_allocation), 0U);
+      }
+
+      size_t remaining = count;
+
+      while (remaining > 0U)
+      {
+        char* p_frontier = p_buffer + (items_initialised * Item_Size);
+
+        if ((p_next == p_frontier) && (items_initialised < Max_Size))
+        {
+          // The rest of the free list is never used items, so take a run of them without linking.
+          size_t   unused = size_t(Max_Size - items_initialised);
+          uint32_t n      = uint32_t((remaining < unused) ? remaining : unused);
+
+          for (uint32_t i = 0U; i < n; ++i)
+          {
+            *out = reinterpret_cast<T*>(p_frontier + (i * Item_Size));
+            ++out;
+          }
+
+          items_initialised += n;
+          remaining         -= n;
+          p_next             = p_frontier + (n * Item_Size);
+        }
+        else
+        {
+          // A released item, or an initialised one, so follow its link.
+          *out = reinterpret_cast<T*>(p_next);
+          ++out;
+
+          p_next = *reinterpret_cast<char**>(p_next);
+          --remaining;
+        }
+      }
+
+      items_allocated += uint32_t(count);
+      record_allocations(uint32_t(count));
+
+      if (items_allocated == Max_Size)
+      {
+        // No more left!
+        p_next = ETL_NULLPTR;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Release count objects to the pool, splicing them into the free list in one step.
+    /// If asserts or exceptions are enabled and an object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown, and none are released.
+    /// \param ptrs  An iterator to the pointers to the objects to release.
+    /// \param count The number of objects to release.
+    //*************************************************************************
+    template <typename TIterator>
+    void release_n(TIterator ptrs, size_t count)
+    {
+      if (count == 0U)
+      {
+        return;
+      }
+
+      ETL_ASSERT_OR_RETURN(count <= items_allocated, ETL_ERROR(etl::pool_no_allocation));
+
+      char* p_first = to_item(*ptrs);
+      char* p_last  = p_first;
+
+      ETL_ASSERT_OR_RETURN(is_item_in_pool(p_first), ETL_ERROR(etl::pool_object_not_in_pool));
+
+      // Link the released items together.
+      for (size_t i = 1U; i < count; ++i)
+      {
+        ++ptrs;
+        char* p_item = to_item(*ptrs);
+
+        ETL_ASSERT_OR_RETURN(is_item_in_pool(p_item), ETL_ERROR(etl::pool_object_not_in_pool));
+
+        *reinterpret_cast<char**>(p_last) = p_item;
+        p_last = p_item;
+      }
+
+      // Splice the chain in front of the free list.
+      *reinterpret_cast<char**>(p_last) = p_next;
+      p_next = p_first;
+
+      items_allocated -= uint32_t(count);
+      record_releases(uint32_t(count));
+    }
+
     //*************************************************************************
     /// Release all objects in the pool.
+    /// O(1), as the free list is rebuilt lazily.
     //*************************************************************************
     void release_all()
     {
+      record_releases(items_allocated);
       items_allocated = 0;
       items_initialised = 0;
       p_next = p_buffer;
@@ -313,6 +470,26 @@ namespace etl
       return items_allocated == Max_Size;
     }
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Returns the usage statistics for the pool.
+    //*************************************************************************
+    const etl::pool_statistics& get_statistics() const
+    {
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Clears the usage statistics for the pool.
+    /// The high-water mark restarts at the current number of allocated items.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      statistics.clear();
+      statistics.high_water_mark = items_allocated;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -353,6 +530,8 @@ namespace etl
         p_value = p_next;
 
         ++items_allocated;
+        record_allocations(1U);
+
         if (items_allocated < Max_Size)
         {
           // Set up the pointer to the next free item
@@ -366,6 +545,7 @@ namespace etl
       }
       else
       {
+        record_failure();
         ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
       }
 
@@ -414,6 +594,7 @@ namespace etl
         p_next = p_value;
 
         --items_allocated;
+        record_releases(1U);
       }
       else
       {
@@ -421,6 +602,61 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Records allocations in the statistics and trace, if enabled.
+    //*************************************************************************
+    void record_allocations(uint32_t n)
+    {
+      ETL_TRACE(etl::trace_event::pool_allocate, this, n);
+
+#if defined(ETL_POOL_STATISTICS)
+      statistics.allocations += n;
+
+      if (items_allocated > statistics.high_water_mark)
+      {
+        statistics.high_water_mark = items_allocated;
+  #if defined(ETL_POOL_STATISTICS_TIME)
+        statistics.high_water_time = uint32_t(ETL_POOL_STATISTICS_TIME());
+  #endif
+      }
+#else
+      (void)n;
+#endif
+    }
+
+    //*************************************************************************
+    /// Records releases in the statistics and trace, if enabled.
+    //*************************************************************************
+    void record_releases(uint32_t n)
+    {
+      ETL_TRACE(etl::trace_event::pool_release, this, n);
+
+#if defined(ETL_POOL_STATISTICS)
+      statistics.releases += n;
+#else
+      (void)n;
+#endif
+    }
+
+    //*************************************************************************
+    /// Records a failed allocation in the statistics, if enabled.
+    //*************************************************************************
+    void record_failure()
+    {
+#if defined(ETL_POOL_STATISTICS)
+      ++statistics.failures;
+#endif
+    }
+
+    //*************************************************************************
+    /// Converts an object pointer to an item pointer.
+    //*************************************************************************
+    static char* to_item(const void* const p_object)
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      return (char*)p;
+    }
+
     //*************************************************************************
     /// Check if the item belongs to this pool.
     //*************************************************************************
@@ -451,6 +687,10 @@ namespace etl
     uint32_t  items_allocated;   ///< The number of items allocated.
     uint32_t  items_initialised; ///< The number of items initialised.
 
+#if defined(ETL_POOL_STATISTICS)
+    etl::pool_statistics statistics; ///< The usage statistics.
+#endif
+
     const uint32_t Item_Size;    ///< The size of allocated items.
     const uint32_t Max_Size;     ///< The maximum number of objects that can be allocated.
 
@@ -953,6 +953,37 @@ namespace etl
   template <typename T>
   ETL_CONSTANT bool is_random_access_iterator_concept<T>::value;
 
+  //***************************************************************************
+  /// Is the iterator over a sequence made of contiguous segments?
+  /// A segmented iterator defines 'segment_pointer' and has the members
+  /// segment_pointer segment_begin() const, which returns the address of the current element,
+  /// size_t segment_size(const TIterator& last) const, which returns the number of elements up
+  /// to 'last' or the end of the current segment, whichever is nearer, and
+  /// void segment_advance(size_t n), which moves forward by n, at most segment_size(last), elements.
+  /// Algorithms may then process each segment as a pointer range.
+  //***************************************************************************
+  template <typename T>
+  struct is_segmented_iterator
+  {
+  private:
+
+    typedef char yes;
+    struct no { char c[2]; };
+
+    template <typename U>
+    static yes test(typename U::segment_pointer*);
+
+    template <typename U>
+    static no test(...);
+
+  public:
+
+    static ETL_CONSTANT bool value = (sizeof(test<T>(0)) == sizeof(yes));
+  };
+
+  template <typename T>
+  ETL_CONSTANT bool is_segmented_iterator<T>::value;
+
 #if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //*****************************************************************************
   /// Get the 'begin' iterator.
@@ -76,6 +76,21 @@ namespace etl
       return hash;
     }
 
+    uint32_t add(value_type hash, const uint8_t* p_data, size_t length) const
+    {
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      while (length != 0U)
+      {
+        hash += *p_data++;
+        hash += (hash << 10U);
+        hash ^= (hash >> 6U);
+        --length;
+      }
+
+      return hash;
+    }
+
     uint32_t final(value_type hash) const
     {
       hash += (hash << 3U);
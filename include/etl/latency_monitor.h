@@ -0,0 +1,348 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LATENCY_MONITOR_INCLUDED
+#define ETL_LATENCY_MONITOR_INCLUDED
+
+#include "platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup latency_monitor latency monitor
+/// Handler latency instrumentation.
+/// Define ETL_LATENCY_HOOKS to measure the execution time of message router
+/// handlers, per message id, and callback timer callbacks, per timer id,
+/// into the etl::ilatency_monitor set for each domain.
+/// Without ETL_LATENCY_HOOKS the hooks expand to nothing.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The sources of latency measurements.
+  ///\ingroup latency_monitor
+  //***************************************************************************
+  struct latency_domain
+  {
+    enum enum_type
+    {
+      message, ///< Message router handlers, by message id.
+      timer    ///< Callback timer callbacks, by timer id.
+    };
+  };
+}
+
+#if defined(ETL_LATENCY_HOOKS)
+
+#include "binary.h"
+#include "cycle_counter.h"
+#include "histogram.h"
+#include "nullptr.h"
+
+//*****************************************************************************
+/// The clock for latency measurements.
+/// Defaults to ETL_CYCLE_COUNTER().
+//*****************************************************************************
+#if !defined(ETL_LATENCY_TIMESTAMP)
+  #define ETL_LATENCY_TIMESTAMP() ETL_CYCLE_COUNTER()
+#endif
+
+//*****************************************************************************
+/// Measures from here to the end of the scope.
+/// Only one may be declared in a scope.
+//*****************************************************************************
+#define ETL_LATENCY_SCOPE(domain, id) etl::latency_scope etl_latency_scope((domain), static_cast<size_t>(id))
+
+//*****************************************************************************
+/// Discards the measurement of the ETL_LATENCY_SCOPE in this scope.
+//*****************************************************************************
+#define ETL_LATENCY_CANCEL() etl_latency_scope.cancel()
+
+namespace etl
+{
+  //***************************************************************************
+  /// The latency statistics for one id.
+  ///\ingroup latency_monitor
+  //***************************************************************************
+  struct latency_statistics
+  {
+    /// Bucket 'n' counts the latencies that need 'n' bits, i.e.
+    /// 2^(n-1) to 2^n - 1. Bucket 0 counts latencies of zero.
+    typedef etl::histogram<uint8_t, uint32_t, 33U, 0> histogram_type;
+
+    histogram_type histogram;
+    uint32_t       worst;
+    uint32_t       count;
+  };
+
+  //***************************************************************************
+  /// The interface to a latency monitor.
+  /// Ids at or above the maximum share one overflow entry.
+  /// Records from one context at a time, e.g. the context that runs the
+  /// router or ticks the timers.
+  ///\ingroup latency_monitor
+  //***************************************************************************
+  class ilatency_monitor
+  {
+  public:
+
+    //*************************************************************************
+    /// Records a latency.
+    //*************************************************************************
+    void record(size_t id, uint32_t latency)
+    {
+      etl::latency_statistics& statistics = p_statistics[(id < max_ids) ? id : max_ids];
+
+      statistics.histogram.add(bucket(latency));
+
+      if (latency > statistics.worst)
+      {
+        statistics.worst = latency;
+      }
+
+      ++statistics.count;
+    }
+
+    //*************************************************************************
+    /// Gets the statistics for an id.
+    //*************************************************************************
+    const etl::latency_statistics& get(size_t id) const
+    {
+      return p_statistics[(id < max_ids) ? id : max_ids];
+    }
+
+    //*************************************************************************
+    /// Gets the statistics for ids at or above the maximum.
+    //*************************************************************************
+    const etl::latency_statistics& overflow() const
+    {
+      return p_statistics[max_ids];
+    }
+
+    //*************************************************************************
+    /// Gets the worst case latency for an id.
+    //*************************************************************************
+    uint32_t worst_case(size_t id) const
+    {
+      return get(id).worst;
+    }
+
+    //*************************************************************************
+    /// Gets the number of latencies recorded for an id.
+    //*************************************************************************
+    uint32_t count(size_t id) const
+    {
+      return get(id).count;
+    }
+
+    //*************************************************************************
+    /// Gets an upper bound for the latency percentile, from 0 to 100, of an
+    /// id. Accurate to a power of two.
+    //*************************************************************************
+    uint32_t percentile(size_t id, double percentile_) const
+    {
+      const etl::latency_statistics& statistics = get(id);
+
+      if (statistics.count == 0U)
+      {
+        return 0U;
+      }
+
+      const uint8_t n = statistics.histogram.percentile(percentile_);
+
+      return (n == 0U) ? 0U : static_cast<uint32_t>(0xFFFFFFFFUL >> (32U - n));
+    }
+
+    //*************************************************************************
+    /// The number of ids with their own statistics.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return max_ids;
+    }
+
+    //*************************************************************************
+    /// Clears all statistics.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i <= max_ids; ++i)
+      {
+        p_statistics[i].histogram.clear();
+        p_statistics[i].worst = 0U;
+        p_statistics[i].count = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// The histogram bucket for a latency.
+    //*************************************************************************
+    static uint8_t bucket(uint32_t latency)
+    {
+      return (latency == 0U) ? 0U : static_cast<uint8_t>(32U - etl::count_leading_zeros(latency));
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ilatency_monitor(etl::latency_statistics* p_statistics_, size_t max_ids_)
+      : p_statistics(p_statistics_)
+      , max_ids(max_ids_)
+    {
+      clear();
+    }
+
+  private:
+
+    ilatency_monitor(const ilatency_monitor&) ETL_DELETE;
+    ilatency_monitor& operator =(const ilatency_monitor&) ETL_DELETE;
+
+    etl::latency_statistics* const p_statistics;
+    const size_t                   max_ids;
+  };
+
+  //***************************************************************************
+  /// A latency monitor for ids 0 to VMax_Ids - 1.
+  ///\ingroup latency_monitor
+  //***************************************************************************
+  template <size_t VMax_Ids>
+  class latency_monitor : public etl::ilatency_monitor
+  {
+  public:
+
+    static ETL_CONSTANT size_t Max_Ids = VMax_Ids;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    latency_monitor()
+      : ilatency_monitor(statistics, VMax_Ids)
+    {
+    }
+
+  private:
+
+    // The extra entry is for the overflow.
+    etl::latency_statistics statistics[VMax_Ids + 1U];
+  };
+
+  template <size_t VMax_Ids>
+  ETL_CONSTANT size_t latency_monitor<VMax_Ids>::Max_Ids;
+
+  namespace private_latency_monitor
+  {
+    //*************************************************************************
+    /// The monitor used by the hooks for a domain.
+    //*************************************************************************
+    inline etl::ilatency_monitor*& monitor(etl::latency_domain::enum_type domain)
+    {
+      static etl::ilatency_monitor* p_monitors[2] = { ETL_NULLPTR, ETL_NULLPTR };
+
+      return p_monitors[domain];
+    }
+  }
+
+  //***************************************************************************
+  /// Sets the monitor used by the hooks for a domain.
+  /// Set before handlers run. ETL_NULLPTR stops measurement.
+  ///\ingroup latency_monitor
+  //***************************************************************************
+  inline void set_latency_monitor(etl::latency_domain::enum_type domain, etl::ilatency_monitor* p_monitor)
+  {
+    private_latency_monitor::monitor(domain) = p_monitor;
+  }
+
+  //***************************************************************************
+  /// Gets the monitor used by the hooks for a domain.
+  ///\ingroup latency_monitor
+  //***************************************************************************
+  inline etl::ilatency_monitor* get_latency_monitor(etl::latency_domain::enum_type domain)
+  {
+    return private_latency_monitor::monitor(domain);
+  }
+
+  //***************************************************************************
+  /// Records the time from construction to destruction in the monitor for a
+  /// domain, if there is one.
+  ///\ingroup latency_monitor
+  //***************************************************************************
+  class latency_scope
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    latency_scope(etl::latency_domain::enum_type domain, size_t id_)
+      : p_monitor(private_latency_monitor::monitor(domain))
+      , id(id_)
+      , start((p_monitor != ETL_NULLPTR) ? uint32_t(ETL_LATENCY_TIMESTAMP()) : 0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~latency_scope()
+    {
+      if (p_monitor != ETL_NULLPTR)
+      {
+        p_monitor->record(id, uint32_t(ETL_LATENCY_TIMESTAMP()) - start);
+      }
+    }
+
+    //*************************************************************************
+    /// Discards the measurement.
+    //*************************************************************************
+    void cancel()
+    {
+      p_monitor = ETL_NULLPTR;
+    }
+
+  private:
+
+    latency_scope(const latency_scope&) ETL_DELETE;
+    latency_scope& operator =(const latency_scope&) ETL_DELETE;
+
+    etl::ilatency_monitor* p_monitor;
+    const size_t           id;
+    const uint32_t         start;
+  };
+}
+
+#else
+  #define ETL_LATENCY_SCOPE(domain, id)
+  #define ETL_LATENCY_CANCEL()
+#endif
+
+#endif
@@ -285,6 +285,17 @@ namespace etl
       return p_node_pool->available();
     }
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Returns the usage statistics of the node pool.
+    //*************************************************************************
+    const etl::pool_statistics& get_pool_statistics() const
+    {
+      ETL_ASSERT(p_node_pool != ETL_NULLPTR, ETL_ERROR(list_no_pool));
+      return p_node_pool->get_statistics();
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -346,6 +357,44 @@ namespace etl
       right.previous = &left;
     }
 
+    //*************************************************************************
+    /// Moves the node 'from' to the position before 'to'.
+    //*************************************************************************
+    void move_node(node_t& to_node, node_t& from_node)
+    {
+      if (&from_node == &to_node)
+      {
+        return; // Can't more to before yourself!
+      }
+
+      // Disconnect the node from the list.
+      join(*from_node.previous, *from_node.next);
+
+      // Attach it to the new position.
+      join(*to_node.previous, from_node);
+      join(from_node, to_node);
+    }
+
+    //*************************************************************************
+    /// Moves the nodes 'first' to before 'last' to the position before 'to'.
+    //*************************************************************************
+    void move_nodes(node_t& to_node, node_t& first_node, node_t& last_node)
+    {
+      if (&first_node == &last_node)
+      {
+        return; // Empty range.
+      }
+
+      node_t& final_node = *last_node.previous;
+
+      // Disconnect the range from the list.
+      join(*first_node.previous, last_node);
+
+      // Attach it to the new position.
+      join(*to_node.previous, first_node);
+      join(final_node, to_node);
+    }
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -445,6 +494,83 @@ namespace etl
       return reinterpret_cast<data_node_t*>(p_node);
     }
 
+    //*************************************************************************
+    /// Sorts a null terminated chain of 'next' links by descending address.
+    /// The 'previous' links are not changed.
+    //*************************************************************************
+    static node_t* sort_by_address(node_t* p_list)
+    {
+      size_t list_size = 1U;
+
+      while (true)
+      {
+        node_t* p_left = p_list;
+        node_t* p_tail = ETL_NULLPTR;
+        size_t  number_of_merges = 0U;
+
+        p_list = ETL_NULLPTR;
+
+        while (p_left != ETL_NULLPTR)
+        {
+          ++number_of_merges;
+
+          // Step 'list_size' places along from left.
+          node_t* p_right   = p_left;
+          size_t  left_size = 0U;
+
+          while ((left_size < list_size) && (p_right != ETL_NULLPTR))
+          {
+            ++left_size;
+            p_right = p_right->next;
+          }
+
+          size_t right_size = list_size;
+
+          // Merge the two runs.
+          while ((left_size > 0U) || ((right_size > 0U) && (p_right != ETL_NULLPTR)))
+          {
+            node_t* p_node;
+
+            if ((left_size != 0U) &&
+                ((right_size == 0U) || (p_right == ETL_NULLPTR) || (uintptr_t(p_left) > uintptr_t(p_right))))
+            {
+              p_node = p_left;
+              p_left = p_left->next;
+              --left_size;
+            }
+            else
+            {
+              p_node  = p_right;
+              p_right = p_right->next;
+              --right_size;
+            }
+
+            if (p_tail == ETL_NULLPTR)
+            {
+              p_list = p_node;
+            }
+            else
+            {
+              p_tail->next = p_node;
+            }
+
+            p_tail = p_node;
+          }
+
+          p_left = p_right;
+        }
+
+        p_tail->next = ETL_NULLPTR;
+
+        if (number_of_merges <= 1U)
+        {
+          return p_list;
+        }
+
+        list_size *= 2U;
+      }
+    }
+
     //*************************************************************************
     /// Downcast a node_t& to a data_node_t&
     //*************************************************************************
@@ -1333,6 +1459,32 @@ namespace etl
       initialise();
     }
 
+    //*************************************************************************
+    /// Clears the list incrementally.
+    /// Removes up to 'budget' elements from the front, so that clearing a large
+    /// list may be spread over several calls. Trivially destructible elements
+    /// in a pool that is not shared are all released in one step.
+    ///\param budget The maximum number of elements to remove.
+    ///\return <b>true</b> if the list is now empty.
+    //*************************************************************************
+    bool clear_some(size_t budget)
+    {
+      if (etl::is_trivially_destructible<T>::value && !has_shared_pool())
+      {
+        initialise();
+      }
+      else
+      {
+        while ((budget != 0U) && !empty())
+        {
+          remove_node(get_head());
+          --budget;
+        }
+      }
+
+      return empty();
+    }
+
     //*************************************************************************
     // Removes the values specified.
     //*************************************************************************
@@ -1788,6 +1940,72 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Reorders the values so that traversal visits the nodes in ascending
+    /// address order. The order of the values is unchanged.
+    /// Nodes that are allocated from a pool, then erased and reused, end up
+    /// scattered through it, so that traversal jumps around memory. After a
+    /// reorder, traversal reads the pool in one direction, which the hardware
+    /// prefetcher can follow.
+    /// O(N log N) node comparisons and at most N - 1 value swaps. No extra
+    /// memory is used.
+    /// Iterators remain valid, but may refer to different values.
+    //*************************************************************************
+    void reorder()
+    {
+      if (is_trivial_list())
+      {
+        return;
+      }
+
+      // Sort the 'next' links by descending address.
+      // The 'previous' links still hold the traversal order.
+      terminal_node.previous->next = ETL_NULLPTR;
+      node_t* p_by_address = sort_by_address(terminal_node.next);
+
+      // Pair the nodes, from the last, in both orders.
+      // Each node's 'previous' link now points to the node that its value must move to.
+      node_t* p_by_traversal = terminal_node.previous;
+      node_t* p_target       = p_by_address;
+
+      while (p_target != ETL_NULLPTR)
+      {
+        node_t* p_previous = p_by_traversal->previous;
+        p_by_traversal->previous = p_target;
+        p_by_traversal = p_previous;
+        p_target       = p_target->next;
+      }
+
+      // Move the values to their targets, one permutation cycle at a time.
+      for (node_t* p_node = p_by_address; p_node != ETL_NULLPTR; p_node = p_node->next)
+      {
+        while (p_node->previous != p_node)
+        {
+          node_t* p_other = p_node->previous;
+
+          using ETL_OR_STD::swap; // Allow ADL
+          swap(data_cast(p_node)->value, data_cast(p_other)->value);
+
+          p_node->previous  = p_other->previous;
+          p_other->previous = p_other;
+        }
+      }
+
+      // Link the nodes in ascending address order.
+      node_t* p_next = &terminal_node;
+      node_t* p_node = p_by_address;
+
+      while (p_node != ETL_NULLPTR)
+      {
+        node_t* p_higher = p_node;
+        p_node = p_node->next;
+        join(*p_higher, *p_next);
+        p_next = p_higher;
+      }
+
+      join(terminal_node, *p_next);
+    }
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -1929,20 +2147,7 @@ namespace etl
     //*************************************************************************
     void move(iterator to, iterator from)
     {
-      if (from == to)
-      {
-        return; // Can't more to before yourself!
-      }
-
-      node_t& from_node = *from.p_node;
-      node_t& to_node = *to.p_node;
-
-      // Disconnect the node from the list.
-      join(*from_node.previous, *from_node.next);
-
-      // Attach it to the new position.
-      join(*to_node.previous, from_node);
-      join(from_node, to_node);
+      move_node(*to.p_node, *from.p_node);
     }
 
     //*************************************************************************
@@ -1964,17 +2169,7 @@ namespace etl
       }
 #endif
 
-      node_t& first_node = *first.p_node;
-      node_t& last_node = *last.p_node;
-      node_t& to_node = *to.p_node;
-      node_t& final_node = *last_node.previous;
-
-      // Disconnect the range from the list.
-      join(*first_node.previous, last_node);
-
-      // Attach it to the new position.
-      join(*to_node.previous, first_node);
-      join(final_node, to_node);
+      move_nodes(*to.p_node, *first.p_node, *last.p_node);
     }
 
     //*************************************************************************
@@ -0,0 +1,598 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LZ4_INCLUDED
+#define ETL_LZ4_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "span.h"
+#include "byte_stream.h"
+#include "bip_buffer_spsc_atomic.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup lz4 lz4
+/// Allocation free compression and decompression in the LZ4 block format.
+/// The output can be decompressed by any LZ4 block decoder.
+/// See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The status of a compression or decompression.
+  ///\ingroup lz4
+  //***************************************************************************
+  struct lz4_status
+  {
+    enum enum_type
+    {
+      Success,         ///< All of the source was processed.
+      Invalid,         ///< The compressed source is malformed at 'read'.
+      Destination_Full ///< The destination is too small.
+    };
+  };
+
+  //***************************************************************************
+  /// The result of a compression or decompression.
+  ///\ingroup lz4
+  //***************************************************************************
+  struct lz4_result
+  {
+    lz4_result()
+      : status(etl::lz4_status::Success)
+      , read(0U)
+      , written(0U)
+    {
+    }
+
+    bool success() const
+    {
+      return status == etl::lz4_status::Success;
+    }
+
+    etl::lz4_status::enum_type status;
+    size_t                     read;    ///< The number of source bytes processed.
+    size_t                     written; ///< The number of destination bytes written.
+  };
+
+  namespace private_lz4
+  {
+    static ETL_CONSTANT size_t Min_Match      = 4U;      ///< The shortest match.
+    static ETL_CONSTANT size_t Last_Literals  = 5U;      ///< The last bytes are always literals.
+    static ETL_CONSTANT size_t Match_Limit    = 12U;     ///< The last match starts before this from the end.
+    static ETL_CONSTANT size_t Max_Offset     = 65535U;  ///< The furthest match.
+    static ETL_CONSTANT size_t Skip_Trigger   = 6U;      ///< Speeds up the search through incompressible data.
+
+    //*************************************************************************
+    inline uint32_t read32(const uint8_t* p)
+    {
+      uint32_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// The length of the common prefix of a and b, up to 'limit'.
+    /// Compares a word at a time.
+    //*************************************************************************
+    inline size_t common_length(const uint8_t* a, const uint8_t* b, size_t limit)
+    {
+      size_t length = 0U;
+
+      while ((limit - length) >= sizeof(size_t))
+      {
+        size_t wa;
+        size_t wb;
+        memcpy(&wa, a + length, sizeof(size_t));
+        memcpy(&wb, b + length, sizeof(size_t));
+
+        if (wa != wb)
+        {
+          break;
+        }
+
+        length += sizeof(size_t);
+      }
+
+      while ((length < limit) && (a[length] == b[length]))
+      {
+        ++length;
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// The number of bytes to encode a length of 15 or more in a token.
+    //*************************************************************************
+    inline size_t extra_length_size(size_t length)
+    {
+      return (length < 15U) ? 0U : ((length - 15U) / 255U) + 1U;
+    }
+
+    //*************************************************************************
+    /// Writes the bytes that follow a token for a length of 15 or more.
+    //*************************************************************************
+    inline uint8_t* write_extra_length(uint8_t* p, size_t length)
+    {
+      if (length >= 15U)
+      {
+        length -= 15U;
+
+        while (length >= 255U)
+        {
+          *p++ = 255U;
+          length -= 255U;
+        }
+
+        *p++ = static_cast<uint8_t>(length);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Reads the bytes that follow a token for a length of 15.
+    /// Returns false if the source ends first.
+    //*************************************************************************
+    inline bool read_extra_length(const uint8_t*& p, const uint8_t* p_end, size_t& length)
+    {
+      uint8_t value;
+
+      do
+      {
+        if (p == p_end)
+        {
+          return false;
+        }
+
+        value   = *p++;
+        length += value;
+      } while (value == 255U);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes a sequence of literals and an optional match.
+    /// Returns ETL_NULLPTR if the destination is too small.
+    //*************************************************************************
+    inline uint8_t* write_sequence(uint8_t* p, const uint8_t* p_end,
+                                   const uint8_t* p_literals, size_t literal_length,
+                                   size_t offset, size_t match_length)
+    {
+      const size_t match_code = (match_length == 0U) ? 0U : (match_length - Min_Match);
+      const size_t needed     = 1U + extra_length_size(literal_length) + literal_length +
+                                ((match_length == 0U) ? 0U : (2U + extra_length_size(match_code)));
+
+      if (needed > static_cast<size_t>(p_end - p))
+      {
+        return ETL_NULLPTR;
+      }
+
+      const size_t literal_token = (literal_length < 15U) ? literal_length : 15U;
+      const size_t match_token   = (match_code     < 15U) ? match_code     : 15U;
+
+      *p++ = static_cast<uint8_t>((literal_token << 4U) | match_token);
+      p    = write_extra_length(p, literal_length);
+
+      if (literal_length != 0U)
+      {
+        memcpy(p, p_literals, literal_length);
+        p += literal_length;
+      }
+
+      if (match_length != 0U)
+      {
+        *p++ = static_cast<uint8_t>(offset);
+        *p++ = static_cast<uint8_t>(offset >> 8U);
+        p    = write_extra_length(p, match_code);
+      }
+
+      return p;
+    }
+  }
+
+  //***************************************************************************
+  /// The largest compressed size of 'length' bytes.
+  ///\ingroup lz4
+  //***************************************************************************
+  ETL_CONSTEXPR inline size_t lz4_max_compressed_size(size_t length)
+  {
+    return length + (length / 255U) + 16U;
+  }
+
+  //***************************************************************************
+  /// An LZ4 block compressor.
+  /// The object is the match finder's hash table, of 2^VHash_Bits positions,
+  /// so it is usually declared statically and reused for each block.
+  /// More bits find more matches, for 4 bytes of RAM per entry.
+  /// Each block is compressed independently.
+  ///\ingroup lz4
+  //***************************************************************************
+  template <size_t VHash_Bits = 10U>
+  class lz4_compressor
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VHash_Bits >= 8U) && (VHash_Bits <= 16U), "Hash bits must be from 8 to 16");
+
+    static ETL_CONSTANT size_t Hash_Bits = VHash_Bits;
+    static ETL_CONSTANT size_t Hash_Size = size_t(1U) << VHash_Bits;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    lz4_compressor()
+      : table()
+    {
+    }
+
+    //*************************************************************************
+    /// Compresses the source into the destination.
+    /// A destination of lz4_max_compressed_size() bytes always fits.
+    //*************************************************************************
+    etl::lz4_result compress(etl::span<const uint8_t> source, etl::span<uint8_t> destination)
+    {
+      return compress(source.data(), source.size(), destination.data(), destination.size());
+    }
+
+    //*************************************************************************
+    /// Compresses the source into the destination.
+    //*************************************************************************
+    etl::lz4_result compress(etl::span<const char> source, etl::span<char> destination)
+    {
+      return compress(reinterpret_cast<const uint8_t*>(source.data()), source.size(),
+                      reinterpret_cast<uint8_t*>(destination.data()), destination.size());
+    }
+
+    //*************************************************************************
+    /// Compresses the source into the free space of the writer.
+    /// The writer is advanced past the compressed block if it fits.
+    //*************************************************************************
+    etl::lz4_result compress(etl::span<const uint8_t> source, etl::byte_stream_writer& writer)
+    {
+      etl::span<char> free_data = writer.free_data();
+
+      etl::lz4_result result = compress(source.data(), source.size(),
+                                        reinterpret_cast<uint8_t*>(free_data.data()), free_data.size());
+
+      if (result.success())
+      {
+        writer.skip<char>(result.written);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Compresses the source into the free space of the writer.
+    //*************************************************************************
+    etl::lz4_result compress(etl::span<const char> source, etl::byte_stream_writer& writer)
+    {
+      return compress(etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(source.data()), source.size()), writer);
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    /// Compresses the source into a write reserve of the bip buffer.
+    /// The compressed block is committed if it fits, otherwise nothing is
+    /// committed.
+    //*************************************************************************
+    template <typename T, const size_t Memory_Model>
+    etl::lz4_result compress(etl::span<const uint8_t> source, etl::ibip_buffer_spsc_atomic<T, Memory_Model>& buffer)
+    {
+      ETL_STATIC_ASSERT(sizeof(T) == 1U, "The buffer must be of bytes");
+
+      typedef typename etl::ibip_buffer_spsc_atomic<T, Memory_Model>::size_type size_type;
+
+      const size_t    needed  = etl::lz4_max_compressed_size(source.size());
+      const size_type maximum = etl::numeric_limits<size_type>::max();
+
+      etl::span<T> reserve = buffer.write_reserve((needed < maximum) ? static_cast<size_type>(needed) : maximum);
+
+      etl::lz4_result result = compress(source.data(), source.size(),
+                                        reinterpret_cast<uint8_t*>(reserve.data()), reserve.size());
+
+      if (result.success())
+      {
+        buffer.write_commit(reserve.first(result.written));
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Compresses the source into a write reserve of the bip buffer.
+    //*************************************************************************
+    template <typename T, const size_t Memory_Model>
+    etl::lz4_result compress(etl::span<const char> source, etl::ibip_buffer_spsc_atomic<T, Memory_Model>& buffer)
+    {
+      return compress(etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(source.data()), source.size()), buffer);
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// The hash of the four bytes at p.
+    //*************************************************************************
+    static size_t hash(const uint8_t* p)
+    {
+      return static_cast<size_t>((private_lz4::read32(p) * 2654435761UL) >> (32U - VHash_Bits)) & (Hash_Size - 1U);
+    }
+
+    //*************************************************************************
+    /// Compresses a block. Greedy matching, as the reference 'fast' mode.
+    //*************************************************************************
+    etl::lz4_result compress(const uint8_t* p_source, size_t length, uint8_t* p_destination, size_t capacity)
+    {
+      using namespace private_lz4;
+
+      etl::lz4_result result;
+
+      const uint8_t* const p_end = p_destination + capacity;
+      uint8_t*             p     = p_destination;
+      size_t               anchor = 0U;
+
+      if (length > Match_Limit)
+      {
+        memset(table, 0, sizeof(table));
+
+        const size_t match_end   = length - Last_Literals;
+        const size_t search_end  = length - Match_Limit;
+        size_t       position    = 1U;
+        size_t       attempts    = size_t(1U) << Skip_Trigger;
+
+        while (position < search_end)
+        {
+          const size_t h         = hash(p_source + position);
+          size_t       candidate = table[h];
+
+          table[h] = static_cast<uint32_t>(position);
+
+          if (((position - candidate) > Max_Offset) ||
+              (read32(p_source + candidate) != read32(p_source + position)))
+          {
+            // Step further the longer there is no match.
+            position += (attempts++ >> Skip_Trigger);
+            continue;
+          }
+
+          attempts = size_t(1U) << Skip_Trigger;
+
+          // Extend the match backwards over the pending literals.
+          while ((position > anchor) && (candidate > 0U) && (p_source[position - 1U] == p_source[candidate - 1U]))
+          {
+            --position;
+            --candidate;
+          }
+
+          const size_t match_length = Min_Match + common_length(p_source + position + Min_Match,
+                                                                p_source + candidate + Min_Match,
+                                                                match_end - position - Min_Match);
+
+          p = write_sequence(p, p_end, p_source + anchor, position - anchor, position - candidate, match_length);
+
+          if (p == ETL_NULLPTR)
+          {
+            result.status = etl::lz4_status::Destination_Full;
+            return result;
+          }
+
+          position += match_length;
+          anchor    = position;
+
+          if (position < search_end)
+          {
+            table[hash(p_source + position - 2U)] = static_cast<uint32_t>(position - 2U);
+          }
+        }
+      }
+
+      p = private_lz4::write_sequence(p, p_end, p_source + anchor, length - anchor, 0U, 0U);
+
+      if (p == ETL_NULLPTR)
+      {
+        result.status = etl::lz4_status::Destination_Full;
+        return result;
+      }
+
+      result.read    = length;
+      result.written = static_cast<size_t>(p - p_destination);
+
+      return result;
+    }
+
+    uint32_t table[Hash_Size];
+  };
+
+  template <size_t VHash_Bits>
+  ETL_CONSTANT size_t lz4_compressor<VHash_Bits>::Hash_Bits;
+
+  template <size_t VHash_Bits>
+  ETL_CONSTANT size_t lz4_compressor<VHash_Bits>::Hash_Size;
+
+  namespace private_lz4
+  {
+    //*************************************************************************
+    /// Decompresses a block, checking every length and offset.
+    //*************************************************************************
+    inline etl::lz4_result decompress(const uint8_t* p_source, size_t length, uint8_t* p_destination, size_t capacity)
+    {
+      etl::lz4_result result;
+
+      const uint8_t*       ip     = p_source;
+      const uint8_t* const ip_end = p_source + length;
+      uint8_t*             op     = p_destination;
+      uint8_t* const       op_end = p_destination + capacity;
+
+      while (ip != ip_end)
+      {
+        const uint8_t* const p_sequence = ip;
+        const uint8_t        token      = *ip++;
+
+        size_t literal_length = token >> 4U;
+
+        if ((literal_length == 15U) && !read_extra_length(ip, ip_end, literal_length))
+        {
+          result.status = etl::lz4_status::Invalid;
+          result.read   = static_cast<size_t>(p_sequence - p_source);
+          break;
+        }
+
+        if (literal_length > static_cast<size_t>(ip_end - ip))
+        {
+          result.status = etl::lz4_status::Invalid;
+          result.read   = static_cast<size_t>(p_sequence - p_source);
+          break;
+        }
+
+        if (literal_length > static_cast<size_t>(op_end - op))
+        {
+          result.status = etl::lz4_status::Destination_Full;
+          result.read   = static_cast<size_t>(p_sequence - p_source);
+          break;
+        }
+
+        if (literal_length != 0U)
+        {
+          memcpy(op, ip, literal_length);
+          ip += literal_length;
+          op += literal_length;
+        }
+
+        if (ip == ip_end)
+        {
+          // The last sequence has no match.
+          break;
+        }
+
+        size_t offset       = 0U;
+        size_t match_length = token & 0x0FU;
+
+        if ((ip_end - ip) >= 2)
+        {
+          offset = size_t(ip[0]) | (size_t(ip[1]) << 8U);
+          ip += 2U;
+        }
+
+        if ((offset == 0U) || (offset > static_cast<size_t>(op - p_destination)) ||
+            ((match_length == 15U) && !read_extra_length(ip, ip_end, match_length)))
+        {
+          result.status = etl::lz4_status::Invalid;
+          result.read   = static_cast<size_t>(p_sequence - p_source);
+          break;
+        }
+
+        match_length += Min_Match;
+
+        if (match_length > static_cast<size_t>(op_end - op))
+        {
+          result.status = etl::lz4_status::Destination_Full;
+          result.read   = static_cast<size_t>(p_sequence - p_source);
+          break;
+        }
+
+        const uint8_t* match = op - offset;
+
+        if (offset >= match_length)
+        {
+          memcpy(op, match, match_length);
+          op += match_length;
+        }
+        else
+        {
+          // Overlapping, so the pattern repeats.
+          while (match_length-- != 0U)
+          {
+            *op++ = *match++;
+          }
+        }
+      }
+
+      if (result.success())
+      {
+        result.read = length;
+      }
+
+      result.written = static_cast<size_t>(op - p_destination);
+
+      return result;
+    }
+  }
+
+  //***************************************************************************
+  /// Decompresses an LZ4 block into the destination.
+  /// Malformed input is detected and never reads or writes out of bounds.
+  ///\ingroup lz4
+  //***************************************************************************
+  inline etl::lz4_result lz4_decompress(etl::span<const uint8_t> source, etl::span<uint8_t> destination)
+  {
+    return private_lz4::decompress(source.data(), source.size(), destination.data(), destination.size());
+  }
+
+  //***************************************************************************
+  /// Decompresses an LZ4 block into the destination.
+  ///\ingroup lz4
+  //***************************************************************************
+  inline etl::lz4_result lz4_decompress(etl::span<const char> source, etl::span<char> destination)
+  {
+    return private_lz4::decompress(reinterpret_cast<const uint8_t*>(source.data()), source.size(),
+                                   reinterpret_cast<uint8_t*>(destination.data()), destination.size());
+  }
+
+  //***************************************************************************
+  /// Decompresses an LZ4 block into the free space of the writer.
+  /// The writer is advanced past the decompressed data if it fits.
+  ///\ingroup lz4
+  //***************************************************************************
+  inline etl::lz4_result lz4_decompress(etl::span<const uint8_t> source, etl::byte_stream_writer& writer)
+  {
+    etl::span<char> free_data = writer.free_data();
+
+    etl::lz4_result result = private_lz4::decompress(source.data(), source.size(),
+                                                     reinterpret_cast<uint8_t*>(free_data.data()), free_data.size());
+
+    if (result.success())
+    {
+      writer.skip<char>(result.written);
+    }
+
+    return result;
+  }
+}
+
+#endif
@@ -447,6 +447,125 @@ namespace etl
       swap->weight = detached->weight;
     }
 
+    //*************************************************************************
+    /// Updates the weights from the balance node to the parent of the
+    /// replacement node, then swaps the found node with the replacement.
+    /// Uses only the node links, so is shared by all key and value types.
+    //*************************************************************************
+    void rebalance_and_detach(Node* found, Node* found_parent, Node* replace_parent, Node* balance, Node* balance_parent)
+    {
+      // Step 2: Update weights from critical node to replacement parent node
+      while (balance)
+      {
+        if (balance->children[balance->dir] == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        if (balance->weight == kNeither)
+        {
+          balance->weight = 1 - balance->dir;
+        }
+        else if (balance->weight == balance->dir)
+        {
+          balance->weight = kNeither;
+        }
+        else
+        {
+          int weight = balance->children[1 - balance->dir]->weight;
+          // Perform a 3 node rotation if weight is same as balance->dir
+          if (weight == balance->dir)
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance_parent == ETL_NULLPTR)
+            {
+              rotate_3node(root_node, 1 - balance->dir,
+                balance->children[1 - balance->dir]->children[balance->dir]->weight);
+            }
+            else
+            {
+              rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
+                balance->children[1 - balance->dir]->children[balance->dir]->weight);
+            }
+          }
+          // Already balanced, rebalance and make it heavy in opposite
+          // direction of the node being removed
+          else if (weight == kNeither)
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance_parent == ETL_NULLPTR)
+            {
+              rotate_2node(root_node, 1 - balance->dir);
+              root_node->weight = balance->dir;
+            }
+            else
+            {
+              rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
+              balance_parent->children[balance_parent->dir]->weight = balance->dir;
+            }
+            // Update balance node weight in opposite direction of node removed
+            balance->weight = 1 - balance->dir;
+          }
+          // Rebalance and leave it balanced
+          else
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance_parent == ETL_NULLPTR)
+            {
+              rotate_2node(root_node, 1 - balance->dir);
+            }
+            else
+            {
+              rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
+            }
+          }
+
+          // Is balance node the same as the target node found? then update
+          // its parent after the rotation performed above
+          if (balance == found)
+          {
+            if (balance_parent)
+            {
+              found_parent = balance_parent->children[balance_parent->dir];
+              // Update dir since it is likely stale
+              found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
+            }
+            else
+            {
+              found_parent = root_node;
+              root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
+            }
+          }
+        }
+
+        // Next balance node to consider
+        balance_parent = balance;
+        balance = balance->children[balance->dir];
+      } // while(balance)
+
+      // Step 3: Swap found node with replacement node
+      if (found_parent)
+      {
+        // Handle traditional case
+        detach_node(found_parent->children[found_parent->dir],
+          replace_parent->children[replace_parent->dir]);
+      }
+      // Handle root node removal
+      else
+      {
+        // Valid replacement node for root node being removed?
+        if (replace_parent)
+        {
+          detach_node(root_node, replace_parent->children[replace_parent->dir]);
+        }
+        else
+        {
+          // Target node and replacement node are both root node
+          detach_node(root_node, root_node);
+        }
+      }
+    }
+
     size_type current_size;   ///< The number of the used nodes.
     const size_type CAPACITY; ///< The maximum size of the map.
     Node* root_node;          ///< The node that acts as the map root.
@@ -1055,6 +1174,24 @@ namespace etl
       initialise();
     }
 
+    //*************************************************************************
+    /// Clears the map incrementally.
+    /// Erases up to 'budget' elements from the front, so that clearing a large
+    /// map may be spread over several calls. Each erase is O(log N).
+    ///\param budget The maximum number of elements to erase.
+    ///\return <b>true</b> if the map is now empty.
+    //*************************************************************************
+    bool clear_some(size_t budget)
+    {
+      while ((budget != 0U) && !empty())
+      {
+        erase(cbegin());
+        --budget;
+      }
+
+      return empty();
+    }
+
     //*********************************************************************
     /// Counts the number of elements that contain the key specified.
     ///\param key The key to search for.
@@ -1432,6 +1569,16 @@ namespace etl
     }
 #endif
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Returns the usage statistics of the node pool.
+    //*************************************************************************
+    const etl::pool_statistics& get_pool_statistics() const
+    {
+      return p_node_pool->get_statistics();
+    }
+#endif
+
     //*************************************************************************
     /// How to compare two key elements.
     //*************************************************************************
@@ -2318,116 +2465,8 @@ namespace etl
       // If target node was found, proceed with rebalancing and replacement
       if (found)
       {
-        // Step 2: Update weights from critical node to replacement parent node
-        while (balance)
-        {
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
-
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-                balance_parent->children[balance_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-              }
-            }
-
-            // Is balance node the same as the target node found? then update
-            // its parent after the rotation performed above
-            if (balance == found)
-            {
-              if (balance_parent)
-              {
-                found_parent = balance_parent->children[balance_parent->dir];
-                // Update dir since it is likely stale
-                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
-              }
-              else
-              {
-                found_parent = root_node;
-                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
-              }
-            }
-          }
-
-          // Next balance node to consider
-          balance_parent = balance;
-          balance = balance->children[balance->dir];
-        } // while(balance)
-
-          // Step 3: Swap found node with replacement node
-        if (found_parent)
-        {
-          // Handle traditional case
-          detach_node(found_parent->children[found_parent->dir],
-            replace_parent->children[replace_parent->dir]);
-        }
-        // Handle root node removal
-        else
-        {
-          // Valid replacement node for root node being removed?
-          if (replace_parent)
-          {
-            detach_node(root_node, replace_parent->children[replace_parent->dir]);
-          }
-          else
-          {
-            // Target node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
-        }
+        // Steps 2 and 3: Update the weights and swap found with the replacement
+        rebalance_and_detach(found, found_parent, replace_parent, balance, balance_parent);
 
         // Downcast found into data node
         Data_Node& found_data_node = imap::data_cast(*found);
@@ -2514,116 +2553,8 @@ namespace etl
       // If target node was found, proceed with rebalancing and replacement
       if (found)
       {
-        // Step 2: Update weights from critical node to replacement parent node
-        while (balance)
-        {
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
-
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-                balance_parent->children[balance_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-              }
-            }
-
-            // Is balance node the same as the target node found? then update
-            // its parent after the rotation performed above
-            if (balance == found)
-            {
-              if (balance_parent)
-              {
-                found_parent = balance_parent->children[balance_parent->dir];
-                // Update dir since it is likely stale
-                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
-              }
-              else
-              {
-                found_parent = root_node;
-                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
-              }
-            }
-          }
-
-          // Next balance node to consider
-          balance_parent = balance;
-          balance = balance->children[balance->dir];
-        } // while(balance)
-
-          // Step 3: Swap found node with replacement node
-        if (found_parent)
-        {
-          // Handle traditional case
-          detach_node(found_parent->children[found_parent->dir],
-            replace_parent->children[replace_parent->dir]);
-        }
-        // Handle root node removal
-        else
-        {
-          // Valid replacement node for root node being removed?
-          if (replace_parent)
-          {
-            detach_node(root_node, replace_parent->children[replace_parent->dir]);
-          }
-          else
-          {
-            // Target node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
-        }
+        // Steps 2 and 3: Update the weights and swap found with the replacement
+        rebalance_and_detach(found, found_parent, replace_parent, balance, balance_parent);
 
         // Downcast found into data node
         Data_Node& found_data_node = imap::data_cast(*found);
@@ -43,6 +43,10 @@ SOFTWARE.
 
 #include "limits.h"
 #include "type_traits.h"
+#include "integral_limits.h"
+#include "binary.h"
+
+#include <stdint.h>
 
 namespace etl
 {
@@ -151,6 +155,176 @@ namespace etl
     return value1 == value2;
   }
 #include "private/diagnostic_pop.h"
+
+  namespace private_math
+  {
+    //*************************************************************************
+    /// The type that integral calculations are done in.
+    /// Unsigned, and at least as wide as unsigned int, so that small types
+    /// are not promoted to int.
+    //*************************************************************************
+    template <typename T>
+    struct work_type
+    {
+      typedef typename etl::make_unsigned<T>::type unsigned_type;
+
+      typedef typename etl::conditional<(sizeof(unsigned_type) < sizeof(unsigned int)), unsigned int, unsigned_type>::type type;
+    };
+
+    //*************************************************************************
+    /// The number of bits needed to represent a non-zero value.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    uint_least8_t bit_width(T value)
+    {
+      return static_cast<uint_least8_t>(etl::integral_limits<T>::bits - etl::count_leading_zeros(value));
+    }
+
+    //*************************************************************************
+    /// The powers of ten that fit in 32 and 64 bits.
+    //*************************************************************************
+    inline uint32_t power_of_10(uint32_t, uint_least8_t i)
+    {
+      static const uint32_t powers[] =
+      {
+        1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+      };
+
+      return powers[i];
+    }
+
+#if ETL_USING_64BIT_TYPES
+    inline uint64_t power_of_10(uint64_t, uint_least8_t i)
+    {
+      static const uint64_t powers[] =
+      {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+        10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+        1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+        10000000000000000000ULL
+      };
+
+      return powers[i];
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Integral square root, rounded down.
+  /// Newton's method, from a first guess above the root set from the count of
+  /// leading zeros. Takes at most a few divisions.
+  /// Returns 0 for negative values.
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_integral<T>::value, T>::type
+    isqrt(T value)
+  {
+    typedef typename private_math::work_type<T>::type work_t;
+
+    if (value <= T(0))
+    {
+      return T(0);
+    }
+
+    const work_t n = static_cast<work_t>(value);
+
+    work_t root = work_t(1U) << ((private_math::bit_width(n) + 1U) / 2U);
+    work_t next = (root + (n / root)) >> 1U;
+
+    while (next < root)
+    {
+      root = next;
+      next = (root + (n / root)) >> 1U;
+    }
+
+    return static_cast<T>(root);
+  }
+
+  //***************************************************************************
+  /// Integral base 2 log, rounded down.
+  /// Returns 0 for values less than 1.
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_integral<T>::value, uint_least8_t>::type
+    ilog2(T value)
+  {
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    if (value <= T(0))
+    {
+      return 0U;
+    }
+
+    return static_cast<uint_least8_t>(private_math::bit_width(static_cast<unsigned_t>(value)) - 1U);
+  }
+
+  //***************************************************************************
+  /// Integral base 10 log, rounded down.
+  /// Estimates the log from the base 2 log, then corrects it with a single
+  /// compare against a table of powers of ten.
+  /// Returns 0 for values less than 1.
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD
+  typename etl::enable_if<etl::is_integral<T>::value, uint_least8_t>::type
+    ilog10(T value)
+  {
+#if ETL_USING_64BIT_TYPES
+    typedef typename etl::conditional<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>::type table_t;
+#else
+    typedef uint32_t table_t;
+#endif
+
+    if (value <= T(0))
+    {
+      return 0U;
+    }
+
+    const table_t n = static_cast<table_t>(value);
+
+    // 1233 / 4096 is just above log10(2).
+    const uint_least8_t estimate = static_cast<uint_least8_t>((private_math::bit_width(n) * 1233U) >> 12U);
+
+    return static_cast<uint_least8_t>(estimate - ((n < private_math::power_of_10(table_t(), estimate)) ? 1U : 0U));
+  }
+
+  //***************************************************************************
+  /// Integral power, by repeated squaring.
+  /// Takes one or two multiplies for each bit of the exponent.
+  /// Powers of two are a shift.
+  /// The result wraps, as for multiplication of unsigned types.
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_integral<T>::value, T>::type
+    ipow(T base, unsigned int exponent)
+  {
+    typedef typename private_math::work_type<T>::type work_t;
+
+    if (base == T(2))
+    {
+      return (exponent < etl::integral_limits<T>::bits) ? static_cast<T>(work_t(1U) << exponent) : T(0);
+    }
+
+    work_t b      = static_cast<work_t>(base);
+    work_t result = 1U;
+
+    while (exponent != 0U)
+    {
+      if ((exponent & 1U) != 0U)
+      {
+        result *= b;
+      }
+
+      exponent >>= 1U;
+      b *= b;
+    }
+
+    return static_cast<T>(result);
+  }
 }
 
 #endif
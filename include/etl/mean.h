@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_sums.h"
 
 //#include <math.h>
 #include <stdint.h>
@@ -107,7 +109,12 @@ namespace etl
     //*********************************
     void add(TInput value)
     {
-      sum += TCalc(value);
+      if (counter == 0U)
+      {
+        shift = private_statistics::get_shift<calc_t>(value);
+      }
+
+      sum += calc_t(value) - shift;
       ++counter;
       recalculate = true;
     }
@@ -125,6 +132,27 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a span of values.
+    /// Faster than adding the values one at a time.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      if (values.empty())
+      {
+        return;
+      }
+
+      if (counter == 0U)
+      {
+        shift = private_statistics::get_shift<calc_t>(values[0]);
+      }
+
+      private_statistics::accumulate_sum(values.data(), values.size(), shift, sum);
+      counter += uint32_t(values.size());
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -144,6 +172,15 @@ namespace etl
       add(first, last);
     }
 
+    //*********************************
+    /// operator ()
+    /// Add a span of values.
+    //*********************************
+    void operator ()(etl::span<const TInput> values)
+    {
+      add(values);
+    }
+
     //*********************************
     /// Get the mean.
     //*********************************
@@ -156,7 +193,7 @@ namespace etl
         if (counter != 0)
         {
           double n = double(counter);
-          mean_value = sum / n;
+          mean_value = double(shift) + (sum / n);
         }
 
         recalculate = false;
@@ -187,6 +224,7 @@ namespace etl
     void clear()
     {
       sum         = calc_t(0);
+      shift       = calc_t(0);
       counter     = 0U;
       mean_value  = 0.0;
       recalculate = true;
@@ -195,6 +233,7 @@ namespace etl
   private:
 
     calc_t   sum;
+    calc_t   shift;
     uint32_t counter;
     mutable double mean_value;
     mutable bool   recalculate;
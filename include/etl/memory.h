@@ -2268,9 +2268,9 @@ namespace etl
   typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TPointer>::value_type>::value, TPointer>::type
     mem_copy(const TPointer sb, const TPointer se, TPointer db) ETL_NOEXCEPT
   {
-    return reinterpret_cast<TPointer>(memcpy(reinterpret_cast<void*>(db),
-                                             reinterpret_cast<void*>(sb),
-                                             sizeof(typename etl::iterator_traits<TPointer>::value_type) * static_cast<size_t>(se - sb)));
+    return reinterpret_cast<TPointer>(ETL_MEMCPY(reinterpret_cast<void*>(db),
+                                                 reinterpret_cast<void*>(sb),
+                                                 sizeof(typename etl::iterator_traits<TPointer>::value_type) * static_cast<size_t>(se - sb)));
   }
 
   //***************************************************************************
@@ -2284,9 +2284,9 @@ namespace etl
   typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TPointer>::value_type>::value, TPointer>::type
     mem_copy(const TPointer sb, size_t n, TPointer db) ETL_NOEXCEPT
   {
-    return reinterpret_cast<TPointer>(memcpy(reinterpret_cast<void*>(db),
-                                             reinterpret_cast<void*>(sb),
-                                             sizeof(typename etl::iterator_traits<TPointer>::value_type) * n));
+    return reinterpret_cast<TPointer>(ETL_MEMCPY(reinterpret_cast<void*>(db),
+                                                 reinterpret_cast<void*>(sb),
+                                                 sizeof(typename etl::iterator_traits<TPointer>::value_type) * n));
   }
 
   //***************************************************************************
@@ -2300,9 +2300,9 @@ namespace etl
   typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TPointer>::value_type>::value, TPointer>::type
     mem_move(const TPointer sb, const TPointer se, TPointer db) ETL_NOEXCEPT
   {
-    return reinterpret_cast<TPointer>(memmove(reinterpret_cast<void*>(db),
-                                              reinterpret_cast<void*>(sb),
-                                              sizeof(typename etl::iterator_traits<TPointer>::value_type) * static_cast<size_t>(se - sb)));
+    return reinterpret_cast<TPointer>(ETL_MEMMOVE(reinterpret_cast<void*>(db),
+                                                  reinterpret_cast<void*>(sb),
+                                                  sizeof(typename etl::iterator_traits<TPointer>::value_type) * static_cast<size_t>(se - sb)));
   }
 
   //***************************************************************************
@@ -2316,9 +2316,32 @@ namespace etl
   typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TPointer>::value_type>::value, TPointer>::type
     mem_move(const TPointer sb, size_t n, TPointer db) ETL_NOEXCEPT
   {
-    return reinterpret_cast<TPointer>(memmove(reinterpret_cast<void*>(db),
-                                              reinterpret_cast<void*>(sb),
-                                              sizeof(typename etl::iterator_traits<TPointer>::value_type) * n));
+    return reinterpret_cast<TPointer>(ETL_MEMMOVE(reinterpret_cast<void*>(db),
+                                                  reinterpret_cast<void*>(sb),
+                                                  sizeof(typename etl::iterator_traits<TPointer>::value_type) * n));
+  }
+
+  //***************************************************************************
+  /// Relocates the objects in [sb, se) to db, leaving the source as raw memory.
+  /// The same as move constructing each object at its new address and then
+  /// destroying the original, but by memmove. The ranges may overlap.
+  /// Type must be trivially relocatable. See etl::is_trivially_relocatable.
+  /// \param source begin
+  /// \param source end
+  /// \param destination begin
+  /// \return The end of the destination range.
+  //***************************************************************************
+  template <typename T>
+  T* trivially_relocate(T* sb, T* se, T* db) ETL_NOEXCEPT
+  {
+    const size_t n = static_cast<size_t>(se - sb);
+
+    if (n != 0U)
+    {
+      ETL_MEMMOVE(static_cast<void*>(db), static_cast<const void*>(sb), sizeof(T) * n);
+    }
+
+    return db + n;
   }
 
   //***************************************************************************
@@ -2370,9 +2393,9 @@ namespace etl
   typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TPointer>::value_type>::value, TPointer>::type
     mem_set(TPointer db, const TPointer de, T value) ETL_NOEXCEPT
   {
-    return reinterpret_cast<TPointer>(memset(reinterpret_cast<void*>(db),
-                                             static_cast<char>(value),
-                                             sizeof(typename etl::iterator_traits<TPointer>::value_type) * static_cast<size_t>(de - db)));
+    return reinterpret_cast<TPointer>(ETL_MEMSET(reinterpret_cast<void*>(db),
+                                                 static_cast<char>(value),
+                                                 sizeof(typename etl::iterator_traits<TPointer>::value_type) * static_cast<size_t>(de - db)));
   }
 
   //***************************************************************************
@@ -2386,9 +2409,9 @@ namespace etl
   typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TPointer>::value_type>::value, TPointer>::type
     mem_set(const TPointer db, size_t n, T value) ETL_NOEXCEPT
   {
-    return reinterpret_cast<TPointer>(memset(reinterpret_cast<void*>(db),
-                                             static_cast<char>(value),
-                                             sizeof(typename etl::iterator_traits<TPointer>::value_type) * n));
+    return reinterpret_cast<TPointer>(ETL_MEMSET(reinterpret_cast<void*>(db),
+                                                 static_cast<char>(value),
+                                                 sizeof(typename etl::iterator_traits<TPointer>::value_type) * n));
   }
 
   //***************************************************************************
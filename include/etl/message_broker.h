@@ -35,11 +35,42 @@ SOFTWARE.
 #include "message.h"
 #include "message_router.h"
 #include "span.h"
+#include "algorithm.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
 
 #include <stdint.h>
 
 namespace etl
 {
+  //***************************************************************************
+  /// Base exception class for message broker
+  //***************************************************************************
+  class message_broker_exception : public etl::exception
+  {
+  public:
+
+    message_broker_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The subscription index is full.
+  //***************************************************************************
+  class message_broker_index_full : public etl::message_broker_exception
+  {
+  public:
+
+    message_broker_index_full(string_type file_name_, numeric_type line_number_)
+      : message_broker_exception(ETL_ERROR_TEXT("message broker:index full", ETL_MESSAGE_BROKER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Message broker
   //***************************************************************************
@@ -136,6 +167,11 @@ namespace etl
     message_broker()
       : imessage_router(etl::imessage_router::MESSAGE_BROKER)
       , head()
+      , p_index_offsets(ETL_NULLPTR)
+      , p_index_entries(ETL_NULLPTR)
+      , index_size(0U)
+      , index_capacity(0U)
+      , index_valid(false)
     {
     }
 
@@ -145,6 +181,11 @@ namespace etl
     message_broker(etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_BROKER, successor_)
       , head()
+      , p_index_offsets(ETL_NULLPTR)
+      , p_index_entries(ETL_NULLPTR)
+      , index_size(0U)
+      , index_capacity(0U)
+      , index_valid(false)
     {
     }
 
@@ -154,6 +195,11 @@ namespace etl
     message_broker(etl::message_router_id_t id_)
       : imessage_router(id_)
       , head()
+      , p_index_offsets(ETL_NULLPTR)
+      , p_index_entries(ETL_NULLPTR)
+      , index_size(0U)
+      , index_capacity(0U)
+      , index_valid(false)
     {
       ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
     }
@@ -164,6 +210,11 @@ namespace etl
     message_broker(etl::message_router_id_t id_, etl::imessage_router& successor_)
       : imessage_router(id_, successor_)
       , head()
+      , p_index_offsets(ETL_NULLPTR)
+      , p_index_entries(ETL_NULLPTR)
+      , index_size(0U)
+      , index_capacity(0U)
+      , index_valid(false)
     {
       ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
     }
@@ -174,12 +225,14 @@ namespace etl
     void subscribe(etl::message_broker::subscription& new_sub)
     {
       initialise_insertion_point(new_sub.get_router(), &new_sub);
+      rebuild_index();
     }
 
     //*******************************************
     void unsubscribe(etl::imessage_router& router)
     {
       initialise_insertion_point(&router, ETL_NULLPTR);
+      rebuild_index();
     }
 
     //*******************************************
@@ -190,7 +243,7 @@ namespace etl
 
     virtual void receive(etl::shared_message shared_msg) ETL_OVERRIDE
     {
-      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, etl::shared_message::borrow(shared_msg));
     }
 
     //*******************************************
@@ -199,7 +252,15 @@ namespace etl
     {
       const etl::message_id_t id = msg.get_message_id();
 
-      if (!empty())
+      if (is_indexed(id))
+      {
+        // Only visit the subscriptions in the index for this id.
+        for (size_t i = p_index_offsets[id]; i < p_index_offsets[id + 1U]; ++i)
+        {
+          deliver(*p_index_entries[i], destination_router_id, msg);
+        }
+      }
+      else if (!empty())
       {
         // Scan the subscription lists.
         subscription* sub = static_cast<subscription*>(head.get_next());
@@ -212,13 +273,7 @@ namespace etl
 
           if (itr != message_ids.end())
           {
-            etl::imessage_router* router = sub->get_router();
-
-            if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
-                destination_router_id == router->get_message_router_id())
-            {
-              router->receive(msg);
-            }
+            deliver(*sub, destination_router_id, msg);
           }
 
           sub = sub->next_subscription();
@@ -238,7 +293,15 @@ namespace etl
     {
       const etl::message_id_t id = shared_msg.get_message().get_message_id();
 
-      if (!empty())
+      if (is_indexed(id))
+      {
+        // Only visit the subscriptions in the index for this id.
+        for (size_t i = p_index_offsets[id]; i < p_index_offsets[id + 1U]; ++i)
+        {
+          deliver(*p_index_entries[i], destination_router_id, shared_msg);
+        }
+      }
+      else if (!empty())
       {
         // Scan the subscription lists.
         subscription* sub = static_cast<subscription*>(head.get_next());
@@ -251,13 +314,7 @@ namespace etl
 
           if (itr != message_ids.end())
           {
-            etl::imessage_router* router = sub->get_router();
-
-            if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
-                destination_router_id == router->get_message_router_id())
-            {
-              router->receive(shared_msg);
-            }
+            deliver(*sub, destination_router_id, shared_msg);
           }
 
           sub = sub->next_subscription();
@@ -267,7 +324,7 @@ namespace etl
       // Always pass the message on to a successor.
       if (has_successor())
       {
-        get_successor().receive(destination_router_id, shared_msg);
+        get_successor().receive(destination_router_id, etl::shared_message::borrow(shared_msg));
       }
     }
 
@@ -279,7 +336,17 @@ namespace etl
     //*******************************************
     virtual bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      if (!empty())
+      if (is_indexed(id))
+      {
+        for (size_t i = p_index_offsets[id]; i < p_index_offsets[id + 1U]; ++i)
+        {
+          if (p_index_entries[i]->get_router()->accepts(id))
+          {
+            return true;
+          }
+        }
+      }
+      else if (!empty())
       {
         // Scan the subscription lists.
         subscription* sub = static_cast<subscription*>(head.get_next());
@@ -322,6 +389,82 @@ namespace etl
     void clear()
     {
       head.terminate();
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Rebuilds the subscription index, if the broker has one.
+    /// Called automatically on subscribe and unsubscribe.
+    /// If the index is too small for the subscriptions, the broker asserts
+    /// and falls back to scanning the subscriptions.
+    //*******************************************
+    void rebuild_index()
+    {
+      if (p_index_offsets == ETL_NULLPTR)
+      {
+        return;
+      }
+
+      // Count the subscriptions for each id, in the slot after the id.
+      for (size_t i = 0U; i <= index_size; ++i)
+      {
+        p_index_offsets[i] = 0U;
+      }
+
+      size_t total = 0U;
+
+      for (subscription* sub = static_cast<subscription*>(head.get_next()); sub != ETL_NULLPTR; sub = sub->next_subscription())
+      {
+        message_id_span_t message_ids = sub->message_id_list();
+
+        for (size_t i = 0U; i < message_ids.size(); ++i)
+        {
+          if (is_new_index_entry(message_ids, i))
+          {
+            ++p_index_offsets[message_ids[i] + 1U];
+            ++total;
+          }
+        }
+      }
+
+      if (total > index_capacity)
+      {
+        // Disable the index.
+        p_index_offsets[index_size] = 0U;
+        index_valid = false;
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::message_broker_index_full));
+        return;
+      }
+
+      // Convert the counts to the start of each id's entries.
+      for (size_t i = 1U; i <= index_size; ++i)
+      {
+        p_index_offsets[i] += p_index_offsets[i - 1U];
+      }
+
+      // Fill in the entries, in subscription order.
+      // This moves each offset on to the start of the next id.
+      for (subscription* sub = static_cast<subscription*>(head.get_next()); sub != ETL_NULLPTR; sub = sub->next_subscription())
+      {
+        message_id_span_t message_ids = sub->message_id_list();
+
+        for (size_t i = 0U; i < message_ids.size(); ++i)
+        {
+          if (is_new_index_entry(message_ids, i))
+          {
+            p_index_entries[p_index_offsets[message_ids[i]]++] = sub;
+          }
+        }
+      }
+
+      // Move the offsets back to the start of each id.
+      for (size_t i = index_size - 1U; i != 0U; --i)
+      {
+        p_index_offsets[i] = p_index_offsets[i - 1U];
+      }
+
+      p_index_offsets[0] = 0U;
+      index_valid = true;
     }
 
     //********************************************
@@ -348,8 +491,112 @@ namespace etl
       return head.get_next() == ETL_NULLPTR;
     }
 
+  protected:
+
+    typedef uint_least16_t index_offset_t;
+
+    //*******************************************
+    /// Constructor, with a subscription index.
+    /// 'p_index_offsets_' has 'index_size_' + 1 elements.
+    /// 'p_index_entries_' has 'index_capacity_' elements.
+    //*******************************************
+    message_broker(index_offset_t* p_index_offsets_, subscription** p_index_entries_, size_t index_size_, size_t index_capacity_)
+      : imessage_router(etl::imessage_router::MESSAGE_BROKER)
+      , head()
+      , p_index_offsets(p_index_offsets_)
+      , p_index_entries(p_index_entries_)
+      , index_size(index_size_)
+      , index_capacity(index_capacity_)
+      , index_valid(false)
+    {
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Constructor, with a subscription index.
+    //*******************************************
+    message_broker(index_offset_t* p_index_offsets_, subscription** p_index_entries_, size_t index_size_, size_t index_capacity_, etl::imessage_router& successor_)
+      : imessage_router(etl::imessage_router::MESSAGE_BROKER, successor_)
+      , head()
+      , p_index_offsets(p_index_offsets_)
+      , p_index_entries(p_index_entries_)
+      , index_size(index_size_)
+      , index_capacity(index_capacity_)
+      , index_valid(false)
+    {
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Constructor, with a subscription index.
+    //*******************************************
+    message_broker(index_offset_t* p_index_offsets_, subscription** p_index_entries_, size_t index_size_, size_t index_capacity_, etl::message_router_id_t id_)
+      : imessage_router(id_)
+      , head()
+      , p_index_offsets(p_index_offsets_)
+      , p_index_entries(p_index_entries_)
+      , index_size(index_size_)
+      , index_capacity(index_capacity_)
+      , index_valid(false)
+    {
+      ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Constructor, with a subscription index.
+    //*******************************************
+    message_broker(index_offset_t* p_index_offsets_, subscription** p_index_entries_, size_t index_size_, size_t index_capacity_, etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : imessage_router(id_, successor_)
+      , head()
+      , p_index_offsets(p_index_offsets_)
+      , p_index_entries(p_index_entries_)
+      , index_size(index_size_)
+      , index_capacity(index_capacity_)
+      , index_valid(false)
+    {
+      ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
+      rebuild_index();
+    }
+
   private:
 
+    //*******************************************
+    /// Is the message id covered by the index?
+    //*******************************************
+    bool is_indexed(etl::message_id_t id) const
+    {
+      return index_valid && (size_t(id) < index_size);
+    }
+
+    //*******************************************
+    /// Is the id at 'index' in the index, and not a repeat within the list?
+    //*******************************************
+    bool is_new_index_entry(const message_id_span_t& message_ids, size_t index) const
+    {
+      if (size_t(message_ids[index]) >= index_size)
+      {
+        return false;
+      }
+
+      return etl::find(message_ids.begin(), message_ids.begin() + index, message_ids[index]) == (message_ids.begin() + index);
+    }
+
+    //*******************************************
+    /// Sends the message to the subscription's router, if it is a destination.
+    //*******************************************
+    template <typename TMessage>
+    static void deliver(const subscription& sub, etl::message_router_id_t destination_router_id, TMessage& msg)
+    {
+      etl::imessage_router* router = sub.get_router();
+
+      if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
+          destination_router_id == router->get_message_router_id())
+      {
+        router->receive(private_shared_message::lend(msg));
+      }
+    }
+
     //*******************************************
     void initialise_insertion_point(const etl::imessage_router* p_router, etl::message_broker::subscription* p_new_sub)
     {
@@ -384,6 +631,66 @@ namespace etl
     }
 
     subscription_node head;
+
+    index_offset_t* p_index_offsets; ///< The start of each id's entries, or ETL_NULLPTR.
+    subscription**  p_index_entries; ///< The subscriptions, grouped by id.
+    size_t          index_size;      ///< The number of message ids in the index.
+    size_t          index_capacity;  ///< The maximum number of entries.
+    bool            index_valid;     ///< False if the entries did not fit.
+  };
+
+  //***************************************************************************
+  /// A message broker with a subscription index.
+  /// For each message id below NUMBER_OF_IDS_, the broker keeps the list of
+  /// subscriptions to it, so that a message only visits those.
+  /// Other ids are delivered as for etl::message_broker.
+  /// MAX_ENTRIES_ is the maximum total number of indexed ids over all
+  /// subscriptions.
+  //***************************************************************************
+  template <size_t NUMBER_OF_IDS_, size_t MAX_ENTRIES_>
+  class indexed_message_broker : public etl::message_broker
+  {
+  public:
+
+    ETL_STATIC_ASSERT(NUMBER_OF_IDS_ > 0U, "NUMBER_OF_IDS_ must not be zero");
+    ETL_STATIC_ASSERT(MAX_ENTRIES_ <= 65535U, "MAX_ENTRIES_ must fit in index_offset_t");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_broker()
+      : message_broker(offsets, entries, NUMBER_OF_IDS_, MAX_ENTRIES_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_broker(etl::imessage_router& successor_)
+      : message_broker(offsets, entries, NUMBER_OF_IDS_, MAX_ENTRIES_, successor_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_broker(etl::message_router_id_t id_)
+      : message_broker(offsets, entries, NUMBER_OF_IDS_, MAX_ENTRIES_, id_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_broker(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : message_broker(offsets, entries, NUMBER_OF_IDS_, MAX_ENTRIES_, id_, successor_)
+    {
+    }
+
+  private:
+
+    index_offset_t offsets[NUMBER_OF_IDS_ + 1U];
+    subscription*  entries[MAX_ENTRIES_ > 0U ? MAX_ENTRIES_ : 1U];
   };
 }
 
@@ -30,6 +30,7 @@ SOFTWARE.
 #define ETL_MESSAGE_BUS_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
 #include "algorithm.h"
 #include "vector.h"
 #include "nullptr.h"
@@ -38,6 +39,8 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "binary.h"
+#include "static_assert.h"
 
 #include <stdint.h>
 
@@ -104,6 +107,7 @@ namespace etl
                                                              compare_router_id());
 
           router_list.insert(irouter, &router);
+          rebuild_index();
         }
       }
 
@@ -127,6 +131,7 @@ namespace etl
                                                                                                     compare_router_id());
 
         router_list.erase(range.first, range.second);
+        rebuild_index();
       }
     }
 
@@ -140,6 +145,7 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+        rebuild_index();
       }
     }
 
@@ -152,34 +158,22 @@ namespace etl
     //*******************************************
     virtual void receive(etl::shared_message   shared_msg) ETL_OVERRIDE
     {
-      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, etl::shared_message::borrow(shared_msg));
     }
 
     //*******************************************
     virtual void receive(etl::message_router_id_t destination_router_id,
                          const etl::imessage&     message) ETL_OVERRIDE
     {
+      ETL_TRACE(etl::trace_event::message_receive, this, message.get_message_id());
+
       switch (destination_router_id)
       {
         //*****************************
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
-          router_list_t::iterator irouter = router_list.begin();
-
-          // Broadcast to everyone.
-          while (irouter != router_list.end())
-          {
-            etl::imessage_router& router = **irouter;
-
-            if (router.accepts(message.get_message_id()))
-            {
-              router.receive(message);
-            }
-
-            ++irouter;
-          }
-
+          broadcast(message.get_message_id(), message);
           break;
         }
 
@@ -244,21 +238,7 @@ namespace etl
         // Broadcast to all routers.
       case etl::imessage_router::ALL_MESSAGE_ROUTERS:
       {
-        router_list_t::iterator irouter = router_list.begin();
-
-        // Broadcast to everyone.
-        while (irouter != router_list.end())
-        {
-          etl::imessage_router& router = **irouter;
-
-          if (router.accepts(shared_msg.get_message().get_message_id()))
-          {
-            router.receive(shared_msg);
-          }
-
-          ++irouter;
-        }
-
+        broadcast(shared_msg.get_message().get_message_id(), shared_msg);
         break;
       }
 
@@ -277,7 +257,7 @@ namespace etl
         {
           if ((*(range.first))->accepts(shared_msg.get_message().get_message_id()))
           {
-            (*(range.first))->receive(shared_msg);
+            (*(range.first))->receive(etl::shared_message::borrow(shared_msg));
           }
 
           ++range.first;
@@ -293,7 +273,7 @@ namespace etl
         while (irouter != router_list.end())
         {
           // So pass it on.
-          (*irouter)->receive(destination_router_id, shared_msg);
+          (*irouter)->receive(destination_router_id, etl::shared_message::borrow(shared_msg));
 
           ++irouter;
         }
@@ -306,11 +286,29 @@ namespace etl
       {
         if (get_successor().accepts(shared_msg.get_message().get_message_id()))
         {
-          get_successor().receive(destination_router_id, shared_msg);
+          get_successor().receive(destination_router_id, etl::shared_message::borrow(shared_msg));
         }
       }
     }
 
+    //*******************************************
+    /// Receives a batch of messages, delivering each in turn.
+    //*******************************************
+    virtual void receive(message_span_t messages) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, messages);
+    }
+
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id,
+                         message_span_t           messages) ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        imessage_bus::receive(destination_router_id, *messages[i]);
+      }
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -319,19 +317,46 @@ namespace etl
     //*******************************************
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      // Check the list of subscribed routers.
-      router_list_t::iterator irouter = router_list.begin();
-
-      while (irouter != router_list.end())
+      if (is_indexed(id))
       {
-        etl::imessage_router& router = **irouter;
+        // Check the routers in the index for this id.
+        const index_element_t* p_row = p_index + (size_t(id) * index_row_size);
 
-        if (router.accepts(id))
+        for (size_t word = 0U; word < index_row_size; ++word)
         {
-          return true;
+          index_element_t bits = p_row[word];
+
+          while (bits != 0U)
+          {
+            const size_t position = (word * Index_Bits) + etl::count_trailing_zeros(bits);
+            bits &= (bits - 1U);
+
+            const etl::imessage_router& router = *router_list[position];
+
+            // Message buses are in every row, so ask them.
+            if (!is_message_bus(router) || router.accepts(id))
+            {
+              return true;
+            }
+          }
         }
+      }
+      else
+      {
+        // Check the list of subscribed routers.
+        router_list_t::iterator irouter = router_list.begin();
+
+        while (irouter != router_list.end())
+        {
+          etl::imessage_router& router = **irouter;
+
+          if (router.accepts(id))
+          {
+            return true;
+          }
 
-        ++irouter;
+          ++irouter;
+        }
       }
 
       // Check any successor.
@@ -356,6 +381,40 @@ namespace etl
     void clear()
     {
       router_list.clear();
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Rebuilds the subscriber index, if the bus has one.
+    /// Called automatically on subscribe and unsubscribe.
+    /// Call if the ids accepted by a subscribed router change.
+    //*******************************************
+    void rebuild_index()
+    {
+      if (p_index != ETL_NULLPTR)
+      {
+        for (size_t i = 0U; i < (index_size * index_row_size); ++i)
+        {
+          p_index[i] = 0U;
+        }
+
+        for (size_t position = 0U; position < router_list.size(); ++position)
+        {
+          const etl::imessage_router& router = *router_list[position];
+
+          const size_t          word = position / Index_Bits;
+          const index_element_t mask = index_element_t(1U) << (position % Index_Bits);
+
+          for (size_t id = 0U; id < index_size; ++id)
+          {
+            // The subscribers of a message bus may change, so it is in every row.
+            if (is_message_bus(router) || router.accepts(etl::message_id_t(id)))
+            {
+              p_index[(id * index_row_size) + word] |= mask;
+            }
+          }
+        }
+      }
     }
 
     //********************************************
@@ -378,12 +437,22 @@ namespace etl
 
   protected:
 
+    typedef uint32_t index_element_t;
+
+    enum
+    {
+      Index_Bits = 32
+    };
+
     //*******************************************
     /// Constructor.
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(ETL_NULLPTR),
+        index_size(0U),
+        index_row_size(0U)
     {
     }
 
@@ -392,12 +461,108 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& router_list_, etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_),
-      router_list(router_list_)
+      router_list(router_list_),
+      p_index(ETL_NULLPTR),
+      index_size(0U),
+      index_row_size(0U)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with a subscriber index.
+    /// The index has a row of 'index_row_size_' elements for each of the
+    /// first 'index_size_' message ids.
+    //*******************************************
+    imessage_bus(router_list_t& list, index_element_t* p_index_, size_t index_size_, size_t index_row_size_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+        router_list(list),
+        p_index(p_index_),
+        index_size(index_size_),
+        index_row_size(index_row_size_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with a subscriber index.
+    //*******************************************
+    imessage_bus(router_list_t& list, index_element_t* p_index_, size_t index_size_, size_t index_row_size_, etl::imessage_router& successor_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_),
+        router_list(list),
+        p_index(p_index_),
+        index_size(index_size_),
+        index_row_size(index_row_size_)
     {
     }
 
   private:
 
+    //*******************************************
+    /// Is the message id covered by the index?
+    //*******************************************
+    bool is_indexed(etl::message_id_t id) const
+    {
+      return size_t(id) < index_size;
+    }
+
+    //*******************************************
+    /// Is the router a message bus?
+    //*******************************************
+    static bool is_message_bus(const etl::imessage_router& router)
+    {
+      return router.get_message_router_id() == etl::imessage_router::MESSAGE_BUS;
+    }
+
+    //*******************************************
+    /// Sends a message to every router that accepts it.
+    /// Shared messages are lent, so the reference count is not changed for
+    /// each router, only by the routers that keep a copy.
+    //*******************************************
+    template <typename TMessage>
+    void broadcast(etl::message_id_t id, TMessage& message)
+    {
+      if (is_indexed(id))
+      {
+        // Only visit the routers in the index for this id.
+        const index_element_t* p_row = p_index + (size_t(id) * index_row_size);
+
+        for (size_t word = 0U; word < index_row_size; ++word)
+        {
+          index_element_t bits = p_row[word];
+
+          while (bits != 0U)
+          {
+            const size_t position = (word * Index_Bits) + etl::count_trailing_zeros(bits);
+            bits &= (bits - 1U);
+
+            etl::imessage_router& router = *router_list[position];
+
+            // Message buses are in every row, so ask them.
+            if (!is_message_bus(router) || router.accepts(id))
+            {
+              router.receive(private_shared_message::lend(message));
+            }
+          }
+        }
+      }
+      else
+      {
+        router_list_t::iterator irouter = router_list.begin();
+
+        // Broadcast to everyone.
+        while (irouter != router_list.end())
+        {
+          etl::imessage_router& router = **irouter;
+
+          if (router.accepts(id))
+          {
+            router.receive(private_shared_message::lend(message));
+          }
+
+          ++irouter;
+        }
+      }
+    }
+
     //*******************************************
     // How to compare routers to router ids.
     //*******************************************
@@ -415,6 +580,10 @@ namespace etl
     };
 
     router_list_t& router_list;
+
+    index_element_t* p_index;        ///< The subscriber index, or ETL_NULLPTR.
+    size_t           index_size;     ///< The number of message ids in the index.
+    size_t           index_row_size; ///< The number of elements in each row of the index.
   };
 
   //***************************************************************************
@@ -445,6 +614,51 @@ namespace etl
 
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
   };
+
+  //***************************************************************************
+  /// A message bus with a subscriber index.
+  /// For each message id below NUMBER_OF_IDS_, the bus keeps a bitmask of the
+  /// subscribers that accept it, so that a broadcast only visits those.
+  /// Other ids are delivered as for etl::message_bus.
+  /// The index is rebuilt on subscribe and unsubscribe. If the ids accepted
+  /// by a subscribed router change, call rebuild_index().
+  //***************************************************************************
+  template <uint_least8_t MAX_ROUTERS_, size_t NUMBER_OF_IDS_>
+  class indexed_message_bus : public etl::imessage_bus
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_ROUTERS_ > 0U, "MAX_ROUTERS_ must not be zero");
+    ETL_STATIC_ASSERT(NUMBER_OF_IDS_ > 0U, "NUMBER_OF_IDS_ must not be zero");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_bus()
+      : imessage_bus(router_list, &index[0][0], NUMBER_OF_IDS_, Row_Size)
+    {
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    indexed_message_bus(etl::imessage_router& successor_)
+      : imessage_bus(router_list, &index[0][0], NUMBER_OF_IDS_, Row_Size, successor_)
+    {
+      rebuild_index();
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Row_Size = (MAX_ROUTERS_ + imessage_bus::Index_Bits - 1U) / imessage_bus::Index_Bits;
+
+    etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    index_element_t index[NUMBER_OF_IDS_][Row_Size];
+  };
+
+  template <uint_least8_t MAX_ROUTERS_, size_t NUMBER_OF_IDS_>
+  ETL_CONSTANT size_t indexed_message_bus<MAX_ROUTERS_, NUMBER_OF_IDS_>::Row_Size;
 }
 
 #endif
@@ -54,6 +54,7 @@ SOFTWARE.
 #include "platform.h"
 #include "message.h"
 #include "shared_message.h"
+#include "span.h"
 #if ETL_HAS_VIRTUAL_MESSAGES
   #include "message_packet.h"
 #endif
@@ -65,6 +66,8 @@ SOFTWARE.
 #include "nullptr.h"
 #include "placement_new.h"
 #include "successor.h"
+#include "trace.h"
+#include "latency_monitor.h"
 #include "type_traits.h"
 
 #include <stdint.h>
@@ -111,6 +114,8 @@ namespace etl
   {
   public:
 
+    typedef etl::span<const etl::imessage* const> message_span_t;
+
     virtual ~imessage_router() {}
     virtual void receive(const etl::imessage&) = 0;
     virtual bool accepts(etl::message_id_t) const = 0;
@@ -138,7 +143,28 @@ namespace etl
     {
       if ((destination_router_id == get_message_router_id()) || (destination_router_id == imessage_router::ALL_MESSAGE_ROUTERS))
       {
-        receive(shared_msg);
+        receive(etl::shared_message::borrow(shared_msg));
+      }
+    }
+
+    //********************************************
+    /// Receives a batch of messages, in order.
+    /// Override to handle the batch in one call.
+    //********************************************
+    virtual void receive(message_span_t messages)
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        receive(*messages[i]);
+      }
+    }
+
+    //********************************************
+    virtual void receive(etl::message_router_id_t destination_router_id, message_span_t messages)
+    {
+      if ((destination_router_id == get_message_router_id()) || (destination_router_id == imessage_router::ALL_MESSAGE_ROUTERS))
+      {
+        receive(messages);
       }
     }
 
@@ -404,6 +430,127 @@ namespace etl
 // For C++17 and above.
 //*************************************************************************************************
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_message_router
+  {
+    //***************************************************************************
+    /// A compile time lookup from message id to handler.
+    /// Uses a jump table indexed by id if the ids are dense enough,
+    /// otherwise a binary search of the sorted ids.
+    /// If an id appears more than once, the first handler is used.
+    //***************************************************************************
+    template <typename THandler, etl::message_id_t... Ids>
+    class message_id_lookup
+    {
+    private:
+
+      //********************************************
+      /// Finds the lowest or highest id.
+      //********************************************
+      static constexpr etl::message_id_t find_id(bool lowest)
+      {
+        const etl::message_id_t ids[] = { Ids... };
+
+        etl::message_id_t result = ids[0];
+
+        for (etl::message_id_t id : ids)
+        {
+          if (lowest ? (id < result) : (id > result))
+          {
+            result = id;
+          }
+        }
+
+        return result;
+      }
+
+    public:
+
+      static constexpr size_t            Number_Of_Ids = sizeof...(Ids);
+      static constexpr etl::message_id_t Min_Id        = find_id(true);
+      static constexpr etl::message_id_t Max_Id        = find_id(false);
+      static constexpr size_t            Range         = size_t(Max_Id - Min_Id) + 1U;
+      static constexpr bool              Is_Dense      = (Range <= (4U * Number_Of_Ids));
+
+      //********************************************
+      constexpr message_id_lookup(const THandler (&handlers_)[Number_Of_Ids])
+        : table()
+        , sorted_ids()
+        , sorted_handlers()
+      {
+        const etl::message_id_t ids[Number_Of_Ids] = { Ids... };
+
+        if constexpr (Is_Dense)
+        {
+          // Fill in reverse, so that the first of any duplicates wins.
+          for (size_t i = Number_Of_Ids; i != 0U; --i)
+          {
+            table[ids[i - 1U] - Min_Id] = handlers_[i - 1U];
+          }
+        }
+        else
+        {
+          // A stable insertion sort, so that the first of any duplicates wins.
+          for (size_t i = 0U; i < Number_Of_Ids; ++i)
+          {
+            size_t j = i;
+
+            while ((j != 0U) && (sorted_ids[j - 1U] > ids[i]))
+            {
+              sorted_ids[j]      = sorted_ids[j - 1U];
+              sorted_handlers[j] = sorted_handlers[j - 1U];
+              --j;
+            }
+
+            sorted_ids[j]      = ids[i];
+            sorted_handlers[j] = handlers_[i];
+          }
+        }
+      }
+
+      //********************************************
+      /// Returns the handler for the id, or ETL_NULLPTR if there is none.
+      //********************************************
+      constexpr THandler find(etl::message_id_t id) const
+      {
+        if constexpr (Is_Dense)
+        {
+          const size_t index = size_t(id) - size_t(Min_Id);
+
+          return ((id >= Min_Id) && (index < Range)) ? table[index] : ETL_NULLPTR;
+        }
+        else
+        {
+          size_t first = 0U;
+          size_t count = Number_Of_Ids;
+
+          // Lower bound.
+          while (count != 0U)
+          {
+            const size_t step = count / 2U;
+
+            if (sorted_ids[first + step] < id)
+            {
+              first += step + 1U;
+              count -= step + 1U;
+            }
+            else
+            {
+              count = step;
+            }
+          }
+
+          return ((first < Number_Of_Ids) && (sorted_ids[first] == id)) ? sorted_handlers[first] : ETL_NULLPTR;
+        }
+      }
+
+    private:
+
+      THandler          table[Is_Dense ? Range : 1U];
+      etl::message_id_t sorted_ids[Is_Dense ? 1U : Number_Of_Ids];
+      THandler          sorted_handlers[Is_Dense ? 1U : Number_Of_Ids];
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
   //***************************************************************************
@@ -447,9 +594,17 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      ETL_TRACE(etl::trace_event::message_receive, this, msg.get_message_id());
+
+      const handler_type handler = find_handler(msg.get_message_id());
 
-      if (!was_handled)
+      if (handler != ETL_NULLPTR)
+      {
+        ETL_LATENCY_SCOPE(etl::latency_domain::message, msg.get_message_id());
+
+        handler(*this, msg);
+      }
+      else
       {
         if (has_successor())
         {
@@ -467,6 +622,9 @@ namespace etl
     {
       if constexpr (etl::is_one_of<TMessage, TMessageTypes...>::value)
       {
+        ETL_TRACE(etl::trace_event::message_receive, this, TMessage::ID);
+        ETL_LATENCY_SCOPE(etl::latency_domain::message, TMessage::ID);
+
         static_cast<TDerived*>(this)->on_receive(msg);
       }
       else
@@ -487,7 +645,12 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if (find_handler(id) != ETL_NULLPTR)
+      {
+        return true;
+      }
+
+      return has_successor() && get_successor().accepts(id);
     }
 
     //********************************************
@@ -510,2261 +673,43 @@ namespace etl
 
   private:
 
+    typedef void (*handler_type)(message_router&, const etl::imessage&);
+
+    //********************************************
+    /// Calls on_receive for the concrete message type.
     //********************************************
     template <typename TMessage>
-    bool receive_message_type(const etl::imessage& msg)
+    static void dispatch(message_router& router, const etl::imessage& msg)
     {
-      if (TMessage::ID == msg.get_message_id())
-      {
-        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
     }
 
     //********************************************
-    template <typename TMessage>
-    bool accepts_type(etl::message_id_t id) const
+    /// Finds the handler for a message id.
+    //********************************************
+    static handler_type find_handler(etl::message_id_t id)
     {
-      if (TMessage::ID == id)
+      if constexpr (sizeof...(TMessageTypes) == 0U)
       {
-        return true;
+        (void)id;
+        return ETL_NULLPTR;
       }
       else
       {
-        if (has_successor())
-        {
-          return get_successor().accepts(id);
-        }
-        else
-        {
-          return false;
-        }
+        static constexpr private_message_router::message_id_lookup<handler_type, TMessageTypes::ID...> lookup({ &dispatch<TMessageTypes>... });
+
+        return lookup.find(id);
       }
     }
   };
-#else
+#endif
+}
+
+#if !ETL_USING_CPP17 || defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
 //*************************************************************************************************
 // For C++14 and below.
 //*************************************************************************************************
-  //***************************************************************************
-  // The definition for all 16 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2 = void, typename T3 = void, typename T4 = void,
-            typename T5 = void, typename T6 = void, typename T7 = void, typename T8 = void,
-            typename T9 = void, typename T10 = void, typename T11 = void, typename T12 = void,
-            typename T13 = void, typename T14 = void, typename T15 = void, typename T16 = void>
-  class message_router  : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15,  T16> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const etl::message_id_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        case T9::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T9&>(msg)); break;
-        case T10::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T10&>(msg)); break;
-        case T11::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T11&>(msg)); break;
-        case T12::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T12&>(msg)); break;
-        case T13::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T13&>(msg)); break;
-        case T14::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T14&>(msg)); break;
-        case T15::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T15&>(msg)); break;
-        case T16::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T16&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: case T14::ID: case T15::ID: case T16::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 15 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12,
-            typename T13, typename T14, typename T15>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14,  T15> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        case T9::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T9&>(msg)); break;
-        case T10::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T10&>(msg)); break;
-        case T11::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T11&>(msg)); break;
-        case T12::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T12&>(msg)); break;
-        case T13::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T13&>(msg)); break;
-        case T14::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T14&>(msg)); break;
-        case T15::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T15&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: case T14::ID: case T15::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 14 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12,
-            typename T13, typename T14>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13,  T14> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        case T9::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T9&>(msg)); break;
-        case T10::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T10&>(msg)); break;
-        case T11::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T11&>(msg)); break;
-        case T12::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T12&>(msg)); break;
-        case T13::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T13&>(msg)); break;
-        case T14::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T14&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: case T14::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 13 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12,
-            typename T13>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12,  T13> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        case T9::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T9&>(msg)); break;
-        case T10::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T10&>(msg)); break;
-        case T11::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T11&>(msg)); break;
-        case T12::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T12&>(msg)); break;
-        case T13::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T13&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 12 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11, typename T12>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11,  T12> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        case T9::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T9&>(msg)); break;
-        case T10::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T10&>(msg)); break;
-        case T11::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T11&>(msg)); break;
-        case T12::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T12&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 11 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10, typename T11>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10,  T11> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        case T9::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T9&>(msg)); break;
-        case T10::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T10&>(msg)); break;
-        case T11::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T11&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-        case T9::ID: case T10::ID: case T11::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 10 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9, typename T10>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9,  T10> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        case T9::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T9&>(msg)); break;
-        case T10::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T10&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-        case T9::ID: case T10::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 9 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8,
-            typename T9>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, T8, T9, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7, T8,  T9> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        case T9::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T9&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-        case T9::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 8 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7, typename T8>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, T8, void, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6, T7,  T8> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        case T8::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T8&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID:
-
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 7 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6, typename T7>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, T7, void, void, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5, T6,  T7> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        case T7::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T7&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 6 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5, typename T6>
-  class message_router<TDerived, T1, T2, T3, T4, T5, T6, void, void, void, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4, T5,  T6> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        case T6::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T6&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 5 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4,
-            typename T5>
-  class message_router<TDerived, T1, T2, T3, T4, T5, void, void, void, void, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3, T4,  T5> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        case T5::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T5&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 4 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3, typename T4>
-  class message_router<TDerived, T1, T2, T3, T4, void, void, void, void, void, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2, T3,  T4> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        case T4::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T4&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3, T4>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 3 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2, typename T3>
-  class message_router<TDerived, T1, T2, T3, void, void, void, void, void, void, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1, T2,  T3> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        case T3::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T3&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2, T3>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 2 message types.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1, typename T2>
-  class message_router<TDerived, T1, T2, void, void, void, void, void, void, void, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet<T1,  T2> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        case T2::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T2&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1, T2>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1, T2>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID: case T2::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
-
-  //***************************************************************************
-  // Specialisation for 1 message type.
-  //***************************************************************************
-  template <typename TDerived,
-            typename T1>
-  class message_router<TDerived, T1, void, void, void, void, void, void, void, void, void, void, void, void, void, void, void>
-   : public imessage_router
-  {
-  public:
-
-  #if ETL_HAS_VIRTUAL_MESSAGES
-    typedef etl::message_packet< T1> message_packet;
-  #endif
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_)
-      : imessage_router(id_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
-      : imessage_router(id_, successor_)
-    {
-      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
-    }
-
-    //**********************************************
-    message_router()
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
-    {
-    }
-
-    //**********************************************
-    message_router(etl::imessage_router& successor_)
-      : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
-    {
-    }
-
-    //**********************************************
-    using etl::imessage_router::receive;
-
-    void receive(const etl::imessage& msg) ETL_OVERRIDE
-    {
-      const size_t id = msg.get_message_id();
-
-      switch (id)
-      {
-        case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
-        default:
-        {
-           if (has_successor())
-           {
-             get_successor().receive(msg);
-           }
-           else
-           {
-             static_cast<TDerived*>(this)->on_receive_unknown(msg);
-           }
-           break;
-        }
-      }
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && etl::is_one_of<TMessage, T1>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      static_cast<TDerived*>(this)->on_receive(msg);
-    }
-
-    template <typename TMessage>
-    typename etl::enable_if<etl::is_base_of<imessage, TMessage>::value && !etl::is_one_of<TMessage, T1>::value, void>::type
-      receive(const TMessage& msg)
-    {
-      if (has_successor())
-      {
-        get_successor().receive(msg);
-      }
-      else
-      {
-        static_cast<TDerived*>(this)->on_receive_unknown(msg);
-      }
-    }
-
-
-    //**********************************************
-    using imessage_router::accepts;
-
-    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
-    {
-      switch (id)
-      {
-        case T1::ID:
-          return true;
-        default:
-        {
-          if (has_successor())
-          {
-            return get_successor().accepts(id);
-          }
-          else
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    //********************************************
-    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
-    {
-      return false;
-    }
-
-    //********************************************
-    bool is_producer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-
-    //********************************************
-    bool is_consumer() const ETL_OVERRIDE
-    {
-      return true;
-    }
-  };
+  #include "private/message_router_legacy.h"
 #endif
-}
 
 #endif
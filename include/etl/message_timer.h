@@ -34,6 +34,7 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "shared_message.h"
 #include "message_bus.h"
 #include "static_assert.h"
 #include "timer.h"
@@ -87,6 +88,7 @@ namespace etl
         p_router(ETL_NULLPTR),
         period(0),
         delta(etl::timer::state::Inactive),
+        slack(0),
         destination_router_id(etl::imessage_bus::ALL_MESSAGE_ROUTERS),
         id(etl::timer::id::NO_TIMER),
         previous(etl::timer::id::NO_TIMER),
@@ -106,6 +108,7 @@ namespace etl
         p_router(&irouter_),
         period(period_),
         delta(etl::timer::state::Inactive),
+        slack(0),
         destination_router_id(destination_router_id_),
         id(id_),
         previous(etl::timer::id::NO_TIMER),
@@ -134,12 +137,16 @@ namespace etl
     etl::imessage_router*    p_router;
     uint32_t                 period;
     uint32_t                 delta;
+    uint32_t                 slack;
     etl::message_router_id_t destination_router_id;
     etl::timer::id::type     id;
     uint_least8_t            previous;
     uint_least8_t            next;
     bool                     repeating;
 
+    /// Holds a reference to the message, if registered with a shared message.
+    etl::private_shared_message::holder shared_msg;
+
   private:
 
     // Disabled.
@@ -379,6 +386,28 @@ namespace etl
       return id;
     }
 
+    //*******************************************
+    /// Register a timer with a shared message.
+    /// The timer holds a reference to the message until it is unregistered.
+    /// On expiry the message is lent to the router's shared message receive,
+    /// so a queued router takes its own reference rather than a copy.
+    //*******************************************
+    etl::timer::id::type register_timer(const etl::shared_message& message_,
+                                        etl::imessage_router&      router_,
+                                        uint32_t                   period_,
+                                        bool                       repeating_,
+                                        etl::message_router_id_t   destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      etl::timer::id::type id = register_timer(message_.get_message(), router_, period_, repeating_, destination_router_id_);
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        timer_array[id].shared_msg.set(message_);
+      }
+
+      return id;
+    }
+
     //*******************************************
     /// Unregister a timer.
     //*******************************************
@@ -399,7 +428,8 @@ namespace etl
             ETL_ENABLE_TIMER_UPDATES;
           }
 
-          // Reset in-place.
+          // Release any shared message, then reset in-place.
+          timer.shared_msg.reset();
           new (&timer) message_timer_data();
           --registered_timers;
 
@@ -437,6 +467,7 @@ namespace etl
 
       for (int i = 0; i < MAX_TIMERS; ++i)
       {
+        timer_array[i].shared_msg.reset();
         new (&timer_array[i]) message_timer_data();
       }
 
@@ -460,23 +491,48 @@ namespace etl
 
           if (has_active)
           {
-            while (has_active && (count >= active_list.front().delta))
+            bool has_expired = false;
+
+            // Timers that are due, and then any timers within their slack of being due.
+            while (has_active && ((count >= active_list.front().delta) ||
+                                  (has_expired && ((active_list.front().delta - count) <= active_list.front().slack))))
             {
               etl::message_timer_data& timer = active_list.front();
 
-              count -= timer.delta;
+              // The time from now that the timer was due.
+              uint32_t due = timer.delta;
+
+              if (count >= due)
+              {
+                count -= due;
+                due = 0U;
+                has_expired = true;
 
-              active_list.remove(timer.id, true);
+                active_list.remove(timer.id, true);
+              }
+              else
+              {
+                // Fire early, leaving the time for the following timers unchanged.
+                active_list.remove(timer.id, false);
+              }
 
               if (timer.repeating)
               {
-                timer.delta = timer.period;
+                // Reinsert the timer, keeping its phase if fired early.
+                timer.delta = timer.period + due;
                 active_list.insert(timer.id);
               }
 
               if (timer.p_router != ETL_NULLPTR)
               {
-                timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+                if (timer.shared_msg.has_value())
+                {
+                  timer.p_router->receive(timer.destination_router_id, etl::shared_message::borrow(timer.shared_msg.value()));
+                }
+                else
+                {
+                  timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+                }
               }
 
               has_active = !active_list.empty();
@@ -589,6 +645,31 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    /// Sets a timer's slack.
+    /// When another timer expires, this timer will also fire in the same tick
+    /// if it is due within 'slack_' ticks. The default is zero.
+    /// Lets timers that are close together share one wake-up.
+    //*******************************************
+    bool set_slack(etl::timer::id::type id_, uint32_t slack_)
+    {
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        etl::message_timer_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          ETL_DISABLE_TIMER_UPDATES;
+          timer.slack = slack_;
+          ETL_ENABLE_TIMER_UPDATES;
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
     //*******************************************
     /// Check if there is an active timer.
     //*******************************************
@@ -34,9 +34,12 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "shared_message.h"
 #include "message_bus.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "integral_limits.h"
+#include "type_traits.h"
 #include "atomic.h"
 #include "algorithm.h"
 
@@ -49,17 +52,24 @@ namespace etl
   //***************************************************************************
   /// Interface for message timer
   //***************************************************************************
-  template <typename TSemaphore>
+  template <typename TSemaphore, typename TTick = uint32_t>
   class imessage_timer_atomic
   {
   public:
 
+    ETL_STATIC_ASSERT(etl::is_unsigned<TTick>::value, "TTick must be an unsigned integral type");
+
+    typedef TTick tick_type;
+
+    static ETL_CONSTANT tick_type Inactive           = etl::integral_limits<tick_type>::max; ///< The delta of an inactive timer.
+    static ETL_CONSTANT tick_type No_Active_Interval = etl::integral_limits<tick_type>::max; ///< Returned by time_to_next() when no timer is active.
+
     //*******************************************
     /// Register a timer.
     //*******************************************
     etl::timer::id::type register_timer(const etl::imessage&     message_,
                                         etl::imessage_router&    router_,
-                                        uint32_t                 period_,
+                                        tick_type                period_,
                                         bool                     repeating_,
                                         etl::message_router_id_t destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
     {
@@ -92,6 +102,28 @@ namespace etl
       return id;
     }
 
+    //*******************************************
+    /// Register a timer with a shared message.
+    /// The timer holds a reference to the message until it is unregistered.
+    /// On expiry the message is lent to the router's shared message receive,
+    /// so a queued router takes its own reference rather than a copy.
+    //*******************************************
+    etl::timer::id::type register_timer(const etl::shared_message& message_,
+                                        etl::imessage_router&      router_,
+                                        tick_type                  period_,
+                                        bool                       repeating_,
+                                        etl::message_router_id_t   destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      etl::timer::id::type id = register_timer(message_.get_message(), router_, period_, repeating_, destination_router_id_);
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        timer_array[id].shared_msg.set(message_);
+      }
+
+      return id;
+    }
+
     //*******************************************
     /// Unregister a timer.
     //*******************************************
@@ -112,7 +144,8 @@ namespace etl
             --process_semaphore;
           }
 
-          // Reset in-place.
+          // Release any shared message, then reset in-place.
+          timer.shared_msg.reset();
           new (&timer) timer_data();
           --registered_timers;
 
@@ -150,6 +183,7 @@ namespace etl
 
       for (int i = 0; i < MAX_TIMERS; ++i)
       {
+        timer_array[i].shared_msg.reset();
         new (&timer_array[i]) timer_data();
       }
 
@@ -162,7 +196,7 @@ namespace etl
     // Returns true if the tick was processed,
     // false if not.
     //*******************************************
-    bool tick(uint32_t count)
+    bool tick(tick_type count)
     {
       if (enabled)
       {
@@ -183,7 +217,14 @@ namespace etl
 
               if (timer.p_router != ETL_NULLPTR)
               {
-                timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+                if (timer.shared_msg.has_value())
+                {
+                  timer.p_router->receive(timer.destination_router_id, etl::shared_message::borrow(timer.shared_msg.value()));
+                }
+                else
+                {
+                  timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+                }
               }
 
               if (timer.repeating)
@@ -225,7 +266,7 @@ namespace etl
         if (timer.id != etl::timer::id::NO_TIMER)
         {
           // Has a valid period.
-          if (timer.period != etl::timer::state::Inactive)
+          if (timer.period != Inactive)
           {
             ++process_semaphore;
             if (timer.is_active())
@@ -277,7 +318,7 @@ namespace etl
     //*******************************************
     /// Sets a timer's period.
     //*******************************************
-    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    bool set_period(etl::timer::id::type id_, tick_type period_)
     {
       if (stop(id_))
       {
@@ -316,11 +357,11 @@ namespace etl
 
     //*******************************************
     /// Get the time to the next timer event.
-    /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+    /// Returns No_Active_Interval if there is no active timer.
     //*******************************************
-    uint32_t time_to_next() const
+    tick_type time_to_next() const
     {
-      uint32_t delta = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+      tick_type delta = No_Active_Interval;
 
       ++process_semaphore;
       if (!active_list.empty())
@@ -343,7 +384,7 @@ namespace etl
         : p_message(ETL_NULLPTR)
         , p_router(ETL_NULLPTR)
         , period(0U)
-        , delta(etl::timer::state::Inactive)
+        , delta(Inactive)
         , destination_router_id(etl::imessage_bus::ALL_MESSAGE_ROUTERS)
         , id(etl::timer::id::NO_TIMER)
         , previous(etl::timer::id::NO_TIMER)
@@ -356,13 +397,13 @@ namespace etl
       timer_data(etl::timer::id::type     id_,
         const etl::imessage& message_,
         etl::imessage_router& irouter_,
-        uint32_t                 period_,
+        tick_type                period_,
         bool                     repeating_,
         etl::message_router_id_t destination_router_id_ = etl::imessage_bus::ALL_MESSAGE_ROUTERS)
         : p_message(&message_)
         , p_router(&irouter_)
         , period(period_)
-        , delta(etl::timer::state::Inactive)
+        , delta(Inactive)
         , destination_router_id(destination_router_id_)
         , id(id_)
         , previous(etl::timer::id::NO_TIMER)
@@ -376,7 +417,7 @@ namespace etl
       //*******************************************
       bool is_active() const
       {
-        return delta != etl::timer::state::Inactive;
+        return delta != Inactive;
       }
 
       //*******************************************
@@ -384,19 +425,22 @@ namespace etl
       //*******************************************
       void set_inactive()
       {
-        delta = etl::timer::state::Inactive;
+        delta = Inactive;
       }
 
       const etl::imessage*     p_message;
       etl::imessage_router*    p_router;
-      uint32_t                 period;
-      uint32_t                 delta;
+      tick_type                period;
+      tick_type                delta;
       etl::message_router_id_t destination_router_id;
       etl::timer::id::type     id;
       uint_least8_t            previous;
       uint_least8_t            next;
       bool                     repeating;
 
+      /// Holds a reference to the message, if registered with a shared message.
+      etl::private_shared_message::holder shared_msg;
+
     private:
 
       // Disabled.
@@ -548,7 +592,7 @@ namespace etl
 
         timer.previous = etl::timer::id::NO_TIMER;
         timer.next = etl::timer::id::NO_TIMER;
-        timer.delta = etl::timer::state::Inactive;
+        timer.delta = Inactive;
       }
 
       //*******************************
@@ -625,11 +669,17 @@ namespace etl
     const uint_least8_t MAX_TIMERS;
   };
 
+  template <typename TSemaphore, typename TTick>
+  ETL_CONSTANT typename imessage_timer_atomic<TSemaphore, TTick>::tick_type imessage_timer_atomic<TSemaphore, TTick>::Inactive;
+
+  template <typename TSemaphore, typename TTick>
+  ETL_CONSTANT typename imessage_timer_atomic<TSemaphore, TTick>::tick_type imessage_timer_atomic<TSemaphore, TTick>::No_Active_Interval;
+
   //***************************************************************************
   /// The message timer
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_, typename TSemaphore>
-  class message_timer_atomic : public etl::imessage_timer_atomic<TSemaphore>
+  template <uint_least8_t MAX_TIMERS_, typename TSemaphore, typename TTick = uint32_t>
+  class message_timer_atomic : public etl::imessage_timer_atomic<TSemaphore, TTick>
   {
   public:
 
@@ -639,13 +689,13 @@ namespace etl
     /// Constructor.
     //*******************************************
     message_timer_atomic()
-      : imessage_timer_atomic<TSemaphore>(timer_array, MAX_TIMERS_)
+      : imessage_timer_atomic<TSemaphore, TTick>(timer_array, MAX_TIMERS_)
     {
     }
 
   private:
 
-    typename etl::imessage_timer_atomic<TSemaphore>::timer_data timer_array[MAX_TIMERS_];
+    typename etl::imessage_timer_atomic<TSemaphore, TTick>::timer_data timer_array[MAX_TIMERS_];
   };
 }
 
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "shared_message.h"
 #include "message_bus.h"
 #include "static_assert.h"
 #include "timer.h"
@@ -96,6 +97,28 @@ namespace etl
       return id;
     }
 
+    //*******************************************
+    /// Register a timer with a shared message.
+    /// The timer holds a reference to the message until it is unregistered.
+    /// On expiry the message is lent to the router's shared message receive,
+    /// so a queued router takes its own reference rather than a copy.
+    //*******************************************
+    etl::timer::id::type register_timer(const etl::shared_message& message_,
+                                        etl::imessage_router&      router_,
+                                        uint32_t                   period_,
+                                        bool                       repeating_,
+                                        etl::message_router_id_t   destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      etl::timer::id::type id = register_timer(message_.get_message(), router_, period_, repeating_, destination_router_id_);
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        timer_array[id].shared_msg.set(message_);
+      }
+
+      return id;
+    }
+
     //*******************************************
     /// Unregister a timer.
     //*******************************************
@@ -116,7 +139,8 @@ namespace etl
             unlock();
           }
 
-          // Reset in-place.
+          // Release any shared message, then reset in-place.
+          timer.shared_msg.reset();
           new (&timer) timer_data();
           --number_of_registered_timers;
 
@@ -154,6 +178,7 @@ namespace etl
 
       for (int i = 0; i < MAX_TIMERS; ++i)
       {
+        timer_array[i].shared_msg.reset();
         new (&timer_array[i]) timer_data();
       }
 
@@ -187,7 +212,14 @@ namespace etl
 
               if (timer.p_router != ETL_NULLPTR)
               {
-                timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+                if (timer.shared_msg.has_value())
+                {
+                  timer.p_router->receive(timer.destination_router_id, etl::shared_message::borrow(timer.shared_msg.value()));
+                }
+                else
+                {
+                  timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+                }
               }
 
               if (timer.repeating)
@@ -413,6 +445,9 @@ namespace etl
       uint_least8_t            next;
       bool                     repeating;
 
+      /// Holds a reference to the message, if registered with a shared message.
+      etl::private_shared_message::holder shared_msg;
+
     private:
 
       // Disabled.
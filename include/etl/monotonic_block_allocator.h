@@ -0,0 +1,162 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MONOTONIC_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_MONOTONIC_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace etl
+{
+  //*************************************************************************
+  /// The monotonic memory block allocator.
+  /// Allocates blocks of any size by moving a pointer through a user buffer.
+  /// Releasing a block does not free its memory; all of the memory is freed
+  /// at once by reset(). When the buffer is exhausted, requests are passed on
+  /// to the successor, if configured.
+  //*************************************************************************
+  class monotonic_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor
+    ///\param p_buffer_   The memory to allocate from.
+    ///\param buffer_size The size of the memory, in bytes.
+    //*************************************************************************
+    monotonic_block_allocator(void* p_buffer_, size_t buffer_size)
+      : p_begin(static_cast<char*>(p_buffer_))
+      , p_end(static_cast<char*>(p_buffer_) + buffer_size)
+      , p_next(static_cast<char*>(p_buffer_))
+    {
+    }
+
+    //*************************************************************************
+    /// Frees all of the blocks allocated from this allocator.
+    /// Does not reset the successor.
+    //*************************************************************************
+    void reset()
+    {
+      p_next = p_begin;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes used, including any alignment padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return size_t(p_next - p_begin);
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes not yet used.
+    //*************************************************************************
+    size_t available() const
+    {
+      return size_t(p_end - p_next);
+    }
+
+    //*************************************************************************
+    /// Returns the size of the buffer, in bytes.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return size_t(p_end - p_begin);
+    }
+
+    //*************************************************************************
+    /// Returns true if nothing has been allocated since the last reset.
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_next == p_begin;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment == 0U)
+      {
+        required_alignment = 1U;
+      }
+
+      // Round up to the alignment, which is a power of 2.
+      uintptr_t next    = reinterpret_cast<uintptr_t>(p_next);
+      uintptr_t aligned = (next + (required_alignment - 1U)) & ~uintptr_t(required_alignment - 1U);
+      size_t    padding = size_t(aligned - next);
+
+      if ((padding > available()) || (required_size > (available() - padding)))
+      {
+        return ETL_NULLPTR;
+      }
+
+      char* p_block = p_next + padding;
+      p_next = p_block + required_size;
+
+      return p_block;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    /// The memory is not reused until reset().
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      return is_owner_of_block(pblock);
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      const char* p = static_cast<const char*>(pblock);
+
+      return (p >= p_begin) && (p < p_end);
+    }
+
+  private:
+
+    char* const p_begin; ///< The start of the buffer.
+    char* const p_end;   ///< The end of the buffer.
+    char*       p_next;  ///< The start of the free memory.
+  };
+}
+
+#endif
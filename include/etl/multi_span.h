@@ -68,6 +68,9 @@ namespace etl
 
       friend class multi_span;
 
+      /// Marks the iterator as segmented. See etl::is_segmented_iterator.
+      typedef pointer segment_pointer;
+
       iterator()
         : p_current(ETL_NULLPTR)
         , p_end(ETL_NULLPTR)
@@ -145,12 +148,52 @@ namespace etl
         return &operator*();
       }
 
+      //*************************************************************************
+      /// The address of the current element.
+      //*************************************************************************
+      segment_pointer segment_begin() const
+      {
+        return p_value;
+      }
+
+      //*************************************************************************
+      /// The number of elements from this one, up to 'last' or the end of the
+      /// current span, whichever is nearer.
+      //*************************************************************************
+      size_t segment_size(const iterator& last) const
+      {
+        if (p_current == p_end)
+        {
+          return 0U;
+        }
+        else if (last.p_current == p_current)
+        {
+          return static_cast<size_t>(last.p_value - p_value);
+        }
+        else
+        {
+          return static_cast<size_t>(p_current->end() - p_value);
+        }
+      }
+
+      //*************************************************************************
+      /// Moves forward by n elements, at most to the end of the current span.
+      //*************************************************************************
+      void segment_advance(size_t n)
+      {
+        if (n != 0U)
+        {
+          p_value += n - 1U;
+          operator ++();
+        }
+      }
+
       //*************************************************************************
       /// == operator
       //*************************************************************************
       friend bool operator ==(const iterator& lhs, const iterator& rhs)
       {
-        return (lhs.p_current == rhs.p_current);
+        return (lhs.p_current == rhs.p_current) && (lhs.p_value == rhs.p_value);
       }
 
       //*************************************************************************
@@ -333,6 +376,26 @@ namespace etl
       return span_list.size();
     }
 
+    //*************************************************************************
+    /// Calls function(span_type) for each span that is not empty, in order.
+    /// The function may then process each span as a pointer range.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_segment(TFunction function) const
+    {
+      for (typename span_list_type::iterator itr = span_list.begin();
+           itr != span_list.end();
+           ++itr)
+      {
+        if (!itr->empty())
+        {
+          function(*itr);
+        }
+      }
+
+      return function;
+    }
+
   private:
 
     span_list_type span_list;
@@ -292,6 +292,118 @@ namespace etl
       swap->weight = detached->weight;
     }
 
+    //*************************************************************************
+    /// Updates the weights from the balance node to the parent of the
+    /// replacement node, then swaps the found node with the replacement.
+    /// Uses only the node links, so is shared by all key and value types.
+    //*************************************************************************
+    void rebalance_and_detach(Node* found, Node* replacement, Node* balance)
+    {
+      // Step 4: Update weights from balance to parent of node determined
+      // in step 3 above rotating (2 or 3 node rotations) as needed.
+      while (balance)
+      {
+        // Break when balance node reaches the parent of replacement node
+        if (balance->children[balance->dir] == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        // If balance node is balanced already (kNeither) then just imbalance
+        // the node in the opposite direction of the node being removed
+        if (balance->weight == kNeither)
+        {
+          balance->weight = 1 - balance->dir;
+        }
+        // If balance node is imbalanced in the opposite direction of the
+        // node being removed then the node now becomes balanced
+        else if (balance->weight == balance->dir)
+        {
+          balance->weight = kNeither;
+        }
+        // Otherwise a rotation is required at this node
+        else
+        {
+          int weight = balance->children[1 - balance->dir]->weight;
+          // Perform a 3 node rotation if weight is same as balance->dir
+          if (weight == balance->dir)
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance->parent == ETL_NULLPTR)
+            {
+              rotate_3node(root_node, 1 - balance->dir,
+                balance->children[1 - balance->dir]->children[balance->dir]->weight);
+            }
+            else
+            {
+              rotate_3node(balance->parent->children[balance->parent->dir], 1 - balance->dir,
+                balance->children[1 - balance->dir]->children[balance->dir]->weight);
+            }
+          }
+          // Already balanced, rebalance and make it heavy in opposite
+          // direction of the node being removed
+          else if (weight == kNeither)
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance->parent == ETL_NULLPTR)
+            {
+              rotate_2node(root_node, 1 - balance->dir);
+              root_node->weight = balance->dir;
+            }
+            else
+            {
+              // Balance parent might change during rotate, keep local copy
+              // to old parent so its weight can be updated after the 2 node
+              // rotate is completed
+              Node* old_parent = balance->parent;
+              rotate_2node(balance->parent->children[balance->parent->dir], 1 - balance->dir);
+              old_parent->children[old_parent->dir]->weight = balance->dir;
+            }
+            // Update balance node weight in opposite direction of node removed
+            balance->weight = 1 - balance->dir;
+          }
+          // Rebalance and leave it balanced
+          else
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance->parent == ETL_NULLPTR)
+            {
+              rotate_2node(root_node, 1 - balance->dir);
+            }
+            else
+            {
+              rotate_2node(balance->parent->children[balance->parent->dir], 1 - balance->dir);
+            }
+          }
+        }
+
+        // Next balance node to consider
+        balance = balance->children[balance->dir];
+      } // while(balance)
+
+      // Step 5: Swap found with replacement
+      if (found->parent)
+      {
+        // Handle traditional case
+        detach_node(found->parent->children[found->parent->dir],
+          replacement->parent->children[replacement->parent->dir]);
+      }
+      // Handle root node removal
+      else
+      {
+        // Valid replacement node for root node being removed?
+        if (replacement->parent)
+        {
+          detach_node(root_node, replacement->parent->children[replacement->parent->dir]);
+        }
+        else
+        {
+          // Found node and replacement node are both root node
+          detach_node(root_node, root_node);
+        }
+      }
+    }
+
     //*************************************************************************
     /// Balance the critical node at the position provided as needed
     //*************************************************************************
@@ -2165,109 +2277,8 @@ namespace etl
           }
         } // while(node)
 
-          // Step 4: Update weights from balance to parent of node determined
-          // in step 3 above rotating (2 or 3 node rotations) as needed.
-        while (balance)
-        {
-          // Break when balance node reaches the parent of replacement node
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
-
-          // If balance node is balanced already (kNeither) then just imbalance
-          // the node in the opposite direction of the node being removed
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          // If balance node is imbalanced in the opposite direction of the
-          // node being removed then the node now becomes balanced
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          // Otherwise a rotation is required at this node
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance->parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance->parent->children[balance->parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance->parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                // Balance parent might change during rotate, keep local copy
-                // to old parent so its weight can be updated after the 2 node
-                // rotate is completed
-                Node* old_parent = balance->parent;
-                rotate_2node(balance->parent->children[balance->parent->dir], 1 - balance->dir);
-                old_parent->children[old_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance->parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance->parent->children[balance->parent->dir], 1 - balance->dir);
-              }
-            }
-          }
-
-          // Next balance node to consider
-          balance = balance->children[balance->dir];
-        } // while(balance)
-
-          // Step 5: Swap found with node (replacement)
-        if (found->parent)
-        {
-          // Handle traditional case
-          detach_node(found->parent->children[found->parent->dir],
-            node->parent->children[node->parent->dir]);
-        }
-        // Handle root node removal
-        else
-        {
-          // Valid replacement node for root node being removed?
-          if (node->parent)
-          {
-            detach_node(root_node, node->parent->children[node->parent->dir]);
-          }
-          else
-          {
-            // Found node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
-        }
+        // Steps 4 and 5: Update the weights and swap found with the replacement
+        rebalance_and_detach(found, node, balance);
 
         // One less.
         --current_size;
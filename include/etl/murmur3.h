@@ -35,6 +35,10 @@ SOFTWARE.
 #include "ihash.h"
 #include "binary.h"
 #include "error_handler.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "unaligned_type.h"
+#include "array.h"
 
 #include <stdint.h>
 
@@ -85,23 +89,8 @@ namespace etl
     murmur3(TIterator begin, const TIterator end, value_type seed_ = 0)
       : seed(seed_)
     {
-      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
-
       reset();
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -118,6 +107,7 @@ namespace etl
 
     //*************************************************************************
     /// Adds a range.
+    /// Contiguous ranges are hashed a whole block at a time.
     /// \param begin
     /// \param end
     //*************************************************************************
@@ -127,20 +117,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -153,7 +130,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8U);
+      block |= value_type(value_) << (block_fill_count * 8U);
 
       if (++block_fill_count == FULL_BLOCK)
       {
@@ -184,6 +161,54 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add(uint8_t(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range.
+    /// Whole blocks are read directly from the, possibly unaligned, data.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      const uint8_t* p_data = reinterpret_cast<const uint8_t*>(begin);
+      size_t         length = size_t(end - begin);
+
+      // Complete a partially filled block.
+      while ((block_fill_count != 0U) && (length != 0U))
+      {
+        add(*p_data++);
+        --length;
+      }
+
+      while (length >= FULL_BLOCK)
+      {
+        block = value_type(reinterpret_cast<const etl::le_uint32_t*>(p_data)->value());
+        add_block();
+        block = 0;
+
+        p_data     += FULL_BLOCK;
+        length     -= FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      while (length != 0U)
+      {
+        add(*p_data++);
+        --length;
+      }
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
@@ -236,6 +261,275 @@ namespace etl
     static ETL_CONSTANT value_type MULTIPLY   = 5;
     static ETL_CONSTANT value_type ADD        = 0xE6546B64UL;
   };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Calculates the 128 bit murmur3 hash, optimised for 64 bit platforms.
+  /// Equivalent to MurmurHash3_x64_128.
+  /// The value is returned as { h1, h2 }.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x64_128
+  {
+  public:
+
+    typedef etl::array<uint64_t, 2U> value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_x64_128(uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_x64_128(TIterator begin, const TIterator end, uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      h1               = seed;
+      h2               = seed;
+      char_count       = 0;
+      block_fill_count = 0;
+      is_finalised     = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// Contiguous ranges are hashed a whole block at a time.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      block[block_fill_count] = value_;
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block(block);
+        block_fill_count = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+
+      value_type result = { { h1, h2 } };
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add(uint8_t(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range.
+    /// Whole blocks are read directly from the, possibly unaligned, data.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      const uint8_t* p_data = reinterpret_cast<const uint8_t*>(begin);
+      size_t         length = size_t(end - begin);
+
+      // Complete a partially filled block.
+      while ((block_fill_count != 0U) && (length != 0U))
+      {
+        add(*p_data++);
+        --length;
+      }
+
+      while (length >= FULL_BLOCK)
+      {
+        add_block(p_data);
+
+        p_data     += FULL_BLOCK;
+        length     -= FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      while (length != 0U)
+      {
+        add(*p_data++);
+        --length;
+      }
+    }
+
+    //*************************************************************************
+    /// Reads a little endian 64 bit value from the, possibly unaligned, data.
+    //*************************************************************************
+    static uint64_t read(const uint8_t* p_data)
+    {
+      return reinterpret_cast<const etl::le_uint64_t*>(p_data)->value();
+    }
+
+    //*************************************************************************
+    static uint64_t mix_k1(uint64_t k1)
+    {
+      k1 *= CONSTANT1;
+      k1  = rotate_left(k1, 31U);
+      k1 *= CONSTANT2;
+
+      return k1;
+    }
+
+    //*************************************************************************
+    static uint64_t mix_k2(uint64_t k2)
+    {
+      k2 *= CONSTANT2;
+      k2  = rotate_left(k2, 33U);
+      k2 *= CONSTANT1;
+
+      return k2;
+    }
+
+    //*************************************************************************
+    static uint64_t fmix(uint64_t k)
+    {
+      k ^= (k >> 33U);
+      k *= 0xFF51AFD7ED558CCDULL;
+      k ^= (k >> 33U);
+      k *= 0xC4CEB9FE1A85EC53ULL;
+      k ^= (k >> 33U);
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// Adds a filled block to the hash.
+    //*************************************************************************
+    void add_block(const uint8_t* p_block)
+    {
+      h1 ^= mix_k1(read(p_block));
+      h1  = rotate_left(h1, 27U);
+      h1 += h2;
+      h1  = (h1 * 5U) + 0x52DCE729ULL;
+
+      h2 ^= mix_k2(read(p_block + 8U));
+      h2  = rotate_left(h2, 31U);
+      h2 += h1;
+      h2  = (h2 * 5U) + 0x38495AB5ULL;
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        uint64_t k1 = 0U;
+        uint64_t k2 = 0U;
+
+        for (uint8_t i = block_fill_count; i > 8U; --i)
+        {
+          k2 = (k2 << 8U) | block[i - 1U];
+        }
+
+        for (uint8_t i = (block_fill_count > 8U) ? 8U : block_fill_count; i > 0U; --i)
+        {
+          k1 = (k1 << 8U) | block[i - 1U];
+        }
+
+        if (block_fill_count > 8U)
+        {
+          h2 ^= mix_k2(k2);
+        }
+
+        if (block_fill_count > 0U)
+        {
+          h1 ^= mix_k1(k1);
+        }
+
+        h1 ^= uint64_t(char_count);
+        h2 ^= uint64_t(char_count);
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+
+        h1 += h2;
+        h2 += h1;
+
+        is_finalised = true;
+      }
+    }
+
+    bool     is_finalised;
+    uint8_t  block_fill_count;
+    size_t   char_count;
+    uint64_t h1;
+    uint64_t h2;
+    uint32_t seed;
+    uint8_t  block[16];
+
+    static ETL_CONSTANT uint8_t  FULL_BLOCK = 16U;
+    static ETL_CONSTANT uint64_t CONSTANT1  = 0x87C37B91114253D5ULL;
+    static ETL_CONSTANT uint64_t CONSTANT2  = 0x4CF5AD432745937FULL;
+  };
+#endif
 }
 
 #endif
@@ -35,6 +35,10 @@ SOFTWARE.
 #include "type_traits.h"
 #include "limits.h"
 #include "iterator.h"
+#include "functional.h"
+#include "private/numeric_simd.h"
+
+#include <stddef.h>
 
 #if ETL_USING_STL
   #include <iterator>
@@ -213,6 +217,310 @@ namespace etl
 
     return typecast_a(a) + (typecast_t(t) * (typecast_b(b) - typecast_a(a)));
   }
+
+  namespace private_numeric
+  {
+    //*************************************************************************
+    /// Can the range be summed with the vector kernel?
+    /// The iterator must be a pointer to T, and T must have vector support.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    struct is_simd_range
+      : etl::bool_constant<etl::is_pointer<TIterator>::value &&
+                           etl::is_same<typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type, T>::value &&
+                           etl::private_numeric::simd_ops<T>::Enabled>
+    {
+    };
+
+    //*************************************************************************
+    /// Sums the range in order.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    T reduce(TIterator first, TIterator last, T init, etl::bool_constant<false>)
+    {
+      while (first != last)
+      {
+        init = init + *first;
+        ++first;
+      }
+
+      return init;
+    }
+
+    //*************************************************************************
+    /// Sums whole blocks with the vector kernel, then the rest in order.
+    //*************************************************************************
+    template <typename T>
+    T reduce(const T* first, const T* last, T init, etl::bool_constant<true>)
+    {
+      size_t n = size_t(last - first);
+
+      etl::private_numeric::simd_sum(first, n, init, etl::bool_constant<true>());
+
+      return reduce(first, last, init, etl::bool_constant<false>());
+    }
+
+    //*************************************************************************
+    /// Sums the products of the ranges in order.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2, typename T>
+    T dot_product(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init, etl::bool_constant<false>)
+    {
+      while (first1 != last1)
+      {
+        init = init + (*first1 * *first2);
+        ++first1;
+        ++first2;
+      }
+
+      return init;
+    }
+
+    //*************************************************************************
+    /// Sums the products of whole blocks with the vector kernel, then the rest
+    /// in order.
+    //*************************************************************************
+    template <typename T>
+    T dot_product(const T* first1, const T* last1, const T* first2, T init, etl::bool_constant<true>)
+    {
+      size_t n = size_t(last1 - first1);
+
+      etl::private_numeric::simd_dot_product(first1, first2, n, init, etl::bool_constant<true>());
+
+      return dot_product(first1, last1, first2, init, etl::bool_constant<false>());
+    }
+
+    //*************************************************************************
+    /// Running sums, in order.
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator partial_sum(TInputIterator first, TInputIterator last, TOutputIterator d_first, etl::bool_constant<false>)
+    {
+      if (first == last)
+      {
+        return d_first;
+      }
+
+      typename etl::iterator_traits<TInputIterator>::value_type sum = *first;
+      *d_first = sum;
+
+      while (++first != last)
+      {
+        sum = sum + *first;
+        *++d_first = sum;
+      }
+
+      return ++d_first;
+    }
+
+    //*************************************************************************
+    /// Running sums of whole blocks with the vector kernel, then the rest in
+    /// order.
+    //*************************************************************************
+    template <typename T>
+    T* partial_sum(const T* first, const T* last, T* d_first, etl::bool_constant<true>)
+    {
+      if (first == last)
+      {
+        return d_first;
+      }
+
+      size_t n   = size_t(last - first);
+      T      sum = T(0);
+
+      etl::private_numeric::simd_prefix_sum(first, d_first, n, sum, etl::bool_constant<true>());
+
+      while (first != last)
+      {
+        sum = sum + *first++;
+        *d_first++ = sum;
+      }
+
+      return d_first;
+    }
+  }
+
+  //***************************************************************************
+  /// reduce
+  /// As accumulate, except that the values may be summed in any order.
+  /// Contiguous ranges of float and double are summed with vector
+  /// instructions, when available. The result may differ slightly from
+  /// accumulate, due to the different rounding.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T reduce(TIterator first, TIterator last, T init)
+  {
+    typedef etl::bool_constant<etl::private_numeric::is_simd_range<TIterator, T>::value> use_simd;
+
+    return etl::private_numeric::reduce(first, last, init, use_simd());
+  }
+
+  //***************************************************************************
+  /// reduce
+  /// Starts from a value initialised value_type.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator>
+  typename etl::iterator_traits<TIterator>::value_type reduce(TIterator first, TIterator last)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    return etl::reduce(first, last, value_type());
+  }
+
+  //***************************************************************************
+  /// reduce
+  /// With a user supplied operation, which must be associative and
+  /// commutative. The values are combined in order.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T reduce(TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    while (first != last)
+    {
+      init = operation(init, *first);
+      ++first;
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// transform_reduce
+  /// The sum of the products of two ranges, in any order.
+  /// Contiguous ranges of float and double use vector instructions, when
+  /// available. The result may differ slightly from inner_product, due to the
+  /// different rounding.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T>
+  T transform_reduce(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init)
+  {
+    typedef etl::bool_constant<etl::private_numeric::is_simd_range<TIterator1, T>::value &&
+                               etl::private_numeric::is_simd_range<TIterator2, T>::value> use_simd;
+
+    return etl::private_numeric::dot_product(first1, last1, first2, init, use_simd());
+  }
+
+  //***************************************************************************
+  /// transform_reduce
+  /// Two ranges, with user supplied reduce and transform operations.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T, typename TReduce, typename TTransform>
+  T transform_reduce(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init, TReduce reduce, TTransform transform)
+  {
+    while (first1 != last1)
+    {
+      init = reduce(init, transform(*first1, *first2));
+      ++first1;
+      ++first2;
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// transform_reduce
+  /// One range, with user supplied reduce and transform operations.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TReduce, typename TTransform>
+  T transform_reduce(TIterator first, TIterator last, T init, TReduce reduce, TTransform transform)
+  {
+    while (first != last)
+    {
+      init = reduce(init, transform(*first));
+      ++first;
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// inner_product
+  /// The sum of the products of two ranges, in order.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T>
+  ETL_CONSTEXPR14 T inner_product(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init)
+  {
+    while (first1 != last1)
+    {
+      init = init + (*first1 * *first2);
+      ++first1;
+      ++first2;
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// inner_product
+  /// With user supplied sum and product operations, in order.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename T, typename TBinaryOperation1, typename TBinaryOperation2>
+  ETL_CONSTEXPR14 T inner_product(TIterator1 first1, TIterator1 last1, TIterator2 first2, T init, TBinaryOperation1 operation1, TBinaryOperation2 operation2)
+  {
+    while (first1 != last1)
+    {
+      init = operation1(init, operation2(*first1, *first2));
+      ++first1;
+      ++first2;
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// partial_sum
+  /// Writes the running sums of the range to d_first.
+  /// d_first may be equal to first.
+  /// Contiguous ranges of int32_t and uint32_t use vector instructions, when
+  /// available. The results are identical.
+  ///\return An iterator to the end of the output.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator partial_sum(TInputIterator first, TInputIterator last, TOutputIterator d_first)
+  {
+    typedef typename etl::iterator_traits<TInputIterator>::value_type value_type;
+
+    typedef etl::bool_constant<etl::is_pointer<TInputIterator>::value &&
+                               etl::is_same<TOutputIterator, value_type*>::value &&
+                               etl::private_numeric::simd_prefix_sum_enabled<value_type>::value> use_simd;
+
+    return etl::private_numeric::partial_sum(first, last, d_first, use_simd());
+  }
+
+  //***************************************************************************
+  /// partial_sum
+  /// With a user supplied operation.
+  ///\return An iterator to the end of the output.
+  ///\ingroup numeric
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TBinaryOperation>
+  ETL_CONSTEXPR14 TOutputIterator partial_sum(TInputIterator first, TInputIterator last, TOutputIterator d_first, TBinaryOperation operation)
+  {
+    if (first == last)
+    {
+      return d_first;
+    }
+
+    typename etl::iterator_traits<TInputIterator>::value_type sum = *first;
+    *d_first = sum;
+
+    while (++first != last)
+    {
+      sum = operation(sum, *first);
+      *++d_first = sum;
+    }
+
+    return ++d_first;
+  }
 }
 
 #endif
@@ -0,0 +1,312 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_OFFSET_PTR_INCLUDED
+#define ETL_OFFSET_PTR_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "iterator.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup offset_ptr offset_ptr
+/// A self relative pointer.
+/// Stores the distance from itself to the object, rather than its address,
+/// so a structure that links to itself with offset pointers is still valid
+/// when its memory is mapped at a different address, such as shared memory
+/// mapped by several processes, or a RAM image restored after a restart.
+/// The offset pointer and the object must be in the same block of memory.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// A self relative pointer to a T.
+  /// A null pointer is stored as an offset of 1, so an offset pointer may
+  /// point to itself, or to the object that contains it.
+  ///\ingroup offset_ptr
+  //***************************************************************************
+  template <typename T>
+  class offset_ptr
+  {
+  public:
+
+    typedef T                               element_type;
+    typedef T                               value_type;
+    typedef T*                              pointer;
+    typedef T&                              reference;
+    typedef ptrdiff_t                       difference_type;
+    typedef ETL_OR_STD::random_access_iterator_tag iterator_category;
+
+    //*************************************************************************
+    /// Constructs a null pointer.
+    //*************************************************************************
+    offset_ptr()
+      : offset(Null_Offset)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a pointer.
+    //*************************************************************************
+    offset_ptr(T* p)
+      : offset(to_offset(p))
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Points to the same object as 'other'.
+    //*************************************************************************
+    offset_ptr(const offset_ptr& other)
+      : offset(to_offset(other.get()))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from an offset pointer to a convertible type.
+    //*************************************************************************
+    template <typename U>
+    offset_ptr(const offset_ptr<U>& other)
+      : offset(to_offset(other.get()))
+    {
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    /// Points to the same object as 'other'.
+    //*************************************************************************
+    offset_ptr& operator =(const offset_ptr& other)
+    {
+      offset = to_offset(other.get());
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assigns from an offset pointer to a convertible type.
+    //*************************************************************************
+    template <typename U>
+    offset_ptr& operator =(const offset_ptr<U>& other)
+    {
+      offset = to_offset(other.get());
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assigns from a pointer.
+    //*************************************************************************
+    offset_ptr& operator =(T* p)
+    {
+      offset = to_offset(p);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets the pointer.
+    //*************************************************************************
+    T* get() const
+    {
+      return (offset == Null_Offset) ? ETL_NULLPTR : reinterpret_cast<T*>(self() + offset);
+    }
+
+    //*************************************************************************
+    /// Dereference operators.
+    //*************************************************************************
+    T& operator *() const
+    {
+      return *get();
+    }
+
+    T* operator ->() const
+    {
+      return get();
+    }
+
+    T& operator [](difference_type n) const
+    {
+      return get()[n];
+    }
+
+    //*************************************************************************
+    /// Checks for a non-null pointer.
+    //*************************************************************************
+    ETL_EXPLICIT operator bool() const
+    {
+      return offset != Null_Offset;
+    }
+
+    //*************************************************************************
+    /// Arithmetic operators.
+    //*************************************************************************
+    offset_ptr& operator +=(difference_type n)
+    {
+      offset += n * difference_type(sizeof(T));
+
+      return *this;
+    }
+
+    offset_ptr& operator -=(difference_type n)
+    {
+      offset -= n * difference_type(sizeof(T));
+
+      return *this;
+    }
+
+    offset_ptr& operator ++()
+    {
+      return *this += 1;
+    }
+
+    offset_ptr& operator --()
+    {
+      return *this -= 1;
+    }
+
+    offset_ptr operator ++(int)
+    {
+      offset_ptr temp(*this);
+      ++*this;
+      return temp;
+    }
+
+    offset_ptr operator --(int)
+    {
+      offset_ptr temp(*this);
+      --*this;
+      return temp;
+    }
+
+    friend offset_ptr operator +(const offset_ptr& lhs, difference_type n)
+    {
+      return offset_ptr(lhs.get() + n);
+    }
+
+    friend offset_ptr operator +(difference_type n, const offset_ptr& rhs)
+    {
+      return offset_ptr(rhs.get() + n);
+    }
+
+    friend offset_ptr operator -(const offset_ptr& lhs, difference_type n)
+    {
+      return offset_ptr(lhs.get() - n);
+    }
+
+    friend difference_type operator -(const offset_ptr& lhs, const offset_ptr& rhs)
+    {
+      return lhs.get() - rhs.get();
+    }
+
+    //*************************************************************************
+    /// Comparison operators.
+    //*************************************************************************
+    friend bool operator ==(const offset_ptr& lhs, const offset_ptr& rhs)
+    {
+      return lhs.get() == rhs.get();
+    }
+
+    friend bool operator !=(const offset_ptr& lhs, const offset_ptr& rhs)
+    {
+      return lhs.get() != rhs.get();
+    }
+
+    friend bool operator <(const offset_ptr& lhs, const offset_ptr& rhs)
+    {
+      return lhs.get() < rhs.get();
+    }
+
+    friend bool operator <=(const offset_ptr& lhs, const offset_ptr& rhs)
+    {
+      return lhs.get() <= rhs.get();
+    }
+
+    friend bool operator >(const offset_ptr& lhs, const offset_ptr& rhs)
+    {
+      return lhs.get() > rhs.get();
+    }
+
+    friend bool operator >=(const offset_ptr& lhs, const offset_ptr& rhs)
+    {
+      return lhs.get() >= rhs.get();
+    }
+
+    friend bool operator ==(const offset_ptr& lhs, const T* rhs)
+    {
+      return lhs.get() == rhs;
+    }
+
+    friend bool operator ==(const T* lhs, const offset_ptr& rhs)
+    {
+      return lhs == rhs.get();
+    }
+
+    friend bool operator !=(const offset_ptr& lhs, const T* rhs)
+    {
+      return lhs.get() != rhs;
+    }
+
+    friend bool operator !=(const T* lhs, const offset_ptr& rhs)
+    {
+      return lhs != rhs.get();
+    }
+
+  private:
+
+    static ETL_CONSTANT difference_type Null_Offset = 1;
+
+    //*************************************************************************
+    /// The address of this offset pointer.
+    //*************************************************************************
+    intptr_t self() const
+    {
+      return reinterpret_cast<intptr_t>(this);
+    }
+
+    //*************************************************************************
+    /// The offset from this offset pointer to 'p'.
+    //*************************************************************************
+    difference_type to_offset(const volatile void* p) const
+    {
+      return (p == ETL_NULLPTR) ? Null_Offset : difference_type(reinterpret_cast<intptr_t>(p) - self());
+    }
+
+    difference_type offset;
+  };
+
+  template <typename T>
+  ETL_CONSTANT typename offset_ptr<T>::difference_type offset_ptr<T>::Null_Offset;
+}
+
+#endif
@@ -97,12 +97,51 @@ namespace etl
     }
   };
 
+  //*****************************************************************************
+  /// Specialise for a type that has a value that is never stored, so that
+  /// etl::optional may use that value as its empty state instead of a separate
+  /// flag. The type must be default constructible, copy assignable and equality
+  /// comparable. Derive the specialisation from etl::optional_sentinel_value, or
+  /// define 'value' as true and a static 'sentinel()' that returns the value.
+  ///\code
+  /// template <>
+  /// struct etl::optional_sentinel<Channel> : etl::optional_sentinel_value<Channel, Channel::Invalid> {};
+  ///\endcode
+  ///\ingroup utilities
+  //*****************************************************************************
+  template <typename T>
+  struct optional_sentinel
+  {
+    static ETL_CONSTANT bool value = false;
+  };
+
+  template <typename T>
+  ETL_CONSTANT bool optional_sentinel<T>::value;
+
+  //*****************************************************************************
+  /// A base for etl::optional_sentinel, for integral and enum types.
+  ///\ingroup utilities
+  //*****************************************************************************
+  template <typename T, T Sentinel>
+  struct optional_sentinel_value
+  {
+    static ETL_CONSTANT bool value = true;
+
+    static ETL_CONSTEXPR T sentinel()
+    {
+      return Sentinel;
+    }
+  };
+
+  template <typename T, T Sentinel>
+  ETL_CONSTANT bool optional_sentinel_value<T, Sentinel>::value;
+
   //*****************************************************************************
   // Implementations for fundamental and non fundamental types.
   //*****************************************************************************
   namespace private_optional
   {
-    template <typename T, bool IsDefaultConstructible = etl::is_integral<T>::value>
+    template <typename T, bool IsDefaultConstructible = etl::is_integral<T>::value || etl::optional_sentinel<T>::value>
     class optional_impl;
 
     //*****************************************************************************
@@ -679,7 +718,7 @@ namespace etl
     };
 
     //*****************************************************************************
-    // Implementation for fundamental types.
+    // Implementation for fundamental types, and types with a sentinel value.
     //*****************************************************************************
     template <typename T>
     class optional_impl<T, true>
@@ -924,7 +963,7 @@ namespace etl
       ETL_CONSTEXPR14
       bool has_value() const ETL_NOEXCEPT
       {
-        return storage.valid;
+        return storage.has_value();
       }
 
       //***************************************************************************
@@ -1065,10 +1104,9 @@ namespace etl
           storage.destroy();
         }
 
-        T* p = ::new (&storage.value) T();
-        storage.valid = true;
+        storage.construct(T());
 
-        return *p;
+        return storage.value;
       }
 
       //*************************************************************************
@@ -1084,10 +1122,9 @@ namespace etl
           storage.destroy();
         }
 
-        T* p = ::new (&storage.value) T(value1);
-        storage.valid = true;
+        storage.construct(T(value1));
 
-        return *p;
+        return storage.value;
       }
 
       //*************************************************************************
@@ -1103,10 +1140,9 @@ namespace etl
           storage.destroy();
         }
 
-        T* p = ::new (&storage.value) T(value1, value2);
-        storage.valid = true;
+        storage.construct(T(value1, value2));
 
-        return *p;
+        return storage.value;
       }
 
       //*************************************************************************
@@ -1122,10 +1158,9 @@ namespace etl
           storage.destroy();
         }
 
-        T* p = ::new (&storage.value) T(value1, value2, value3);
-        storage.valid = true;
+        storage.construct(T(value1, value2, value3));
 
-        return *p;
+        return storage.value;
       }
 
       //*************************************************************************
@@ -1141,23 +1176,22 @@ namespace etl
           storage.destroy();
         }
 
-        T* p = ::new (&storage.value) T(value1, value2, value3, value4);
-        storage.valid = true;
+        storage.construct(T(value1, value2, value3, value4));
 
-        return *p;
+        return storage.value;
       }
 #endif
 
     private:
 
       //*************************************
-      // The storage for the optional value.
+      // The storage for the optional value, with a flag.
       //*************************************
-      struct storage_type
+      struct flag_storage
       {
         //*******************************
         ETL_CONSTEXPR14
-        storage_type()
+        flag_storage()
           : value()
           , valid(false)
         {
@@ -1197,10 +1231,73 @@ namespace etl
           valid = false;
         }
 
+        //*******************************
+        ETL_CONSTEXPR14
+        bool has_value() const
+        {
+          return valid;
+        }
+
         T    value;
         bool valid;
       };
 
+      //*************************************
+      // The storage for the optional value, where
+      // the sentinel value means that it is empty.
+      //*************************************
+      struct sentinel_storage
+      {
+        //*******************************
+        ETL_CONSTEXPR14
+        sentinel_storage()
+          : value(etl::optional_sentinel<T>::sentinel())
+        {
+        }
+
+        //*******************************
+        ETL_CONSTEXPR14
+        void construct(const T& value_)
+        {
+          value = value_;
+        }
+
+#if ETL_USING_CPP11
+        //*******************************
+        ETL_CONSTEXPR14
+        void construct(T&& value_)
+        {
+          value = value_;
+        }
+
+        //*******************************
+        template <typename... TArgs>
+        ETL_CONSTEXPR14
+        void construct(TArgs&&... args)
+        {
+          value = T(etl::forward<TArgs>(args)...);
+        }
+#endif
+
+        //*******************************
+        ETL_CONSTEXPR14
+        void destroy()
+        {
+          value = etl::optional_sentinel<T>::sentinel();
+        }
+
+        //*******************************
+        ETL_CONSTEXPR14
+        bool has_value() const
+        {
+          return !(value == etl::optional_sentinel<T>::sentinel());
+        }
+
+        T value;
+      };
+
+      typedef typename etl::conditional<etl::optional_sentinel<T>::value, sentinel_storage, flag_storage>::type storage_type;
+
       storage_type storage;
     };
   }
@@ -0,0 +1,1021 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PACKED_VECTOR_INCLUDED
+#define ETL_PACKED_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "smallest.h"
+#include "span.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup packed_vector packed_vector
+/// A vector of unsigned integers of VBits bits each, packed end to end in
+/// 32 bit words, with the capacity defined at compile time.
+/// An element may span two words.
+/// Elements are accessed through proxy references. Blocks of elements are
+/// packed and unpacked a word at a time.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the packed_vector.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  class packed_vector_exception : public etl::exception
+  {
+  public:
+
+    packed_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the packed_vector.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  class packed_vector_full : public etl::packed_vector_exception
+  {
+  public:
+
+    packed_vector_full(string_type file_name_, numeric_type line_number_)
+      : etl::packed_vector_exception(ETL_ERROR_TEXT("packed_vector:full", ETL_PACKED_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the packed_vector.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  class packed_vector_out_of_bounds : public etl::packed_vector_exception
+  {
+  public:
+
+    packed_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::packed_vector_exception(ETL_ERROR_TEXT("packed_vector:bounds", ETL_PACKED_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized packed_vectors.
+  /// Can be used as a reference type for all packed_vectors with the same
+  /// number of bits per element.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  template <size_t VBits>
+  class ipacked_vector
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VBits > 0U) && (VBits <= 32U), "packed_vector: bits must be 1 to 32");
+
+    typedef typename etl::smallest_uint_for_bits<VBits>::type value_type;
+    typedef uint32_t                                          word_type;
+    typedef size_t                                            size_type;
+    typedef ptrdiff_t                                         difference_type;
+
+    static ETL_CONSTANT size_t Bits = VBits;
+
+    class iterator;
+    class const_iterator;
+
+    //*************************************************************************
+    /// A proxy reference to an element.
+    //*************************************************************************
+    class reference
+    {
+    public:
+
+      friend class ipacked_vector;
+      friend class iterator;
+
+      //*******************************
+      reference(const reference& other)
+        : p_owner(other.p_owner)
+        , index(other.index)
+      {
+      }
+
+      //*******************************
+      operator value_type() const
+      {
+        return p_owner->get(index);
+      }
+
+      //*******************************
+      reference& operator =(value_type value)
+      {
+        p_owner->set(index, value);
+        return *this;
+      }
+
+      //*******************************
+      reference& operator =(const reference& other)
+      {
+        p_owner->set(index, value_type(other));
+        return *this;
+      }
+
+      //*******************************
+      /// Swaps the referenced elements.
+      //*******************************
+      friend void swap(reference lhs, reference rhs)
+      {
+        const value_type temp = lhs;
+        lhs = value_type(rhs);
+        rhs = temp;
+      }
+
+    private:
+
+      reference(ipacked_vector* p_owner_, size_t index_)
+        : p_owner(p_owner_)
+        , index(index_)
+      {
+      }
+
+      ipacked_vector* p_owner;
+      size_t          index;
+    };
+
+    //*************************************************************************
+    /// The common parts of the iterators.
+    //*************************************************************************
+    template <typename TOwner, typename TDerived>
+    class iterator_base
+    {
+    public:
+
+      //*******************************
+      TDerived& operator ++()
+      {
+        ++index;
+        return derived();
+      }
+
+      //*******************************
+      TDerived operator ++(int)
+      {
+        TDerived temp(derived());
+        ++index;
+        return temp;
+      }
+
+      //*******************************
+      TDerived& operator --()
+      {
+        --index;
+        return derived();
+      }
+
+      //*******************************
+      TDerived operator --(int)
+      {
+        TDerived temp(derived());
+        --index;
+        return temp;
+      }
+
+      //*******************************
+      TDerived& operator +=(difference_type n)
+      {
+        index = size_t(difference_type(index) + n);
+        return derived();
+      }
+
+      //*******************************
+      TDerived& operator -=(difference_type n)
+      {
+        index = size_t(difference_type(index) - n);
+        return derived();
+      }
+
+      //*******************************
+      TDerived operator +(difference_type n) const
+      {
+        TDerived temp(derived());
+        temp += n;
+        return temp;
+      }
+
+      //*******************************
+      TDerived operator -(difference_type n) const
+      {
+        TDerived temp(derived());
+        temp -= n;
+        return temp;
+      }
+
+      //*******************************
+      friend TDerived operator +(difference_type n, const TDerived& itr)
+      {
+        return itr + n;
+      }
+
+      //*******************************
+      friend difference_type operator -(const TDerived& lhs, const TDerived& rhs)
+      {
+        return difference_type(lhs.index) - difference_type(rhs.index);
+      }
+
+      //*******************************
+      friend bool operator ==(const TDerived& lhs, const TDerived& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //*******************************
+      friend bool operator !=(const TDerived& lhs, const TDerived& rhs)
+      {
+        return lhs.index != rhs.index;
+      }
+
+      //*******************************
+      friend bool operator <(const TDerived& lhs, const TDerived& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      //*******************************
+      friend bool operator >(const TDerived& lhs, const TDerived& rhs)
+      {
+        return lhs.index > rhs.index;
+      }
+
+      //*******************************
+      friend bool operator <=(const TDerived& lhs, const TDerived& rhs)
+      {
+        return lhs.index <= rhs.index;
+      }
+
+      //*******************************
+      friend bool operator >=(const TDerived& lhs, const TDerived& rhs)
+      {
+        return lhs.index >= rhs.index;
+      }
+
+    protected:
+
+      iterator_base()
+        : p_owner(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator_base(TOwner* p_owner_, size_t index_)
+        : p_owner(p_owner_)
+        , index(index_)
+      {
+      }
+
+      TDerived& derived()
+      {
+        return static_cast<TDerived&>(*this);
+      }
+
+      const TDerived& derived() const
+      {
+        return static_cast<const TDerived&>(*this);
+      }
+
+      TOwner* p_owner;
+      size_t  index;
+    };
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public iterator_base<ipacked_vector, iterator>
+                   , public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, difference_type, void, reference>
+    {
+      typedef iterator_base<ipacked_vector, iterator> base_t;
+
+    public:
+
+      friend class ipacked_vector;
+      friend class const_iterator;
+
+      typedef typename ipacked_vector::reference reference;
+
+      iterator()
+      {
+      }
+
+      reference operator *() const
+      {
+        return reference(this->p_owner, this->index);
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return reference(this->p_owner, size_t(difference_type(this->index) + n));
+      }
+
+    private:
+
+      iterator(ipacked_vector* p_owner_, size_t index_)
+        : base_t(p_owner_, index_)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public iterator_base<const ipacked_vector, const_iterator>
+                         , public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, difference_type, void, value_type>
+    {
+      typedef iterator_base<const ipacked_vector, const_iterator> base_t;
+
+    public:
+
+      friend class ipacked_vector;
+
+      typedef value_type reference;
+
+      const_iterator()
+      {
+      }
+
+      const_iterator(const iterator& other)
+        : base_t(other.p_owner, other.index)
+      {
+      }
+
+      value_type operator *() const
+      {
+        return this->p_owner->get(this->index);
+      }
+
+      value_type operator [](difference_type n) const
+      {
+        return this->p_owner->get(size_t(difference_type(this->index) + n));
+      }
+
+    private:
+
+      const_iterator(const ipacked_vector* p_owner_, size_t index_)
+        : base_t(p_owner_, index_)
+      {
+      }
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, 0U);
+    }
+
+    const_iterator begin() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, 0U);
+    }
+
+    iterator end()
+    {
+      return iterator(this, current_size);
+    }
+
+    const_iterator end() const
+    {
+      return const_iterator(this, current_size);
+    }
+
+    const_iterator cend() const
+    {
+      return const_iterator(this, current_size);
+    }
+
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the element at index. No bounds check.
+    //*************************************************************************
+    reference operator [](size_t index)
+    {
+      return reference(this, index);
+    }
+
+    value_type operator [](size_t index) const
+    {
+      return get(index);
+    }
+
+    //*************************************************************************
+    /// Gets the element at index.
+    /// If asserts or exceptions are enabled, emits packed_vector_out_of_bounds
+    /// if the index is out of range.
+    //*************************************************************************
+    reference at(size_t index)
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(packed_vector_out_of_bounds));
+
+      return reference(this, index);
+    }
+
+    value_type at(size_t index) const
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(packed_vector_out_of_bounds));
+
+      return get(index);
+    }
+
+    //*************************************************************************
+    /// Gets the first and last elements. Undefined if empty.
+    //*************************************************************************
+    reference front()
+    {
+      return reference(this, 0U);
+    }
+
+    value_type front() const
+    {
+      return get(0U);
+    }
+
+    reference back()
+    {
+      return reference(this, current_size - 1U);
+    }
+
+    value_type back() const
+    {
+      return get(current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Gets the element at index. No bounds check.
+    //*************************************************************************
+    value_type get(size_t index) const
+    {
+      const size_t bit   = index * VBits;
+      const size_t word  = bit / Word_Bits;
+      const size_t shift = bit % Word_Bits;
+
+      word_type value = p_words[word] >> shift;
+
+      if ((shift + VBits) > Word_Bits)
+      {
+        value |= p_words[word + 1U] << (Word_Bits - shift);
+      }
+
+      return value_type(value & mask());
+    }
+
+    //*************************************************************************
+    /// Sets the element at index. No bounds check.
+    /// Only the low VBits bits of the value are stored.
+    //*************************************************************************
+    void set(size_t index, value_type value)
+    {
+      const size_t    bit   = index * VBits;
+      const size_t    word  = bit / Word_Bits;
+      const size_t    shift = bit % Word_Bits;
+      const word_type v     = word_type(value) & mask();
+
+      p_words[word] = (p_words[word] & ~(mask() << shift)) | (v << shift);
+
+      if ((shift + VBits) > Word_Bits)
+      {
+        const size_t low_bits = Word_Bits - shift;
+
+        p_words[word + 1U] = (p_words[word + 1U] & ~(mask() >> low_bits)) | (v >> low_bits);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds an element to the end.
+    /// If asserts or exceptions are enabled, emits packed_vector_full if full.
+    //*************************************************************************
+    void push_back(value_type value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(packed_vector_full));
+
+      set(current_size, value);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Removes the last element. Undefined if empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Resizes the vector. New elements are set to value.
+    /// If asserts or exceptions are enabled, emits packed_vector_full if the
+    /// size is more than the capacity.
+    //*************************************************************************
+    void resize(size_t new_size, value_type value = value_type(0))
+    {
+      ETL_ASSERT_OR_RETURN(new_size <= capacity_elements, ETL_ERROR(packed_vector_full));
+
+      while (current_size < new_size)
+      {
+        set(current_size, value);
+        ++current_size;
+      }
+
+      current_size = new_size;
+    }
+
+    //*************************************************************************
+    /// Replaces the contents with n copies of value.
+    //*************************************************************************
+    void assign(size_t n, value_type value)
+    {
+      clear();
+      resize(n, value);
+    }
+
+    //*************************************************************************
+    /// Replaces the contents with the values.
+    //*************************************************************************
+    void assign(etl::span<const value_type> values)
+    {
+      clear();
+      append(values);
+    }
+
+    //*************************************************************************
+    /// Packs the values on to the end, a word at a time.
+    /// If asserts or exceptions are enabled, emits packed_vector_full if they
+    /// do not all fit. None are added.
+    //*************************************************************************
+    void append(etl::span<const value_type> values)
+    {
+      ETL_ASSERT_OR_RETURN(values.size() <= available(), ETL_ERROR(packed_vector_full));
+
+      if (values.empty())
+      {
+        return;
+      }
+
+      const size_t bit  = current_size * VBits;
+      size_t       word = bit / Word_Bits;
+      size_t       used = bit % Word_Bits;
+
+      // Keep the elements already in the first word.
+      word_type accumulator = p_words[word] & low_mask(used);
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        const word_type v = word_type(values[i]) & mask();
+
+        accumulator |= shift_left(v, used);
+        used += VBits;
+
+        if (used >= Word_Bits)
+        {
+          p_words[word++] = accumulator;
+          used -= Word_Bits;
+
+          // The bits of v that did not fit.
+          accumulator = (used == 0U) ? word_type(0U) : (v >> (VBits - used));
+        }
+      }
+
+      if (used != 0U)
+      {
+        p_words[word] = accumulator;
+      }
+
+      current_size += values.size();
+    }
+
+    //*************************************************************************
+    /// Unpacks elements from position on to output, a word at a time.
+    ///\return The number of elements unpacked.
+    //*************************************************************************
+    size_t unpack(size_t position, etl::span<value_type> output) const
+    {
+      if (position >= current_size)
+      {
+        return 0U;
+      }
+
+      const size_t count = ((current_size - position) < output.size()) ? (current_size - position) : output.size();
+      const size_t bit   = position * VBits;
+
+      size_t    word        = bit / Word_Bits;
+      size_t    available   = Word_Bits - (bit % Word_Bits);
+      word_type accumulator = p_words[word] >> (bit % Word_Bits);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (available >= VBits)
+        {
+          output[i]    = value_type(accumulator & mask());
+          accumulator  = shift_right(accumulator, VBits);
+          available   -= VBits;
+        }
+        else
+        {
+          // The element continues in the next word.
+          const word_type next = p_words[++word];
+
+          output[i]   = value_type((accumulator | shift_left(next, available)) & mask());
+          accumulator = shift_right(next, VBits - available);
+          available   = Word_Bits - (VBits - available);
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Finds the first element equal to value.
+    /// The elements are unpacked in blocks, then searched.
+    //*************************************************************************
+    const_iterator find(value_type value) const
+    {
+      value_type buffer[Block_Size];
+
+      size_t position = 0U;
+
+      while (position < current_size)
+      {
+        const size_t n = unpack(position, etl::span<value_type>(buffer, Block_Size));
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          if (buffer[i] == value)
+          {
+            return const_iterator(this, position + i);
+          }
+        }
+
+        position += n;
+      }
+
+      return end();
+    }
+
+    iterator find(value_type value)
+    {
+      const const_iterator itr = static_cast<const ipacked_vector&>(*this).find(value);
+
+      return iterator(this, itr.index);
+    }
+
+    //*************************************************************************
+    /// Counts the elements equal to value.
+    /// The elements are unpacked in blocks, then counted.
+    //*************************************************************************
+    size_t count(value_type value) const
+    {
+      value_type buffer[Block_Size];
+
+      size_t position = 0U;
+      size_t total    = 0U;
+
+      while (position < current_size)
+      {
+        const size_t n = unpack(position, etl::span<value_type>(buffer, Block_Size));
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          total += (buffer[i] == value) ? 1U : 0U;
+        }
+
+        position += n;
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Clears the vector.
+    //*************************************************************************
+    void clear()
+    {
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the packed words. Bits past the last element are unspecified.
+    //*************************************************************************
+    etl::span<const word_type> data() const
+    {
+      return etl::span<const word_type>(p_words, ((current_size * VBits) + Word_Bits - 1U) / Word_Bits);
+    }
+
+    //*************************************************************************
+    /// Size information.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    bool full() const
+    {
+      return current_size == capacity_elements;
+    }
+
+    size_t capacity() const
+    {
+      return capacity_elements;
+    }
+
+    size_t max_size() const
+    {
+      return capacity_elements;
+    }
+
+    size_t available() const
+    {
+      return capacity_elements - current_size;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// If asserts or exceptions are enabled, emits packed_vector_full if the
+    /// other vector does not fit.
+    //*************************************************************************
+    ipacked_vector& operator =(const ipacked_vector& other)
+    {
+      if (&other != this)
+      {
+        copy_from(other);
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ipacked_vector(word_type* p_words_, size_t capacity_)
+      : p_words(p_words_)
+      , capacity_elements(capacity_)
+      , current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Copies the elements of another vector, a word at a time.
+    //*************************************************************************
+    void copy_from(const ipacked_vector& other)
+    {
+      ETL_ASSERT_OR_RETURN(other.size() <= capacity_elements, ETL_ERROR(packed_vector_full));
+
+      const etl::span<const word_type> words = other.data();
+
+      for (size_t i = 0U; i < words.size(); ++i)
+      {
+        p_words[i] = words[i];
+      }
+
+      current_size = other.size();
+    }
+
+#if defined(ETL_POLYMORPHIC_PACKED_VECTOR) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipacked_vector()
+    {
+    }
+#else
+    ~ipacked_vector()
+    {
+    }
+#endif
+
+  private:
+
+    // Not static constants, so that nothing needs a definition.
+    enum
+    {
+      Word_Bits  = 32U,
+      Block_Size = 64U
+    };
+
+    //*************************************************************************
+    static word_type mask()
+    {
+      return word_type(~word_type(0U)) >> (Word_Bits - VBits);
+    }
+
+    //*************************************************************************
+    static word_type low_mask(size_t n)
+    {
+      return (n == 0U) ? word_type(0U) : (word_type(~word_type(0U)) >> (Word_Bits - n));
+    }
+
+    //*************************************************************************
+    static word_type shift_left(word_type value, size_t n)
+    {
+      return (n >= Word_Bits) ? word_type(0U) : word_type(value << n);
+    }
+
+    //*************************************************************************
+    static word_type shift_right(word_type value, size_t n)
+    {
+      return (n >= Word_Bits) ? word_type(0U) : word_type(value >> n);
+    }
+
+    // Disable copy construction.
+    ipacked_vector(const ipacked_vector&) ETL_DELETE;
+
+    word_type* p_words;
+    size_t     capacity_elements;
+    size_t     current_size;
+  };
+
+  template <size_t VBits>
+  ETL_CONSTANT size_t ipacked_vector<VBits>::Bits;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  template <size_t VBits>
+  bool operator ==(const etl::ipacked_vector<VBits>& lhs, const etl::ipacked_vector<VBits>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    for (size_t i = 0U; i < lhs.size(); ++i)
+    {
+      if (lhs.get(i) != rhs.get(i))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  template <size_t VBits>
+  bool operator !=(const etl::ipacked_vector<VBits>& lhs, const etl::ipacked_vector<VBits>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A packed_vector with the capacity defined at compile time.
+  ///\tparam VBits     The number of bits in each element, 1 to 32.
+  ///\tparam MAX_SIZE_ The maximum number of elements.
+  ///\ingroup packed_vector
+  //***************************************************************************
+  template <size_t VBits, const size_t MAX_SIZE_>
+  class packed_vector : public etl::ipacked_vector<VBits>
+  {
+  private:
+
+    typedef etl::ipacked_vector<VBits> base;
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "packed_vector: zero capacity");
+
+  public:
+
+    typedef typename base::value_type value_type;
+    typedef typename base::word_type  word_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    /// The number of words of storage.
+    static ETL_CONSTANT size_t Words = ((MAX_SIZE_ * VBits) + 31U) / 32U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    packed_vector()
+      : base(words, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with n copies of value.
+    //*************************************************************************
+    packed_vector(size_t n, value_type value)
+      : base(words, MAX_SIZE)
+    {
+      this->assign(n, value);
+    }
+
+    //*************************************************************************
+    /// Constructor, from a span of values.
+    //*************************************************************************
+    explicit packed_vector(etl::span<const value_type> values)
+      : base(words, MAX_SIZE)
+    {
+      this->assign(values);
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    packed_vector(const packed_vector& other)
+      : base(words, MAX_SIZE)
+    {
+      this->copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    packed_vector& operator =(const packed_vector& other)
+    {
+      base::operator =(other);
+
+      return *this;
+    }
+
+  private:
+
+    word_type words[Words];
+  };
+
+  template <size_t VBits, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t packed_vector<VBits, MAX_SIZE_>::MAX_SIZE;
+
+  template <size_t VBits, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t packed_vector<VBits, MAX_SIZE_>::Words;
+}
+
+#endif
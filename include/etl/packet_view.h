@@ -0,0 +1,384 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PACKET_VIEW_INCLUDED
+#define ETL_PACKET_VIEW_INCLUDED
+
+#include "platform.h"
+#include "byte_stream.h"
+#include "endianness.h"
+#include "nth_type.h"
+#include "span.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "unaligned_type.h"
+
+#include <stddef.h>
+#include <string.h>
+
+///\defgroup packet_view packet_view
+/// A view of a packet in a byte buffer, described by a list of fields.
+/// Fields are decoded only when they are read.
+///\ingroup containers
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// The kinds of packet field.
+  ///\ingroup packet_view
+  //***************************************************************************
+  struct packet_field_kind
+  {
+    enum enum_type
+    {
+      Fixed,    ///< A fixed number of bytes.
+      Sized_By, ///< A number of bytes given by an earlier field.
+      Rest      ///< The remaining bytes. Must be the last field.
+    };
+  };
+
+  //***************************************************************************
+  /// An arithmetic field, stored with the given endianness.
+  /// Reads as a T.
+  ///\ingroup packet_view
+  //***************************************************************************
+  template <typename T, int Endian = etl::endian::big>
+  struct packet_value
+  {
+    ETL_STATIC_ASSERT(etl::is_arithmetic<T>::value, "Packet values must be arithmetic");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT packet_field_kind::enum_type Kind = packet_field_kind::Fixed;
+    static ETL_CONSTANT size_t                       Size = sizeof(T);
+
+    static value_type decode(const char* p, size_t)
+    {
+      etl::unaligned_type<T, Endian> value;
+      memcpy(value.data(), p, sizeof(T));
+
+      return value.value();
+    }
+  };
+
+  template <typename T, int Endian>
+  ETL_CONSTANT packet_field_kind::enum_type packet_value<T, Endian>::Kind;
+
+  template <typename T, int Endian>
+  ETL_CONSTANT size_t packet_value<T, Endian>::Size;
+
+  //***************************************************************************
+  /// A field of VSize bytes.
+  /// Reads as a span of the bytes. Also used for reserved bytes.
+  ///\ingroup packet_view
+  //***************************************************************************
+  template <size_t VSize>
+  struct packet_bytes
+  {
+    typedef etl::span<const char> value_type;
+
+    static ETL_CONSTANT packet_field_kind::enum_type Kind = packet_field_kind::Fixed;
+    static ETL_CONSTANT size_t                       Size = VSize;
+
+    static value_type decode(const char* p, size_t size)
+    {
+      return value_type(p, size);
+    }
+  };
+
+  template <size_t VSize>
+  ETL_CONSTANT packet_field_kind::enum_type packet_bytes<VSize>::Kind;
+
+  template <size_t VSize>
+  ETL_CONSTANT size_t packet_bytes<VSize>::Size;
+
+  //***************************************************************************
+  /// A field with the number of bytes given by the value of the earlier field
+  /// at VLength_Index.
+  /// Reads as a span of the bytes.
+  ///\ingroup packet_view
+  //***************************************************************************
+  template <size_t VLength_Index>
+  struct packet_bytes_sized_by
+  {
+    typedef etl::span<const char> value_type;
+
+    static ETL_CONSTANT packet_field_kind::enum_type Kind         = packet_field_kind::Sized_By;
+    static ETL_CONSTANT size_t                       Length_Index = VLength_Index;
+
+    static value_type decode(const char* p, size_t size)
+    {
+      return value_type(p, size);
+    }
+  };
+
+  template <size_t VLength_Index>
+  ETL_CONSTANT packet_field_kind::enum_type packet_bytes_sized_by<VLength_Index>::Kind;
+
+  template <size_t VLength_Index>
+  ETL_CONSTANT size_t packet_bytes_sized_by<VLength_Index>::Length_Index;
+
+  //***************************************************************************
+  /// A field with the remaining bytes of the buffer.
+  /// Reads as a span of the bytes.
+  ///\ingroup packet_view
+  //***************************************************************************
+  struct packet_bytes_rest
+  {
+    typedef etl::span<const char> value_type;
+
+    static ETL_CONSTANT packet_field_kind::enum_type Kind = packet_field_kind::Rest;
+
+    static value_type decode(const char* p, size_t size)
+    {
+      return value_type(p, size);
+    }
+  };
+
+  //***************************************************************************
+  /// A view of a packet laid out as the list of fields TFields.
+  /// Nothing is copied or decoded on construction. get<I>() reads field I
+  /// from the buffer. The offset of a field is the sum of the sizes of the
+  /// fields before it, so is a compile time constant up to the first field
+  /// that is sized by another.
+  /// Check is_valid() before reading fields. get<I>() does not check the
+  /// buffer size.
+  ///\code
+  /// typedef etl::packet_view<etl::packet_value<uint8_t>,                     // 0: type
+  ///                          etl::packet_value<uint16_t, etl::endian::big>,  // 1: payload length
+  ///                          etl::packet_bytes<2>,                           // 2: reserved
+  ///                          etl::packet_bytes_sized_by<1>,                  // 3: payload
+  ///                          etl::packet_value<uint32_t, etl::endian::big> > // 4: crc
+  ///                          frame_view;
+  ///
+  /// frame_view frame(buffer);
+  ///
+  /// if (frame.is_valid() && (frame.get<0>() == Data))
+  /// {
+  ///   etl::span<const char> payload = frame.get<3>();
+  /// }
+  ///\endcode
+  ///\ingroup packet_view
+  //***************************************************************************
+  template <typename... TFields>
+  class packet_view
+  {
+  public:
+
+    static ETL_CONSTANT size_t Fields = sizeof...(TFields);
+
+    ETL_STATIC_ASSERT(Fields > 0U, "No fields");
+
+    //*************************************************************************
+    /// The type of field I.
+    //*************************************************************************
+    template <size_t I>
+    using field_type = etl::nth_type_t<I, TFields...>;
+
+    //*************************************************************************
+    /// The type read from field I.
+    //*************************************************************************
+    template <size_t I>
+    using value_type = typename field_type<I>::value_type;
+
+    //*************************************************************************
+    /// Constructs from a span of the buffer.
+    //*************************************************************************
+    explicit packet_view(etl::span<const char> buffer_)
+      : p_buffer(buffer_.data())
+      , length(buffer_.size())
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a buffer and length.
+    //*************************************************************************
+    packet_view(const void* p_buffer_, size_t length_)
+      : p_buffer(static_cast<const char*>(p_buffer_))
+      , length(length_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from the unread data of a byte stream reader.
+    /// Skip size_bytes() in the reader to move to the next packet.
+    //*************************************************************************
+    explicit packet_view(const etl::byte_stream_reader& reader)
+      : p_buffer(reader.free_data().data())
+      , length(reader.free_data().size())
+    {
+    }
+
+    //*************************************************************************
+    /// Reads field I.
+    //*************************************************************************
+    template <size_t I>
+    value_type<I> get() const
+    {
+      ETL_STATIC_ASSERT(I < Fields, "Field index out of range");
+
+      const size_t offset = offset_of<I>();
+
+      return field_type<I>::decode(p_buffer + offset, field_size<I>(offset));
+    }
+
+    //*************************************************************************
+    /// The offset of field I, or of the end of the packet for I == Fields.
+    //*************************************************************************
+    template <size_t I>
+    size_t offset_of() const
+    {
+      ETL_STATIC_ASSERT(I <= Fields, "Field index out of range");
+
+      return offset_at(etl::integral_constant<size_t, I>());
+    }
+
+    //*************************************************************************
+    /// The size of field I, in bytes.
+    //*************************************************************************
+    template <size_t I>
+    size_t size_of() const
+    {
+      ETL_STATIC_ASSERT(I < Fields, "Field index out of range");
+
+      return field_size<I>(offset_of<I>());
+    }
+
+    //*************************************************************************
+    /// The size of the packet, in bytes.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return offset_of<Fields>();
+    }
+
+    //*************************************************************************
+    /// Whether the buffer holds all of the fields.
+    /// Each size is only read once the field holding it is known to be in the
+    /// buffer.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return check(etl::integral_constant<size_t, 0U>(), 0U);
+    }
+
+    //*************************************************************************
+    /// The whole buffer.
+    //*************************************************************************
+    etl::span<const char> data() const
+    {
+      return etl::span<const char>(p_buffer, length);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Offsets, as the sum of the sizes of the earlier fields.
+    //*************************************************************************
+    size_t offset_at(etl::integral_constant<size_t, 0U>) const
+    {
+      return 0U;
+    }
+
+    template <size_t I>
+    size_t offset_at(etl::integral_constant<size_t, I>) const
+    {
+      const size_t offset = offset_at(etl::integral_constant<size_t, I - 1U>());
+
+      return offset + field_size<I - 1U>(offset);
+    }
+
+    //*************************************************************************
+    /// The size of field I at 'offset', by kind.
+    //*************************************************************************
+    template <size_t I>
+    size_t field_size(size_t offset) const
+    {
+      typedef etl::integral_constant<packet_field_kind::enum_type, field_type<I>::Kind> kind;
+
+      return field_size<I>(offset, kind());
+    }
+
+    template <size_t I>
+    size_t field_size(size_t, etl::integral_constant<packet_field_kind::enum_type, packet_field_kind::Fixed>) const
+    {
+      return field_type<I>::Size;
+    }
+
+    template <size_t I>
+    size_t field_size(size_t, etl::integral_constant<packet_field_kind::enum_type, packet_field_kind::Sized_By>) const
+    {
+      ETL_STATIC_ASSERT(field_type<I>::Length_Index < I, "The length must be in an earlier field");
+      ETL_STATIC_ASSERT(etl::is_integral<value_type<field_type<I>::Length_Index> >::value, "The length must be an integral field");
+
+      return static_cast<size_t>(get<field_type<I>::Length_Index>());
+    }
+
+    template <size_t I>
+    size_t field_size(size_t offset, etl::integral_constant<packet_field_kind::enum_type, packet_field_kind::Rest>) const
+    {
+      ETL_STATIC_ASSERT(I == (Fields - 1U), "The rest of the bytes must be the last field");
+
+      return (offset < length) ? (length - offset) : 0U;
+    }
+
+    //*************************************************************************
+    /// Checks that each field fits, in order.
+    //*************************************************************************
+    bool check(etl::integral_constant<size_t, Fields>, size_t offset) const
+    {
+      return offset <= length;
+    }
+
+    template <size_t I>
+    bool check(etl::integral_constant<size_t, I>, size_t offset) const
+    {
+      if (offset > length)
+      {
+        return false;
+      }
+
+      const size_t size = field_size<I>(offset);
+
+      return (size <= (length - offset)) && check(etl::integral_constant<size_t, I + 1U>(), offset + size);
+    }
+
+    const char* p_buffer;
+    size_t      length;
+  };
+
+  template <typename... TFields>
+  ETL_CONSTANT size_t packet_view<TFields...>::Fields;
+}
+
+#endif
+#endif
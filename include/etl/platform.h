@@ -183,6 +183,24 @@ SOFTWARE.
   #define ETL_HAS_STRING_TRUNCATION_CHECKS 1
 #endif
 
+//*************************************
+// Option to disable the shortest round trip formatting of floating point values.
+// Removes the 1K table of cached powers for targets where size matters.
+#if defined(ETL_DISABLE_SHORTEST_FLOAT_FORMAT) || ETL_NOT_USING_64BIT_TYPES
+  #define ETL_HAS_SHORTEST_FLOAT_FORMAT 0
+#else
+  #define ETL_HAS_SHORTEST_FLOAT_FORMAT 1
+#endif
+
+//*************************************
+// Option to disable the Eisel-Lemire parsing of float and double values.
+// Removes the 10K table of powers of five for targets where size matters.
+#if defined(ETL_DISABLE_FAST_FLOAT_PARSE) || ETL_NOT_USING_64BIT_TYPES
+  #define ETL_HAS_FAST_FLOAT_PARSE 0
+#else
+  #define ETL_HAS_FAST_FLOAT_PARSE 1
+#endif
+
 //*************************************
 // Option to disable clear-after-use functionality for strings.
 #if defined(ETL_DISABLE_STRING_CLEAR_AFTER_USE)
@@ -231,6 +249,23 @@ SOFTWARE.
 #define ETL_HAS_ICIRCULAR_BUFFER_REPAIR 0
 #endif
 
+//*************************************
+// Option to store the hash of each element in the unordered containers' nodes.
+#if defined(ETL_UNORDERED_CACHE_HASH_ENABLE)
+  #define ETL_HAS_UNORDERED_CACHED_HASH 1
+#else
+  #define ETL_HAS_UNORDERED_CACHED_HASH 0
+#endif
+
+//*************************************
+// Option to round the unordered containers' bucket counts up to a power of 2,
+// so that a hash is mapped to a bucket with a mask instead of a division.
+#if defined(ETL_UNORDERED_POW2_BUCKETS_ENABLE)
+  #define ETL_HAS_UNORDERED_POW2_BUCKETS 1
+#else
+  #define ETL_HAS_UNORDERED_POW2_BUCKETS 0
+#endif
+
 //*************************************
 // Indicate if C++ exceptions are enabled.
 #if defined(ETL_THROW_EXCEPTIONS)
@@ -512,6 +547,10 @@ namespace etl
     static ETL_CONSTANT bool has_mutable_array_view           = (ETL_HAS_MUTABLE_ARRAY_VIEW == 1);
     static ETL_CONSTANT bool has_ideque_repair                = (ETL_HAS_IDEQUE_REPAIR == 1);
     static ETL_CONSTANT bool has_virtual_messages             = (ETL_HAS_VIRTUAL_MESSAGES == 1);
+    static ETL_CONSTANT bool has_unordered_cached_hash        = (ETL_HAS_UNORDERED_CACHED_HASH == 1);
+    static ETL_CONSTANT bool has_unordered_pow2_buckets       = (ETL_HAS_UNORDERED_POW2_BUCKETS == 1);
+    static ETL_CONSTANT bool has_shortest_float_format        = (ETL_HAS_SHORTEST_FLOAT_FORMAT == 1);
+    static ETL_CONSTANT bool has_fast_float_parse             = (ETL_HAS_FAST_FLOAT_PARSE == 1);
 
     // Is...
     static ETL_CONSTANT bool is_debug_build                   = (ETL_IS_DEBUG_BUILD == 1);
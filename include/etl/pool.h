@@ -47,14 +47,16 @@ namespace etl
 {
   //*************************************************************************
   /// A templated pool implementation that uses a fixed size pool.
+  /// VAlignment may be larger than the alignment of T, to align and pad each
+  /// item to a cache line or DMA boundary. e.g. etl::pool<T, 16, 64>
   ///\ingroup pool
   //*************************************************************************
-  template <typename T, const size_t VSize>
-  class pool : public etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, VSize>
+  template <typename T, const size_t VSize, const size_t VAlignment = etl::alignment_of<T>::value>
+  class pool : public etl::generic_pool<sizeof(T), VAlignment, VSize>
   {
   private:
 
-    typedef etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, VSize> base_t;
+    typedef etl::generic_pool<sizeof(T), VAlignment, VSize> base_t;
 
   public:
 
@@ -181,13 +183,14 @@ namespace etl
   //*************************************************************************
   /// A templated pool implementation that uses a fixed size pool.
   /// The storage for the pool is supplied externally.
+  /// VAlignment may be larger than the alignment of T, as for etl::pool.
   ///\ingroup pool
   //*************************************************************************
-  template <typename T>
-  class pool_ext : public etl::generic_pool_ext<sizeof(T), etl::alignment_of<T>::value>
+  template <typename T, const size_t VAlignment = etl::alignment_of<T>::value>
+  class pool_ext : public etl::generic_pool_ext<sizeof(T), VAlignment>
   {
   private:
-    typedef etl::generic_pool_ext<sizeof(T), etl::alignment_of<T>::value> base_t;
+    typedef etl::generic_pool_ext<sizeof(T), VAlignment> base_t;
 
   public:
     using base_t::ALIGNMENT;
@@ -0,0 +1,948 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_ATOMIC_INCLUDED
+#define ETL_POOL_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "ipool.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "alignment.h"
+#include "log.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  template <size_t VCacheSize>
+  class pool_atomic_cache;
+
+  //***************************************************************************
+  ///\ingroup pool
+  /// The base for a pool that may be shared between threads or cores.
+  /// The free list is a lock-free stack of item indexes. The head holds a tag
+  /// that changes with every update, so a stale compare and swap always fails.
+  /// Each thread may also keep a small etl::pool_atomic_cache, so that most
+  /// allocations and releases do not touch the shared list.
+  //***************************************************************************
+  class ipool_atomic
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      ETL_ASSERT_OR_RETURN(is_in_pool(p_object), ETL_ERROR(etl::pool_object_not_in_pool));
+
+      uint32_t index = index_of(p_object);
+
+      push_chain(index, index, 1U);
+    }
+
+    //*************************************************************************
+    /// Release all objects in the pool.
+    /// Must only be called when no other thread is using the pool or its caches.
+    //*************************************************************************
+    void release_all()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      const char* p = static_cast<const char*>(p_object);
+
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((Item_Size * Max_Size) - Item_Size));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if ETL_IS_DEBUG_BUILD
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % Item_Size) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of items in the shared free list.
+    /// Items held in caches are not included.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of items that are not in the shared free list.
+    /// Items held in caches are included.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if all of the items are in the shared free list.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the shared free list is empty.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+  protected:
+
+    template <size_t VCacheSize>
+    friend class pool_atomic_cache;
+
+    //*************************************************************************
+    /// Constructor
+    /// initialise() must be called once the derived class is constructed.
+    //*************************************************************************
+    ipool_atomic(char* p_buffer_, uint32_t item_size_, uint32_t max_size_, etl::atomic<uint32_t>* p_links_, uint32_t index_bits_)
+      : p_buffer(p_buffer_)
+      , p_links(p_links_)
+      , head(0U)
+      , items_allocated(0U)
+      , Item_Size(item_size_)
+      , Max_Size(max_size_)
+      , Index_Bits(index_bits_)
+      , Index_Mask((uint32_t(1U) << index_bits_) - 1U)
+    {
+    }
+
+    //*************************************************************************
+    /// Links all of the items into the free list.
+    //*************************************************************************
+    void initialise()
+    {
+      // Indexes are 1 based. 0 is the end of the list.
+      for (uint32_t i = 0U; i < Max_Size; ++i)
+      {
+        p_links[i].store((i + 2U) > Max_Size ? 0U : (i + 2U), etl::memory_order_relaxed);
+      }
+
+      items_allocated.store(0U, etl::memory_order_relaxed);
+      head.store(Max_Size > 0U ? 1U : 0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipool_atomic()
+    {
+    }
+#else
+    ~ipool_atomic()
+    {
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item from the pool.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      uint32_t index = pop_index();
+
+      if (index == 0U)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::pool_no_allocation));
+        return ETL_NULLPTR;
+      }
+
+      return item_at(index);
+    }
+
+    //*************************************************************************
+    /// Takes the first free index, or 0 if there are none.
+    //*************************************************************************
+    uint32_t pop_index()
+    {
+      uint32_t current = head.load(etl::memory_order_acquire);
+
+      while ((current & Index_Mask) != 0U)
+      {
+        uint32_t index = current & Index_Mask;
+
+        // May be stale if another thread takes the item first, but then the tag will not match.
+        uint32_t next = p_links[index - 1U].load(etl::memory_order_relaxed);
+
+        if (head.compare_exchange_weak(current, next_head(current, next), etl::memory_order_acq_rel))
+        {
+          items_allocated.fetch_add(1U, etl::memory_order_relaxed);
+          return index;
+        }
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Returns a chain of linked indexes to the free list.
+    //*************************************************************************
+    void push_chain(uint32_t first, uint32_t last, uint32_t count)
+    {
+      uint32_t current = head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        p_links[last - 1U].store(current & Index_Mask, etl::memory_order_relaxed);
+      } while (!head.compare_exchange_weak(current, next_head(current, first), etl::memory_order_acq_rel));
+
+      items_allocated.fetch_sub(count, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The new head, with the tag moved on.
+    //*************************************************************************
+    uint32_t next_head(uint32_t current, uint32_t index) const
+    {
+      return (((current >> Index_Bits) + 1U) << Index_Bits) | index;
+    }
+
+    //*************************************************************************
+    char* item_at(uint32_t index) const
+    {
+      return p_buffer + ((index - 1U) * Item_Size);
+    }
+
+    //*************************************************************************
+    uint32_t index_of(const void* p_object) const
+    {
+      return uint32_t((static_cast<const char*>(p_object) - p_buffer) / Item_Size) + 1U;
+    }
+
+    // Disable copy construction and assignment.
+    ipool_atomic(const ipool_atomic&) ETL_DELETE;
+    ipool_atomic& operator =(const ipool_atomic&) ETL_DELETE;
+
+    char*                  p_buffer;
+    etl::atomic<uint32_t>* p_links;         ///< The next free index for each item.
+    etl::atomic<uint32_t>  head;            ///< The tag and the index of the first free item.
+    etl::atomic<uint32_t>  items_allocated; ///< The number of items not in the free list.
+
+    const uint32_t Item_Size;  ///< The size of allocated items.
+    const uint32_t Max_Size;   ///< The maximum number of objects that can be allocated.
+    const uint32_t Index_Bits; ///< The number of bits of the head that hold the index.
+    const uint32_t Index_Mask;
+  };
+
+  //*************************************************************************
+  /// A templated pool implementation that uses a fixed size pool, and that
+  /// may be shared between threads or cores.
+  /// At least 8 bits of the 32 bit head are left for the tag.
+  ///\ingroup pool
+  //*************************************************************************
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  class generic_pool_atomic : public etl::ipool_atomic
+  {
+  private:
+
+    static ETL_CONSTANT uint32_t Index_Bits = etl::log2<VSize>::value + 1U;
+
+  public:
+
+    ETL_STATIC_ASSERT(VSize > 0U, "Pool must not be empty");
+    ETL_STATIC_ASSERT(Index_Bits <= 24U, "Pool too large");
+
+    static ETL_CONSTANT size_t SIZE      = VSize;
+    static ETL_CONSTANT size_t ALIGNMENT = VAlignment;
+    static ETL_CONSTANT size_t TYPE_SIZE = VTypeSize;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_pool_atomic()
+      : etl::ipool_atomic(reinterpret_cast<char*>(&buffer[0]), Element_Size, VSize, links, Index_Bits)
+    {
+      // The links are only constructed once the base is.
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::allocate<U>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      U* p = ipool_atomic::allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      U* p = ipool_atomic::allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      U* p = ipool_atomic::allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      U* p = ipool_atomic::allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      U* p = ipool_atomic::allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      U* p = ipool_atomic::allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      p_object->~U();
+      ipool_atomic::release(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char      value[VTypeSize]; ///< Storage for value type.
+      typename  etl::type_with_alignment<VAlignment>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[VSize];
+
+    ///< The free list links.
+    etl::atomic<uint32_t> links[VSize];
+
+    static ETL_CONSTANT uint32_t Element_Size = sizeof(Element);
+
+    // Should not be copied.
+    generic_pool_atomic(const generic_pool_atomic&) ETL_DELETE;
+    generic_pool_atomic& operator =(const generic_pool_atomic&) ETL_DELETE;
+  };
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::ALIGNMENT;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::TYPE_SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT uint32_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::Index_Bits;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT uint32_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::Element_Size;
+
+  //*************************************************************************
+  /// A per thread (or per core) cache of free items from an etl::ipool_atomic.
+  /// Must only be used by the thread that owns it.
+  /// When empty, it takes half of its capacity from the pool. When full,
+  /// it returns half of its capacity to the pool in one operation.
+  /// Items held in the cache are returned to the pool when it is destroyed.
+  /// Items may be released to any cache of the same pool, or to the pool itself.
+  ///\ingroup pool
+  //*************************************************************************
+  template <size_t VCacheSize>
+  class pool_atomic_cache
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VCacheSize >= 2U, "Cache size must be at least 2");
+
+    static ETL_CONSTANT size_t SIZE = VCacheSize;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    explicit pool_atomic_cache(etl::ipool_atomic& pool_)
+      : pool(pool_)
+      , count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor
+    /// Returns the cached items to the pool.
+    //*************************************************************************
+    ~pool_atomic_cache()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache, refilling it from the pool if empty.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > pool.Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      if (count == 0U)
+      {
+        refill();
+
+        if (count == 0U)
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(etl::pool_no_allocation));
+          return ETL_NULLPTR;
+        }
+      }
+
+      return reinterpret_cast<T*>(pool.item_at(indexes[--count]));
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > pool.Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object to the cache, returning half of the cache to the pool if full.
+    /// If asserts or exceptions are enabled and the object does not belong to the
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      ETL_ASSERT_OR_RETURN(pool.is_in_pool(p_object), ETL_ERROR(etl::pool_object_not_in_pool));
+
+      if (count == VCacheSize)
+      {
+        give_back(VCacheSize / 2U);
+      }
+
+      indexes[count++] = pool.index_of(p_object);
+    }
+
+    //*************************************************************************
+    /// Returns all of the cached items to the pool.
+    //*************************************************************************
+    void flush()
+    {
+      give_back(count);
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items held in the cache.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of free items held in the cache.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return VCacheSize;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Takes up to half of the cache's capacity from the pool.
+    //*************************************************************************
+    void refill()
+    {
+      while (count < (VCacheSize / 2U))
+      {
+        uint32_t index = pool.pop_index();
+
+        if (index == 0U)
+        {
+          break;
+        }
+
+        indexes[count++] = index;
+      }
+    }
+
+    //*************************************************************************
+    /// Links the top n cached items together and pushes them to the pool at once.
+    //*************************************************************************
+    void give_back(size_t n)
+    {
+      if (n > 0U)
+      {
+        size_t first = count - n;
+
+        for (size_t i = first; i < (count - 1U); ++i)
+        {
+          pool.p_links[indexes[i] - 1U].store(indexes[i + 1U], etl::memory_order_relaxed);
+        }
+
+        pool.push_chain(indexes[first], indexes[count - 1U], uint32_t(n));
+
+        count = first;
+      }
+    }
+
+    // Should not be copied.
+    pool_atomic_cache(const pool_atomic_cache&) ETL_DELETE;
+    pool_atomic_cache& operator =(const pool_atomic_cache&) ETL_DELETE;
+
+    etl::ipool_atomic& pool;
+    uint32_t           indexes[VCacheSize]; ///< The cached free item indexes.
+    size_t             count;               ///< The number of cached items.
+  };
+
+  template <size_t VCacheSize>
+  ETL_CONSTANT size_t pool_atomic_cache<VCacheSize>::SIZE;
+}
+
+#endif
+#endif
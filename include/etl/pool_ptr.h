@@ -0,0 +1,799 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_PTR_INCLUDED
+#define ETL_POOL_PTR_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "nullptr.h"
+#include "utility.h"
+#include "type_traits.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_pool_ptr
+  {
+    //*************************************************************************
+    /// The pool slot for an etl::pool_ptr.
+    /// Holds the owning pool alongside the value.
+    //*************************************************************************
+    template <typename T>
+    struct unique_node
+    {
+#if ETL_USING_CPP11 && !defined(ETL_POOL_PTR_FORCE_CPP03_IMPLEMENTATION)
+      template <typename... TArgs>
+      explicit unique_node(etl::ipool& pool, TArgs&&... args)
+        : p_pool(&pool)
+        , value(etl::forward<TArgs>(args)...)
+      {
+      }
+#else
+      explicit unique_node(etl::ipool& pool)
+        : p_pool(&pool)
+        , value()
+      {
+      }
+
+      template <typename T1>
+      unique_node(etl::ipool& pool, const T1& value1)
+        : p_pool(&pool)
+        , value(value1)
+      {
+      }
+
+      template <typename T1, typename T2>
+      unique_node(etl::ipool& pool, const T1& value1, const T2& value2)
+        : p_pool(&pool)
+        , value(value1, value2)
+      {
+      }
+
+      template <typename T1, typename T2, typename T3>
+      unique_node(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3)
+        : p_pool(&pool)
+        , value(value1, value2, value3)
+      {
+      }
+
+      template <typename T1, typename T2, typename T3, typename T4>
+      unique_node(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+        : p_pool(&pool)
+        , value(value1, value2, value3, value4)
+      {
+      }
+#endif
+
+      etl::ipool* p_pool;
+      T           value;
+    };
+
+    //*************************************************************************
+    /// The pool slot for an etl::pool_shared_ptr.
+    /// Holds the owning pool and the reference count alongside the value.
+    //*************************************************************************
+    template <typename T, typename TCounter>
+    struct shared_node
+    {
+#if ETL_USING_CPP11 && !defined(ETL_POOL_PTR_FORCE_CPP03_IMPLEMENTATION)
+      template <typename... TArgs>
+      explicit shared_node(etl::ipool& pool, TArgs&&... args)
+        : p_pool(&pool)
+        , count(1)
+        , value(etl::forward<TArgs>(args)...)
+      {
+      }
+#else
+      explicit shared_node(etl::ipool& pool)
+        : p_pool(&pool)
+        , count(1)
+        , value()
+      {
+      }
+
+      template <typename T1>
+      shared_node(etl::ipool& pool, const T1& value1)
+        : p_pool(&pool)
+        , count(1)
+        , value(value1)
+      {
+      }
+
+      template <typename T1, typename T2>
+      shared_node(etl::ipool& pool, const T1& value1, const T2& value2)
+        : p_pool(&pool)
+        , count(1)
+        , value(value1, value2)
+      {
+      }
+
+      template <typename T1, typename T2, typename T3>
+      shared_node(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3)
+        : p_pool(&pool)
+        , count(1)
+        , value(value1, value2, value3)
+      {
+      }
+
+      template <typename T1, typename T2, typename T3, typename T4>
+      shared_node(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+        : p_pool(&pool)
+        , count(1)
+        , value(value1, value2, value3, value4)
+      {
+      }
+#endif
+
+      etl::ipool* p_pool;
+      TCounter    count;
+      T           value;
+
+    private:
+
+      // The count may not be copyable.
+      shared_node(const shared_node&) ETL_DELETE;
+      shared_node& operator =(const shared_node&) ETL_DELETE;
+    };
+
+    //*************************************************************************
+    /// Allocates a node from the pool.
+    /// Returns ETL_NULLPTR if the pool is exhausted and asserts do not throw.
+    //*************************************************************************
+    template <typename TNode>
+    TNode* allocate_node(etl::ipool& pool)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!pool.full(), ETL_ERROR(etl::pool_no_allocation), ETL_NULLPTR);
+
+      return pool.allocate<TNode>();
+    }
+  }
+
+  //***************************************************************************
+  /// A unique owning pointer to an object in an etl::ipool.
+  /// The owning pool is stored in the pool slot, so the pointer is one word
+  /// and needs no deleter. Create with etl::make_pool_ptr.
+  /// The pool item size must be at least sizeof(pool_ptr<T>::node_type).
+  ///\ingroup memory
+  //***************************************************************************
+  template <typename T>
+  class pool_ptr
+  {
+  public:
+
+    typedef T                                  element_type;
+    typedef T*                                 pointer;
+    typedef T&                                 reference;
+    typedef etl::private_pool_ptr::unique_node<T> node_type;
+
+    //*********************************
+    ETL_CONSTEXPR pool_ptr() ETL_NOEXCEPT
+      : p_node(ETL_NULLPTR)
+    {
+    }
+
+    //*********************************
+    ETL_CONSTEXPR pool_ptr(etl::nullptr_t) ETL_NOEXCEPT
+      : p_node(ETL_NULLPTR)
+    {
+    }
+
+    //*********************************
+    /// Takes ownership of a node constructed in a pool.
+    //*********************************
+    ETL_CONSTEXPR explicit pool_ptr(node_type* p_node_) ETL_NOEXCEPT
+      : p_node(p_node_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*********************************
+    pool_ptr(pool_ptr&& other) ETL_NOEXCEPT
+      : p_node(other.p_node)
+    {
+      other.p_node = ETL_NULLPTR;
+    }
+#else
+    //*********************************
+    pool_ptr(pool_ptr& other) ETL_NOEXCEPT
+      : p_node(other.p_node)
+    {
+      other.p_node = ETL_NULLPTR;
+    }
+
+    //*********************************
+    /// Carries ownership out of a temporary, such as the result of etl::make_pool_ptr.
+    //*********************************
+    struct pool_ptr_ref
+    {
+      explicit pool_ptr_ref(node_type* p_node_)
+        : p_node(p_node_)
+      {
+      }
+
+      node_type* p_node;
+    };
+
+    //*********************************
+    pool_ptr(pool_ptr_ref ref) ETL_NOEXCEPT
+      : p_node(ref.p_node)
+    {
+    }
+
+    //*********************************
+    operator pool_ptr_ref() ETL_NOEXCEPT
+    {
+      return pool_ptr_ref(release());
+    }
+#endif
+
+    //*********************************
+    ~pool_ptr()
+    {
+      reset();
+    }
+
+    //*********************************
+    pointer get() const ETL_NOEXCEPT
+    {
+      return (p_node != ETL_NULLPTR) ? &p_node->value : ETL_NULLPTR;
+    }
+
+    //*********************************
+    /// Destroys the object and returns it to its pool.
+    //*********************************
+    void reset() ETL_NOEXCEPT
+    {
+      if (p_node != ETL_NULLPTR)
+      {
+        node_type* p_old = p_node;
+        p_node = ETL_NULLPTR;
+
+        p_old->p_pool->destroy(p_old);
+      }
+    }
+
+    //*********************************
+    /// Gives up ownership of the node without destroying it.
+    //*********************************
+    node_type* release() ETL_NOEXCEPT
+    {
+      node_type* p_old = p_node;
+      p_node = ETL_NULLPTR;
+
+      return p_old;
+    }
+
+    //*********************************
+    void swap(pool_ptr& other) ETL_NOEXCEPT
+    {
+      node_type* p_temp = p_node;
+      p_node       = other.p_node;
+      other.p_node = p_temp;
+    }
+
+    //*********************************
+    ETL_CONSTEXPR operator bool() const ETL_NOEXCEPT
+    {
+      return (p_node != ETL_NULLPTR);
+    }
+
+    //*********************************
+    pool_ptr& operator =(etl::nullptr_t) ETL_NOEXCEPT
+    {
+      reset();
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************
+    pool_ptr& operator =(pool_ptr&& other) ETL_NOEXCEPT
+    {
+      if (&other != this)
+      {
+        reset();
+        p_node = other.release();
+      }
+
+      return *this;
+    }
+#else
+    //*********************************
+    pool_ptr& operator =(pool_ptr& other) ETL_NOEXCEPT
+    {
+      if (&other != this)
+      {
+        reset();
+        p_node = other.release();
+      }
+
+      return *this;
+    }
+
+    //*********************************
+    pool_ptr& operator =(pool_ptr_ref ref) ETL_NOEXCEPT
+    {
+      reset();
+      p_node = ref.p_node;
+
+      return *this;
+    }
+#endif
+
+    //*********************************
+    reference operator *() const
+    {
+      return p_node->value;
+    }
+
+    //*********************************
+    pointer operator ->() const ETL_NOEXCEPT
+    {
+      return &p_node->value;
+    }
+
+  private:
+
+#if ETL_USING_CPP11
+    pool_ptr(const pool_ptr&) ETL_DELETE;
+    pool_ptr& operator =(const pool_ptr&) ETL_DELETE;
+#endif
+
+    node_type* p_node;
+  };
+
+  //***************************************************************************
+  /// A shared owning pointer to an object in an etl::ipool.
+  /// The owning pool and the reference count are stored in the pool slot,
+  /// so the pointer is one word and needs no deleter.
+  /// Create with etl::make_pool_shared_ptr.
+  /// The pool item size must be at least sizeof(pool_shared_ptr<T>::node_type).
+  /// Use etl::atomic_int32_t for TCounter if copies are shared between threads.
+  ///\ingroup memory
+  //***************************************************************************
+  template <typename T, typename TCounter = int32_t>
+  class pool_shared_ptr
+  {
+  public:
+
+    typedef T                                                element_type;
+    typedef T*                                               pointer;
+    typedef T&                                               reference;
+    typedef TCounter                                         counter_type;
+    typedef etl::private_pool_ptr::shared_node<T, TCounter> node_type;
+
+    //*********************************
+    ETL_CONSTEXPR pool_shared_ptr() ETL_NOEXCEPT
+      : p_node(ETL_NULLPTR)
+    {
+    }
+
+    //*********************************
+    ETL_CONSTEXPR pool_shared_ptr(etl::nullptr_t) ETL_NOEXCEPT
+      : p_node(ETL_NULLPTR)
+    {
+    }
+
+    //*********************************
+    /// Takes ownership of a node constructed in a pool.
+    /// The node's count must account for this pointer.
+    //*********************************
+    ETL_CONSTEXPR explicit pool_shared_ptr(node_type* p_node_) ETL_NOEXCEPT
+      : p_node(p_node_)
+    {
+    }
+
+    //*********************************
+    pool_shared_ptr(const pool_shared_ptr& other) ETL_NOEXCEPT
+      : p_node(other.p_node)
+    {
+      add_reference();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************
+    pool_shared_ptr(pool_shared_ptr&& other) ETL_NOEXCEPT
+      : p_node(other.p_node)
+    {
+      other.p_node = ETL_NULLPTR;
+    }
+#endif
+
+    //*********************************
+    ~pool_shared_ptr()
+    {
+      reset();
+    }
+
+    //*********************************
+    pointer get() const ETL_NOEXCEPT
+    {
+      return (p_node != ETL_NULLPTR) ? &p_node->value : ETL_NULLPTR;
+    }
+
+    //*********************************
+    /// Drops this reference.
+    /// The last reference destroys the object and returns it to its pool.
+    //*********************************
+    void reset() ETL_NOEXCEPT
+    {
+      if (p_node != ETL_NULLPTR)
+      {
+        node_type* p_old = p_node;
+        p_node = ETL_NULLPTR;
+
+        if (--p_old->count == 0)
+        {
+          p_old->p_pool->destroy(p_old);
+        }
+      }
+    }
+
+    //*********************************
+    /// The number of pointers sharing the object.
+    //*********************************
+    int32_t use_count() const ETL_NOEXCEPT
+    {
+      return (p_node != ETL_NULLPTR) ? int32_t(p_node->count) : 0;
+    }
+
+    //*********************************
+    bool unique() const ETL_NOEXCEPT
+    {
+      return use_count() == 1;
+    }
+
+    //*********************************
+    void swap(pool_shared_ptr& other) ETL_NOEXCEPT
+    {
+      node_type* p_temp = p_node;
+      p_node       = other.p_node;
+      other.p_node = p_temp;
+    }
+
+    //*********************************
+    ETL_CONSTEXPR operator bool() const ETL_NOEXCEPT
+    {
+      return (p_node != ETL_NULLPTR);
+    }
+
+    //*********************************
+    pool_shared_ptr& operator =(etl::nullptr_t) ETL_NOEXCEPT
+    {
+      reset();
+
+      return *this;
+    }
+
+    //*********************************
+    pool_shared_ptr& operator =(const pool_shared_ptr& other) ETL_NOEXCEPT
+    {
+      if (other.p_node != p_node)
+      {
+        reset();
+        p_node = other.p_node;
+        add_reference();
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************
+    pool_shared_ptr& operator =(pool_shared_ptr&& other) ETL_NOEXCEPT
+    {
+      if (&other != this)
+      {
+        reset();
+        p_node       = other.p_node;
+        other.p_node = ETL_NULLPTR;
+      }
+
+      return *this;
+    }
+#endif
+
+    //*********************************
+    reference operator *() const
+    {
+      return p_node->value;
+    }
+
+    //*********************************
+    pointer operator ->() const ETL_NOEXCEPT
+    {
+      return &p_node->value;
+    }
+
+    //*********************************
+    friend bool operator ==(const pool_shared_ptr& lhs, const pool_shared_ptr& rhs) ETL_NOEXCEPT
+    {
+      return lhs.p_node == rhs.p_node;
+    }
+
+    //*********************************
+    friend bool operator !=(const pool_shared_ptr& lhs, const pool_shared_ptr& rhs) ETL_NOEXCEPT
+    {
+      return lhs.p_node != rhs.p_node;
+    }
+
+  private:
+
+    //*********************************
+    void add_reference() ETL_NOEXCEPT
+    {
+      if (p_node != ETL_NULLPTR)
+      {
+        ++p_node->count;
+      }
+    }
+
+    node_type* p_node;
+  };
+
+#if ETL_USING_CPP11 && !defined(ETL_POOL_PTR_FORCE_CPP03_IMPLEMENTATION)
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_ptr.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename... TArgs>
+  etl::pool_ptr<T> make_pool_ptr(etl::ipool& pool, TArgs&&... args)
+  {
+    typedef typename etl::pool_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, etl::forward<TArgs>(args)...);
+    }
+
+    return etl::pool_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_shared_ptr.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename TCounter = int32_t, typename... TArgs>
+  etl::pool_shared_ptr<T, TCounter> make_pool_shared_ptr(etl::ipool& pool, TArgs&&... args)
+  {
+    typedef typename etl::pool_shared_ptr<T, TCounter>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, etl::forward<TArgs>(args)...);
+    }
+
+    return etl::pool_shared_ptr<T, TCounter>(p_node);
+  }
+#else
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_ptr.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T>
+  etl::pool_ptr<T> make_pool_ptr(etl::ipool& pool)
+  {
+    typedef typename etl::pool_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool);
+    }
+
+    return etl::pool_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_ptr.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename T1>
+  etl::pool_ptr<T> make_pool_ptr(etl::ipool& pool, const T1& value1)
+  {
+    typedef typename etl::pool_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, value1);
+    }
+
+    return etl::pool_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_ptr.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename T1, typename T2>
+  etl::pool_ptr<T> make_pool_ptr(etl::ipool& pool, const T1& value1, const T2& value2)
+  {
+    typedef typename etl::pool_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, value1, value2);
+    }
+
+    return etl::pool_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_ptr.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename T1, typename T2, typename T3>
+  etl::pool_ptr<T> make_pool_ptr(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3)
+  {
+    typedef typename etl::pool_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, value1, value2, value3);
+    }
+
+    return etl::pool_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_ptr.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename T1, typename T2, typename T3, typename T4>
+  etl::pool_ptr<T> make_pool_ptr(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+  {
+    typedef typename etl::pool_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, value1, value2, value3, value4);
+    }
+
+    return etl::pool_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_shared_ptr.
+  /// Uses the default counter type.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T>
+  etl::pool_shared_ptr<T> make_pool_shared_ptr(etl::ipool& pool)
+  {
+    typedef typename etl::pool_shared_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool);
+    }
+
+    return etl::pool_shared_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_shared_ptr.
+  /// Uses the default counter type.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename T1>
+  etl::pool_shared_ptr<T> make_pool_shared_ptr(etl::ipool& pool, const T1& value1)
+  {
+    typedef typename etl::pool_shared_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, value1);
+    }
+
+    return etl::pool_shared_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_shared_ptr.
+  /// Uses the default counter type.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename T1, typename T2>
+  etl::pool_shared_ptr<T> make_pool_shared_ptr(etl::ipool& pool, const T1& value1, const T2& value2)
+  {
+    typedef typename etl::pool_shared_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, value1, value2);
+    }
+
+    return etl::pool_shared_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_shared_ptr.
+  /// Uses the default counter type.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename T1, typename T2, typename T3>
+  etl::pool_shared_ptr<T> make_pool_shared_ptr(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3)
+  {
+    typedef typename etl::pool_shared_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, value1, value2, value3);
+    }
+
+    return etl::pool_shared_ptr<T>(p_node);
+  }
+
+  //***************************************************************************
+  /// Creates an object in the pool, owned by an etl::pool_shared_ptr.
+  /// Uses the default counter type.
+  /// Returns an empty pointer if the pool is exhausted and asserts do not throw.
+  //***************************************************************************
+  template <typename T, typename T1, typename T2, typename T3, typename T4>
+  etl::pool_shared_ptr<T> make_pool_shared_ptr(etl::ipool& pool, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+  {
+    typedef typename etl::pool_shared_ptr<T>::node_type node_type;
+
+    node_type* p_node = etl::private_pool_ptr::allocate_node<node_type>(pool);
+
+    if (p_node != ETL_NULLPTR)
+    {
+      ::new (p_node) node_type(pool, value1, value2, value3, value4);
+    }
+
+    return etl::pool_shared_ptr<T>(p_node);
+  }
+#endif
+}
+
+#endif
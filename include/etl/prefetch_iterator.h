@@ -0,0 +1,250 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PREFETCH_ITERATOR_INCLUDED
+#define ETL_PREFETCH_ITERATOR_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "private/addressof.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+/// The default number of elements that etl::prefetch_iterator requests ahead
+/// of the current one.
+//*****************************************************************************
+#if !defined(ETL_PREFETCH_DISTANCE)
+  #define ETL_PREFETCH_DISTANCE 4U
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Requests the cache line holding 'p', ahead of its use.
+  /// Does nothing for compilers without a prefetch builtin.
+  //***************************************************************************
+  inline void prefetch(const void* p)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+  }
+
+  //***************************************************************************
+  /// A forward iterator adaptor that prefetches the element a fixed distance
+  /// ahead of the current one.
+  /// Intended for node based containers, such as etl::list, etl::forward_list,
+  /// etl::map and etl::set, where each step loads a node that is unlikely to
+  /// be in the cache. The node is requested while the previous elements are
+  /// being processed.
+  /// A second iterator runs ahead of the current one, so the end of the range
+  /// must be supplied.
+  ///\tparam TIterator The adapted iterator. At least a forward iterator.
+  //***************************************************************************
+  template <typename TIterator>
+  class prefetch_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag,
+                                                 typename etl::iterator_traits<TIterator>::value_type,
+                                                 typename etl::iterator_traits<TIterator>::difference_type,
+                                                 typename etl::iterator_traits<TIterator>::pointer,
+                                                 typename etl::iterator_traits<TIterator>::reference>
+  {
+  public:
+
+    typedef TIterator                                              iterator_type;
+    typedef typename etl::iterator_traits<TIterator>::pointer      pointer;
+    typedef typename etl::iterator_traits<TIterator>::reference    reference;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    prefetch_iterator()
+      : current()
+      , ahead()
+      , last()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// Prefetches the first 'distance' elements after 'first'.
+    ///\param first    The first element.
+    ///\param last     The end of the range.
+    ///\param distance The number of elements to prefetch ahead.
+    //*************************************************************************
+    prefetch_iterator(TIterator first_, TIterator last_, size_t distance = ETL_PREFETCH_DISTANCE)
+      : current(first_)
+      , ahead(first_)
+      , last(last_)
+    {
+      while ((distance != 0U) && (ahead != last))
+      {
+        ++ahead;
+        prefetch_ahead();
+        --distance;
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs an end iterator.
+    //*************************************************************************
+    explicit prefetch_iterator(TIterator last_)
+      : current(last_)
+      , ahead(last_)
+      , last(last_)
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the adapted iterator.
+    //*************************************************************************
+    iterator_type base() const
+    {
+      return current;
+    }
+
+    //*************************************************************************
+    /// Pre-increment operator.
+    //*************************************************************************
+    prefetch_iterator& operator ++()
+    {
+      ++current;
+
+      if (ahead != last)
+      {
+        ++ahead;
+        prefetch_ahead();
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Post-increment operator.
+    //*************************************************************************
+    prefetch_iterator operator ++(int)
+    {
+      prefetch_iterator temp(*this);
+      ++(*this);
+      return temp;
+    }
+
+    //*************************************************************************
+    /// De-reference operator.
+    //*************************************************************************
+    reference operator *() const
+    {
+      return *current;
+    }
+
+    //*************************************************************************
+    /// Member access operator.
+    //*************************************************************************
+    pointer operator ->() const
+    {
+      return etl::addressof(*current);
+    }
+
+    //*************************************************************************
+    /// Equality operator.
+    //*************************************************************************
+    friend bool operator ==(const prefetch_iterator& lhs, const prefetch_iterator& rhs)
+    {
+      return lhs.current == rhs.current;
+    }
+
+    //*************************************************************************
+    /// Inequality operator.
+    //*************************************************************************
+    friend bool operator !=(const prefetch_iterator& lhs, const prefetch_iterator& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Prefetches the element at 'ahead', if there is one.
+    //*************************************************************************
+    void prefetch_ahead()
+    {
+      if (ahead != last)
+      {
+        etl::prefetch(etl::addressof(*ahead));
+      }
+    }
+
+    TIterator current;
+    TIterator ahead;
+    TIterator last;
+  };
+
+  //***************************************************************************
+  /// Makes a prefetch_iterator for the start of a range.
+  //***************************************************************************
+  template <typename TIterator>
+  etl::prefetch_iterator<TIterator> make_prefetch_iterator(TIterator first, TIterator last, size_t distance = ETL_PREFETCH_DISTANCE)
+  {
+    return etl::prefetch_iterator<TIterator>(first, last, distance);
+  }
+
+  //***************************************************************************
+  /// Makes a prefetch_iterator for the end of a range.
+  //***************************************************************************
+  template <typename TIterator>
+  etl::prefetch_iterator<TIterator> make_prefetch_iterator(TIterator last)
+  {
+    return etl::prefetch_iterator<TIterator>(last);
+  }
+
+  //***************************************************************************
+  /// Applies a function to each element of a range, prefetching the element
+  /// 'distance' places ahead.
+  ///\return The function.
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryOperation>
+  TUnaryOperation for_each_prefetch(TIterator first, TIterator last, TUnaryOperation unary_operation, size_t distance = ETL_PREFETCH_DISTANCE)
+  {
+    etl::prefetch_iterator<TIterator>       itr(first, last, distance);
+    const etl::prefetch_iterator<TIterator> end(last);
+
+    while (itr != end)
+    {
+      unary_operation(*itr);
+      ++itr;
+    }
+
+    return unary_operation;
+  }
+}
+
+#endif
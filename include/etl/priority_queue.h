@@ -41,6 +41,10 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "static_assert.h"
+#include "memory.h"
+#include "integral_limits.h"
+#include "placement_new.h"
 
 #include <stddef.h>
 
@@ -95,6 +99,165 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// The exception thrown when a handle does not refer to a queued value.
+  ///\ingroup queue
+  //***************************************************************************
+  class priority_queue_handle : public etl::priority_queue_exception
+  {
+  public:
+
+    priority_queue_handle(string_type file_name_, numeric_type line_number_)
+      : priority_queue_exception(ETL_ERROR_TEXT("priority_queue:handle", ETL_PRIORITY_QUEUE_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_priority_queue
+  {
+    //*************************************************************************
+    /// Heap operations for a heap where each node has ARITY children.
+    /// A wider heap is shallower, so a pop visits fewer levels, and the
+    /// children of each node are adjacent in memory.
+    //*************************************************************************
+    template <size_t ARITY>
+    struct heap
+    {
+      ETL_STATIC_ASSERT(ARITY >= 2, "The heap arity must be at least 2");
+
+      //*********************************
+      /// Moves the value at 'hole' down to its place in [first, first + length).
+      //*********************************
+      template <typename TIterator, typename TValue, typename TCompare>
+      static void sift_down(TIterator first, size_t length, size_t hole, TValue& value, TCompare& compare)
+      {
+        while (true)
+        {
+          const size_t child = (hole * ARITY) + 1U;
+
+          if (child >= length)
+          {
+            break;
+          }
+
+          const size_t last_child = ((child + ARITY) < length) ? (child + ARITY) : length;
+          size_t best = child;
+
+          for (size_t i = child + 1U; i < last_child; ++i)
+          {
+            if (compare(first[best], first[i]))
+            {
+              best = i;
+            }
+          }
+
+          if (!compare(value, first[best]))
+          {
+            break;
+          }
+
+          first[hole] = ETL_MOVE(first[best]);
+          hole = best;
+        }
+
+        first[hole] = ETL_MOVE(value);
+      }
+
+      //*********************************
+      /// Adds the value at last - 1 to the heap in [first, last - 1).
+      //*********************************
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare& compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+        size_t hole = static_cast<size_t>(etl::distance(first, last)) - 1U;
+        value_type value = ETL_MOVE(first[hole]);
+
+        while (hole > 0U)
+        {
+          const size_t parent = (hole - 1U) / ARITY;
+
+          if (!compare(first[parent], value))
+          {
+            break;
+          }
+
+          first[hole] = ETL_MOVE(first[parent]);
+          hole = parent;
+        }
+
+        first[hole] = ETL_MOVE(value);
+      }
+
+      //*********************************
+      /// Moves the top of the heap to last - 1 and makes [first, last - 1) a heap.
+      //*********************************
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare& compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+        const size_t length = static_cast<size_t>(etl::distance(first, last));
+
+        if (length > 1U)
+        {
+          value_type value = ETL_MOVE(first[length - 1U]);
+          first[length - 1U] = ETL_MOVE(first[0]);
+          sift_down(first, length - 1U, 0U, value, compare);
+        }
+      }
+
+      //*********************************
+      /// Makes [first, last) a heap.
+      //*********************************
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare& compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+        const size_t length = static_cast<size_t>(etl::distance(first, last));
+
+        if (length > 1U)
+        {
+          size_t i = ((length - 2U) / ARITY) + 1U;
+
+          while (i > 0U)
+          {
+            --i;
+            value_type value = ETL_MOVE(first[i]);
+            sift_down(first, length, i, value, compare);
+          }
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// A binary heap uses the standard heap algorithms.
+    //*************************************************************************
+    template <>
+    struct heap<2U>
+    {
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare& compare)
+      {
+        etl::push_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare& compare)
+      {
+        etl::pop_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare& compare)
+      {
+        etl::make_heap(first, last, compare);
+      }
+    };
+  }
+
   //***************************************************************************
   ///\ingroup queue
   ///\brief This is the base for all priority queues that contain a particular type.
@@ -110,10 +273,17 @@ namespace etl
   /// \tparam T The type of value that the queue holds.
   /// \tparam TContainer to hold the T queue values
   /// \tparam TCompare to use in comparing T values
+  /// \tparam ARITY The number of children of each node of the heap.
+  /// A 4 or 8 way heap halves or thirds the levels visited by each pop,
+  /// which is faster for large queues.
   //***************************************************************************
-  template <typename T, typename TContainer, typename TCompare = etl::less<T> >
+  template <typename T, typename TContainer, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
   class ipriority_queue
   {
+  private:
+
+    typedef private_priority_queue::heap<ARITY> heap_type;
+
   public:
 
     typedef T                     value_type;         ///< The type stored in the queue.
@@ -158,7 +328,7 @@ namespace etl
       // Put element at end
       container.push_back(value);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
 #if ETL_USING_CPP11
@@ -175,7 +345,7 @@ namespace etl
       // Put element at end
       container.push_back(etl::move(value));
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 #endif
 
@@ -194,7 +364,7 @@ namespace etl
       // Put element at end
       container.emplace_back(etl::forward<Args>(args)...);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 #else
     //*************************************************************************
@@ -210,7 +380,7 @@ namespace etl
       // Put element at end
       container.emplace_back();
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -227,7 +397,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -244,7 +414,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -261,7 +431,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -278,7 +448,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3, value4);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 #endif
 
@@ -302,7 +472,7 @@ namespace etl
 
       clear();
       container.assign(first, last);
-      etl::make_heap(container.begin(), container.end(), compare);
+      heap_type::make(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -312,7 +482,7 @@ namespace etl
     void pop()
     {
       // Move largest element to end
-      etl::pop_heap(container.begin(), container.end(), compare);
+      heap_type::pop(container.begin(), container.end(), compare);
       // Actually remove largest element at end
       container.pop_back();
     }
@@ -455,9 +625,10 @@ namespace etl
   /// This queue does not support concurrent access by different threads.
   /// \tparam T    The type this queue should support.
   /// \tparam SIZE The maximum capacity of the queue.
+  /// \tparam ARITY The number of children of each node of the heap.
   //***************************************************************************
-  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type> >
-  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare>
+  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type>, const size_t ARITY = 2U>
+  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare, ARITY>
   {
   public:
 
@@ -470,7 +641,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     priority_queue()
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
     }
 
@@ -478,9 +649,9 @@ namespace etl
     /// Copy constructor
     //*************************************************************************
     priority_queue(const priority_queue& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clone(rhs);
     }
 
 #if ETL_USING_CPP11
@@ -488,9 +659,9 @@ namespace etl
     /// Move constructor
     //*************************************************************************
     priority_queue(priority_queue&& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::move(etl::move(rhs));
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::move(etl::move(rhs));
     }
 #endif
 
@@ -502,9 +673,9 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     priority_queue(TIterator first, TIterator last)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::assign(first, last);
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::assign(first, last);
     }
 
     //*************************************************************************
@@ -512,7 +683,7 @@ namespace etl
     //*************************************************************************
     ~priority_queue()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clear();
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clear();
     }
 
     //*************************************************************************
@@ -522,7 +693,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clone(rhs);
       }
 
       return *this;
@@ -536,8 +707,8 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clear();
-        etl::ipriority_queue<T, TContainer, TCompare>::move(etl::move(rhs));
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clear();
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::move(etl::move(rhs));
       }
 
       return *this;
@@ -545,8 +716,547 @@ namespace etl
 #endif
   };
 
-  template <typename T, const size_t SIZE, typename TContainer, typename TCompare>
-  ETL_CONSTANT typename priority_queue<T, SIZE, TContainer, TCompare>::size_type priority_queue<T, SIZE, TContainer, TCompare>::MAX_SIZE;
+  template <typename T, const size_t SIZE, typename TContainer, typename TCompare, const size_t ARITY>
+  ETL_CONSTANT typename priority_queue<T, SIZE, TContainer, TCompare, ARITY>::size_type priority_queue<T, SIZE, TContainer, TCompare, ARITY>::MAX_SIZE;
+
+  //***************************************************************************
+  ///\ingroup queue
+  ///\brief The base for all indexed priority queues that contain a particular type.
+  ///\details An indexed priority queue returns a handle from each push.
+  /// The handle stays valid until the value leaves the queue, and may be used
+  /// to read, update or erase the value wherever it is in the heap.
+  /// The values do not move. The heap holds the handles.
+  ///\code
+  /// etl::indexed_priority_queue<Deadline, 10000, etl::greater<Deadline>, 4> deadlines;
+  ///
+  /// size_t handle = deadlines.push(deadline);
+  /// deadlines.update(handle, earlier_deadline);
+  ///\endcode
+  /// \tparam T        The type of value that the queue holds.
+  /// \tparam TCompare To use in comparing T values.
+  /// \tparam ARITY    The number of children of each node of the heap.
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
+  class iindexed_priority_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT(ARITY >= 2, "The heap arity must be at least 2");
+
+    typedef T        value_type;         ///< The type stored in the queue.
+    typedef TCompare compare_type;       ///< The comparison type.
+    typedef T&       reference;          ///< A reference to the type used in the queue.
+    typedef const T& const_reference;    ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&      rvalue_reference;   ///< An rvalue reference to the type used in the queue.
+#endif
+    typedef size_t   size_type;          ///< The type used for determining the size of the queue.
+    typedef size_t   handle_type;        ///< The type of the handle of a queued value.
+
+    /// The handle returned when a value could not be pushed.
+    static ETL_CONSTANT handle_type npos = etl::integral_limits<handle_type>::max;
+
+    //*************************************************************************
+    /// Gets a const reference to the highest priority value in the priority queue.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return p_values[p_heap[0]];
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the highest priority value in the priority queue.
+    //*************************************************************************
+    handle_type top_handle() const
+    {
+      return p_heap[0];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the value with the handle.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_handle
+    /// if the handle does not refer to a queued value.
+    //*************************************************************************
+    const_reference get(handle_type handle) const
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::priority_queue_handle));
+
+      return p_values[handle];
+    }
+
+    //*************************************************************************
+    /// Checks whether the handle refers to a queued value.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle < CAPACITY) && (p_position[handle] < current_size);
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
+    /// is the priority queue is already full.
+    ///\param value The value to push to the queue.
+    ///\return The handle of the value.
+    //*************************************************************************
+    handle_type push(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(etl::priority_queue_full), npos);
+
+      const handle_type handle = p_heap[current_size];
+      ::new (static_cast<void*>(p_values + handle)) T(value);
+
+      return add(handle);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
+    /// is the priority queue is already full.
+    ///\param value The value to push to the queue.
+    ///\return The handle of the value.
+    //*************************************************************************
+    handle_type push(rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(etl::priority_queue_full), npos);
+
+      const handle_type handle = p_heap[current_size];
+      ::new (static_cast<void*>(p_values + handle)) T(etl::move(value));
+
+      return add(handle);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
+    /// is the priority queue is already full.
+    ///\return The handle of the value.
+    //*************************************************************************
+    template <typename ... Args>
+    handle_type emplace(Args && ... args)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(etl::priority_queue_full), npos);
+
+      const handle_type handle = p_heap[current_size];
+      ::new (static_cast<void*>(p_values + handle)) T(etl::forward<Args>(args)...);
+
+      return add(handle);
+    }
+#endif
+
+    //*************************************************************************
+    /// Changes the value with the handle and moves it to its new place in the queue.
+    /// Raising or lowering the priority are both allowed.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_handle
+    /// if the handle does not refer to a queued value.
+    //*************************************************************************
+    void update(handle_type handle, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(etl::priority_queue_handle));
+
+      p_values[handle] = value;
+      restore(p_position[handle]);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Changes the value with the handle and moves it to its new place in the queue.
+    /// Raising or lowering the priority are both allowed.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_handle
+    /// if the handle does not refer to a queued value.
+    //*************************************************************************
+    void update(handle_type handle, rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(etl::priority_queue_handle));
+
+      p_values[handle] = etl::move(value);
+      restore(p_position[handle]);
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the value with the handle from the queue.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_handle
+    /// if the handle does not refer to a queued value.
+    //*************************************************************************
+    void erase(handle_type handle)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(etl::priority_queue_handle));
+
+      const size_t position = p_position[handle];
+
+      --current_size;
+
+      // Swap the last value into the hole, leaving the freed handle after the heap.
+      place(position, p_heap[current_size]);
+      place(current_size, handle);
+
+      p_values[handle].~T();
+
+      if (position < current_size)
+      {
+        restore(position);
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the highest priority value from the queue.
+    /// Does nothing if the priority queue is already empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (!empty())
+      {
+        erase(p_heap[0]);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the highest priority value in the priority queue
+    /// and assigns it to destination and removes it from the queue.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      destination = ETL_MOVE(p_values[p_heap[0]]);
+      pop();
+    }
+
+    //*************************************************************************
+    /// Returns the current number of items in the priority queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the priority queue is empty.
+    /// \return <b>true</b> if the queue is empty, otherwise <b>false</b>
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the priority queue is full.
+    /// \return <b>true</b> if the priority queue is full, otherwise <b>false</b>
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        p_values[p_heap[i]].~T();
+      }
+
+      current_size = 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iindexed_priority_queue(T* p_values_, size_t* p_heap_, size_t* p_position_, size_t max_size_)
+      : p_values(p_values_)
+      , p_heap(p_heap_)
+      , p_position(p_position_)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_heap[i]     = i;
+        p_position[i] = i;
+      }
+    }
+
+    //*************************************************************************
+    /// Make this a clone of a queue of the same capacity.
+    /// The handles of the other queue are valid for this one.
+    //*************************************************************************
+    void clone(const iindexed_priority_queue& other)
+    {
+      clear();
+
+      etl::copy(other.p_heap, other.p_heap + CAPACITY, p_heap);
+      etl::copy(other.p_position, other.p_position + CAPACITY, p_position);
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const handle_type handle = p_heap[i];
+        ::new (static_cast<void*>(p_values + handle)) T(other.p_values[handle]);
+        ++current_size;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move the values of a queue of the same capacity to this one.
+    /// The handles of the other queue are valid for this one.
+    //*************************************************************************
+    void move(iindexed_priority_queue&& other)
+    {
+      clear();
+
+      etl::copy(other.p_heap, other.p_heap + CAPACITY, p_heap);
+      etl::copy(other.p_position, other.p_position + CAPACITY, p_position);
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const handle_type handle = p_heap[i];
+        ::new (static_cast<void*>(p_values + handle)) T(etl::move(other.p_values[handle]));
+        ++current_size;
+      }
+
+      other.clear();
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~iindexed_priority_queue()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds the value just constructed for the handle to the heap.
+    //*************************************************************************
+    handle_type add(handle_type handle)
+    {
+      ++current_size;
+      sift_up(current_size - 1U);
+
+      return handle;
+    }
+
+    //*************************************************************************
+    /// Puts the handle at the position in the heap.
+    //*************************************************************************
+    void place(size_t position, handle_type handle)
+    {
+      p_heap[position]   = handle;
+      p_position[handle] = position;
+    }
+
+    //*************************************************************************
+    /// Moves the value at the position up or down to restore the heap.
+    //*************************************************************************
+    void restore(size_t position)
+    {
+      if ((position > 0U) && compare(p_values[p_heap[(position - 1U) / ARITY]], p_values[p_heap[position]]))
+      {
+        sift_up(position);
+      }
+      else
+      {
+        sift_down(position);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the value at the position up to its place in the heap.
+    //*************************************************************************
+    void sift_up(size_t position)
+    {
+      const handle_type handle = p_heap[position];
+      const T& value = p_values[handle];
+
+      while (position > 0U)
+      {
+        const size_t parent = (position - 1U) / ARITY;
+
+        if (!compare(p_values[p_heap[parent]], value))
+        {
+          break;
+        }
+
+        place(position, p_heap[parent]);
+        position = parent;
+      }
+
+      place(position, handle);
+    }
+
+    //*************************************************************************
+    /// Moves the value at the position down to its place in the heap.
+    //*************************************************************************
+    void sift_down(size_t position)
+    {
+      const handle_type handle = p_heap[position];
+      const T& value = p_values[handle];
+
+      while (true)
+      {
+        const size_t child = (position * ARITY) + 1U;
+
+        if (child >= current_size)
+        {
+          break;
+        }
+
+        const size_t last_child = ((child + ARITY) < current_size) ? (child + ARITY) : current_size;
+        size_t best = child;
+
+        for (size_t i = child + 1U; i < last_child; ++i)
+        {
+          if (compare(p_values[p_heap[best]], p_values[p_heap[i]]))
+          {
+            best = i;
+          }
+        }
+
+        if (!compare(value, p_values[p_heap[best]]))
+        {
+          break;
+        }
+
+        place(position, p_heap[best]);
+        position = best;
+      }
+
+      place(position, handle);
+    }
+
+    // Disable copy construction and assignment.
+    iindexed_priority_queue(const iindexed_priority_queue&);
+    iindexed_priority_queue& operator =(const iindexed_priority_queue&);
+
+    T*        p_values;     ///< The values, indexed by handle.
+    size_t*   p_heap;       ///< The heap of handles. The free handles follow the heap.
+    size_t*   p_position;   ///< The position of each handle in p_heap.
+    size_type current_size;
+    const size_type CAPACITY;
+    TCompare  compare;
+  };
+
+  template <typename T, typename TCompare, const size_t ARITY>
+  ETL_CONSTANT typename iindexed_priority_queue<T, TCompare, ARITY>::handle_type iindexed_priority_queue<T, TCompare, ARITY>::npos;
+
+  //***************************************************************************
+  ///\ingroup priority_queue
+  /// A fixed capacity indexed priority queue.
+  /// This queue does not support concurrent access by different threads.
+  /// \tparam T        The type this queue should support.
+  /// \tparam SIZE     The maximum capacity of the queue.
+  /// \tparam TCompare To use in comparing T values.
+  /// \tparam ARITY    The number of children of each node of the heap.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
+  class indexed_priority_queue : public etl::iindexed_priority_queue<T, TCompare, ARITY>
+  {
+  private:
+
+    typedef etl::iindexed_priority_queue<T, TCompare, ARITY> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    indexed_priority_queue()
+      : base_t(values, heap, position, SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. The handles of rhs are valid for the copy.
+    //*************************************************************************
+    indexed_priority_queue(const indexed_priority_queue& rhs)
+      : base_t(values, heap, position, SIZE)
+    {
+      base_t::clone(rhs);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. The handles of rhs are valid for the new queue.
+    //*************************************************************************
+    indexed_priority_queue(indexed_priority_queue&& rhs)
+      : base_t(values, heap, position, SIZE)
+    {
+      base_t::move(etl::move(rhs));
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator. The handles of rhs are valid for this queue.
+    //*************************************************************************
+    indexed_priority_queue& operator = (const indexed_priority_queue& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator. The handles of rhs are valid for this queue.
+    //*************************************************************************
+    indexed_priority_queue& operator = (indexed_priority_queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::move(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    etl::uninitialized_buffer_of<T, SIZE> values;
+    size_t heap[SIZE];
+    size_t position[SIZE];
+  };
+
+  template <typename T, const size_t SIZE, typename TCompare, const size_t ARITY>
+  ETL_CONSTANT typename indexed_priority_queue<T, SIZE, TCompare, ARITY>::size_type indexed_priority_queue<T, SIZE, TCompare, ARITY>::MAX_SIZE;
 }
 
 #endif
@@ -0,0 +1,544 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ALGORITHM_SIMD_INCLUDED
+#define ETL_ALGORITHM_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+//*****************************************************************************
+// Block kernels for find, count and mismatch over contiguous 8, 16 and 32 bit
+// lanes. Each kernel only processes whole blocks. The caller finishes the
+// remaining elements with a scalar loop, starting at the returned index.
+// Uses SSE2, NEON or MVE when available, otherwise word-at-a-time (SWAR).
+//*****************************************************************************
+
+#if ETL_USING_SSE2 || ETL_USING_AVX2
+  #include <emmintrin.h>
+#elif ETL_USING_MVE
+  #include <arm_mve.h>
+#elif ETL_USING_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// The unsigned lane type for an element size.
+    //*************************************************************************
+    template <size_t Size>
+    struct simd_lane;
+
+    template <>
+    struct simd_lane<1U>
+    {
+      typedef uint8_t type;
+    };
+
+    template <>
+    struct simd_lane<2U>
+    {
+      typedef uint16_t type;
+    };
+
+    template <>
+    struct simd_lane<4U>
+    {
+      typedef uint32_t type;
+    };
+
+    //*************************************************************************
+    /// The index of the lowest set bit. mask must not be zero.
+    //*************************************************************************
+    inline uint_least8_t simd_first_set_bit(uint64_t mask)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return static_cast<uint_least8_t>(__builtin_ctzll(mask));
+#else
+      uint_least8_t index = 0U;
+
+      while ((mask & 1U) == 0U)
+      {
+        mask >>= 1U;
+        ++index;
+      }
+
+      return index;
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of set bits.
+    //*************************************************************************
+    inline size_t simd_count_bits(uint64_t mask)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return static_cast<size_t>(__builtin_popcountll(mask));
+#else
+      mask = mask - ((mask >> 1U) & 0x5555555555555555ULL);
+      mask = (mask & 0x3333333333333333ULL) + ((mask >> 2U) & 0x3333333333333333ULL);
+      mask = (mask + (mask >> 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+
+      return static_cast<size_t>((mask * 0x0101010101010101ULL) >> 56U);
+#endif
+    }
+
+#if ETL_USING_SSE2 || ETL_USING_AVX2 || ETL_USING_NEON || ETL_USING_MVE
+    //*************************************************************************
+    /// Vector operations.
+    /// equal_lanes returns a mask with SIMD_BITS_PER_BYTE bits per byte,
+    /// in memory order, set for every byte of each equal lane.
+    //*************************************************************************
+    static ETL_CONSTANT size_t SIMD_BLOCK_SIZE = 16U;
+
+    template <typename TLane>
+    struct simd_ops;
+
+  #if ETL_USING_SSE2 || ETL_USING_AVX2
+    static ETL_CONSTANT size_t   SIMD_BITS_PER_BYTE = 1U;
+    static ETL_CONSTANT uint64_t SIMD_ALL_EQUAL     = 0xFFFFU;
+
+    template <>
+    struct simd_ops<uint8_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      }
+
+      static vector_type splat(uint8_t value)
+      {
+        return _mm_set1_epi8(static_cast<char>(value));
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+      }
+    };
+
+    template <>
+    struct simd_ops<uint16_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      }
+
+      static vector_type splat(uint16_t value)
+      {
+        return _mm_set1_epi16(static_cast<short>(value));
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(a, b)));
+      }
+    };
+
+    template <>
+    struct simd_ops<uint32_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      }
+
+      static vector_type splat(uint32_t value)
+      {
+        return _mm_set1_epi32(static_cast<int>(value));
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi32(a, b)));
+      }
+    };
+  #elif ETL_USING_MVE
+    // The compare predicate has one bit per byte.
+    static ETL_CONSTANT size_t   SIMD_BITS_PER_BYTE = 1U;
+    static ETL_CONSTANT uint64_t SIMD_ALL_EQUAL     = 0xFFFFU;
+
+    template <>
+    struct simd_ops<uint8_t>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+      }
+
+      static vector_type splat(uint8_t value)
+      {
+        return vdupq_n_u8(value);
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return static_cast<uint64_t>(vcmpeqq_u8(a, b));
+      }
+    };
+
+    template <>
+    struct simd_ops<uint16_t>
+    {
+      typedef uint16x8_t vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return vreinterpretq_u16_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p)));
+      }
+
+      static vector_type splat(uint16_t value)
+      {
+        return vdupq_n_u16(value);
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return static_cast<uint64_t>(vcmpeqq_u16(a, b));
+      }
+    };
+
+    template <>
+    struct simd_ops<uint32_t>
+    {
+      typedef uint32x4_t vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return vreinterpretq_u32_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p)));
+      }
+
+      static vector_type splat(uint32_t value)
+      {
+        return vdupq_n_u32(value);
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return static_cast<uint64_t>(vcmpeqq_u32(a, b));
+      }
+    };
+  #elif ETL_USING_NEON
+    // The compare result is narrowed to four bits per byte.
+    static ETL_CONSTANT size_t   SIMD_BITS_PER_BYTE = 4U;
+    static ETL_CONSTANT uint64_t SIMD_ALL_EQUAL     = 0xFFFFFFFFFFFFFFFFULL;
+
+    inline uint64_t simd_narrow_mask(uint8x16_t equal)
+    {
+      const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+
+      return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+
+    template <>
+    struct simd_ops<uint8_t>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+      }
+
+      static vector_type splat(uint8_t value)
+      {
+        return vdupq_n_u8(value);
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return simd_narrow_mask(vceqq_u8(a, b));
+      }
+    };
+
+    template <>
+    struct simd_ops<uint16_t>
+    {
+      typedef uint16x8_t vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return vreinterpretq_u16_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p)));
+      }
+
+      static vector_type splat(uint16_t value)
+      {
+        return vdupq_n_u16(value);
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return simd_narrow_mask(vreinterpretq_u8_u16(vceqq_u16(a, b)));
+      }
+    };
+
+    template <>
+    struct simd_ops<uint32_t>
+    {
+      typedef uint32x4_t vector_type;
+
+      static vector_type load(const char* p)
+      {
+        return vreinterpretq_u32_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p)));
+      }
+
+      static vector_type splat(uint32_t value)
+      {
+        return vdupq_n_u32(value);
+      }
+
+      static uint64_t equal_lanes(vector_type a, vector_type b)
+      {
+        return simd_narrow_mask(vreinterpretq_u8_u32(vceqq_u32(a, b)));
+      }
+    };
+  #endif
+
+    //*************************************************************************
+    /// Searches whole blocks for value.
+    /// \return The index of the first match, or the number of elements searched.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_find(const char* p, size_t length, TLane value)
+    {
+      typedef simd_ops<TLane> ops;
+
+      const size_t lanes         = SIMD_BLOCK_SIZE / sizeof(TLane);
+      const size_t bits_per_lane = SIMD_BITS_PER_BYTE * sizeof(TLane);
+
+      const typename ops::vector_type target = ops::splat(value);
+
+      size_t i = 0U;
+
+      while ((length - i) >= lanes)
+      {
+        const uint64_t mask = ops::equal_lanes(ops::load(p + (i * sizeof(TLane))), target);
+
+        if (mask != 0U)
+        {
+          return i + (simd_first_set_bit(mask) / bits_per_lane);
+        }
+
+        i += lanes;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Counts the occurrences of value in whole blocks.
+    /// Sets searched to the number of elements searched.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_count(const char* p, size_t length, TLane value, size_t& searched)
+    {
+      typedef simd_ops<TLane> ops;
+
+      const size_t lanes         = SIMD_BLOCK_SIZE / sizeof(TLane);
+      const size_t bits_per_lane = SIMD_BITS_PER_BYTE * sizeof(TLane);
+
+      const typename ops::vector_type target = ops::splat(value);
+
+      size_t i = 0U;
+      size_t n = 0U;
+
+      while ((length - i) >= lanes)
+      {
+        n += simd_count_bits(ops::equal_lanes(ops::load(p + (i * sizeof(TLane))), target));
+        i += lanes;
+      }
+
+      searched = i;
+
+      return n / bits_per_lane;
+    }
+
+    //*************************************************************************
+    /// Compares whole blocks.
+    /// \return The index of the first difference, or the number of elements compared.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_mismatch(const char* p1, const char* p2, size_t length)
+    {
+      typedef simd_ops<uint8_t> ops;
+
+      const size_t bytes = length * sizeof(TLane);
+
+      size_t i = 0U;
+
+      while ((bytes - i) >= SIMD_BLOCK_SIZE)
+      {
+        const uint64_t mask = ops::equal_lanes(ops::load(p1 + i), ops::load(p2 + i));
+
+        if (mask != SIMD_ALL_EQUAL)
+        {
+          const size_t byte_index = i + (simd_first_set_bit(~mask) / SIMD_BITS_PER_BYTE);
+
+          return byte_index / sizeof(TLane);
+        }
+
+        i += SIMD_BLOCK_SIZE;
+      }
+
+      return i / sizeof(TLane);
+    }
+
+#else
+    //*************************************************************************
+    /// Word-at-a-time operations.
+    //*************************************************************************
+  #if ETL_USING_64BIT_TYPES
+    typedef uint64_t simd_word_t;
+  #else
+    typedef uint32_t simd_word_t;
+  #endif
+
+    template <typename TLane>
+    struct simd_word_masks
+    {
+      // 0x0101..., 0x8080... etc. for the lane size.
+      static const simd_word_t ones = static_cast<simd_word_t>(~simd_word_t(0U)) / static_cast<simd_word_t>(static_cast<TLane>(~TLane(0U)));
+      static const simd_word_t high = static_cast<simd_word_t>(ones << ((sizeof(TLane) * 8U) - 1U));
+      static const simd_word_t low  = static_cast<simd_word_t>(~high);
+    };
+
+    inline simd_word_t simd_load_word(const char* p)
+    {
+      simd_word_t word;
+      memcpy(&word, p, sizeof(simd_word_t));
+
+      return word;
+    }
+
+    //*************************************************************************
+    /// Sets the high bit of every zero lane, and clears all other bits.
+    //*************************************************************************
+    template <typename TLane>
+    simd_word_t simd_zero_lanes(simd_word_t word)
+    {
+      typedef simd_word_masks<TLane> masks;
+
+      const simd_word_t t = static_cast<simd_word_t>(((word & masks::low) + masks::low) | word);
+
+      return static_cast<simd_word_t>(~(t | masks::low));
+    }
+
+    //*************************************************************************
+    /// Searches whole words for value.
+    /// \return The index of the word holding the first match, or the number of elements searched.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_find(const char* p, size_t length, TLane value)
+    {
+      const size_t      lanes  = sizeof(simd_word_t) / sizeof(TLane);
+      const simd_word_t target = static_cast<simd_word_t>(simd_word_masks<TLane>::ones * value);
+
+      size_t i = 0U;
+
+      while ((length - i) >= lanes)
+      {
+        if (simd_zero_lanes<TLane>(simd_load_word(p + (i * sizeof(TLane))) ^ target) != 0U)
+        {
+          break;
+        }
+
+        i += lanes;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Counts the occurrences of value in whole words.
+    /// Sets searched to the number of elements searched.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_count(const char* p, size_t length, TLane value, size_t& searched)
+    {
+      const size_t      lanes  = sizeof(simd_word_t) / sizeof(TLane);
+      const simd_word_t target = static_cast<simd_word_t>(simd_word_masks<TLane>::ones * value);
+
+      size_t i = 0U;
+      size_t n = 0U;
+
+      while ((length - i) >= lanes)
+      {
+        n += simd_count_bits(simd_zero_lanes<TLane>(simd_load_word(p + (i * sizeof(TLane))) ^ target));
+        i += lanes;
+      }
+
+      searched = i;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Compares whole words.
+    /// \return The index of the word holding the first difference, or the number of elements compared.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_mismatch(const char* p1, const char* p2, size_t length)
+    {
+      const size_t bytes = length * sizeof(TLane);
+
+      size_t i = 0U;
+
+      while ((bytes - i) >= sizeof(simd_word_t))
+      {
+        if (simd_load_word(p1 + i) != simd_load_word(p2 + i))
+        {
+          break;
+        }
+
+        i += sizeof(simd_word_t);
+      }
+
+      return i / sizeof(TLane);
+    }
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,172 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BASE64_SIMD_INCLUDED
+#define ETL_BASE64_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// Vector kernels for the Base64 encoder and decoder, in the style of Muła and
+// Lemire. Each kernel only processes whole vectors. The caller finishes the
+// remaining blocks with the scalar code.
+// In C++14 and above the callers are constexpr, so the kernels are only
+// enabled if the compiler can tell when it is evaluating at compile time.
+// Define ETL_BASE64_USING_SIMD as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_BASE64_USING_SIMD)
+  #if ETL_USING_SSSE3 && (!ETL_USING_CPP14 || ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+    #define ETL_BASE64_USING_SIMD 1
+  #else
+    #define ETL_BASE64_USING_SIMD 0
+  #endif
+#endif
+
+#if ETL_BASE64_USING_SIMD
+
+#include <tmmintrin.h>
+
+namespace etl
+{
+  namespace private_base64
+  {
+    //*************************************************************************
+    /// Returns true when evaluated at compile time.
+    //*************************************************************************
+    inline ETL_CONSTEXPR bool is_constant_evaluated()
+    {
+#if ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+      return __builtin_is_constant_evaluated();
+#else
+      return false;
+#endif
+    }
+
+    //*************************************************************************
+    /// Encodes groups of four 3 byte blocks to 16 characters.
+    /// Each group loads 16 bytes, so the last two blocks are left for the caller.
+    /// Advances p_input and p_output, and reduces n_blocks by the blocks encoded.
+    //*************************************************************************
+    inline void simd_encode(const uint8_t*& p_input, char*& p_output, size_t& n_blocks, const char* encoder_table)
+    {
+      // Moves each 3 bytes to 4, as [b1, b0, b2, b1], ready to split into sextets.
+      const __m128i spread = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+      // Offsets from a sextet to its character, indexed by the sextet's range.
+      const __m128i offsets = _mm_setr_epi8(static_cast<char>('a' - 26),
+                                            static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                            static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                            static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                            static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                            static_cast<char>('0' - 52), static_cast<char>('0' - 52),
+                                            static_cast<char>(encoder_table[62] - 62),
+                                            static_cast<char>(encoder_table[63] - 63),
+                                            'A', 0, 0);
+
+      while (n_blocks >= 6U)
+      {
+        __m128i input = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p_input)), spread);
+
+        // Split into sextets, one per byte.
+        const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        const __m128i sextets = _mm_or_si128(t0, t1);
+
+        // 0 for 26 to 51, 1 to 10 for the digits, 11 and 12 for 62 and 63, 13 for 0 to 25.
+        __m128i range = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+        range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_output), _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, range)));
+
+        p_input  += 12U;
+        p_output += 16U;
+        n_blocks -= 4U;
+      }
+    }
+
+    //*************************************************************************
+    /// Decodes groups of 16 characters to four 3 byte blocks.
+    /// Each group stores 16 bytes, so needs room for two more blocks than it decodes.
+    /// Stops at the first group that contains a character that is not in the table.
+    /// Advances p_input and p_output, and reduces n_blocks by the blocks decoded.
+    //*************************************************************************
+    inline void simd_decode(const char*& p_input, unsigned char*& p_output, size_t& n_blocks, const char* encoder_table)
+    {
+      const __m128i char_62 = _mm_set1_epi8(encoder_table[62]);
+      const __m128i char_63 = _mm_set1_epi8(encoder_table[63]);
+
+      while (n_blocks >= 6U)
+      {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_input));
+
+        // Bytes of 0x80 and above compare as negative, so are in none of the ranges.
+        const __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(input, _mm_set1_epi8('Z' + 1)));
+        const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(input, _mm_set1_epi8('z' + 1)));
+        const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(input, _mm_set1_epi8('9' + 1)));
+        const __m128i is_62    = _mm_cmpeq_epi8(input, char_62);
+        const __m128i is_63    = _mm_cmpeq_epi8(input, char_63);
+
+        const __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(is_upper, is_lower), _mm_or_si128(is_digit, is_62)), is_63);
+
+        if (_mm_movemask_epi8(valid) != 0xFFFF)
+        {
+          break;
+        }
+
+        __m128i offset = _mm_and_si128(is_upper, _mm_set1_epi8(static_cast<char>(-'A')));
+        offset = _mm_or_si128(offset, _mm_and_si128(is_lower, _mm_set1_epi8(static_cast<char>(26 - 'a'))));
+        offset = _mm_or_si128(offset, _mm_and_si128(is_digit, _mm_set1_epi8(static_cast<char>(52 - '0'))));
+        offset = _mm_or_si128(offset, _mm_and_si128(is_62,    _mm_set1_epi8(static_cast<char>(62 - encoder_table[62]))));
+        offset = _mm_or_si128(offset, _mm_and_si128(is_63,    _mm_set1_epi8(static_cast<char>(63 - encoder_table[63]))));
+
+        const __m128i sextets = _mm_add_epi8(input, offset);
+
+        // Join pairs of sextets to 12 bits, then pairs of those to 24 bits.
+        const __m128i pairs  = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+        const __m128i blocks = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+        // Take the three bytes of each block, most significant first.
+        const __m128i output = _mm_shuffle_epi8(blocks, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_output), output);
+
+        p_input  += 16U;
+        p_output += 12U;
+        n_blocks -= 4U;
+      }
+    }
+  }
+}
+
+#endif
+#endif
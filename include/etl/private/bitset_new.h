@@ -48,6 +48,7 @@ SOFTWARE.
 #include "../enum_type.h"
 #include "../largest.h"
 #include "../smallest.h"
+#include "bitset_simd.h"
 
 #include <string.h>
 #include <stddef.h>
@@ -189,6 +190,42 @@ namespace etl
 
     template <typename TElement>
     ETL_CONSTANT TElement bitset_impl_common<TElement>::All_Clear_Element;
+
+    //*************************************************************************
+    /// The element operations for the fused count and find functions.
+    //*************************************************************************
+    struct operation_and
+    {
+      template <typename TElement>
+      static ETL_CONSTEXPR TElement apply(TElement lhs, TElement rhs) ETL_NOEXCEPT
+      {
+        return TElement(lhs & rhs);
+      }
+    };
+
+    struct operation_andnot
+    {
+      template <typename TElement>
+      static ETL_CONSTEXPR TElement apply(TElement lhs, TElement rhs) ETL_NOEXCEPT
+      {
+        return TElement(lhs & TElement(~rhs));
+      }
+    };
+
+#if ETL_BITSET_USING_SIMD
+    //*************************************************************************
+    /// The vector kernel for each operation.
+    //*************************************************************************
+    inline size_t simd_count_of(operation_and, const uint8_t*& p_lhs, const uint8_t*& p_rhs, size_t& n)
+    {
+      return simd_count_and_bits(p_lhs, p_rhs, n);
+    }
+
+    inline size_t simd_count_of(operation_andnot, const uint8_t*& p_lhs, const uint8_t*& p_rhs, size_t& n)
+    {
+      return simd_count_andnot_bits(p_lhs, p_rhs, n);
+    }
+#endif
   }
 
   //*************************************************************************
@@ -682,26 +719,17 @@ namespace etl
     {
       if (position < active_bits)
       {
-        // Where to start.
-        size_t bit = position;
+        // Invert when searching for clear bits, then drop the bits before the start.
+        const element_type invert = state ? All_Clear_Element : All_Set_Element;
+        const element_type value  = element_type((*pbuffer ^ invert) & element_type(All_Set_Element << position));
 
-        element_type mask = 1U << position;
-
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < active_bits)
+          const size_t bit = etl::count_trailing_zeros(value);
+
+          if (bit < active_bits)
           {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
+            return bit;
           }
         }
       }
@@ -709,6 +737,46 @@ namespace etl
       return npos;
     }
 
+    //*************************************************************************
+    /// Count the number of bits set in the lhs and rhs combined by TOperation.
+    //*************************************************************************
+    template <typename TOperation>
+    static
+    ETL_CONSTEXPR14
+    size_t count_of(const_pointer lhs_pbuffer,
+                    const_pointer rhs_pbuffer,
+                    size_t        /*number_of_elements*/) ETL_NOEXCEPT
+    {
+      return etl::count_bits(TOperation::apply(*lhs_pbuffer, *rhs_pbuffer));
+    }
+
+    //*************************************************************************
+    /// Finds the next bit set in the lhs and rhs combined by TOperation.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    template <typename TOperation>
+    static
+    ETL_CONSTEXPR14
+    size_t find_next_of(const_pointer lhs_pbuffer,
+                        const_pointer rhs_pbuffer,
+                        size_t        /*number_of_elements*/,
+                        size_t        active_bits,
+                        size_t        position) ETL_NOEXCEPT
+    {
+      if (position < active_bits)
+      {
+        const element_type value = element_type(TOperation::apply(*lhs_pbuffer, *rhs_pbuffer) & element_type(All_Set_Element << position));
+
+        if (value != All_Clear_Element)
+        {
+          return etl::count_trailing_zeros(value);
+        }
+      }
+
+      return npos;
+    }
+
     //*************************************************************************
     /// operator assignment
     /// Assigns rhs to lhs
@@ -910,6 +978,19 @@ namespace etl
     {
       size_t count = 0;
 
+#if ETL_BITSET_USING_SIMD
+      if (!private_bitset::is_constant_evaluated())
+      {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(pbuffer);
+        size_t         n = number_of_elements * sizeof(element_type);
+
+        count = private_bitset::simd_count_bits(p, n);
+
+        pbuffer            = reinterpret_cast<const_pointer>(p);
+        number_of_elements = n / sizeof(element_type);
+      }
+#endif
+
       while (number_of_elements-- != 0)
       {
         count += etl::count_bits(*pbuffer++);
@@ -1473,49 +1554,128 @@ namespace etl
                      bool          state,
                      size_t        position) ETL_NOEXCEPT
     {
+      if (position >= total_bits)
+      {
+        return npos;
+      }
+
       // Where to start.
       size_t index = position >> log2<Bits_Per_Element>::value;
       size_t bit   = position & (Bits_Per_Element - 1);
 
-      element_type mask = 1 << bit;
+      // Invert when searching for clear bits, so that the search is always for a set bit.
+      const element_type invert = state ? All_Clear_Element : All_Set_Element;
+
+      // Drop the bits before the start.
+      element_type value = element_type((pbuffer[index] ^ invert) & element_type(All_Set_Element << bit));
 
       // For each element in the bitset...
-      while (index < number_of_elements)
+      while (true)
       {
-        element_type value = pbuffer[index];
+        if (value != All_Clear_Element)
+        {
+          position = (index << log2<Bits_Per_Element>::value) + etl::count_trailing_zeros(value);
+
+          // The unused bits of the last element may match.
+          return (position < total_bits) ? position : npos;
+        }
+
+        ++index;
 
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) ||
-            (!state && (value != All_Set_Element)))
+        // Skip groups of elements with no match.
+        while (((index + 4U) <= number_of_elements) &&
+               (element_type((pbuffer[index]      ^ invert) | (pbuffer[index + 1U] ^ invert) |
+                             (pbuffer[index + 2U] ^ invert) | (pbuffer[index + 3U] ^ invert)) == All_Clear_Element))
         {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
+          index += 4U;
         }
-        else
+
+        if (index == number_of_elements)
         {
-          position += (Bits_Per_Element - bit);
+          return npos;
         }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
+        value = element_type(pbuffer[index] ^ invert);
+      }
+    }
 
-        ++index;
+    //*************************************************************************
+    /// Count the number of bits set in the lhs and rhs combined by TOperation.
+    //*************************************************************************
+    template <typename TOperation>
+    static
+    ETL_CONSTEXPR14
+    size_t count_of(const_pointer lhs_pbuffer,
+                    const_pointer rhs_pbuffer,
+                    size_t        number_of_elements) ETL_NOEXCEPT
+    {
+      size_t count = 0;
+
+#if ETL_BITSET_USING_SIMD
+      if (!private_bitset::is_constant_evaluated())
+      {
+        const uint8_t* p_lhs = reinterpret_cast<const uint8_t*>(lhs_pbuffer);
+        const uint8_t* p_rhs = reinterpret_cast<const uint8_t*>(rhs_pbuffer);
+        size_t         n     = number_of_elements * sizeof(element_type);
+
+        count = private_bitset::simd_count_of(TOperation(), p_lhs, p_rhs, n);
+
+        lhs_pbuffer        = reinterpret_cast<const_pointer>(p_lhs);
+        rhs_pbuffer        = reinterpret_cast<const_pointer>(p_rhs);
+        number_of_elements = n / sizeof(element_type);
       }
+#endif
 
-      return npos;
+      while (number_of_elements-- != 0)
+      {
+        count += etl::count_bits(TOperation::apply(*lhs_pbuffer++, *rhs_pbuffer++));
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Finds the next bit set in the lhs and rhs combined by TOperation.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    template <typename TOperation>
+    static
+    ETL_CONSTEXPR14
+    size_t find_next_of(const_pointer lhs_pbuffer,
+                        const_pointer rhs_pbuffer,
+                        size_t        number_of_elements,
+                        size_t        total_bits,
+                        size_t        position) ETL_NOEXCEPT
+    {
+      if (position >= total_bits)
+      {
+        return npos;
+      }
+
+      // Where to start.
+      size_t index = position >> log2<Bits_Per_Element>::value;
+      size_t bit   = position & (Bits_Per_Element - 1);
+
+      // Drop the bits before the start.
+      element_type value = element_type(TOperation::apply(lhs_pbuffer[index], rhs_pbuffer[index]) & element_type(All_Set_Element << bit));
+
+      // For each element in the bitset...
+      while (true)
+      {
+        if (value != All_Clear_Element)
+        {
+          // The unused bits of the last element are always clear in the lhs.
+          return (index << log2<Bits_Per_Element>::value) + etl::count_trailing_zeros(value);
+        }
+
+        if (++index == number_of_elements)
+        {
+          return npos;
+        }
+
+        value = TOperation::apply(lhs_pbuffer[index], rhs_pbuffer[index]);
+      }
     }
 
     //*************************************************************************
@@ -2565,6 +2725,62 @@ namespace etl
       return implementation::find_next(buffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// The number of bits set in both this and other.
+    /// The same as (*this & other).count(), without the temporary.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t and_count(const bitset<Active_Bits, TElement>& other) const ETL_NOEXCEPT
+    {
+      return implementation::template count_of<private_bitset::operation_and>(buffer, other.buffer, Number_Of_Elements);
+    }
+
+    //*************************************************************************
+    /// The number of bits set in this and clear in other.
+    /// The same as (*this & ~other).count(), without the temporary.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t andnot_count(const bitset<Active_Bits, TElement>& other) const ETL_NOEXCEPT
+    {
+      return implementation::template count_of<private_bitset::operation_andnot>(buffer, other.buffer, Number_Of_Elements);
+    }
+
+    //*************************************************************************
+    /// Finds the first bit set in both this and other.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t and_find_first(const bitset<Active_Bits, TElement>& other) const ETL_NOEXCEPT
+    {
+      return implementation::template find_next_of<private_bitset::operation_and>(buffer, other.buffer, Number_Of_Elements, Active_Bits, 0);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit set in both this and other.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t and_find_next(const bitset<Active_Bits, TElement>& other, size_t position) const ETL_NOEXCEPT
+    {
+      return implementation::template find_next_of<private_bitset::operation_and>(buffer, other.buffer, Number_Of_Elements, Active_Bits, position);
+    }
+
+    //*************************************************************************
+    /// Finds the first bit set in this and clear in other.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t andnot_find_first(const bitset<Active_Bits, TElement>& other) const ETL_NOEXCEPT
+    {
+      return implementation::template find_next_of<private_bitset::operation_andnot>(buffer, other.buffer, Number_Of_Elements, Active_Bits, 0);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit set in this and clear in other.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t andnot_find_next(const bitset<Active_Bits, TElement>& other, size_t position) const ETL_NOEXCEPT
+    {
+      return implementation::template find_next_of<private_bitset::operation_andnot>(buffer, other.buffer, Number_Of_Elements, Active_Bits, position);
+    }
+
     //*************************************************************************
     /// operator &
     //*************************************************************************
@@ -2631,6 +2847,38 @@ namespace etl
       return *this;
     }
 
+    //*************************************************************************
+    /// ANDs each bitset in the range into this one.
+    /// The range may be of bitsets or of pointers to bitsets.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 bitset<Active_Bits, TElement>& and_with(TIterator first, TIterator last) ETL_NOEXCEPT
+    {
+      while (first != last)
+      {
+        implementation::operator_and(buffer, operand(*first).buffer, Number_Of_Elements);
+        ++first;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// ORs each bitset in the range into this one.
+    /// The range may be of bitsets or of pointers to bitsets.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 bitset<Active_Bits, TElement>& or_with(TIterator first, TIterator last) ETL_NOEXCEPT
+    {
+      while (first != last)
+      {
+        implementation::operator_or(buffer, operand(*first).buffer, Number_Of_Elements);
+        ++first;
+      }
+
+      return *this;
+    }
+
     //*************************************************************************
     /// operator ~
     //*************************************************************************
@@ -2748,6 +2996,19 @@ namespace etl
     // The implementation of the bitset functionality.
     typedef etl::bitset_impl<element_type, (Number_Of_Elements == 1U) ? etl::bitset_storage_model::Single : etl::bitset_storage_model::Multi> implementation;
 
+    //*************************************************************************
+    /// The bitset of an and_with or or_with range element.
+    //*************************************************************************
+    static ETL_CONSTEXPR const bitset<Active_Bits, TElement>& operand(const bitset<Active_Bits, TElement>& other) ETL_NOEXCEPT
+    {
+      return other;
+    }
+
+    static ETL_CONSTEXPR const bitset<Active_Bits, TElement>& operand(const bitset<Active_Bits, TElement>* pother) ETL_NOEXCEPT
+    {
+      return *pother;
+    }
+
     // The storage for the bitset.
     element_type buffer[Number_Of_Elements];
   };
@@ -3563,6 +3824,62 @@ namespace etl
       return implementation::find_next(pbuffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// The number of bits set in both this and other.
+    /// The same as (*this & other).count(), without the temporary.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t and_count(const bitset_ext<Active_Bits, TElement>& other) const ETL_NOEXCEPT
+    {
+      return implementation::template count_of<private_bitset::operation_and>(pbuffer, other.pbuffer, Number_Of_Elements);
+    }
+
+    //*************************************************************************
+    /// The number of bits set in this and clear in other.
+    /// The same as (*this & ~other).count(), without the temporary.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t andnot_count(const bitset_ext<Active_Bits, TElement>& other) const ETL_NOEXCEPT
+    {
+      return implementation::template count_of<private_bitset::operation_andnot>(pbuffer, other.pbuffer, Number_Of_Elements);
+    }
+
+    //*************************************************************************
+    /// Finds the first bit set in both this and other.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t and_find_first(const bitset_ext<Active_Bits, TElement>& other) const ETL_NOEXCEPT
+    {
+      return implementation::template find_next_of<private_bitset::operation_and>(pbuffer, other.pbuffer, Number_Of_Elements, Active_Bits, 0);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit set in both this and other.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t and_find_next(const bitset_ext<Active_Bits, TElement>& other, size_t position) const ETL_NOEXCEPT
+    {
+      return implementation::template find_next_of<private_bitset::operation_and>(pbuffer, other.pbuffer, Number_Of_Elements, Active_Bits, position);
+    }
+
+    //*************************************************************************
+    /// Finds the first bit set in this and clear in other.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t andnot_find_first(const bitset_ext<Active_Bits, TElement>& other) const ETL_NOEXCEPT
+    {
+      return implementation::template find_next_of<private_bitset::operation_andnot>(pbuffer, other.pbuffer, Number_Of_Elements, Active_Bits, 0);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit set in this and clear in other.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t andnot_find_next(const bitset_ext<Active_Bits, TElement>& other, size_t position) const ETL_NOEXCEPT
+    {
+      return implementation::template find_next_of<private_bitset::operation_andnot>(pbuffer, other.pbuffer, Number_Of_Elements, Active_Bits, position);
+    }
+
     //*************************************************************************
     /// operator &=
     //*************************************************************************
@@ -3593,6 +3910,38 @@ namespace etl
       return *this;
     }
 
+    //*************************************************************************
+    /// ANDs each bitset in the range into this one.
+    /// The range may be of bitsets or of pointers to bitsets.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 bitset_ext<Active_Bits, TElement>& and_with(TIterator first, TIterator last) ETL_NOEXCEPT
+    {
+      while (first != last)
+      {
+        implementation::operator_and(pbuffer, operand(*first).pbuffer, Number_Of_Elements);
+        ++first;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// ORs each bitset in the range into this one.
+    /// The range may be of bitsets or of pointers to bitsets.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 bitset_ext<Active_Bits, TElement>& or_with(TIterator first, TIterator last) ETL_NOEXCEPT
+    {
+      while (first != last)
+      {
+        implementation::operator_or(pbuffer, operand(*first).pbuffer, Number_Of_Elements);
+        ++first;
+      }
+
+      return *this;
+    }
+
     //*************************************************************************
     /// operator <<=
     //*************************************************************************
@@ -3660,6 +4009,19 @@ namespace etl
     // The implementation of the bitset functionality.
     typedef etl::bitset_impl<element_type, (Number_Of_Elements == 1U) ? etl::bitset_storage_model::Single : etl::bitset_storage_model::Multi> implementation;
 
+    //*************************************************************************
+    /// The bitset of an and_with or or_with range element.
+    //*************************************************************************
+    static ETL_CONSTEXPR const bitset_ext<Active_Bits, TElement>& operand(const bitset_ext<Active_Bits, TElement>& other) ETL_NOEXCEPT
+    {
+      return other;
+    }
+
+    static ETL_CONSTEXPR const bitset_ext<Active_Bits, TElement>& operand(const bitset_ext<Active_Bits, TElement>* pother) ETL_NOEXCEPT
+    {
+      return *pother;
+    }
+
     // Pointer to the storage for the bitset.
     element_type* pbuffer;
   };
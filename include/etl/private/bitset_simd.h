@@ -0,0 +1,285 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BITSET_SIMD_INCLUDED
+#define ETL_BITSET_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// Vector kernels for large bitsets.
+// The population counts are the Harley-Seal carry save adder method of Muła,
+// Kurz and Lemire, which only counts the bits of each vector once for every
+// sixteen vectors. The fused counts combine two bitsets as they are loaded.
+// Each kernel only processes whole blocks of vectors. The caller counts the
+// remaining elements with the scalar code.
+// In C++14 and above the callers are constexpr, so the kernels are only
+// enabled if the compiler can tell when it is evaluating at compile time.
+// Define ETL_BITSET_USING_SIMD as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_BITSET_USING_SIMD)
+  #if ETL_USING_AVX2 && (!ETL_USING_CPP14 || ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+    #define ETL_BITSET_USING_SIMD 1
+  #else
+    #define ETL_BITSET_USING_SIMD 0
+  #endif
+#endif
+
+#if ETL_BITSET_USING_SIMD
+
+#include <immintrin.h>
+
+namespace etl
+{
+  namespace private_bitset
+  {
+    //*************************************************************************
+    /// Returns true when evaluated at compile time.
+    //*************************************************************************
+    inline ETL_CONSTEXPR bool is_constant_evaluated()
+    {
+#if ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+      return __builtin_is_constant_evaluated();
+#else
+      return false;
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of bytes counted by each step of simd_count_bits.
+    //*************************************************************************
+    static ETL_CONSTANT size_t Simd_Count_Block_Size = 16U * sizeof(__m256i);
+
+    //*************************************************************************
+    /// The bit count of each 64 bit lane, by nibble lookup.
+    //*************************************************************************
+    inline __m256i simd_count_lanes(__m256i value)
+    {
+      const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                              0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+      const __m256i low_mask = _mm256_set1_epi8(0x0F);
+
+      const __m256i low  = _mm256_shuffle_epi8(lookup, _mm256_and_si256(value, low_mask));
+      const __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(value, 4), low_mask));
+
+      return _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256());
+    }
+
+    //*************************************************************************
+    /// Carry save adder. Adds a, b and c, bit by bit, to high and low.
+    //*************************************************************************
+    inline void simd_carry_save_add(__m256i& high, __m256i& low, __m256i a, __m256i b, __m256i c)
+    {
+      const __m256i u = _mm256_xor_si256(a, b);
+
+      high = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+      low  = _mm256_xor_si256(u, c);
+    }
+
+    //*************************************************************************
+    /// Loads the vectors to count from one buffer.
+    //*************************************************************************
+    struct simd_load_bits
+    {
+      explicit simd_load_bits(const uint8_t* p_)
+        : p(p_)
+      {
+      }
+
+      __m256i operator ()(size_t i) const
+      {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p) + i);
+      }
+
+      void advance()
+      {
+        p += Simd_Count_Block_Size;
+      }
+
+      const uint8_t* p;
+    };
+
+    //*************************************************************************
+    /// Loads the vectors to count as lhs & rhs.
+    //*************************************************************************
+    struct simd_load_and_bits
+    {
+      simd_load_and_bits(const uint8_t* p_lhs_, const uint8_t* p_rhs_)
+        : p_lhs(p_lhs_)
+        , p_rhs(p_rhs_)
+      {
+      }
+
+      __m256i operator ()(size_t i) const
+      {
+        return _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_lhs) + i),
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_rhs) + i));
+      }
+
+      void advance()
+      {
+        p_lhs += Simd_Count_Block_Size;
+        p_rhs += Simd_Count_Block_Size;
+      }
+
+      const uint8_t* p_lhs;
+      const uint8_t* p_rhs;
+    };
+
+    //*************************************************************************
+    /// Loads the vectors to count as lhs & ~rhs.
+    //*************************************************************************
+    struct simd_load_andnot_bits
+    {
+      simd_load_andnot_bits(const uint8_t* p_lhs_, const uint8_t* p_rhs_)
+        : p_lhs(p_lhs_)
+        , p_rhs(p_rhs_)
+      {
+      }
+
+      __m256i operator ()(size_t i) const
+      {
+        return _mm256_andnot_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_rhs) + i),
+                                   _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_lhs) + i));
+      }
+
+      void advance()
+      {
+        p_lhs += Simd_Count_Block_Size;
+        p_rhs += Simd_Count_Block_Size;
+      }
+
+      const uint8_t* p_lhs;
+      const uint8_t* p_rhs;
+    };
+
+    //*************************************************************************
+    /// Counts the set bits in whole blocks of Simd_Count_Block_Size bytes.
+    /// Reduces n by the bytes counted.
+    //*************************************************************************
+    template <typename TLoad>
+    size_t simd_count_blocks(TLoad& load, size_t& n)
+    {
+      __m256i total    = _mm256_setzero_si256();
+      __m256i ones     = _mm256_setzero_si256();
+      __m256i twos     = _mm256_setzero_si256();
+      __m256i fours    = _mm256_setzero_si256();
+      __m256i eights   = _mm256_setzero_si256();
+      __m256i sixteens = _mm256_setzero_si256();
+      __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
+
+      while (n >= Simd_Count_Block_Size)
+      {
+        simd_carry_save_add(twos_a,   ones,   ones,   load(0),  load(1));
+        simd_carry_save_add(twos_b,   ones,   ones,   load(2),  load(3));
+        simd_carry_save_add(fours_a,  twos,   twos,   twos_a,   twos_b);
+        simd_carry_save_add(twos_a,   ones,   ones,   load(4),  load(5));
+        simd_carry_save_add(twos_b,   ones,   ones,   load(6),  load(7));
+        simd_carry_save_add(fours_b,  twos,   twos,   twos_a,   twos_b);
+        simd_carry_save_add(eights_a, fours,  fours,  fours_a,  fours_b);
+        simd_carry_save_add(twos_a,   ones,   ones,   load(8),  load(9));
+        simd_carry_save_add(twos_b,   ones,   ones,   load(10), load(11));
+        simd_carry_save_add(fours_a,  twos,   twos,   twos_a,   twos_b);
+        simd_carry_save_add(twos_a,   ones,   ones,   load(12), load(13));
+        simd_carry_save_add(twos_b,   ones,   ones,   load(14), load(15));
+        simd_carry_save_add(fours_b,  twos,   twos,   twos_a,   twos_b);
+        simd_carry_save_add(eights_b, fours,  fours,  fours_a,  fours_b);
+        simd_carry_save_add(sixteens, eights, eights, eights_a, eights_b);
+
+        total = _mm256_add_epi64(total, simd_count_lanes(sixteens));
+
+        load.advance();
+        n -= Simd_Count_Block_Size;
+      }
+
+      // Add the partial sums, weighted by their place.
+      total = _mm256_slli_epi64(total, 4);
+      total = _mm256_add_epi64(total, _mm256_slli_epi64(simd_count_lanes(eights), 3));
+      total = _mm256_add_epi64(total, _mm256_slli_epi64(simd_count_lanes(fours),  2));
+      total = _mm256_add_epi64(total, _mm256_slli_epi64(simd_count_lanes(twos),   1));
+      total = _mm256_add_epi64(total, simd_count_lanes(ones));
+
+      uint64_t lanes[4];
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), total);
+
+      return static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+
+    //*************************************************************************
+    /// Counts the set bits in whole blocks of Simd_Count_Block_Size bytes.
+    /// Advances p and reduces n by the bytes counted.
+    //*************************************************************************
+    inline size_t simd_count_bits(const uint8_t*& p, size_t& n)
+    {
+      simd_load_bits load(p);
+
+      const size_t count = simd_count_blocks(load, n);
+      p = load.p;
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Counts the bits set in both, in whole blocks of Simd_Count_Block_Size bytes.
+    /// Advances p_lhs and p_rhs and reduces n by the bytes counted.
+    //*************************************************************************
+    inline size_t simd_count_and_bits(const uint8_t*& p_lhs, const uint8_t*& p_rhs, size_t& n)
+    {
+      simd_load_and_bits load(p_lhs, p_rhs);
+
+      const size_t count = simd_count_blocks(load, n);
+      p_lhs = load.p_lhs;
+      p_rhs = load.p_rhs;
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Counts the bits set in lhs and clear in rhs, in whole blocks of Simd_Count_Block_Size bytes.
+    /// Advances p_lhs and p_rhs and reduces n by the bytes counted.
+    //*************************************************************************
+    inline size_t simd_count_andnot_bits(const uint8_t*& p_lhs, const uint8_t*& p_rhs, size_t& n)
+    {
+      simd_load_andnot_bits load(p_lhs, p_rhs);
+
+      const size_t count = simd_count_blocks(load, n);
+      p_lhs = load.p_lhs;
+      p_rhs = load.p_rhs;
+
+      return count;
+    }
+  }
+}
+
+#endif
+#endif
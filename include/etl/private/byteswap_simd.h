@@ -0,0 +1,217 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BYTESWAP_SIMD_INCLUDED
+#define ETL_BYTESWAP_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Vector kernels for the bulk byte reversal of 16, 32 and 64 bit values.
+// Each kernel only processes whole vectors. The caller finishes the
+// remaining values with the scalar code.
+// A whole vector is loaded before it is stored, so the source and
+// destination may be the same.
+// Uses AVX2, SSSE3 or SSE2, NEON or MVE when available.
+// Define ETL_BYTESWAP_USING_SIMD as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_BYTESWAP_USING_SIMD)
+  #if ETL_USING_SSE2 || ETL_USING_NEON || ETL_USING_MVE
+    #define ETL_BYTESWAP_USING_SIMD 1
+  #else
+    #define ETL_BYTESWAP_USING_SIMD 0
+  #endif
+#endif
+
+#if ETL_BYTESWAP_USING_SIMD
+  #if ETL_USING_AVX2
+    #include <immintrin.h>
+  #elif ETL_USING_SSSE3
+    #include <tmmintrin.h>
+  #elif ETL_USING_SSE2
+    #include <emmintrin.h>
+  #elif ETL_USING_MVE
+    #include <arm_mve.h>
+  #elif ETL_USING_NEON
+    #include <arm_neon.h>
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_byteswap
+  {
+    //*************************************************************************
+    /// The kernels for types without vector support do nothing.
+    //*************************************************************************
+    template <typename T>
+    void simd_byteswap(const T*&, T*&, size_t&)
+    {
+    }
+
+#if ETL_BYTESWAP_USING_SIMD
+  #if ETL_USING_SSE2
+    #if ETL_USING_SSSE3
+    //*************************************************************************
+    /// Reverses the bytes of each value with a byte shuffle.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    template <typename T>
+    void simd_shuffle(const T*& source, T*& destination, size_t& n, const __m128i& order)
+    {
+      const size_t Per_Vector = 16U / sizeof(T);
+
+    #if ETL_USING_AVX2
+      const __m256i order256 = _mm256_broadcastsi128_si256(order);
+
+      for (; n >= (2U * Per_Vector); n -= (2U * Per_Vector), source += (2U * Per_Vector), destination += (2U * Per_Vector))
+      {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), _mm256_shuffle_epi8(v, order256));
+      }
+    #endif
+
+      for (; n >= Per_Vector; n -= Per_Vector, source += Per_Vector, destination += Per_Vector)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_shuffle_epi8(v, order));
+      }
+    }
+
+    inline void simd_byteswap(const uint16_t*& source, uint16_t*& destination, size_t& n)
+    {
+      simd_shuffle(source, destination, n, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+    }
+
+    inline void simd_byteswap(const uint32_t*& source, uint32_t*& destination, size_t& n)
+    {
+      simd_shuffle(source, destination, n, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    }
+
+    inline void simd_byteswap(const uint64_t*& source, uint64_t*& destination, size_t& n)
+    {
+      simd_shuffle(source, destination, n, _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    }
+    #else
+    //*************************************************************************
+    /// Swaps the bytes of each 16 bit lane.
+    //*************************************************************************
+    inline __m128i swap_bytes_16(__m128i v)
+    {
+      return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    }
+
+    //*************************************************************************
+    /// Reverses the bytes of each value with shifts and word shuffles.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_byteswap(const uint16_t*& source, uint16_t*& destination, size_t& n)
+    {
+      for (; n >= 8U; n -= 8U, source += 8U, destination += 8U)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), swap_bytes_16(v));
+      }
+    }
+
+    inline void simd_byteswap(const uint32_t*& source, uint32_t*& destination, size_t& n)
+    {
+      for (; n >= 4U; n -= 4U, source += 4U, destination += 4U)
+      {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+        // Swap the 16 bit words of each value, then the bytes of each word.
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), swap_bytes_16(v));
+      }
+    }
+
+    inline void simd_byteswap(const uint64_t*& source, uint64_t*& destination, size_t& n)
+    {
+      for (; n >= 2U; n -= 2U, source += 2U, destination += 2U)
+      {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+        // Reverse the 16 bit words of each value, then the bytes of each word.
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), swap_bytes_16(v));
+      }
+    }
+    #endif
+  #elif ETL_USING_MVE || ETL_USING_NEON
+    //*************************************************************************
+    /// Reverses the bytes of each value with VREV16, VREV32 and VREV64.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_byteswap(const uint16_t*& source, uint16_t*& destination, size_t& n)
+    {
+      for (; n >= 8U; n -= 8U, source += 8U, destination += 8U)
+      {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(source));
+
+        vst1q_u8(reinterpret_cast<uint8_t*>(destination), vrev16q_u8(v));
+      }
+    }
+
+    inline void simd_byteswap(const uint32_t*& source, uint32_t*& destination, size_t& n)
+    {
+      for (; n >= 4U; n -= 4U, source += 4U, destination += 4U)
+      {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(source));
+
+        vst1q_u8(reinterpret_cast<uint8_t*>(destination), vrev32q_u8(v));
+      }
+    }
+
+    inline void simd_byteswap(const uint64_t*& source, uint64_t*& destination, size_t& n)
+    {
+      for (; n >= 2U; n -= 2U, source += 2U, destination += 2U)
+      {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(source));
+
+        vst1q_u8(reinterpret_cast<uint8_t*>(destination), vrev64q_u8(v));
+      }
+    }
+  #endif
+#endif
+  }
+}
+
+#endif
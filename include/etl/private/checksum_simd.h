@@ -0,0 +1,219 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CHECKSUM_SIMD_INCLUDED
+#define ETL_CHECKSUM_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if ETL_USING_SSE2 || ETL_USING_AVX2 || ETL_USING_NEON || ETL_USING_MVE
+  #define ETL_CHECKSUM_USING_SIMD 1
+#else
+  #define ETL_CHECKSUM_USING_SIMD 0
+#endif
+
+#if ETL_CHECKSUM_USING_SIMD
+
+#if ETL_USING_AVX2
+  #include <immintrin.h>
+#elif ETL_USING_SSE2
+  #include <emmintrin.h>
+#elif ETL_USING_MVE
+  #include <arm_mve.h>
+#elif ETL_USING_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_checksum
+  {
+    //*************************************************************************
+    /// Sums the bytes of whole vectors.
+    /// Advances p_data and reduces length by the number of bytes consumed.
+    /// \return The sum of the consumed bytes.
+    //*************************************************************************
+    inline uint64_t simd_sum(const uint8_t*& p_data, size_t& length)
+    {
+      uint64_t sum = 0U;
+
+#if ETL_USING_AVX2
+      {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i       acc  = _mm256_setzero_si256();
+
+        while (length >= 32U)
+        {
+          const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data));
+          acc = _mm256_add_epi64(acc, _mm256_sad_epu8(v, zero));
+
+          p_data += 32U;
+          length -= 32U;
+        }
+
+        uint64_t lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        sum += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+      }
+#endif
+
+#if ETL_USING_SSE2 || ETL_USING_AVX2
+      {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i       acc  = _mm_setzero_si128();
+
+        while (length >= 16U)
+        {
+          const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_data));
+          acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+
+          p_data += 16U;
+          length -= 16U;
+        }
+
+        uint64_t lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        sum += lanes[0] + lanes[1];
+      }
+#elif ETL_USING_MVE
+      while (length >= 16U)
+      {
+        // A 32 bit accumulator can take 2^20 vectors of 0xFF.
+        size_t   blocks = length / 16U;
+        uint32_t acc    = 0U;
+
+        blocks  = (blocks > 0x100000U) ? 0x100000U : blocks;
+        length -= blocks * 16U;
+
+        while (blocks != 0U)
+        {
+          acc = vaddvaq_u8(acc, vld1q_u8(p_data));
+
+          p_data += 16U;
+          --blocks;
+        }
+
+        sum += acc;
+      }
+#elif ETL_USING_NEON
+      while (length >= 16U)
+      {
+        // Each 32 bit lane gains at most 4 x 0xFF per vector.
+        size_t     blocks = length / 16U;
+        uint32x4_t acc    = vdupq_n_u32(0U);
+
+        blocks  = (blocks > 0x100000U) ? 0x100000U : blocks;
+        length -= blocks * 16U;
+
+        while (blocks != 0U)
+        {
+          acc = vpadalq_u16(acc, vpaddlq_u8(vld1q_u8(p_data)));
+
+          p_data += 16U;
+          --blocks;
+        }
+
+        const uint64x2_t total = vpaddlq_u32(acc);
+        sum += vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1);
+      }
+#endif
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// XORs the bytes of whole vectors.
+    /// Advances p_data and reduces length by the number of bytes consumed.
+    /// \return The XOR of the consumed bytes.
+    //*************************************************************************
+    inline uint8_t simd_xor(const uint8_t*& p_data, size_t& length)
+    {
+      uint8_t bytes[16] = { 0U };
+
+#if ETL_USING_SSE2 || ETL_USING_AVX2
+      __m128i acc = _mm_setzero_si128();
+
+  #if ETL_USING_AVX2
+      if (length >= 32U)
+      {
+        __m256i acc256 = _mm256_setzero_si256();
+
+        while (length >= 32U)
+        {
+          acc256 = _mm256_xor_si256(acc256, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data)));
+
+          p_data += 32U;
+          length -= 32U;
+        }
+
+        acc = _mm_xor_si128(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+      }
+  #endif
+
+      while (length >= 16U)
+      {
+        acc = _mm_xor_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_data)));
+
+        p_data += 16U;
+        length -= 16U;
+      }
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), acc);
+#elif ETL_USING_MVE || ETL_USING_NEON
+      uint8x16_t acc = vdupq_n_u8(0U);
+
+      while (length >= 16U)
+      {
+        acc = veorq_u8(acc, vld1q_u8(p_data));
+
+        p_data += 16U;
+        length -= 16U;
+      }
+
+      vst1q_u8(bytes, acc);
+#endif
+
+      uint8_t result = 0U;
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        result ^= bytes[i];
+      }
+
+      return result;
+    }
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,382 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_FOLDING_INCLUDED
+#define ETL_CRC_FOLDING_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+
+#if ETL_USING_CRC_FOLDING
+
+#if ETL_USING_PCLMUL
+  #include <wmmintrin.h>
+  #include <tmmintrin.h>
+#else
+  #include <arm_neon.h>
+#endif
+
+//*****************************************************************************
+// The minimum length of data, in bytes, for which folding is used.
+// Shorter blocks use the table driven calculation.
+//*****************************************************************************
+#if !defined(ETL_CRC_FOLDING_THRESHOLD)
+  #define ETL_CRC_FOLDING_THRESHOLD 64U
+#endif
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*****************************************************************************
+    /// Compile time GF(2) arithmetic modulo the CRC polynomial.
+    /// Polynomials are held in normal (non-reflected) bit order.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_fold_arithmetic
+    {
+      static ETL_CONSTANT size_t   Bits = TCrcParameters::Accumulator_Bits;
+      static ETL_CONSTANT uint64_t Mask = (Bits == 64U) ? UINT64_MAX : ((uint64_t(1U) << (Bits % 64U)) - 1U);
+      static ETL_CONSTANT uint64_t Poly = uint64_t(TCrcParameters::Polynomial);
+
+      //*********************************
+      /// a * x mod P
+      static ETL_CONSTEXPR uint64_t mulx(uint64_t a)
+      {
+        return ((a << 1U) & Mask) ^ ((((a >> (Bits - 1U)) & 1U) != 0U) ? Poly : 0U);
+      }
+
+      //*********************************
+      /// a * b mod P, Horner's method from bit i - 1 down.
+      static ETL_CONSTEXPR uint64_t mulmod(uint64_t a, uint64_t b, size_t i, uint64_t r)
+      {
+        return (i == 0U) ? r : mulmod(a, b, i - 1U, mulx(r) ^ ((((b >> (i - 1U)) & 1U) != 0U) ? a : 0U));
+      }
+
+      //*********************************
+      /// a * a mod P
+      static ETL_CONSTEXPR uint64_t square(uint64_t a)
+      {
+        return mulmod(a, a, Bits, 0U);
+      }
+
+      //*********************************
+      /// x^n mod P
+      static ETL_CONSTEXPR uint64_t xpow(size_t n)
+      {
+        return (n == 0U) ? 1U : (((n & 1U) != 0U) ? mulx(xpow(n - 1U)) : square(xpow(n / 2U)));
+      }
+
+      //*********************************
+      /// Reverses the order of the 64 bits.
+      static ETL_CONSTEXPR uint64_t reflect(uint64_t v)
+      {
+        return swap_bits(swap_bits(swap_bits(swap_bits(swap_bits(swap_bits(v, 1U,  0x5555555555555555ULL),
+                                                                              2U,  0x3333333333333333ULL),
+                                                                              4U,  0x0F0F0F0F0F0F0F0FULL),
+                                                                              8U,  0x00FF00FF00FF00FFULL),
+                                                                              16U, 0x0000FFFF0000FFFFULL),
+                                                                              32U, 0x00000000FFFFFFFFULL);
+      }
+
+      //*********************************
+      /// The fold multiplier for x^n, in the order used by the carry-less multiply.
+      /// The reflected form is pre-divided by x, as the reflected product is one bit short.
+      static ETL_CONSTEXPR uint64_t key(size_t n)
+      {
+        return TCrcParameters::Reflect ? reflect(xpow(n - 1U)) : xpow(n);
+      }
+
+    private:
+
+      static ETL_CONSTEXPR uint64_t swap_bits(uint64_t v, size_t shift, uint64_t mask)
+      {
+        return ((v >> shift) & mask) | ((v & mask) << shift);
+      }
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT size_t crc_fold_arithmetic<TCrcParameters>::Bits;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_arithmetic<TCrcParameters>::Mask;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_arithmetic<TCrcParameters>::Poly;
+
+    //*****************************************************************************
+    /// The fold constants for a set of CRC parameters.
+    /// Folding a 128 bit value forward by N bits multiplies the upper 64 bits by
+    /// x^(N + 64) mod P and the lower 64 bits by x^N mod P.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_fold_constants
+    {
+      typedef crc_fold_arithmetic<TCrcParameters> arithmetic;
+
+      static ETL_CONSTANT uint64_t Fold_128_Hi = arithmetic::key(128U + 64U);
+      static ETL_CONSTANT uint64_t Fold_128_Lo = arithmetic::key(128U);
+      static ETL_CONSTANT uint64_t Fold_256_Hi = arithmetic::key(256U + 64U);
+      static ETL_CONSTANT uint64_t Fold_256_Lo = arithmetic::key(256U);
+      static ETL_CONSTANT uint64_t Fold_384_Hi = arithmetic::key(384U + 64U);
+      static ETL_CONSTANT uint64_t Fold_384_Lo = arithmetic::key(384U);
+      static ETL_CONSTANT uint64_t Fold_512_Hi = arithmetic::key(512U + 64U);
+      static ETL_CONSTANT uint64_t Fold_512_Lo = arithmetic::key(512U);
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_constants<TCrcParameters>::Fold_128_Hi;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_constants<TCrcParameters>::Fold_128_Lo;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_constants<TCrcParameters>::Fold_256_Hi;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_constants<TCrcParameters>::Fold_256_Lo;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_constants<TCrcParameters>::Fold_384_Hi;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_constants<TCrcParameters>::Fold_384_Lo;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_constants<TCrcParameters>::Fold_512_Hi;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT uint64_t crc_fold_constants<TCrcParameters>::Fold_512_Lo;
+
+#if ETL_USING_PCLMUL
+    //*****************************************************************************
+    /// x86 PCLMULQDQ operations.
+    /// Reflected values are held little endian, so the upper polynomial half is
+    /// in the low lane. Normal values are byte reversed into the high lane.
+    //*****************************************************************************
+    template <bool Reflect>
+    struct crc_fold_operations
+    {
+      typedef __m128i vector_type;
+
+      //*********************************
+      static vector_type load(const uint8_t* p_data)
+      {
+        vector_type v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_data));
+
+        return Reflect ? v : _mm_shuffle_epi8(v, byte_reverse_mask());
+      }
+
+      //*********************************
+      static void store(uint8_t* p_data, vector_type v)
+      {
+        if (!Reflect)
+        {
+          v = _mm_shuffle_epi8(v, byte_reverse_mask());
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_data), v);
+      }
+
+      //*********************************
+      static vector_type initial(uint64_t crc, size_t bits)
+      {
+        return Reflect ? _mm_set_epi64x(0, static_cast<int64_t>(crc))
+                       : _mm_set_epi64x(static_cast<int64_t>(crc << (64U - bits)), 0);
+      }
+
+      //*********************************
+      static vector_type fold(vector_type v, uint64_t k_hi, uint64_t k_lo)
+      {
+        const vector_type k = Reflect ? _mm_set_epi64x(static_cast<int64_t>(k_lo), static_cast<int64_t>(k_hi))
+                                      : _mm_set_epi64x(static_cast<int64_t>(k_hi), static_cast<int64_t>(k_lo));
+
+        return _mm_xor_si128(_mm_clmulepi64_si128(v, k, 0x00), _mm_clmulepi64_si128(v, k, 0x11));
+      }
+
+      //*********************************
+      static vector_type bitwise_xor(vector_type a, vector_type b)
+      {
+        return _mm_xor_si128(a, b);
+      }
+
+    private:
+
+      //*********************************
+      static vector_type byte_reverse_mask()
+      {
+        return _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+      }
+    };
+#else
+    //*****************************************************************************
+    /// AArch64 PMULL operations.
+    /// Reflected values are held little endian, so the upper polynomial half is
+    /// in lane 0. Normal values are byte reversed, putting it in lane 1.
+    //*****************************************************************************
+    template <bool Reflect>
+    struct crc_fold_operations
+    {
+      typedef uint64x2_t vector_type;
+
+      static ETL_CONSTANT int Hi_Lane = Reflect ? 0 : 1;
+      static ETL_CONSTANT int Lo_Lane = Reflect ? 1 : 0;
+
+      //*********************************
+      static vector_type load(const uint8_t* p_data)
+      {
+        if (Reflect)
+        {
+          return vreinterpretq_u64_u8(vld1q_u8(p_data));
+        }
+        else
+        {
+          vector_type v = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(p_data)));
+
+          return vextq_u64(v, v, 1);
+        }
+      }
+
+      //*********************************
+      static void store(uint8_t* p_data, vector_type v)
+      {
+        if (Reflect)
+        {
+          vst1q_u8(p_data, vreinterpretq_u8_u64(v));
+        }
+        else
+        {
+          v = vextq_u64(v, v, 1);
+          vst1q_u8(p_data, vrev64q_u8(vreinterpretq_u8_u64(v)));
+        }
+      }
+
+      //*********************************
+      static vector_type initial(uint64_t crc, size_t bits)
+      {
+        return Reflect ? vcombine_u64(vcreate_u64(crc), vcreate_u64(0U))
+                       : vcombine_u64(vcreate_u64(0U), vcreate_u64(crc << (64U - bits)));
+      }
+
+      //*********************************
+      static vector_type fold(vector_type v, uint64_t k_hi, uint64_t k_lo)
+      {
+        poly128_t hi = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(v, Hi_Lane)), static_cast<poly64_t>(k_hi));
+        poly128_t lo = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(v, Lo_Lane)), static_cast<poly64_t>(k_lo));
+
+        return veorq_u64(vreinterpretq_u64_p128(hi), vreinterpretq_u64_p128(lo));
+      }
+
+      //*********************************
+      static vector_type bitwise_xor(vector_type a, vector_type b)
+      {
+        return veorq_u64(a, b);
+      }
+    };
+#endif
+
+    //*****************************************************************************
+    /// Folds whole 128 bit blocks down to a single 128 bit remainder.
+    /// The CRC of the blocks is the table driven CRC of the remainder, starting
+    /// from zero.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_folding
+    {
+      typedef typename TCrcParameters::accumulator_type   accumulator_type;
+      typedef crc_fold_constants<TCrcParameters>          constants;
+      typedef crc_fold_operations<TCrcParameters::Reflect> operations;
+      typedef typename operations::vector_type            vector_type;
+
+      static ETL_CONSTANT size_t Block_Size = 16U;
+
+      //*************************************************************************
+      /// \param crc       The current accumulator value.
+      /// \param p_data    Pointer to the data.
+      /// \param blocks    The number of 16 byte blocks. Must be at least 1.
+      /// \param remainder Receives the folded 16 byte remainder.
+      //*************************************************************************
+      static void fold(accumulator_type crc, const uint8_t* p_data, size_t blocks, uint8_t (&remainder)[Block_Size])
+      {
+        vector_type x0 = operations::bitwise_xor(operations::load(p_data), operations::initial(uint64_t(crc), TCrcParameters::Accumulator_Bits));
+
+        if (blocks >= 4U)
+        {
+          // Four independent lanes hide the multiply latency.
+          vector_type x1 = operations::load(p_data + (1U * Block_Size));
+          vector_type x2 = operations::load(p_data + (2U * Block_Size));
+          vector_type x3 = operations::load(p_data + (3U * Block_Size));
+
+          p_data += 4U * Block_Size;
+          blocks -= 4U;
+
+          while (blocks >= 4U)
+          {
+            x0 = operations::bitwise_xor(operations::fold(x0, constants::Fold_512_Hi, constants::Fold_512_Lo), operations::load(p_data));
+            x1 = operations::bitwise_xor(operations::fold(x1, constants::Fold_512_Hi, constants::Fold_512_Lo), operations::load(p_data + (1U * Block_Size)));
+            x2 = operations::bitwise_xor(operations::fold(x2, constants::Fold_512_Hi, constants::Fold_512_Lo), operations::load(p_data + (2U * Block_Size)));
+            x3 = operations::bitwise_xor(operations::fold(x3, constants::Fold_512_Hi, constants::Fold_512_Lo), operations::load(p_data + (3U * Block_Size)));
+
+            p_data += 4U * Block_Size;
+            blocks -= 4U;
+          }
+
+          // Combine the lanes.
+          x0 = operations::bitwise_xor(operations::fold(x0, constants::Fold_384_Hi, constants::Fold_384_Lo),
+                                       operations::fold(x1, constants::Fold_256_Hi, constants::Fold_256_Lo));
+          x0 = operations::bitwise_xor(x0, operations::fold(x2, constants::Fold_128_Hi, constants::Fold_128_Lo));
+          x0 = operations::bitwise_xor(x0, x3);
+        }
+        else
+        {
+          p_data += Block_Size;
+          --blocks;
+        }
+
+        while (blocks != 0U)
+        {
+          x0 = operations::bitwise_xor(operations::fold(x0, constants::Fold_128_Hi, constants::Fold_128_Lo), operations::load(p_data));
+
+          p_data += Block_Size;
+          --blocks;
+        }
+
+        operations::store(remainder, x0);
+      }
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT size_t crc_folding<TCrcParameters>::Block_Size;
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,274 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_HARDWARE_INCLUDED
+#define ETL_CRC_HARDWARE_INCLUDED
+
+#include "../platform.h"
+#include "crc_parameters.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_HARDWARE_CRC32_C && !defined(ETL_USE_USER_CRC32_C_HARDWARE)
+  #if ETL_USING_SSE42
+    #include <nmmintrin.h>
+    #define ETL_CRC32_C_USING_SSE42
+  #elif ETL_USING_ARM_CRC32
+    #include <arm_acle.h>
+    #define ETL_CRC32_C_USING_ARM_ACLE
+  #endif
+#endif
+
+#if ETL_USING_HARDWARE_CRC32 && !defined(ETL_USE_USER_CRC32_HARDWARE)
+  #if ETL_USING_ARM_CRC32
+    #include <arm_acle.h>
+    #define ETL_CRC32_USING_ARM_ACLE
+  #endif
+#endif
+
+namespace etl
+{
+#if defined(ETL_USE_USER_CRC32_HARDWARE)
+  //***************************************************************************
+  /// User supplied CRC32 calculation, such as a peripheral CRC unit.
+  /// Must be defined by the application.
+  /// \param crc      The current reflected accumulator value, without the final xor.
+  /// \param p_data   Pointer to the data.
+  /// \param length   The number of bytes.
+  /// \return The updated reflected accumulator value.
+  //***************************************************************************
+  uint32_t crc32_user_hardware(uint32_t crc, const uint8_t* p_data, size_t length);
+#endif
+
+#if defined(ETL_USE_USER_CRC32_C_HARDWARE)
+  //***************************************************************************
+  /// User supplied CRC32-C calculation, such as a peripheral CRC unit.
+  /// Must be defined by the application.
+  /// \param crc      The current reflected accumulator value, without the final xor.
+  /// \param p_data   Pointer to the data.
+  /// \param length   The number of bytes.
+  /// \return The updated reflected accumulator value.
+  //***************************************************************************
+  uint32_t crc32_c_user_hardware(uint32_t crc, const uint8_t* p_data, size_t length);
+#endif
+
+  namespace private_crc
+  {
+    //*****************************************************************************
+    /// Drives a set of hardware CRC primitives over a block of data.
+    /// Words are loaded with memcpy, so the data does not need to be aligned.
+    //*****************************************************************************
+    template <typename TPrimitives>
+    struct crc_hardware_block
+    {
+      static uint32_t add(uint32_t crc, const uint8_t* p_data, size_t length)
+      {
+#if ETL_USING_64BIT_TYPES
+        while (length >= 8U)
+        {
+          uint64_t word;
+          memcpy(&word, p_data, sizeof(word));
+          crc = TPrimitives::add_u64(crc, word);
+          p_data += 8U;
+          length -= 8U;
+        }
+#endif
+
+        while (length >= 4U)
+        {
+          uint32_t word;
+          memcpy(&word, p_data, sizeof(word));
+          crc = TPrimitives::add_u32(crc, word);
+          p_data += 4U;
+          length -= 4U;
+        }
+
+        while (length != 0U)
+        {
+          crc = TPrimitives::add_u8(crc, *p_data);
+          ++p_data;
+          --length;
+        }
+
+        return crc;
+      }
+    };
+
+#if defined(ETL_CRC32_C_USING_SSE42)
+    //*****************************************************************************
+    /// SSE4.2 CRC32-C primitives.
+    //*****************************************************************************
+    struct crc32_c_sse42_primitives
+    {
+      static uint32_t add_u8(uint32_t crc, uint8_t value)
+      {
+        return _mm_crc32_u8(crc, value);
+      }
+
+      static uint32_t add_u32(uint32_t crc, uint32_t value)
+      {
+        return _mm_crc32_u32(crc, value);
+      }
+
+  #if ETL_USING_64BIT_TYPES
+      static uint32_t add_u64(uint32_t crc, uint64_t value)
+      {
+    #if defined(__x86_64__) || defined(_M_X64)
+        return static_cast<uint32_t>(_mm_crc32_u64(crc, value));
+    #else
+        crc = _mm_crc32_u32(crc, static_cast<uint32_t>(value));
+        return _mm_crc32_u32(crc, static_cast<uint32_t>(value >> 32U));
+    #endif
+      }
+  #endif
+    };
+#endif
+
+#if defined(ETL_CRC32_C_USING_ARM_ACLE)
+    //*****************************************************************************
+    /// ARMv8 CRC32-C primitives.
+    //*****************************************************************************
+    struct crc32_c_arm_primitives
+    {
+      static uint32_t add_u8(uint32_t crc, uint8_t value)
+      {
+        return __crc32cb(crc, value);
+      }
+
+      static uint32_t add_u32(uint32_t crc, uint32_t value)
+      {
+        return __crc32cw(crc, value);
+      }
+
+  #if ETL_USING_64BIT_TYPES
+      static uint32_t add_u64(uint32_t crc, uint64_t value)
+      {
+        return __crc32cd(crc, value);
+      }
+  #endif
+    };
+#endif
+
+#if defined(ETL_CRC32_USING_ARM_ACLE)
+    //*****************************************************************************
+    /// ARMv8 CRC32 primitives.
+    //*****************************************************************************
+    struct crc32_arm_primitives
+    {
+      static uint32_t add_u8(uint32_t crc, uint8_t value)
+      {
+        return __crc32b(crc, value);
+      }
+
+      static uint32_t add_u32(uint32_t crc, uint32_t value)
+      {
+        return __crc32w(crc, value);
+      }
+
+  #if ETL_USING_64BIT_TYPES
+      static uint32_t add_u64(uint32_t crc, uint64_t value)
+      {
+        return __crc32d(crc, value);
+      }
+  #endif
+    };
+#endif
+
+    //*****************************************************************************
+    /// Hardware CRC backend.
+    /// The default is 'not available'; the table driven policy is used.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_hardware
+    {
+      static ETL_CONSTANT bool Available = false;
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT bool crc_hardware<TCrcParameters>::Available;
+
+#if ETL_USING_HARDWARE_CRC32_C
+    //*********************************
+    // CRC32-C
+    template <>
+    struct crc_hardware<crc32_c_parameters>
+    {
+      static ETL_CONSTANT bool Available = true;
+
+      static uint32_t add(uint32_t crc, uint8_t value)
+      {
+        return add(crc, &value, 1U);
+      }
+
+      static uint32_t add(uint32_t crc, const uint8_t* p_data, size_t length)
+      {
+  #if defined(ETL_USE_USER_CRC32_C_HARDWARE)
+        return etl::crc32_c_user_hardware(crc, p_data, length);
+  #elif defined(ETL_CRC32_C_USING_SSE42)
+        return crc_hardware_block<crc32_c_sse42_primitives>::add(crc, p_data, length);
+  #else
+        return crc_hardware_block<crc32_c_arm_primitives>::add(crc, p_data, length);
+  #endif
+      }
+    };
+#endif
+
+#if ETL_USING_HARDWARE_CRC32
+    //*********************************
+    // CRC32
+    template <>
+    struct crc_hardware<crc32_parameters>
+    {
+      static ETL_CONSTANT bool Available = true;
+
+      static uint32_t add(uint32_t crc, uint8_t value)
+      {
+        return add(crc, &value, 1U);
+      }
+
+      static uint32_t add(uint32_t crc, const uint8_t* p_data, size_t length)
+      {
+  #if defined(ETL_USE_USER_CRC32_HARDWARE)
+        return etl::crc32_user_hardware(crc, p_data, length);
+  #else
+        return crc_hardware_block<crc32_arm_primitives>::add(crc, p_data, length);
+  #endif
+      }
+    };
+#endif
+  }
+}
+
+#undef ETL_CRC32_C_USING_SSE42
+#undef ETL_CRC32_C_USING_ARM_ACLE
+#undef ETL_CRC32_USING_ARM_ACLE
+
+#endif
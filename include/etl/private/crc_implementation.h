@@ -40,6 +40,8 @@ SOFTWARE.
 #include "stdint.h"
 
 #include "crc_parameters.h"
+#include "crc_hardware.h"
+#include "crc_folding.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -155,6 +157,54 @@ namespace etl
     template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
     ETL_CONSTANT TAccumulator crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
 
+    //*****************************************************************************
+    /// CRC Slice Table Entry
+    /// The CRC contribution of byte 'Index' followed by 'Slice' zero bytes.
+    /// Slice 0 is the standard 256 entry table.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    class crc_slice_table_entry
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous = crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice - 1U>::value;
+
+      static ETL_CONSTANT TAccumulator Reflected_Value = TAccumulator((Previous >> 8U) ^
+                                                         crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, size_t(Previous & 0xFFU), 8U>::value);
+
+      static ETL_CONSTANT TAccumulator Normal_Value    = TAccumulator((Previous << 8U) ^
+                                                         crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, size_t((Previous >> (Accumulator_Bits - 8U)) & 0xFFU), 8U>::value);
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = Reflect ? Reflected_Value : Normal_Value;
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Previous;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Reflected_Value;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Normal_Value;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::value;
+
+    //*********************************
+    // Slice 0.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    class crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>::value;
+
     //*****************************************************************************
     /// CRC Update Chunk
     //*****************************************************************************
@@ -587,12 +637,179 @@ namespace etl
       }
     };
 
+    //*****************************************************************************
+    // CRC Slice Tables.
+    // Processes 'Slices' bytes per iteration using 'Slices' x 256 entry tables.
+    //*****************************************************************************
+#define ETL_CRC_SLICE_ENTRY(Slice, Index)      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, (Index), (Slice)>::value
+#define ETL_CRC_SLICE_ENTRIES_4(Slice, Index)  ETL_CRC_SLICE_ENTRY(Slice, (Index) + 0U),  ETL_CRC_SLICE_ENTRY(Slice, (Index) + 1U), \
+                                               ETL_CRC_SLICE_ENTRY(Slice, (Index) + 2U),  ETL_CRC_SLICE_ENTRY(Slice, (Index) + 3U)
+#define ETL_CRC_SLICE_ENTRIES_16(Slice, Index) ETL_CRC_SLICE_ENTRIES_4(Slice, (Index) + 0U),  ETL_CRC_SLICE_ENTRIES_4(Slice, (Index) + 4U), \
+                                               ETL_CRC_SLICE_ENTRIES_4(Slice, (Index) + 8U),  ETL_CRC_SLICE_ENTRIES_4(Slice, (Index) + 12U)
+#define ETL_CRC_SLICE_ROW(Slice)               { ETL_CRC_SLICE_ENTRIES_16(Slice, 0U),   ETL_CRC_SLICE_ENTRIES_16(Slice, 16U),  \
+                                                 ETL_CRC_SLICE_ENTRIES_16(Slice, 32U),  ETL_CRC_SLICE_ENTRIES_16(Slice, 48U),  \
+                                                 ETL_CRC_SLICE_ENTRIES_16(Slice, 64U),  ETL_CRC_SLICE_ENTRIES_16(Slice, 80U),  \
+                                                 ETL_CRC_SLICE_ENTRIES_16(Slice, 96U),  ETL_CRC_SLICE_ENTRIES_16(Slice, 112U), \
+                                                 ETL_CRC_SLICE_ENTRIES_16(Slice, 128U), ETL_CRC_SLICE_ENTRIES_16(Slice, 144U), \
+                                                 ETL_CRC_SLICE_ENTRIES_16(Slice, 160U), ETL_CRC_SLICE_ENTRIES_16(Slice, 176U), \
+                                                 ETL_CRC_SLICE_ENTRIES_16(Slice, 192U), ETL_CRC_SLICE_ENTRIES_16(Slice, 208U), \
+                                                 ETL_CRC_SLICE_ENTRIES_16(Slice, 224U), ETL_CRC_SLICE_ENTRIES_16(Slice, 240U) }
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table_data;
+
+    //*********************************
+    // Slice by 8.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>
+    {
+      static const TAccumulator table[8U][256U];
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    const TAccumulator crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>::table[8U][256U] =
+    {
+      ETL_CRC_SLICE_ROW(0U), ETL_CRC_SLICE_ROW(1U), ETL_CRC_SLICE_ROW(2U), ETL_CRC_SLICE_ROW(3U),
+      ETL_CRC_SLICE_ROW(4U), ETL_CRC_SLICE_ROW(5U), ETL_CRC_SLICE_ROW(6U), ETL_CRC_SLICE_ROW(7U)
+    };
+
+    //*********************************
+    // Slice by 16.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>
+    {
+      static const TAccumulator table[16U][256U];
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    const TAccumulator crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>::table[16U][256U] =
+    {
+      ETL_CRC_SLICE_ROW(0U),  ETL_CRC_SLICE_ROW(1U),  ETL_CRC_SLICE_ROW(2U),  ETL_CRC_SLICE_ROW(3U),
+      ETL_CRC_SLICE_ROW(4U),  ETL_CRC_SLICE_ROW(5U),  ETL_CRC_SLICE_ROW(6U),  ETL_CRC_SLICE_ROW(7U),
+      ETL_CRC_SLICE_ROW(8U),  ETL_CRC_SLICE_ROW(9U),  ETL_CRC_SLICE_ROW(10U), ETL_CRC_SLICE_ROW(11U),
+      ETL_CRC_SLICE_ROW(12U), ETL_CRC_SLICE_ROW(13U), ETL_CRC_SLICE_ROW(14U), ETL_CRC_SLICE_ROW(15U)
+    };
+
+#undef ETL_CRC_SLICE_ENTRY
+#undef ETL_CRC_SLICE_ENTRIES_4
+#undef ETL_CRC_SLICE_ENTRIES_16
+#undef ETL_CRC_SLICE_ROW
+
+    //*********************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table
+    {
+      static ETL_CONSTANT size_t Accumulator_Bytes = Accumulator_Bits / 8U;
+
+      typedef crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices> data_t;
+
+      //*************************************************************************
+      /// Adds a single byte, using the first slice.
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, data_t::table[0]);
+      }
+
+      //*************************************************************************
+      /// Adds a block of bytes, 'Slices' bytes at a time.
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, const uint8_t* p_data, size_t length) const
+      {
+        while (length >= Slices)
+        {
+          TAccumulator result = 0U;
+
+          for (size_t i = 0U; i < Slices; ++i)
+          {
+            uint8_t index = p_data[i];
+
+            if (i < Accumulator_Bytes)
+            {
+              index ^= Reflect ? uint8_t(crc >> (8U * i))
+                               : uint8_t(crc >> (Accumulator_Bits - 8U - (8U * i)));
+            }
+
+            result ^= data_t::table[Slices - 1U - i][index];
+          }
+
+          crc     = result;
+          p_data += Slices;
+          length -= Slices;
+        }
+
+        while (length != 0U)
+        {
+          crc = add(crc, *p_data);
+          ++p_data;
+          --length;
+        }
+
+        return crc;
+      }
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    ETL_CONSTANT size_t crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices>::Accumulator_Bytes;
+
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
     template <typename TCrcParameters, size_t Table_Size>
     struct crc_policy;
 
+    //*********************************
+    // Policy for 16 x 256 entry slice-by-16 table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_slice_table<typename TCrcParameters::accumulator_type,
+                                                                      TCrcParameters::Accumulator_Bits,
+                                                                      TCrcParameters::Polynomial,
+                                                                      TCrcParameters::Reflect,
+                                                                      16U>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for 8 x 256 entry slice-by-8 table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_slice_table<typename TCrcParameters::accumulator_type,
+                                                                      TCrcParameters::Accumulator_Bits,
+                                                                      TCrcParameters::Polynomial,
+                                                                      TCrcParameters::Reflect,
+                                                                      8U>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
     //*********************************
     // Policy for 256 entry table.
     template <typename TCrcParameters>
@@ -676,17 +893,203 @@ namespace etl
         return crc ^ TCrcParameters::Xor_Out;
       }
     };
-  }
+
+
+    //*****************************************************************************
+    // CRC Folding Policies.
+    // Blocks of at least ETL_CRC_FOLDING_THRESHOLD bytes are folded with carry-less
+    // multiplies, and the remainder reduced with the table driven policy.
+    //*****************************************************************************
+#if ETL_USING_CRC_FOLDING
+    template <typename TCrcParameters, size_t Table_Size>
+    struct crc_folding_policy : public crc_policy<TCrcParameters, Table_Size>
+    {
+      ETL_STATIC_ASSERT(ETL_CRC_FOLDING_THRESHOLD >= 16U, "ETL_CRC_FOLDING_THRESHOLD must be at least 16");
+
+      typedef crc_policy<TCrcParameters, Table_Size>    table_policy;
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      using table_policy::add;
+
+      //*************************************************************************
+      accumulator_type add(accumulator_type crc, const uint8_t* p_data, size_t length) const
+      {
+        typedef etl::integral_constant<bool, etl::private_frame_check_sequence::has_block_add<table_policy>::value> table_has_block_add;
+
+        static ETL_CONSTANT size_t Block_Size = crc_folding<TCrcParameters>::Block_Size;
+
+        if (length >= ETL_CRC_FOLDING_THRESHOLD)
+        {
+          const size_t blocks = length / Block_Size;
+          uint8_t remainder[Block_Size];
+
+          crc_folding<TCrcParameters>::fold(crc, p_data, blocks, remainder);
+          crc = table_add(accumulator_type(0U), remainder, Block_Size, table_has_block_add());
+
+          p_data += blocks * Block_Size;
+          length -= blocks * Block_Size;
+        }
+
+        return table_add(crc, p_data, length, table_has_block_add());
+      }
+
+    private:
+
+      //*************************************************************************
+      accumulator_type table_add(accumulator_type crc, const uint8_t* p_data, size_t length, etl::true_type) const
+      {
+        return table_policy::add(crc, p_data, length);
+      }
+
+      //*************************************************************************
+      accumulator_type table_add(accumulator_type crc, const uint8_t* p_data, size_t length, etl::false_type) const
+      {
+        while (length != 0U)
+        {
+          crc = table_policy::add(crc, *p_data);
+          ++p_data;
+          --length;
+        }
+
+        return crc;
+      }
+    };
+#else
+    template <typename TCrcParameters, size_t Table_Size>
+    struct crc_folding_policy : public crc_policy<TCrcParameters, Table_Size>
+    {
+    };
+#endif
+
+    //*****************************************************************************
+    // Hardware CRC Policies.
+    // Replaces the table lookups when a hardware backend is available for the
+    // CRC parameters. Otherwise the table driven policy is used unchanged.
+    //*****************************************************************************
+    template <typename TCrcParameters, size_t Table_Size, bool Hardware = crc_hardware<TCrcParameters>::Available>
+    struct crc_hardware_policy : public crc_folding_policy<TCrcParameters, Table_Size>
+    {
+    };
+
+    //*********************************
+    template <typename TCrcParameters, size_t Table_Size>
+    struct crc_hardware_policy<TCrcParameters, Table_Size, true> : public crc_policy<TCrcParameters, Table_Size>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      accumulator_type add(accumulator_type crc, uint8_t value) const
+      {
+        return crc_hardware<TCrcParameters>::add(crc, value);
+      }
+
+      //*************************************************************************
+      accumulator_type add(accumulator_type crc, const uint8_t* p_data, size_t length) const
+      {
+        return crc_hardware<TCrcParameters>::add(crc, p_data, length);
+      }
+    };
+
+    //*****************************************************************************
+    /// Run time GF(2) arithmetic modulo the CRC polynomial.
+    /// Values are in normal (non-reflected) bit order.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_polynomial_arithmetic
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT size_t Bits = TCrcParameters::Accumulator_Bits;
+
+      //*************************************************************************
+      /// a * x mod P
+      //*************************************************************************
+      static accumulator_type multiply_by_x(accumulator_type a)
+      {
+        const bool top_bit_set = ((a >> (Bits - 1U)) & 1U) != 0U;
+
+        a = accumulator_type(a << 1U);
+
+        return top_bit_set ? accumulator_type(a ^ TCrcParameters::Polynomial) : a;
+      }
+
+      //*************************************************************************
+      /// a * b mod P
+      //*************************************************************************
+      static accumulator_type multiply(accumulator_type a, accumulator_type b)
+      {
+        accumulator_type result = 0U;
+
+        for (size_t i = Bits; i != 0U; --i)
+        {
+          result = multiply_by_x(result);
+
+          if (((b >> (i - 1U)) & 1U) != 0U)
+          {
+            result ^= a;
+          }
+        }
+
+        return result;
+      }
+
+      //*************************************************************************
+      /// x^(8 * length) mod P, by repeated squaring.
+      //*************************************************************************
+      static accumulator_type x_to_the_bytes(size_t length)
+      {
+        accumulator_type result = 1U;
+        accumulator_type power  = 1U;
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          power = multiply_by_x(power);
+        }
+
+        while (length != 0U)
+        {
+          if ((length & 1U) != 0U)
+          {
+            result = multiply(result, power);
+          }
+
+          power    = multiply(power, power);
+          length >>= 1U;
+        }
+
+        return result;
+      }
+
+      //*************************************************************************
+      /// Converts an accumulator value to or from normal bit order.
+      //*************************************************************************
+      static accumulator_type to_normal(accumulator_type value)
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits(value) : value;
+      }
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT size_t crc_polynomial_arithmetic<TCrcParameters>::Bits;  }
 
   //*****************************************************************************
   /// Basic parameterised CRC type.
   //*****************************************************************************
   template <typename TCrcParameters, size_t Table_Size>
-  class crc_type : public etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> >
+  class crc_type : public etl::frame_check_sequence<private_crc::crc_hardware_policy<TCrcParameters, Table_Size> >
   {
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U),
+                      "Table size must be 4, 16, 256, 2048 or 4096");
+
+    /// The number of lookup table entries.
+    static ETL_CONSTANT size_t Table_Entries = Table_Size;
+
+    /// The read only memory used by the lookup tables, in bytes.
+    static ETL_CONSTANT size_t Table_Bytes = Table_Size * sizeof(typename TCrcParameters::accumulator_type);
 
     //*************************************************************************
     /// Default constructor.
@@ -707,7 +1110,54 @@ namespace etl
       this->reset();
       this->add(begin, end);
     }
+
+    //*************************************************************************
+    /// Combines the CRCs of two consecutive blocks without reading the data.
+    /// O(log n) in the length of the second block.
+    /// \param crc1    The CRC of the first block.
+    /// \param crc2    The CRC of the second block.
+    /// \param length2 The length of the second block, in bytes.
+    /// \return The CRC of the first block followed by the second.
+    //*************************************************************************
+    static typename TCrcParameters::accumulator_type combine(typename TCrcParameters::accumulator_type crc1,
+                                                             typename TCrcParameters::accumulator_type crc2,
+                                                             size_t length2)
+    {
+      typedef private_crc::crc_polynomial_arithmetic<TCrcParameters> arithmetic;
+      typedef typename TCrcParameters::accumulator_type              accumulator_type;
+
+      const private_crc::crc_policy<TCrcParameters, Table_Size> policy;
+
+      // Remove the final xor from crc1 and the initial value's contribution from crc2.
+      accumulator_type value = accumulator_type(crc1 ^ TCrcParameters::Xor_Out ^ policy.initial());
+
+      value = arithmetic::to_normal(value);
+      value = arithmetic::multiply(value, arithmetic::x_to_the_bytes(length2));
+      value = arithmetic::to_normal(value);
+
+      return accumulator_type(value ^ crc2);
+    }
   };
+
+  template <typename TCrcParameters, size_t Table_Size>
+  ETL_CONSTANT size_t crc_type<TCrcParameters, Table_Size>::Table_Entries;
+
+  template <typename TCrcParameters, size_t Table_Size>
+  ETL_CONSTANT size_t crc_type<TCrcParameters, Table_Size>::Table_Bytes;
+
+  //*****************************************************************************
+  /// Combines the CRCs of two consecutive blocks without reading the data.
+  /// \tparam TCrc   The CRC type, such as etl::crc32.
+  /// \param crc1    The CRC of the first block.
+  /// \param crc2    The CRC of the second block.
+  /// \param length2 The length of the second block, in bytes.
+  /// \return The CRC of the first block followed by the second.
+  //*****************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine(typename TCrc::value_type crc1, typename TCrc::value_type crc2, size_t length2)
+  {
+    return TCrc::combine(crc1, crc2, length2);
+  }
 }
 
 #endif
@@ -0,0 +1,163 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FILTER_SIMD_INCLUDED
+#define ETL_FILTER_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+// Vector multiply accumulate kernels for the floating point filter dot
+// products. Each kernel only processes whole vectors. The caller finishes
+// the remaining values with the scalar code.
+// The products are summed in a different order to the scalar code, so the
+// results may differ in the last bits.
+// Uses SSE2, NEON or MVE when available.
+// Define ETL_FILTER_USING_SIMD as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_FILTER_USING_SIMD)
+  #if ETL_USING_SSE2 || ETL_USING_NEON || ETL_USING_MVE_FLOAT
+    #define ETL_FILTER_USING_SIMD 1
+  #else
+    #define ETL_FILTER_USING_SIMD 0
+  #endif
+#endif
+
+#if ETL_FILTER_USING_SIMD
+  #if ETL_USING_SSE2
+    #include <emmintrin.h>
+  #elif ETL_USING_MVE
+    #include <arm_mve.h>
+  #elif ETL_USING_NEON
+    #include <arm_neon.h>
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_filter
+  {
+    //*************************************************************************
+    /// The kernel for types without vector support does nothing.
+    //*************************************************************************
+    template <typename T>
+    void simd_dot_product(const T*&, const T*&, size_t&, T&)
+    {
+    }
+
+#if ETL_FILTER_USING_SIMD
+  #if ETL_USING_SSE2
+    //*************************************************************************
+    /// Adds the products of whole vectors to sum.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_dot_product(const float*& a, const float*& b, size_t& n, float& sum)
+    {
+      __m128 accumulator0 = _mm_setzero_ps();
+      __m128 accumulator1 = _mm_setzero_ps();
+
+      for (; n >= 8U; n -= 8U, a += 8U, b += 8U)
+      {
+        accumulator0 = _mm_add_ps(accumulator0, _mm_mul_ps(_mm_loadu_ps(a),      _mm_loadu_ps(b)));
+        accumulator1 = _mm_add_ps(accumulator1, _mm_mul_ps(_mm_loadu_ps(a + 4U), _mm_loadu_ps(b + 4U)));
+      }
+
+      float lanes[4];
+      _mm_storeu_ps(lanes, _mm_add_ps(accumulator0, accumulator1));
+
+      sum += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    //*************************************************************************
+    /// Adds the products of whole vectors to sum.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_dot_product(const double*& a, const double*& b, size_t& n, double& sum)
+    {
+      __m128d accumulator0 = _mm_setzero_pd();
+      __m128d accumulator1 = _mm_setzero_pd();
+
+      for (; n >= 4U; n -= 4U, a += 4U, b += 4U)
+      {
+        accumulator0 = _mm_add_pd(accumulator0, _mm_mul_pd(_mm_loadu_pd(a),      _mm_loadu_pd(b)));
+        accumulator1 = _mm_add_pd(accumulator1, _mm_mul_pd(_mm_loadu_pd(a + 2U), _mm_loadu_pd(b + 2U)));
+      }
+
+      double lanes[2];
+      _mm_storeu_pd(lanes, _mm_add_pd(accumulator0, accumulator1));
+
+      sum += lanes[0] + lanes[1];
+    }
+  #elif ETL_USING_MVE
+    //*************************************************************************
+    /// Adds the products of whole vectors to sum.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_dot_product(const float*& a, const float*& b, size_t& n, float& sum)
+    {
+      float32x4_t accumulator = vdupq_n_f32(0.0f);
+
+      for (; n >= 4U; n -= 4U, a += 4U, b += 4U)
+      {
+        accumulator = vfmaq_f32(accumulator, vld1q_f32(a), vld1q_f32(b));
+      }
+
+      sum += (vgetq_lane_f32(accumulator, 0) + vgetq_lane_f32(accumulator, 1)) +
+             (vgetq_lane_f32(accumulator, 2) + vgetq_lane_f32(accumulator, 3));
+    }
+  #elif ETL_USING_NEON
+    //*************************************************************************
+    /// Adds the products of whole vectors to sum.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_dot_product(const float*& a, const float*& b, size_t& n, float& sum)
+    {
+      float32x4_t accumulator0 = vdupq_n_f32(0.0f);
+      float32x4_t accumulator1 = vdupq_n_f32(0.0f);
+
+      for (; n >= 8U; n -= 8U, a += 8U, b += 8U)
+      {
+        accumulator0 = vmlaq_f32(accumulator0, vld1q_f32(a),      vld1q_f32(b));
+        accumulator1 = vmlaq_f32(accumulator1, vld1q_f32(a + 4U), vld1q_f32(b + 4U));
+      }
+
+      const float32x4_t accumulator = vaddq_f32(accumulator0, accumulator1);
+
+      sum += (vgetq_lane_f32(accumulator, 0) + vgetq_lane_f32(accumulator, 1)) +
+             (vgetq_lane_f32(accumulator, 2) + vgetq_lane_f32(accumulator, 3));
+    }
+  #endif
+#endif
+  }
+}
+
+#endif
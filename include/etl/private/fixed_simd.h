@@ -0,0 +1,259 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_SIMD_INCLUDED
+#define ETL_FIXED_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Vector kernels for the bulk operations on 16 bit etl::fixed values.
+// Each kernel only processes whole vectors. The caller finishes the
+// remaining values with the scalar code, which gives identical results.
+// Uses SSE2, NEON or the Cortex-M4/M7 DSP extension when available.
+// Define ETL_FIXED_USING_SIMD as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_FIXED_USING_SIMD)
+  #if ETL_USING_SSE2 || ETL_USING_NEON || ETL_USING_ARM_DSP
+    #define ETL_FIXED_USING_SIMD 1
+  #else
+    #define ETL_FIXED_USING_SIMD 0
+  #endif
+#endif
+
+#if ETL_FIXED_USING_SIMD
+  #if ETL_USING_SSE2
+    #include <emmintrin.h>
+  #elif ETL_USING_NEON
+    #include <arm_neon.h>
+  #elif ETL_USING_ARM_DSP
+    #include <arm_acle.h>
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_fixed
+  {
+    //*************************************************************************
+    /// The kernels for types without vector support do nothing.
+    //*************************************************************************
+    template <typename T>
+    void simd_add(const T*&, const T*&, T*&, size_t&)
+    {
+    }
+
+    template <typename T>
+    void simd_subtract(const T*&, const T*&, T*&, size_t&)
+    {
+    }
+
+    template <typename T>
+    void simd_dot_product(const T*&, const T*&, size_t&, int64_t&)
+    {
+    }
+
+#if ETL_FIXED_USING_SIMD
+  #if ETL_USING_SSE2
+    //*************************************************************************
+    /// Saturating addition of whole vectors.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_add(const int16_t*& a, const int16_t*& b, int16_t*& result, size_t& n)
+    {
+      for (; n >= 8U; n -= 8U, a += 8U, b += 8U, result += 8U)
+      {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm_adds_epi16(va, vb));
+      }
+    }
+
+    //*************************************************************************
+    /// Saturating subtraction of whole vectors.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_subtract(const int16_t*& a, const int16_t*& b, int16_t*& result, size_t& n)
+    {
+      for (; n >= 8U; n -= 8U, a += 8U, b += 8U, result += 8U)
+      {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm_subs_epi16(va, vb));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds the exact products of whole vectors to sum.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_dot_product(const int16_t*& a, const int16_t*& b, size_t& n, int64_t& sum)
+    {
+      __m128i accumulator = _mm_setzero_si128();
+
+      for (; n >= 8U; n -= 8U, a += 8U, b += 8U)
+      {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+
+        // The 32 bit products.
+        const __m128i low  = _mm_mullo_epi16(va, vb);
+        const __m128i high = _mm_mulhi_epi16(va, vb);
+        const __m128i p0   = _mm_unpacklo_epi16(low, high);
+        const __m128i p1   = _mm_unpackhi_epi16(low, high);
+
+        // Sign extend to 64 bits and accumulate.
+        const __m128i s0 = _mm_srai_epi32(p0, 31);
+        const __m128i s1 = _mm_srai_epi32(p1, 31);
+
+        accumulator = _mm_add_epi64(accumulator, _mm_unpacklo_epi32(p0, s0));
+        accumulator = _mm_add_epi64(accumulator, _mm_unpackhi_epi32(p0, s0));
+        accumulator = _mm_add_epi64(accumulator, _mm_unpacklo_epi32(p1, s1));
+        accumulator = _mm_add_epi64(accumulator, _mm_unpackhi_epi32(p1, s1));
+      }
+
+      int64_t lanes[2];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), accumulator);
+
+      sum += lanes[0] + lanes[1];
+    }
+  #elif ETL_USING_NEON
+    //*************************************************************************
+    /// Saturating addition of whole vectors.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_add(const int16_t*& a, const int16_t*& b, int16_t*& result, size_t& n)
+    {
+      for (; n >= 8U; n -= 8U, a += 8U, b += 8U, result += 8U)
+      {
+        vst1q_s16(result, vqaddq_s16(vld1q_s16(a), vld1q_s16(b)));
+      }
+    }
+
+    //*************************************************************************
+    /// Saturating subtraction of whole vectors.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_subtract(const int16_t*& a, const int16_t*& b, int16_t*& result, size_t& n)
+    {
+      for (; n >= 8U; n -= 8U, a += 8U, b += 8U, result += 8U)
+      {
+        vst1q_s16(result, vqsubq_s16(vld1q_s16(a), vld1q_s16(b)));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds the exact products of whole vectors to sum.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_dot_product(const int16_t*& a, const int16_t*& b, size_t& n, int64_t& sum)
+    {
+      int64x2_t accumulator = vdupq_n_s64(0);
+
+      for (; n >= 8U; n -= 8U, a += 8U, b += 8U)
+      {
+        const int16x8_t va = vld1q_s16(a);
+        const int16x8_t vb = vld1q_s16(b);
+
+        accumulator = vpadalq_s32(accumulator, vmull_s16(vget_low_s16(va), vget_low_s16(vb)));
+        accumulator = vpadalq_s32(accumulator, vmull_s16(vget_high_s16(va), vget_high_s16(vb)));
+      }
+
+      sum += vgetq_lane_s64(accumulator, 0) + vgetq_lane_s64(accumulator, 1);
+    }
+  #elif ETL_USING_ARM_DSP
+    //*************************************************************************
+    /// Loads and stores two packed 16 bit values.
+    //*************************************************************************
+    inline int16x2_t load_pair(const int16_t* p)
+    {
+      int16x2_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+    }
+
+    inline void store_pair(int16_t* p, int16x2_t value)
+    {
+      memcpy(p, &value, sizeof(value));
+    }
+
+    //*************************************************************************
+    /// Saturating addition of whole pairs, with QADD16.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_add(const int16_t*& a, const int16_t*& b, int16_t*& result, size_t& n)
+    {
+      for (; n >= 2U; n -= 2U, a += 2U, b += 2U, result += 2U)
+      {
+        store_pair(result, __qadd16(load_pair(a), load_pair(b)));
+      }
+    }
+
+    //*************************************************************************
+    /// Saturating subtraction of whole pairs, with QSUB16.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_subtract(const int16_t*& a, const int16_t*& b, int16_t*& result, size_t& n)
+    {
+      for (; n >= 2U; n -= 2U, a += 2U, b += 2U, result += 2U)
+      {
+        store_pair(result, __qsub16(load_pair(a), load_pair(b)));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds the exact products of whole pairs to sum, with SMLALD.
+    /// SMLALD accumulates in 64 bits, so unlike SMLAD it cannot overflow.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    inline void simd_dot_product(const int16_t*& a, const int16_t*& b, size_t& n, int64_t& sum)
+    {
+      int64_t accumulator = 0;
+
+      for (; n >= 2U; n -= 2U, a += 2U, b += 2U)
+      {
+        accumulator = __smlald(load_pair(a), load_pair(b), accumulator);
+      }
+
+      sum += accumulator;
+    }
+  #endif
+#endif
+  }
+}
+
+#endif
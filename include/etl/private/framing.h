@@ -0,0 +1,196 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FRAMING_INCLUDED
+#define ETL_FRAMING_INCLUDED
+
+#include "../platform.h"
+#include "../delegate.h"
+#include "../span.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace etl
+{
+  namespace private_framing
+  {
+    //*************************************************************************
+    /// Word at a time byte search.
+    /// A word has a byte equal to 'value' when ((x - ones) & ~x & highs) is
+    /// non-zero, where x is the word xor the value in every byte.
+    //*************************************************************************
+    typedef size_t word_type;
+
+    static ETL_CONSTANT word_type Ones  = word_type(~word_type(0U)) / 0xFFU;
+    static ETL_CONSTANT word_type Highs = Ones * 0x80U;
+
+    inline word_type has_byte(word_type word, word_type pattern)
+    {
+      const word_type x = word ^ pattern;
+
+      return (x - Ones) & ~x & Highs;
+    }
+
+    //*************************************************************************
+    /// The index of the first byte equal to 'value', or 'length'.
+    //*************************************************************************
+    inline size_t find_byte(const uint8_t* p, size_t length, uint8_t value)
+    {
+      const word_type pattern = Ones * value;
+
+      size_t i = 0U;
+
+      for (; (length - i) >= sizeof(word_type); i += sizeof(word_type))
+      {
+        word_type word;
+        memcpy(&word, p + i, sizeof(word));
+
+        if (has_byte(word, pattern) != 0U)
+        {
+          break;
+        }
+      }
+
+      while ((i < length) && (p[i] != value))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The index of the first byte equal to 'value1' or 'value2', or 'length'.
+    //*************************************************************************
+    inline size_t find_either(const uint8_t* p, size_t length, uint8_t value1, uint8_t value2)
+    {
+      const word_type pattern1 = Ones * value1;
+      const word_type pattern2 = Ones * value2;
+
+      size_t i = 0U;
+
+      for (; (length - i) >= sizeof(word_type); i += sizeof(word_type))
+      {
+        word_type word;
+        memcpy(&word, p + i, sizeof(word));
+
+        if ((has_byte(word, pattern1) | has_byte(word, pattern2)) != 0U)
+        {
+          break;
+        }
+      }
+
+      while ((i < length) && (p[i] != value1) && (p[i] != value2))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The output buffer of an encoder or decoder.
+    /// If there is a callback, the encoders send each full buffer to it.
+    /// Otherwise data that does not fit sets the overflow flag.
+    //*************************************************************************
+    class output_buffer
+    {
+    public:
+
+      typedef etl::span<const uint8_t>              span_type;
+      typedef etl::delegate<void(const span_type&)> callback_type;
+
+      //***********************************
+      output_buffer(uint8_t* p_buffer_, size_t max_size_, callback_type callback_)
+        : p_buffer(p_buffer_)
+        , length(0U)
+        , max_size(max_size_)
+        , callback(callback_)
+        , overflowed(false)
+      {
+      }
+
+      //***********************************
+      /// Appends bytes. Sends the buffer to the callback each time it fills
+      /// when 'stream' is true.
+      //***********************************
+      void push(const uint8_t* p, size_t n, bool stream)
+      {
+        while (n != 0U)
+        {
+          if (length == max_size)
+          {
+            if (stream && callback.is_valid())
+            {
+              callback(span());
+              length = 0U;
+            }
+            else
+            {
+              overflowed = true;
+              return;
+            }
+          }
+
+          const size_t free  = max_size - length;
+          const size_t count = (n < free) ? n : free;
+
+          memcpy(p_buffer + length, p, count);
+
+          length += count;
+          p      += count;
+          n      -= count;
+        }
+      }
+
+      //***********************************
+      void push(uint8_t value, bool stream)
+      {
+        push(&value, 1U, stream);
+      }
+
+      //***********************************
+      span_type span() const
+      {
+        return span_type(p_buffer, length);
+      }
+
+      uint8_t*      p_buffer;
+      size_t        length;
+      const size_t  max_size;
+      callback_type callback;
+      bool          overflowed;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,302 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HASH_TABLE_GROUP_INCLUDED
+#define ETL_HASH_TABLE_GROUP_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if ETL_USING_SSE2
+  #include <emmintrin.h>
+#elif ETL_USING_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_hash_table
+  {
+    //*************************************************************************
+    /// Control byte values.
+    /// A full slot holds 7 bits of the element's hash (0 to 127).
+    //*************************************************************************
+    struct control
+    {
+      static ETL_CONSTANT int8_t Empty   = -128;
+      static ETL_CONSTANT int8_t Deleted = -2;
+
+      static bool is_full(int8_t c)
+      {
+        return c >= 0;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Hash table group policies.
+  /// A group matches 16 control bytes at a time.
+  /// Each match returns a mask; lowest_index() gives the slot of the lowest
+  /// match in the group, and 'mask &= (mask - 1)' moves on to the next one.
+  /// match() may report slots that hold a different hash fragment, but these
+  /// are always full slots, so a key comparison rejects them.
+  //***************************************************************************
+
+  //***************************************************************************
+  /// Portable group, working on 32 bit words.
+  /// Suitable for cores without SIMD, such as the Cortex-M0.
+  //***************************************************************************
+  class hash_table_group_scalar
+  {
+  public:
+
+    static ETL_CONSTANT size_t Width = 16U;
+
+    typedef uint32_t mask_type;
+
+    //*******************************
+    explicit hash_table_group_scalar(const int8_t* pcontrol)
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(pcontrol);
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        word[i] =  uint32_t(p[0])         | (uint32_t(p[1]) << 8U) |
+                  (uint32_t(p[2]) << 16U) | (uint32_t(p[3]) << 24U);
+        p += 4U;
+      }
+    }
+
+    //*******************************
+    /// The slots that match the hash fragment.
+    //*******************************
+    mask_type match(int8_t h2) const
+    {
+      const uint32_t pattern = Lsbs * uint8_t(h2);
+
+      mask_type mask = 0U;
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        const uint32_t x = word[i] ^ pattern;
+        mask |= compress((x - Lsbs) & ~x & Msbs) << (i * 4U);
+      }
+
+      return mask;
+    }
+
+    //*******************************
+    /// The slots that are empty.
+    //*******************************
+    mask_type match_empty() const
+    {
+      mask_type mask = 0U;
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        mask |= compress(word[i] & ~(word[i] << 6U) & Msbs) << (i * 4U);
+      }
+
+      return mask;
+    }
+
+    //*******************************
+    /// The slots that are empty or deleted.
+    //*******************************
+    mask_type match_empty_or_deleted() const
+    {
+      mask_type mask = 0U;
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        mask |= compress(word[i] & ~(word[i] << 7U) & Msbs) << (i * 4U);
+      }
+
+      return mask;
+    }
+
+    //*******************************
+    static size_t lowest_index(mask_type mask)
+    {
+      return etl::count_trailing_zeros(mask);
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t   Words = Width / 4U;
+    static ETL_CONSTANT uint32_t Lsbs  = 0x01010101UL;
+    static ETL_CONSTANT uint32_t Msbs  = 0x80808080UL;
+
+    //*******************************
+    /// Gathers the top bit of each byte into the bottom 4 bits.
+    //*******************************
+    static mask_type compress(uint32_t bits)
+    {
+      return uint32_t((bits >> 7U) * 0x10204080UL) >> 28U;
+    }
+
+    uint32_t word[Words];
+  };
+
+#if ETL_USING_SSE2
+  //***************************************************************************
+  /// SSE2 group.
+  //***************************************************************************
+  class hash_table_group_sse2
+  {
+  public:
+
+    static ETL_CONSTANT size_t Width = 16U;
+
+    typedef uint32_t mask_type;
+
+    //*******************************
+    explicit hash_table_group_sse2(const int8_t* pcontrol)
+      : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pcontrol)))
+    {
+    }
+
+    //*******************************
+    /// The slots that match the hash fragment.
+    //*******************************
+    mask_type match(int8_t h2) const
+    {
+      return mask_type(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+    }
+
+    //*******************************
+    /// The slots that are empty.
+    //*******************************
+    mask_type match_empty() const
+    {
+      return match(private_hash_table::control::Empty);
+    }
+
+    //*******************************
+    /// The slots that are empty or deleted.
+    //*******************************
+    mask_type match_empty_or_deleted() const
+    {
+      return mask_type(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)));
+    }
+
+    //*******************************
+    static size_t lowest_index(mask_type mask)
+    {
+      return etl::count_trailing_zeros(mask);
+    }
+
+  private:
+
+    __m128i ctrl;
+  };
+#endif
+
+#if ETL_USING_NEON && ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// NEON group.
+  /// The mask has 4 bits per slot, of which only the top one is kept.
+  //***************************************************************************
+  class hash_table_group_neon
+  {
+  public:
+
+    static ETL_CONSTANT size_t Width = 16U;
+
+    typedef uint64_t mask_type;
+
+    //*******************************
+    explicit hash_table_group_neon(const int8_t* pcontrol)
+      : ctrl(vld1q_s8(pcontrol))
+    {
+    }
+
+    //*******************************
+    /// The slots that match the hash fragment.
+    //*******************************
+    mask_type match(int8_t h2) const
+    {
+      return to_mask(vceqq_s8(ctrl, vdupq_n_s8(h2)));
+    }
+
+    //*******************************
+    /// The slots that are empty.
+    //*******************************
+    mask_type match_empty() const
+    {
+      return match(private_hash_table::control::Empty);
+    }
+
+    //*******************************
+    /// The slots that are empty or deleted.
+    //*******************************
+    mask_type match_empty_or_deleted() const
+    {
+      return to_mask(vcltq_s8(ctrl, vdupq_n_s8(-1)));
+    }
+
+    //*******************************
+    static size_t lowest_index(mask_type mask)
+    {
+      return etl::count_trailing_zeros(mask) >> 2U;
+    }
+
+  private:
+
+    //*******************************
+    /// Narrows each byte of the comparison to a nibble.
+    //*******************************
+    static mask_type to_mask(uint8x16_t matches)
+    {
+      const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+
+      return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ULL;
+    }
+
+    int8x16_t ctrl;
+  };
+#endif
+
+  //***************************************************************************
+  /// The fastest group for the target.
+  //***************************************************************************
+#if ETL_USING_SSE2
+  typedef hash_table_group_sse2   hash_table_group_default;
+#elif ETL_USING_NEON && ETL_USING_64BIT_TYPES
+  typedef hash_table_group_neon   hash_table_group_default;
+#else
+  typedef hash_table_group_scalar hash_table_group_default;
+#endif
+}
+
+#endif
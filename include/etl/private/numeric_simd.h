@@ -0,0 +1,372 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_NUMERIC_SIMD_INCLUDED
+#define ETL_NUMERIC_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Vector kernels for the float and double reductions and the 32 bit integer
+// prefix sums in numeric.h.
+// The reductions use four vector accumulators, so consecutive additions do
+// not wait on each other. Each kernel only processes whole blocks. The caller
+// finishes the remaining values with the scalar code.
+// Uses AVX2, SSE2, NEON or MVE when available.
+// Define ETL_NUMERIC_USING_SIMD as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_NUMERIC_USING_SIMD)
+  #if ETL_USING_SSE2 || ETL_USING_AVX2 || ETL_USING_NEON || ETL_USING_MVE
+    #define ETL_NUMERIC_USING_SIMD 1
+  #else
+    #define ETL_NUMERIC_USING_SIMD 0
+  #endif
+#endif
+
+#if ETL_NUMERIC_USING_SIMD
+  #if ETL_USING_AVX2
+    #include <immintrin.h>
+  #elif ETL_USING_SSE2
+    #include <emmintrin.h>
+  #elif ETL_USING_MVE
+    #include <arm_mve.h>
+  #elif ETL_USING_NEON
+    #include <arm_neon.h>
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_numeric
+  {
+    //*************************************************************************
+    /// Vector operations for a floating point type.
+    //*************************************************************************
+    template <typename T>
+    struct simd_ops
+    {
+      static ETL_CONSTANT bool Enabled = false;
+    };
+
+#if ETL_NUMERIC_USING_SIMD
+  #if ETL_USING_AVX2
+    template <>
+    struct simd_ops<float>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 8U;
+
+      typedef __m256 vector_type;
+
+      static vector_type zero()                           { return _mm256_setzero_ps(); }
+      static vector_type load(const float* p)             { return _mm256_loadu_ps(p); }
+      static vector_type add(vector_type a, vector_type b) { return _mm256_add_ps(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return _mm256_mul_ps(a, b); }
+      static void        store(float* p, vector_type a)   { _mm256_storeu_ps(p, a); }
+    };
+
+    template <>
+    struct simd_ops<double>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 4U;
+
+      typedef __m256d vector_type;
+
+      static vector_type zero()                           { return _mm256_setzero_pd(); }
+      static vector_type load(const double* p)            { return _mm256_loadu_pd(p); }
+      static vector_type add(vector_type a, vector_type b) { return _mm256_add_pd(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return _mm256_mul_pd(a, b); }
+      static void        store(double* p, vector_type a)  { _mm256_storeu_pd(p, a); }
+    };
+  #elif ETL_USING_SSE2
+    template <>
+    struct simd_ops<float>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 4U;
+
+      typedef __m128 vector_type;
+
+      static vector_type zero()                           { return _mm_setzero_ps(); }
+      static vector_type load(const float* p)             { return _mm_loadu_ps(p); }
+      static vector_type add(vector_type a, vector_type b) { return _mm_add_ps(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return _mm_mul_ps(a, b); }
+      static void        store(float* p, vector_type a)   { _mm_storeu_ps(p, a); }
+    };
+
+    template <>
+    struct simd_ops<double>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 2U;
+
+      typedef __m128d vector_type;
+
+      static vector_type zero()                           { return _mm_setzero_pd(); }
+      static vector_type load(const double* p)            { return _mm_loadu_pd(p); }
+      static vector_type add(vector_type a, vector_type b) { return _mm_add_pd(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return _mm_mul_pd(a, b); }
+      static void        store(double* p, vector_type a)  { _mm_storeu_pd(p, a); }
+    };
+  #elif ETL_USING_MVE
+    #if ETL_USING_MVE_FLOAT
+    template <>
+    struct simd_ops<float>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 4U;
+
+      typedef float32x4_t vector_type;
+
+      static vector_type zero()                           { return vdupq_n_f32(0.0f); }
+      static vector_type load(const float* p)             { return vld1q_f32(p); }
+      static vector_type add(vector_type a, vector_type b) { return vaddq_f32(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return vmulq_f32(a, b); }
+      static void        store(float* p, vector_type a)   { vst1q_f32(p, a); }
+    };
+    #endif
+  #elif ETL_USING_NEON
+    template <>
+    struct simd_ops<float>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 4U;
+
+      typedef float32x4_t vector_type;
+
+      static vector_type zero()                           { return vdupq_n_f32(0.0f); }
+      static vector_type load(const float* p)             { return vld1q_f32(p); }
+      static vector_type add(vector_type a, vector_type b) { return vaddq_f32(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return vmulq_f32(a, b); }
+      static void        store(float* p, vector_type a)   { vst1q_f32(p, a); }
+    };
+
+    #if ETL_USING_NEON_FLOAT64
+    template <>
+    struct simd_ops<double>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 2U;
+
+      typedef float64x2_t vector_type;
+
+      static vector_type zero()                           { return vdupq_n_f64(0.0); }
+      static vector_type load(const double* p)            { return vld1q_f64(p); }
+      static vector_type add(vector_type a, vector_type b) { return vaddq_f64(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return vmulq_f64(a, b); }
+      static void        store(double* p, vector_type a)  { vst1q_f64(p, a); }
+    };
+    #endif
+  #endif
+#endif
+
+    //*************************************************************************
+    /// The number of values in each block of the reduction kernels.
+    //*************************************************************************
+    template <typename T>
+    struct simd_block
+    {
+      static ETL_CONSTANT size_t value = 4U * simd_ops<T>::Width;
+    };
+
+    //*************************************************************************
+    /// Adds the four accumulators, then their lanes, to sum.
+    //*************************************************************************
+    template <typename T>
+    void simd_reduce(T& sum,
+                     typename simd_ops<T>::vector_type a0, typename simd_ops<T>::vector_type a1,
+                     typename simd_ops<T>::vector_type a2, typename simd_ops<T>::vector_type a3)
+    {
+      typedef simd_ops<T> ops;
+
+      T lanes[ops::Width];
+      ops::store(lanes, ops::add(ops::add(a0, a1), ops::add(a2, a3)));
+
+      T total = T(0);
+
+      for (size_t i = 0U; i < ops::Width; ++i)
+      {
+        total += lanes[i];
+      }
+
+      sum += total;
+    }
+
+    //*************************************************************************
+    /// The kernels for types without vector support do nothing.
+    //*************************************************************************
+    template <typename T>
+    void simd_sum(const T*&, size_t&, T&, etl::bool_constant<false>)
+    {
+    }
+
+    template <typename T>
+    void simd_dot_product(const T*&, const T*&, size_t&, T&, etl::bool_constant<false>)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds the values of whole blocks to sum.
+    /// Advances p and reduces n by the values processed.
+    //*************************************************************************
+    template <typename T>
+    void simd_sum(const T*& p, size_t& n, T& sum, etl::bool_constant<true>)
+    {
+      typedef simd_ops<T> ops;
+      typedef typename ops::vector_type vector_type;
+
+      const size_t W = ops::Width;
+
+      vector_type s0 = ops::zero();
+      vector_type s1 = ops::zero();
+      vector_type s2 = ops::zero();
+      vector_type s3 = ops::zero();
+
+      for (; n >= simd_block<T>::value; n -= simd_block<T>::value, p += simd_block<T>::value)
+      {
+        s0 = ops::add(s0, ops::load(p));
+        s1 = ops::add(s1, ops::load(p + W));
+        s2 = ops::add(s2, ops::load(p + (2U * W)));
+        s3 = ops::add(s3, ops::load(p + (3U * W)));
+      }
+
+      simd_reduce<T>(sum, s0, s1, s2, s3);
+    }
+
+    //*************************************************************************
+    /// Adds the products of whole blocks to sum.
+    /// Advances the pointers and reduces n by the values processed.
+    //*************************************************************************
+    template <typename T>
+    void simd_dot_product(const T*& a, const T*& b, size_t& n, T& sum, etl::bool_constant<true>)
+    {
+      typedef simd_ops<T> ops;
+      typedef typename ops::vector_type vector_type;
+
+      const size_t W = ops::Width;
+
+      vector_type s0 = ops::zero();
+      vector_type s1 = ops::zero();
+      vector_type s2 = ops::zero();
+      vector_type s3 = ops::zero();
+
+      for (; n >= simd_block<T>::value; n -= simd_block<T>::value, a += simd_block<T>::value, b += simd_block<T>::value)
+      {
+        s0 = ops::add(s0, ops::mul(ops::load(a),            ops::load(b)));
+        s1 = ops::add(s1, ops::mul(ops::load(a + W),        ops::load(b + W)));
+        s2 = ops::add(s2, ops::mul(ops::load(a + (2U * W)), ops::load(b + (2U * W))));
+        s3 = ops::add(s3, ops::mul(ops::load(a + (3U * W)), ops::load(b + (3U * W))));
+      }
+
+      simd_reduce<T>(sum, s0, s1, s2, s3);
+    }
+
+    //*************************************************************************
+    /// Is there a prefix sum kernel for T?
+    //*************************************************************************
+    template <typename T>
+    struct simd_prefix_sum_enabled
+    {
+#if ETL_NUMERIC_USING_SIMD && (ETL_USING_SSE2 || ETL_USING_AVX2 || ETL_USING_NEON)
+      static ETL_CONSTANT bool value = (etl::is_same<T, int32_t>::value || etl::is_same<T, uint32_t>::value);
+#else
+      static ETL_CONSTANT bool value = false;
+#endif
+    };
+
+    //*************************************************************************
+    /// The prefix sum kernel for types without vector support does nothing.
+    //*************************************************************************
+    template <typename T>
+    void simd_prefix_sum(const T*&, T*&, size_t&, T&, etl::bool_constant<false>)
+    {
+    }
+
+#if ETL_NUMERIC_USING_SIMD && (ETL_USING_SSE2 || ETL_USING_AVX2 || ETL_USING_NEON)
+    //*************************************************************************
+    /// Running sums of blocks of four 32 bit values, starting from sum.
+    /// The lanes are summed with two shifted adds, then the running total of
+    /// the previous blocks is added. Wraps as the scalar code does.
+    /// Advances the pointers, reduces n by the values processed and sets sum
+    /// to the last running sum.
+    //*************************************************************************
+    template <typename T>
+    void simd_prefix_sum(const T*& in, T*& out, size_t& n, T& sum, etl::bool_constant<true>)
+    {
+  #if ETL_USING_SSE2 || ETL_USING_AVX2
+      __m128i carry = _mm_set1_epi32(int32_t(sum));
+
+      for (; n >= 4U; n -= 4U, in += 4U, out += 4U)
+      {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), x);
+
+        // Broadcast the last lane.
+        carry = _mm_shuffle_epi32(x, 0xFF);
+      }
+
+      sum = T(_mm_cvtsi128_si32(carry));
+  #else
+      const uint32x4_t zero = vdupq_n_u32(0U);
+
+      uint32x4_t carry = vdupq_n_u32(uint32_t(sum));
+
+      for (; n >= 4U; n -= 4U, in += 4U, out += 4U)
+      {
+        uint32x4_t x = vld1q_u32(reinterpret_cast<const uint32_t*>(in));
+
+        x = vaddq_u32(x, vextq_u32(zero, x, 3));
+        x = vaddq_u32(x, vextq_u32(zero, x, 2));
+        x = vaddq_u32(x, carry);
+
+        vst1q_u32(reinterpret_cast<uint32_t*>(out), x);
+
+        // Broadcast the last lane.
+        carry = vdupq_n_u32(vgetq_lane_u32(x, 3));
+      }
+
+      sum = T(vgetq_lane_u32(carry, 0));
+  #endif
+    }
+#endif
+  }
+}
+
+#endif
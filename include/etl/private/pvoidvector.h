@@ -40,6 +40,7 @@ SOFTWARE.
 #include "../error_handler.h"
 #include "../functional.h"
 #include "../iterator.h"
+#include "../memory.h"
 
 #include <stddef.h>
 
@@ -450,8 +451,8 @@ namespace etl
       {
         if (position_ != end())
         {
+          etl::mem_move(position_, p_end, position_ + 1);
           ++p_end;
-          etl::copy_backward(position_, end() - 1, end());
           *position_ = value;
         }
         else
@@ -481,8 +482,8 @@ namespace etl
 
       if (position_ != end())
       {
+        etl::mem_move(position_, p_end, position_ + 1);
         ++p_end;
-        etl::copy_backward(position_, end() - 1, end());
         *position_ = ETL_NULLPTR;
       }
       else
@@ -511,8 +512,8 @@ namespace etl
 
       if (position_ != end())
       {
+        etl::mem_move(position_, p_end, position_ + 1);
         ++p_end;
-        etl::copy_backward(position_, end() - 1, end());
         *position_ = value;
       }
       else
@@ -542,7 +543,7 @@ namespace etl
 
       iterator position_ = to_iterator(position);
 
-      etl::copy_backward(position_, p_end, p_end + n);
+      etl::mem_move(position_, p_end, position_ + n);
       etl::fill_n(position_, n, value);
 
       p_end += n;
@@ -568,7 +569,7 @@ namespace etl
 
       ETL_ASSERT_OR_RETURN((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
-      etl::copy_backward(position_, p_end, p_end + count);
+      etl::mem_move(position_, p_end, position_ + count);
       etl::copy(first, last, position_);
       p_end += count;
     }
@@ -580,7 +581,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      etl::copy(i_element + 1, end(), i_element);
+      etl::mem_move(i_element + 1, p_end, i_element);
       --p_end;
 
       return i_element;
@@ -595,7 +596,7 @@ namespace etl
     {
       iterator i_element_ = to_iterator(i_element);
 
-      etl::copy(i_element_ + 1, end(), i_element_);
+      etl::mem_move(i_element_ + 1, p_end, i_element_);
       --p_end;
 
       return i_element_;
@@ -614,7 +615,7 @@ namespace etl
       iterator first_ = to_iterator(first);
       iterator last_  = to_iterator(last);
 
-      etl::copy(last_, end(), first_);
+      etl::mem_move(last_, p_end, first_);
       size_t n_delete = static_cast<size_t>(etl::distance(first, last));
 
       // Just adjust the count.
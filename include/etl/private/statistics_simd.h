@@ -0,0 +1,400 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATISTICS_SIMD_INCLUDED
+#define ETL_STATISTICS_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+// Vector kernels for the float and double sums of the statistics functors.
+// Each sum has two vector accumulators, so consecutive additions do not wait
+// on each other. Each kernel only processes whole blocks of two vectors. The
+// caller finishes the remaining values with the scalar code.
+// Uses SSE2 or NEON when available.
+// Define ETL_STATISTICS_USING_SIMD as 0 to disable them.
+//*****************************************************************************
+#if !defined(ETL_STATISTICS_USING_SIMD)
+  #if ETL_USING_SSE2 || ETL_USING_NEON
+    #define ETL_STATISTICS_USING_SIMD 1
+  #else
+    #define ETL_STATISTICS_USING_SIMD 0
+  #endif
+#endif
+
+#if ETL_STATISTICS_USING_SIMD
+  #if ETL_USING_SSE2
+    #include <emmintrin.h>
+  #elif ETL_USING_NEON
+    #include <arm_neon.h>
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_statistics
+  {
+    //*************************************************************************
+    /// Vector operations for a floating point type.
+    //*************************************************************************
+    template <typename T>
+    struct simd_ops
+    {
+      static ETL_CONSTANT bool Enabled = false;
+    };
+
+#if ETL_STATISTICS_USING_SIMD
+  #if ETL_USING_SSE2
+    template <>
+    struct simd_ops<float>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 4U;
+
+      typedef __m128 vector_type;
+
+      static vector_type zero()                           { return _mm_setzero_ps(); }
+      static vector_type set(float value)                 { return _mm_set1_ps(value); }
+      static vector_type load(const float* p)             { return _mm_loadu_ps(p); }
+      static vector_type add(vector_type a, vector_type b) { return _mm_add_ps(a, b); }
+      static vector_type sub(vector_type a, vector_type b) { return _mm_sub_ps(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return _mm_mul_ps(a, b); }
+      static void        store(float* p, vector_type a)   { _mm_storeu_ps(p, a); }
+    };
+
+    template <>
+    struct simd_ops<double>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 2U;
+
+      typedef __m128d vector_type;
+
+      static vector_type zero()                           { return _mm_setzero_pd(); }
+      static vector_type set(double value)                { return _mm_set1_pd(value); }
+      static vector_type load(const double* p)            { return _mm_loadu_pd(p); }
+      static vector_type add(vector_type a, vector_type b) { return _mm_add_pd(a, b); }
+      static vector_type sub(vector_type a, vector_type b) { return _mm_sub_pd(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return _mm_mul_pd(a, b); }
+      static void        store(double* p, vector_type a)  { _mm_storeu_pd(p, a); }
+    };
+  #elif ETL_USING_NEON
+    template <>
+    struct simd_ops<float>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 4U;
+
+      typedef float32x4_t vector_type;
+
+      static vector_type zero()                           { return vdupq_n_f32(0.0f); }
+      static vector_type set(float value)                 { return vdupq_n_f32(value); }
+      static vector_type load(const float* p)             { return vld1q_f32(p); }
+      static vector_type add(vector_type a, vector_type b) { return vaddq_f32(a, b); }
+      static vector_type sub(vector_type a, vector_type b) { return vsubq_f32(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return vmulq_f32(a, b); }
+      static void        store(float* p, vector_type a)   { vst1q_f32(p, a); }
+    };
+
+    #if ETL_USING_NEON_FLOAT64
+    template <>
+    struct simd_ops<double>
+    {
+      static ETL_CONSTANT bool   Enabled = true;
+      static ETL_CONSTANT size_t Width   = 2U;
+
+      typedef float64x2_t vector_type;
+
+      static vector_type zero()                           { return vdupq_n_f64(0.0); }
+      static vector_type set(double value)                { return vdupq_n_f64(value); }
+      static vector_type load(const double* p)            { return vld1q_f64(p); }
+      static vector_type add(vector_type a, vector_type b) { return vaddq_f64(a, b); }
+      static vector_type sub(vector_type a, vector_type b) { return vsubq_f64(a, b); }
+      static vector_type mul(vector_type a, vector_type b) { return vmulq_f64(a, b); }
+      static void        store(double* p, vector_type a)  { vst1q_f64(p, a); }
+    };
+    #endif
+  #endif
+#endif
+
+    //*************************************************************************
+    /// True if the sums of TInput in TCalc have vector kernels.
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    struct simd_enabled
+    {
+      typedef etl::integral_constant<bool, etl::is_same<TCalc, TInput>::value && simd_ops<TCalc>::Enabled> type;
+    };
+
+    //*************************************************************************
+    /// The number of values in each block of the vector kernels.
+    //*************************************************************************
+    template <typename T>
+    struct simd_block
+    {
+      static ETL_CONSTANT size_t value = 2U * simd_ops<T>::Width;
+    };
+
+    //*************************************************************************
+    /// Adds the two accumulators, then their lanes, to sum.
+    //*************************************************************************
+    template <typename T>
+    void simd_reduce(T& sum, typename simd_ops<T>::vector_type a, typename simd_ops<T>::vector_type b)
+    {
+      typedef simd_ops<T> ops;
+
+      T lanes[ops::Width];
+      ops::store(lanes, ops::add(a, b));
+
+      T total = T(0);
+
+      for (size_t i = 0U; i < ops::Width; ++i)
+      {
+        total += lanes[i];
+      }
+
+      sum += total;
+    }
+
+    //*************************************************************************
+    /// The kernels for types without vector support do nothing.
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    void simd_accumulate_sum(const TInput*&, size_t&, TCalc, TCalc&, etl::false_type)
+    {
+    }
+
+    template <typename TCalc, typename TInput>
+    void simd_accumulate_squares(const TInput*&, size_t&, TCalc&, etl::false_type)
+    {
+    }
+
+    template <typename TCalc, typename TInput>
+    void simd_accumulate_sum_and_squares(const TInput*&, size_t&, TCalc, TCalc&, TCalc&, etl::false_type)
+    {
+    }
+
+    template <typename TCalc, typename TInput>
+    void simd_accumulate_products(const TInput*&, const TInput*&, size_t&, TCalc, TCalc, TCalc&, TCalc&, TCalc&, etl::false_type)
+    {
+    }
+
+    template <typename TCalc, typename TInput>
+    void simd_accumulate_products_and_squares(const TInput*&, const TInput*&, size_t&, TCalc, TCalc, TCalc&, TCalc&, TCalc&, TCalc&, TCalc&, etl::false_type)
+    {
+    }
+
+    //*************************************************************************
+    /// Accumulates sum(x - shift) over whole blocks.
+    /// Advances p and reduces n by the values accumulated.
+    //*************************************************************************
+    template <typename T>
+    void simd_accumulate_sum(const T*& p, size_t& n, T shift, T& sum, etl::true_type)
+    {
+      typedef simd_ops<T> ops;
+      typedef typename ops::vector_type vector_type;
+
+      const vector_type vshift = ops::set(shift);
+
+      vector_type s0 = ops::zero();
+      vector_type s1 = ops::zero();
+
+      for (; n >= simd_block<T>::value; n -= simd_block<T>::value, p += simd_block<T>::value)
+      {
+        s0 = ops::add(s0, ops::sub(ops::load(p), vshift));
+        s1 = ops::add(s1, ops::sub(ops::load(p + ops::Width), vshift));
+      }
+
+      simd_reduce<T>(sum, s0, s1);
+    }
+
+    //*************************************************************************
+    /// Accumulates sum(x^2) over whole blocks.
+    /// Advances p and reduces n by the values accumulated.
+    //*************************************************************************
+    template <typename T>
+    void simd_accumulate_squares(const T*& p, size_t& n, T& sum_of_squares, etl::true_type)
+    {
+      typedef simd_ops<T> ops;
+      typedef typename ops::vector_type vector_type;
+
+      vector_type q0 = ops::zero();
+      vector_type q1 = ops::zero();
+
+      for (; n >= simd_block<T>::value; n -= simd_block<T>::value, p += simd_block<T>::value)
+      {
+        const vector_type x0 = ops::load(p);
+        const vector_type x1 = ops::load(p + ops::Width);
+
+        q0 = ops::add(q0, ops::mul(x0, x0));
+        q1 = ops::add(q1, ops::mul(x1, x1));
+      }
+
+      simd_reduce<T>(sum_of_squares, q0, q1);
+    }
+
+    //*************************************************************************
+    /// Accumulates sum(x - shift) and sum((x - shift)^2) over whole blocks.
+    /// Advances p and reduces n by the values accumulated.
+    //*************************************************************************
+    template <typename T>
+    void simd_accumulate_sum_and_squares(const T*& p, size_t& n, T shift, T& sum, T& sum_of_squares, etl::true_type)
+    {
+      typedef simd_ops<T> ops;
+      typedef typename ops::vector_type vector_type;
+
+      const vector_type vshift = ops::set(shift);
+
+      vector_type s0 = ops::zero();
+      vector_type s1 = ops::zero();
+      vector_type q0 = ops::zero();
+      vector_type q1 = ops::zero();
+
+      for (; n >= simd_block<T>::value; n -= simd_block<T>::value, p += simd_block<T>::value)
+      {
+        const vector_type d0 = ops::sub(ops::load(p), vshift);
+        const vector_type d1 = ops::sub(ops::load(p + ops::Width), vshift);
+
+        s0 = ops::add(s0, d0);
+        s1 = ops::add(s1, d1);
+        q0 = ops::add(q0, ops::mul(d0, d0));
+        q1 = ops::add(q1, ops::mul(d1, d1));
+      }
+
+      simd_reduce<T>(sum, s0, s1);
+      simd_reduce<T>(sum_of_squares, q0, q1);
+    }
+
+    //*************************************************************************
+    /// Accumulates sum(x - shift1), sum(y - shift2) and sum((x - shift1)(y - shift2))
+    /// over whole blocks.
+    /// Advances p1 and p2 and reduces n by the values accumulated.
+    //*************************************************************************
+    template <typename T>
+    void simd_accumulate_products(const T*& p1, const T*& p2, size_t& n,
+                                  T shift1, T shift2,
+                                  T& sum1, T& sum2, T& inner_product,
+                                  etl::true_type)
+    {
+      typedef simd_ops<T> ops;
+      typedef typename ops::vector_type vector_type;
+
+      const vector_type vshift1 = ops::set(shift1);
+      const vector_type vshift2 = ops::set(shift2);
+
+      vector_type s10 = ops::zero();
+      vector_type s11 = ops::zero();
+      vector_type s20 = ops::zero();
+      vector_type s21 = ops::zero();
+      vector_type ip0 = ops::zero();
+      vector_type ip1 = ops::zero();
+
+      for (; n >= simd_block<T>::value; n -= simd_block<T>::value, p1 += simd_block<T>::value, p2 += simd_block<T>::value)
+      {
+        const vector_type d10 = ops::sub(ops::load(p1), vshift1);
+        const vector_type d11 = ops::sub(ops::load(p1 + ops::Width), vshift1);
+        const vector_type d20 = ops::sub(ops::load(p2), vshift2);
+        const vector_type d21 = ops::sub(ops::load(p2 + ops::Width), vshift2);
+
+        s10 = ops::add(s10, d10);
+        s11 = ops::add(s11, d11);
+        s20 = ops::add(s20, d20);
+        s21 = ops::add(s21, d21);
+        ip0 = ops::add(ip0, ops::mul(d10, d20));
+        ip1 = ops::add(ip1, ops::mul(d11, d21));
+      }
+
+      simd_reduce<T>(sum1, s10, s11);
+      simd_reduce<T>(sum2, s20, s21);
+      simd_reduce<T>(inner_product, ip0, ip1);
+    }
+
+    //*************************************************************************
+    /// Accumulates the sums of simd_accumulate_products, plus sum((x - shift1)^2)
+    /// and sum((y - shift2)^2), over whole blocks.
+    /// Advances p1 and p2 and reduces n by the values accumulated.
+    //*************************************************************************
+    template <typename T>
+    void simd_accumulate_products_and_squares(const T*& p1, const T*& p2, size_t& n,
+                                              T shift1, T shift2,
+                                              T& sum1, T& sum2,
+                                              T& sum_of_squares1, T& sum_of_squares2,
+                                              T& inner_product,
+                                              etl::true_type)
+    {
+      typedef simd_ops<T> ops;
+      typedef typename ops::vector_type vector_type;
+
+      const vector_type vshift1 = ops::set(shift1);
+      const vector_type vshift2 = ops::set(shift2);
+
+      vector_type s10 = ops::zero();
+      vector_type s11 = ops::zero();
+      vector_type s20 = ops::zero();
+      vector_type s21 = ops::zero();
+      vector_type q10 = ops::zero();
+      vector_type q11 = ops::zero();
+      vector_type q20 = ops::zero();
+      vector_type q21 = ops::zero();
+      vector_type ip0 = ops::zero();
+      vector_type ip1 = ops::zero();
+
+      for (; n >= simd_block<T>::value; n -= simd_block<T>::value, p1 += simd_block<T>::value, p2 += simd_block<T>::value)
+      {
+        const vector_type d10 = ops::sub(ops::load(p1), vshift1);
+        const vector_type d11 = ops::sub(ops::load(p1 + ops::Width), vshift1);
+        const vector_type d20 = ops::sub(ops::load(p2), vshift2);
+        const vector_type d21 = ops::sub(ops::load(p2 + ops::Width), vshift2);
+
+        s10 = ops::add(s10, d10);
+        s11 = ops::add(s11, d11);
+        s20 = ops::add(s20, d20);
+        s21 = ops::add(s21, d21);
+        q10 = ops::add(q10, ops::mul(d10, d10));
+        q11 = ops::add(q11, ops::mul(d11, d11));
+        q20 = ops::add(q20, ops::mul(d20, d20));
+        q21 = ops::add(q21, ops::mul(d21, d21));
+        ip0 = ops::add(ip0, ops::mul(d10, d20));
+        ip1 = ops::add(ip1, ops::mul(d11, d21));
+      }
+
+      simd_reduce<T>(sum1, s10, s11);
+      simd_reduce<T>(sum2, s20, s21);
+      simd_reduce<T>(sum_of_squares1, q10, q11);
+      simd_reduce<T>(sum_of_squares2, q20, q21);
+      simd_reduce<T>(inner_product, ip0, ip1);
+    }
+  }
+}
+
+#endif
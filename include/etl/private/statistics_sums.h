@@ -0,0 +1,253 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATISTICS_SUMS_INCLUDED
+#define ETL_STATISTICS_SUMS_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "statistics_simd.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+// Bulk accumulation of the sums used by the statistics functors.
+// float and double sums use the vector kernels of statistics_simd.h, if
+// available, for the whole blocks. Otherwise each kernel keeps eight
+// independent partial sums, so the additions do not wait on each other.
+// The partial sums are combined at the end, which also reduces the rounding
+// error of floating point sums.
+// Each value has the shift subtracted before it is accumulated. For floating
+// point sums the shift is the first value, so the sums are of small
+// deviations and the variance does not suffer from cancellation.
+//*****************************************************************************
+namespace etl
+{
+  namespace private_statistics
+  {
+    static ETL_CONSTANT size_t Lanes = 8U;
+
+    //*************************************************************************
+    /// The shift to use for the sums, given the first value.
+    /// Zero for integral sums, where there is no rounding error to reduce.
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc get_shift(TInput first)
+    {
+      return etl::is_floating_point<TCalc>::value ? TCalc(first) : TCalc(0);
+    }
+
+    //*************************************************************************
+    /// Adds the partial sums pairwise.
+    //*************************************************************************
+    template <typename TCalc>
+    TCalc reduce(const TCalc* lanes)
+    {
+      return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+
+    //*************************************************************************
+    /// Accumulates sum(x - shift).
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    void accumulate_sum(const TInput* p, size_t n, TCalc shift, TCalc& sum)
+    {
+      simd_accumulate_sum(p, n, shift, sum, typename simd_enabled<TCalc, TInput>::type());
+
+      TCalc s[Lanes] = {};
+
+      for (; n >= Lanes; n -= Lanes, p += Lanes)
+      {
+        for (size_t i = 0U; i < Lanes; ++i)
+        {
+          s[i] += TCalc(p[i]) - shift;
+        }
+      }
+
+      for (size_t j = 0U; j < n; ++j)
+      {
+        s[0] += TCalc(p[j]) - shift;
+      }
+
+      sum += reduce(s);
+    }
+
+    //*************************************************************************
+    /// Accumulates sum(x^2).
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    void accumulate_squares(const TInput* p, size_t n, TCalc& sum_of_squares)
+    {
+      simd_accumulate_squares(p, n, sum_of_squares, typename simd_enabled<TCalc, TInput>::type());
+
+      TCalc q[Lanes] = {};
+
+      for (; n >= Lanes; n -= Lanes, p += Lanes)
+      {
+        for (size_t i = 0U; i < Lanes; ++i)
+        {
+          q[i] += TCalc(p[i]) * TCalc(p[i]);
+        }
+      }
+
+      for (size_t j = 0U; j < n; ++j)
+      {
+        q[0] += TCalc(p[j]) * TCalc(p[j]);
+      }
+
+      sum_of_squares += reduce(q);
+    }
+
+    //*************************************************************************
+    /// Accumulates sum(x - shift) and sum((x - shift)^2).
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    void accumulate_sum_and_squares(const TInput* p, size_t n, TCalc shift, TCalc& sum, TCalc& sum_of_squares)
+    {
+      simd_accumulate_sum_and_squares(p, n, shift, sum, sum_of_squares, typename simd_enabled<TCalc, TInput>::type());
+
+      TCalc s[Lanes] = {};
+      TCalc q[Lanes] = {};
+
+      for (; n >= Lanes; n -= Lanes, p += Lanes)
+      {
+        for (size_t i = 0U; i < Lanes; ++i)
+        {
+          const TCalc d = TCalc(p[i]) - shift;
+          s[i] += d;
+          q[i] += d * d;
+        }
+      }
+
+      for (size_t j = 0U; j < n; ++j)
+      {
+        const TCalc d = TCalc(p[j]) - shift;
+        s[0] += d;
+        q[0] += d * d;
+      }
+
+      sum            += reduce(s);
+      sum_of_squares += reduce(q);
+    }
+
+    //*************************************************************************
+    /// Accumulates sum(x - shift1), sum(y - shift2) and sum((x - shift1)(y - shift2)).
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    void accumulate_products(const TInput* p1, const TInput* p2, size_t n,
+                             TCalc shift1, TCalc shift2,
+                             TCalc& sum1, TCalc& sum2, TCalc& inner_product)
+    {
+      simd_accumulate_products(p1, p2, n, shift1, shift2, sum1, sum2, inner_product, typename simd_enabled<TCalc, TInput>::type());
+
+      TCalc s1[Lanes] = {};
+      TCalc s2[Lanes] = {};
+      TCalc ip[Lanes] = {};
+
+      for (; n >= Lanes; n -= Lanes, p1 += Lanes, p2 += Lanes)
+      {
+        for (size_t i = 0U; i < Lanes; ++i)
+        {
+          const TCalc d1 = TCalc(p1[i]) - shift1;
+          const TCalc d2 = TCalc(p2[i]) - shift2;
+          s1[i] += d1;
+          s2[i] += d2;
+          ip[i] += d1 * d2;
+        }
+      }
+
+      for (size_t j = 0U; j < n; ++j)
+      {
+        const TCalc d1 = TCalc(p1[j]) - shift1;
+        const TCalc d2 = TCalc(p2[j]) - shift2;
+        s1[0] += d1;
+        s2[0] += d2;
+        ip[j] += d1 * d2;
+      }
+
+      sum1          += reduce(s1);
+      sum2          += reduce(s2);
+      inner_product += reduce(ip);
+    }
+
+    //*************************************************************************
+    /// Accumulates the sums of accumulate_products, plus sum((x - shift1)^2)
+    /// and sum((y - shift2)^2).
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    void accumulate_products_and_squares(const TInput* p1, const TInput* p2, size_t n,
+                                         TCalc shift1, TCalc shift2,
+                                         TCalc& sum1, TCalc& sum2,
+                                         TCalc& sum_of_squares1, TCalc& sum_of_squares2,
+                                         TCalc& inner_product)
+    {
+      simd_accumulate_products_and_squares(p1, p2, n, shift1, shift2, sum1, sum2, sum_of_squares1, sum_of_squares2, inner_product, typename simd_enabled<TCalc, TInput>::type());
+
+      TCalc s1[Lanes] = {};
+      TCalc s2[Lanes] = {};
+      TCalc q1[Lanes] = {};
+      TCalc q2[Lanes] = {};
+      TCalc ip[Lanes] = {};
+
+      for (; n >= Lanes; n -= Lanes, p1 += Lanes, p2 += Lanes)
+      {
+        for (size_t i = 0U; i < Lanes; ++i)
+        {
+          const TCalc d1 = TCalc(p1[i]) - shift1;
+          const TCalc d2 = TCalc(p2[i]) - shift2;
+          s1[i] += d1;
+          s2[i] += d2;
+          q1[i] += d1 * d1;
+          q2[i] += d2 * d2;
+          ip[i] += d1 * d2;
+        }
+      }
+
+      for (size_t j = 0U; j < n; ++j)
+      {
+        const TCalc d1 = TCalc(p1[j]) - shift1;
+        const TCalc d2 = TCalc(p2[j]) - shift2;
+        s1[0] += d1;
+        s2[0] += d2;
+        q1[0] += d1 * d1;
+        q2[0] += d2 * d2;
+        ip[j] += d1 * d2;
+      }
+
+      sum1            += reduce(s1);
+      sum2            += reduce(s2);
+      sum_of_squares1 += reduce(q1);
+      sum_of_squares2 += reduce(q2);
+      inner_product   += reduce(ip);
+    }
+  }
+}
+
+#endif
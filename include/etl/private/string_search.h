@@ -0,0 +1,354 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../type_traits.h"
+#include "../integral_limits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Search kernels shared by etl::ibasic_string and etl::basic_string_view.
+// Single characters are found with etl::find, which searches contiguous
+// characters a block at a time using SSE2, NEON, MVE or SWAR.
+// Character sets are tested with a 256 bit table, so each character of the
+// text costs one lookup regardless of the size of the set.
+// Long needles in byte strings use Boyer-Moore-Horspool. Shorter needles
+// scan for the first character, then compare the rest.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    static ETL_CONSTANT size_t npos = etl::integral_limits<size_t>::max;
+
+    /// The shortest byte needle for which Boyer-Moore-Horspool is used.
+    static ETL_CONSTANT size_t Horspool_Threshold = 16U;
+
+    //*************************************************************************
+    /// The unsigned value of a character, for indexing tables.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint_least32_t char_index(T c)
+    {
+      typedef typename etl::conditional<sizeof(T) == 1U, uint8_t,
+                typename etl::conditional<sizeof(T) == 2U, uint16_t, uint32_t>::type>::type unsigned_t;
+
+      return static_cast<uint_least32_t>(static_cast<unsigned_t>(c));
+    }
+
+    //*************************************************************************
+    /// A set of characters.
+    /// Characters below 256 are held in a bit table. Any others are found
+    /// by searching the original set.
+    //*************************************************************************
+    template <typename T>
+    class char_set
+    {
+    public:
+
+      ETL_CONSTEXPR14 char_set(const T* set_, size_t length_)
+        : bits()
+        , set(set_)
+        , length(length_)
+        , has_wide(false)
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          const uint_least32_t index = char_index(set[i]);
+
+          if (index < 256U)
+          {
+            bits[index >> 5U] |= uint32_t(1U) << (index & 31U);
+          }
+          else
+          {
+            has_wide = true;
+          }
+        }
+      }
+
+      ETL_CONSTEXPR14 bool contains(T c) const
+      {
+        const uint_least32_t index = char_index(c);
+
+        if (index < 256U)
+        {
+          return ((bits[index >> 5U] >> (index & 31U)) & 1U) != 0U;
+        }
+
+        return has_wide && (etl::find(set, set + length, c) != (set + length));
+      }
+
+    private:
+
+      uint32_t bits[8];
+      const T* set;
+      size_t   length;
+      bool     has_wide;
+    };
+
+    //*************************************************************************
+    /// Finds the first c at or after position.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_char(const T* text, size_t length, size_t position, T c)
+    {
+      if (position >= length)
+      {
+        return npos;
+      }
+
+      const T* p = etl::find(text + position, text + length, c);
+
+      return (p == (text + length)) ? npos : static_cast<size_t>(p - text);
+    }
+
+    //*************************************************************************
+    /// Boyer-Moore-Horspool for byte needles.
+    /// Shifts are capped at 255, which only shortens the shift for needles
+    /// longer than that.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_horspool(const T* text, size_t length, size_t position, const T* needle, size_t needle_length)
+    {
+      const size_t  last_start = length - needle_length;
+      const size_t  last       = needle_length - 1U;
+      const uint8_t max_shift  = static_cast<uint8_t>(etl::min(needle_length, size_t(255U)));
+
+      uint8_t shift[256] = {};
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        shift[i] = max_shift;
+      }
+
+      for (size_t i = 0U; i < last; ++i)
+      {
+        shift[char_index(needle[i])] = static_cast<uint8_t>(etl::min(last - i, size_t(255U)));
+      }
+
+      const T last_char = needle[last];
+
+      size_t i = position;
+
+      while (i <= last_start)
+      {
+        const T c = text[i + last];
+
+        if ((c == last_char) && etl::equal(needle, needle + last, text + i))
+        {
+          return i;
+        }
+
+        i += shift[char_index(c)];
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of needle at or after position.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_substring(const T* text, size_t length, size_t position, const T* needle, size_t needle_length)
+    {
+      if ((position > length) || (needle_length > (length - position)))
+      {
+        return npos;
+      }
+
+      if (needle_length == 0U)
+      {
+        return position;
+      }
+
+      if ((sizeof(T) == 1U) && (needle_length >= Horspool_Threshold))
+      {
+        return find_horspool(text, length, position, needle, needle_length);
+      }
+
+      // Find each candidate for the first character, then compare the rest.
+      const T* const p_last_start = text + (length - needle_length) + 1U;
+      const T        first_char   = needle[0];
+
+      const T* p = text + position;
+
+      while (p != p_last_start)
+      {
+        p = etl::find(p, p_last_start, first_char);
+
+        if (p == p_last_start)
+        {
+          break;
+        }
+
+        if (etl::equal(needle + 1U, needle + needle_length, p + 1U))
+        {
+          return static_cast<size_t>(p - text);
+        }
+
+        ++p;
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the first character at or after position that is in the set.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_first_of(const T* text, size_t length, size_t position, const T* set, size_t set_length)
+    {
+      if ((position >= length) || (set_length == 0U))
+      {
+        return npos;
+      }
+
+      if (set_length == 1U)
+      {
+        return find_char(text, length, position, set[0]);
+      }
+
+      const char_set<T> chars(set, set_length);
+
+      for (size_t i = position; i < length; ++i)
+      {
+        if (chars.contains(text[i]))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the first character at or after position that is not in the set.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_first_not_of(const T* text, size_t length, size_t position, const T* set, size_t set_length)
+    {
+      if (position >= length)
+      {
+        return npos;
+      }
+
+      if (set_length <= 1U)
+      {
+        for (size_t i = position; i < length; ++i)
+        {
+          if ((set_length == 0U) || (text[i] != set[0]))
+          {
+            return i;
+          }
+        }
+
+        return npos;
+      }
+
+      const char_set<T> chars(set, set_length);
+
+      for (size_t i = position; i < length; ++i)
+      {
+        if (!chars.contains(text[i]))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last character at or before position that is in the set.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_last_of(const T* text, size_t length, size_t position, const T* set, size_t set_length)
+    {
+      if ((length == 0U) || (set_length == 0U))
+      {
+        return npos;
+      }
+
+      const char_set<T> chars(set, set_length);
+
+      size_t i = etl::min(position, length - 1U) + 1U;
+
+      while (i != 0U)
+      {
+        --i;
+
+        if (chars.contains(text[i]))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last character at or before position that is not in the set.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_last_not_of(const T* text, size_t length, size_t position, const T* set, size_t set_length)
+    {
+      if (length == 0U)
+      {
+        return npos;
+      }
+
+      const char_set<T> chars(set, set_length);
+
+      size_t i = etl::min(position, length - 1U) + 1U;
+
+      while (i != 0U)
+      {
+        --i;
+
+        if (!chars.contains(text[i]))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+  }
+}
+
+#endif
@@ -45,6 +45,10 @@ SOFTWARE.
 #include "../math.h"
 #include "../limits.h"
 
+#if ETL_HAS_SHORTEST_FLOAT_FORMAT
+  #include "to_string_shortest.h"
+#endif
+
 #include <math.h>
 
 #if ETL_USING_STL && ETL_USING_CPP11
@@ -63,6 +67,76 @@ namespace etl
     typedef uint64_t uworkspace_t;
 #endif
 
+    //***************************************************************************
+    /// The two digit decimal strings "00" to "99".
+    //***************************************************************************
+    template <typename T = void>
+    struct decimal_digit_pairs
+    {
+      static const char table[201];
+    };
+
+    template <typename T>
+    const char decimal_digit_pairs<T>::table[201] =
+      "00010203040506070809"
+      "10111213141516171819"
+      "20212223242526272829"
+      "30313233343536373839"
+      "40414243444546474849"
+      "50515253545556575859"
+      "60616263646566676869"
+      "70717273747576777879"
+      "80818283848586878889"
+      "90919293949596979899";
+
+    //***************************************************************************
+    /// Appends a non-zero unsigned value in decimal.
+    /// Converts two digits per division into a local buffer, then appends
+    /// the result to the string in one operation.
+    //***************************************************************************
+    template <typename TUnsigned, typename TIString>
+    void add_unsigned_decimal(TUnsigned value, TIString& str, const bool negative)
+    {
+      typedef typename TIString::value_type type;
+
+      // The maximum number of digits, plus the sign.
+      static ETL_CONSTANT size_t Buffer_Size = size_t(etl::numeric_limits<TUnsigned>::digits10) + 2U;
+
+      const char* digit_pairs = decimal_digit_pairs<>::table;
+
+      type  buffer[Buffer_Size];
+      type* p_end = buffer + Buffer_Size;
+      type* p     = p_end;
+
+      while (value >= 100U)
+      {
+        const size_t index = size_t(value % 100U) * 2U;
+        value /= 100U;
+
+        *--p = type(digit_pairs[index + 1U]);
+        *--p = type(digit_pairs[index]);
+      }
+
+      if (value >= 10U)
+      {
+        const size_t index = size_t(value) * 2U;
+
+        *--p = type(digit_pairs[index + 1U]);
+        *--p = type(digit_pairs[index]);
+      }
+      else
+      {
+        *--p = type('0' + value);
+      }
+
+      if (negative)
+      {
+        *--p = type('-');
+      }
+
+      str.append(p, static_cast<typename TIString::size_type>(p_end - p));
+    }
+
     //***************************************************************************
     /// Helper function for left/right alignment.
     //***************************************************************************
@@ -166,6 +240,14 @@ namespace etl
 
         str.push_back(type('0'));
       }
+      else if (format.get_base() == 10U)
+      {
+        typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+        const unsigned_t magnitude = etl::is_negative(value) ? unsigned_t(unsigned_t(0U) - unsigned_t(value)) : unsigned_t(value);
+
+        etl::private_to_string::add_unsigned_decimal(magnitude, str, negative);
+      }
       else
       {
         // Extract the digits, in reverse order.
@@ -176,12 +258,6 @@ namespace etl
           value = value / T(format.get_base());
         }
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10U) && negative)
-        {
-          str.push_back(type('-'));
-        }
-
         if (format.is_show_base())
         {
           switch (format.get_base())
@@ -312,6 +388,30 @@ namespace etl
       {
         etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
       }
+#if ETL_HAS_SHORTEST_FLOAT_FORMAT
+      else if (format.is_shortest())
+      {
+        if (value == T(0))
+        {
+          str.push_back(type('0'));
+        }
+        else
+        {
+          char digits[24];
+          int  length;
+          int  decimal_exponent;
+
+          etl::private_to_string::shortest_decimal(etl::absolute(value), digits, length, decimal_exponent);
+
+          if (etl::is_negative(value))
+          {
+            str.push_back(type('-'));
+          }
+
+          etl::private_to_string::add_shortest_digits(digits, length, decimal_exponent, str, format.is_upper_case());
+        }
+      }
+#endif
       else
       {
         // Make sure we format the two halves correctly.
@@ -0,0 +1,540 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TO_STRING_SHORTEST_INCLUDED
+#define ETL_TO_STRING_SHORTEST_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../limits.h"
+#include "../type_traits.h"
+#include "../static_assert.h"
+
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Shortest round trip formatting for float and double, using Grisu2.
+// Produces the shortest, or very nearly the shortest, string of decimal
+// digits that reads back as the same value. Uses 64 bit integer arithmetic
+// only, plus a table of 79 cached powers of ten.
+// Based on "Printing Floating-Point Numbers Quickly and Accurately with
+// Integers", Florian Loitsch, 2010.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_to_string
+  {
+    //***************************************************************************
+    /// A 64 bit significand and binary exponent.
+    //***************************************************************************
+    struct diy_fp
+    {
+      diy_fp(uint64_t f_, int e_)
+        : f(f_)
+        , e(e_)
+      {
+      }
+
+      uint64_t f;
+      int      e;
+    };
+
+    //***************************************************************************
+    /// x - y, where the exponents are equal and x >= y.
+    //***************************************************************************
+    inline diy_fp diy_fp_subtract(const diy_fp& x, const diy_fp& y)
+    {
+      return diy_fp(x.f - y.f, x.e);
+    }
+
+    //***************************************************************************
+    /// x * y, rounded to the upper 64 bits.
+    //***************************************************************************
+    inline diy_fp diy_fp_multiply(const diy_fp& x, const diy_fp& y)
+    {
+      const uint64_t x_lo = x.f & 0xFFFFFFFFU;
+      const uint64_t x_hi = x.f >> 32U;
+      const uint64_t y_lo = y.f & 0xFFFFFFFFU;
+      const uint64_t y_hi = y.f >> 32U;
+
+      const uint64_t p0 = x_lo * y_lo;
+      const uint64_t p1 = x_lo * y_hi;
+      const uint64_t p2 = x_hi * y_lo;
+      const uint64_t p3 = x_hi * y_hi;
+
+      uint64_t middle = (p0 >> 32U) + (p1 & 0xFFFFFFFFU) + (p2 & 0xFFFFFFFFU);
+      middle += uint64_t(1U) << 31U; // Round.
+
+      return diy_fp(p3 + (p1 >> 32U) + (p2 >> 32U) + (middle >> 32U), x.e + y.e + 64);
+    }
+
+    //***************************************************************************
+    /// Shifts the significand until its top bit is set.
+    //***************************************************************************
+    inline diy_fp diy_fp_normalise(diy_fp x)
+    {
+      while ((x.f >> 63U) == 0U)
+      {
+        x.f <<= 1U;
+        --x.e;
+      }
+
+      return x;
+    }
+
+    //***************************************************************************
+    /// Shifts the significand to give the specified exponent.
+    //***************************************************************************
+    inline diy_fp diy_fp_normalise_to(const diy_fp& x, int e)
+    {
+      return diy_fp(x.f << (x.e - e), e);
+    }
+
+    //***************************************************************************
+    /// The bit representation of a floating point type.
+    //***************************************************************************
+    template <typename T>
+    struct shortest_float_bits;
+
+    template <>
+    struct shortest_float_bits<float>
+    {
+      typedef uint32_t type;
+    };
+
+    template <>
+    struct shortest_float_bits<double>
+    {
+      typedef uint64_t type;
+    };
+
+    //***************************************************************************
+    /// Finds the value and the boundaries of its rounding interval,
+    /// normalised to the exponent of the upper boundary.
+    /// The value must be finite and greater than zero.
+    //***************************************************************************
+    template <typename T>
+    void shortest_boundaries(T value, diy_fp& w, diy_fp& w_minus, diy_fp& w_plus)
+    {
+      typedef typename shortest_float_bits<T>::type bits_t;
+
+      ETL_STATIC_ASSERT(sizeof(bits_t) == sizeof(T), "Unsupported floating point format");
+
+      const int      Precision  = etl::numeric_limits<T>::digits; // Includes the hidden bit.
+      const int      Bias       = etl::numeric_limits<T>::max_exponent - 1 + (Precision - 1);
+      const int      Min_Exp    = 1 - Bias;
+      const uint64_t Hidden_Bit = uint64_t(1U) << (Precision - 1);
+
+      bits_t bits;
+      memcpy(&bits, &value, sizeof(T));
+
+      const uint64_t biased_exponent = uint64_t(bits) >> (Precision - 1);
+      const uint64_t fraction        = uint64_t(bits) & (Hidden_Bit - 1U);
+
+      const diy_fp v = (biased_exponent == 0U) ? diy_fp(fraction, Min_Exp)
+                                               : diy_fp(fraction + Hidden_Bit, int(biased_exponent) - Bias);
+
+      // The gap below is half the size when the value is a power of two.
+      const bool lower_is_closer = (fraction == 0U) && (biased_exponent > 1U);
+
+      const diy_fp m_plus  = diy_fp((2U * v.f) + 1U, v.e - 1);
+      const diy_fp m_minus = lower_is_closer ? diy_fp((4U * v.f) - 1U, v.e - 2)
+                                             : diy_fp((2U * v.f) - 1U, v.e - 1);
+
+      w_plus  = diy_fp_normalise(m_plus);
+      w_minus = diy_fp_normalise_to(m_minus, w_plus.e);
+      w       = diy_fp_normalise(v);
+    }
+
+    //***************************************************************************
+    /// A cached power of ten, c = f * 2^e ~= 10^k.
+    //***************************************************************************
+    struct shortest_cached_power
+    {
+      uint64_t f;
+      int16_t  e;
+      int16_t  k;
+    };
+
+    //***************************************************************************
+    /// Normalised powers of ten from 10^-300 to 10^324 in steps of 8.
+    //***************************************************************************
+    template <typename T = void>
+    struct shortest_cached_powers
+    {
+      static const shortest_cached_power table[79];
+    };
+
+    template <typename T>
+    const shortest_cached_power shortest_cached_powers<T>::table[79] =
+    {
+      { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+      { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+      { 0xBE5691EF416BD60CULL, -1007, -284 },
+      { 0x8DD01FAD907FFC3CULL, -980, -276 },
+      { 0xD3515C2831559A83ULL, -954, -268 },
+      { 0x9D71AC8FADA6C9B5ULL, -927, -260 },
+      { 0xEA9C227723EE8BCBULL, -901, -252 },
+      { 0xAECC49914078536DULL, -874, -244 },
+      { 0x823C12795DB6CE57ULL, -847, -236 },
+      { 0xC21094364DFB5637ULL, -821, -228 },
+      { 0x9096EA6F3848984FULL, -794, -220 },
+      { 0xD77485CB25823AC7ULL, -768, -212 },
+      { 0xA086CFCD97BF97F4ULL, -741, -204 },
+      { 0xEF340A98172AACE5ULL, -715, -196 },
+      { 0xB23867FB2A35B28EULL, -688, -188 },
+      { 0x84C8D4DFD2C63F3BULL, -661, -180 },
+      { 0xC5DD44271AD3CDBAULL, -635, -172 },
+      { 0x936B9FCEBB25C996ULL, -608, -164 },
+      { 0xDBAC6C247D62A584ULL, -582, -156 },
+      { 0xA3AB66580D5FDAF6ULL, -555, -148 },
+      { 0xF3E2F893DEC3F126ULL, -529, -140 },
+      { 0xB5B5ADA8AAFF80B8ULL, -502, -132 },
+      { 0x87625F056C7C4A8BULL, -475, -124 },
+      { 0xC9BCFF6034C13053ULL, -449, -116 },
+      { 0x964E858C91BA2655ULL, -422, -108 },
+      { 0xDFF9772470297EBDULL, -396, -100 },
+      { 0xA6DFBD9FB8E5B88FULL, -369, -92 },
+      { 0xF8A95FCF88747D94ULL, -343, -84 },
+      { 0xB94470938FA89BCFULL, -316, -76 },
+      { 0x8A08F0F8BF0F156BULL, -289, -68 },
+      { 0xCDB02555653131B6ULL, -263, -60 },
+      { 0x993FE2C6D07B7FACULL, -236, -52 },
+      { 0xE45C10C42A2B3B06ULL, -210, -44 },
+      { 0xAA242499697392D3ULL, -183, -36 },
+      { 0xFD87B5F28300CA0EULL, -157, -28 },
+      { 0xBCE5086492111AEBULL, -130, -20 },
+      { 0x8CBCCC096F5088CCULL, -103, -12 },
+      { 0xD1B71758E219652CULL, -77, -4 },
+      { 0x9C40000000000000ULL, -50, 4 },
+      { 0xE8D4A51000000000ULL, -24, 12 },
+      { 0xAD78EBC5AC620000ULL, 3, 20 },
+      { 0x813F3978F8940984ULL, 30, 28 },
+      { 0xC097CE7BC90715B3ULL, 56, 36 },
+      { 0x8F7E32CE7BEA5C70ULL, 83, 44 },
+      { 0xD5D238A4ABE98068ULL, 109, 52 },
+      { 0x9F4F2726179A2245ULL, 136, 60 },
+      { 0xED63A231D4C4FB27ULL, 162, 68 },
+      { 0xB0DE65388CC8ADA8ULL, 189, 76 },
+      { 0x83C7088E1AAB65DBULL, 216, 84 },
+      { 0xC45D1DF942711D9AULL, 242, 92 },
+      { 0x924D692CA61BE758ULL, 269, 100 },
+      { 0xDA01EE641A708DEAULL, 295, 108 },
+      { 0xA26DA3999AEF774AULL, 322, 116 },
+      { 0xF209787BB47D6B85ULL, 348, 124 },
+      { 0xB454E4A179DD1877ULL, 375, 132 },
+      { 0x865B86925B9BC5C2ULL, 402, 140 },
+      { 0xC83553C5C8965D3DULL, 428, 148 },
+      { 0x952AB45CFA97A0B3ULL, 455, 156 },
+      { 0xDE469FBD99A05FE3ULL, 481, 164 },
+      { 0xA59BC234DB398C25ULL, 508, 172 },
+      { 0xF6C69A72A3989F5CULL, 534, 180 },
+      { 0xB7DCBF5354E9BECEULL, 561, 188 },
+      { 0x88FCF317F22241E2ULL, 588, 196 },
+      { 0xCC20CE9BD35C78A5ULL, 614, 204 },
+      { 0x98165AF37B2153DFULL, 641, 212 },
+      { 0xE2A0B5DC971F303AULL, 667, 220 },
+      { 0xA8D9D1535CE3B396ULL, 694, 228 },
+      { 0xFB9B7CD9A4A7443CULL, 720, 236 },
+      { 0xBB764C4CA7A44410ULL, 747, 244 },
+      { 0x8BAB8EEFB6409C1AULL, 774, 252 },
+      { 0xD01FEF10A657842CULL, 800, 260 },
+      { 0x9B10A4E5E9913129ULL, 827, 268 },
+      { 0xE7109BFBA19C0C9DULL, 853, 276 },
+      { 0xAC2820D9623BF429ULL, 880, 284 },
+      { 0x80444B5E7AA7CF85ULL, 907, 292 },
+      { 0xBF21E44003ACDD2DULL, 933, 300 },
+      { 0x8E679C2F5E44FF8FULL, 960, 308 },
+      { 0xD433179D9C8CB841ULL, 986, 316 },
+      { 0x9E19DB92B4E31BA9ULL, 1013, 324 }
+    };
+
+    //***************************************************************************
+    /// Finds a cached power of ten that scales a value with a binary exponent
+    /// of e so that the result's exponent is in the range [-60, -32].
+    //***************************************************************************
+    inline const shortest_cached_power& shortest_get_cached_power(int e)
+    {
+      const int Alpha            = -60;
+      const int Min_Decimal_Exp  = -300;
+      const int Decimal_Exp_Step = 8;
+
+      // k = ceil((Alpha - e - 1) * log10(2))
+      const int f = Alpha - e - 1;
+      const int k = ((f * 78913) / (1 << 18)) + ((f > 0) ? 1 : 0);
+
+      const int index = (-Min_Decimal_Exp + k + (Decimal_Exp_Step - 1)) / Decimal_Exp_Step;
+
+      return shortest_cached_powers<>::table[index];
+    }
+
+    //***************************************************************************
+    /// Finds the largest power of ten <= n, returning the number of digits in n.
+    //***************************************************************************
+    inline int shortest_largest_pow10(uint32_t n, uint32_t& pow10)
+    {
+      int digits = 10;
+      pow10 = 1000000000U;
+
+      while ((pow10 > n) && (digits > 1))
+      {
+        pow10 /= 10U;
+        --digits;
+      }
+
+      return digits;
+    }
+
+    //***************************************************************************
+    /// Moves the last digit towards w while it stays inside the interval.
+    //***************************************************************************
+    inline void shortest_round(char* buffer, int length, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k)
+    {
+      while ((rest < dist) &&
+             ((delta - rest) >= ten_k) &&
+             (((rest + ten_k) < dist) || ((dist - rest) > (rest + ten_k - dist))))
+      {
+        --buffer[length - 1];
+        rest += ten_k;
+      }
+    }
+
+    //***************************************************************************
+    /// Generates the digits of M_plus until they are within the interval.
+    //***************************************************************************
+    inline void shortest_generate_digits(char* buffer, int& length, int& decimal_exponent, const diy_fp& M_minus, const diy_fp& w, const diy_fp& M_plus)
+    {
+      uint64_t delta = diy_fp_subtract(M_plus, M_minus).f;
+      uint64_t dist  = diy_fp_subtract(M_plus, w).f;
+
+      const int      shift = -M_plus.e;
+      const uint64_t one   = uint64_t(1U) << shift;
+
+      // Split M_plus into integral and fractional parts.
+      uint32_t p1 = static_cast<uint32_t>(M_plus.f >> shift);
+      uint64_t p2 = M_plus.f & (one - 1U);
+
+      uint32_t pow10;
+      int n = shortest_largest_pow10(p1, pow10);
+
+      // The integral digits.
+      while (n > 0)
+      {
+        const uint32_t d = p1 / pow10;
+        p1 %= pow10;
+        buffer[length++] = static_cast<char>('0' + d);
+        --n;
+
+        const uint64_t rest = (uint64_t(p1) << shift) + p2;
+
+        if (rest <= delta)
+        {
+          decimal_exponent += n;
+          shortest_round(buffer, length, dist, delta, rest, uint64_t(pow10) << shift);
+          return;
+        }
+
+        pow10 /= 10U;
+      }
+
+      // The fractional digits.
+      int m = 0;
+
+      while (true)
+      {
+        p2 *= 10U;
+        buffer[length++] = static_cast<char>('0' + (p2 >> shift));
+        p2 &= (one - 1U);
+        ++m;
+
+        delta *= 10U;
+        dist  *= 10U;
+
+        if (p2 <= delta)
+        {
+          break;
+        }
+      }
+
+      decimal_exponent -= m;
+      shortest_round(buffer, length, dist, delta, p2, one);
+    }
+
+    //***************************************************************************
+    /// Generates the shortest digits for a finite value greater than zero.
+    /// value = digits * 10^decimal_exponent.
+    /// The buffer must hold at least 17 characters.
+    //***************************************************************************
+    template <typename T>
+    void shortest_decimal(T value, char* buffer, int& length, int& decimal_exponent)
+    {
+      diy_fp w(0U, 0);
+      diy_fp w_minus(0U, 0);
+      diy_fp w_plus(0U, 0);
+
+      shortest_boundaries(value, w, w_minus, w_plus);
+
+      const shortest_cached_power& cached = shortest_get_cached_power(w_plus.e);
+      const diy_fp c_minus_k(cached.f, cached.e);
+
+      const diy_fp w_scaled       = diy_fp_multiply(w,       c_minus_k);
+      const diy_fp w_minus_scaled = diy_fp_multiply(w_minus, c_minus_k);
+      const diy_fp w_plus_scaled  = diy_fp_multiply(w_plus,  c_minus_k);
+
+      // Narrow the interval by one unit to allow for the errors in the multiplications.
+      const diy_fp M_minus(w_minus_scaled.f + 1U, w_minus_scaled.e);
+      const diy_fp M_plus(w_plus_scaled.f - 1U, w_plus_scaled.e);
+
+      length           = 0;
+      decimal_exponent = -cached.k;
+
+      shortest_generate_digits(buffer, length, decimal_exponent, M_minus, w_scaled, M_plus);
+    }
+
+    //***************************************************************************
+    /// Long double is formatted as double.
+    //***************************************************************************
+    inline void shortest_decimal(long double value, char* buffer, int& length, int& decimal_exponent)
+    {
+      shortest_decimal(static_cast<double>(value), buffer, length, decimal_exponent);
+    }
+
+    //***************************************************************************
+    /// Appends the digits, value = digits * 10^decimal_exponent.
+    /// Uses fixed notation when the decimal point falls within 21 digits,
+    /// in the same way as ECMAScript, otherwise scientific notation.
+    //***************************************************************************
+    template <typename TIString>
+    void add_shortest_digits(const char* digits, int length, int decimal_exponent, TIString& str, bool upper_case)
+    {
+      typedef typename TIString::value_type type;
+
+      // Longest is "0.00000" + 17 digits, or 17 digits + ".e-324".
+      type  buffer[32];
+      type* p = buffer;
+
+      // The number of digits before the decimal point.
+      const int point = length + decimal_exponent;
+
+      if ((point > 0) && (point <= 21))
+      {
+        if (point >= length)
+        {
+          // All integral. ddd000
+          for (int i = 0; i < length; ++i)
+          {
+            *p++ = type(digits[i]);
+          }
+
+          for (int i = length; i < point; ++i)
+          {
+            *p++ = type('0');
+          }
+        }
+        else
+        {
+          // ddd.ddd
+          for (int i = 0; i < point; ++i)
+          {
+            *p++ = type(digits[i]);
+          }
+
+          *p++ = type('.');
+
+          for (int i = point; i < length; ++i)
+          {
+            *p++ = type(digits[i]);
+          }
+        }
+      }
+      else if ((point <= 0) && (point > -6))
+      {
+        // 0.000ddd
+        *p++ = type('0');
+        *p++ = type('.');
+
+        for (int i = point; i < 0; ++i)
+        {
+          *p++ = type('0');
+        }
+
+        for (int i = 0; i < length; ++i)
+        {
+          *p++ = type(digits[i]);
+        }
+      }
+      else
+      {
+        // d.ddde+xx
+        *p++ = type(digits[0]);
+
+        if (length > 1)
+        {
+          *p++ = type('.');
+
+          for (int i = 1; i < length; ++i)
+          {
+            *p++ = type(digits[i]);
+          }
+        }
+
+        *p++ = upper_case ? type('E') : type('e');
+
+        int exponent = point - 1;
+
+        if (exponent < 0)
+        {
+          *p++ = type('-');
+          exponent = -exponent;
+        }
+        else
+        {
+          *p++ = type('+');
+        }
+
+        if (exponent >= 100)
+        {
+          *p++ = type('0' + (exponent / 100));
+          exponent %= 100;
+        }
+
+        *p++ = type('0' + (exponent / 10));
+        *p++ = type('0' + (exponent % 10));
+      }
+
+      str.append(buffer, static_cast<typename TIString::size_type>(p - buffer));
+    }
+  }
+}
+
+#endif
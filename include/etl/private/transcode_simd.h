@@ -0,0 +1,125 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRANSCODE_SIMD_INCLUDED
+#define ETL_TRANSCODE_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// ASCII detection for the UTF transcoders, 16 bytes at a time.
+// Uses SSE2 when available, otherwise two 64 bit words at a time (SWAR).
+// Define ETL_TRANSCODE_USING_SIMD as 0 to use the SWAR code.
+//*****************************************************************************
+#if !defined(ETL_TRANSCODE_USING_SIMD)
+  #if ETL_USING_SSE2
+    #define ETL_TRANSCODE_USING_SIMD 1
+  #else
+    #define ETL_TRANSCODE_USING_SIMD 0
+  #endif
+#endif
+
+#if ETL_TRANSCODE_USING_SIMD
+  #include <emmintrin.h>
+#endif
+
+namespace etl
+{
+  namespace private_transcode
+  {
+    //*************************************************************************
+    /// The mask of the bits that are not ASCII, for each unit size.
+    //*************************************************************************
+    template <size_t Size>
+    struct non_ascii_mask;
+
+    template <>
+    struct non_ascii_mask<1U>
+    {
+      static ETL_CONSTANT uint64_t value = 0x8080808080808080ULL;
+    };
+
+    template <>
+    struct non_ascii_mask<2U>
+    {
+      static ETL_CONSTANT uint64_t value = 0xFF80FF80FF80FF80ULL;
+    };
+
+    template <>
+    struct non_ascii_mask<4U>
+    {
+      static ETL_CONSTANT uint64_t value = 0xFFFFFF80FFFFFF80ULL;
+    };
+
+    //*************************************************************************
+    /// Whether the 16 bytes at p are all ASCII units.
+    //*************************************************************************
+    template <size_t Size>
+    bool is_ascii_block(const void* p)
+    {
+#if ETL_TRANSCODE_USING_SIMD
+      const __m128i mask  = _mm_set1_epi64x(int64_t(non_ascii_mask<Size>::value));
+      const __m128i block = _mm_loadu_si128(static_cast<const __m128i*>(p));
+
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(block, mask), _mm_setzero_si128())) == 0xFFFF;
+#else
+      uint64_t words[2];
+      memcpy(words, p, sizeof(words));
+
+      return ((words[0] | words[1]) & non_ascii_mask<Size>::value) == 0U;
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of leading ASCII units, in whole 16 byte blocks, of the
+    /// first 'length' units.
+    //*************************************************************************
+    template <typename T>
+    size_t ascii_prefix(const T* p, size_t length)
+    {
+      const size_t block = 16U / sizeof(T);
+
+      size_t count = 0U;
+
+      while (((length - count) >= block) && is_ascii_block<sizeof(T)>(p + count))
+      {
+        count += block;
+      }
+
+      return count;
+    }
+  }
+}
+
+#endif
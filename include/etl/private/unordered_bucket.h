@@ -0,0 +1,102 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_BUCKET_INCLUDED
+#define ETL_UNORDERED_BUCKET_INCLUDED
+
+#include "../platform.h"
+#include "../power.h"
+#include "../hash.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_unordered
+  {
+    //*************************************************************************
+    /// The number of buckets allocated for a requested bucket count.
+    /// Rounded up to a power of 2 when ETL_UNORDERED_POW2_BUCKETS_ENABLE is defined.
+    //*************************************************************************
+    template <size_t Buckets>
+    struct bucket_count
+    {
+#if ETL_HAS_UNORDERED_POW2_BUCKETS
+      static ETL_CONSTANT size_t value = etl::power_of_2_round_up<Buckets>::value;
+#else
+      static ETL_CONSTANT size_t value = Buckets;
+#endif
+    };
+
+    template <size_t Buckets>
+    ETL_CONSTANT size_t bucket_count<Buckets>::value;
+
+    //*************************************************************************
+    /// Maps a hash to a bucket index.
+    /// Uses the avalanche finaliser and a mask when ETL_UNORDERED_POW2_BUCKETS_ENABLE
+    /// is defined, avoiding an integer division on every lookup.
+    /// Otherwise uses the remainder of the division by the bucket count.
+    //*************************************************************************
+    inline size_t bucket_index(size_t hash, size_t number_of_buckets)
+    {
+#if ETL_HAS_UNORDERED_POW2_BUCKETS
+      return etl::hash_avalanche(hash) & (number_of_buckets - 1U);
+#else
+      return hash % number_of_buckets;
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of keys hashed and prefetched together by find_batch.
+    //*************************************************************************
+    struct find_batch
+    {
+      enum
+      {
+        Size = 16
+      };
+    };
+
+    //*************************************************************************
+    /// Requests a cache line, ahead of its use.
+    //*************************************************************************
+    inline void prefetch(const void* p)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(p);
+#else
+      (void)p;
+#endif
+    }
+  }
+}
+
+#endif
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "../platform.h"
 #include "../utility.h"
 #include "../largest.h"
+#include "../smallest.h"
 #include "../exception.h"
 #include "../type_traits.h"
 #include "../integral_limits.h"
@@ -457,8 +458,9 @@ namespace etl
 
     //***************************************************************************
     /// The type used for ids.
+    /// The smallest type that can hold every index and the 'no value' id.
     //***************************************************************************
-    using type_id_t = uint_least8_t ;
+    using type_id_t = etl::smallest_uint_for_value_t<sizeof...(TTypes)>;
 
     //***************************************************************************
     /// get() is a friend function.
@@ -507,10 +509,22 @@ namespace etl
     //***************************************************************************
     static const size_t Size = sizeof(largest_t);
 
+    //***************************************************************************
+    /// The id stored when there is no value.
+    //***************************************************************************
+    static constexpr type_id_t Npos_Id = etl::integral_limits<type_id_t>::max;
+
     //***************************************************************************
     /// The largest alignment.
+    /// Defining ETL_VARIANT_ALIGNMENT raises the alignment of the storage to at
+    /// least that value, for example to keep each variant on its own cache line.
     //***************************************************************************
+#if defined(ETL_VARIANT_ALIGNMENT)
+    static const size_t Alignment = (etl::largest_alignment<TTypes...>::value > ETL_VARIANT_ALIGNMENT) ? etl::largest_alignment<TTypes...>::value
+                                                                                                      : ETL_VARIANT_ALIGNMENT;
+#else
     static const size_t Alignment = etl::largest_alignment<TTypes...>::value;
+#endif
 
     //***************************************************************************
     /// The operation templates.
@@ -560,8 +574,8 @@ namespace etl
 #include "diagnostic_uninitialized_push.h"
     template <typename T, etl::enable_if_t<!etl::is_same<etl::remove_cvref_t<T>, variant>::value, int> = 0>
     ETL_CONSTEXPR14 variant(T&& value)
-      : operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
-      , type_id(index_of_type<T>::value)
+      : type_id(index_of_type<T>::value)
+      , operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
     {
       static_assert(etl::is_one_of<etl::remove_cvref_t<T>, TTypes...>::value, "Unsupported type");
 
@@ -575,8 +589,8 @@ namespace etl
 #include "diagnostic_uninitialized_push.h"
     template <typename T, typename... TArgs>
     ETL_CONSTEXPR14 explicit variant(etl::in_place_type_t<T>, TArgs&&... args)
-      : operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
-      , type_id(index_of_type<T>::value)
+      : type_id(index_of_type<T>::value)
+      , operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
     {
       static_assert(etl::is_one_of<etl::remove_cvref_t<T>, TTypes...>::value, "Unsupported type");
 
@@ -608,8 +622,8 @@ namespace etl
 #include "diagnostic_uninitialized_push.h"
     template <typename T, typename U, typename... TArgs >
     ETL_CONSTEXPR14 explicit variant(etl::in_place_type_t<T>, std::initializer_list<U> init, TArgs&&... args)
-      : operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
-      , type_id(index_of_type<T>::value)
+      : type_id(index_of_type<T>::value)
+      , operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
     {
       static_assert(etl::is_one_of<etl::remove_cvref_t<T>, TTypes...> ::value, "Unsupported type");
 
@@ -641,14 +655,14 @@ namespace etl
     //***************************************************************************
 #include "diagnostic_uninitialized_push.h"
     ETL_CONSTEXPR14 variant(const variant& other)
-      : operation(other.operation)
-      , type_id(other.type_id)
+      : type_id(other.type_id)
+      , operation(other.operation)
     {
       if (this != &other)
       {
         if (other.index() == variant_npos)
         {
-          type_id = variant_npos;
+          type_id = Npos_Id;
         }
         else
         {
@@ -664,14 +678,14 @@ namespace etl
     //***************************************************************************
 #include "diagnostic_uninitialized_push.h"
     ETL_CONSTEXPR14 variant(variant&& other)
-      : operation(other.operation)
-      , type_id(other.type_id)
+      : type_id(other.type_id)
+      , operation(other.operation)
     {
       if (this != &other)
       {
         if (other.index() == variant_npos)
         {
-          type_id = variant_npos;
+          type_id = Npos_Id;
         }
         else
         {
@@ -680,7 +694,7 @@ namespace etl
       }
       else
       {
-        type_id = variant_npos;
+        type_id = Npos_Id;
       }
     }
 #include "diagnostic_pop.h"
@@ -696,7 +710,7 @@ namespace etl
       }
 
       operation = operation_type<void, false, false>::do_operation; // Null operation.
-      type_id = variant_npos;
+      type_id = Npos_Id;
     }
 
     //***************************************************************************
@@ -818,7 +832,7 @@ namespace etl
       {
         if (other.index() == variant_npos)
         {
-          type_id = variant_npos;
+          type_id = Npos_Id;
         }
         else
         {
@@ -844,7 +858,7 @@ namespace etl
       {
         if (other.index() == variant_npos)
         {
-          type_id = variant_npos;
+          type_id = Npos_Id;
         }
         else
         {
@@ -866,7 +880,7 @@ namespace etl
     //***************************************************************************
     constexpr bool valueless_by_exception() const noexcept
     {
-      return type_id == variant_npos;
+      return type_id == Npos_Id;
     }
 
     //***************************************************************************
@@ -874,7 +888,7 @@ namespace etl
     //***************************************************************************
     constexpr size_t index() const noexcept
     {
-      return type_id;
+      return (type_id == Npos_Id) ? variant_npos : static_cast<size_t>(type_id);
     }
 
     //***************************************************************************
@@ -934,11 +948,7 @@ namespace etl
     etl::enable_if_t<etl::is_visitor<TVisitor>::value, void>
       accept(TVisitor& v)
     {
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_visitor(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-#else
-      do_visitor(v);
-#endif
     }
 
     //***************************************************************************
@@ -948,11 +958,7 @@ namespace etl
     etl::enable_if_t<etl::is_visitor<TVisitor>::value, void>
       accept(TVisitor& v) const
     {
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_visitor(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-#else
-      do_visitor(v);
-#endif
     }
 
     //***************************************************************************
@@ -962,11 +968,7 @@ namespace etl
     etl::enable_if_t<!etl::is_visitor<TVisitor>::value, void>
       accept(TVisitor& v)
     {
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_operator(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-#else
-      do_operator(v);
-#endif
     }
 
     //***************************************************************************
@@ -976,11 +978,7 @@ namespace etl
     etl::enable_if_t<!etl::is_visitor<TVisitor>::value, void>
       accept(TVisitor& v) const
     {
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_operator(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-#else
-      do_operator(v);
-#endif
     }
 
     //***************************************************************************
@@ -993,11 +991,7 @@ namespace etl
 #endif
     void accept_visitor(TVisitor& v)
     {
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_visitor(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-#else
-      do_visitor(v);
-#endif
     }
 
     //***************************************************************************
@@ -1010,11 +1004,7 @@ namespace etl
 #endif
     void accept_visitor(TVisitor& v) const
     {
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_visitor(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-#else
-      do_visitor(v);
-#endif
     }
 
     //***************************************************************************
@@ -1027,11 +1017,7 @@ namespace etl
 #endif
     void accept_functor(TVisitor& v)
     {
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_operator(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-#else
-      do_operator(v);
-#endif
     }
 
     //***************************************************************************
@@ -1044,11 +1030,7 @@ namespace etl
 #endif
     void accept_functor(TVisitor& v) const
     {
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
       do_operator(v, etl::make_index_sequence<sizeof...(TTypes)>{});
-#else
-      do_operator(v);
-#endif
     }
 
   private:
@@ -1100,350 +1082,111 @@ namespace etl
       ::new (pstorage) type();
     }
 
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the relevant visitor through a table indexed by the type id.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_visitor(TVisitor& visitor, etl::index_sequence<I...>)
     {
-      (attempt_visitor<I>(visitor) || ...);
-    }
+      using function_type = void(*)(TVisitor&, variant&);
 
-    //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
-    //***************************************************************************
-    template <typename TVisitor, size_t... I>
-    void do_visitor(TVisitor& visitor, etl::index_sequence<I...>) const
-    {
-      (attempt_visitor<I>(visitor) || ...);
-    }
-#else
-    //***************************************************************************
-    /// /// Call the relevant visitor.
-    //***************************************************************************
-    template <typename TVisitor>
-    void do_visitor(TVisitor& visitor)
-    {
-      switch (index())
+      static constexpr function_type functions[] = { &call_visitor<I, TVisitor>... };
+
+      if (index() < sizeof...(TTypes))
       {
-        case 0: { visitor.visit(etl::get<0>(*this)); break; }
-        case 1: { visitor.visit(etl::get<1>(*this)); break; }
-        case 2: { visitor.visit(etl::get<2>(*this)); break; }
-        case 3: { visitor.visit(etl::get<3>(*this)); break; }
-        case 4: { visitor.visit(etl::get<4>(*this)); break; }
-        case 5: { visitor.visit(etl::get<5>(*this)); break; }
-        case 6: { visitor.visit(etl::get<6>(*this)); break; }
-        case 7: { visitor.visit(etl::get<7>(*this)); break; }
-#if !defined(ETL_VARIANT_CPP11_MAX_8_TYPES)
-        case 8: { visitor.visit(etl::get<8>(*this)); break; }
-        case 9: { visitor.visit(etl::get<9>(*this)); break; }
-        case 10: { visitor.visit(etl::get<10>(*this)); break; }
-        case 11: { visitor.visit(etl::get<11>(*this)); break; }
-        case 12: { visitor.visit(etl::get<12>(*this)); break; }
-        case 13: { visitor.visit(etl::get<13>(*this)); break; }
-        case 14: { visitor.visit(etl::get<14>(*this)); break; }
-        case 15: { visitor.visit(etl::get<15>(*this)); break; }
-#if !defined(ETL_VARIANT_CPP11_MAX_16_TYPES)
-        case 16: { visitor.visit(etl::get<16>(*this)); break; }
-        case 17: { visitor.visit(etl::get<17>(*this)); break; }
-        case 18: { visitor.visit(etl::get<18>(*this)); break; }
-        case 19: { visitor.visit(etl::get<19>(*this)); break; }
-        case 20: { visitor.visit(etl::get<20>(*this)); break; }
-        case 21: { visitor.visit(etl::get<21>(*this)); break; }
-        case 22: { visitor.visit(etl::get<22>(*this)); break; }
-        case 23: { visitor.visit(etl::get<23>(*this)); break; }
-#if !defined(ETL_VARIANT_CPP11_MAX_24_TYPES)
-        case 24: { visitor.visit(etl::get<24>(*this)); break; }
-        case 25: { visitor.visit(etl::get<25>(*this)); break; }
-        case 26: { visitor.visit(etl::get<26>(*this)); break; }
-        case 27: { visitor.visit(etl::get<27>(*this)); break; }
-        case 28: { visitor.visit(etl::get<28>(*this)); break; }
-        case 29: { visitor.visit(etl::get<29>(*this)); break; }
-        case 30: { visitor.visit(etl::get<30>(*this)); break; }
-        case 31: { visitor.visit(etl::get<31>(*this)); break; }
-#endif
-#endif
-#endif
-        default: break;
+        functions[index()](visitor, *this);
       }
     }
 
     //***************************************************************************
-    /// /// Call the relevant visitor.
+    /// Call the relevant visitor through a table indexed by the type id.
     //***************************************************************************
-    template <typename TVisitor>
-    void do_visitor(TVisitor& visitor) const
+    template <typename TVisitor, size_t... I>
+    void do_visitor(TVisitor& visitor, etl::index_sequence<I...>) const
     {
-      switch (index())
+      using function_type = void(*)(TVisitor&, const variant&);
+
+      static constexpr function_type functions[] = { &call_visitor<I, TVisitor>... };
+
+      if (index() < sizeof...(TTypes))
       {
-        case 0: { visitor.visit(etl::get<0>(*this)); break; }
-        case 1: { visitor.visit(etl::get<1>(*this)); break; }
-        case 2: { visitor.visit(etl::get<2>(*this)); break; }
-        case 3: { visitor.visit(etl::get<3>(*this)); break; }
-        case 4: { visitor.visit(etl::get<4>(*this)); break; }
-        case 5: { visitor.visit(etl::get<5>(*this)); break; }
-        case 6: { visitor.visit(etl::get<6>(*this)); break; }
-        case 7: { visitor.visit(etl::get<7>(*this)); break; }
-#if !defined(ETL_VARIANT_CPP11_MAX_8_TYPES)
-        case 8: { visitor.visit(etl::get<8>(*this)); break; }
-        case 9: { visitor.visit(etl::get<9>(*this)); break; }
-        case 10: { visitor.visit(etl::get<10>(*this)); break; }
-        case 11: { visitor.visit(etl::get<11>(*this)); break; }
-        case 12: { visitor.visit(etl::get<12>(*this)); break; }
-        case 13: { visitor.visit(etl::get<13>(*this)); break; }
-        case 14: { visitor.visit(etl::get<14>(*this)); break; }
-        case 15: { visitor.visit(etl::get<15>(*this)); break; }
-#if !defined(ETL_VARIANT_CPP11_MAX_16_TYPES)
-        case 16: { visitor.visit(etl::get<16>(*this)); break; }
-        case 17: { visitor.visit(etl::get<17>(*this)); break; }
-        case 18: { visitor.visit(etl::get<18>(*this)); break; }
-        case 19: { visitor.visit(etl::get<19>(*this)); break; }
-        case 20: { visitor.visit(etl::get<20>(*this)); break; }
-        case 21: { visitor.visit(etl::get<21>(*this)); break; }
-        case 22: { visitor.visit(etl::get<22>(*this)); break; }
-        case 23: { visitor.visit(etl::get<23>(*this)); break; }
-#if !defined(ETL_VARIANT_CPP11_MAX_24_TYPES)
-        case 24: { visitor.visit(etl::get<24>(*this)); break; }
-        case 25: { visitor.visit(etl::get<25>(*this)); break; }
-        case 26: { visitor.visit(etl::get<26>(*this)); break; }
-        case 27: { visitor.visit(etl::get<27>(*this)); break; }
-        case 28: { visitor.visit(etl::get<28>(*this)); break; }
-        case 29: { visitor.visit(etl::get<29>(*this)); break; }
-        case 30: { visitor.visit(etl::get<30>(*this)); break; }
-        case 31: { visitor.visit(etl::get<31>(*this)); break; }
-#endif
-#endif
-#endif
-        default: break;
+        functions[index()](visitor, *this);
       }
     }
-#endif
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a visitor with the alternative at Index.
     //***************************************************************************
     template <size_t Index, typename TVisitor>
-    bool attempt_visitor(TVisitor& visitor)
+    static void call_visitor(TVisitor& visitor, variant& v)
     {
-      if (Index == index())
-      {
-        // Workaround for MSVC (2023/05/13)
-        // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
-        // Changed all of the instances for consistency.
-        auto& v = etl::get<Index>(*this);
-        visitor.visit(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      // Workaround for MSVC (2023/05/13)
+      // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
+      // Changed all of the instances for consistency.
+      auto& value = *static_cast<type_from_index<Index>*>(v.data);
+      visitor.visit(value);
     }
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a visitor with the alternative at Index.
     //***************************************************************************
     template <size_t Index, typename TVisitor>
-    bool attempt_visitor(TVisitor& visitor) const
+    static void call_visitor(TVisitor& visitor, const variant& v)
     {
-      if (Index == index())
-      {
-        // Workaround for MSVC (2023/05/13)
-        // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
-        // Changed all of the instances for consistency.
-        auto& v = etl::get<Index>(*this);
-        visitor.visit(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      auto& value = *static_cast<const type_from_index<Index>*>(v.data);
+      visitor.visit(value);
     }
 
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
+    /// Call the relevant functor through a table indexed by the type id.
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_operator(TVisitor& visitor, etl::index_sequence<I...>)
     {
-      (attempt_operator<I>(visitor) || ...);
-    }
+      using function_type = void(*)(TVisitor&, variant&);
 
-    //***************************************************************************
-    /// Call the relevant visitor by attempting each one.
-    //***************************************************************************
-    template <typename TVisitor, size_t... I>
-    void do_operator(TVisitor& visitor, etl::index_sequence<I...>) const
-    {
-      (attempt_operator<I>(visitor) || ...);
-    }
-#else
-    //***************************************************************************
-    /// Call the relevant visitor.
-    //***************************************************************************
-    template <typename TVisitor>
-    void do_operator(TVisitor& visitor)
-    {
-#if defined(ETL_VARIANT_CPP11_MAX_8_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 8U, "ETL_VARIANT_CPP11_MAX_8_TYPES - Only a maximum of 8 types are allowed in this variant");
-#endif
-
-#if defined(ETL_VARIANT_CPP11_MAX_16_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 16U, "ETL_VARIANT_CPP11_MAX_16_TYPES - Only a maximum of 16 types are allowed in this variant");
-#endif
-
-#if defined(ETL_VARIANT_CPP11_MAX_24_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 24U, "ETL_VARIANT_CPP11_MAX_24_TYPES - Only a maximum of 24 types are allowed in this variant");
-#endif
-
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 32U, "A maximum of 32 types are allowed in this variant");
+      static constexpr function_type functions[] = { &call_operator<I, TVisitor>... };
 
-      switch (index())
+      if (index() < sizeof...(TTypes))
       {
-        case 0: visitor(etl::get<0>(*this)); break;
-        case 1: visitor(etl::get<1>(*this)); break;
-        case 2: visitor(etl::get<2>(*this)); break;
-        case 3: visitor(etl::get<3>(*this)); break;
-        case 4: visitor(etl::get<4>(*this)); break;
-        case 5: visitor(etl::get<5>(*this)); break;
-        case 6: visitor(etl::get<6>(*this)); break;
-        case 7: visitor(etl::get<7>(*this)); break;
-#if !defined(ETL_VARIANT_CPP11_MAX_8_TYPES)
-        case 8: visitor(etl::get<8>(*this)); break;
-        case 9: visitor(etl::get<9>(*this)); break;
-        case 10: visitor(etl::get<10>(*this)); break;
-        case 11: visitor(etl::get<11>(*this)); break;
-        case 12: visitor(etl::get<12>(*this)); break;
-        case 13: visitor(etl::get<13>(*this)); break;
-        case 14: visitor(etl::get<14>(*this)); break;
-        case 15: visitor(etl::get<15>(*this)); break;
-#if !defined(ETL_VARIANT_CPP11_MAX_16_TYPES)
-        case 16: visitor(etl::get<16>(*this)); break;
-        case 17: visitor(etl::get<17>(*this)); break;
-        case 18: visitor(etl::get<18>(*this)); break;
-        case 19: visitor(etl::get<19>(*this)); break;
-        case 20: visitor(etl::get<20>(*this)); break;
-        case 21: visitor(etl::get<21>(*this)); break;
-        case 22: visitor(etl::get<22>(*this)); break;
-        case 23: visitor(etl::get<23>(*this)); break;
-#if !defined(ETL_VARIANT_CPP11_MAX_24_TYPES)
-        case 24: visitor(etl::get<24>(*this)); break;
-        case 25: visitor(etl::get<25>(*this)); break;
-        case 26: visitor(etl::get<26>(*this)); break;
-        case 27: visitor(etl::get<27>(*this)); break;
-        case 28: visitor(etl::get<28>(*this)); break;
-        case 29: visitor(etl::get<29>(*this)); break;
-        case 30: visitor(etl::get<30>(*this)); break;
-        case 31: visitor(etl::get<31>(*this)); break;
-#endif
-#endif
-#endif
-        default: break;
+        functions[index()](visitor, *this);
       }
     }
 
     //***************************************************************************
-    /// Call the relevant visitor.
+    /// Call the relevant functor through a table indexed by the type id.
     //***************************************************************************
-    template <typename TVisitor>
-    void do_operator(TVisitor& visitor) const
+    template <typename TVisitor, size_t... I>
+    void do_operator(TVisitor& visitor, etl::index_sequence<I...>) const
     {
-#if defined(ETL_VARIANT_CPP11_MAX_8_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 8U, "ETL_VARIANT_CPP11_MAX_8_TYPES - Only a maximum of 8 types are allowed in this variant");
-#endif
-
-#if defined(ETL_VARIANT_CPP11_MAX_16_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 16U, "ETL_VARIANT_CPP11_MAX_16_TYPES - Only a maximum of 16 types are allowed in this variant");
-#endif
-
-#if defined(ETL_VARIANT_CPP11_MAX_24_TYPES)
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 24U, "ETL_VARIANT_CPP11_MAX_24_TYPES - Only a maximum of 24 types are allowed in this variant");
-#endif
+      using function_type = void(*)(TVisitor&, const variant&);
 
-      ETL_STATIC_ASSERT(sizeof...(TTypes) <= 32U, "A maximum of 32 types are allowed in this variant");
+      static constexpr function_type functions[] = { &call_operator<I, TVisitor>... };
 
-      switch (index())
+      if (index() < sizeof...(TTypes))
       {
-        case 0: visitor(etl::get<0>(*this)); break;
-        case 1: visitor(etl::get<1>(*this)); break;
-        case 2: visitor(etl::get<2>(*this)); break;
-        case 3: visitor(etl::get<3>(*this)); break;
-        case 4: visitor(etl::get<4>(*this)); break;
-        case 5: visitor(etl::get<5>(*this)); break;
-        case 6: visitor(etl::get<6>(*this)); break;
-        case 7: visitor(etl::get<7>(*this)); break;
-#if !defined(ETL_VARIANT_CPP11_MAX_8_TYPES)
-        case 8: visitor(etl::get<8>(*this)); break;
-        case 9: visitor(etl::get<9>(*this)); break;
-        case 10: visitor(etl::get<10>(*this)); break;
-        case 11: visitor(etl::get<11>(*this)); break;
-        case 12: visitor(etl::get<12>(*this)); break;
-        case 13: visitor(etl::get<13>(*this)); break;
-        case 14: visitor(etl::get<14>(*this)); break;
-        case 15: visitor(etl::get<15>(*this)); break;
-#if !defined(ETL_VARIANT_CPP11_MAX_16_TYPES)
-        case 16: visitor(etl::get<16>(*this)); break;
-        case 17: visitor(etl::get<17>(*this)); break;
-        case 18: visitor(etl::get<18>(*this)); break;
-        case 19: visitor(etl::get<19>(*this)); break;
-        case 20: visitor(etl::get<20>(*this)); break;
-        case 21: visitor(etl::get<21>(*this)); break;
-        case 22: visitor(etl::get<22>(*this)); break;
-        case 23: visitor(etl::get<23>(*this)); break;
-#if !defined(ETL_VARIANT_CPP11_MAX_24_TYPES)
-        case 24: visitor(etl::get<24>(*this)); break;
-        case 25: visitor(etl::get<25>(*this)); break;
-        case 26: visitor(etl::get<26>(*this)); break;
-        case 27: visitor(etl::get<27>(*this)); break;
-        case 28: visitor(etl::get<28>(*this)); break;
-        case 29: visitor(etl::get<29>(*this)); break;
-        case 30: visitor(etl::get<30>(*this)); break;
-        case 31: visitor(etl::get<31>(*this)); break;
-#endif
-#endif
-#endif
-        default: break;
+        functions[index()](visitor, *this);
       }
     }
-#endif
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a functor with the alternative at Index.
     //***************************************************************************
     template <size_t Index, typename TVisitor>
-    bool attempt_operator(TVisitor& visitor)
+    static void call_operator(TVisitor& visitor, variant& v)
     {
-      if (Index == index())
-      {
-        auto& v = etl::get<Index>(*this);
-        visitor(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      auto& value = *static_cast<type_from_index<Index>*>(v.data);
+      visitor(value);
     }
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call a functor with the alternative at Index.
     //***************************************************************************
     template <size_t Index, typename TVisitor>
-    bool attempt_operator(TVisitor& visitor) const
+    static void call_operator(TVisitor& visitor, const variant& v)
     {
-      if (Index == index())
-      {
-        auto& v = etl::get<Index>(*this);
-        visitor(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      auto& value = *static_cast<const type_from_index<Index>*>(v.data);
+      visitor(value);
     }
 
     //***************************************************************************
@@ -1453,14 +1196,15 @@ namespace etl
     etl::uninitialized_buffer<Size, 1U, Alignment> data;
 
     //***************************************************************************
-    /// The operation function.
+    /// The id of the current stored type.
+    /// Placed after the storage, so that it may use its padding.
     //***************************************************************************
-    operation_function operation;
+    type_id_t type_id;
 
     //***************************************************************************
-    /// The id of the current stored type.
+    /// The operation function.
     //***************************************************************************
-    size_t type_id;
+    operation_function operation;
   };
 
   //***************************************************************************
@@ -1832,8 +1576,127 @@ namespace etl
       return jmp_table[v.index()](static_cast<TCallable&&>(f), static_cast<TVariant&&>(v), static_cast<TVarRest&&>(variants)...);
     }
 
-    template <typename TRet, typename TCallable, typename TVariant, typename... TVs>
-    static ETL_CONSTEXPR14 TRet visit(TCallable&& f, TVariant&& v, TVs&&... vs)
+    //***************************************************************************
+    /// The largest number of entries in a flattened visit table.
+    /// Larger visits dispatch the first variant and then visit the rest.
+    //***************************************************************************
+    static constexpr size_t Max_Flat_Visit_Entries = 256U;
+
+    //***************************************************************************
+    /// The product of the sizes of a list of variants.
+    //***************************************************************************
+    template <size_t... tSizes>
+    struct visit_product;
+
+    template <>
+    struct visit_product<> : etl::integral_constant<size_t, 1U>
+    {
+    };
+
+    template <size_t tSize, size_t... tSizes>
+    struct visit_product<tSize, tSizes...> : etl::integral_constant<size_t, tSize * visit_product<tSizes...>::value>
+    {
+    };
+
+    //***************************************************************************
+    /// The alternative index of the variant at tVariant for an entry of the
+    /// flattened visit table. The index of the last variant varies fastest.
+    //***************************************************************************
+    template <size_t tEntry, size_t tVariant, size_t... tSizes>
+    struct visit_alternative;
+
+    template <size_t tEntry, size_t tVariant, size_t tSize, size_t... tSizes>
+    struct visit_alternative<tEntry, tVariant, tSize, tSizes...> : visit_alternative<tEntry, tVariant - 1U, tSizes...>
+    {
+    };
+
+    template <size_t tEntry, size_t tSize, size_t... tSizes>
+    struct visit_alternative<tEntry, 0U, tSize, tSizes...> : etl::integral_constant<size_t, (tEntry / visit_product<tSizes...>::value) % tSize>
+    {
+    };
+
+    //***************************************************************************
+    /// Makes a call to TCallable with the alternatives that correspond to tEntry.
+    /// Instantiated as function pointer in the `do_flat_visit` function.
+    //***************************************************************************
+    template <typename TRet, typename TCallable, size_t tEntry, typename... TVariants>
+    struct flat_visit_entry
+    {
+      template <size_t... tVariants>
+      static constexpr TRet invoke(index_sequence<tVariants...>, TCallable&& f, TVariants&&... vs)
+      {
+        return static_cast<TCallable&&>(f)(etl::get<visit_alternative<tEntry, tVariants, variant_size<remove_reference_t<TVariants> >::value...>::value>(static_cast<TVariants&&>(vs))...);
+      }
+
+      static constexpr TRet call(TCallable&& f, TVariants&&... vs)
+      {
+        return invoke(make_index_sequence<sizeof...(TVariants)>{}, static_cast<TCallable&&>(f), static_cast<TVariants&&>(vs)...);
+      }
+    };
+
+    //***************************************************************************
+    /// The index in the flattened visit table for the current alternatives.
+    //***************************************************************************
+    constexpr size_t flat_visit_index(size_t entry)
+    {
+      return entry;
+    }
+
+    template <typename TVariant, typename... TRest>
+    constexpr size_t flat_visit_index(size_t entry, const TVariant& v, const TRest&... rest)
+    {
+      return flat_visit_index((entry * variant_size<TVariant>::value) + v.index(), rest...);
+    }
+
+    //***************************************************************************
+    /// True if any of the variants is valueless.
+    //***************************************************************************
+    constexpr bool any_valueless()
+    {
+      return false;
+    }
+
+    template <typename TVariant, typename... TRest>
+    constexpr bool any_valueless(const TVariant& v, const TRest&... rest)
+    {
+      return v.valueless_by_exception() || any_valueless(rest...);
+    }
+
+    //***************************************************************************
+    /// Dispatch all of the variants with a single call through a table that
+    /// has an entry for each combination of alternatives.
+    //***************************************************************************
+    template <typename TRet, typename TCallable, size_t... tEntries, typename... TVariants>
+    static ETL_CONSTEXPR14 TRet do_flat_visit(index_sequence<tEntries...>, TCallable&& f, TVariants&&... vs)
+    {
+      ETL_ASSERT(!any_valueless(vs...), ETL_ERROR(bad_variant_access));
+
+      using func_ptr = TRet(*)(TCallable&&, TVariants&&...);
+
+      constexpr func_ptr jmp_table[]
+      {
+        &flat_visit_entry<TRet, TCallable, tEntries, TVariants...>::call...
+      };
+
+      return jmp_table[flat_visit_index(0U, vs...)](static_cast<TCallable&&>(f), static_cast<TVariants&&>(vs)...);
+    }
+
+    //***************************************************************************
+    /// The flattened table is small enough.
+    //***************************************************************************
+    template <typename TRet, size_t tEntries, typename TCallable, typename... TVariants>
+    static ETL_CONSTEXPR14 TRet select_visit(etl::true_type, TCallable&& f, TVariants&&... vs)
+    {
+      return private_variant::do_flat_visit<TRet>(make_index_sequence<tEntries>{},
+                                                  static_cast<TCallable&&>(f),
+                                                  static_cast<TVariants&&>(vs)...);
+    }
+
+    //***************************************************************************
+    /// The flattened table would be too large, so dispatch the first variant.
+    //***************************************************************************
+    template <typename TRet, size_t tEntries, typename TCallable, typename TVariant, typename... TVs>
+    static ETL_CONSTEXPR14 TRet select_visit(etl::false_type, TCallable&& f, TVariant&& v, TVs&&... vs)
     {
       constexpr size_t variants = etl::variant_size<typename remove_reference<TVariant>::type>::value;
       return private_variant::do_visit<TRet>(static_cast<TCallable&&>(f),
@@ -1842,6 +1705,18 @@ namespace etl
                                              static_cast<TVs&&>(vs)...);
     }
 
+    template <typename TRet, typename TCallable, typename TVariant, typename... TVs>
+    static ETL_CONSTEXPR14 TRet visit(TCallable&& f, TVariant&& v, TVs&&... vs)
+    {
+      constexpr size_t entries = visit_product<etl::variant_size<typename remove_reference<TVariant>::type>::value,
+                                               etl::variant_size<typename remove_reference<TVs>::type>::value...>::value;
+
+      return private_variant::select_visit<TRet, entries>(etl::integral_constant<bool, (entries <= Max_Flat_Visit_Entries)>(),
+                                                          static_cast<TCallable&&>(f),
+                                                          static_cast<TVariant&&>(v),
+                                                          static_cast<TVs&&>(vs)...);
+    }
+
     //***************************************************************************
     /// Allows constexpr operation in c++14, otherwise acts like a lambda to
     /// bind a variant "get" to an argument for "TCallable".
@@ -96,6 +96,223 @@ SOFTWARE.
   #define ETL_USING_BUILTIN_IS_TRIVIALLY_COPYABLE 0
 #endif
 
+//*************************************
+// Compile time evaluation detection.
+// Used to select run time only code paths from within constexpr functions.
+#if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+      #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+    #endif
+  #elif defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 9)
+    #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+  #elif defined(_MSC_VER) && (_MSC_VER >= 1925)
+    #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+  #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 0
+#endif
+
+//*************************************
+// Bit counting builtins. GCC and Clang also evaluate these at compile time.
+// Popcount is only used when the target has an instruction for it, as
+// otherwise the builtin is a library call that is no faster than the shifts.
+// Trailing zeros compiles to BSF/TZCNT, RBIT + CLZ on ARMv7-M and above,
+// or a short library routine elsewhere.
+#if !defined(ETL_USING_BUILTIN_POPCOUNT)
+  #if (defined(__GNUC__) || defined(__clang__)) && \
+      (defined(__POPCNT__) || defined(__aarch64__) || defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define ETL_USING_BUILTIN_POPCOUNT 1
+  #else
+    #define ETL_USING_BUILTIN_POPCOUNT 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CTZ)
+  #if defined(__GNUC__) || defined(__clang__)
+    #define ETL_USING_BUILTIN_CTZ 1
+  #else
+    #define ETL_USING_BUILTIN_CTZ 0
+  #endif
+#endif
+
+//*************************************
+// SIMD instruction set support.
+// Detected from the target's instruction set macros, unless already defined.
+// Define ETL_NO_SIMD to disable all SIMD code paths.
+#if defined(ETL_NO_SIMD)
+  #if !defined(ETL_USING_SSE2)
+    #define ETL_USING_SSE2 0
+  #endif
+
+  #if !defined(ETL_USING_SSSE3)
+    #define ETL_USING_SSSE3 0
+  #endif
+
+  #if !defined(ETL_USING_AVX2)
+    #define ETL_USING_AVX2 0
+  #endif
+
+  #if !defined(ETL_USING_NEON)
+    #define ETL_USING_NEON 0
+  #endif
+
+  #if !defined(ETL_USING_MVE)
+    #define ETL_USING_MVE 0
+  #endif
+
+  #if !defined(ETL_USING_MVE_FLOAT)
+    #define ETL_USING_MVE_FLOAT 0
+  #endif
+
+  #if !defined(ETL_USING_NEON_FLOAT64)
+    #define ETL_USING_NEON_FLOAT64 0
+  #endif
+
+  #if !defined(ETL_USING_ARM_DSP)
+    #define ETL_USING_ARM_DSP 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_SSE2)
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_USING_SSE2 1
+  #else
+    #define ETL_USING_SSE2 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_SSSE3)
+  #if defined(__SSSE3__) || defined(__AVX__)
+    #define ETL_USING_SSSE3 1
+  #else
+    #define ETL_USING_SSSE3 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_AVX2)
+  #if defined(__AVX2__)
+    #define ETL_USING_AVX2 1
+  #else
+    #define ETL_USING_AVX2 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_NEON)
+  #if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_NEON 1
+  #else
+    #define ETL_USING_NEON 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_MVE)
+  #if defined(__ARM_FEATURE_MVE) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_MVE 1
+  #else
+    #define ETL_USING_MVE 0
+  #endif
+#endif
+
+// MVE with floating point lanes (Helium MVE-F).
+#if !defined(ETL_USING_MVE_FLOAT)
+  #if ETL_USING_MVE && defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 2)
+    #define ETL_USING_MVE_FLOAT 1
+  #else
+    #define ETL_USING_MVE_FLOAT 0
+  #endif
+#endif
+
+// NEON with double precision lanes, only available on AArch64.
+#if !defined(ETL_USING_NEON_FLOAT64)
+  #if ETL_USING_NEON && defined(__aarch64__)
+    #define ETL_USING_NEON_FLOAT64 1
+  #else
+    #define ETL_USING_NEON_FLOAT64 0
+  #endif
+#endif
+
+// The Cortex-M4/M7 DSP extension's packed 16 bit instructions, e.g. SMLAD.
+#if !defined(ETL_USING_ARM_DSP)
+  #if defined(__ARM_FEATURE_SIMD32) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_ARM_DSP 1
+  #else
+    #define ETL_USING_ARM_DSP 0
+  #endif
+#endif
+
+//*************************************
+// Scalar instruction set extensions, used by the CRC and hash kernels.
+// Detected from the target's instruction set macros, unless already defined.
+// These are not affected by ETL_NO_SIMD.
+#if !defined(ETL_USING_SSE42)
+  #if defined(__SSE4_2__) || defined(__AVX__)
+    #define ETL_USING_SSE42 1
+  #else
+    #define ETL_USING_SSE42 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_PCLMUL)
+  #if defined(__PCLMUL__)
+    #define ETL_USING_PCLMUL 1
+  #else
+    #define ETL_USING_PCLMUL 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_ARM_CRC32)
+  #if defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_ARM_CRC32 1
+  #else
+    #define ETL_USING_ARM_CRC32 0
+  #endif
+#endif
+
+// The AArch64 64 bit polynomial multiply, PMULL.
+#if !defined(ETL_USING_ARM_PMULL)
+  #if defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_ARM_PMULL 1
+  #else
+    #define ETL_USING_ARM_PMULL 0
+  #endif
+#endif
+
+//*************************************
+// Hardware CRC32 and CRC32-C support.
+// Define ETL_USE_USER_CRC32_HARDWARE or ETL_USE_USER_CRC32_C_HARDWARE to route
+// the calculation to a user supplied function, such as a peripheral CRC unit.
+#if !defined(ETL_USING_HARDWARE_CRC32_C)
+  #if defined(ETL_USE_USER_CRC32_C_HARDWARE) || ETL_USING_SSE42 || ETL_USING_ARM_CRC32
+    #define ETL_USING_HARDWARE_CRC32_C 1
+  #else
+    #define ETL_USING_HARDWARE_CRC32_C 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_HARDWARE_CRC32)
+  #if defined(ETL_USE_USER_CRC32_HARDWARE) || ETL_USING_ARM_CRC32
+    #define ETL_USING_HARDWARE_CRC32 1
+  #else
+    #define ETL_USING_HARDWARE_CRC32 0
+  #endif
+#endif
+
+//*************************************
+// Carry-less multiply support for CRC folding.
+// x86 requires PCLMULQDQ and SSSE3. ARM requires AArch64 with PMULL.
+// Disabled by ETL_NO_SIMD, as the folding uses vector registers.
+#if !defined(ETL_USING_CRC_FOLDING)
+  #if ETL_USING_CPP11 && ETL_USING_64BIT_TYPES && \
+      ((ETL_USING_PCLMUL && ETL_USING_SSSE3) || (ETL_USING_ARM_PMULL && ETL_USING_NEON))
+    #define ETL_USING_CRC_FOLDING 1
+  #else
+    #define ETL_USING_CRC_FOLDING 0
+  #endif
+#endif
+
 namespace etl
 {
   namespace traits
@@ -107,6 +324,23 @@ namespace etl
     static ETL_CONSTANT bool using_builtin_is_trivially_constructible = (ETL_USING_BUILTIN_IS_TRIVIALLY_CONSTRUCTIBLE == 1);
     static ETL_CONSTANT bool using_builtin_is_trivially_destructible  = (ETL_USING_BUILTIN_IS_TRIVIALLY_DESTRUCTIBLE == 1);
     static ETL_CONSTANT bool using_builtin_is_trivially_copyable      = (ETL_USING_BUILTIN_IS_TRIVIALLY_COPYABLE == 1);
+    static ETL_CONSTANT bool using_builtin_popcount                   = (ETL_USING_BUILTIN_POPCOUNT == 1);
+    static ETL_CONSTANT bool using_builtin_ctz                        = (ETL_USING_BUILTIN_CTZ == 1);
+    static ETL_CONSTANT bool using_sse2                               = (ETL_USING_SSE2 == 1);
+    static ETL_CONSTANT bool using_ssse3                              = (ETL_USING_SSSE3 == 1);
+    static ETL_CONSTANT bool using_avx2                               = (ETL_USING_AVX2 == 1);
+    static ETL_CONSTANT bool using_neon                               = (ETL_USING_NEON == 1);
+    static ETL_CONSTANT bool using_mve                                = (ETL_USING_MVE == 1);
+    static ETL_CONSTANT bool using_mve_float                          = (ETL_USING_MVE_FLOAT == 1);
+    static ETL_CONSTANT bool using_neon_float64                       = (ETL_USING_NEON_FLOAT64 == 1);
+    static ETL_CONSTANT bool using_arm_dsp                            = (ETL_USING_ARM_DSP == 1);
+    static ETL_CONSTANT bool using_sse42                              = (ETL_USING_SSE42 == 1);
+    static ETL_CONSTANT bool using_pclmul                             = (ETL_USING_PCLMUL == 1);
+    static ETL_CONSTANT bool using_arm_crc32                          = (ETL_USING_ARM_CRC32 == 1);
+    static ETL_CONSTANT bool using_arm_pmull                          = (ETL_USING_ARM_PMULL == 1);
+    static ETL_CONSTANT bool using_hardware_crc32                     = (ETL_USING_HARDWARE_CRC32 == 1);
+    static ETL_CONSTANT bool using_hardware_crc32_c                   = (ETL_USING_HARDWARE_CRC32_C == 1);
+    static ETL_CONSTANT bool using_crc_folding                        = (ETL_USING_CRC_FOLDING == 1);
   }
 }
 
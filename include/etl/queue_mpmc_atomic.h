@@ -0,0 +1,676 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "alignment.h"
+#include "parameter_type.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base for all queue_mpmc_atomics.
+  /// Each slot has a sequence counter that tells producers and consumers
+  /// whether it is free or holds a value for the current lap.
+  /// The counters are at least 32 bits, whatever the memory model, so that a
+  /// thread stalled between reading and claiming a position cannot be fooled
+  /// by the counter wrapping back to the same value.
+  //***************************************************************************
+  template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      counter_type dequeue = dequeue_position.load(etl::memory_order_acquire);
+      counter_type enqueue = enqueue_position.load(etl::memory_order_acquire);
+
+      counter_type n;
+
+      if (enqueue >= dequeue)
+      {
+        n = enqueue - dequeue;
+      }
+      else
+      {
+        n = LIMIT - dequeue + enqueue;
+      }
+
+      // A position may have moved on between the two loads.
+      return (n > MAX_SIZE) ? MAX_SIZE : size_type(n);
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    /// The type of the positions and slot sequence counters.
+    typedef typename etl::conditional<(sizeof(size_type) < sizeof(uint32_t)), uint32_t, size_type>::type counter_type;
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : enqueue_position(0),
+        dequeue_position(0),
+        MAX_SIZE(max_size_),
+        LIMIT(counter_type((etl::integral_limits<counter_type>::max / max_size_) * max_size_))
+    {
+    }
+
+    //*************************************************************************
+    /// Advances a position or sequence by n, wrapping at LIMIT.
+    //*************************************************************************
+    counter_type advance(counter_type position, counter_type n) const
+    {
+      return (position >= (LIMIT - n)) ? counter_type(position - (LIMIT - n)) : counter_type(position + n);
+    }
+
+    //*************************************************************************
+    /// Is the sequence ahead of the target, i.e. has another thread already
+    /// used the slot for this position?
+    //*************************************************************************
+    bool is_ahead(counter_type sequence, counter_type target) const
+    {
+      counter_type distance = (sequence >= target) ? counter_type(sequence - target) : counter_type(LIMIT - target + sequence);
+
+      return distance < (LIMIT / 2U);
+    }
+
+    etl::atomic<counter_type> enqueue_position; ///< The next position to push to.
+    etl::atomic<counter_type> dequeue_position; ///< The next position to pop from.
+    const size_type MAX_SIZE;                   ///< The maximum number of items in the queue.
+    const counter_type LIMIT;                   ///< Positions wrap at this multiple of MAX_SIZE.
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 10> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// It is lock-free, and does not require an RTOS.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&                        rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+  protected:
+
+    typedef typename base_t::counter_type counter_type;
+
+    //*************************************************************************
+    /// A slot in the queue.
+    //*************************************************************************
+    struct slot_type
+    {
+      etl::atomic<counter_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+
+      T* value()
+      {
+        return reinterpret_cast<T*>(&storage);
+      }
+    };
+
+    using base_t::enqueue_position;
+    using base_t::dequeue_position;
+    using base_t::MAX_SIZE;
+    using base_t::advance;
+    using base_t::is_ahead;
+
+  public:
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    ///\return <b>false</b> if the queue is full.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value);
+
+        publish_push(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue.
+    ///\return <b>false</b> if the queue is full.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(etl::move(value));
+
+        publish_push(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    ///\return <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(etl::forward<Args>(args)...);
+
+        publish_push(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    ///\return <b>false</b> if the queue is full.
+    //*************************************************************************
+    bool emplace()
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T();
+
+        publish_push(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    ///\return <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1);
+
+        publish_push(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    ///\return <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2);
+
+        publish_push(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    ///\return <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2, value3);
+
+        publish_push(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    ///\return <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2, value3, value4);
+
+        publish_push(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    ///\return <b>false</b> if the queue is empty.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_pop(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        value = ETL_MOVE(*p_slot->value());
+
+        release_pop(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    ///\return <b>false</b> if the queue is empty.
+    //*************************************************************************
+    bool pop()
+    {
+      counter_type position;
+      slot_type*   p_slot = claim_for_pop(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        release_pop(*p_slot, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Pops until the queue is seen to be empty.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(slot_type* p_slots_, size_type max_size_)
+      : base_t(max_size_),
+        p_slots(p_slots_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets each slot's sequence to its index.
+    /// Called from the derived class once the slots have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_slots[i].sequence.store(counter_type(i), etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the slot at the enqueue position.
+    ///\return The slot, or <b>ETL_NULLPTR</b> if the queue is full.
+    //*************************************************************************
+    slot_type* claim_for_push(counter_type& position)
+    {
+      position = enqueue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_type&   slot     = p_slots[position % MAX_SIZE];
+        counter_type sequence = slot.sequence.load(etl::memory_order_acquire);
+
+        if (sequence == position)
+        {
+          // The slot is free for this lap.
+          if (enqueue_position.compare_exchange_weak(position, advance(position, 1U), etl::memory_order_relaxed))
+          {
+            return &slot;
+          }
+        }
+        else if (is_ahead(sequence, position))
+        {
+          // Another producer has taken it.
+          position = enqueue_position.load(etl::memory_order_relaxed);
+        }
+        else
+        {
+          // The slot still holds the value from the previous lap.
+          return ETL_NULLPTR;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a pushed value visible to consumers.
+    //*************************************************************************
+    void publish_push(slot_type& slot, counter_type position)
+    {
+      slot.sequence.store(advance(position, 1U), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the slot at the dequeue position.
+    ///\return The slot, or <b>ETL_NULLPTR</b> if the queue is empty.
+    //*************************************************************************
+    slot_type* claim_for_pop(counter_type& position)
+    {
+      position = dequeue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_type&   slot     = p_slots[position % MAX_SIZE];
+        counter_type sequence = slot.sequence.load(etl::memory_order_acquire);
+        counter_type target   = advance(position, 1U);
+
+        if (sequence == target)
+        {
+          // The slot holds a value for this lap.
+          if (dequeue_position.compare_exchange_weak(position, target, etl::memory_order_relaxed))
+          {
+            return &slot;
+          }
+        }
+        else if (is_ahead(sequence, target))
+        {
+          // Another consumer has taken it.
+          position = dequeue_position.load(etl::memory_order_relaxed);
+        }
+        else
+        {
+          // Nothing has been pushed to the slot yet.
+          return ETL_NULLPTR;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys a popped value and frees the slot for the next lap.
+    //*************************************************************************
+    void release_pop(slot_type& slot, counter_type position)
+    {
+      slot.value()->~T();
+
+      slot.sequence.store(advance(position, counter_type(MAX_SIZE)), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    slot_type* p_slots; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity, lock-free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+  private:
+
+    typedef typename base_t::counter_type counter_type;
+    typedef typename base_t::slot_type    slot_type;
+
+  public:
+
+    // A slot's 'free' and 'full' sequences would be the same for a single slot.
+    ETL_STATIC_ASSERT((SIZE >= 2), "Size must be at least two");
+    ETL_STATIC_ASSERT((SIZE <= etl::integral_limits<size_type>::max), "Size too large for memory model");
+    ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<counter_type>::max / 4U)), "Size too large for the sequence counters");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(slots, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator = (queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The slots used in the queue_mpmc_atomic.
+    slot_type slots[SIZE];
+  };
+
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::size_type queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::MAX_SIZE;
+}
+
+#endif
+#endif
@@ -32,13 +32,16 @@ SOFTWARE.
 #define ETL_SPSC_QUEUE_ATOMIC_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
 #include "alignment.h"
 #include "parameter_type.h"
 #include "atomic.h"
 #include "memory_model.h"
 #include "integral_limits.h"
+#include "power.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -47,6 +50,14 @@ SOFTWARE.
 
 namespace etl
 {
+  //***************************************************************************
+  /// The base for all queue_spsc_atomics.
+  /// Define ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE (e.g. 64) to place the 'push'
+  /// and 'pop' indices on separate cache lines. Each thread then keeps a copy
+  /// of the other's index, and only reloads it when the queue looks full/empty.
+  /// When the capacity is a power of two the indices run freely and are
+  /// masked, so no slot is reserved to tell a full queue from an empty one.
+  //***************************************************************************
   template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
   class queue_spsc_atomic_base
   {
@@ -72,9 +83,7 @@ namespace etl
     //*************************************************************************
     bool full() const
     {
-      size_type next_index = get_next_index(write.load(etl::memory_order_acquire), RESERVED);
-
-      return (next_index == read.load(etl::memory_order_acquire));
+      return distance(write.load(etl::memory_order_acquire), read.load(etl::memory_order_acquire)) == CAPACITY;
     }
 
     //*************************************************************************
@@ -86,18 +95,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_acquire);
       size_type read_index = read.load(etl::memory_order_acquire);
 
-      size_type n;
-
-      if (write_index >= read_index)
-      {
-        n = write_index - read_index;
-      }
-      else
-      {
-        n = RESERVED - read_index + write_index;
-      }
-
-      return n;
+      return distance(write_index, read_index);
     }
 
     //*************************************************************************
@@ -106,7 +104,7 @@ namespace etl
     //*************************************************************************
     size_type available() const
     {
-      return RESERVED - size() - 1;
+      return CAPACITY - size();
     }
 
     //*************************************************************************
@@ -114,7 +112,7 @@ namespace etl
     //*************************************************************************
     size_type capacity() const
     {
-      return RESERVED - 1;
+      return CAPACITY;
     }
 
     //*************************************************************************
@@ -122,15 +120,26 @@ namespace etl
     //*************************************************************************
     size_type max_size() const
     {
-      return RESERVED - 1;
+      return CAPACITY;
     }
 
   protected:
 
-    queue_spsc_atomic_base(size_type reserved_)
+    //*************************************************************************
+    /// The indices run freely if there are as many slots as the capacity.
+    //*************************************************************************
+    queue_spsc_atomic_base(size_type slots_, size_type capacity_)
       : write(0),
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE)
+        read_cache(0),
+#endif
         read(0),
-        RESERVED(reserved_)
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE)
+        write_cache(0),
+#endif
+        RESERVED((slots_ == capacity_) ? size_type(0) : slots_),
+        MASK((slots_ == capacity_) ? size_type(capacity_ - 1) : size_type(~size_type(0))),
+        CAPACITY(capacity_)
     {
     }
 
@@ -149,9 +158,128 @@ namespace etl
       return index;
     }
 
+    //*************************************************************************
+    /// The number of items from the read index to the write index.
+    /// When the indices run freely RESERVED is zero, and this is the modular
+    /// difference.
+    //*************************************************************************
+    size_type distance(size_type write_index, size_type read_index) const
+    {
+      return (write_index >= read_index) ? size_type(write_index - read_index) : size_type(RESERVED - read_index + write_index);
+    }
+
+    //*************************************************************************
+    /// The slot for an index.
+    //*************************************************************************
+    size_type slot(size_type index) const
+    {
+      return index & MASK;
+    }
+
+    //*************************************************************************
+    /// The number of slots in the buffer.
+    //*************************************************************************
+    size_type slots() const
+    {
+      return (RESERVED != 0) ? RESERVED : CAPACITY;
+    }
+
+    //*************************************************************************
+    /// How much free space is there for the 'push' thread?
+    /// Always reloads the read index.
+    //*************************************************************************
+    size_type free_for_push(size_type write_index)
+    {
+      size_type read_index = read.load(etl::memory_order_acquire);
+
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE)
+      read_cache = read_index;
+#endif
+
+      return CAPACITY - distance(write_index, read_index);
+    }
+
+    //*************************************************************************
+    /// How many items are there for the 'pop' thread?
+    /// Always reloads the write index.
+    //*************************************************************************
+    size_type used_for_pop(size_type read_index)
+    {
+      size_type write_index = write.load(etl::memory_order_acquire);
+
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE)
+      write_cache = write_index;
+#endif
+
+      return distance(write_index, read_index);
+    }
+
+#if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE)
+    //*************************************************************************
+    /// Would pushing at the write index overrun the 'pop' thread?
+    /// Only reloads the read index when the cached copy says the queue is full.
+    /// Call from the 'push' thread only.
+    //*************************************************************************
+    bool is_full_for_push(size_type write_index)
+    {
+      if (distance(write_index, read_cache) == CAPACITY)
+      {
+        read_cache = read.load(etl::memory_order_acquire);
+
+        return (distance(write_index, read_cache) == CAPACITY);
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Is there nothing to pop at the read index?
+    /// Only reloads the write index when the cached copy says the queue is empty.
+    /// Call from the 'pop' thread only.
+    //*************************************************************************
+    bool is_empty_for_pop(size_type read_index)
+    {
+      if (read_index == write_cache)
+      {
+        write_cache = write.load(etl::memory_order_acquire);
+
+        return (read_index == write_cache);
+      }
+
+      return false;
+    }
+
+    // The indices used by the 'push' and 'pop' threads are kept on separate cache lines.
+    char padding0[ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE];
+    etl::atomic<size_type> write; ///< Where to input new data.
+    size_type read_cache;         ///< The 'push' thread's copy of the read index.
+    char padding1[ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE];
+    etl::atomic<size_type> read;  ///< Where to get the oldest data.
+    size_type write_cache;        ///< The 'pop' thread's copy of the write index.
+    char padding2[ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_SIZE];
+#else
+    //*************************************************************************
+    /// Would pushing at the write index overrun the 'pop' thread?
+    //*************************************************************************
+    bool is_full_for_push(size_type write_index) const
+    {
+      return (distance(write_index, read.load(etl::memory_order_acquire)) == CAPACITY);
+    }
+
+    //*************************************************************************
+    /// Is there nothing to pop at the read index?
+    //*************************************************************************
+    bool is_empty_for_pop(size_type read_index) const
+    {
+      return (read_index == write.load(etl::memory_order_acquire));
+    }
+
     etl::atomic<size_type> write; ///< Where to input new data.
     etl::atomic<size_type> read;  ///< Where to get the oldest data.
-    const size_type RESERVED;     ///< The maximum number of items in the queue.
+#endif
+    const size_type RESERVED;     ///< Where the indices wrap, or zero if they run freely.
+    const size_type MASK;         ///< Converts an index to a slot.
+    const size_type CAPACITY;     ///< The maximum number of items in the queue.
 
   private:
 
@@ -203,6 +331,12 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::slot;
+    using base_t::slots;
+    using base_t::is_full_for_push;
+    using base_t::is_empty_for_pop;
+    using base_t::free_for_push;
+    using base_t::used_for_pop;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,11 +346,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value);
+        ::new (&p_buffer[slot(write_index)]) T(value);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -234,11 +369,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(write_index))
       {
-        ::new (&p_buffer[write_index]) T(etl::move(value));
+        ::new (&p_buffer[slot(write_index)]) T(etl::move(value));
 
         write.store(next_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -259,11 +395,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(write_index))
       {
-        ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
+        ::new (&p_buffer[slot(write_index)]) T(etl::forward<Args>(args)...);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -281,11 +418,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(write_index))
       {
-        ::new (&p_buffer[write_index]) T();
+        ::new (&p_buffer[slot(write_index)]) T();
 
         write.store(next_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -304,11 +442,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value1);
+        ::new (&p_buffer[slot(write_index)]) T(value1);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -327,11 +466,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value1, value2);
+        ::new (&p_buffer[slot(write_index)]) T(value1, value2);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -350,11 +490,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value1, value2, value3);
+        ::new (&p_buffer[slot(write_index)]) T(value1, value2, value3);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -373,11 +514,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(write_index))
       {
-        ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
+        ::new (&p_buffer[slot(write_index)]) T(value1, value2, value3, value4);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -394,13 +536,13 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (is_empty_for_pop(read_index))
       {
         // Queue is empty
         return false;
       }
 
-      value = p_buffer[read_index];
+      value = p_buffer[slot(read_index)];
 
       return true;
     }
@@ -412,7 +554,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (is_empty_for_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -421,14 +563,15 @@ namespace etl
       size_type next_index = get_next_index(read_index, RESERVED);
 
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
-      value = etl::move(p_buffer[read_index]);
+      value = etl::move(p_buffer[slot(read_index)]);
 #else
-      value = p_buffer[read_index];
+      value = p_buffer[slot(read_index)];
 #endif
 
-      p_buffer[read_index].~T();
+      p_buffer[slot(read_index)].~T();
 
       read.store(next_index, etl::memory_order_release);
+      ETL_TRACE(etl::trace_event::queue_pop, this, 1U);
 
       return true;
     }
@@ -440,7 +583,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (is_empty_for_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -448,13 +591,125 @@ namespace etl
 
       size_type next_index = get_next_index(read_index, RESERVED);
 
-      p_buffer[read_index].~T();
+      p_buffer[slot(read_index)].~T();
 
       read.store(next_index, etl::memory_order_release);
+      ETL_TRACE(etl::trace_event::queue_pop, this, 1U);
 
       return true;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// The batch is published with a single update of the write index.
+    ///\return The number of values pushed. Stops early if the queue becomes full.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type free_count  = free_for_push(write_index);
+      size_type n = 0;
+
+      while ((first != last) && (n != free_count))
+      {
+        ::new (&p_buffer[slot(write_index)]) T(*first);
+
+        write_index = get_next_index(write_index, RESERVED);
+        ++first;
+        ++n;
+      }
+
+      if (n != 0)
+      {
+        write.store(write_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_push, this, n);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// The batch is released with a single update of the read index.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type n          = used_for_pop(read_index);
+
+      if (n > max_count)
+      {
+        n = max_count;
+      }
+
+      for (size_type i = 0; i != n; ++i)
+      {
+        *out = ETL_MOVE(p_buffer[slot(read_index)]);
+        ++out;
+
+        p_buffer[slot(read_index)].~T();
+
+        read_index = get_next_index(read_index, RESERVED);
+      }
+
+      if (n != 0)
+      {
+        read.store(read_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_pop, this, n);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gets the values at the front of the queue that are contiguous in memory,
+    /// so that they may be processed in place. Remove them with commit().
+    /// Call from the 'pop' thread only.
+    //*************************************************************************
+    etl::span<T> peek_span()
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type n          = used_for_pop(read_index);
+      size_type contiguous = slots() - slot(read_index);
+
+      return etl::span<T>(p_buffer + slot(read_index), static_cast<size_t>((n < contiguous) ? n : contiguous));
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue, usually after processing
+    /// them in place through peek_span().
+    /// The batch is released with a single update of the read index.
+    ///\return The number of values removed. Limited to the size of the queue.
+    //*************************************************************************
+    size_type commit(size_type n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type used       = used_for_pop(read_index);
+
+      if (n > used)
+      {
+        n = used;
+      }
+
+      for (size_type i = 0; i != n; ++i)
+      {
+        p_buffer[slot(read_index)].~T();
+
+        read_index = get_next_index(read_index, RESERVED);
+      }
+
+      if (n != 0)
+      {
+        read.store(read_index, etl::memory_order_release);
+        ETL_TRACE(etl::trace_event::queue_pop, this, n);
+      }
+
+      return n;
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     //*************************************************************************
@@ -462,7 +717,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      return p_buffer[read_index];
+      return p_buffer[slot(read_index)];
     }
 
     //*************************************************************************
@@ -472,7 +727,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      return p_buffer[read_index];
+      return p_buffer[slot(read_index)];
     }
 
     //*************************************************************************
@@ -493,8 +748,8 @@ namespace etl
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
-    iqueue_spsc_atomic(T* p_buffer_, size_type reserved_)
-      : base_t(reserved_),
+    iqueue_spsc_atomic(T* p_buffer_, size_type slots_, size_type capacity_)
+      : base_t(slots_, capacity_),
         p_buffer(p_buffer_)
     {
     }
@@ -518,7 +773,7 @@ namespace etl
   /// A fixed capacity spsc queue.
   /// This queue supports concurrent access by one producer and one consumer.
   /// \tparam T            The type this queue should support.
-  /// \tparam SIZE         The maximum capacity of the queue.
+  /// \tparam SIZE         The maximum capacity of the queue. A power of two saves a slot.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
   //***************************************************************************
   template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
@@ -534,7 +789,8 @@ namespace etl
 
   private:
 
-    static ETL_CONSTANT size_type RESERVED_SIZE = size_type(SIZE + 1);
+    // A power of two capacity needs no reserved slot.
+    static ETL_CONSTANT size_type RESERVED_SIZE = size_type(etl::is_power_of_2<SIZE>::value ? SIZE : SIZE + 1);
 
   public:
 
@@ -546,7 +802,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     queue_spsc_atomic()
-      : base_t(reinterpret_cast<T*>(&buffer[0]), RESERVED_SIZE)
+      : base_t(reinterpret_cast<T*>(&buffer[0]), RESERVED_SIZE, size_type(SIZE))
     {
     }
 
@@ -0,0 +1,461 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUE_SPSC_INTERPROCESS_INCLUDED
+#define ETL_QUEUE_SPSC_INTERPROCESS_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "static_assert.h"
+#include "nullptr.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+/// Define ETL_QUEUE_SPSC_INTERPROCESS_USING_FUTEX on Linux to add the
+/// blocking push_wait() and pop_wait(), which sleep on a futex in the
+/// shared region.
+//*****************************************************************************
+#if defined(ETL_QUEUE_SPSC_INTERPROCESS_USING_FUTEX)
+  #if !defined(__linux__)
+    #error ETL_QUEUE_SPSC_INTERPROCESS_USING_FUTEX requires Linux
+  #endif
+  #include "atomic_wait/atomic_wait_futex.h"
+#endif
+
+namespace etl
+{
+  namespace private_queue_spsc_interprocess
+  {
+    //*************************************************************************
+    /// The control block at the start of the shared region.
+    /// Holds no pointers, so the region may be mapped at a different address
+    /// in each process. The indices and the waiter counts that go with them
+    /// are on separate cache lines.
+    //*************************************************************************
+    struct header
+    {
+      static ETL_CONSTANT size_t Line_Size = 64U;
+
+      etl::atomic<uint32_t> magic;        ///< Set last, when the queue is ready.
+      uint32_t              version;      ///< The layout version.
+      uint32_t              element_size; ///< sizeof(T).
+      uint32_t              capacity;     ///< A power of two.
+      char                  padding0[Line_Size - (4U * sizeof(uint32_t))];
+
+      etl::atomic<uint32_t> write;        ///< Free running write index.
+      etl::atomic<uint32_t> pop_waiters;  ///< The consumers waiting on 'write'.
+      char                  padding1[Line_Size - (2U * sizeof(uint32_t))];
+
+      etl::atomic<uint32_t> read;         ///< Free running read index.
+      etl::atomic<uint32_t> push_waiters; ///< The producers waiting on 'read'.
+      char                  padding2[Line_Size - (2U * sizeof(uint32_t))];
+    };
+
+    ETL_STATIC_ASSERT(sizeof(etl::atomic<uint32_t>) == sizeof(uint32_t), "etl::atomic<uint32_t> must have the layout of uint32_t");
+  }
+
+  //***************************************************************************
+  /// A single producer, single consumer queue for two processes.
+  /// The control block and the storage are in a region of memory supplied by
+  /// the user, such as POSIX shared memory, and may be mapped at a different
+  /// address in each process. Items are copied directly into the region.
+  /// One process calls create() and the other calls attach().
+  /// The region holds a version stamped header, so attach() fails if the
+  /// queue was created by an incompatible build.
+  /// T must be trivially copyable and must not contain pointers.
+  /// The capacity is the largest power of two that fits in the region.
+  /// etl::atomic<uint32_t> must be lock free.
+  //***************************************************************************
+  template <typename T>
+  class queue_spsc_interprocess
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef uint32_t size_type;
+
+    static ETL_CONSTANT uint32_t Magic   = 0x51434C45UL; // "ELCQ"
+    static ETL_CONSTANT uint32_t Version = 1U;
+
+    //*************************************************************************
+    /// The size of region needed for a capacity.
+    //*************************************************************************
+    static size_t required_size(size_type capacity)
+    {
+      return storage_offset() + (size_t(capacity) * sizeof(T));
+    }
+
+    //*************************************************************************
+    /// Default constructor.
+    /// The queue may not be used until create() or attach() succeeds.
+    //*************************************************************************
+    queue_spsc_interprocess()
+      : p_header(ETL_NULLPTR)
+      , p_buffer(ETL_NULLPTR)
+      , mask(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Creates an empty queue in the region.
+    /// Must complete before the other process calls attach().
+    /// The region must be aligned to the cache line size.
+    /// Returns false if the region is too small to hold one item.
+    //*************************************************************************
+    bool create(void* p_region, size_t region_size)
+    {
+      detach();
+
+      if ((p_region == ETL_NULLPTR) || (region_size < required_size(1U)))
+      {
+        return false;
+      }
+
+      size_t items = (region_size - storage_offset()) / sizeof(T);
+
+      if (items > size_t(0x80000000UL))
+      {
+        items = size_t(0x80000000UL);
+      }
+
+      // Round down to a power of two.
+      size_type capacity = 1U;
+
+      while ((size_t(capacity) * 2U) <= items)
+      {
+        capacity *= 2U;
+      }
+
+      header_t* p = static_cast<header_t*>(p_region);
+
+      p->magic.store(0U, etl::memory_order_relaxed);
+      p->version      = Version;
+      p->element_size = uint32_t(sizeof(T));
+      p->capacity     = capacity;
+      p->write.store(0U, etl::memory_order_relaxed);
+      p->pop_waiters.store(0U, etl::memory_order_relaxed);
+      p->read.store(0U, etl::memory_order_relaxed);
+      p->push_waiters.store(0U, etl::memory_order_relaxed);
+
+      // Publish the queue.
+      p->magic.store(Magic, etl::memory_order_release);
+
+      use(p_region);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Attaches to a queue created in the region by another process.
+    /// Returns false if the region does not hold a ready queue of T with
+    /// this layout version, or is too small for it.
+    //*************************************************************************
+    bool attach(void* p_region, size_t region_size)
+    {
+      detach();
+
+      if ((p_region == ETL_NULLPTR) || (region_size < sizeof(header_t)))
+      {
+        return false;
+      }
+
+      header_t* p = static_cast<header_t*>(p_region);
+
+      if ((p->magic.load(etl::memory_order_acquire) != Magic) ||
+          (p->version != Version) ||
+          (p->element_size != sizeof(T)) ||
+          (p->capacity == 0U) ||
+          ((p->capacity & (p->capacity - 1U)) != 0U) ||
+          (region_size < required_size(p->capacity)))
+      {
+        return false;
+      }
+
+      use(p_region);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Stops using the region. The queue in the region is not changed.
+    //*************************************************************************
+    void detach()
+    {
+      p_header = ETL_NULLPTR;
+      p_buffer = ETL_NULLPTR;
+      mask     = 0U;
+    }
+
+    //*************************************************************************
+    /// Is the queue using a region?
+    //*************************************************************************
+    bool is_attached() const
+    {
+      return p_header != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Pushes a value to the queue.
+    /// Returns false if the queue is full.
+    /// Call from the producer only.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      const uint32_t write_index = p_header->write.load(etl::memory_order_relaxed);
+
+      if ((write_index - p_header->read.load(etl::memory_order_acquire)) > mask)
+      {
+        return false;
+      }
+
+      p_buffer[write_index & mask] = value;
+
+      publish(p_header->write, write_index + 1U, p_header->pop_waiters);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pops a value from the queue.
+    /// Returns false if the queue is empty.
+    /// Call from the consumer only.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      const uint32_t read_index = p_header->read.load(etl::memory_order_relaxed);
+
+      if (read_index == p_header->write.load(etl::memory_order_acquire))
+      {
+        return false;
+      }
+
+      value = p_buffer[read_index & mask];
+
+      publish(p_header->read, read_index + 1U, p_header->push_waiters);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pops a value from the queue and discards it.
+    /// Returns false if the queue is empty.
+    /// Call from the consumer only.
+    //*************************************************************************
+    bool pop()
+    {
+      const uint32_t read_index = p_header->read.load(etl::memory_order_relaxed);
+
+      if (read_index == p_header->write.load(etl::memory_order_acquire))
+      {
+        return false;
+      }
+
+      publish(p_header->read, read_index + 1U, p_header->push_waiters);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the value at the front of the queue, in the region.
+    /// Undefined if the queue is empty.
+    /// Call from the consumer only.
+    //*************************************************************************
+    reference front()
+    {
+      return p_buffer[p_header->read.load(etl::memory_order_relaxed) & mask];
+    }
+
+#if defined(ETL_QUEUE_SPSC_INTERPROCESS_USING_FUTEX)
+    //*************************************************************************
+    /// Pushes a value, sleeping while the queue is full.
+    /// Call from the producer only.
+    //*************************************************************************
+    void push_wait(const_reference value)
+    {
+      while (!push(value))
+      {
+        const uint32_t read_index = p_header->read.load(etl::memory_order_acquire);
+
+        wait_for_change(p_header->read, read_index, p_header->push_waiters, (p_header->write.load(etl::memory_order_relaxed) - read_index) > mask);
+      }
+    }
+
+    //*************************************************************************
+    /// Pops a value, sleeping while the queue is empty.
+    /// Call from the consumer only.
+    //*************************************************************************
+    void pop_wait(reference value)
+    {
+      while (!pop(value))
+      {
+        const uint32_t write_index = p_header->write.load(etl::memory_order_acquire);
+
+        wait_for_change(p_header->write, write_index, p_header->pop_waiters, write_index == p_header->read.load(etl::memory_order_relaxed));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Accurate from the consumer, a guess from the producer.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Accurate from the producer, a guess from the consumer.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == capacity();
+    }
+
+    //*************************************************************************
+    /// How many items are in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      return p_header->write.load(etl::memory_order_acquire) - p_header->read.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// How much free space is available in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return capacity() - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold?
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return mask + 1U;
+    }
+
+    size_type max_size() const
+    {
+      return capacity();
+    }
+
+  private:
+
+    typedef private_queue_spsc_interprocess::header header_t;
+
+    //*************************************************************************
+    /// The offset of the items from the start of the region.
+    //*************************************************************************
+    static size_t storage_offset()
+    {
+      const size_t alignment = etl::alignment_of<T>::value;
+
+      return ((sizeof(header_t) + alignment - 1U) / alignment) * alignment;
+    }
+
+    //*************************************************************************
+    /// Sets the pointers to a region that holds a queue.
+    //*************************************************************************
+    void use(void* p_region)
+    {
+      p_header = static_cast<header_t*>(p_region);
+      p_buffer = reinterpret_cast<T*>(static_cast<char*>(p_region) + storage_offset());
+      mask     = p_header->capacity - 1U;
+    }
+
+    //*************************************************************************
+    /// Stores a new index and wakes the other process if it is waiting on it.
+    //*************************************************************************
+    static void publish(etl::atomic<uint32_t>& index, uint32_t value, etl::atomic<uint32_t>& waiters)
+    {
+#if defined(ETL_QUEUE_SPSC_INTERPROCESS_USING_FUTEX)
+      // Ordered with the waiter's count and check in wait_for_change().
+      index.store(value, etl::memory_order_seq_cst);
+
+      if (waiters.load(etl::memory_order_seq_cst) != 0U)
+      {
+        etl::private_atomic_wait::wait_policy::notify_all_shared(index);
+      }
+#else
+      (void)waiters;
+      index.store(value, etl::memory_order_release);
+#endif
+    }
+
+#if defined(ETL_QUEUE_SPSC_INTERPROCESS_USING_FUTEX)
+    //*************************************************************************
+    /// Sleeps until the index changes from 'old_value', if 'blocked'.
+    //*************************************************************************
+    static void wait_for_change(etl::atomic<uint32_t>& index, uint32_t old_value, etl::atomic<uint32_t>& waiters, bool blocked)
+    {
+      if (blocked)
+      {
+        waiters.fetch_add(1U, etl::memory_order_seq_cst);
+
+        if (index.load(etl::memory_order_seq_cst) == old_value)
+        {
+          etl::private_atomic_wait::wait_policy::wait_shared(index, old_value);
+        }
+
+        waiters.fetch_sub(1U, etl::memory_order_relaxed);
+      }
+    }
+#endif
+
+    // Non-copyable
+    queue_spsc_interprocess(const queue_spsc_interprocess&) ETL_DELETE;
+    queue_spsc_interprocess& operator =(const queue_spsc_interprocess&) ETL_DELETE;
+
+    header_t* p_header; ///< The control block in the region.
+    T*        p_buffer; ///< The items in the region.
+    uint32_t  mask;     ///< The capacity - 1, copied from the control block.
+  };
+
+  template <typename T>
+  ETL_CONSTANT uint32_t queue_spsc_interprocess<T>::Magic;
+
+  template <typename T>
+  ETL_CONSTANT uint32_t queue_spsc_interprocess<T>::Version;
+}
+
+#endif
+#endif
@@ -32,12 +32,14 @@ SOFTWARE.
 #define ETL_SPSC_QUEUE_ISR_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
 #include "alignment.h"
 #include "parameter_type.h"
 #include "memory_model.h"
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -106,6 +108,44 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue from an ISR.
+    ///\return The number of values pushed. Stops early if the queue becomes full.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_from_isr(TIterator first, TIterator last)
+    {
+      return push_implementation(first, last);
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator from an ISR.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_from_isr(TOutputIterator out, size_type max_count)
+    {
+      return pop_implementation(out, max_count);
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous values at the front of the queue from an ISR.
+    /// Remove them with commit_from_isr().
+    //*************************************************************************
+    etl::span<T> peek_span_from_isr()
+    {
+      return peek_span_implementation();
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue from an ISR.
+    ///\return The number of values removed. Limited to the size of the queue.
+    //*************************************************************************
+    size_type commit_from_isr(size_type n)
+    {
+      return commit_implementation(n);
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue from an ISR
     //*************************************************************************
@@ -208,6 +248,7 @@ namespace etl
         write_index = get_next_index(write_index, MAX_SIZE);
 
         ++current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -229,6 +270,7 @@ namespace etl
         write_index = get_next_index(write_index, MAX_SIZE);
 
         ++current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -254,6 +296,7 @@ namespace etl
         write_index = get_next_index(write_index, MAX_SIZE);
 
         ++current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -275,6 +318,7 @@ namespace etl
         write_index = get_next_index(write_index, MAX_SIZE);
 
         ++current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -297,6 +341,7 @@ namespace etl
         write_index = get_next_index(write_index, MAX_SIZE);
 
         ++current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -319,6 +364,7 @@ namespace etl
         write_index = get_next_index(write_index, MAX_SIZE);
 
         ++current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -341,6 +387,7 @@ namespace etl
         write_index = get_next_index(write_index, MAX_SIZE);
 
         ++current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -363,6 +410,7 @@ namespace etl
         write_index = get_next_index(write_index, MAX_SIZE);
 
         ++current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -395,6 +443,7 @@ namespace etl
       read_index = get_next_index(read_index, MAX_SIZE);
 
       --current_size;
+      ETL_TRACE(etl::trace_event::queue_pop, this, 1U);
 
       return true;
     }
@@ -431,10 +480,92 @@ namespace etl
       read_index = get_next_index(read_index, MAX_SIZE);
 
       --current_size;
+      ETL_TRACE(etl::trace_event::queue_pop, this, 1U);
 
       return true;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_implementation(TIterator first, TIterator last)
+    {
+      const size_type free_count = MAX_SIZE - current_size;
+      size_type n = 0;
+
+      while ((first != last) && (n != free_count))
+      {
+        ::new (&p_buffer[write_index]) T(*first);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+        ++first;
+        ++n;
+      }
+
+      current_size += n;
+      ETL_TRACE(etl::trace_event::queue_push, this, n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_implementation(TOutputIterator out, size_type max_count)
+    {
+      const size_type n = (current_size < max_count) ? current_size : max_count;
+
+      for (size_type i = 0; i != n; ++i)
+      {
+        *out = ETL_MOVE(p_buffer[read_index]);
+        ++out;
+
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, MAX_SIZE);
+      }
+
+      current_size -= n;
+      ETL_TRACE(etl::trace_event::queue_pop, this, n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous values at the front of the queue.
+    //*************************************************************************
+    etl::span<T> peek_span_implementation()
+    {
+      const size_type contiguous = MAX_SIZE - read_index;
+
+      return etl::span<T>(p_buffer + read_index, static_cast<size_t>((current_size < contiguous) ? current_size : contiguous));
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue.
+    //*************************************************************************
+    size_type commit_implementation(size_type n)
+    {
+      if (n > current_size)
+      {
+        n = current_size;
+      }
+
+      for (size_type i = 0; i != n; ++i)
+      {
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, MAX_SIZE);
+      }
+
+      current_size -= n;
+      ETL_TRACE(etl::trace_event::queue_pop, this, n);
+
+      return n;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
     //*************************************************************************
@@ -657,6 +788,71 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Interrupts are locked once for the whole batch.
+    ///\return The number of values pushed. Stops early if the queue becomes full.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      TAccess::lock();
+
+      size_type result = this->push_implementation(first, last);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// Interrupts are locked once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      TAccess::lock();
+
+      size_type result = this->pop_implementation(out, max_count);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the values at the front of the queue that are contiguous in memory,
+    /// so that they may be processed in place. Remove them with commit().
+    //*************************************************************************
+    etl::span<T> peek_span()
+    {
+      TAccess::lock();
+
+      etl::span<T> result = this->peek_span_implementation();
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue, usually after processing
+    /// them in place through peek_span().
+    ///\return The number of values removed. Limited to the size of the queue.
+    //*************************************************************************
+    size_type commit(size_type n)
+    {
+      TAccess::lock();
+
+      size_type result = this->commit_implementation(n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue.
     //*************************************************************************
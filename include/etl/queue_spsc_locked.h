@@ -32,6 +32,7 @@ SOFTWARE.
 #define ETL_SPSC_QUEUE_LOCKED_INCLUDED
 
 #include "platform.h"
+#include "trace.h"
 #include "memory.h"
 #include "parameter_type.h"
 #include "memory_model.h"
@@ -39,6 +40,7 @@ SOFTWARE.
 #include "function.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -446,6 +448,114 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Unlocked.
+    ///\return The number of values pushed. Stops early if the queue becomes full.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_from_unlocked(TIterator first, TIterator last)
+    {
+      return push_implementation(first, last);
+    }
+
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Locked once for the whole batch.
+    ///\return The number of values pushed. Stops early if the queue becomes full.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      lock();
+
+      size_type result = push_implementation(first, last);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// Unlocked.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_from_unlocked(TOutputIterator out, size_type max_count)
+    {
+      return pop_implementation(out, max_count);
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// Locked once for the whole batch.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      lock();
+
+      size_type result = pop_implementation(out, max_count);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the values at the front of the queue that are contiguous in memory,
+    /// so that they may be processed in place. Remove them with commit().
+    /// Unlocked.
+    //*************************************************************************
+    etl::span<T> peek_span_from_unlocked()
+    {
+      return peek_span_implementation();
+    }
+
+    //*************************************************************************
+    /// Gets the values at the front of the queue that are contiguous in memory,
+    /// so that they may be processed in place. Remove them with commit().
+    //*************************************************************************
+    etl::span<T> peek_span()
+    {
+      lock();
+
+      etl::span<T> result = peek_span_implementation();
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue, usually after processing
+    /// them in place through peek_span().
+    /// Unlocked.
+    ///\return The number of values removed. Limited to the size of the queue.
+    //*************************************************************************
+    size_type commit_from_unlocked(size_type n)
+    {
+      return commit_implementation(n);
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue, usually after processing
+    /// them in place through peek_span().
+    ///\return The number of values removed. Limited to the size of the queue.
+    //*************************************************************************
+    size_type commit(size_type n)
+    {
+      lock();
+
+      size_type result = commit_implementation(n);
+
+      unlock();
+
+      return result;
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     /// Unlocked
@@ -601,6 +711,7 @@ namespace etl
         this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
 
         ++this->current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -623,6 +734,7 @@ namespace etl
         this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
 
         ++this->current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -647,6 +759,7 @@ namespace etl
         this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
 
         ++this->current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -667,6 +780,7 @@ namespace etl
         this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
 
         ++this->current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -688,6 +802,7 @@ namespace etl
         this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
 
         ++this->current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -709,6 +824,7 @@ namespace etl
         this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
 
         ++this->current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -730,6 +846,7 @@ namespace etl
         this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
 
         ++this->current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -751,6 +868,7 @@ namespace etl
         this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
 
         ++this->current_size;
+        ETL_TRACE(etl::trace_event::queue_push, this, 1U);
 
         return true;
       }
@@ -783,6 +901,7 @@ namespace etl
       this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
 
       --this->current_size;
+      ETL_TRACE(etl::trace_event::queue_pop, this, 1U);
 
       return true;
     }
@@ -822,10 +941,97 @@ namespace etl
       this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
 
       --this->current_size;
+      ETL_TRACE(etl::trace_event::queue_pop, this, 1U);
 
       return true;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Unlocked
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_implementation(TIterator first, TIterator last)
+    {
+      const size_type free_count = this->MAX_SIZE - this->current_size;
+      size_type n = 0;
+
+      while ((first != last) && (n != free_count))
+      {
+        ::new (&p_buffer[this->write_index]) T(*first);
+
+        this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
+        ++first;
+        ++n;
+      }
+
+      this->current_size += n;
+      ETL_TRACE(etl::trace_event::queue_push, this, n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// Unlocked
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_implementation(TOutputIterator out, size_type max_count)
+    {
+      const size_type n = (this->current_size < max_count) ? this->current_size : max_count;
+
+      for (size_type i = 0; i != n; ++i)
+      {
+        *out = ETL_MOVE(p_buffer[this->read_index]);
+        ++out;
+
+        p_buffer[this->read_index].~T();
+
+        this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
+      }
+
+      this->current_size -= n;
+      ETL_TRACE(etl::trace_event::queue_pop, this, n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous values at the front of the queue.
+    /// Unlocked
+    //*************************************************************************
+    etl::span<T> peek_span_implementation()
+    {
+      const size_type contiguous = this->MAX_SIZE - this->read_index;
+      const size_type n          = (this->current_size < contiguous) ? this->current_size : contiguous;
+
+      return etl::span<T>(p_buffer + this->read_index, static_cast<size_t>(n));
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue.
+    /// Unlocked
+    //*************************************************************************
+    size_type commit_implementation(size_type n)
+    {
+      if (n > this->current_size)
+      {
+        n = this->current_size;
+      }
+
+      for (size_type i = 0; i != n; ++i)
+      {
+        p_buffer[this->read_index].~T();
+
+        this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
+      }
+
+      this->current_size -= n;
+      ETL_TRACE(etl::trace_event::queue_pop, this, n);
+
+      return n;
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_locked(const iqueue_spsc_locked&) ETL_DELETE;
     iqueue_spsc_locked& operator =(const iqueue_spsc_locked&) ETL_DELETE;
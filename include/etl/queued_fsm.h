@@ -0,0 +1,147 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUED_FSM_INCLUDED
+#define ETL_QUEUED_FSM_INCLUDED
+
+#include "platform.h"
+#include "fsm.h"
+#include "queue.h"
+#include "message.h"
+#include "message_router.h"
+#include "error_handler.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Adds a bounded event queue with run-to-completion semantics to an
+  /// etl::fsm or etl::hfsm.
+  /// A message received while another is being processed, such as one sent
+  /// to the state machine from within a state's handler, is copied into the
+  /// queue and processed once the current event, and any state changes that
+  /// it caused, have completed.
+  /// \tparam TFsm       The state machine type. etl::fsm, etl::hfsm or a type derived from them.
+  /// \tparam TPacket    An etl::message_packet able to hold any of the queued messages.
+  /// \tparam Queue_Size The maximum number of messages that may be queued.
+  //***************************************************************************
+  template <typename TFsm, typename TPacket, size_t Queue_Size>
+  class queued_fsm : public TFsm
+  {
+  public:
+
+    ETL_STATIC_ASSERT((etl::is_base_of<etl::fsm, TFsm>::value), "TFsm must be derived from etl::fsm");
+
+    typedef TPacket packet_type;
+    typedef etl::imessage_router::message_span_t message_span_t;
+
+    static ETL_CONSTANT size_t Max_Queued_Events = Queue_Size;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_fsm(etl::message_router_id_t id)
+      : TFsm(id)
+      , processing(false)
+    {
+    }
+
+    using TFsm::receive;
+
+    //*******************************************
+    /// Top level message handler.
+    /// Processes the message, then any messages queued while doing so.
+    /// If called while a message is being processed, the message is queued.
+    /// Emits an etl::queue_full error if the queue has no free space.
+    //*******************************************
+    void receive(const etl::imessage& message) ETL_OVERRIDE
+    {
+      if (processing)
+      {
+        ETL_ASSERT_OR_RETURN(!event_queue.full(), ETL_ERROR(etl::queue_full));
+        event_queue.emplace(message);
+        return;
+      }
+
+      processing = true;
+
+      TFsm::receive(message);
+
+      // Messages are processed where they lie, as new ones are added at the back.
+      while (!event_queue.empty())
+      {
+        TFsm::receive(event_queue.front().get());
+        event_queue.pop();
+      }
+
+      processing = false;
+    }
+
+    //*******************************************
+    /// Handles a batch of messages, in order.
+    //*******************************************
+    void receive(message_span_t messages) ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        queued_fsm::receive(*messages[i]);
+      }
+    }
+
+    //*******************************************
+    /// Returns true if a message is being processed.
+    //*******************************************
+    bool is_processing() const
+    {
+      return processing;
+    }
+
+    //*******************************************
+    /// Returns the number of messages waiting to be processed.
+    //*******************************************
+    size_t queued_events() const
+    {
+      return event_queue.size();
+    }
+
+  private:
+
+    etl::queue<TPacket, Queue_Size> event_queue; ///< Messages received while processing another.
+    bool                            processing;  ///< True while a message is being processed.
+  };
+
+  template <typename TFsm, typename TPacket, size_t Queue_Size>
+  ETL_CONSTANT size_t queued_fsm<TFsm, TPacket, Queue_Size>::Max_Queued_Events;
+}
+
+#endif
@@ -0,0 +1,794 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_HEAP_INCLUDED
+#define ETL_RADIX_HEAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "bit.h"
+#include "memory.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup radix_heap radix_heap
+/// A monotone priority queue for unsigned integral priorities, with the
+/// capacity defined at compile time.
+/// The lowest key has the highest priority, and a key may not be pushed that
+/// is lower than the last key popped. Timer deadlines and scheduling ticks
+/// have this property.
+/// Push is O(1) and pop is O(log C) amortised, where C is the number of bits
+/// in the key, with no comparisons between the values in the queue.
+/// The values are held in buckets by the highest bit in which their key
+/// differs from the last key popped. A pop redistributes one bucket only
+/// when the lowest bucket is empty. Values with equal keys are popped in
+/// an unspecified order.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for radix_heap exceptions.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_exception : public etl::exception
+  {
+  public:
+
+    radix_heap_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the heap is full.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_full : public etl::radix_heap_exception
+  {
+  public:
+
+    radix_heap_full(string_type file_name_, numeric_type line_number_)
+      : etl::radix_heap_exception(ETL_ERROR_TEXT("radix_heap:full", ETL_RADIX_HEAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a key is lower than the last key popped.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_monotonic : public etl::radix_heap_exception
+  {
+  public:
+
+    radix_heap_monotonic(string_type file_name_, numeric_type line_number_)
+      : etl::radix_heap_exception(ETL_ERROR_TEXT("radix_heap:monotonic", ETL_RADIX_HEAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The default key for a radix_heap. The value is its own key.
+  /// Supply a functor with the same form to key other types.
+  ///\code
+  /// struct timer_key
+  /// {
+  ///   typedef uint32_t key_type;
+  ///
+  ///   key_type operator ()(const timer& t) const
+  ///   {
+  ///     return t.deadline;
+  ///   }
+  /// };
+  ///\endcode
+  ///\ingroup radix_heap
+  //***************************************************************************
+  template <typename T>
+  struct radix_heap_key
+  {
+    typedef T key_type;
+
+    key_type operator ()(const T& value) const
+    {
+      return value;
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup radix_heap
+  ///\brief The base for all radix heaps that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived heap.
+  ///\code
+  /// etl::radix_heap<uint32_t, 16> myHeap;
+  /// etl::iradix_heap<uint32_t>& iHeap = myHeap;
+  ///\endcode
+  /// \tparam T       The type of value that the heap holds.
+  /// \tparam TGetKey Gets the unsigned integral key of a value.
+  //***************************************************************************
+  template <typename T, typename TGetKey = etl::radix_heap_key<T> >
+  class iradix_heap
+  {
+  public:
+
+    typedef T                           value_type;       ///< The type stored in the heap.
+    typedef TGetKey                     key_getter_type;  ///< The key functor type.
+    typedef typename TGetKey::key_type  key_type;         ///< The type of the key.
+    typedef T&                          reference;        ///< A reference to the type used in the heap.
+    typedef const T&                    const_reference;  ///< A const reference to the type used in the heap.
+#if ETL_USING_CPP11
+    typedef T&&                         rvalue_reference; ///< An rvalue reference to the type used in the heap.
+#endif
+    typedef size_t                      size_type;        ///< The type used for determining the size of the heap.
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<key_type>::value, "The key must be an unsigned integral type");
+    ETL_STATIC_ASSERT(etl::integral_limits<key_type>::bits <= 64, "The key must be at most 64 bits");
+
+    /// Bucket 0 holds the keys equal to the last key popped. Bucket i holds the
+    /// keys that differ from it first in bit i - 1.
+    static ETL_CONSTANT size_t Number_Of_Buckets = etl::integral_limits<key_type>::bits + 1U;
+
+    //*************************************************************************
+    /// Gets a const reference to the value with the lowest key.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return *top_pointer();
+    }
+
+    //*************************************************************************
+    /// Gets the last key popped. Keys lower than this may not be pushed.
+    //*************************************************************************
+    key_type last_key() const
+    {
+      return last;
+    }
+
+    //*************************************************************************
+    /// Adds a value to the heap.
+    /// If asserts or exceptions are enabled, throws an etl::radix_heap_full
+    /// if the heap is already full, or an etl::radix_heap_monotonic if the
+    /// key is lower than the last key popped.
+    ///\param value The value to push to the heap.
+    //*************************************************************************
+    void push(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(etl::radix_heap_full));
+
+      const key_type key = key_of(value);
+
+      ETL_ASSERT_OR_RETURN(key >= last, ETL_ERROR(etl::radix_heap_monotonic));
+
+      const size_t bucket = bucket_of(key);
+      T* p = next_slot(bucket);
+      ::new (static_cast<void*>(p)) T(value);
+      add(bucket, p, key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves a value to the heap.
+    /// If asserts or exceptions are enabled, throws an etl::radix_heap_full
+    /// if the heap is already full, or an etl::radix_heap_monotonic if the
+    /// key is lower than the last key popped.
+    ///\param value The value to push to the heap.
+    //*************************************************************************
+    void push(rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(etl::radix_heap_full));
+
+      const key_type key = key_of(value);
+
+      ETL_ASSERT_OR_RETURN(key >= last, ETL_ERROR(etl::radix_heap_monotonic));
+
+      const size_t bucket = bucket_of(key);
+      T* p = next_slot(bucket);
+      ::new (static_cast<void*>(p)) T(etl::move(value));
+      add(bucket, p, key);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the heap.
+    /// The value is constructed before its key is known, then moved to its bucket.
+    /// If asserts or exceptions are enabled, throws an etl::radix_heap_full
+    /// if the heap is already full, or an etl::radix_heap_monotonic if the
+    /// key is lower than the last key popped.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args && ... args)
+    {
+      push(T(etl::forward<Args>(args)...));
+    }
+#endif
+
+    //*************************************************************************
+    /// Assigns values to the heap, starting afresh from a last key of zero.
+    /// If asserts or exceptions are enabled, throws an etl::radix_heap_full
+    /// if the heap does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last_)
+    {
+      clear();
+
+      while (first != last_)
+      {
+        push(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the value with the lowest key.
+    /// Does nothing if the heap is already empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (empty())
+      {
+        return;
+      }
+
+      if (heads[0] == npos)
+      {
+        redistribute();
+      }
+
+      const size_t block = heads[0];
+
+      --p_counts[block];
+      value_at(block, p_counts[block])->~T();
+
+      if (p_counts[block] == 0U)
+      {
+        heads[0] = p_next[block];
+        release(block);
+      }
+
+      --current_size;
+      p_lowest = ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Gets the value with the lowest key, assigns it to destination and
+    /// removes it from the heap.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      destination = ETL_MOVE(*top_pointer());
+      pop();
+    }
+
+    //*************************************************************************
+    /// Returns the current number of items in the heap.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be stored.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the heap is empty.
+    /// \return <b>true</b> if the heap is empty, otherwise <b>false</b>
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the heap is full.
+    /// \return <b>true</b> if the heap is full, otherwise <b>false</b>
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Clears the heap to the empty state, with a last key of zero.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+      {
+        size_t block = heads[bucket];
+
+        while (block != npos)
+        {
+          const size_t next = p_next[block];
+          etl::destroy(value_at(block, 0U), value_at(block, p_counts[block]));
+          release(block);
+          block = next;
+        }
+
+        heads[bucket] = npos;
+      }
+
+      occupied     = 0U;
+      current_size = 0U;
+      last         = key_type(0);
+      p_lowest     = ETL_NULLPTR;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iradix_heap(T* p_values_, size_t* p_next_, size_t* p_counts_, size_t max_size_, size_t block_size_, size_t number_of_blocks_)
+      : p_values(p_values_)
+      , p_next(p_next_)
+      , p_counts(p_counts_)
+      , free_blocks(npos)
+      , occupied(0U)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+      , BLOCK_SIZE(block_size_)
+      , last(key_type(0))
+      , p_lowest(ETL_NULLPTR)
+    {
+      for (size_t bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+      {
+        heads[bucket] = npos;
+      }
+
+      for (size_t block = number_of_blocks_; block != 0U; --block)
+      {
+        release(block - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Make this a clone of the supplied heap.
+    //*************************************************************************
+    void clone(const iradix_heap& other)
+    {
+      clear();
+      last = other.last;
+
+      for (size_t bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+      {
+        for (size_t block = other.heads[bucket]; block != npos; block = other.p_next[block])
+        {
+          for (size_t i = 0U; i < other.p_counts[block]; ++i)
+          {
+            push(*other.value_at(block, i));
+          }
+        }
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Make this a moved version of the supplied heap.
+    //*************************************************************************
+    void move(iradix_heap&& other)
+    {
+      clear();
+      last = other.last;
+
+      for (size_t bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+      {
+        for (size_t block = other.heads[bucket]; block != npos; block = other.p_next[block])
+        {
+          for (size_t i = 0U; i < other.p_counts[block]; ++i)
+          {
+            push(etl::move(*other.value_at(block, i)));
+          }
+        }
+      }
+
+      other.clear();
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~iradix_heap()
+    {
+    }
+
+  private:
+
+    /// The end of a list of blocks.
+    static ETL_CONSTANT size_t npos = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// Gets the bucket for a key.
+    //*************************************************************************
+    size_t bucket_of(key_type key) const
+    {
+      return static_cast<size_t>(etl::bit_width(static_cast<key_type>(key ^ last)));
+    }
+
+    //*************************************************************************
+    /// Gets the address of value i of a block.
+    //*************************************************************************
+    T* value_at(size_t block, size_t i) const
+    {
+      return p_values + (block * BLOCK_SIZE) + i;
+    }
+
+    //*************************************************************************
+    /// Takes a block from the free list.
+    //*************************************************************************
+    size_t allocate()
+    {
+      const size_t block = free_blocks;
+      free_blocks = p_next[block];
+
+      return block;
+    }
+
+    //*************************************************************************
+    /// Returns a block to the free list.
+    //*************************************************************************
+    void release(size_t block)
+    {
+      p_next[block] = free_blocks;
+      free_blocks   = block;
+    }
+
+    //*************************************************************************
+    /// Gets the address for the next value in a bucket.
+    /// Starts a new first block for the bucket if the current one is full.
+    //*************************************************************************
+    T* next_slot(size_t bucket)
+    {
+      size_t block = heads[bucket];
+
+      if ((block == npos) || (p_counts[block] == BLOCK_SIZE))
+      {
+        const size_t new_block = allocate();
+
+        p_next[new_block]   = block;
+        p_counts[new_block] = 0U;
+        heads[bucket]       = new_block;
+        block               = new_block;
+
+        if (bucket != 0U)
+        {
+          occupied |= (uint64_t(1) << (bucket - 1U));
+        }
+      }
+
+      return value_at(block, p_counts[block]);
+    }
+
+    //*************************************************************************
+    /// Counts the value just constructed at next_slot(bucket).
+    //*************************************************************************
+    void add(size_t bucket, const T* p, key_type key)
+    {
+      ++p_counts[heads[bucket]];
+      ++current_size;
+
+      if ((p_lowest != ETL_NULLPTR) && (key < key_of(*p_lowest)))
+      {
+        p_lowest = p;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves a value to the next slot of its bucket.
+    //*************************************************************************
+    void relocate(T* p)
+    {
+      const size_t bucket = bucket_of(key_of(*p));
+
+      ::new (static_cast<void*>(next_slot(bucket))) T(ETL_MOVE(*p));
+      ++p_counts[heads[bucket]];
+      p->~T();
+    }
+
+    //*************************************************************************
+    /// Gets the lowest occupied bucket, above bucket 0.
+    //*************************************************************************
+    size_t lowest_bucket() const
+    {
+      return static_cast<size_t>(etl::countr_zero(occupied)) + 1U;
+    }
+
+    //*************************************************************************
+    /// Gets the value that the next pop will remove.
+    /// Bucket 0 holds the lowest keys, if it is not empty, and the last of
+    /// them is popped first. Otherwise the lowest key is found in the lowest
+    /// occupied bucket and remembered until the next pop.
+    //*************************************************************************
+    const T* top_pointer() const
+    {
+      if (heads[0] != npos)
+      {
+        return value_at(heads[0], p_counts[heads[0]] - 1U);
+      }
+
+      if (p_lowest == ETL_NULLPTR)
+      {
+        p_lowest = value_at(heads[lowest_bucket()], 0U);
+        key_type lowest_key = key_of(*p_lowest);
+
+        for (size_t block = heads[lowest_bucket()]; block != npos; block = p_next[block])
+        {
+          for (size_t i = 0U; i < p_counts[block]; ++i)
+          {
+            const T* p = value_at(block, i);
+            const key_type key = key_of(*p);
+
+            if (key < lowest_key)
+            {
+              p_lowest   = p;
+              lowest_key = key;
+            }
+          }
+        }
+      }
+
+      return p_lowest;
+    }
+
+    //*************************************************************************
+    /// Moves last up to the lowest key, which is in the lowest occupied
+    /// bucket, and moves the bucket's values to the lower buckets.
+    /// The value with the lowest key is moved last, so that it is the next
+    /// one popped from bucket 0.
+    //*************************************************************************
+    void redistribute()
+    {
+      T* const lowest = const_cast<T*>(top_pointer());
+      const size_t bucket = lowest_bucket();
+
+      size_t block = heads[bucket];
+      size_t lowest_block = npos;
+
+      heads[bucket] = npos;
+      occupied &= ~(uint64_t(1) << (bucket - 1U));
+      last = key_of(*lowest);
+
+      while (block != npos)
+      {
+        const size_t next = p_next[block];
+
+        for (size_t i = 0U; i < p_counts[block]; ++i)
+        {
+          T* p = value_at(block, i);
+
+          if (p == lowest)
+          {
+            lowest_block = block;
+          }
+          else
+          {
+            relocate(p);
+          }
+        }
+
+        if (block != lowest_block)
+        {
+          release(block);
+        }
+
+        block = next;
+      }
+
+      relocate(lowest);
+      release(lowest_block);
+    }
+
+    // Disable copy construction and assignment.
+    iradix_heap(const iradix_heap&);
+    iradix_heap& operator =(const iradix_heap&);
+
+    T*              p_values;                   ///< The values, in blocks of BLOCK_SIZE.
+    size_t*         p_next;                     ///< The next block in the same bucket, or in the free list.
+    size_t*         p_counts;                   ///< The number of values in each block.
+    size_t          heads[Number_Of_Buckets];   ///< The first block of each bucket.
+    size_t          free_blocks;                ///< The first free block.
+    uint64_t        occupied;                   ///< Bit i - 1 is set if bucket i is not empty.
+    size_type       current_size;
+    const size_type CAPACITY;
+    const size_t    BLOCK_SIZE;
+    key_type        last;                       ///< The last key popped.
+    mutable const T* p_lowest;                  ///< The lowest value, if bucket 0 is empty and it is known.
+    TGetKey         key_of;
+  };
+
+  template <typename T, typename TGetKey>
+  ETL_CONSTANT size_t iradix_heap<T, TGetKey>::Number_Of_Buckets;
+
+  template <typename T, typename TGetKey>
+  ETL_CONSTANT size_t iradix_heap<T, TGetKey>::npos;
+
+  //***************************************************************************
+  ///\ingroup radix_heap
+  /// A fixed capacity radix heap.
+  /// This heap does not support concurrent access by different threads.
+  /// The values are stored in blocks of up to 16, so that moving a bucket
+  /// reads its values in order.
+  /// \tparam T       The type this heap should support.
+  /// \tparam SIZE    The maximum capacity of the heap.
+  /// \tparam TGetKey Gets the unsigned integral key of a value.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, typename TGetKey = etl::radix_heap_key<T> >
+  class radix_heap : public etl::iradix_heap<T, TGetKey>
+  {
+  private:
+
+    typedef etl::iradix_heap<T, TGetKey> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    /// The number of values in each block. Small heaps use smaller blocks.
+    static ETL_CONSTANT size_t Block_Size = ((SIZE / (base_t::Number_Of_Buckets + 2U)) >= 16U) ? 16U :
+                                            ((SIZE / (base_t::Number_Of_Buckets + 2U)) == 0U) ? 1U :
+                                            (SIZE / (base_t::Number_Of_Buckets + 2U));
+
+    /// The number of blocks that may be partly filled. These are the first
+    /// block of each bucket, and the one or two blocks being emptied by a
+    /// redistribution. Each holds at least one value.
+    static ETL_CONSTANT size_t Partial_Blocks = (SIZE < (base_t::Number_Of_Buckets + 2U)) ? SIZE : (base_t::Number_Of_Buckets + 2U);
+
+    /// The number of blocks.
+    static ETL_CONSTANT size_t Number_Of_Blocks = Partial_Blocks + ((SIZE - Partial_Blocks) / Block_Size);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    radix_heap()
+      : base_t(values, next, counts, SIZE, Block_Size, Number_Of_Blocks)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    radix_heap(const radix_heap& rhs)
+      : base_t(values, next, counts, SIZE, Block_Size, Number_Of_Blocks)
+    {
+      base_t::clone(rhs);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    radix_heap(radix_heap&& rhs)
+      : base_t(values, next, counts, SIZE, Block_Size, Number_Of_Blocks)
+    {
+      base_t::move(etl::move(rhs));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    radix_heap(TIterator first, TIterator last)
+      : base_t(values, next, counts, SIZE, Block_Size, Number_Of_Blocks)
+    {
+      base_t::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~radix_heap()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    radix_heap& operator = (const radix_heap& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    radix_heap& operator = (radix_heap&& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::move(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    etl::uninitialized_buffer_of<T, Number_Of_Blocks * Block_Size> values;
+    size_t next[Number_Of_Blocks];
+    size_t counts[Number_Of_Blocks];
+  };
+
+  template <typename T, const size_t SIZE, typename TGetKey>
+  ETL_CONSTANT typename radix_heap<T, SIZE, TGetKey>::size_type radix_heap<T, SIZE, TGetKey>::MAX_SIZE;
+
+  template <typename T, const size_t SIZE, typename TGetKey>
+  ETL_CONSTANT size_t radix_heap<T, SIZE, TGetKey>::Block_Size;
+
+  template <typename T, const size_t SIZE, typename TGetKey>
+  ETL_CONSTANT size_t radix_heap<T, SIZE, TGetKey>::Partial_Blocks;
+
+  template <typename T, const size_t SIZE, typename TGetKey>
+  ETL_CONSTANT size_t radix_heap<T, SIZE, TGetKey>::Number_Of_Blocks;
+}
+
+#endif
@@ -0,0 +1,1007 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_TREE_INCLUDED
+#define ETL_RADIX_TREE_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "string_view.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup radix_tree radix_tree
+/// A compressed radix tree (trie) that maps byte string keys to values, with
+/// the number of nodes defined at compile time.
+/// Each node holds a run of up to Label_Size key bytes, so keys that share a
+/// prefix share the nodes for it. Longer runs use a chain of nodes.
+/// Supports exact, longest prefix and 'all keys with a prefix' queries.
+/// Lookups are O(K), where K is the length of the key.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the radix_tree.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  class radix_tree_exception : public etl::exception
+  {
+  public:
+
+    radix_tree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the radix_tree.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  class radix_tree_full : public etl::radix_tree_exception
+  {
+  public:
+
+    radix_tree_full(string_type file_name_, numeric_type line_number_)
+      : etl::radix_tree_exception(ETL_ERROR_TEXT("radix_tree:full", ETL_RADIX_TREE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the radix_tree.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  class radix_tree_out_of_bounds : public etl::radix_tree_exception
+  {
+  public:
+
+    radix_tree_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::radix_tree_exception(ETL_ERROR_TEXT("radix_tree:bounds", ETL_RADIX_TREE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_radix_tree
+  {
+    //*************************************************************************
+    /// A node of the tree.
+    /// The children of a node are a list, sorted by their first label byte.
+    /// The label bytes are stored separately.
+    //*************************************************************************
+    struct node
+    {
+      uint16_t child;     ///< The first child, or Npos.
+      uint16_t sibling;   ///< The next sibling, or Npos. The next free node when free.
+      uint8_t  length;    ///< The number of label bytes.
+      bool     has_value; ///< Does a key end at this node?
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized radix_trees.
+  /// Can be used as a reference type for all radix_trees containing a specific type.
+  /// Node 0 is the root, which has an empty label.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  template <typename TMapped>
+  class iradix_tree
+  {
+  public:
+
+    typedef TMapped            mapped_type;
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+    typedef mapped_type*       mapped_pointer;
+    typedef const mapped_type* const_mapped_pointer;
+    typedef size_t             size_type;
+
+    //*************************************************************************
+    /// Inserts a key and value, if the key is not already in the tree.
+    /// If asserts or exceptions are enabled, emits radix_tree_full if there
+    /// are not enough free nodes. The tree is not changed.
+    ///\return <b>true</b> if the key was inserted.
+    //*************************************************************************
+    bool insert(etl::string_view key, const_mapped_reference value)
+    {
+      return insert(reinterpret_cast<const uint8_t*>(key.data()), key.size(), value);
+    }
+
+    //*************************************************************************
+    /// Inserts a byte key and value, if the key is not already in the tree.
+    /// If asserts or exceptions are enabled, emits radix_tree_full if there
+    /// are not enough free nodes. The tree is not changed.
+    ///\return <b>true</b> if the key was inserted.
+    //*************************************************************************
+    bool insert(const uint8_t* key, size_t length, const_mapped_reference value)
+    {
+      uint16_t n   = Root;
+      size_t   pos = 0U;
+
+      while (pos != length)
+      {
+        uint16_t child = find_child(n, key[pos]);
+
+        if (child == Npos)
+        {
+          ETL_ASSERT_OR_RETURN_VALUE(chain_length(length - pos) <= available(), ETL_ERROR(radix_tree_full), false);
+
+          add_chain(n, key + pos, length - pos, value);
+
+          return true;
+        }
+
+        const size_t matched = match(child, key + pos, length - pos);
+
+        if (matched != p_nodes[child].length)
+        {
+          // The key leaves the label part way through.
+          const size_t remaining = length - pos - matched;
+
+          ETL_ASSERT_OR_RETURN_VALUE((1U + chain_length(remaining)) <= available(), ETL_ERROR(radix_tree_full), false);
+
+          const uint16_t split = split_node(n, child, matched);
+
+          if (remaining == 0U)
+          {
+            set_value(split, value);
+          }
+          else
+          {
+            add_chain(split, key + pos + matched, remaining, value);
+          }
+
+          return true;
+        }
+
+        n    = child;
+        pos += matched;
+      }
+
+      if (p_nodes[n].has_value)
+      {
+        return false;
+      }
+
+      set_value(n, value);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases a key.
+    ///\return The number of keys erased. 0 or 1.
+    //*************************************************************************
+    size_t erase(etl::string_view key)
+    {
+      return erase(reinterpret_cast<const uint8_t*>(key.data()), key.size());
+    }
+
+    //*************************************************************************
+    /// Erases a byte key.
+    ///\return The number of keys erased. 0 or 1.
+    //*************************************************************************
+    size_t erase(const uint8_t* key, size_t length)
+    {
+      // The last node on the path that must be kept, and its child on the path.
+      uint16_t keep = Root;
+      uint16_t cut  = Npos;
+
+      uint16_t n   = Root;
+      size_t   pos = 0U;
+
+      while (pos != length)
+      {
+        const uint16_t child = find_child(n, key[pos]);
+
+        if ((child == Npos) || (match(child, key + pos, length - pos) != p_nodes[child].length))
+        {
+          return 0U;
+        }
+
+        if ((n == Root) || p_nodes[n].has_value || (p_nodes[n].child != child) || (p_nodes[child].sibling != Npos))
+        {
+          keep = n;
+          cut  = child;
+        }
+
+        n    = child;
+        pos += p_nodes[child].length;
+      }
+
+      if (!p_nodes[n].has_value)
+      {
+        return 0U;
+      }
+
+      clear_value(n);
+
+      if (n != Root)
+      {
+        if (p_nodes[n].child == Npos)
+        {
+          // Remove the leaf and the chain of nodes without values above it.
+          unlink_child(keep, cut);
+
+          while (cut != Npos)
+          {
+            const uint16_t next = p_nodes[cut].child;
+            free_node(cut);
+            cut = next;
+          }
+
+          if (keep != Root)
+          {
+            merge_with_only_child(keep);
+          }
+        }
+        else
+        {
+          merge_with_only_child(n);
+        }
+      }
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Finds the value for a key.
+    ///\return A pointer to the value, or ETL_NULLPTR if the key is not in the tree.
+    //*************************************************************************
+    mapped_pointer find(etl::string_view key)
+    {
+      return const_cast<mapped_pointer>(static_cast<const iradix_tree&>(*this).find(key));
+    }
+
+    //*************************************************************************
+    /// Finds the value for a key.
+    ///\return A pointer to the value, or ETL_NULLPTR if the key is not in the tree.
+    //*************************************************************************
+    const_mapped_pointer find(etl::string_view key) const
+    {
+      return find(reinterpret_cast<const uint8_t*>(key.data()), key.size());
+    }
+
+    //*************************************************************************
+    /// Finds the value for a byte key.
+    ///\return A pointer to the value, or ETL_NULLPTR if the key is not in the tree.
+    //*************************************************************************
+    mapped_pointer find(const uint8_t* key, size_t length)
+    {
+      return const_cast<mapped_pointer>(static_cast<const iradix_tree&>(*this).find(key, length));
+    }
+
+    //*************************************************************************
+    /// Finds the value for a byte key.
+    ///\return A pointer to the value, or ETL_NULLPTR if the key is not in the tree.
+    //*************************************************************************
+    const_mapped_pointer find(const uint8_t* key, size_t length) const
+    {
+      const uint16_t n = find_node(key, length);
+
+      return ((n != Npos) && p_nodes[n].has_value) ? p_values + n : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks if a key is in the tree.
+    //*************************************************************************
+    bool contains(etl::string_view key) const
+    {
+      return find(key) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks if a byte key is in the tree.
+    //*************************************************************************
+    bool contains(const uint8_t* key, size_t length) const
+    {
+      return find(key, length) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Gets the value for a key.
+    /// If asserts or exceptions are enabled, emits radix_tree_out_of_bounds
+    /// if the key is not in the tree.
+    //*************************************************************************
+    mapped_reference at(etl::string_view key)
+    {
+      mapped_pointer p = find(key);
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(radix_tree_out_of_bounds));
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Gets the value for a key.
+    /// If asserts or exceptions are enabled, emits radix_tree_out_of_bounds
+    /// if the key is not in the tree.
+    //*************************************************************************
+    const_mapped_reference at(etl::string_view key) const
+    {
+      const_mapped_pointer p = find(key);
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(radix_tree_out_of_bounds));
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Finds the value for the longest key in the tree that is a prefix of 'key'.
+    ///\return A pointer to the value, or ETL_NULLPTR if no key is a prefix.
+    //*************************************************************************
+    const_mapped_pointer longest_match(etl::string_view key) const
+    {
+      size_t matched_length;
+
+      return longest_match(reinterpret_cast<const uint8_t*>(key.data()), key.size(), matched_length);
+    }
+
+    //*************************************************************************
+    /// Finds the value for the longest key in the tree that is a prefix of 'key'.
+    ///\param matched_length Set to the length of the matching key.
+    ///\return A pointer to the value, or ETL_NULLPTR if no key is a prefix.
+    //*************************************************************************
+    const_mapped_pointer longest_match(etl::string_view key, size_t& matched_length) const
+    {
+      return longest_match(reinterpret_cast<const uint8_t*>(key.data()), key.size(), matched_length);
+    }
+
+    //*************************************************************************
+    /// Finds the value for the longest key in the tree that is a prefix of
+    /// the byte key.
+    ///\param matched_length Set to the length of the matching key.
+    ///\return A pointer to the value, or ETL_NULLPTR if no key is a prefix.
+    //*************************************************************************
+    const_mapped_pointer longest_match(const uint8_t* key, size_t length, size_t& matched_length) const
+    {
+      const_mapped_pointer result = p_nodes[Root].has_value ? p_values + Root : ETL_NULLPTR;
+      matched_length = 0U;
+
+      uint16_t n   = Root;
+      size_t   pos = 0U;
+
+      while (pos != length)
+      {
+        const uint16_t child = find_child(n, key[pos]);
+
+        if ((child == Npos) || (match(child, key + pos, length - pos) != p_nodes[child].length))
+        {
+          break;
+        }
+
+        n    = child;
+        pos += p_nodes[child].length;
+
+        if (p_nodes[n].has_value)
+        {
+          result         = p_values + n;
+          matched_length = pos;
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with the value of each key that starts with 'prefix',
+    /// in key order.
+    ///\return The number of keys found.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_with_prefix(etl::string_view prefix, TFunction function) const
+    {
+      return for_each_with_prefix(reinterpret_cast<const uint8_t*>(prefix.data()), prefix.size(), function);
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with the value of each key that starts with the byte
+    /// prefix, in key order.
+    ///\return The number of keys found.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_with_prefix(const uint8_t* prefix, size_t length, TFunction function) const
+    {
+      uint16_t n   = Root;
+      size_t   pos = 0U;
+
+      while (pos != length)
+      {
+        const uint16_t child = find_child(n, prefix[pos]);
+
+        if (child == Npos)
+        {
+          return 0U;
+        }
+
+        const size_t matched = match(child, prefix + pos, length - pos);
+
+        // The prefix must match the label, or end within it.
+        if ((matched != p_nodes[child].length) && (matched != (length - pos)))
+        {
+          return 0U;
+        }
+
+        n    = child;
+        pos += matched;
+      }
+
+      return visit(n, function);
+    }
+
+    //*************************************************************************
+    /// Clears the tree.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        if (p_nodes[i].has_value)
+        {
+          clear_value(uint16_t(i));
+        }
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Gets the number of keys.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the tree is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if all of the nodes are in use.
+    /// A key may still be added if it ends at an existing node.
+    //*************************************************************************
+    bool full() const
+    {
+      return free_nodes == 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the number of free nodes.
+    //*************************************************************************
+    size_type available() const
+    {
+      return free_nodes;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of nodes, not including the root.
+    //*************************************************************************
+    size_type max_nodes() const
+    {
+      return CAPACITY - 1U;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of bytes in each node.
+    //*************************************************************************
+    size_type label_size() const
+    {
+      return LABEL_SIZE;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iradix_tree& operator =(const iradix_tree& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    typedef private_radix_tree::node node_t;
+
+    static ETL_CONSTANT uint16_t Npos = 0xFFFFU;
+    static ETL_CONSTANT uint16_t Root = 0U;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_nodes_    The nodes, including the root.
+    ///\param p_labels_   The label bytes, label_size_ per node.
+    ///\param p_values_   The value storage, one per node.
+    ///\param capacity_   The number of nodes, including the root.
+    ///\param label_size_ The maximum label length.
+    //*************************************************************************
+    iradix_tree(node_t* p_nodes_, uint8_t* p_labels_, mapped_type* p_values_, size_t capacity_, size_t label_size_)
+      : p_nodes(p_nodes_)
+      , p_labels(p_labels_)
+      , p_values(p_values_)
+      , CAPACITY(capacity_)
+      , LABEL_SIZE(label_size_)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Copies another tree with the same number of nodes and label size.
+    //*************************************************************************
+    void copy_from(const iradix_tree& other)
+    {
+      clear();
+
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_nodes[i]           = other.p_nodes[i];
+        p_nodes[i].has_value = false;
+
+        if (other.p_nodes[i].has_value)
+        {
+          set_value(uint16_t(i), other.p_values[i]);
+        }
+      }
+
+      etl::copy_n(other.p_labels, CAPACITY * LABEL_SIZE, p_labels);
+
+      free_list  = other.free_list;
+      free_nodes = other.free_nodes;
+    }
+
+  private:
+
+    // Disable copy construction.
+    iradix_tree(const iradix_tree&);
+
+    //*************************************************************************
+    /// Makes an empty tree.
+    //*************************************************************************
+    void initialise()
+    {
+      p_nodes[Root].child     = Npos;
+      p_nodes[Root].sibling   = Npos;
+      p_nodes[Root].length    = 0U;
+      p_nodes[Root].has_value = false;
+
+      free_list = Npos;
+
+      for (size_t i = CAPACITY - 1U; i > 0U; --i)
+      {
+        p_nodes[i].has_value = false;
+        p_nodes[i].sibling   = free_list;
+        free_list            = uint16_t(i);
+      }
+
+      free_nodes   = CAPACITY - 1U;
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// The label of a node.
+    //*************************************************************************
+    uint8_t* label(uint16_t n) const
+    {
+      return p_labels + (size_t(n) * LABEL_SIZE);
+    }
+
+    //*************************************************************************
+    /// The number of nodes needed for a run of key bytes.
+    //*************************************************************************
+    size_t chain_length(size_t length) const
+    {
+      return (length + LABEL_SIZE - 1U) / LABEL_SIZE;
+    }
+
+    //*************************************************************************
+    /// The child of a node whose label starts with 'byte', or Npos.
+    //*************************************************************************
+    uint16_t find_child(uint16_t n, uint8_t byte) const
+    {
+      uint16_t child = p_nodes[n].child;
+
+      while ((child != Npos) && (label(child)[0] < byte))
+      {
+        child = p_nodes[child].sibling;
+      }
+
+      return ((child != Npos) && (label(child)[0] == byte)) ? child : Npos;
+    }
+
+    //*************************************************************************
+    /// The number of the node's label bytes that match the key.
+    //*************************************************************************
+    size_t match(uint16_t n, const uint8_t* key, size_t length) const
+    {
+      const uint8_t* p     = label(n);
+      const size_t   limit = (length < p_nodes[n].length) ? length : p_nodes[n].length;
+
+      size_t i = 0U;
+
+      while ((i < limit) && (p[i] == key[i]))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The node that the key ends at, or Npos.
+    //*************************************************************************
+    uint16_t find_node(const uint8_t* key, size_t length) const
+    {
+      uint16_t n   = Root;
+      size_t   pos = 0U;
+
+      while (pos != length)
+      {
+        const uint16_t child = find_child(n, key[pos]);
+
+        if ((child == Npos) || (match(child, key + pos, length - pos) != p_nodes[child].length))
+        {
+          return Npos;
+        }
+
+        n    = child;
+        pos += p_nodes[child].length;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Takes a node from the free list.
+    //*************************************************************************
+    uint16_t allocate_node()
+    {
+      const uint16_t n = free_list;
+
+      free_list = p_nodes[n].sibling;
+      --free_nodes;
+
+      p_nodes[n].child     = Npos;
+      p_nodes[n].sibling   = Npos;
+      p_nodes[n].length    = 0U;
+      p_nodes[n].has_value = false;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Returns a node to the free list.
+    //*************************************************************************
+    void free_node(uint16_t n)
+    {
+      p_nodes[n].sibling = free_list;
+      free_list          = n;
+      ++free_nodes;
+    }
+
+    //*************************************************************************
+    /// Adds a child to a node, in label order.
+    //*************************************************************************
+    void link_child(uint16_t parent, uint16_t child)
+    {
+      const uint8_t byte = label(child)[0];
+
+      uint16_t* p_link = &p_nodes[parent].child;
+
+      while ((*p_link != Npos) && (label(*p_link)[0] < byte))
+      {
+        p_link = &p_nodes[*p_link].sibling;
+      }
+
+      p_nodes[child].sibling = *p_link;
+      *p_link                = child;
+    }
+
+    //*************************************************************************
+    /// Removes a child from a node.
+    //*************************************************************************
+    void unlink_child(uint16_t parent, uint16_t child)
+    {
+      uint16_t* p_link = &p_nodes[parent].child;
+
+      while (*p_link != child)
+      {
+        p_link = &p_nodes[*p_link].sibling;
+      }
+
+      *p_link = p_nodes[child].sibling;
+    }
+
+    //*************************************************************************
+    /// Adds a chain of nodes below 'parent' for the key bytes, with the value
+    /// at the end. There must be enough free nodes.
+    //*************************************************************************
+    void add_chain(uint16_t parent, const uint8_t* key, size_t length, const_mapped_reference value)
+    {
+      bool first = true;
+
+      while (length != 0U)
+      {
+        const uint16_t n     = allocate_node();
+        const size_t   count = (length < LABEL_SIZE) ? length : LABEL_SIZE;
+
+        etl::copy_n(key, count, label(n));
+        p_nodes[n].length = uint8_t(count);
+
+        if (first)
+        {
+          link_child(parent, n);
+          first = false;
+        }
+        else
+        {
+          p_nodes[parent].child = n;
+        }
+
+        parent  = n;
+        key    += count;
+        length -= count;
+      }
+
+      set_value(parent, value);
+    }
+
+    //*************************************************************************
+    /// Splits a child's label after 'count' bytes.
+    /// There must be a free node.
+    ///\return The new node, holding the first part of the label.
+    //*************************************************************************
+    uint16_t split_node(uint16_t parent, uint16_t child, size_t count)
+    {
+      const uint16_t split = allocate_node();
+
+      // The new node takes the child's place in the parent's list.
+      uint16_t* p_link = &p_nodes[parent].child;
+
+      while (*p_link != child)
+      {
+        p_link = &p_nodes[*p_link].sibling;
+      }
+
+      *p_link                = split;
+      p_nodes[split].sibling = p_nodes[child].sibling;
+      p_nodes[split].child   = child;
+      p_nodes[child].sibling = Npos;
+
+      uint8_t* p_child = label(child);
+
+      etl::copy_n(p_child, count, label(split));
+      p_nodes[split].length = uint8_t(count);
+
+      etl::copy(p_child + count, p_child + p_nodes[child].length, p_child);
+      p_nodes[child].length = uint8_t(p_nodes[child].length - count);
+
+      return split;
+    }
+
+    //*************************************************************************
+    /// Joins a node without a value to its only child, if the labels fit in
+    /// one node.
+    //*************************************************************************
+    void merge_with_only_child(uint16_t n)
+    {
+      const uint16_t child = p_nodes[n].child;
+
+      if ((child == Npos) || (p_nodes[child].sibling != Npos) || p_nodes[n].has_value ||
+          ((size_t(p_nodes[n].length) + p_nodes[child].length) > LABEL_SIZE))
+      {
+        return;
+      }
+
+      etl::copy_n(label(child), p_nodes[child].length, label(n) + p_nodes[n].length);
+      p_nodes[n].length = uint8_t(p_nodes[n].length + p_nodes[child].length);
+      p_nodes[n].child  = p_nodes[child].child;
+
+      if (p_nodes[child].has_value)
+      {
+        set_value(n, p_values[child]);
+        clear_value(child);
+      }
+
+      free_node(child);
+    }
+
+    //*************************************************************************
+    /// Stores a value at a node.
+    //*************************************************************************
+    void set_value(uint16_t n, const_mapped_reference value)
+    {
+      ::new (p_values + n) mapped_type(value);
+      p_nodes[n].has_value = true;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Destroys the value at a node.
+    //*************************************************************************
+    void clear_value(uint16_t n)
+    {
+      p_values[n].~mapped_type();
+      p_nodes[n].has_value = false;
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with the values in the subtree at a node.
+    /// Recurses once per level, so the depth is bounded by the longest key.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t visit(uint16_t n, TFunction& function) const
+    {
+      size_t count = 0U;
+
+      if (p_nodes[n].has_value)
+      {
+        function(p_values[n]);
+        ++count;
+      }
+
+      for (uint16_t child = p_nodes[n].child; child != Npos; child = p_nodes[child].sibling)
+      {
+        count += visit(child, function);
+      }
+
+      return count;
+    }
+
+    node_t*         p_nodes;
+    uint8_t*        p_labels;
+    mapped_type*    p_values;
+    uint16_t        free_list;
+    size_type       free_nodes;
+    size_type       current_size;
+    const size_type CAPACITY;
+    const size_type LABEL_SIZE;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_RADIX_TREE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iradix_tree()
+    {
+    }
+#else
+  protected:
+    ~iradix_tree()
+    {
+    }
+#endif
+  };
+
+  template <typename TMapped>
+  ETL_CONSTANT uint16_t iradix_tree<TMapped>::Npos;
+
+  template <typename TMapped>
+  ETL_CONSTANT uint16_t iradix_tree<TMapped>::Root;
+
+  //***************************************************************************
+  /// A radix_tree implementation that uses fixed size buffers.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam MAX_NODES_  The maximum number of nodes, not including the root.
+  ///                    A tree of N keys with short labels needs at most 2N nodes.
+  ///\tparam LABEL_SIZE_ The maximum number of key bytes held in each node.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  template <typename TMapped, const size_t MAX_NODES_, const size_t LABEL_SIZE_ = 8U>
+  class radix_tree : public etl::iradix_tree<TMapped>
+  {
+  private:
+
+    typedef etl::iradix_tree<TMapped> base;
+
+    ETL_STATIC_ASSERT(MAX_NODES_ < 0xFFFFU, "radix_tree: too many nodes");
+    ETL_STATIC_ASSERT((LABEL_SIZE_ > 0U) && (LABEL_SIZE_ <= 255U), "radix_tree: label size must be 1 to 255");
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_NODES  = MAX_NODES_;
+    static ETL_CONSTANT size_t LABEL_SIZE = LABEL_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    radix_tree()
+      : base(nodes, labels, reinterpret_cast<TMapped*>(&values), MAX_NODES + 1U, LABEL_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    radix_tree(const radix_tree& other)
+      : base(nodes, labels, reinterpret_cast<TMapped*>(&values), MAX_NODES + 1U, LABEL_SIZE)
+    {
+      this->copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~radix_tree()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    radix_tree& operator = (const radix_tree& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    typename base::node_t nodes[MAX_NODES_ + 1U];
+    uint8_t               labels[(MAX_NODES_ + 1U) * LABEL_SIZE_];
+
+    /// The values, indexed by node.
+    typename etl::aligned_storage<sizeof(TMapped) * (MAX_NODES_ + 1U), etl::alignment_of<TMapped>::value>::type values;
+  };
+
+  template <typename TMapped, const size_t MAX_NODES_, const size_t LABEL_SIZE_>
+  ETL_CONSTANT size_t radix_tree<TMapped, MAX_NODES_, LABEL_SIZE_>::MAX_NODES;
+
+  template <typename TMapped, const size_t MAX_NODES_, const size_t LABEL_SIZE_>
+  ETL_CONSTANT size_t radix_tree<TMapped, MAX_NODES_, LABEL_SIZE_>::LABEL_SIZE;
+}
+
+#endif
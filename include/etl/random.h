@@ -33,6 +33,8 @@ SOFTWARE.
 
 #include "platform.h"
 #include "binary.h"
+#include "span.h"
+#include "static_assert.h"
 
 #include <stdint.h>
 
@@ -72,6 +74,16 @@ namespace etl
   };
 #endif
 
+  //***************************************************************************
+  /// Converts a random number to a uniform float in the range [0, 1).
+  /// Uses the top 24 bits, which a float holds exactly, and a multiply
+  /// rather than a divide.
+  //***************************************************************************
+  inline float random_to_float(uint32_t n)
+  {
+    return static_cast<float>(n >> 8U) * (1.0f / 16777216.0f);
+  }
+
   //***************************************************************************
   /// A 32 bit random number generator.
   /// Uses a 128 bit XOR shift algorithm.
@@ -147,8 +159,118 @@ namespace etl
         return n;
       }
 
+      //***************************************************************************
+      /// Advances the sequence by n steps, in O(log n) time.
+      /// The generator is linear, so n steps are found as a polynomial,
+      /// x^n modulo the generator's characteristic polynomial.
+      //***************************************************************************
+      void discard(uintmax_t n)
+      {
+        uint32_t result[4] = { 1U, 0U, 0U, 0U }; // 1
+        uint32_t power[4]  = { 2U, 0U, 0U, 0U }; // x
+
+        while (n != 0U)
+        {
+          if ((n & 1U) != 0U)
+          {
+            multiply_modulo(result, power, result);
+          }
+
+          multiply_modulo(power, power, power);
+          n >>= 1U;
+        }
+
+        apply_jump(result);
+      }
+
+      //***************************************************************************
+      /// Advances the sequence by 2^64 steps.
+      /// Starting from one seed, each call gives the start of a stream that does
+      /// not overlap the previous one for 2^64 values.
+      //***************************************************************************
+      void jump()
+      {
+        // x^(2^64) modulo the characteristic polynomial.
+        static const uint32_t jump_64[4] = { 0x35AAC71CUL, 0x821E5343UL, 0xF52E65C4UL, 0xD8CD644EUL };
+
+        apply_jump(jump_64);
+      }
+
     private:
 
+      //***************************************************************************
+      /// result = lhs * rhs modulo the characteristic polynomial, over GF(2).
+      /// The polynomials are 128 bit, least significant word first.
+      //***************************************************************************
+      static void multiply_modulo(const uint32_t lhs[4], const uint32_t rhs[4], uint32_t result[4])
+      {
+        // The characteristic polynomial, less its x^128 term.
+        static const uint32_t characteristic[4] = { 0xFD3C8001UL, 0xF985D65FUL, 0x0046D8B3UL, 0x00000001UL };
+
+        uint32_t a[4]   = { lhs[0], lhs[1], lhs[2], lhs[3] };
+        uint32_t b[4]   = { rhs[0], rhs[1], rhs[2], rhs[3] };
+        uint32_t acc[4] = { 0U, 0U, 0U, 0U };
+
+        for (size_t bit = 0U; bit < 128U; ++bit)
+        {
+          if (((b[bit / 32U] >> (bit % 32U)) & 1U) != 0U)
+          {
+            for (size_t i = 0U; i < 4U; ++i)
+            {
+              acc[i] ^= a[i];
+            }
+          }
+
+          // a *= x
+          const uint32_t overflow = a[3] >> 31U;
+
+          a[3] = (a[3] << 1U) | (a[2] >> 31U);
+          a[2] = (a[2] << 1U) | (a[1] >> 31U);
+          a[1] = (a[1] << 1U) | (a[0] >> 31U);
+          a[0] = (a[0] << 1U);
+
+          if (overflow != 0U)
+          {
+            for (size_t i = 0U; i < 4U; ++i)
+            {
+              a[i] ^= characteristic[i];
+            }
+          }
+        }
+
+        for (size_t i = 0U; i < 4U; ++i)
+        {
+          result[i] = acc[i];
+        }
+      }
+
+      //***************************************************************************
+      /// Replaces the state by the sum of the states after i steps, for each
+      /// term x^i of the jump polynomial.
+      //***************************************************************************
+      void apply_jump(const uint32_t polynomial[4])
+      {
+        uint32_t acc[4] = { 0U, 0U, 0U, 0U };
+
+        for (size_t bit = 0U; bit < 128U; ++bit)
+        {
+          if (((polynomial[bit / 32U] >> (bit % 32U)) & 1U) != 0U)
+          {
+            for (size_t i = 0U; i < 4U; ++i)
+            {
+              acc[i] ^= state[i];
+            }
+          }
+
+          operator()();
+        }
+
+        for (size_t i = 0U; i < 4U; ++i)
+        {
+          state[i] = acc[i];
+        }
+      }
+
       uint32_t state[4];
   };
 
@@ -198,7 +320,12 @@ namespace etl
     //***************************************************************************
     uint32_t operator()()
     {
-      value = (a * value) % m;
+      // Schrage's method, as a * value overflows 32 bits.
+      const int32_t lo = static_cast<int32_t>(a * (value % q));
+      const int32_t hi = static_cast<int32_t>(r * (value / q));
+      const int32_t n  = lo - hi;
+
+      value = static_cast<uint32_t>((n < 0) ? (n + static_cast<int32_t>(m)) : n);
 
       return value;
     }
@@ -216,10 +343,37 @@ namespace etl
       return n;
     }
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Advances the sequence by n steps, in O(log n) time.
+    /// value = value * a^n mod m.
+    //***************************************************************************
+    void discard(uintmax_t n)
+    {
+      uint64_t result = 1U;
+      uint64_t power  = a;
+
+      while (n != 0U)
+      {
+        if ((n & 1U) != 0U)
+        {
+          result = (result * power) % m;
+        }
+
+        power = (power * power) % m;
+        n >>= 1U;
+      }
+
+      value = static_cast<uint32_t>((result * value) % m);
+    }
+#endif
+
   private:
 
     static ETL_CONSTANT uint32_t a = 40014U;
     static ETL_CONSTANT uint32_t m = 2147483563UL;
+    static ETL_CONSTANT uint32_t q = m / a;
+    static ETL_CONSTANT uint32_t r = m % a;
 
     uint32_t value;
   };
@@ -514,6 +668,33 @@ namespace etl
       return n;
     }
 
+    //***************************************************************************
+    /// Advances the sequence by n steps, in O(log n) time.
+    /// Composes the affine step value * multiplier + increment with itself.
+    //***************************************************************************
+    void discard(uintmax_t n)
+    {
+      uint64_t accumulated_multiplier = 1U;
+      uint64_t accumulated_increment  = 0U;
+      uint64_t step_multiplier        = multiplier;
+      uint64_t step_increment         = increment;
+
+      while (n != 0U)
+      {
+        if ((n & 1U) != 0U)
+        {
+          accumulated_multiplier *= step_multiplier;
+          accumulated_increment   = (accumulated_increment * step_multiplier) + step_increment;
+        }
+
+        step_increment  = (step_multiplier + 1U) * step_increment;
+        step_multiplier *= step_multiplier;
+        n >>= 1U;
+      }
+
+      value = (accumulated_multiplier * value) + accumulated_increment;
+    }
+
   private:
 
     static ETL_CONSTANT uint64_t multiplier = 6364136223846793005ULL;
@@ -589,6 +770,336 @@ namespace etl
     uint8_t value;
   };
 #endif
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// A 32 bit random number generator.
+  /// Uses the xoshiro256** algorithm, with 256 bits of state.
+  /// next64() returns the full 64 bit result.
+  /// https://prng.di.unimi.it/
+  //***************************************************************************
+  class random_xoshiro256ss : public random
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique non-zero seed.
+    //***************************************************************************
+    random_xoshiro256ss()
+    {
+      // An attempt to come up with a unique non-zero seed,
+      // based on the address of the instance.
+      uintptr_t n    = reinterpret_cast<uintptr_t>(this);
+      uint32_t  seed = static_cast<uint32_t>(n);
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xoshiro256ss(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The state is filled from the seed by splitmix64, so is never all zero.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      uint64_t x = seed;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        x += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = x;
+        z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+        state[i] = z ^ (z >> 31U);
+      }
+    }
+
+    //***************************************************************************
+    /// Get the next 64 bit random number.
+    //***************************************************************************
+    uint64_t next64()
+    {
+      const uint64_t result = etl::rotate_left(state[1] * 5U, 7U) * 9U;
+      const uint64_t t      = state[1] << 17U;
+
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= t;
+      state[3]  = etl::rotate_left(state[3], 45U);
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    /// The upper 32 bits of the 64 bit result, which are the best.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return static_cast<uint32_t>(next64() >> 32U);
+    }
+
+    //***************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      uint32_t r = high - low + 1UL;
+      uint32_t n = operator()();
+      n %= r;
+      n += low;
+
+      return n;
+    }
+
+  private:
+
+    uint64_t state[4];
+  };
+#endif
+
+  //***************************************************************************
+  /// A 32 bit random number generator.
+  /// Runs several independent 128 bit XOR shift generators side by side.
+  /// The state is held as one array per word, so that a block of one value per
+  /// lane is a loop that compilers turn into SIMD instructions.
+  /// Values come out in lane order, a block at a time.
+  /// Use fill() to generate many values at once.
+  ///\tparam Lanes The number of generators. 4 or 8 suit most SIMD units.
+  //***************************************************************************
+  template <size_t Lanes = 8U>
+  class random_xorshift_lanes : public random
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Lanes > 0U, "At least one lane is required");
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique non-zero seed.
+    //***************************************************************************
+    random_xorshift_lanes()
+    {
+      // An attempt to come up with a unique non-zero seed,
+      // based on the address of the instance.
+      uintptr_t n    = reinterpret_cast<uintptr_t>(this);
+      uint32_t  seed = static_cast<uint32_t>(n);
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xorshift_lanes(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// Each lane's state is a different hash of the seed, and is never zero.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      uint32_t x = seed;
+
+      for (size_t lane = 0U; lane < Lanes; ++lane)
+      {
+        s0[lane] = mix(x);
+        s1[lane] = mix(x);
+        s2[lane] = mix(x);
+        s3[lane] = mix(x) | 1U;
+      }
+
+      index = Lanes;
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      if (index == Lanes)
+      {
+        next_block(buffer);
+        index = 0U;
+      }
+
+      return buffer[index++];
+    }
+
+    //***************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      uint32_t r = high - low + 1UL;
+      uint32_t n = operator()();
+      n %= r;
+      n += low;
+
+      return n;
+    }
+
+    //***************************************************************************
+    /// Fills the span with random numbers.
+    /// Gives the same values as repeated calls to operator().
+    //***************************************************************************
+    void fill(etl::span<uint32_t> destination)
+    {
+      uint32_t* p_out  = destination.data();
+      size_t    length = destination.size();
+
+      // Use up what is left of the last block.
+      while ((length != 0U) && (index != Lanes))
+      {
+        *p_out++ = buffer[index++];
+        --length;
+      }
+
+      // Whole blocks go straight to the destination.
+      while (length >= Lanes)
+      {
+        next_block(p_out);
+        p_out  += Lanes;
+        length -= Lanes;
+      }
+
+      while (length != 0U)
+      {
+        *p_out++ = operator()();
+        --length;
+      }
+    }
+
+    //***************************************************************************
+    /// Fills the span with uniform random floats in the range [0, 1).
+    //***************************************************************************
+    void fill(etl::span<float> destination)
+    {
+      float* p_out  = destination.data();
+      size_t length = destination.size();
+
+      uint32_t block[Lanes];
+
+      while (length >= Lanes)
+      {
+        next_block(block);
+
+        for (size_t lane = 0U; lane < Lanes; ++lane)
+        {
+          p_out[lane] = etl::random_to_float(block[lane]);
+        }
+
+        p_out  += Lanes;
+        length -= Lanes;
+      }
+
+      while (length != 0U)
+      {
+        *p_out++ = etl::random_to_float(operator()());
+        --length;
+      }
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Generates one value per lane.
+    //***************************************************************************
+    void next_block(uint32_t* p_out)
+    {
+      for (size_t lane = 0U; lane < Lanes; ++lane)
+      {
+        uint32_t t = s3[lane];
+        t ^= t << 11U;
+        t ^= t >> 8U;
+        s3[lane] = s2[lane];
+        s2[lane] = s1[lane];
+        s1[lane] = s0[lane];
+        t ^= s0[lane];
+        t ^= s0[lane] >> 19U;
+        s0[lane] = t;
+
+        p_out[lane] = t;
+      }
+    }
+
+    //***************************************************************************
+    /// A step of a 32 bit splitmix style sequence, for seeding.
+    //***************************************************************************
+    static uint32_t mix(uint32_t& x)
+    {
+      x += 0x9E3779B9UL;
+      uint32_t z = x;
+      z = (z ^ (z >> 16U)) * 0x85EBCA6BUL;
+      z = (z ^ (z >> 13U)) * 0xC2B2AE35UL;
+
+      return z ^ (z >> 16U);
+    }
+
+    uint32_t s0[Lanes];
+    uint32_t s1[Lanes];
+    uint32_t s2[Lanes];
+    uint32_t s3[Lanes];
+    uint32_t buffer[Lanes];
+    size_t   index;
+  };
+
+  //***************************************************************************
+  /// Fills the span with random numbers from the generator.
+  //***************************************************************************
+  template <typename TGenerator>
+  void random_fill(TGenerator& generator, etl::span<uint32_t> destination)
+  {
+    for (size_t i = 0U; i < destination.size(); ++i)
+    {
+      destination[i] = generator();
+    }
+  }
+
+  //***************************************************************************
+  /// Fills the span with uniform random floats in the range [0, 1).
+  //***************************************************************************
+  template <typename TGenerator>
+  void random_fill(TGenerator& generator, etl::span<float> destination)
+  {
+    for (size_t i = 0U; i < destination.size(); ++i)
+    {
+      destination[i] = etl::random_to_float(generator());
+    }
+  }
+
+  //***************************************************************************
+  /// Fills the span with random numbers, a block at a time.
+  //***************************************************************************
+  template <size_t Lanes>
+  void random_fill(etl::random_xorshift_lanes<Lanes>& generator, etl::span<uint32_t> destination)
+  {
+    generator.fill(destination);
+  }
+
+  //***************************************************************************
+  /// Fills the span with uniform random floats in the range [0, 1), a block at a time.
+  //***************************************************************************
+  template <size_t Lanes>
+  void random_fill(etl::random_xorshift_lanes<Lanes>& generator, etl::span<float> destination)
+  {
+    generator.fill(destination);
+  }
 }
 
 #endif
@@ -0,0 +1,331 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RATE_LIMITER_INCLUDED
+#define ETL_RATE_LIMITER_INCLUDED
+
+#include "platform.h"
+#include "circular_buffer.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stdint.h>
+
+///\defgroup rate_limiter rate limiter
+/// Limits the rate of events, such as received messages.
+/// Time is a free running tick count, in the same units as the counts passed
+/// to the timers' tick(). It may wrap. A limiter is updated only when it is
+/// used, so thousands of them cost nothing between events.
+/// Each limiter must be used from one context at a time.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// A token bucket.
+  /// Holds up to 'capacity' tokens. 'tokens_per_refill' are added every
+  /// 'ticks_per_refill' ticks. An event that takes tokens is allowed only if
+  /// enough are available, which allows bursts of up to 'capacity'.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  class token_bucket
+  {
+  public:
+
+    typedef uint32_t tick_type;
+
+    //*************************************************************************
+    /// Constructor. Starts full.
+    ///\param capacity_          The maximum number of tokens.
+    ///\param tokens_per_refill_ The tokens added each refill period.
+    ///\param ticks_per_refill_  The length of the refill period. Must not be zero.
+    ///\param now                The current tick count.
+    //*************************************************************************
+    token_bucket(uint32_t capacity_, uint32_t tokens_per_refill_, tick_type ticks_per_refill_, tick_type now)
+      : capacity(capacity_)
+      , tokens_per_refill(tokens_per_refill_)
+      , ticks_per_refill(ticks_per_refill_)
+      , tokens(capacity_)
+      , last_refill(now)
+    {
+    }
+
+    //*************************************************************************
+    /// Takes 'count' tokens, if they are available.
+    ///\return <b>true</b> if the event is allowed.
+    //*************************************************************************
+    bool try_acquire(tick_type now, uint32_t count = 1U)
+    {
+      refill(now);
+
+      if (tokens < count)
+      {
+        return false;
+      }
+
+      tokens -= count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the number of tokens available.
+    //*************************************************************************
+    uint32_t available(tick_type now)
+    {
+      refill(now);
+
+      return tokens;
+    }
+
+    //*************************************************************************
+    /// Gets the number of ticks until 'count' tokens will be available.
+    /// Returns etl::integral_limits<tick_type>::max if 'count' is more than
+    /// the capacity or no tokens are added.
+    //*************************************************************************
+    tick_type ticks_until(tick_type now, uint32_t count = 1U)
+    {
+      refill(now);
+
+      if (tokens >= count)
+      {
+        return 0U;
+      }
+
+      if ((count > capacity) || (tokens_per_refill == 0U))
+      {
+        return etl::integral_limits<tick_type>::max;
+      }
+
+      const uint32_t periods = ((count - tokens) + tokens_per_refill - 1U) / tokens_per_refill;
+
+      return (periods * ticks_per_refill) - (now - last_refill);
+    }
+
+    //*************************************************************************
+    /// Refills the bucket.
+    //*************************************************************************
+    void reset(tick_type now)
+    {
+      tokens      = capacity;
+      last_refill = now;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of tokens.
+    //*************************************************************************
+    uint32_t max_tokens() const
+    {
+      return capacity;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds the tokens for the whole refill periods since the last refill.
+    //*************************************************************************
+    void refill(tick_type now)
+    {
+      const tick_type elapsed = now - last_refill;
+      const uint32_t  periods = elapsed / ticks_per_refill;
+
+      if (periods == 0U)
+      {
+        return;
+      }
+
+      const uint32_t space = capacity - tokens;
+
+      if ((tokens_per_refill == 0U) || ((space / tokens_per_refill) < periods))
+      {
+        // Full. Credit for the time spent full is not kept.
+        tokens      = (tokens_per_refill == 0U) ? tokens : capacity;
+        last_refill = now;
+      }
+      else
+      {
+        // Keep the part period.
+        tokens      += periods * tokens_per_refill;
+        last_refill += periods * ticks_per_refill;
+      }
+    }
+
+    uint32_t  capacity;
+    uint32_t  tokens_per_refill;
+    tick_type ticks_per_refill;
+    uint32_t  tokens;
+    tick_type last_refill;
+  };
+
+  //***************************************************************************
+  /// A sliding window counter.
+  /// Counts the events in the last VBuckets buckets of 'ticks_per_bucket'
+  /// ticks, including the current one, and allows an event only if the count
+  /// would not pass 'limit'.
+  /// The window moves a bucket at a time, so the window is accurate to one
+  /// bucket.
+  ///\tparam VBuckets The number of buckets in the window.
+  ///\tparam TCount   The type of the counts.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  template <size_t VBuckets, typename TCount = uint16_t>
+  class sliding_window_counter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VBuckets > 0U, "sliding_window_counter: no buckets");
+    ETL_STATIC_ASSERT(etl::is_unsigned<TCount>::value, "sliding_window_counter: count must be unsigned");
+
+    typedef uint32_t tick_type;
+    typedef TCount   count_type;
+
+    static ETL_CONSTANT size_t Buckets = VBuckets;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param limit_            The maximum count in the window.
+    ///\param ticks_per_bucket_ The length of a bucket. Must not be zero.
+    ///\param now               The current tick count.
+    //*************************************************************************
+    sliding_window_counter(count_type limit_, tick_type ticks_per_bucket_, tick_type now)
+      : limit(limit_)
+      , ticks_per_bucket(ticks_per_bucket_)
+      , bucket_start(now)
+      , total(0U)
+    {
+      buckets.push(count_type(0U));
+    }
+
+    //*************************************************************************
+    /// Adds 'count' events, if the window has room for them.
+    ///\return <b>true</b> if the events are allowed.
+    //*************************************************************************
+    bool try_acquire(tick_type now, count_type count = 1U)
+    {
+      advance(now);
+
+      if (count > count_type(limit - total))
+      {
+        return false;
+      }
+
+      buckets.back() = count_type(buckets.back() + count);
+      total          = count_type(total + count);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the number of events in the window.
+    //*************************************************************************
+    count_type count(tick_type now)
+    {
+      advance(now);
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Gets the number of events that would be allowed now.
+    //*************************************************************************
+    count_type available(tick_type now)
+    {
+      advance(now);
+
+      return count_type(limit - total);
+    }
+
+    //*************************************************************************
+    /// Clears the window.
+    //*************************************************************************
+    void reset(tick_type now)
+    {
+      buckets.clear();
+      buckets.push(count_type(0U));
+      bucket_start = now;
+      total        = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum count in the window.
+    //*************************************************************************
+    count_type max_count() const
+    {
+      return limit;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Starts new buckets for the time since the current one started.
+    //*************************************************************************
+    void advance(tick_type now)
+    {
+      const uint32_t elapsed = (now - bucket_start) / ticks_per_bucket;
+
+      if (elapsed == 0U)
+      {
+        return;
+      }
+
+      if (elapsed >= VBuckets)
+      {
+        // The whole window has passed.
+        reset(now - ((now - bucket_start) % ticks_per_bucket));
+        return;
+      }
+
+      for (uint32_t i = 0U; i < elapsed; ++i)
+      {
+        if (buckets.full())
+        {
+          // The oldest bucket is about to leave the window.
+          total = count_type(total - buckets.front());
+        }
+
+        buckets.push(count_type(0U));
+      }
+
+      bucket_start += elapsed * ticks_per_bucket;
+    }
+
+    etl::circular_buffer<count_type, VBuckets> buckets;
+    count_type                                 limit;
+    tick_type                                  ticks_per_bucket;
+    tick_type                                  bucket_start;
+    count_type                                 total;
+  };
+
+  template <size_t VBuckets, typename TCount>
+  ETL_CONSTANT size_t sliding_window_counter<VBuckets, TCount>::Buckets;
+}
+
+#endif
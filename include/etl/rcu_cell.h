@@ -0,0 +1,318 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RCU_CELL_INCLUDED
+#define ETL_RCU_CELL_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "spin_mutex.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A read-copy-update cell.
+  /// Holds VN instances of T, such as a flat_map of calibration data, that are
+  /// read often and updated rarely. A single writer builds the next version in
+  /// a spare instance while readers continue to use the current one, then
+  /// publishes it with one atomic store. Readers never block or retry.
+  /// An instance is only reused after a grace period, in which all readers
+  /// that could have seen it have finished. Each reader registers with one of
+  /// two counters, selected by the epoch, which the writer flips and drains
+  /// twice per grace period.
+  /// With more than two instances, the writer may publish VN - 1 times before
+  /// it must wait for a grace period.
+  /// The writer waits for readers, so must not preempt them, for example from
+  /// an interrupt that a reader thread is interrupted by.
+  //***************************************************************************
+  template <typename T, size_t VN = 2U>
+  class rcu_cell
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VN >= 2U, "At least two instances are required");
+    ETL_STATIC_ASSERT(VN <= 32U, "At most 32 instances are supported");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t N = VN;
+
+    //*************************************************************************
+    /// Pins the current version for a reader.
+    /// The version will not be reused until the lock is destroyed.
+    /// Readers should hold the lock for as short a time as possible, as the
+    /// writer may be waiting for them.
+    //*************************************************************************
+    class read_lock
+    {
+    public:
+
+      //*******************************
+      explicit read_lock(const rcu_cell& cell_)
+        : cell(cell_)
+        , parity(cell_.epoch_count.load(etl::memory_order_relaxed) & 1U)
+      {
+        cell.reader_count[parity].fetch_add(1U, etl::memory_order_seq_cst);
+        p_value = &cell.instances[cell.current_index.load(etl::memory_order_seq_cst)];
+      }
+
+      //*******************************
+      ~read_lock()
+      {
+        cell.reader_count[parity].fetch_sub(1U, etl::memory_order_release);
+      }
+
+      //*******************************
+      const T& get() const
+      {
+        return *p_value;
+      }
+
+      //*******************************
+      const T& operator *() const
+      {
+        return *p_value;
+      }
+
+      //*******************************
+      const T* operator ->() const
+      {
+        return p_value;
+      }
+
+    private:
+
+      read_lock(const read_lock&) ETL_DELETE;
+      read_lock& operator =(const read_lock&) ETL_DELETE;
+
+      const rcu_cell& cell;
+      const uint32_t  parity;
+      const T*        p_value;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// The instances are value initialised.
+    //*************************************************************************
+    rcu_cell()
+      : instances()
+      , current_index(0U)
+      , epoch_count(0U)
+      , next_index(No_Index)
+      , retired(0U)
+    {
+      reader_count[0].store(0U, etl::memory_order_relaxed);
+      reader_count[1].store(0U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// The first version is a copy of 'value'.
+    //*************************************************************************
+    explicit rcu_cell(const T& value)
+      : instances()
+      , current_index(0U)
+      , epoch_count(0U)
+      , next_index(No_Index)
+      , retired(0U)
+    {
+      reader_count[0].store(0U, etl::memory_order_relaxed);
+      reader_count[1].store(0U, etl::memory_order_relaxed);
+
+      instances[0] = value;
+    }
+
+    //*************************************************************************
+    /// Starts an update.
+    /// Returns a spare instance, holding a copy of the current version, for
+    /// the writer to modify. Waits for a grace period if every spare instance
+    /// may still be in use by readers.
+    /// Writer only.
+    //*************************************************************************
+    T& begin_update()
+    {
+      T& next = begin_update_empty();
+
+      next = current();
+
+      return next;
+    }
+
+    //*************************************************************************
+    /// Starts an update.
+    /// Returns a spare instance, holding an earlier version, for the writer to
+    /// overwrite. Waits for a grace period if every spare instance may still
+    /// be in use by readers.
+    /// Writer only.
+    //*************************************************************************
+    T& begin_update_empty()
+    {
+      if (next_index == No_Index)
+      {
+        next_index = find_spare();
+
+        if (next_index == No_Index)
+        {
+          synchronize();
+          next_index = find_spare();
+        }
+      }
+
+      return instances[next_index];
+    }
+
+    //*************************************************************************
+    /// Publishes the instance returned by begin_update as the current version.
+    /// Does not wait for readers. The previous version is reused after the
+    /// next grace period.
+    /// Writer only.
+    //*************************************************************************
+    void publish()
+    {
+      if (next_index != No_Index)
+      {
+        const uint32_t previous = current_index.load(etl::memory_order_relaxed);
+
+        current_index.store(next_index, etl::memory_order_seq_cst);
+
+        retired   |= (1UL << previous);
+        next_index = No_Index;
+      }
+    }
+
+    //*************************************************************************
+    /// Abandons an update started by begin_update.
+    /// Writer only.
+    //*************************************************************************
+    void cancel_update()
+    {
+      next_index = No_Index;
+    }
+
+    //*************************************************************************
+    /// Replaces the current version with a copy of 'value'.
+    /// Writer only.
+    //*************************************************************************
+    void write(const T& value)
+    {
+      begin_update_empty() = value;
+      publish();
+    }
+
+    //*************************************************************************
+    /// Waits for a grace period, after which no reader is using a version
+    /// published before the call.
+    /// Writer only.
+    //*************************************************************************
+    void synchronize()
+    {
+      // A reader may read the epoch just before a flip and register after it,
+      // so the counters are flipped and drained twice.
+      for (int i = 0; i < 2; ++i)
+      {
+        const uint32_t epoch = epoch_count.load(etl::memory_order_relaxed);
+
+        epoch_count.store(epoch + 1U, etl::memory_order_seq_cst);
+
+        while (reader_count[epoch & 1U].load(etl::memory_order_seq_cst) != 0U)
+        {
+          ETL_SPIN_PAUSE();
+        }
+      }
+
+      retired = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the current version.
+    /// Writer only. Readers must use a read_lock.
+    //*************************************************************************
+    const T& current() const
+    {
+      return instances[current_index.load(etl::memory_order_relaxed)];
+    }
+
+    //*************************************************************************
+    /// The number of epoch flips so far. Advances by two per grace period.
+    //*************************************************************************
+    uint32_t epoch() const
+    {
+      return epoch_count.load(etl::memory_order_acquire);
+    }
+
+  private:
+
+    enum
+    {
+      No_Index = VN
+    };
+
+    //*************************************************************************
+    /// Finds an instance that is neither current nor retired since the last
+    /// grace period.
+    //*************************************************************************
+    uint32_t find_spare() const
+    {
+      const uint32_t current = current_index.load(etl::memory_order_relaxed);
+
+      for (uint32_t i = 0U; i < VN; ++i)
+      {
+        if ((i != current) && ((retired & (1UL << i)) == 0U))
+        {
+          return i;
+        }
+      }
+
+      return No_Index;
+    }
+
+    rcu_cell(const rcu_cell&) ETL_DELETE;
+    rcu_cell& operator =(const rcu_cell&) ETL_DELETE;
+
+    T                             instances[VN];
+    etl::atomic<uint32_t>         current_index;
+    etl::atomic<uint32_t>         epoch_count;
+    mutable etl::atomic<uint32_t> reader_count[2];
+    uint32_t                      next_index;
+    uint32_t                      retired;
+  };
+
+  template <typename T, size_t VN>
+  ETL_CONSTANT size_t rcu_cell<T, VN>::N;
+}
+
+#endif
+#endif
@@ -225,6 +225,24 @@ namespace etl
   template <typename TMessage>
   using atomic_counted_message = etl::reference_counted_message<TMessage, etl::atomic_int32_t>;
 #endif
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Class for creating reference counted messages using a plain counter.
+  /// For messages that are only shared within one thread.
+  /// \tparam TMessage The type to be reference counted.
+  //***************************************************************************
+  template <typename TMessage>
+  using non_atomic_counted_message = etl::reference_counted_message<TMessage, int32_t>;
+
+  //***************************************************************************
+  /// Class for creating reference counted messages using an interrupt masked counter.
+  /// \tparam TMessage The type to be reference counted.
+  /// \tparam TAccess  The interrupt control. See etl::interrupt_masked_counter.
+  //***************************************************************************
+  template <typename TMessage, typename TAccess>
+  using interrupt_masked_counted_message = etl::reference_counted_message<TMessage, etl::interrupt_masked_counter<TAccess> >;
+#endif
 }
 
 #endif
@@ -86,6 +86,11 @@ namespace etl
 
   //***************************************************************************
   /// A pool for allocating reference counted messages.
+  /// \tparam TCounter The counter used by each message.
+  ///                  An etl::atomic type when messages are shared between threads,
+  ///                  an integral type when they are only shared within one thread,
+  ///                  or etl::interrupt_masked_counter when they are shared with
+  ///                  interrupt handlers on a single core.
   //***************************************************************************
   template <typename TCounter>
   class reference_counted_message_pool : public etl::ireference_counted_message_pool
@@ -317,6 +322,24 @@ namespace etl
 #if ETL_USING_CPP11 && ETL_HAS_ATOMIC
   using  atomic_counted_message_pool = reference_counted_message_pool<etl::atomic_int>;
 #endif
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// A pool whose messages use a plain counter.
+  /// For shared messages that are only copied within one thread, such as on
+  /// single core targets where all routing is done from the main loop.
+  //***************************************************************************
+  using non_atomic_counted_message_pool = reference_counted_message_pool<int32_t>;
+
+  //***************************************************************************
+  /// A pool whose messages use an interrupt masked counter.
+  /// For shared messages that are also copied or released by interrupt
+  /// handlers on single core targets.
+  /// \tparam TAccess The interrupt control. See etl::interrupt_masked_counter.
+  //***************************************************************************
+  template <typename TAccess>
+  using interrupt_masked_counted_message_pool = reference_counted_message_pool<etl::interrupt_masked_counter<TAccess> >;
+#endif
 }
 
 #endif
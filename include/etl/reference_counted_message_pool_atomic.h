@@ -0,0 +1,183 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_REFERENCE_COUNTED_MESSAGE_POOL_ATOMIC_INCLUDED
+#define ETL_REFERENCE_COUNTED_MESSAGE_POOL_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "message.h"
+#include "pool_atomic.h"
+#include "ireference_counted_message_pool.h"
+#include "reference_counted_message.h"
+#include "reference_counted_message_pool.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "utility.h"
+#include "memory.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// A pool for allocating reference counted messages from any thread, core
+  /// or interrupt, without a lock.
+  /// The messages are allocated from an etl::ipool_atomic, such as an
+  /// etl::generic_pool_atomic sized with pool_message_parameters.
+  /// \tparam TCounter The reference counter type. Should be an etl::atomic.
+  //***************************************************************************
+  template <typename TCounter = etl::atomic_int32_t>
+  class reference_counted_message_pool_atomic : public etl::ireference_counted_message_pool
+  {
+  public:
+
+    /// Gives the size and alignment required for a list of message types.
+    typedef etl::reference_counted_message_pool<TCounter> pool_parameters_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    reference_counted_message_pool_atomic(etl::ipool_atomic& pool_)
+      : pool(pool_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Allocate a reference counted message from the pool.
+    //*************************************************************************
+    template <typename TMessage, typename... TArgs>
+    etl::reference_counted_message<TMessage, TCounter>* allocate(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "Not a message type");
+
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+
+      rcm_t* p = allocate_block<rcm_t>();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new(p) rcm_t(*this, etl::forward<TArgs>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Allocate a reference counted message from the pool.
+    //*************************************************************************
+    template <typename TMessage>
+    etl::reference_counted_message<TMessage, TCounter>* allocate(const TMessage& message)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "Not a message type");
+
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+
+      rcm_t* p = allocate_block<rcm_t>();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new(p) rcm_t(message, *this);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate a reference counted message from the pool.
+    //*************************************************************************
+    template <typename TMessage>
+    etl::reference_counted_message<TMessage, TCounter>* allocate()
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "Not a message type");
+
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+
+      rcm_t* p = allocate_block<rcm_t>();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new(p) rcm_t(*this);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Destruct a message and send it back to the pool.
+    //*************************************************************************
+    void release(const etl::ireference_counted_message& rcmessage)
+    {
+      bool released = pool.is_in_pool(&rcmessage);
+
+      if (released)
+      {
+        rcmessage.~ireference_counted_message();
+        pool.release(&rcmessage);
+      }
+
+      ETL_ASSERT(released, ETL_ERROR(etl::reference_counted_message_pool_release_failure));
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the raw memory for a message.
+    //*************************************************************************
+    template <typename TRcm>
+    TRcm* allocate_block()
+    {
+      TRcm* p = ETL_NULLPTR;
+
+      // Another thread may still take the last item first, in which case the pool reports it.
+      if (!pool.full())
+      {
+        p = pool.template allocate<TRcm>();
+      }
+
+      ETL_ASSERT((p != ETL_NULLPTR), ETL_ERROR(etl::reference_counted_message_pool_allocation_failure));
+
+      return p;
+    }
+
+    /// The lock-free pool.
+    etl::ipool_atomic& pool;
+
+    // Should not be copied.
+    reference_counted_message_pool_atomic(const reference_counted_message_pool_atomic&) ETL_DELETE;
+    reference_counted_message_pool_atomic& operator =(const reference_counted_message_pool_atomic&) ETL_DELETE;
+  };
+}
+
+#endif
+#endif
@@ -80,6 +80,81 @@ namespace etl
     ETL_NODISCARD virtual int32_t get_reference_count() const = 0;
   };
 
+  //***************************************************************************
+  /// A counter that masks interrupts while it is changed.
+  /// For counts shared with interrupt handlers on single core targets, where
+  /// an etl::atomic would add exclusive load/store loops to every change.
+  /// \tparam TAccess The interrupt control, with static lock() and unlock(),
+  ///                 as used by etl::queue_spsc_isr.
+  /// \tparam T       The type of the count.
+  //***************************************************************************
+  template <typename TAccess, typename T = int32_t>
+  class interrupt_masked_counter
+  {
+  public:
+
+    typedef T value_type;
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    interrupt_masked_counter(T value_ = 0)
+      : value(value_)
+    {
+    }
+
+    //***************************************************************************
+    /// Set the count.
+    //***************************************************************************
+    interrupt_masked_counter& operator =(T value_)
+    {
+      TAccess::lock();
+      value = value_;
+      TAccess::unlock();
+
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Increment the count.
+    //***************************************************************************
+    T operator ++()
+    {
+      TAccess::lock();
+      const T result = ++value;
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Decrement the count.
+    //***************************************************************************
+    T operator --()
+    {
+      TAccess::lock();
+      const T result = --value;
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Get the count.
+    //***************************************************************************
+    operator T() const
+    {
+      return value;
+    }
+
+  private:
+
+    interrupt_masked_counter(const interrupt_masked_counter&) ETL_DELETE;
+    interrupt_masked_counter& operator =(const interrupt_masked_counter&) ETL_DELETE;
+
+    volatile T value;
+  };
+
   //***************************************************************************
   /// A specific type of reference counter.
   //***************************************************************************
@@ -286,6 +361,24 @@ namespace etl
   template <typename TObject>
   using atomic_counted_object = etl::reference_counted_object<TObject, etl::atomic_int32_t>;
 #endif
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Class for creating reference counted objects using a plain counter.
+  /// For objects that are only shared within one thread.
+  /// \tparam TObject  The type to be reference counted.
+  //***************************************************************************
+  template <typename TObject>
+  using non_atomic_counted_object = etl::reference_counted_object<TObject, int32_t>;
+
+  //***************************************************************************
+  /// Class for creating reference counted objects using an interrupt masked counter.
+  /// \tparam TObject  The type to be reference counted.
+  /// \tparam TAccess  The interrupt control. See etl::interrupt_masked_counter.
+  //***************************************************************************
+  template <typename TObject, typename TAccess>
+  using interrupt_masked_counted_object = etl::reference_counted_object<TObject, etl::interrupt_masked_counter<TAccess> >;
+#endif
 }
 
 #endif
@@ -32,6 +32,7 @@ SOFTWARE.
 #define ETL_REFERENCE_FLAT_MAP_INCLUDED
 
 #include "platform.h"
+#include "algorithm.h"
 #include "vector.h"
 #include "error_handler.h"
 #include "debug_count.h"
@@ -351,6 +352,31 @@ namespace etl
       key_compare comp;
     };
 
+    //*********************************************************************
+    /// How to compare the entries in the lookup.
+    //*********************************************************************
+    class LookupCompare
+    {
+    public:
+
+      bool operator ()(const value_type* element1, const value_type* element2) const
+      {
+        return comp(element1->first, element2->first);
+      }
+
+      bool operator ()(const value_type* element, const key_type& key) const
+      {
+        return comp(element->first, key);
+      }
+
+      bool operator ()(const key_type& key, const value_type* element) const
+      {
+        return comp(key, element->first);
+      }
+
+      key_compare comp;
+    };
+
   public:
 
     //*********************************************************************
@@ -1029,6 +1055,60 @@ namespace etl
     }
 #endif
 
+    //*********************************************************************
+    /// Checks whether the key is in the first n_ordered elements.
+    /// Only the first n_ordered elements need be in order.
+    //*********************************************************************
+    bool contains_ordered(key_parameter_t key, size_t n_ordered) const
+    {
+      return etl::binary_search(lookup.begin(), lookup.begin() + n_ordered, key, lookup_compare);
+    }
+
+    //*********************************************************************
+    /// Appends a value to the end of the lookup without ordering it.
+    /// Used by batch insertion. The lookup is put back in order by
+    /// sort_appended and merge_appended.
+    //*********************************************************************
+    void append_unordered(value_type& value)
+    {
+      ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_map_full));
+
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first n_ordered and moves any
+    /// that have duplicate keys to the end.
+    ///\return An iterator to the first duplicate, or end() if none.
+    //*********************************************************************
+    iterator sort_appended(size_t n_ordered)
+    {
+      typename lookup_t::iterator first = lookup.begin() + n_ordered;
+      typename lookup_t::iterator write = first;
+
+      etl::sort(first, lookup.end(), lookup_compare);
+
+      for (typename lookup_t::iterator read = first; read != lookup.end(); ++read)
+      {
+        if ((write == first) || lookup_compare(*(write - 1), *read))
+        {
+          etl::iter_swap(write, read);
+          ++write;
+        }
+      }
+
+      return iterator(write);
+    }
+
+    //*********************************************************************
+    /// Merges the sorted, unique values appended after the first n_ordered
+    /// into the ordered values.
+    //*********************************************************************
+    void merge_appended(size_t n_ordered)
+    {
+      etl::inplace_merge(lookup.begin(), lookup.begin() + n_ordered, lookup.end(), lookup_compare);
+    }
+
   private:
 
     // Disable copy construction and assignment.
@@ -1039,6 +1119,8 @@ namespace etl
 
     Compare compare;
 
+    LookupCompare lookup_compare;
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
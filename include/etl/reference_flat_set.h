@@ -299,6 +299,33 @@ namespace etl
 
     typedef typename etl::parameter_type<T>::type parameter_t;
 
+  private:
+
+    //*********************************************************************
+    /// How to compare the entries in the lookup.
+    //*********************************************************************
+    class LookupCompare
+    {
+    public:
+
+      bool operator ()(const value_type* element1, const value_type* element2) const
+      {
+        return comp(*element1, *element2);
+      }
+
+      bool operator ()(const value_type* element, const value_type& key) const
+      {
+        return comp(*element, key);
+      }
+
+      bool operator ()(const value_type& key, const value_type* element) const
+      {
+        return comp(key, *element);
+      }
+
+      key_compare comp;
+    };
+
   public:
 
     typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
@@ -898,6 +925,60 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Checks whether the value is in the first n_ordered elements.
+    /// Only the first n_ordered elements need be in order.
+    //*********************************************************************
+    bool contains_ordered(const_reference value, size_t n_ordered) const
+    {
+      return etl::binary_search(lookup.begin(), lookup.begin() + n_ordered, value, lookup_compare);
+    }
+
+    //*********************************************************************
+    /// Appends a value to the end of the lookup without ordering it.
+    /// Used by batch insertion. The lookup is put back in order by
+    /// sort_appended and merge_appended.
+    //*********************************************************************
+    void append_unordered(reference value)
+    {
+      ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_set_full));
+
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first n_ordered and moves any
+    /// duplicates to the end.
+    ///\return An iterator to the first duplicate, or end() if none.
+    //*********************************************************************
+    iterator sort_appended(size_t n_ordered)
+    {
+      typename lookup_t::iterator first = lookup.begin() + n_ordered;
+      typename lookup_t::iterator write = first;
+
+      etl::sort(first, lookup.end(), lookup_compare);
+
+      for (typename lookup_t::iterator read = first; read != lookup.end(); ++read)
+      {
+        if ((write == first) || lookup_compare(*(write - 1), *read))
+        {
+          etl::iter_swap(write, read);
+          ++write;
+        }
+      }
+
+      return iterator(write);
+    }
+
+    //*********************************************************************
+    /// Merges the sorted, unique values appended after the first n_ordered
+    /// into the ordered values.
+    //*********************************************************************
+    void merge_appended(size_t n_ordered)
+    {
+      etl::inplace_merge(lookup.begin(), lookup.begin() + n_ordered, lookup.end(), lookup_compare);
+    }
+
   private:
 
     // Disable copy construction.
@@ -908,6 +989,8 @@ namespace etl
 
     TKeyCompare compare;
 
+    LookupCompare lookup_compare;
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
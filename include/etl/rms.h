@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_sums.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -127,6 +129,22 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a span of values.
+    /// Faster than adding the values one at a time.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      if (values.empty())
+      {
+        return;
+      }
+
+      private_statistics::accumulate_squares(values.data(), values.size(), sum_of_squares);
+      counter += uint32_t(values.size());
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -146,6 +164,15 @@ namespace etl
       add(first, last);
     }
 
+    //*********************************
+    /// operator ()
+    /// Add a span of values.
+    //*********************************
+    void operator ()(etl::span<const TInput> values)
+    {
+      add(values);
+    }
+
     //*********************************
     /// Get the rms.
     //*********************************
@@ -37,6 +37,13 @@ SOFTWARE.
 #include "task.h"
 #include "type_traits.h"
 #include "function.h"
+#include "atomic.h"
+#include "power.h"
+#include "work_stealing_deque.h"
+#include "static_assert.h"
+#include "binary.h"
+#include "algorithm.h"
+#include "integral_limits.h"
 
 #include <stdint.h>
 
@@ -222,6 +229,366 @@ namespace etl
     }
   };
 
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// Work Stealing.
+  /// A policy the scheduler can use to share the tasks between several cores.
+  /// Worker 0 runs in scheduler::start(). Each of the other workers calls
+  /// scheduler::schedule_worker(worker_id) repeatedly from its own core.
+  /// Each worker polls its share of the tasks and queues those that have work
+  /// in its own deque. A worker runs the tasks in its own deque, then steals
+  /// from the deques of the others.
+  /// A task is only ever called from one worker at a time.
+  /// Tasks must not be added once the other workers have started.
+  /// \tparam N_WORKERS The number of workers.
+  /// \tparam MAX_TASKS The maximum number of tasks. Must match that of the scheduler.
+  //***************************************************************************
+  template <size_t N_WORKERS, size_t MAX_TASKS>
+  struct scheduler_policy_work_stealing
+  {
+    ETL_STATIC_ASSERT(N_WORKERS > 0U, "At least one worker is required");
+
+    scheduler_policy_work_stealing()
+    {
+      for (size_t index = 0UL; index < MAX_TASKS; ++index)
+      {
+        claimed[index].store(false, etl::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// Called from scheduler::start() as worker 0.
+    //*******************************************
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      return schedule_tasks(task_list, 0U);
+    }
+
+    //*******************************************
+    /// One scheduling pass for the worker.
+    //*******************************************
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list, size_t worker_id)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(worker_id < N_WORKERS, ETL_ERROR(etl::scheduler_exception), true);
+
+      bool idle = true;
+
+      // Queue this worker's share of the tasks that have work to do.
+      for (size_t index = worker_id; index < task_list.size(); index += N_WORKERS)
+      {
+        if (!claimed[index].exchange(true, etl::memory_order_acquire))
+        {
+          if ((task_list[index]->task_request_work() == 0) || !deques[worker_id].push_bottom(index))
+          {
+            claimed[index].store(false, etl::memory_order_release);
+          }
+        }
+      }
+
+      // Run them, then help the other workers.
+      size_t index;
+
+      while (deques[worker_id].pop_bottom(index) || steal(worker_id, index))
+      {
+        task_list[index]->task_process_work();
+        claimed[index].store(false, etl::memory_order_release);
+        idle = false;
+      }
+
+      return idle;
+    }
+
+  private:
+
+    //*******************************************
+    /// Tries each of the other workers' deques in turn.
+    //*******************************************
+    bool steal(size_t worker_id, size_t& index)
+    {
+      for (size_t i = 1UL; i < N_WORKERS; ++i)
+      {
+        size_t victim = (worker_id + i) % N_WORKERS;
+
+        if (deques[victim].steal(index))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    // A deque can hold every task, so a push never fails.
+    typedef etl::work_stealing_deque<size_t, etl::power_of_2_round_up<MAX_TASKS>::value> deque_t;
+
+    deque_t           deques[N_WORKERS];
+    etl::atomic<bool> claimed[MAX_TASKS]; ///< Set while a task is queued or running.
+  };
+#endif
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// Ready Bitmap.
+  /// A policy the scheduler can use to decide what to do next.
+  /// Tasks, or interrupts, signal that a priority has work by calling
+  /// set_ready(priority) through scheduler::get_policy(). The policy finds the
+  /// highest ready priority by counting leading zeros in a bitmap, and calls
+  /// the tasks of that priority that have work. No task is polled unless its
+  /// priority has been signalled.
+  /// The ready bit is cleared before the tasks are called, and is set again
+  /// if one of them still has work afterwards.
+  //***************************************************************************
+  struct scheduler_policy_ready_bitmap
+  {
+    scheduler_policy_ready_bitmap()
+    {
+      for (size_t word = 0UL; word < size_t(Words); ++word)
+      {
+        ready[word].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// Signals that the tasks of the priority have work.
+    /// May be called from an interrupt.
+    //*******************************************
+    void set_ready(etl::task_priority_t priority)
+    {
+      ready[word_of(priority)].fetch_or(bit_of(priority), etl::memory_order_release);
+    }
+
+    //*******************************************
+    /// Withdraws the signal for the priority.
+    //*******************************************
+    void clear_ready(etl::task_priority_t priority)
+    {
+      ready[word_of(priority)].fetch_and(static_cast<uint32_t>(~bit_of(priority)), etl::memory_order_relaxed);
+    }
+
+    //*******************************************
+    /// Checks if the priority has been signalled.
+    //*******************************************
+    bool is_ready(etl::task_priority_t priority) const
+    {
+      return (ready[word_of(priority)].load(etl::memory_order_relaxed) & bit_of(priority)) != 0U;
+    }
+
+    //*******************************************
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      // Find the highest ready priority.
+      size_t   word = size_t(Words);
+      uint32_t bits = 0U;
+
+      while ((bits == 0U) && (word != 0UL))
+      {
+        --word;
+        bits = ready[word].load(etl::memory_order_acquire);
+      }
+
+      if (bits == 0U)
+      {
+        return true;
+      }
+
+      const etl::task_priority_t priority = static_cast<etl::task_priority_t>((word * 32U) + (31U - etl::count_leading_zeros(bits)));
+
+      clear_ready(priority);
+
+      // The tasks are in descending priority order.
+      etl::ivector<etl::task*>::iterator itask = etl::lower_bound(task_list.begin(), task_list.end(), priority, compare_priority());
+
+      bool more_work = false;
+
+      while ((itask != task_list.end()) && ((*itask)->get_task_priority() == priority))
+      {
+        etl::task& task = **itask;
+
+        if (task.task_request_work() > 0)
+        {
+          task.task_process_work();
+          more_work = more_work || (task.task_request_work() > 0);
+        }
+
+        ++itask;
+      }
+
+      if (more_work)
+      {
+        set_ready(priority);
+      }
+
+      return false;
+    }
+
+  private:
+
+    //*******************************************
+    struct compare_priority
+    {
+      bool operator()(const etl::task* ptask, etl::task_priority_t priority) const
+      {
+        return ptask->get_task_priority() > priority;
+      }
+    };
+
+    //*******************************************
+    static size_t word_of(etl::task_priority_t priority)
+    {
+      return static_cast<size_t>(priority) / 32U;
+    }
+
+    //*******************************************
+    static uint32_t bit_of(etl::task_priority_t priority)
+    {
+      return uint32_t(1U) << (static_cast<size_t>(priority) % 32U);
+    }
+
+    enum
+    {
+      Words = (etl::integral_limits<etl::task_priority_t>::max / 32U) + 1U
+    };
+
+    etl::atomic<uint32_t> ready[Words]; ///< One bit per priority.
+  };
+#endif
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// Earliest Deadline First.
+  /// A policy the scheduler can use to decide what to do next.
+  /// Time is advanced by calling tick() through scheduler::get_policy(),
+  /// usually from the same timer interrupt that ticks the callback timers.
+  /// Calls the released task with the earliest deadline.
+  /// - A periodic task is released every period, and its deadline is its next
+  ///   release. It is not polled before it is released.
+  /// - An aperiodic task is released while it has work. Those without a
+  ///   deadline run after all of those with one, in priority order.
+  /// When idle, ticks_to_next_release() tells the idle callback how long it
+  /// may sleep for.
+  //***************************************************************************
+  struct scheduler_policy_earliest_deadline_first
+  {
+    scheduler_policy_earliest_deadline_first()
+      : next_release(No_Release)
+    {
+      now.store(0U, etl::memory_order_relaxed);
+    }
+
+    //*******************************************
+    /// Advances the time. May be called from an interrupt.
+    //*******************************************
+    void tick(etl::task_tick_t count = 1U)
+    {
+      now.fetch_add(count, etl::memory_order_release);
+    }
+
+    //*******************************************
+    /// The current time.
+    //*******************************************
+    etl::task_tick_t time() const
+    {
+      return now.load(etl::memory_order_acquire);
+    }
+
+    //*******************************************
+    /// The ticks to the next release of a periodic task, as of the last
+    /// scheduling pass. No_Release if there are no periodic tasks waiting.
+    //*******************************************
+    etl::task_tick_t ticks_to_next_release() const
+    {
+      return next_release;
+    }
+
+    //*******************************************
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      const etl::task_tick_t time_now = time();
+
+      etl::task* p_best = ETL_NULLPTR;
+      next_release      = No_Release;
+
+      for (size_t index = 0UL; index < task_list.size(); ++index)
+      {
+        etl::task& task = *(task_list[index]);
+
+        if (task.task_is_periodic())
+        {
+          const etl::task_tick_t wait = task.get_task_release() - time_now;
+
+          if (is_before(time_now, task.get_task_release()))
+          {
+            if (wait < next_release)
+            {
+              next_release = wait;
+            }
+
+            continue;
+          }
+        }
+        else if ((p_best != ETL_NULLPTR) && !task.has_task_deadline())
+        {
+          // Cannot beat the task already chosen.
+          continue;
+        }
+        else if (task.task_request_work() == 0)
+        {
+          continue;
+        }
+
+        if ((p_best == ETL_NULLPTR) || is_earlier(task, *p_best))
+        {
+          p_best = &task;
+        }
+      }
+
+      if (p_best == ETL_NULLPTR)
+      {
+        return true;
+      }
+
+      p_best->task_process_work();
+
+      if (p_best->task_is_periodic())
+      {
+        p_best->advance_task_release();
+        next_release = 0U;
+      }
+
+      return false;
+    }
+
+    static ETL_CONSTANT etl::task_tick_t No_Release = etl::integral_limits<etl::task_tick_t>::max;
+
+  private:
+
+    //*******************************************
+    /// Wrap safe 'lhs is before rhs'.
+    //*******************************************
+    static bool is_before(etl::task_tick_t lhs, etl::task_tick_t rhs)
+    {
+      return static_cast<etl::make_signed<etl::task_tick_t>::type>(lhs - rhs) < 0;
+    }
+
+    //*******************************************
+    /// Does lhs have an earlier deadline than rhs?
+    /// Ties go to rhs, which is of equal or higher priority.
+    //*******************************************
+    static bool is_earlier(const etl::task& lhs, const etl::task& rhs)
+    {
+      if (!lhs.has_task_deadline())
+      {
+        return false;
+      }
+
+      return !rhs.has_task_deadline() || is_before(lhs.get_task_deadline(), rhs.get_task_deadline());
+    }
+
+    etl::atomic<etl::task_tick_t> now;          ///< The current time.
+    etl::task_tick_t              next_release; ///< Ticks to the next release, from the last pass.
+  };
+#endif
+
   //***************************************************************************
   /// Scheduler base.
   //***************************************************************************
@@ -396,6 +763,26 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Runs one scheduling pass for one of the other workers.
+    /// Only for policies that support more than one worker,
+    /// such as etl::scheduler_policy_work_stealing.
+    /// \return <b>true</b> if the worker was idle.
+    //*******************************************
+    bool schedule_worker(size_t worker_id)
+    {
+      return TSchedulerPolicy::schedule_tasks(task_list, worker_id);
+    }
+
+    //*******************************************
+    /// Gets the scheduling policy.
+    /// For policies that are signalled, such as etl::scheduler_policy_ready_bitmap.
+    //*******************************************
+    TSchedulerPolicy& get_policy()
+    {
+      return *this;
+    }
+
   private:
 
     typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
@@ -0,0 +1,318 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEGREGATED_VARIANT_POOL_INCLUDED
+#define ETL_SEGREGATED_VARIANT_POOL_INCLUDED
+
+#include "platform.h"
+#include "pool.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "utility.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// A type for etl::segregated_variant_pool, with the number of them that
+  /// the pool can hold.
+  //***************************************************************************
+  template <typename T, size_t VMax_Size>
+  struct variant_pool_type
+  {
+    typedef T type;
+
+    static ETL_CONSTANT size_t Max_Size = VMax_Size;
+  };
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT size_t variant_pool_type<T, VMax_Size>::Max_Size;
+
+  namespace private_segregated_variant_pool
+  {
+    //*************************************************************************
+    /// One pool for each type.
+    //*************************************************************************
+    template <typename... TTypes>
+    class pools;
+
+    //*************************************************************************
+    /// The end of the list of pools.
+    //*************************************************************************
+    template <>
+    class pools<>
+    {
+    public:
+
+      void get_pool() const
+      {
+      }
+
+      etl::ipool* find(const void*)
+      {
+        return ETL_NULLPTR;
+      }
+
+      size_t size() const
+      {
+        return 0U;
+      }
+
+      size_t max_size() const
+      {
+        return 0U;
+      }
+
+      void release_all()
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// The pool for TType, followed by the pools for TRest.
+    //*************************************************************************
+    template <typename TType, typename... TRest>
+    class pools<TType, TRest...> : public pools<TRest...>
+    {
+    public:
+
+      typedef pools<TRest...>     base_t;
+      typedef typename TType::type value_type;
+
+      using base_t::get_pool;
+
+      etl::ipool& get_pool(etl::type_identity<value_type>)
+      {
+        return pool;
+      }
+
+      const etl::ipool& get_pool(etl::type_identity<value_type>) const
+      {
+        return pool;
+      }
+
+      //***********************************************************************
+      /// Finds the pool that contains the object, if any.
+      //***********************************************************************
+      etl::ipool* find(const void* p_object)
+      {
+        return pool.is_in_pool(p_object) ? &pool : base_t::find(p_object);
+      }
+
+      size_t size() const
+      {
+        return pool.size() + base_t::size();
+      }
+
+      size_t max_size() const
+      {
+        return pool.max_size() + base_t::max_size();
+      }
+
+      void release_all()
+      {
+        pool.release_all();
+        base_t::release_all();
+      }
+
+    private:
+
+      etl::pool<value_type, TType::Max_Size> pool;
+    };
+  }
+
+  //***************************************************************************
+  /// A pool for any of a set of types, with a separate pool for each type.
+  /// Unlike etl::variant_pool, each item only uses the storage for its own
+  /// type, rather than for the largest type, and each type has its own
+  /// capacity. The pool for a type is selected at compile time.
+  /// e.g.
+  ///   etl::segregated_variant_pool<etl::variant_pool_type<Small, 32>,
+  ///                                etl::variant_pool_type<Large, 4>> pool;
+  /// \tparam TTypes A list of etl::variant_pool_type.
+  //***************************************************************************
+  template <typename... TTypes>
+  class segregated_variant_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TTypes) != 0U, "No types");
+    ETL_STATIC_ASSERT(!(etl::has_duplicates<typename TTypes::type...>::value), "Duplicate types");
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    segregated_variant_pool()
+    {
+    }
+
+    //*************************************************************************
+    /// Allocates storage for a 'T' from its pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<T, typename TTypes::type...>::value), "Unsupported type");
+
+      return get_pool<T>().template allocate<T>();
+    }
+
+    //*************************************************************************
+    /// Creates a 'T' in its pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename... TArgs>
+    T* create(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<T, typename TTypes::type...>::value), "Unsupported type");
+
+      return get_pool<T>().template create<T>(etl::forward<TArgs>(args)...);
+    }
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// If 'T' is one of the pool's types, its pool is selected at compile time.
+    /// If 'T' is a base of the pool's types, the pool that contains the object
+    /// is searched for. 'T' must then have a virtual destructor.
+    /// If asserts or exceptions are enabled and the object does not belong to
+    /// the pool then an etl::pool_object_not_in_pool is thrown.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<T, typename TTypes::type...>::value || etl::is_base_of_any<T, typename TTypes::type...>::value), "Invalid type");
+
+      destroy(p_object, etl::bool_constant<etl::is_one_of<T, typename TTypes::type...>::value>());
+    }
+
+    //*************************************************************************
+    /// Gets the pool for a 'T'.
+    //*************************************************************************
+    template <typename T>
+    etl::ipool& get_pool()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<T, typename TTypes::type...>::value), "Unsupported type");
+
+      return pools.get_pool(etl::type_identity<T>());
+    }
+
+    //*************************************************************************
+    /// Gets the pool for a 'T'.
+    //*************************************************************************
+    template <typename T>
+    const etl::ipool& get_pool() const
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<T, typename TTypes::type...>::value), "Unsupported type");
+
+      return pools.get_pool(etl::type_identity<T>());
+    }
+
+    //*************************************************************************
+    /// Checks to see if the object belongs to the pool.
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object)
+    {
+      return pools.find(p_object) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Releases all objects in all of the pools.
+    /// Does not call their destructors.
+    //*************************************************************************
+    void release_all()
+    {
+      pools.release_all();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items, of all types.
+    //*************************************************************************
+    size_t size() const
+    {
+      return pools.size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items, of all types.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return pools.max_size();
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Destroys an object of one of the pool's types.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object, etl::bool_constant<true>)
+    {
+      get_pool<T>().destroy(p_object);
+    }
+
+    //*************************************************************************
+    /// Destroys an object through a pointer to its base.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object, etl::bool_constant<false>)
+    {
+      etl::ipool* p_pool = pools.find(p_object);
+
+      ETL_ASSERT_OR_RETURN(p_pool != ETL_NULLPTR, ETL_ERROR(etl::pool_object_not_in_pool));
+
+      p_pool->destroy(p_object);
+    }
+
+    segregated_variant_pool(const segregated_variant_pool&) ETL_DELETE;
+    segregated_variant_pool& operator =(const segregated_variant_pool&) ETL_DELETE;
+
+    private_segregated_variant_pool::pools<TTypes...> pools;
+  };
+}
+
+#endif
+#endif
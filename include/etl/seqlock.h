@@ -0,0 +1,193 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEQLOCK_INCLUDED
+#define ETL_SEQLOCK_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "spin_mutex.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A sequence lock.
+  /// Publishes snapshots of a trivially copyable T from a single writer to any
+  /// number of readers. The writer never waits for readers. A reader that
+  /// overlaps a write sees the sequence number change and retries.
+  /// The value is held as an array of atomic words, so the copies are free of
+  /// data races.
+  //***************************************************************************
+  template <typename T>
+  class seqlock
+  {
+  public:
+
+#if ETL_USING_STL && ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "T must be trivially copyable");
+#endif
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    /// The value is zero initialised.
+    //*************************************************************************
+    seqlock()
+      : sequence_number(0U)
+    {
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        data[i].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit seqlock(const T& value)
+      : sequence_number(0U)
+    {
+      copy_in(value);
+    }
+
+    //*************************************************************************
+    /// Publishes a new value.
+    /// Must only be called from one context at a time.
+    //*************************************************************************
+    void write(const T& value)
+    {
+      const uint32_t sequence = sequence_number.load(etl::memory_order_relaxed);
+
+      // Odd while writing.
+      sequence_number.store(sequence + 1U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+
+      copy_in(value);
+
+      sequence_number.store(sequence + 2U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Tries to read a consistent snapshot.
+    /// Returns <b>false</b> if a write was in progress, leaving 'value' in an
+    /// unspecified state.
+    //*************************************************************************
+    bool try_read(T& value) const
+    {
+      const uint32_t before = sequence_number.load(etl::memory_order_acquire);
+
+      if ((before & 1U) != 0U)
+      {
+        return false;
+      }
+
+      copy_out(value);
+
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      return (sequence_number.load(etl::memory_order_relaxed) == before);
+    }
+
+    //*************************************************************************
+    /// Reads a consistent snapshot, retrying while writes overlap.
+    //*************************************************************************
+    T read() const
+    {
+      T value;
+
+      while (!try_read(value))
+      {
+        ETL_SPIN_PAUSE();
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// The number of writes so far, times two, plus one while a write is in
+    /// progress.
+    //*************************************************************************
+    uint32_t sequence() const
+    {
+      return sequence_number.load(etl::memory_order_acquire);
+    }
+
+  private:
+
+    enum
+    {
+      Words = (sizeof(T) + sizeof(uint32_t) - 1U) / sizeof(uint32_t)
+    };
+
+    //*************************************************************************
+    void copy_in(const T& value)
+    {
+      uint32_t buffer[Words];
+
+      buffer[Words - 1U] = 0U;
+      memcpy(buffer, &value, sizeof(T));
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        data[i].store(buffer[i], etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    void copy_out(T& value) const
+    {
+      uint32_t buffer[Words];
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        buffer[i] = data[i].load(etl::memory_order_relaxed);
+      }
+
+      memcpy(&value, buffer, sizeof(T));
+    }
+
+    seqlock(const seqlock&) ETL_DELETE;
+    seqlock& operator =(const seqlock&) ETL_DELETE;
+
+    etl::atomic<uint32_t> sequence_number;
+    etl::atomic<uint32_t> data[Words];
+  };
+}
+
+#endif
+#endif
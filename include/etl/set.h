@@ -276,6 +276,125 @@ namespace etl
       swap->weight = detached->weight;
     }
 
+    //*************************************************************************
+    /// Updates the weights from the balance node to the parent of the
+    /// replacement node, then swaps the found node with the replacement.
+    /// Uses only the node links, so is shared by all key and value types.
+    //*************************************************************************
+    void rebalance_and_detach(Node* found, Node* found_parent, Node* replace_parent, Node* balance, Node* balance_parent)
+    {
+      // Step 2: Update weights from critical node to replacement parent node
+      while (balance)
+      {
+        if (balance->children[balance->dir] == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        if (balance->weight == kNeither)
+        {
+          balance->weight = 1 - balance->dir;
+        }
+        else if (balance->weight == balance->dir)
+        {
+          balance->weight = kNeither;
+        }
+        else
+        {
+          int weight = balance->children[1 - balance->dir]->weight;
+          // Perform a 3 node rotation if weight is same as balance->dir
+          if (weight == balance->dir)
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance_parent == ETL_NULLPTR)
+            {
+              rotate_3node(root_node, 1 - balance->dir,
+                balance->children[1 - balance->dir]->children[balance->dir]->weight);
+            }
+            else
+            {
+              rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
+                balance->children[1 - balance->dir]->children[balance->dir]->weight);
+            }
+          }
+          // Already balanced, rebalance and make it heavy in opposite
+          // direction of the node being removed
+          else if (weight == kNeither)
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance_parent == ETL_NULLPTR)
+            {
+              rotate_2node(root_node, 1 - balance->dir);
+              root_node->weight = balance->dir;
+            }
+            else
+            {
+              rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
+              balance_parent->children[balance_parent->dir]->weight = balance->dir;
+            }
+            // Update balance node weight in opposite direction of node removed
+            balance->weight = 1 - balance->dir;
+          }
+          // Rebalance and leave it balanced
+          else
+          {
+            // Is the root node being rebalanced (no parent)
+            if (balance_parent == ETL_NULLPTR)
+            {
+              rotate_2node(root_node, 1 - balance->dir);
+            }
+            else
+            {
+              rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
+            }
+          }
+
+          // Is balance node the same as the target node found? then update
+          // its parent after the rotation performed above
+          if (balance == found)
+          {
+            if (balance_parent)
+            {
+              found_parent = balance_parent->children[balance_parent->dir];
+              // Update dir since it is likely stale
+              found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
+            }
+            else
+            {
+              found_parent = root_node;
+              root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
+            }
+          }
+        }
+
+        // Next balance node to consider
+        balance_parent = balance;
+        balance = balance->children[balance->dir];
+      } // while(balance)
+
+      // Step 3: Swap found node with replacement node
+      if (found_parent)
+      {
+        // Handle traditional case
+        detach_node(found_parent->children[found_parent->dir],
+          replace_parent->children[replace_parent->dir]);
+      }
+      // Handle root node removal
+      else
+      {
+        // Valid replacement node for root node being removed?
+        if (replace_parent)
+        {
+          detach_node(root_node, replace_parent->children[replace_parent->dir]);
+        }
+        else
+        {
+          // Target node and replacement node are both root node
+          detach_node(root_node, root_node);
+        }
+      }
+    }
+
     //*************************************************************************
     /// Balance the critical node at the position provided as needed
     //*************************************************************************
@@ -2202,116 +2321,8 @@ namespace etl
       // If target node was found, proceed with rebalancing and replacement
       if (found)
       {
-        // Step 2: Update weights from critical node to replacement parent node
-        while (balance)
-        {
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
-
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-                balance_parent->children[balance_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-              }
-            }
-
-            // Is balance node the same as the target node found? then update
-            // its parent after the rotation performed above
-            if (balance == found)
-            {
-              if (balance_parent)
-              {
-                found_parent = balance_parent->children[balance_parent->dir];
-                // Update dir since it is likely stale
-                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
-              }
-              else
-              {
-                found_parent = root_node;
-                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
-              }
-            }
-          }
-
-          // Next balance node to consider
-          balance_parent = balance;
-          balance = balance->children[balance->dir];
-        } // while(balance)
-
-          // Step 3: Swap found node with replacement node
-        if (found_parent)
-        {
-          // Handle traditional case
-          detach_node(found_parent->children[found_parent->dir],
-            replace_parent->children[replace_parent->dir]);
-        }
-        // Handle root node removal
-        else
-        {
-          // Valid replacement node for root node being removed?
-          if (replace_parent)
-          {
-            detach_node(root_node, replace_parent->children[replace_parent->dir]);
-          }
-          else
-          {
-            // Target node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
-        }
+        // Steps 2 and 3: Update the weights and swap found with the replacement
+        rebalance_and_detach(found, found_parent, replace_parent, balance, balance_parent);
 
         // Downcast found into data node
         Data_Node& found_data_node = iset::data_cast(*found);
@@ -2395,116 +2406,8 @@ namespace etl
       // If target node was found, proceed with rebalancing and replacement
       if (found)
       {
-        // Step 2: Update weights from critical node to replacement parent node
-        while (balance)
-        {
-          if (balance->children[balance->dir] == ETL_NULLPTR)
-          {
-            break;
-          }
-
-          if (balance->weight == kNeither)
-          {
-            balance->weight = 1 - balance->dir;
-          }
-          else if (balance->weight == balance->dir)
-          {
-            balance->weight = kNeither;
-          }
-          else
-          {
-            int weight = balance->children[1 - balance->dir]->weight;
-            // Perform a 3 node rotation if weight is same as balance->dir
-            if (weight == balance->dir)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_3node(root_node, 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-              else
-              {
-                rotate_3node(balance_parent->children[balance_parent->dir], 1 - balance->dir,
-                  balance->children[1 - balance->dir]->children[balance->dir]->weight);
-              }
-            }
-            // Already balanced, rebalance and make it heavy in opposite
-            // direction of the node being removed
-            else if (weight == kNeither)
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-                root_node->weight = balance->dir;
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-                balance_parent->children[balance_parent->dir]->weight = balance->dir;
-              }
-              // Update balance node weight in opposite direction of node removed
-              balance->weight = 1 - balance->dir;
-            }
-            // Rebalance and leave it balanced
-            else
-            {
-              // Is the root node being rebalanced (no parent)
-              if (balance_parent == ETL_NULLPTR)
-              {
-                rotate_2node(root_node, 1 - balance->dir);
-              }
-              else
-              {
-                rotate_2node(balance_parent->children[balance_parent->dir], 1 - balance->dir);
-              }
-            }
-
-            // Is balance node the same as the target node found? then update
-            // its parent after the rotation performed above
-            if (balance == found)
-            {
-              if (balance_parent)
-              {
-                found_parent = balance_parent->children[balance_parent->dir];
-                // Update dir since it is likely stale
-                found_parent->dir = found_parent->children[kLeft] == found ? kLeft : kRight;
-              }
-              else
-              {
-                found_parent = root_node;
-                root_node->dir = root_node->children[kLeft] == found ? kLeft : kRight;
-              }
-            }
-          }
-
-          // Next balance node to consider
-          balance_parent = balance;
-          balance = balance->children[balance->dir];
-        } // while(balance)
-
-          // Step 3: Swap found node with replacement node
-        if (found_parent)
-        {
-          // Handle traditional case
-          detach_node(found_parent->children[found_parent->dir],
-            replace_parent->children[replace_parent->dir]);
-        }
-        // Handle root node removal
-        else
-        {
-          // Valid replacement node for root node being removed?
-          if (replace_parent)
-          {
-            detach_node(root_node, replace_parent->children[replace_parent->dir]);
-          }
-          else
-          {
-            // Target node and replacement node are both root node
-            detach_node(root_node, root_node);
-          }
-        }
+        // Steps 2 and 3: Update the weights and swap found with the replacement
+        rebalance_and_detach(found, found_parent, replace_parent, balance, balance_parent);
 
         // Downcast found into data node
         Data_Node& found_data_node = iset::data_cast(*found);
@@ -0,0 +1,250 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARDED_COUNTER_INCLUDED
+#define ETL_SHARDED_COUNTER_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup sharded_counter sharded counter
+///\ingroup utilities
+
+//*****************************************************************************
+/// The default spacing of the shards.
+//*****************************************************************************
+#if !defined(ETL_SHARDED_COUNTER_CACHE_LINE_SIZE)
+  #define ETL_SHARDED_COUNTER_CACHE_LINE_SIZE 64
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The default shard selector.
+  /// Each thread or core has its own stack, so the address of a local
+  /// variable selects a shard with no platform support.
+  /// Replace with a selector that returns the core id where one is available.
+  ///\ingroup sharded_counter
+  //***************************************************************************
+  struct sharded_counter_stack_selector
+  {
+    size_t operator ()() const
+    {
+      char local;
+
+      uintptr_t address = reinterpret_cast<uintptr_t>(&local);
+
+      // Stacks are usually at least 4K apart.
+      return static_cast<size_t>((address >> 12U) ^ (address >> 20U));
+    }
+  };
+
+  //***************************************************************************
+  /// A counter split into VShards atomic shards, each on its own cache line.
+  /// Updates go to the shard chosen by TSelector, so contexts on different
+  /// cores do not contend for one cache line. read() sums the shards.
+  /// Any shard choice gives the correct total; the choice only affects
+  /// contention.
+  /// May be used as the counter type for etl::instance_count.
+  ///\ingroup sharded_counter
+  //***************************************************************************
+  template <size_t VShards,
+            typename T = int32_t,
+            typename TSelector = etl::sharded_counter_stack_selector,
+            size_t VCache_Line_Size = ETL_SHARDED_COUNTER_CACHE_LINE_SIZE>
+  class sharded_counter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VShards > 0U, "Must have at least one shard");
+    ETL_STATIC_ASSERT(VCache_Line_Size > sizeof(etl::atomic<T>), "Cache line size too small");
+
+    typedef T         value_type;
+    typedef TSelector selector_type;
+
+    static ETL_CONSTANT size_t Shards          = VShards;
+    static ETL_CONSTANT size_t Cache_Line_Size = VCache_Line_Size;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    sharded_counter(T initial = T(0))
+    {
+      set(initial);
+    }
+
+    //*************************************************************************
+    /// Adds to the shard for the calling context.
+    //*************************************************************************
+    sharded_counter& operator +=(T value)
+    {
+      add(value);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Subtracts from the shard for the calling context.
+    //*************************************************************************
+    sharded_counter& operator -=(T value)
+    {
+      add(T(0) - value);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Increments the shard for the calling context.
+    //*************************************************************************
+    sharded_counter& operator ++()
+    {
+      add(T(1));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Decrements the shard for the calling context.
+    //*************************************************************************
+    sharded_counter& operator --()
+    {
+      add(T(0) - T(1));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Sets the count.
+    /// Not atomic with respect to concurrent updates.
+    //*************************************************************************
+    sharded_counter& operator =(T value)
+    {
+      set(value);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds to the shard for the calling context.
+    //*************************************************************************
+    void add(T value)
+    {
+      add(value, selector());
+    }
+
+    //*************************************************************************
+    /// Adds to a specific shard.
+    /// The index is taken modulo the number of shards.
+    //*************************************************************************
+    void add(T value, size_t shard)
+    {
+      shards[shard % Shards].value.fetch_add(value, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Sets the count.
+    /// Not atomic with respect to concurrent updates.
+    //*************************************************************************
+    void set(T value)
+    {
+      shards[0].value.store(value, etl::memory_order_relaxed);
+
+      for (size_t i = 1U; i < Shards; ++i)
+      {
+        shards[i].value.store(T(0), etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the count to zero.
+    //*************************************************************************
+    void clear()
+    {
+      set(T(0));
+    }
+
+    //*************************************************************************
+    /// Returns the sum of the shards.
+    /// Updates made during the read may or may not be included.
+    //*************************************************************************
+    T read() const
+    {
+      T total = T(0);
+
+      for (size_t i = 0U; i < Shards; ++i)
+      {
+        total += shards[i].value.load(etl::memory_order_relaxed);
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Returns the sum of the shards.
+    //*************************************************************************
+    operator T() const
+    {
+      return read();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// One shard, padded to a cache line.
+    /// The values are a cache line apart so no two share a line, even if the
+    /// array is not line aligned.
+    //*************************************************************************
+    struct shard_t
+    {
+      etl::atomic<T> value;
+      char           padding[VCache_Line_Size - sizeof(etl::atomic<T>)];
+    };
+
+    sharded_counter(const sharded_counter&) ETL_DELETE;
+
+    TSelector selector;
+    shard_t   shards[VShards];
+  };
+
+  template <size_t VShards, typename T, typename TSelector, size_t VCache_Line_Size>
+  ETL_CONSTANT size_t sharded_counter<VShards, T, TSelector, VCache_Line_Size>::Shards;
+
+  template <size_t VShards, typename T, typename TSelector, size_t VCache_Line_Size>
+  ETL_CONSTANT size_t sharded_counter<VShards, T, TSelector, VCache_Line_Size>::Cache_Line_Size;
+}
+
+#endif
+#endif
@@ -38,10 +38,15 @@ SOFTWARE.
 #include "message.h"
 #include "type_traits.h"
 #include "static_assert.h"
+#include "alignment.h"
+#include "placement_new.h"
 
 //*****************************************************************************
 /// A wrapper for reference counted messages.
 /// Contains pointers to a pool owner and a message defined with a ref count type.
+/// A borrowed shared message, created by etl::shared_message::borrow, uses the
+/// reference held by another shared message and does not change the count.
+/// Copies and moves of a borrowed shared message each hold their own reference.
 //*****************************************************************************
 namespace etl
 {
@@ -60,11 +65,22 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Creates a borrowed shared message for 'other'.
+    /// Used to pass a message on to several routers without changing the
+    /// reference count for each one. Must not outlive 'other'.
+    //*************************************************************************
+    ETL_NODISCARD static shared_message borrow(const etl::shared_message& other)
+    {
+      return shared_message(other.p_rcmessage, borrowed_tag());
+    }
+
     //*************************************************************************
     /// Constructor
     //*************************************************************************
     template <typename TPool, typename TMessage>
     shared_message(TPool& owner, const TMessage& message)
+      : borrowed(false)
     {
       ETL_STATIC_ASSERT((etl::is_base_of<etl::ireference_counted_message_pool, TPool>::value), "TPool not derived from etl::ireference_counted_message_pool");
       ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "TMessage not derived from etl::imessage");
@@ -83,6 +99,7 @@ namespace etl
     //*************************************************************************
     template <typename TPool, typename TMessage, typename... TArgs>
     shared_message(TPool& owner, etl::in_place_type_t<TMessage>, TArgs&&... args)
+      : borrowed(false)
     {
       ETL_STATIC_ASSERT((etl::is_base_of<etl::ireference_counted_message_pool, TPool>::value), "TPool not derived from etl::ireference_counted_message_pool");
       ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "TMessage not derived from etl::imessage");
@@ -100,6 +117,7 @@ namespace etl
     /// Constructor
     //*************************************************************************
     shared_message(etl::ireference_counted_message& rcm)
+      : borrowed(false)
     {
       p_rcmessage = &rcm;
 
@@ -111,6 +129,7 @@ namespace etl
     //*************************************************************************
     shared_message(const etl::shared_message& other)
       : p_rcmessage(other.p_rcmessage)
+      , borrowed(false)
     {
       p_rcmessage->get_reference_counter().increment_reference_count();
     }
@@ -121,8 +140,17 @@ namespace etl
     //*************************************************************************
     shared_message(etl::shared_message&& other) ETL_NOEXCEPT
       : p_rcmessage(etl::move(other.p_rcmessage))
+      , borrowed(false)
     {
-      other.p_rcmessage = ETL_NULLPTR;
+      if (other.borrowed)
+      {
+        // The borrowed reference stays with the lender, so take a new one.
+        p_rcmessage->get_reference_counter().increment_reference_count();
+      }
+      else
+      {
+        other.p_rcmessage = ETL_NULLPTR;
+      }
     }
 #endif
 
@@ -134,13 +162,14 @@ namespace etl
       if (&other != this)
       {
         // Deal with the current message.
-        if (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U)
+        if (!borrowed && (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U))
         {
           p_rcmessage->release();
         }
 
         // Copy over the new one.
         p_rcmessage = other.p_rcmessage;
+        borrowed    = false;
         p_rcmessage->get_reference_counter().increment_reference_count();
        }
 
@@ -156,14 +185,24 @@ namespace etl
       if (&other != this)
       {
         // Deal with the current message.
-        if (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U)
+        if (!borrowed && (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U))
         {
           p_rcmessage->release();
         }
 
         // Move over the new one.
         p_rcmessage = etl::move(other.p_rcmessage);
-        other.p_rcmessage = ETL_NULLPTR;
+        borrowed    = false;
+
+        if (other.borrowed)
+        {
+          // The borrowed reference stays with the lender, so take a new one.
+          p_rcmessage->get_reference_counter().increment_reference_count();
+        }
+        else
+        {
+          other.p_rcmessage = ETL_NULLPTR;
+        }
       }
 
       return *this;
@@ -176,7 +215,8 @@ namespace etl
     //*************************************************************************
     ~shared_message()
     {
-      if ((p_rcmessage != ETL_NULLPTR) &&
+      if (!borrowed &&
+          (p_rcmessage != ETL_NULLPTR) &&
           (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U))
       {
         p_rcmessage->release();
@@ -215,12 +255,112 @@ namespace etl
       return p_rcmessage != ETL_NULLPTR;
     }
 
+    //*************************************************************************
+    /// Checks if the shared message is borrowed.
+    //*************************************************************************
+    ETL_NODISCARD bool is_borrowed() const
+    {
+      return borrowed;
+    }
+
   private:
 
+    struct borrowed_tag {};
+
+    //*************************************************************************
+    /// Constructor for a borrowed shared message.
+    //*************************************************************************
+    shared_message(etl::ireference_counted_message* p_rcmessage_, borrowed_tag)
+      : p_rcmessage(p_rcmessage_)
+      , borrowed(true)
+    {
+    }
+
     shared_message() ETL_DELETE;
 
     etl::ireference_counted_message* p_rcmessage; ///< A pointer to the reference  counted message.
+    bool borrowed;                                ///< Does not hold a reference of its own.
   };
+
+  namespace private_shared_message
+  {
+    //*************************************************************************
+    /// Gets the message to pass on to one of several routers.
+    /// Shared messages are lent, so that passing them on does not change
+    /// the reference count.
+    //*************************************************************************
+    inline const etl::imessage& lend(const etl::imessage& msg)
+    {
+      return msg;
+    }
+
+    inline etl::shared_message lend(const etl::shared_message& shared_msg)
+    {
+      return etl::shared_message::borrow(shared_msg);
+    }
+
+    //*************************************************************************
+    /// Holds a shared message, or nothing.
+    /// Used by message timers, which are default constructed in place.
+    //*************************************************************************
+    class holder
+    {
+    public:
+
+      holder()
+        : valid(false)
+      {
+      }
+
+      ~holder()
+      {
+        reset();
+      }
+
+      //*******************************
+      /// Takes a reference to the shared message.
+      //*******************************
+      void set(const etl::shared_message& shared_msg)
+      {
+        reset();
+        ::new (storage.get_address<etl::shared_message>()) etl::shared_message(shared_msg);
+        valid = true;
+      }
+
+      //*******************************
+      /// Releases the reference to the shared message, if held.
+      //*******************************
+      void reset()
+      {
+        if (valid)
+        {
+          storage.get_reference<etl::shared_message>().~shared_message();
+          valid = false;
+        }
+      }
+
+      //*******************************
+      bool has_value() const
+      {
+        return valid;
+      }
+
+      //*******************************
+      const etl::shared_message& value() const
+      {
+        return storage.get_reference<etl::shared_message>();
+      }
+
+    private:
+
+      // Disabled.
+      holder(const holder&) ETL_DELETE;
+      holder& operator =(const holder&) ETL_DELETE;
+
+      etl::aligned_storage<sizeof(etl::shared_message), etl::alignment_of<etl::shared_message>::value>::type storage;
+      bool valid;
+    };
+  }
 }
 
 #endif
@@ -0,0 +1,222 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARED_MUTEX_INCLUDED
+#define ETL_SHARED_MUTEX_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "spin_mutex.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A reader-writer spin lock.
+  /// Any number of readers may hold the lock at once, or one writer.
+  /// A waiting writer stops new readers from entering, so writers are not
+  /// starved by a stream of readers.
+  //***************************************************************************
+  class shared_mutex
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    shared_mutex()
+      : state(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Locks the mutex for exclusive access.
+    //*************************************************************************
+    void lock()
+    {
+      uint32_t s = state.load(etl::memory_order_relaxed);
+
+      for (;;)
+      {
+        if ((s & (Writer | Reader_Mask)) == 0U)
+        {
+          // Free. Take it, clearing our waiting flag.
+          if (state.compare_exchange_weak(s, Writer, etl::memory_order_acquire, etl::memory_order_relaxed))
+          {
+            return;
+          }
+        }
+        else if ((s & Writer_Waiting) == 0U)
+        {
+          // Stop new readers.
+          state.compare_exchange_weak(s, s | Writer_Waiting, etl::memory_order_relaxed, etl::memory_order_relaxed);
+        }
+        else
+        {
+          ETL_SPIN_PAUSE();
+          s = state.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Tries to lock the mutex for exclusive access.
+    /// Returns <b>true</b> if locked.
+    //*************************************************************************
+    bool try_lock()
+    {
+      uint32_t s = state.load(etl::memory_order_relaxed);
+
+      return ((s & (Writer | Reader_Mask)) == 0U) &&
+             state.compare_exchange_strong(s, Writer, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Unlocks the mutex from exclusive access.
+    //*************************************************************************
+    void unlock()
+    {
+      // Another writer may have set its waiting flag.
+      state.fetch_and(~static_cast<uint32_t>(Writer), etl::memory_order_release);
+      ETL_SPIN_NOTIFY();
+    }
+
+    //*************************************************************************
+    /// Locks the mutex for shared access.
+    //*************************************************************************
+    void lock_shared()
+    {
+      uint32_t s = state.load(etl::memory_order_relaxed);
+
+      for (;;)
+      {
+        if ((s & (Writer | Writer_Waiting)) == 0U)
+        {
+          if (state.compare_exchange_weak(s, s + 1U, etl::memory_order_acquire, etl::memory_order_relaxed))
+          {
+            return;
+          }
+        }
+        else
+        {
+          ETL_SPIN_PAUSE();
+          s = state.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Tries to lock the mutex for shared access.
+    /// Returns <b>true</b> if locked.
+    //*************************************************************************
+    bool try_lock_shared()
+    {
+      uint32_t s = state.load(etl::memory_order_relaxed);
+
+      while ((s & (Writer | Writer_Waiting)) == 0U)
+      {
+        if (state.compare_exchange_weak(s, s + 1U, etl::memory_order_acquire, etl::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Unlocks the mutex from shared access.
+    //*************************************************************************
+    void unlock_shared()
+    {
+      state.fetch_sub(1U, etl::memory_order_release);
+      ETL_SPIN_NOTIFY();
+    }
+
+  private:
+
+    enum
+    {
+      Writer         = 0x80000000UL,
+      Writer_Waiting = 0x40000000UL,
+      Reader_Mask    = 0x3FFFFFFFUL
+    };
+
+    shared_mutex(const shared_mutex&) ETL_DELETE;
+    shared_mutex& operator =(const shared_mutex&) ETL_DELETE;
+
+    etl::atomic<uint32_t> state;
+  };
+
+  //***************************************************************************
+  /// shared_lock
+  /// A mutex wrapper that provides an RAII mechanism for shared ownership of
+  /// a mutex for the duration of a scoped block.
+  //***************************************************************************
+  template <typename TMutex>
+  class shared_lock
+  {
+  public:
+
+    typedef TMutex mutex_type;
+
+    //*****************************************************
+    /// Constructor
+    /// Locks the mutex for shared access.
+    //*****************************************************
+    explicit shared_lock(mutex_type& m_)
+      : m(m_)
+    {
+      m.lock_shared();
+    }
+
+    //*****************************************************
+    /// Destructor
+    //*****************************************************
+    ~shared_lock()
+    {
+      m.unlock_shared();
+    }
+
+  private:
+
+    // Deleted.
+    shared_lock(const shared_lock&) ETL_DELETE;
+
+    mutex_type& m;
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,229 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SIZE_CLASS_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_SIZE_CLASS_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "generic_pool.h"
+#include "static_assert.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  namespace private_size_class_memory_block_allocator
+  {
+    //*************************************************************************
+    /// Holds a generic_pool for each size class.
+    //*************************************************************************
+    template <size_t VAlignment, size_t VBlocks, size_t... VSizes>
+    struct pool_list;
+
+    template <size_t VAlignment, size_t VBlocks, size_t VSize, size_t VNext, size_t... VRest>
+    struct pool_list<VAlignment, VBlocks, VSize, VNext, VRest...>
+    {
+      ETL_STATIC_ASSERT(VSize < VNext, "Block sizes must be in ascending order");
+
+      static ETL_CONSTANT size_t Largest = pool_list<VAlignment, VBlocks, VNext, VRest...>::Largest;
+
+      void get_pools(etl::ipool** pp_pool)
+      {
+        *pp_pool = &pool;
+        rest.get_pools(pp_pool + 1);
+      }
+
+      etl::generic_pool<VSize, VAlignment, VBlocks>   pool;
+      pool_list<VAlignment, VBlocks, VNext, VRest...> rest;
+    };
+
+    template <size_t VAlignment, size_t VBlocks, size_t VSize>
+    struct pool_list<VAlignment, VBlocks, VSize>
+    {
+      static ETL_CONSTANT size_t Largest = VSize;
+
+      void get_pools(etl::ipool** pp_pool)
+      {
+        *pp_pool = &pool;
+      }
+
+      etl::generic_pool<VSize, VAlignment, VBlocks> pool;
+    };
+  }
+
+  //*************************************************************************
+  /// A memory block allocator with a pool for each of a list of block sizes.
+  /// A request is served from the smallest class that fits, found with a
+  /// lookup table, so there is no walk along a chain of allocators.
+  /// If that class is exhausted, the larger classes are tried, then the successor.
+  /// \tparam VAlignment The alignment of all of the blocks.
+  /// \tparam VBlocks    The number of blocks in each class.
+  /// \tparam VSizes     The block sizes, in ascending order.
+  //*************************************************************************
+  template <size_t VAlignment, size_t VBlocks, size_t... VSizes>
+  class size_class_memory_block_allocator : public imemory_block_allocator
+  {
+  private:
+
+    typedef private_size_class_memory_block_allocator::pool_list<VAlignment, VBlocks, VSizes...> pool_list_t;
+
+  public:
+
+    static ETL_CONSTANT size_t Alignment          = VAlignment;
+    static ETL_CONSTANT size_t Blocks_Per_Class   = VBlocks;
+    static ETL_CONSTANT size_t Number_Of_Classes  = sizeof...(VSizes);
+    static ETL_CONSTANT size_t Largest_Block_Size = pool_list_t::Largest;
+
+    ETL_STATIC_ASSERT(Number_Of_Classes > 0U, "At least one block size is required");
+    ETL_STATIC_ASSERT(Number_Of_Classes < 255U, "Too many block sizes");
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    size_class_memory_block_allocator()
+    {
+      pools.get_pools(p_pools);
+
+      const size_t sizes[] = { VSizes... };
+
+      // Map each multiple of the alignment to the smallest class that holds it.
+      size_t class_index = 0U;
+
+      for (size_t i = 0U; i < Lookup_Size; ++i)
+      {
+        while (sizes[class_index] < (i * Alignment))
+        {
+          ++class_index;
+        }
+
+        lookup[i] = static_cast<uint8_t>(class_index);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the pool for a size class.
+    //*************************************************************************
+    const etl::ipool& get_pool(size_t class_index) const
+    {
+      return *p_pools[class_index];
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if ((required_alignment <= Alignment) && (required_size <= Largest_Block_Size))
+      {
+        for (size_t i = lookup[(required_size + (Alignment - 1U)) / Alignment]; i < Number_Of_Classes; ++i)
+        {
+          if (!p_pools[i]->full())
+          {
+            return p_pools[i]->template allocate<char>();
+          }
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      etl::ipool* p_pool = find_pool(pblock);
+
+      if (p_pool != ETL_NULLPTR)
+      {
+        p_pool->release(pblock);
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      return find_pool(pblock) != ETL_NULLPTR;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the pool that owns the block.
+    //*************************************************************************
+    etl::ipool* find_pool(const void* const pblock) const
+    {
+      for (size_t i = 0U; i < Number_Of_Classes; ++i)
+      {
+        if (p_pools[i]->is_in_pool(pblock))
+        {
+          return p_pools[i];
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    static ETL_CONSTANT size_t Lookup_Size = ((Largest_Block_Size + (VAlignment - 1U)) / VAlignment) + 1U;
+
+    pool_list_t  pools;                       ///< The pools, one for each size class.
+    etl::ipool*  p_pools[Number_Of_Classes];  ///< The pools, in class order.
+    uint8_t      lookup[Lookup_Size];         ///< Maps the size, in units of the alignment, to a class.
+  };
+
+  template <size_t VAlignment, size_t VBlocks, size_t... VSizes>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, VBlocks, VSizes...>::Alignment;
+
+  template <size_t VAlignment, size_t VBlocks, size_t... VSizes>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, VBlocks, VSizes...>::Blocks_Per_Class;
+
+  template <size_t VAlignment, size_t VBlocks, size_t... VSizes>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, VBlocks, VSizes...>::Number_Of_Classes;
+
+  template <size_t VAlignment, size_t VBlocks, size_t... VSizes>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, VBlocks, VSizes...>::Largest_Block_Size;
+
+  template <size_t VAlignment, size_t VBlocks, size_t... VSizes>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, VBlocks, VSizes...>::Lookup_Size;
+}
+
+#endif
+#endif
@@ -0,0 +1,388 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLIDING_WINDOW_STATISTICS_INCLUDED
+#define ETL_SLIDING_WINDOW_STATISTICS_INCLUDED
+
+#include "platform.h"
+#include "circular_buffer.h"
+#include "functional.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "private/statistics_sums.h"
+
+#include <math.h>
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_sliding_window_statistics
+  {
+    //***************************************************************************
+    /// A monotonic queue of the samples in the window.
+    /// Each sample removes the samples behind it that it beats, as they can
+    /// never be the extreme, so the front is always the extreme of the window.
+    /// Each sample is pushed and popped at most once, so updates are O(1) amortised.
+    //***************************************************************************
+    template <typename T, size_t Size, typename TCompare>
+    class monotonic_queue
+    {
+    public:
+
+      //*********************************
+      monotonic_queue()
+      {
+        clear();
+      }
+
+      //*********************************
+      /// Adds a sample, after removing those it beats.
+      //*********************************
+      void push(T value, size_t sequence)
+      {
+        TCompare compare;
+
+        while ((length != 0U) && !compare(entries[index(length - 1U)].value, value))
+        {
+          --length;
+        }
+
+        entry& e = entries[index(length)];
+        e.value    = value;
+        e.sequence = sequence;
+        ++length;
+      }
+
+      //*********************************
+      /// Removes the samples that are out of the window ending at newest.
+      /// Compares ages, so is unaffected by the sequence wrapping.
+      //*********************************
+      void expire(size_t newest)
+      {
+        while ((length != 0U) && ((newest - entries[first].sequence) >= Size))
+        {
+          first = (first + 1U) % Size;
+          --length;
+        }
+      }
+
+      //*********************************
+      /// The extreme sample.
+      //*********************************
+      T front() const
+      {
+        return (length != 0U) ? entries[first].value : T();
+      }
+
+      //*********************************
+      void clear()
+      {
+        first  = 0U;
+        length = 0U;
+      }
+
+    private:
+
+      struct entry
+      {
+        T      value;
+        size_t sequence;
+      };
+
+      //*********************************
+      size_t index(size_t i) const
+      {
+        return (first + i) % Size;
+      }
+
+      entry  entries[Size];
+      size_t first;
+      size_t length;
+    };
+  }
+
+  //***************************************************************************
+  /// Sliding window statistics.
+  /// The exact mean, variance, minimum and maximum of the last Window_Size
+  /// samples, each updated in O(1) as a sample is added.
+  /// The mean and variance come from running sums, to which each sample is
+  /// added as it enters the window and from which it is subtracted as it
+  /// leaves. For floating point calculation types the sums are of the
+  /// deviations from the first sample, to reduce cancellation.
+  /// The minimum and maximum come from monotonic queues.
+  ///\tparam T           The sample value type.
+  ///\tparam Window_Size The number of samples in the window.
+  ///\tparam TCalc       The type used for the running sums. Default double.
+  //***************************************************************************
+  template <typename T, size_t Window_Size, typename TCalc = double>
+  class sliding_window_statistics
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Window_Size > 0U, "Zero window size");
+
+    typedef T     value_type;
+    typedef TCalc calc_type;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    sliding_window_statistics()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    sliding_window_statistics(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    /// If the window is full, the oldest value leaves it.
+    //*********************************
+    void add(T value)
+    {
+      if (samples.empty())
+      {
+        shift = private_statistics::get_shift<TCalc>(value);
+      }
+
+      if (samples.full())
+      {
+        const TCalc deviation = TCalc(samples.front()) - shift;
+
+        sum            -= deviation;
+        sum_of_squares -= deviation * deviation;
+
+        samples.pop();
+      }
+
+      const TCalc deviation = TCalc(value) - shift;
+
+      sum            += deviation;
+      sum_of_squares += deviation * deviation;
+
+      samples.push(value);
+
+      minimum.expire(sequence);
+      maximum.expire(sequence);
+      minimum.push(value, sequence);
+      maximum.push(value, sequence);
+
+      ++sequence;
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(T value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Get the mean of the window.
+    //*********************************
+    double get_mean() const
+    {
+      if (samples.empty())
+      {
+        return 0.0;
+      }
+
+      return double(shift) + (double(sum) / double(samples.size()));
+    }
+
+    //*********************************
+    /// Get the population variance of the window.
+    //*********************************
+    double get_variance() const
+    {
+      return get_variance(0U);
+    }
+
+    //*********************************
+    /// Get the sample variance of the window.
+    //*********************************
+    double get_sample_variance() const
+    {
+      return get_variance(1U);
+    }
+
+    //*********************************
+    /// Get the population standard deviation of the window.
+    //*********************************
+    double get_standard_deviation() const
+    {
+      return sqrt(get_variance());
+    }
+
+    //*********************************
+    /// Get the sample standard deviation of the window.
+    //*********************************
+    double get_sample_standard_deviation() const
+    {
+      return sqrt(get_sample_variance());
+    }
+
+    //*********************************
+    /// Get the minimum of the window.
+    /// Returns a default constructed value if the window is empty.
+    //*********************************
+    T get_min() const
+    {
+      return minimum.front();
+    }
+
+    //*********************************
+    /// Get the maximum of the window.
+    /// Returns a default constructed value if the window is empty.
+    //*********************************
+    T get_max() const
+    {
+      return maximum.front();
+    }
+
+    //*********************************
+    /// The samples in the window, oldest first.
+    //*********************************
+    const etl::icircular_buffer<T>& window() const
+    {
+      return samples;
+    }
+
+    //*********************************
+    /// Get the number of samples in the window.
+    //*********************************
+    size_t count() const
+    {
+      return samples.size();
+    }
+
+    //*********************************
+    /// Returns true if the window is empty.
+    //*********************************
+    bool empty() const
+    {
+      return samples.empty();
+    }
+
+    //*********************************
+    /// Returns true if the window is full.
+    //*********************************
+    bool full() const
+    {
+      return samples.full();
+    }
+
+    //*********************************
+    /// Clear the window.
+    //*********************************
+    void clear()
+    {
+      samples.clear();
+      minimum.clear();
+      maximum.clear();
+      sum            = TCalc(0);
+      sum_of_squares = TCalc(0);
+      shift          = TCalc(0);
+      sequence       = 0U;
+    }
+
+  private:
+
+    //*********************************
+    /// The variance, with n - adjustment as the divisor.
+    //*********************************
+    double get_variance(size_t adjustment) const
+    {
+      const size_t count = samples.size();
+
+      if (count <= adjustment)
+      {
+        return 0.0;
+      }
+
+      const double n        = double(count);
+      const double variance = ((n * double(sum_of_squares)) - (double(sum) * double(sum))) / (n * (n - double(adjustment)));
+
+      // Rounding of the running sums may leave a tiny negative value.
+      return (variance > 0.0) ? variance : 0.0;
+    }
+
+    typedef private_sliding_window_statistics::monotonic_queue<T, Window_Size, etl::less<T> >    minimum_queue;
+    typedef private_sliding_window_statistics::monotonic_queue<T, Window_Size, etl::greater<T> > maximum_queue;
+
+    etl::circular_buffer<T, Window_Size> samples;
+    minimum_queue                        minimum;
+    maximum_queue                        maximum;
+    TCalc                                sum;
+    TCalc                                sum_of_squares;
+    TCalc                                shift;
+    size_t                               sequence;
+  };
+
+  template <typename T, size_t Window_Size, typename TCalc>
+  ETL_CONSTANT size_t sliding_window_statistics<T, Window_Size, TCalc>::WINDOW_SIZE;
+}
+
+#endif
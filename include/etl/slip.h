@@ -0,0 +1,705 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLIP_INCLUDED
+#define ETL_SLIP_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "iterator.h"
+#include "delegate.h"
+#include "span.h"
+
+#include "private/framing.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup slip slip
+/// Serial Line Internet Protocol framing, as RFC 1055.
+/// Each frame ends with END. END and ESC in the data are escaped.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// SLIP constants.
+  ///\ingroup slip
+  //***************************************************************************
+  struct slip
+  {
+    static ETL_CONSTANT uint8_t End     = 0xC0U; ///< The frame delimiter.
+    static ETL_CONSTANT uint8_t Esc     = 0xDBU; ///< The escape byte.
+    static ETL_CONSTANT uint8_t Esc_End = 0xDCU; ///< Esc Esc_End is an escaped End.
+    static ETL_CONSTANT uint8_t Esc_Esc = 0xDDU; ///< Esc Esc_Esc is an escaped Esc.
+
+    //*************************************************************************
+    /// The largest encoding of 'length' bytes, with the delimiter.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t max_encoded_size(size_t length)
+    {
+      return (2U * length) + 1U;
+    }
+  };
+
+  //***************************************************************************
+  /// SLIP encoder.
+  /// Pointer ranges find each End and Esc word at a time and copy the runs
+  /// between.
+  /// If there is a callback, it is called with each full output buffer and,
+  /// on flush, with the rest of the frame and then an empty span.
+  ///\ingroup slip
+  //***************************************************************************
+  class islip_encoder
+  {
+  public:
+
+    typedef private_framing::output_buffer::span_type     span_type;
+    typedef private_framing::output_buffer::callback_type callback_type;
+
+    //*************************************************************************
+    /// Encodes a byte.
+    //*************************************************************************
+    template <typename T>
+    bool encode(T value)
+    {
+      ETL_STATIC_ASSERT(etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), "Input type must be an 8 bit integral");
+
+      add(static_cast<uint8_t>(value));
+
+      return !error();
+    }
+
+    //*************************************************************************
+    /// Encodes a range of bytes.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool encode(TInputIterator input_begin, size_t input_length)
+    {
+      typedef typename etl::iterator_traits<TInputIterator>::value_type value_type;
+
+      ETL_STATIC_ASSERT(etl::is_integral<value_type>::value && (etl::integral_limits<value_type>::bits == 8U), "Input type must be an 8 bit integral");
+
+      add_range(input_begin, input_length, etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value>());
+
+      return !error();
+    }
+
+    //*************************************************************************
+    /// Encodes a range of bytes.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool encode(TInputIterator input_begin, TInputIterator input_end)
+    {
+      return encode(input_begin, static_cast<size_t>(etl::distance(input_begin, input_end)));
+    }
+
+    //*************************************************************************
+    /// Encodes a range of bytes and ends the frame.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool encode_final(TInputIterator input_begin, size_t input_length)
+    {
+      return encode(input_begin, input_length) && flush();
+    }
+
+    //*************************************************************************
+    /// Encodes a range of bytes and ends the frame.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool encode_final(TInputIterator input_begin, TInputIterator input_end)
+    {
+      return encode(input_begin, input_end) && flush();
+    }
+
+    //*************************************************************************
+    /// Ends the frame with End.
+    //*************************************************************************
+    bool flush()
+    {
+      output.push(slip::End, true);
+
+      if (!error() && output.callback.is_valid())
+      {
+        if (output.length != 0U)
+        {
+          output.callback(output.span());
+        }
+
+        // Indicate the end of the frame.
+        output.callback(span_type());
+
+        output.length = 0U;
+      }
+
+      return !error();
+    }
+
+    //*************************************************************************
+    /// Resets the encoder.
+    //*************************************************************************
+    void restart()
+    {
+      output.length     = 0U;
+      output.overflowed = false;
+    }
+
+    //*************************************************************************
+    /// The beginning of the output buffer.
+    //*************************************************************************
+    const uint8_t* begin() const
+    {
+      return output.p_buffer;
+    }
+
+    //*************************************************************************
+    /// The end of the output buffer.
+    /// Only useful if a callback has not been set or called.
+    //*************************************************************************
+    const uint8_t* end() const
+    {
+      return output.p_buffer + output.length;
+    }
+
+    //*************************************************************************
+    /// The size of the output.
+    /// Only useful if a callback has not been set or called.
+    //*************************************************************************
+    size_t size() const
+    {
+      return output.length;
+    }
+
+    //*************************************************************************
+    /// The size of the output buffer.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return output.max_size;
+    }
+
+    //*************************************************************************
+    /// A span of the output.
+    /// Only useful if a callback has not been set or called.
+    //*************************************************************************
+    span_type span() const
+    {
+      return output.span();
+    }
+
+    //*************************************************************************
+    /// Whether the output buffer has overflowed.
+    //*************************************************************************
+    bool overflow() const
+    {
+      return output.overflowed;
+    }
+
+    //*************************************************************************
+    /// Whether an error was detected.
+    //*************************************************************************
+    bool error() const
+    {
+      return overflow();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    islip_encoder(uint8_t* p_output_buffer_, size_t output_buffer_max_size_, callback_type callback_)
+      : output(p_output_buffer_, output_buffer_max_size_, callback_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a byte to the frame.
+    //*************************************************************************
+    void add(uint8_t value)
+    {
+      if (value == slip::End)
+      {
+        const uint8_t escaped[2] = { slip::Esc, slip::Esc_End };
+        output.push(escaped, 2U, true);
+      }
+      else if (value == slip::Esc)
+      {
+        const uint8_t escaped[2] = { slip::Esc, slip::Esc_Esc };
+        output.push(escaped, 2U, true);
+      }
+      else
+      {
+        output.push(value, true);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    void add_range(TInputIterator input, size_t length, etl::false_type)
+    {
+      while (length-- != 0U)
+      {
+        add(static_cast<uint8_t>(*input));
+        ++input;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, copying the runs between End and Esc.
+    //*************************************************************************
+    template <typename TInputIterator>
+    void add_range(TInputIterator input, size_t length, etl::true_type)
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(input);
+
+      while (length != 0U)
+      {
+        const size_t run = private_framing::find_either(p, length, slip::End, slip::Esc);
+
+        output.push(p, run, true);
+
+        p      += run;
+        length -= run;
+
+        if (length != 0U)
+        {
+          add(*p);
+          ++p;
+          --length;
+        }
+      }
+    }
+
+    private_framing::output_buffer output;
+  };
+
+  //***************************************************************************
+  /// SLIP encoder with an output buffer of Buffer_Size bytes.
+  ///\ingroup slip
+  //***************************************************************************
+  template <size_t Buffer_Size>
+  class slip_encoder : public islip_encoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Buffer_Size > 0U, "Buffer size must be greater than 0");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    slip_encoder()
+      : islip_encoder(output_buffer, Buffer_Size, callback_type())
+      , output_buffer()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a callback for the output.
+    //*************************************************************************
+    slip_encoder(callback_type callback_)
+      : islip_encoder(output_buffer, Buffer_Size, callback_)
+      , output_buffer()
+    {
+    }
+
+  private:
+
+    /// The internal output buffer.
+    uint8_t output_buffer[Buffer_Size];
+  };
+
+  //***************************************************************************
+  /// SLIP decoder.
+  /// Decodes a stream of frames. A frame ends with End. Empty frames, from
+  /// consecutive End bytes, are ignored.
+  /// If there is a callback, it is called with each complete frame.
+  /// Otherwise decoding stops after each complete frame, which stays in the
+  /// buffer until the next call to decode.
+  /// A frame with an invalid escape, or too large for the buffer, is dropped
+  /// at its End, and decode returns false.
+  /// Pointer ranges find each End and Esc word at a time and copy the runs
+  /// between.
+  ///\ingroup slip
+  //***************************************************************************
+  class islip_decoder
+  {
+  public:
+
+    typedef private_framing::output_buffer::span_type     span_type;
+    typedef private_framing::output_buffer::callback_type callback_type;
+
+    //*************************************************************************
+    /// Decodes a byte.
+    //*************************************************************************
+    template <typename T>
+    bool decode(T value)
+    {
+      ETL_STATIC_ASSERT(etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), "Input type must be an 8 bit integral");
+
+      return add(static_cast<uint8_t>(value));
+    }
+
+    //*************************************************************************
+    /// Decodes a range of bytes.
+    /// Without a callback, stops after a complete frame.
+    /// Returns false if a frame was dropped.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool decode(TInputIterator input_begin, size_t input_length)
+    {
+      typedef typename etl::iterator_traits<TInputIterator>::value_type value_type;
+
+      ETL_STATIC_ASSERT(etl::is_integral<value_type>::value && (etl::integral_limits<value_type>::bits == 8U), "Input type must be an 8 bit integral");
+
+      consumed = 0U;
+
+      return add_range(input_begin, input_length, etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Decodes a range of bytes.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool decode(TInputIterator input_begin, TInputIterator input_end)
+    {
+      return decode(input_begin, static_cast<size_t>(etl::distance(input_begin, input_end)));
+    }
+
+    //*************************************************************************
+    /// The number of bytes used by the last range decode.
+    /// Less than the length if it stopped after a complete frame.
+    //*************************************************************************
+    size_t used() const
+    {
+      return consumed;
+    }
+
+    //*************************************************************************
+    /// Whether the buffer holds a complete frame.
+    /// Only set if there is no callback.
+    //*************************************************************************
+    bool complete() const
+    {
+      return frame_complete;
+    }
+
+    //*************************************************************************
+    /// Resets the decoder.
+    //*************************************************************************
+    void restart()
+    {
+      reset_frame();
+      output.length  = 0U;
+      frame_complete = false;
+    }
+
+    //*************************************************************************
+    /// The beginning of the frame.
+    //*************************************************************************
+    const uint8_t* begin() const
+    {
+      return output.p_buffer;
+    }
+
+    //*************************************************************************
+    /// The end of the frame.
+    //*************************************************************************
+    const uint8_t* end() const
+    {
+      return output.p_buffer + output.length;
+    }
+
+    //*************************************************************************
+    /// The size of the frame, or of the frame so far.
+    //*************************************************************************
+    size_t size() const
+    {
+      return output.length;
+    }
+
+    //*************************************************************************
+    /// The size of the frame buffer.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return output.max_size;
+    }
+
+    //*************************************************************************
+    /// A span of the frame.
+    //*************************************************************************
+    span_type span() const
+    {
+      return output.span();
+    }
+
+    //*************************************************************************
+    /// Whether the current frame is too large for the buffer.
+    //*************************************************************************
+    bool overflow() const
+    {
+      return output.overflowed;
+    }
+
+    //*************************************************************************
+    /// Whether the current frame has an invalid escape.
+    //*************************************************************************
+    bool invalid() const
+    {
+      return malformed;
+    }
+
+    //*************************************************************************
+    /// Whether an error was detected in the current frame.
+    //*************************************************************************
+    bool error() const
+    {
+      return overflow() || invalid();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    islip_decoder(uint8_t* p_buffer_, size_t buffer_max_size_, callback_type callback_)
+      : output(p_buffer_, buffer_max_size_, callback_)
+      , consumed(0U)
+      , escaped(false)
+      , in_frame(false)
+      , malformed(false)
+      , frame_complete(false)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a byte. Returns false if it ended a frame that was dropped.
+    //*************************************************************************
+    bool add(uint8_t value)
+    {
+      if (frame_complete)
+      {
+        output.length  = 0U;
+        frame_complete = false;
+      }
+
+      if (value == slip::End)
+      {
+        return end_frame();
+      }
+
+      in_frame = true;
+
+      if (escaped)
+      {
+        escaped = false;
+
+        if (value == slip::Esc_End)
+        {
+          output.push(slip::End, false);
+        }
+        else if (value == slip::Esc_Esc)
+        {
+          output.push(slip::Esc, false);
+        }
+        else
+        {
+          malformed = true;
+        }
+      }
+      else if (value == slip::Esc)
+      {
+        escaped = true;
+      }
+      else
+      {
+        output.push(value, false);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool add_range(TInputIterator input, size_t length, etl::false_type)
+    {
+      bool success = true;
+
+      while ((length != 0U) && !(frame_complete && (consumed != 0U)))
+      {
+        success = add(static_cast<uint8_t>(*input)) && success;
+        ++input;
+        ++consumed;
+        --length;
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, copying the runs between End and Esc.
+    //*************************************************************************
+    template <typename TInputIterator>
+    bool add_range(TInputIterator input, size_t length, etl::true_type)
+    {
+      const uint8_t* const p_begin = reinterpret_cast<const uint8_t*>(input);
+      const uint8_t*       p       = p_begin;
+
+      bool success = true;
+
+      while ((length != 0U) && !(frame_complete && (p != p_begin)))
+      {
+        const size_t run = (escaped || frame_complete) ? 0U : private_framing::find_either(p, length, slip::End, slip::Esc);
+
+        if (run == 0U)
+        {
+          success = add(*p) && success;
+          ++p;
+          --length;
+        }
+        else
+        {
+          output.push(p, run, false);
+          in_frame = true;
+
+          p      += run;
+          length -= run;
+        }
+      }
+
+      consumed = static_cast<size_t>(p - p_begin);
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Ends a frame. Returns false if it was dropped.
+    //*************************************************************************
+    bool end_frame()
+    {
+      if (!in_frame)
+      {
+        // An empty frame.
+        return true;
+      }
+
+      malformed = malformed || escaped;
+
+      const bool success = !error();
+
+      if (success)
+      {
+        if (output.callback.is_valid())
+        {
+          output.callback(output.span());
+          output.length = 0U;
+        }
+        else
+        {
+          frame_complete = true;
+        }
+      }
+      else
+      {
+        output.length = 0U;
+      }
+
+      reset_frame();
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Resets the state for a new frame.
+    //*************************************************************************
+    void reset_frame()
+    {
+      escaped           = false;
+      in_frame          = false;
+      malformed         = false;
+      output.overflowed = false;
+    }
+
+    private_framing::output_buffer output;
+    size_t                         consumed;
+    bool                           escaped;
+    bool                           in_frame;
+    bool                           malformed;
+    bool                           frame_complete;
+  };
+
+  //***************************************************************************
+  /// SLIP decoder for frames of up to Buffer_Size bytes.
+  ///\ingroup slip
+  //***************************************************************************
+  template <size_t Buffer_Size>
+  class slip_decoder : public islip_decoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Buffer_Size > 0U, "Buffer size must be greater than 0");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    slip_decoder()
+      : islip_decoder(frame_buffer, Buffer_Size, callback_type())
+      , frame_buffer()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a callback for each frame.
+    //*************************************************************************
+    slip_decoder(callback_type callback_)
+      : islip_decoder(frame_buffer, Buffer_Size, callback_)
+      , frame_buffer()
+    {
+    }
+
+  private:
+
+    /// The internal frame buffer.
+    uint8_t frame_buffer[Buffer_Size];
+  };
+}
+
+#endif
@@ -0,0 +1,744 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLOT_MAP_INCLUDED
+#define ETL_SLOT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "power.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup slot_map slot_map
+/// A container that gives each value a stable 32 bit handle, with the
+/// capacity defined at compile time.
+/// The values are packed densely, so iteration is a scan of an array.
+/// A sparse table of slots maps handles to values. Each handle holds a slot
+/// index and the slot's generation, which changes when the value is erased,
+/// so old handles are detected rather than reaching a new value.
+/// Has insertion, erasure and lookup of O(1).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_exception : public etl::exception
+  {
+  public:
+
+    slot_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_full : public etl::slot_map_exception
+  {
+  public:
+
+    slot_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::slot_map_exception(ETL_ERROR_TEXT("slot_map:full", ETL_SLOT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid handle exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_invalid_handle : public etl::slot_map_exception
+  {
+  public:
+
+    slot_map_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : etl::slot_map_exception(ETL_ERROR_TEXT("slot_map:invalid handle", ETL_SLOT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized slot_maps.
+  /// Can be used as a reference type for all slot_maps containing a specific type.
+  /// A slot's generation is odd while it holds a value and even while it is
+  /// free, so a handle can only match a slot in use. The generation wraps
+  /// after 2^(32 - index bits) uses of a slot.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T>
+  class islot_map
+  {
+  public:
+
+    typedef T                 value_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+#if ETL_USING_CPP11
+    typedef T&&               rvalue_reference;
+#endif
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef T*                iterator;
+    typedef const T*          const_iterator;
+    typedef size_t            size_type;
+    typedef uint32_t          handle_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /// A handle that never refers to a value.
+    static ETL_CONSTANT handle_type Null_Handle = 0U;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the values.
+    /// The values are not in insertion order.
+    //*************************************************************************
+    iterator begin()
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the values.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the values.
+    //*************************************************************************
+    iterator end()
+    {
+      return p_buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the values.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the values.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the values.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the end of the values.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end of the values.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the beginning of the values.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the beginning of the values.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the packed values.
+    //*************************************************************************
+    pointer data()
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the packed values.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Inserts a value.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle for the value, or Null_Handle if the slot_map is full.
+    //*************************************************************************
+    handle_type insert(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), Null_Handle);
+
+      ::new (p_buffer + current_size) T(value);
+
+      return commit_insert();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle for the value, or Null_Handle if the slot_map is full.
+    //*************************************************************************
+    handle_type insert(rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), Null_Handle);
+
+      ::new (p_buffer + current_size) T(etl::move(value));
+
+      return commit_insert();
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_SLOT_MAP_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle for the value, or Null_Handle if the slot_map is full.
+    //*************************************************************************
+    template <typename ... Args>
+    handle_type emplace(Args && ... args)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), Null_Handle);
+
+      ::new (p_buffer + current_size) T(etl::forward<Args>(args)...);
+
+      return commit_insert();
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle for the value, or Null_Handle if the slot_map is full.
+    //*************************************************************************
+    handle_type emplace()
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), Null_Handle);
+
+      ::new (p_buffer + current_size) T();
+
+      return commit_insert();
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle for the value, or Null_Handle if the slot_map is full.
+    //*************************************************************************
+    template <typename T1>
+    handle_type emplace(const T1& value1)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), Null_Handle);
+
+      ::new (p_buffer + current_size) T(value1);
+
+      return commit_insert();
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle for the value, or Null_Handle if the slot_map is full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    handle_type emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), Null_Handle);
+
+      ::new (p_buffer + current_size) T(value1, value2);
+
+      return commit_insert();
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle for the value, or Null_Handle if the slot_map is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    handle_type emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), Null_Handle);
+
+      ::new (p_buffer + current_size) T(value1, value2, value3);
+
+      return commit_insert();
+    }
+
+    //*************************************************************************
+    /// Constructs a value in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the
+    /// slot_map is full.
+    ///\return The handle for the value, or Null_Handle if the slot_map is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    handle_type emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(slot_map_full), Null_Handle);
+
+      ::new (p_buffer + current_size) T(value1, value2, value3, value4);
+
+      return commit_insert();
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value for a handle.
+    /// The last value is moved in to its place.
+    ///\return <b>true</b> if the handle was valid.
+    //*************************************************************************
+    bool erase(handle_type handle)
+    {
+      const uint32_t slot = handle & index_mask;
+
+      if (!is_valid(handle, slot))
+      {
+        return false;
+      }
+
+      const uint32_t dense = p_slots[slot].index;
+      const uint32_t last  = uint32_t(current_size - 1U);
+
+      if (dense != last)
+      {
+        p_buffer[dense] = ETL_MOVE(p_buffer[last]);
+
+        const uint32_t moved_slot = p_dense_to_slot[last];
+
+        p_dense_to_slot[dense]   = moved_slot;
+        p_slots[moved_slot].index = dense;
+      }
+
+      p_buffer[last].~T();
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      release_slot(slot);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases the value at an iterator.
+    /// The last value is moved in to its place.
+    ///\return An iterator to the value that is now at the position.
+    //*************************************************************************
+    iterator erase(iterator position)
+    {
+      const size_t dense = size_t(position - p_buffer);
+
+      erase(handle_at(dense));
+
+      return p_buffer + dense;
+    }
+
+    //*************************************************************************
+    /// Finds the value for a handle.
+    ///\return A pointer to the value, or ETL_NULLPTR if the handle is not valid.
+    //*************************************************************************
+    pointer find(handle_type handle)
+    {
+      const uint32_t slot = handle & index_mask;
+
+      return is_valid(handle, slot) ? p_buffer + p_slots[slot].index : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Finds the value for a handle.
+    ///\return A pointer to the value, or ETL_NULLPTR if the handle is not valid.
+    //*************************************************************************
+    const_pointer find(handle_type handle) const
+    {
+      const uint32_t slot = handle & index_mask;
+
+      return is_valid(handle, slot) ? p_buffer + p_slots[slot].index : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks if a handle refers to a value.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return is_valid(handle, handle & index_mask);
+    }
+
+    //*************************************************************************
+    /// Gets the value for a handle.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_handle if
+    /// the handle is not valid.
+    //*************************************************************************
+    reference at(handle_type handle)
+    {
+      pointer p = find(handle);
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(slot_map_invalid_handle));
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Gets the value for a handle.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_handle if
+    /// the handle is not valid.
+    //*************************************************************************
+    const_reference at(handle_type handle) const
+    {
+      const_pointer p = find(handle);
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(slot_map_invalid_handle));
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Gets the handle for the value at a position in the packed values.
+    //*************************************************************************
+    handle_type handle_at(size_t dense_index) const
+    {
+      const uint32_t slot = p_dense_to_slot[dense_index];
+
+      return make_handle(slot, p_slots[slot].generation);
+    }
+
+    //*************************************************************************
+    /// Gets the handle for the value at an iterator.
+    //*************************************************************************
+    handle_type handle_at(const_iterator position) const
+    {
+      return handle_at(size_t(position - p_buffer));
+    }
+
+    //*************************************************************************
+    /// Clears the slot_map. All handles become invalid.
+    //*************************************************************************
+    void clear()
+    {
+      while (current_size != 0U)
+      {
+        --current_size;
+        p_buffer[current_size].~T();
+        ETL_DECREMENT_DEBUG_COUNT;
+
+        release_slot(p_dense_to_slot[current_size]);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the slot_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the slot_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of values.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the number of values that can still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A sparse table entry.
+    /// 'index' is the position of the value while in use, or the next free
+    /// slot while free.
+    //*************************************************************************
+    struct slot_t
+    {
+      uint32_t index;
+      uint32_t generation;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_buffer_        The storage for the packed values.
+    ///\param p_dense_to_slot_ The slot of each packed value.
+    ///\param p_slots_         The sparse table.
+    ///\param capacity_        The maximum number of values.
+    ///\param index_bits_      The number of handle bits for the slot index.
+    //*************************************************************************
+    islot_map(T* p_buffer_, uint32_t* p_dense_to_slot_, slot_t* p_slots_, size_t capacity_, uint32_t index_bits_)
+      : p_buffer(p_buffer_)
+      , p_dense_to_slot(p_dense_to_slot_)
+      , p_slots(p_slots_)
+      , free_list(0U)
+      , current_size(0U)
+      , CAPACITY(capacity_)
+      , index_bits(index_bits_)
+      , index_mask((1UL << index_bits_) - 1U)
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_slots[i].index      = uint32_t(i + 1U);
+        p_slots[i].generation = 0U;
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    islot_map(const islot_map&) ETL_DELETE;
+    islot_map& operator =(const islot_map&) ETL_DELETE;
+
+    //*************************************************************************
+    /// Makes a handle from a slot and generation.
+    //*************************************************************************
+    handle_type make_handle(uint32_t slot, uint32_t generation) const
+    {
+      return (generation << index_bits) | slot;
+    }
+
+    //*************************************************************************
+    /// Checks if a handle matches a slot in use.
+    //*************************************************************************
+    bool is_valid(handle_type handle, uint32_t slot) const
+    {
+      return (slot < CAPACITY) &&
+             ((p_slots[slot].generation & 1U) != 0U) &&
+             (make_handle(slot, p_slots[slot].generation) == handle);
+    }
+
+    //*************************************************************************
+    /// Links the value just constructed at the end of the packed values to a
+    /// free slot.
+    //*************************************************************************
+    handle_type commit_insert()
+    {
+      const uint32_t slot = free_list;
+
+      free_list = p_slots[slot].index;
+
+      // Odd while in use.
+      p_slots[slot].index      = uint32_t(current_size);
+      p_slots[slot].generation = next_generation(p_slots[slot].generation);
+      p_dense_to_slot[current_size] = slot;
+
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return make_handle(slot, p_slots[slot].generation);
+    }
+
+    //*************************************************************************
+    /// Returns a slot to the free list.
+    //*************************************************************************
+    void release_slot(uint32_t slot)
+    {
+      // Even while free.
+      p_slots[slot].generation = next_generation(p_slots[slot].generation);
+      p_slots[slot].index      = free_list;
+      free_list                = slot;
+    }
+
+    //*************************************************************************
+    /// The next generation, wrapping within the handle bits.
+    //*************************************************************************
+    uint32_t next_generation(uint32_t generation) const
+    {
+      return (generation + 1U) & (0xFFFFFFFFUL >> index_bits);
+    }
+
+    T*              p_buffer;
+    uint32_t*       p_dense_to_slot;
+    slot_t*         p_slots;
+    uint32_t        free_list;
+    size_type       current_size;
+    const size_type CAPACITY;
+    const uint32_t  index_bits;
+    const uint32_t  index_mask;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SLOT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~islot_map()
+    {
+    }
+#else
+  protected:
+    ~islot_map()
+    {
+    }
+#endif
+  };
+
+  template <typename T>
+  ETL_CONSTANT typename islot_map<T>::handle_type islot_map<T>::Null_Handle;
+
+  //***************************************************************************
+  /// A slot_map implementation that uses fixed size buffers.
+  ///\tparam T         The value type.
+  ///\tparam MAX_SIZE_ The maximum number of values that can be stored.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_>
+  class slot_map : public etl::islot_map<T>
+  {
+  private:
+
+    typedef etl::islot_map<T> base;
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "slot_map: zero capacity");
+    ETL_STATIC_ASSERT(MAX_SIZE_ <= 0x00800000UL, "slot_map: capacity leaves fewer than 8 generation bits");
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    /// The number of handle bits for the slot index. The rest are the generation.
+    static ETL_CONSTANT uint32_t Index_Bits = (MAX_SIZE_ == 1U) ? 1U : etl::log2<MAX_SIZE_ - 1U>::value + 1U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    slot_map()
+      : base(reinterpret_cast<T*>(&buffer), dense_to_slot, slots, MAX_SIZE, Index_Bits)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~slot_map()
+    {
+      this->clear();
+    }
+
+  private:
+
+    /// The packed values.
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+
+    /// The slot of each packed value.
+    uint32_t dense_to_slot[MAX_SIZE_];
+
+    /// The sparse table.
+    typename base::slot_t slots[MAX_SIZE_];
+  };
+
+  template <typename T, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t slot_map<T, MAX_SIZE_>::MAX_SIZE;
+
+  template <typename T, const size_t MAX_SIZE_>
+  ETL_CONSTANT uint32_t slot_map<T, MAX_SIZE_>::Index_Bits;
+}
+
+#endif
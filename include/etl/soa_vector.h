@@ -0,0 +1,1168 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_VECTOR_INCLUDED
+#define ETL_SOA_VECTOR_INCLUDED
+
+#include "platform.h"
+
+#if ETL_USING_CPP11
+
+#include "algorithm.h"
+#include "iterator.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "memory.h"
+#include "nth_type.h"
+#include "span.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup soa_vector soa_vector
+/// A vector with the capacity defined at compile time, that stores each field
+/// of its elements in a separate contiguous array (structure of arrays).
+/// A loop that touches only some of the fields only streams through the memory
+/// of those fields, and may be vectorised by the compiler.
+/// The elements are accessed through proxies, with get<I>(), or each field as
+/// a span with field<I>().
+///\code
+/// etl::soa_vector<4096, float, float, float, uint32_t> tracks;
+///
+/// tracks.push_back(x, y, z, id);
+///
+/// etl::span<float> xs = tracks.field<0>();
+///
+/// for (float& x : xs)
+/// {
+///   x += dx;
+/// }
+///
+/// uint32_t first_id = etl::get<3>(tracks[0]);
+///\endcode
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the soa_vector.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_exception : public etl::exception
+  {
+  public:
+
+    soa_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the soa_vector.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_full : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_full(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:full", ETL_SOA_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the soa_vector.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_empty : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_empty(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:empty", ETL_SOA_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the soa_vector.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_out_of_bounds : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:bounds", ETL_SOA_VECTOR_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_soa_vector
+  {
+    //*************************************************************************
+    /// The storage for the fields of a soa_vector, one array per field.
+    //*************************************************************************
+    template <size_t N, typename... TTypes>
+    struct storage;
+
+    template <size_t N>
+    struct storage<N>
+    {
+      void get_fields(void**)
+      {
+      }
+    };
+
+    template <size_t N, typename T, typename... TRest>
+    struct storage<N, T, TRest...>
+    {
+      void get_fields(void** p_fields)
+      {
+        p_fields[0] = &buffer;
+        rest.get_fields(p_fields + 1);
+      }
+
+      typename etl::aligned_storage<sizeof(T) * N, etl::alignment_of<T>::value>::type buffer;
+      storage<N, TRest...> rest;
+    };
+
+    //*************************************************************************
+    /// A proxy for an element of a soa_vector.
+    /// Copying a proxy refers to the same element. Assigning to a proxy
+    /// assigns the fields of the element.
+    //*************************************************************************
+    template <bool Is_Const, typename... TTypes>
+    class reference
+    {
+    public:
+
+      template <bool, typename...>
+      friend class reference;
+
+      //*********************************
+      /// The type of field I.
+      //*********************************
+      template <size_t I>
+      using field_type = typename etl::conditional<Is_Const, const etl::nth_type_t<I, TTypes...>,
+                                                             etl::nth_type_t<I, TTypes...>>::type;
+
+      //*********************************
+      reference(void* const* p_fields_, size_t index_)
+        : p_fields(p_fields_)
+        , element_index(index_)
+      {
+      }
+
+      //*********************************
+      reference(const reference& other) = default;
+
+      //*********************************
+      /// Converts from a proxy for a non-const element.
+      //*********************************
+      template <bool Is_Const_Other, typename = typename etl::enable_if<Is_Const && !Is_Const_Other>::type>
+      reference(const reference<Is_Const_Other, TTypes...>& other)
+        : p_fields(other.p_fields)
+        , element_index(other.element_index)
+      {
+      }
+
+      //*********************************
+      /// Assigns the fields of another element.
+      //*********************************
+      reference& operator =(const reference& other)
+      {
+        assign(other, etl::make_index_sequence<sizeof...(TTypes)>());
+
+        return *this;
+      }
+
+      //*********************************
+      /// Assigns the fields of another element.
+      //*********************************
+      template <bool Is_Const_Other>
+      reference& operator =(const reference<Is_Const_Other, TTypes...>& other)
+      {
+        assign(other, etl::make_index_sequence<sizeof...(TTypes)>());
+
+        return *this;
+      }
+
+      //*********************************
+      /// Gets field I of the element.
+      //*********************************
+      template <size_t I>
+      field_type<I>& get() const
+      {
+        return static_cast<field_type<I>*>(p_fields[I])[element_index];
+      }
+
+      //*********************************
+      /// Gets the index of the element.
+      //*********************************
+      size_t index() const
+      {
+        return element_index;
+      }
+
+      //*********************************
+      /// Swaps the fields of two elements.
+      //*********************************
+      void swap(const reference& other) const
+      {
+        swap_fields(other, etl::make_index_sequence<sizeof...(TTypes)>());
+      }
+
+    private:
+
+      //*********************************
+      template <bool Is_Const_Other, size_t... I>
+      void assign(const reference<Is_Const_Other, TTypes...>& other, etl::index_sequence<I...>)
+      {
+        ETL_STATIC_ASSERT(!Is_Const, "Cannot assign to a const element");
+
+        int dummy[] = { 0, (get<I>() = other.template get<I>(), 0)... };
+        (void)dummy;
+      }
+
+      //*********************************
+      template <size_t... I>
+      void swap_fields(const reference& other, etl::index_sequence<I...>) const
+      {
+        ETL_STATIC_ASSERT(!Is_Const, "Cannot swap a const element");
+
+        using ETL_OR_STD::swap; // Allow ADL
+
+        int dummy[] = { 0, (swap(get<I>(), other.template get<I>()), 0)... };
+        (void)dummy;
+      }
+
+      void* const* p_fields;
+      size_t       element_index;
+    };
+
+    //*************************************************************************
+    /// Swaps the fields of two elements.
+    //*************************************************************************
+    template <typename... TTypes>
+    void swap(const reference<false, TTypes...>& lhs, const reference<false, TTypes...>& rhs)
+    {
+      lhs.swap(rhs);
+    }
+
+    //*************************************************************************
+    /// A random access iterator over the elements of a soa_vector.
+    /// Dereferences to a proxy for the element.
+    //*************************************************************************
+    template <bool Is_Const, typename... TTypes>
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag,
+                                          private_soa_vector::reference<Is_Const, TTypes...>,
+                                          ptrdiff_t,
+                                          void,
+                                          private_soa_vector::reference<Is_Const, TTypes...> >
+    {
+    public:
+
+      template <bool, typename...>
+      friend class iterator;
+
+      typedef private_soa_vector::reference<Is_Const, TTypes...> reference_type;
+
+      //*********************************
+      iterator()
+        : p_fields(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*********************************
+      iterator(void* const* p_fields_, size_t index_)
+        : p_fields(p_fields_)
+        , index(index_)
+      {
+      }
+
+      //*********************************
+      /// Converts from a non-const iterator.
+      //*********************************
+      template <bool Is_Const_Other, typename = typename etl::enable_if<Is_Const && !Is_Const_Other>::type>
+      iterator(const iterator<Is_Const_Other, TTypes...>& other)
+        : p_fields(other.p_fields)
+        , index(other.index)
+      {
+      }
+
+      //*********************************
+      reference_type operator *() const
+      {
+        return reference_type(p_fields, index);
+      }
+
+      //*********************************
+      reference_type operator [](ptrdiff_t offset) const
+      {
+        return reference_type(p_fields, size_t(ptrdiff_t(index) + offset));
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      //*********************************
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator +=(ptrdiff_t offset)
+      {
+        index = size_t(ptrdiff_t(index) + offset);
+        return *this;
+      }
+
+      //*********************************
+      iterator& operator -=(ptrdiff_t offset)
+      {
+        index = size_t(ptrdiff_t(index) - offset);
+        return *this;
+      }
+
+      //*********************************
+      friend iterator operator +(const iterator& lhs, ptrdiff_t offset)
+      {
+        iterator temp(lhs);
+        temp += offset;
+        return temp;
+      }
+
+      //*********************************
+      friend iterator operator +(ptrdiff_t offset, const iterator& rhs)
+      {
+        iterator temp(rhs);
+        temp += offset;
+        return temp;
+      }
+
+      //*********************************
+      friend iterator operator -(const iterator& lhs, ptrdiff_t offset)
+      {
+        iterator temp(lhs);
+        temp -= offset;
+        return temp;
+      }
+
+      //*********************************
+      friend ptrdiff_t operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return ptrdiff_t(lhs.index) - ptrdiff_t(rhs.index);
+      }
+
+      //*********************************
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //*********************************
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index != rhs.index;
+      }
+
+      //*********************************
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      //*********************************
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index > rhs.index;
+      }
+
+      //*********************************
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index <= rhs.index;
+      }
+
+      //*********************************
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index >= rhs.index;
+      }
+
+      //*********************************
+      /// Gets the index of the element.
+      //*********************************
+      size_t get_index() const
+      {
+        return index;
+      }
+
+    private:
+
+      void* const* p_fields;
+      size_t       index;
+    };
+  }
+
+  //***************************************************************************
+  /// Gets field I of a soa_vector element.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  template <size_t I, bool Is_Const, typename... TTypes>
+  typename private_soa_vector::reference<Is_Const, TTypes...>::template field_type<I>&
+    get(const private_soa_vector::reference<Is_Const, TTypes...>& element)
+  {
+    return element.template get<I>();
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized soa_vectors.
+  /// Can be used as a reference type for all soa_vectors containing the same field types.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  template <typename... TTypes>
+  class isoa_vector
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TTypes) != 0U, "soa_vector must have at least one field");
+
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+    typedef private_soa_vector::reference<false, TTypes...> reference;
+    typedef private_soa_vector::reference<true, TTypes...>  const_reference;
+    typedef private_soa_vector::iterator<false, TTypes...>  iterator;
+    typedef private_soa_vector::iterator<true, TTypes...>   const_iterator;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /// The number of fields in each element.
+    static ETL_CONSTANT size_t Number_Of_Fields = sizeof...(TTypes);
+
+    /// The type of field I.
+    template <size_t I>
+    using field_type = etl::nth_type_t<I, TTypes...>;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the vector.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(p_fields, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the vector.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(p_fields, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the vector.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(p_fields, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the vector.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(p_fields, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the vector.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(p_fields, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the vector.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(p_fields, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the vector.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the vector.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a proxy for the element at index 'i'.
+    //*************************************************************************
+    reference operator [](size_t i)
+    {
+      return reference(p_fields, i);
+    }
+
+    //*************************************************************************
+    /// Returns a const proxy for the element at index 'i'.
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return const_reference(p_fields, i);
+    }
+
+    //*************************************************************************
+    /// Returns a proxy for the element at index 'i'.
+    /// If asserts or exceptions are enabled, emits an etl::soa_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    reference at(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      return reference(p_fields, i);
+    }
+
+    //*************************************************************************
+    /// Returns a const proxy for the element at index 'i'.
+    /// If asserts or exceptions are enabled, emits an etl::soa_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      return const_reference(p_fields, i);
+    }
+
+    //*************************************************************************
+    /// Returns a proxy for the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return reference(p_fields, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const proxy for the first element.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return const_reference(p_fields, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a proxy for the last element.
+    //*************************************************************************
+    reference back()
+    {
+      return reference(p_fields, current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Returns a const proxy for the last element.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return const_reference(p_fields, current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the array of field I.
+    //*************************************************************************
+    template <size_t I>
+    field_type<I>* data()
+    {
+      return static_cast<field_type<I>*>(p_fields[I]);
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the array of field I.
+    //*************************************************************************
+    template <size_t I>
+    const field_type<I>* data() const
+    {
+      return static_cast<const field_type<I>*>(p_fields[I]);
+    }
+
+    //*************************************************************************
+    /// Returns a span of field I of every element.
+    //*************************************************************************
+    template <size_t I>
+    etl::span<field_type<I> > field()
+    {
+      return etl::span<field_type<I> >(data<I>(), current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const span of field I of every element.
+    //*************************************************************************
+    template <size_t I>
+    etl::span<const field_type<I> > field() const
+    {
+      return etl::span<const field_type<I> >(data<I>(), current_size);
+    }
+
+    //*************************************************************************
+    /// Adds an element with default constructed fields to the back.
+    /// If asserts or exceptions are enabled, emits an etl::soa_vector_full if the vector is full.
+    //*************************************************************************
+    reference push_back()
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(soa_vector_full));
+
+      create_back(etl::make_index_sequence<Number_Of_Fields>());
+
+      return back();
+    }
+
+    //*************************************************************************
+    /// Adds an element to the back, with a value for each field.
+    /// If asserts or exceptions are enabled, emits an etl::soa_vector_full if the vector is full.
+    //*************************************************************************
+    reference push_back(const TTypes&... values)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(soa_vector_full));
+
+      create_back(etl::make_index_sequence<Number_Of_Fields>(), values...);
+
+      return back();
+    }
+
+    //*************************************************************************
+    /// Adds an element to the back, constructing each field from one argument.
+    /// If asserts or exceptions are enabled, emits an etl::soa_vector_full if the vector is full.
+    //*************************************************************************
+    template <typename... TArgs>
+    reference emplace_back(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT(sizeof...(TArgs) == Number_Of_Fields, "One argument is required for each field");
+      ETL_ASSERT(!full(), ETL_ERROR(soa_vector_full));
+
+      create_back(etl::make_index_sequence<Number_Of_Fields>(), etl::forward<TArgs>(args)...);
+
+      return back();
+    }
+
+    //*************************************************************************
+    /// Removes the last element.
+    /// If asserts or exceptions are enabled, emits an etl::soa_vector_empty if the vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(soa_vector_empty));
+
+      destroy(etl::make_index_sequence<Number_Of_Fields>(), current_size - 1U, current_size);
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Inserts an element before position, with a value for each field.
+    /// If asserts or exceptions are enabled, emits an etl::soa_vector_full if the vector is full.
+    ///\return An iterator to the inserted element.
+    //*************************************************************************
+    iterator insert(const_iterator position, const TTypes&... values)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(soa_vector_full));
+
+      const size_t index = position.get_index();
+
+      insert_fields(etl::make_index_sequence<Number_Of_Fields>(), index, values...);
+      ++current_size;
+
+      return iterator(p_fields, index);
+    }
+
+    //*************************************************************************
+    /// Erases an element.
+    ///\return An iterator to the element that followed the erased element.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      return erase(position, position + 1);
+    }
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    ///\return An iterator to the element that followed the erased elements.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      const size_t index_first = first.get_index();
+      const size_t index_last  = last.get_index();
+
+      if (index_first == index_last)
+      {
+        return iterator(p_fields, index_first);
+      }
+
+      erase_fields(etl::make_index_sequence<Number_Of_Fields>(), index_first, index_last);
+      current_size -= (index_last - index_first);
+
+      return iterator(p_fields, index_first);
+    }
+
+    //*************************************************************************
+    /// Erases an element by moving the last element into its place.
+    /// Does not keep the order of the elements, but is O(1).
+    ///\return An iterator to the element that replaced the erased element.
+    //*************************************************************************
+    iterator erase_unordered(const_iterator position)
+    {
+      const size_t index = position.get_index();
+
+      replace_with_back(etl::make_index_sequence<Number_Of_Fields>(), index);
+      --current_size;
+
+      return iterator(p_fields, index);
+    }
+
+    //*************************************************************************
+    /// Resizes the vector.
+    /// New elements have default constructed fields.
+    /// If asserts or exceptions are enabled, emits an etl::soa_vector_full if the new size is larger than the capacity.
+    //*************************************************************************
+    void resize(size_t new_size)
+    {
+      ETL_ASSERT_OR_RETURN(new_size <= CAPACITY, ETL_ERROR(soa_vector_full));
+
+      while (current_size < new_size)
+      {
+        create_back(etl::make_index_sequence<Number_Of_Fields>());
+      }
+
+      if (new_size < current_size)
+      {
+        destroy(etl::make_index_sequence<Number_Of_Fields>(), new_size, current_size);
+        current_size = new_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the vector.
+    //*************************************************************************
+    void clear()
+    {
+      destroy(etl::make_index_sequence<Number_Of_Fields>(), 0U, current_size);
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    isoa_vector& operator =(const isoa_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        copy_from(etl::make_index_sequence<Number_Of_Fields>(), rhs);
+        current_size = rhs.current_size;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    isoa_vector& operator =(isoa_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        move_from(etl::make_index_sequence<Number_Of_Fields>(), rhs);
+        current_size = rhs.current_size;
+        rhs.clear();
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Returns the current number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no elements.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if the vector is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the vector.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum size of the vector.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    template <typename TStorage>
+    isoa_vector(TStorage& storage, size_t max_size_)
+      : current_size(0U)
+      , CAPACITY(max_size_)
+    {
+      storage.get_fields(p_fields);
+    }
+
+    //*************************************************************************
+    /// Copies the elements of another vector to this empty one.
+    //*************************************************************************
+    template <size_t... I>
+    void copy_from(etl::index_sequence<I...>, const isoa_vector& other)
+    {
+      int dummy[] = { 0, (etl::uninitialized_copy(other.data<I>(), other.data<I>() + other.current_size, data<I>()), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    /// Moves the elements of another vector to this empty one.
+    //*************************************************************************
+    template <size_t... I>
+    void move_from(etl::index_sequence<I...>, isoa_vector& other)
+    {
+      int dummy[] = { 0, (etl::uninitialized_move(other.data<I>(), other.data<I>() + other.current_size, data<I>()), 0)... };
+      (void)dummy;
+    }
+
+  private:
+
+    //*************************************************************************
+    template <size_t... I, typename... TArgs>
+    void create_back(etl::index_sequence<I...>, TArgs&&... args)
+    {
+      int dummy[] = { 0, (::new (static_cast<void*>(data<I>() + current_size)) field_type<I>(etl::forward<TArgs>(args)), 0)... };
+      (void)dummy;
+      ++current_size;
+    }
+
+    //*************************************************************************
+    template <size_t... I>
+    void create_back(etl::index_sequence<I...>)
+    {
+      int dummy[] = { 0, (::new (static_cast<void*>(data<I>() + current_size)) field_type<I>(), 0)... };
+      (void)dummy;
+      ++current_size;
+    }
+
+    //*************************************************************************
+    template <size_t... I>
+    void destroy(etl::index_sequence<I...>, size_t first, size_t last)
+    {
+      int dummy[] = { 0, (etl::destroy(data<I>() + first, data<I>() + last), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... I>
+    void insert_fields(etl::index_sequence<I...>, size_t index, const TTypes&... values)
+    {
+      int dummy[] = { 0, (insert_field(data<I>(), index, values), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... I>
+    void erase_fields(etl::index_sequence<I...>, size_t first, size_t last)
+    {
+      int dummy[] = { 0, (erase_field(data<I>(), first, last), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    template <size_t... I>
+    void replace_with_back(etl::index_sequence<I...>, size_t index)
+    {
+      int dummy[] = { 0, (replace_field_with_back(data<I>(), index), 0)... };
+      (void)dummy;
+    }
+
+    //*************************************************************************
+    /// Inserts a value into one field array, at index.
+    //*************************************************************************
+    template <typename T>
+    void insert_field(T* p, size_t index, const T& value)
+    {
+      if (index == current_size)
+      {
+        ::new (static_cast<void*>(p + index)) T(value);
+      }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::trivially_relocate(p + index, p + current_size, p + index + 1U);
+        ::new (static_cast<void*>(p + index)) T(value);
+      }
+      else
+      {
+        ::new (static_cast<void*>(p + current_size)) T(etl::move(p[current_size - 1U]));
+        etl::move_backward(p + index, p + current_size - 1U, p + current_size);
+        p[index] = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases [first, last) from one field array.
+    //*************************************************************************
+    template <typename T>
+    void erase_field(T* p, size_t first, size_t last)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy(p + first, p + last);
+        etl::trivially_relocate(p + last, p + current_size, p + first);
+      }
+      else
+      {
+        etl::move(p + last, p + current_size, p + first);
+        etl::destroy(p + current_size - (last - first), p + current_size);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the last value of one field array to index.
+    //*************************************************************************
+    template <typename T>
+    void replace_field_with_back(T* p, size_t index)
+    {
+      const size_t last = current_size - 1U;
+
+      if (index != last)
+      {
+        p[index] = etl::move(p[last]);
+      }
+
+      etl::destroy_at(p + last);
+    }
+
+    // Disable copy construction.
+    isoa_vector(const isoa_vector&) ETL_DELETE;
+
+    void*           p_fields[sizeof...(TTypes)];
+    size_type       current_size;
+    const size_type CAPACITY;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SOA_VECTOR) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~isoa_vector()
+    {
+    }
+#else
+  protected:
+    ~isoa_vector()
+    {
+    }
+#endif
+  };
+
+  template <typename... TTypes>
+  ETL_CONSTANT size_t isoa_vector<TTypes...>::Number_Of_Fields;
+
+  //***************************************************************************
+  /// A soa_vector implementation that uses a fixed size buffer for each field.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TTypes    The types of the fields.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  template <size_t MAX_SIZE_, typename... TTypes>
+  class soa_vector : public etl::isoa_vector<TTypes...>
+  {
+  private:
+
+    typedef etl::isoa_vector<TTypes...> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_vector()
+      : base(storage, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_vector(const soa_vector& other)
+      : base(storage, MAX_SIZE)
+    {
+      base::operator =(other);
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    soa_vector(soa_vector&& other)
+      : base(storage, MAX_SIZE)
+    {
+      base::operator =(etl::move(other));
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_vector()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_vector& operator =(const soa_vector& rhs)
+    {
+      base::operator =(rhs);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    soa_vector& operator =(soa_vector&& rhs)
+    {
+      base::operator =(etl::move(rhs));
+
+      return *this;
+    }
+
+  private:
+
+    /// One array for each field.
+    private_soa_vector::storage<MAX_SIZE_, TTypes...> storage;
+  };
+
+  template <size_t MAX_SIZE_, typename... TTypes>
+  ETL_CONSTANT size_t soa_vector<MAX_SIZE_, TTypes...>::MAX_SIZE;
+}
+
+#endif
+#endif
@@ -0,0 +1,321 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SORT_NETWORK_INCLUDED
+#define ETL_SORT_NETWORK_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "span.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+
+///\defgroup sort_network sort network
+/// Sorting networks for a fixed number of values.
+/// The comparisons are generated at compile time, as a Batcher odd-even
+/// merge sort. Each is a compare and exchange without branches, so the time
+/// does not depend on the values. Faster than etl::sort for up to about 32
+/// values.
+///\ingroup algorithm
+
+namespace etl
+{
+  namespace private_sort_network
+  {
+    //*************************************************************************
+    /// Puts the values of a and b in order, without branching on the result.
+    //*************************************************************************
+    template <typename T, typename TCompare>
+    ETL_CONSTEXPR14 void compare_exchange(T& a, T& b, TCompare compare)
+    {
+      const bool in_order = !compare(b, a);
+
+      const T lo = in_order ? a : b;
+      const T hi = in_order ? b : a;
+
+      a = lo;
+      b = hi;
+    }
+
+    //*************************************************************************
+    /// The comparison of I + J with I + J + K, if both are in the same merge.
+    //*************************************************************************
+    template <bool VSameMerge>
+    struct comparator
+    {
+      template <size_t VA, size_t VB, typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator first, TCompare compare)
+      {
+        compare_exchange(first[VA], first[VB], compare);
+      }
+    };
+
+    template <>
+    struct comparator<false>
+    {
+      template <size_t VA, size_t VB, typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator, TCompare)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// The loops of Knuth's formulation of Batcher's network, for any N.
+    /// for (P = 1; P < N; P *= 2)
+    ///   for (K = P; K >= 1; K /= 2)
+    ///     for (J = K % P; J + K < N; J += 2K)
+    ///       for (I = 0; I < min(K, N - J - K); ++I)
+    ///         if ((I + J) / 2P == (I + J + K) / 2P)
+    ///           compare_exchange(I + J, I + J + K)
+    //*************************************************************************
+    template <size_t N, size_t P, size_t K, size_t J, size_t I,
+              bool VLoop = (I < ((K < (N - J - K)) ? K : (N - J - K)))>
+    struct loop_i
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator first, TCompare compare)
+      {
+        comparator<((I + J) / (2U * P)) == ((I + J + K) / (2U * P))>::template apply<I + J, I + J + K>(first, compare);
+        loop_i<N, P, K, J, I + 1U>::apply(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t K, size_t J, size_t I>
+    struct loop_i<N, P, K, J, I, false>
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator, TCompare)
+      {
+      }
+    };
+
+    //*************************************************************************
+    template <size_t N, size_t P, size_t K, size_t J, bool VLoop = ((J + K) < N)>
+    struct loop_j
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator first, TCompare compare)
+      {
+        loop_i<N, P, K, J, 0U>::apply(first, compare);
+        loop_j<N, P, K, J + (2U * K)>::apply(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t K, size_t J>
+    struct loop_j<N, P, K, J, false>
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator, TCompare)
+      {
+      }
+    };
+
+    //*************************************************************************
+    template <size_t N, size_t P, size_t K, bool VLoop = (K >= 1U)>
+    struct loop_k
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator first, TCompare compare)
+      {
+        loop_j<N, P, K, K % P>::apply(first, compare);
+        loop_k<N, P, K / 2U>::apply(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t K>
+    struct loop_k<N, P, K, false>
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator, TCompare)
+      {
+      }
+    };
+
+    //*************************************************************************
+    template <size_t N, size_t P, bool VLoop = (P < N)>
+    struct loop_p
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator first, TCompare compare)
+      {
+        loop_k<N, P, P>::apply(first, compare);
+        loop_p<N, 2U * P>::apply(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P>
+    struct loop_p<N, P, false>
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void apply(TIterator, TCompare)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Selects the middle value with the network.
+    //*************************************************************************
+    template <size_t N, typename T, typename TCompare>
+    T median_of(T* values, TCompare compare, etl::bool_constant<true>)
+    {
+      loop_p<N, 1U>::apply(values, compare);
+
+      return values[N / 2U];
+    }
+
+    //*************************************************************************
+    /// Selects the middle value with nth_element.
+    //*************************************************************************
+    template <size_t N, typename T, typename TCompare>
+    T median_of(T* values, TCompare compare, etl::bool_constant<false>)
+    {
+      etl::nth_element(values, values + (N / 2U), values + N, compare);
+
+      return values[N / 2U];
+    }
+  }
+
+  //***************************************************************************
+  /// The largest N for which median_of uses a sorting network.
+  ///\ingroup sort_network
+  //***************************************************************************
+#if !defined(ETL_SORT_NETWORK_MEDIAN_MAX_SIZE)
+  #define ETL_SORT_NETWORK_MEDIAN_MAX_SIZE 32
+#endif
+
+  //***************************************************************************
+  /// Sorts the N values starting at first.
+  ///\tparam N The number of values.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14 void sort_network(TIterator first, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator_concept<TIterator>::value, "sort_network requires random access iterators");
+
+    private_sort_network::loop_p<N, 1U>::apply(first, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the N values starting at first, in ascending order.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator>
+  ETL_CONSTEXPR14 void sort_network(TIterator first)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare_t;
+
+    etl::sort_network<N>(first, compare_t());
+  }
+
+  //***************************************************************************
+  /// Sorts a span of N values.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename T, typename TCompare>
+  ETL_CONSTEXPR14 void sort_network(etl::span<T, N> values, TCompare compare)
+  {
+    etl::sort_network<N>(values.data(), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts a span of N values, in ascending order.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename T>
+  ETL_CONSTEXPR14 void sort_network(etl::span<T, N> values)
+  {
+    etl::sort_network<N>(values.data(), etl::less<typename etl::remove_cv<T>::type>());
+  }
+
+  //***************************************************************************
+  /// Sorts an array of N values.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename T, typename TCompare>
+  ETL_CONSTEXPR14 void sort_network(T (&values)[N], TCompare compare)
+  {
+    etl::sort_network<N>(&values[0], compare);
+  }
+
+  //***************************************************************************
+  /// Sorts an array of N values, in ascending order.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename T>
+  ETL_CONSTEXPR14 void sort_network(T (&values)[N])
+  {
+    etl::sort_network<N>(&values[0], etl::less<T>());
+  }
+
+  //***************************************************************************
+  /// Gets the median of the N values starting at first.
+  /// For an even N this is the upper of the two middle values.
+  /// The values are not changed. Uses a sorting network on a copy for N up to
+  /// ETL_SORT_NETWORK_MEDIAN_MAX_SIZE, otherwise etl::nth_element.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator, typename TCompare>
+  typename etl::iterator_traits<TIterator>::value_type median_of(TIterator first, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(N > 0U, "median_of requires at least one value");
+
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+    typedef etl::bool_constant<(N <= ETL_SORT_NETWORK_MEDIAN_MAX_SIZE)> use_network;
+
+    value_type values[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      values[i] = *first;
+      ++first;
+    }
+
+    return private_sort_network::median_of<N>(values, compare, use_network());
+  }
+
+  //***************************************************************************
+  /// Gets the median of the N values starting at first.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator>
+  typename etl::iterator_traits<TIterator>::value_type median_of(TIterator first)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare_t;
+
+    return etl::median_of<N>(first, compare_t());
+  }
+}
+
+#endif
@@ -0,0 +1,403 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SPIN_MUTEX_INCLUDED
+#define ETL_SPIN_MUTEX_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "binary.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+/// Called on each pass of a spin loop while a lock is contended.
+/// Defaults to the target's spin loop hint, if known.
+/// May be redefined, for example, as a 'wfe' instruction, with ETL_SPIN_NOTIFY
+/// defined as 'sev'.
+//*****************************************************************************
+#if !defined(ETL_SPIN_PAUSE)
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+    #define ETL_SPIN_PAUSE() __builtin_ia32_pause()
+  #elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+    #define ETL_SPIN_PAUSE() __asm__ __volatile__("yield")
+  #else
+    #define ETL_SPIN_PAUSE()
+  #endif
+#endif
+
+//*****************************************************************************
+/// Called when a lock is released.
+//*****************************************************************************
+#if !defined(ETL_SPIN_NOTIFY)
+  #define ETL_SPIN_NOTIFY()
+#endif
+
+namespace etl
+{
+  namespace private_spin_mutex
+  {
+    //*************************************************************************
+    /// Pauses for 'count' spin loop hints.
+    //*************************************************************************
+    inline void pause(uint32_t count)
+    {
+      while (count-- != 0U)
+      {
+        ETL_SPIN_PAUSE();
+      }
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A test and test and set spin lock with exponential backoff.
+  /// Waiters spin on a plain load, so the lock's cache line is shared until it
+  /// is released, and back off for up to VMax_Backoff pauses between attempts.
+  /// Not fair.
+  //***************************************************************************
+  template <uint32_t VMax_Backoff = 64U>
+  class spin_mutex_ext
+  {
+  public:
+
+    static ETL_CONSTANT uint32_t Max_Backoff = VMax_Backoff;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    spin_mutex_ext()
+      : locked(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Locks the mutex.
+    //*************************************************************************
+    void lock()
+    {
+      uint32_t backoff = 1U;
+
+      while (locked.exchange(true, etl::memory_order_acquire))
+      {
+        while (locked.load(etl::memory_order_relaxed))
+        {
+          private_spin_mutex::pause(backoff);
+
+          if (backoff < Max_Backoff)
+          {
+            backoff *= 2U;
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Tries to lock the mutex.
+    /// Returns <b>true</b> if locked.
+    //*************************************************************************
+    bool try_lock()
+    {
+      return !locked.load(etl::memory_order_relaxed) && !locked.exchange(true, etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Unlocks the mutex.
+    //*************************************************************************
+    void unlock()
+    {
+      locked.store(false, etl::memory_order_release);
+      ETL_SPIN_NOTIFY();
+    }
+
+  private:
+
+    spin_mutex_ext(const spin_mutex_ext&) ETL_DELETE;
+    spin_mutex_ext& operator =(const spin_mutex_ext&) ETL_DELETE;
+
+    etl::atomic<bool> locked;
+  };
+
+  template <uint32_t VMax_Backoff>
+  ETL_CONSTANT uint32_t spin_mutex_ext<VMax_Backoff>::Max_Backoff;
+
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A spin lock with the default backoff.
+  //***************************************************************************
+  typedef spin_mutex_ext<> spin_mutex;
+
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A fair, first come first served, ticket lock.
+  /// Waiters back off in proportion to the number of waiters ahead of them.
+  //***************************************************************************
+  class ticket_mutex
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ticket_mutex()
+      : next_ticket(0U)
+      , now_serving(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Locks the mutex.
+    //*************************************************************************
+    void lock()
+    {
+      const uint32_t ticket = next_ticket.fetch_add(1U, etl::memory_order_relaxed);
+
+      uint32_t serving;
+
+      while ((serving = now_serving.load(etl::memory_order_acquire)) != ticket)
+      {
+        private_spin_mutex::pause(ticket - serving);
+      }
+    }
+
+    //*************************************************************************
+    /// Tries to lock the mutex.
+    /// Returns <b>true</b> if locked.
+    //*************************************************************************
+    bool try_lock()
+    {
+      uint32_t ticket = now_serving.load(etl::memory_order_acquire);
+
+      return next_ticket.compare_exchange_strong(ticket, ticket + 1U, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Unlocks the mutex.
+    //*************************************************************************
+    void unlock()
+    {
+      // Only the owner writes now_serving.
+      now_serving.store(now_serving.load(etl::memory_order_relaxed) + 1U, etl::memory_order_release);
+      ETL_SPIN_NOTIFY();
+    }
+
+  private:
+
+    ticket_mutex(const ticket_mutex&) ETL_DELETE;
+    ticket_mutex& operator =(const ticket_mutex&) ETL_DELETE;
+
+    etl::atomic<uint32_t> next_ticket;
+    etl::atomic<uint32_t> now_serving;
+  };
+
+  //***************************************************************************
+  ///\ingroup mutex
+  /// A fair MCS queue lock.
+  /// Each waiter spins on a flag in its own queue node, so a release touches
+  /// only the next waiter's cache line.
+  /// The nodes are held in the mutex. VMax_Waiters is the maximum number of
+  /// contexts that may hold or wait for the lock at the same time; further
+  /// contexts spin until a node is free.
+  //***************************************************************************
+  template <uint32_t VMax_Waiters = 8U>
+  class mcs_mutex
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VMax_Waiters > 0U) && (VMax_Waiters <= 32U), "VMax_Waiters must be 1 to 32");
+
+    static ETL_CONSTANT uint32_t Max_Waiters = VMax_Waiters;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    mcs_mutex()
+      : tail(ETL_NULLPTR)
+      , nodes_in_use(0U)
+      , owner(ETL_NULLPTR)
+    {
+      for (uint32_t i = 0U; i < Max_Waiters; ++i)
+      {
+        nodes[i].next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+        nodes[i].waiting.store(false, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Locks the mutex.
+    //*************************************************************************
+    void lock()
+    {
+      node_t* pnode = allocate_node();
+
+      pnode->next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+      pnode->waiting.store(true, etl::memory_order_relaxed);
+
+      node_t* previous = tail.exchange(pnode, etl::memory_order_acq_rel);
+
+      if (previous != ETL_NULLPTR)
+      {
+        previous->next.store(pnode, etl::memory_order_release);
+
+        while (pnode->waiting.load(etl::memory_order_acquire))
+        {
+          ETL_SPIN_PAUSE();
+        }
+      }
+
+      owner = pnode;
+    }
+
+    //*************************************************************************
+    /// Tries to lock the mutex.
+    /// Returns <b>true</b> if locked.
+    //*************************************************************************
+    bool try_lock()
+    {
+      if (tail.load(etl::memory_order_relaxed) != ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      node_t* pnode = allocate_node();
+
+      pnode->next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+
+      node_t* expected = ETL_NULLPTR;
+
+      if (tail.compare_exchange_strong(expected, pnode, etl::memory_order_acquire, etl::memory_order_relaxed))
+      {
+        owner = pnode;
+        return true;
+      }
+
+      free_node(pnode);
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Unlocks the mutex.
+    //*************************************************************************
+    void unlock()
+    {
+      node_t* pnode = owner;
+      node_t* next  = pnode->next.load(etl::memory_order_acquire);
+
+      if (next == ETL_NULLPTR)
+      {
+        node_t* expected = pnode;
+
+        // No waiters?
+        if (tail.compare_exchange_strong(expected, ETL_NULLPTR, etl::memory_order_release, etl::memory_order_relaxed))
+        {
+          free_node(pnode);
+          ETL_SPIN_NOTIFY();
+          return;
+        }
+
+        // A waiter has joined the queue, but not yet linked itself to this node.
+        while ((next = pnode->next.load(etl::memory_order_acquire)) == ETL_NULLPTR)
+        {
+          ETL_SPIN_PAUSE();
+        }
+      }
+
+      next->waiting.store(false, etl::memory_order_release);
+      free_node(pnode);
+      ETL_SPIN_NOTIFY();
+    }
+
+  private:
+
+    //*************************************************************************
+    struct node_t
+    {
+      etl::atomic<node_t*> next;
+      etl::atomic<bool>    waiting;
+    };
+
+    //*************************************************************************
+    /// Claims the lowest free node.
+    //*************************************************************************
+    node_t* allocate_node()
+    {
+      static ETL_CONSTANT uint32_t All_In_Use = (Max_Waiters == 32U) ? 0xFFFFFFFFUL : ((1UL << Max_Waiters) - 1UL);
+
+      uint32_t in_use = nodes_in_use.load(etl::memory_order_relaxed);
+
+      for (;;)
+      {
+        if (in_use == All_In_Use)
+        {
+          ETL_SPIN_PAUSE();
+          in_use = nodes_in_use.load(etl::memory_order_relaxed);
+        }
+        else
+        {
+          const uint32_t index = etl::count_trailing_zeros(static_cast<uint32_t>(~in_use));
+
+          if (nodes_in_use.compare_exchange_weak(in_use, in_use | (1UL << index), etl::memory_order_acquire, etl::memory_order_relaxed))
+          {
+            return &nodes[index];
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns a node to the free set.
+    //*************************************************************************
+    void free_node(node_t* pnode)
+    {
+      const uint32_t index = static_cast<uint32_t>(pnode - nodes);
+
+      nodes_in_use.fetch_and(~static_cast<uint32_t>(1UL << index), etl::memory_order_release);
+    }
+
+    mcs_mutex(const mcs_mutex&) ETL_DELETE;
+    mcs_mutex& operator =(const mcs_mutex&) ETL_DELETE;
+
+    etl::atomic<node_t*>  tail;
+    etl::atomic<uint32_t> nodes_in_use;
+    node_t*               owner;
+    node_t                nodes[Max_Waiters];
+  };
+
+  template <uint32_t VMax_Waiters>
+  ETL_CONSTANT uint32_t mcs_mutex<VMax_Waiters>::Max_Waiters;
+}
+
+#endif
+#endif
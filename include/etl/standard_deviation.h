@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_sums.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -132,8 +134,15 @@ namespace etl
     //*********************************
     void add(TInput value)
     {
-      sum_of_squares += TCalc(value * value);
-      sum            += TCalc(value);
+      if (counter == 0U)
+      {
+        shift = private_statistics::get_shift<calc_t>(value);
+      }
+
+      const calc_t deviation = calc_t(value) - shift;
+
+      sum_of_squares += deviation * deviation;
+      sum            += deviation;
       ++counter;
       recalculate = true;
     }
@@ -151,6 +160,27 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a span of values.
+    /// Faster than adding the values one at a time.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      if (values.empty())
+      {
+        return;
+      }
+
+      if (counter == 0U)
+      {
+        shift = private_statistics::get_shift<calc_t>(values[0]);
+      }
+
+      private_statistics::accumulate_sum_and_squares(values.data(), values.size(), shift, sum, sum_of_squares);
+      counter += uint32_t(values.size());
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -170,6 +200,15 @@ namespace etl
       add(first, last);
     }
 
+    //*********************************
+    /// operator ()
+    /// Add a span of values.
+    //*********************************
+    void operator ()(etl::span<const TInput> values)
+    {
+      add(values);
+    }
+
     //*********************************
     /// Get the variance.
     //*********************************
@@ -213,6 +252,7 @@ namespace etl
     {
       sum_of_squares           = calc_t(0);
       sum                      = calc_t(0);
+      shift                      = calc_t(0);
       counter                  = 0U;
       variance_value           = 0.0;
       standard_deviation_value = 0.0;
@@ -252,6 +292,7 @@ namespace etl
 
     calc_t   sum_of_squares;
     calc_t   sum;
+    calc_t   shift;
     uint32_t counter;
     mutable double variance_value;
     mutable double standard_deviation_value;
@@ -34,6 +34,9 @@ SOFTWARE.
 #include "array.h"
 #include "array_view.h"
 #include "utility.h"
+#include "smallest.h"
+#include "static_assert.h"
+#include "integral_limits.h"
 
 #include <stdint.h>
 
@@ -611,6 +614,17 @@ namespace etl
     bool started; ///< Set if the state chart has been started.
   };
 
+  //***************************************************************************
+  /// Storage for the index of an etl::state_chart.
+  /// Ids must be less than Number_Of_States and Number_Of_Events to be indexed.
+  //***************************************************************************
+  template <size_t Number_Of_States, size_t Number_Of_Events>
+  struct state_chart_index
+  {
+    uint_least8_t transitions[Number_Of_States * Number_Of_Events];
+    uint_least8_t states[Number_Of_States];
+  };
+
   //***************************************************************************
   /// Simple Finite State Machine
   /// Runtime tables.
@@ -649,6 +663,10 @@ namespace etl
       , transition_table_size(transition_table_end_ - transition_table_begin_)
       , state_table_size(state_table_end_ - state_table_begin_)
       , started(false)
+      , p_transition_index(ETL_NULLPTR)
+      , p_state_index(ETL_NULLPTR)
+      , number_of_states(0U)
+      , number_of_events(0U)
     {
     }
 
@@ -662,6 +680,8 @@ namespace etl
     {
       transition_table_begin = transition_table_begin_;
       transition_table_size = transition_table_end_ - transition_table_begin_;
+
+      rebuild_index();
     }
 
     //*************************************************************************
@@ -674,6 +694,26 @@ namespace etl
     {
       state_table_begin = state_table_begin_;
       state_table_size = state_table_end_ - state_table_begin_;
+
+      rebuild_index();
+    }
+
+    //*************************************************************************
+    /// Sets the storage for the (state, event) index, and builds it.
+    /// With an index, an event finds its first transition, and a state its
+    /// entry, by lookup instead of by searching the tables.
+    /// Ids outside of the index are searched for as before.
+    /// The index is rebuilt when either table is set.
+    //*************************************************************************
+    template <size_t Number_Of_States, size_t Number_Of_Events>
+    void set_index(etl::state_chart_index<Number_Of_States, Number_Of_Events>& index)
+    {
+      p_transition_index = index.transitions;
+      p_state_index      = index.states;
+      number_of_states   = Number_Of_States;
+      number_of_events   = Number_Of_Events;
+
+      rebuild_index();
     }
 
     //*************************************************************************
@@ -727,7 +767,7 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = transition_table_begin;
+        const transition* t = first_transition(event_id);
 
         // Keep looping until we execute a transition or reach the end of the table.
         while (t != transition_table_end())
@@ -801,12 +841,79 @@ namespace etl
       {
         return state_table_end();
       }
+      else if ((p_state_index != ETL_NULLPTR) && (state_id < number_of_states))
+      {
+        return state_table_begin + p_state_index[state_id];
+      }
       else
       {
         return etl::find_if(state_table_begin, state_table_end(), is_state(state_id));
       }
     }
 
+    //*************************************************************************
+    /// Gets the transition to start the search from.
+    //*************************************************************************
+    const transition* first_transition(event_id_t event_id) const
+    {
+      if ((p_transition_index != ETL_NULLPTR) && (event_id < number_of_events) && (this->current_state_id < number_of_states))
+      {
+        return transition_table_begin + p_transition_index[(size_t(this->current_state_id) * number_of_events) + event_id];
+      }
+      else
+      {
+        return transition_table_begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Rebuilds the index, if there is one.
+    //*************************************************************************
+    void rebuild_index()
+    {
+      if (p_transition_index != ETL_NULLPTR)
+      {
+        for (size_t i = 0U; i < (number_of_states * number_of_events); ++i)
+        {
+          p_transition_index[i] = transition_table_size;
+        }
+
+        for (size_t i = 0U; i < number_of_states; ++i)
+        {
+          p_state_index[i] = state_table_size;
+        }
+
+        // Work backwards, so that the first match in each table is the one that remains.
+        for (size_t i = transition_table_size; i != 0U; --i)
+        {
+          const transition& t = transition_table_begin[i - 1U];
+
+          if (t.event_id < number_of_events)
+          {
+            if (t.from_any_state)
+            {
+              for (size_t state_id = 0U; state_id < number_of_states; ++state_id)
+              {
+                p_transition_index[(state_id * number_of_events) + t.event_id] = uint_least8_t(i - 1U);
+              }
+            }
+            else if (t.current_state_id < number_of_states)
+            {
+              p_transition_index[(size_t(t.current_state_id) * number_of_events) + t.event_id] = uint_least8_t(i - 1U);
+            }
+          }
+        }
+
+        for (size_t i = state_table_size; i != 0U; --i)
+        {
+          if (state_table_begin[i - 1U].state_id < number_of_states)
+          {
+            p_state_index[state_table_begin[i - 1U].state_id] = uint_least8_t(i - 1U);
+          }
+        }
+      }
+    }
+
     //*************************************************************************
     const transition* transition_table_end() const
     {
@@ -863,6 +970,10 @@ namespace etl
     uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
     uint_least8_t     state_table_size;       ///< The size of the table of states.
     bool              started;                ///< Set if the state chart has been started.
+    uint_least8_t*    p_transition_index;     ///< The first transition for each state and event, or ETL_NULLPTR.
+    uint_least8_t*    p_state_index;          ///< The state table entry for each state.
+    size_t            number_of_states;       ///< The number of states in the index.
+    size_t            number_of_events;       ///< The number of events in the index.
   };
 
   //***************************************************************************
@@ -903,6 +1014,10 @@ namespace etl
       , transition_table_size(transition_table_end_ - transition_table_begin_)
       , state_table_size(state_table_end_ - state_table_begin_)
       , started(false)
+      , p_transition_index(ETL_NULLPTR)
+      , p_state_index(ETL_NULLPTR)
+      , number_of_states(0U)
+      , number_of_events(0U)
     {
     }
 
@@ -916,6 +1031,8 @@ namespace etl
     {
       transition_table_begin = transition_table_begin_;
       transition_table_size  = transition_table_end_ - transition_table_begin_;
+
+      rebuild_index();
     }
 
     //*************************************************************************
@@ -928,6 +1045,26 @@ namespace etl
     {
       state_table_begin = state_table_begin_;
       state_table_size  = state_table_end_ - state_table_begin_;
+
+      rebuild_index();
+    }
+
+    //*************************************************************************
+    /// Sets the storage for the (state, event) index, and builds it.
+    /// With an index, an event finds its first transition, and a state its
+    /// entry, by lookup instead of by searching the tables.
+    /// Ids outside of the index are searched for as before.
+    /// The index is rebuilt when either table is set.
+    //*************************************************************************
+    template <size_t Number_Of_States, size_t Number_Of_Events>
+    void set_index(etl::state_chart_index<Number_Of_States, Number_Of_Events>& index)
+    {
+      p_transition_index = index.transitions;
+      p_state_index      = index.states;
+      number_of_states   = Number_Of_States;
+      number_of_events   = Number_Of_Events;
+
+      rebuild_index();
     }
 
     //*************************************************************************
@@ -981,7 +1118,7 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = transition_table_begin;
+        const transition* t = first_transition(event_id);
 
         // Keep looping until we execute a transition or reach the end of the table.
         while (t != transition_table_end())
@@ -1051,12 +1188,79 @@ namespace etl
       {
         return state_table_end();
       }
+      else if ((p_state_index != ETL_NULLPTR) && (state_id < number_of_states))
+      {
+        return state_table_begin + p_state_index[state_id];
+      }
       else
       {
         return etl::find_if(state_table_begin, state_table_end(), is_state(state_id));
       }
     }
 
+    //*************************************************************************
+    /// Gets the transition to start the search from.
+    //*************************************************************************
+    const transition* first_transition(event_id_t event_id) const
+    {
+      if ((p_transition_index != ETL_NULLPTR) && (event_id < number_of_events) && (this->current_state_id < number_of_states))
+      {
+        return transition_table_begin + p_transition_index[(size_t(this->current_state_id) * number_of_events) + event_id];
+      }
+      else
+      {
+        return transition_table_begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Rebuilds the index, if there is one.
+    //*************************************************************************
+    void rebuild_index()
+    {
+      if (p_transition_index != ETL_NULLPTR)
+      {
+        for (size_t i = 0U; i < (number_of_states * number_of_events); ++i)
+        {
+          p_transition_index[i] = transition_table_size;
+        }
+
+        for (size_t i = 0U; i < number_of_states; ++i)
+        {
+          p_state_index[i] = state_table_size;
+        }
+
+        // Work backwards, so that the first match in each table is the one that remains.
+        for (size_t i = transition_table_size; i != 0U; --i)
+        {
+          const transition& t = transition_table_begin[i - 1U];
+
+          if (t.event_id < number_of_events)
+          {
+            if (t.from_any_state)
+            {
+              for (size_t state_id = 0U; state_id < number_of_states; ++state_id)
+              {
+                p_transition_index[(state_id * number_of_events) + t.event_id] = uint_least8_t(i - 1U);
+              }
+            }
+            else if (t.current_state_id < number_of_states)
+            {
+              p_transition_index[(size_t(t.current_state_id) * number_of_events) + t.event_id] = uint_least8_t(i - 1U);
+            }
+          }
+        }
+
+        for (size_t i = state_table_size; i != 0U; --i)
+        {
+          if (state_table_begin[i - 1U].state_id < number_of_states)
+          {
+            p_state_index[state_table_begin[i - 1U].state_id] = uint_least8_t(i - 1U);
+          }
+        }
+      }
+    }
+
     //*************************************************************************
     const transition* transition_table_end() const
     {
@@ -1113,7 +1317,392 @@ namespace etl
     uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
     uint_least8_t     state_table_size;       ///< The size of the table of states.
     bool              started;                ///< Set if the state chart has been started.
+    uint_least8_t*    p_transition_index;     ///< The first transition for each state and event, or ETL_NULLPTR.
+    uint_least8_t*    p_state_index;          ///< The state table entry for each state.
+    size_t            number_of_states;       ///< The number of states in the index.
+    size_t            number_of_events;       ///< The number of events in the index.
   };
+
+#if ETL_USING_CPP14
+  namespace state_chart_traits
+  {
+    //*************************************************************************
+    /// A compile time (state, event) lookup for a transition table.
+    /// Holds the index of the first transition for each state and event,
+    /// or Transition_Table_Size if there is none.
+    //*************************************************************************
+    template <typename TTransition, size_t Number_Of_States, size_t Number_Of_Events, size_t Transition_Table_Size>
+    struct transition_lookup
+    {
+      typedef typename etl::smallest_uint_for_value<Transition_Table_Size>::type index_t;
+
+      constexpr explicit transition_lookup(const TTransition* table)
+        : first()
+      {
+        for (size_t state_id = 0U; state_id < Number_Of_States; ++state_id)
+        {
+          for (size_t event_id = 0U; event_id < Number_Of_Events; ++event_id)
+          {
+            first[state_id][event_id] = index_t(Transition_Table_Size);
+          }
+        }
+
+        // Work backwards, so that the first matching transition in the table is the one that remains.
+        for (size_t i = Transition_Table_Size; i != 0U; --i)
+        {
+          const TTransition& t = table[i - 1U];
+
+          if (t.event_id < Number_Of_Events)
+          {
+            if (t.from_any_state)
+            {
+              for (size_t state_id = 0U; state_id < Number_Of_States; ++state_id)
+              {
+                first[state_id][t.event_id] = index_t(i - 1U);
+              }
+            }
+            else if (t.current_state_id < Number_Of_States)
+            {
+              first[t.current_state_id][t.event_id] = index_t(i - 1U);
+            }
+          }
+        }
+      }
+
+      index_t first[Number_Of_States][Number_Of_Events];
+    };
+
+    //*************************************************************************
+    /// A compile time lookup for a state table.
+    /// Holds the index of the entry for each state, or State_Table_Size if
+    /// there is none.
+    //*************************************************************************
+    template <typename TState, size_t Number_Of_States, size_t State_Table_Size>
+    struct state_lookup
+    {
+      typedef typename etl::smallest_uint_for_value<State_Table_Size>::type index_t;
+
+      constexpr explicit state_lookup(const TState* table)
+        : index()
+      {
+        for (size_t state_id = 0U; state_id < Number_Of_States; ++state_id)
+        {
+          index[state_id] = index_t(State_Table_Size);
+        }
+
+        for (size_t i = State_Table_Size; i != 0U; --i)
+        {
+          if (table[i - 1U].state_id < Number_Of_States)
+          {
+            index[table[i - 1U].state_id] = index_t(i - 1U);
+          }
+        }
+      }
+
+      index_t index[Number_Of_States];
+    };
+  }
+
+  namespace private_state_chart
+  {
+    //*************************************************************************
+    /// Checks that every transition moves to a valid state.
+    //*************************************************************************
+    template <typename TTransition>
+    constexpr bool next_states_are_valid(const TTransition* table, size_t table_size, size_t number_of_states)
+    {
+      for (size_t i = 0U; i < table_size; ++i)
+      {
+        if (table[i].next_state_id >= number_of_states)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The parts common to the indexed state charts.
+    //*************************************************************************
+    template <typename                                                        TObject,
+              typename                                                        TParameter,
+              TObject&                                                        TObject_Ref,
+              const etl::state_chart_traits::transition<TObject, TParameter>* Transition_Table_Begin,
+              size_t                                                          Transition_Table_Size,
+              const etl::state_chart_traits::state<TObject>*                  State_Table_Begin,
+              size_t                                                          State_Table_Size,
+              etl::state_chart_traits::state_id_t                             Initial_State,
+              size_t                                                          Number_Of_States,
+              size_t                                                          Number_Of_Events>
+    class indexed_state_chart_base : public etl::istate_chart<TParameter>
+    {
+    public:
+
+      ETL_STATIC_ASSERT(Number_Of_States > 0U, "Number_Of_States must not be zero");
+      ETL_STATIC_ASSERT(Number_Of_States <= (size_t(etl::integral_limits<etl::state_chart_traits::state_id_t>::max) + 1U), "Number_Of_States too large for state_id_t");
+      ETL_STATIC_ASSERT(Number_Of_Events <= (size_t(etl::integral_limits<etl::state_chart_traits::event_id_t>::max) + 1U), "Number_Of_Events too large for event_id_t");
+      ETL_STATIC_ASSERT(Initial_State < Number_Of_States, "Initial_State out of range");
+      ETL_STATIC_ASSERT(next_states_are_valid(Transition_Table_Begin, Transition_Table_Size, Number_Of_States), "Transition to a state out of range");
+
+      typedef state_chart_traits::state_id_t                       state_id_t;
+      typedef state_chart_traits::event_id_t                       event_id_t;
+      typedef state_chart_traits::transition<TObject, TParameter>  transition;
+      typedef state_chart_traits::state<TObject>                   state;
+
+      //***********************************************************************
+      /// Gets a reference to the implementation object.
+      //***********************************************************************
+      TObject& get_object()
+      {
+        return TObject_Ref;
+      }
+
+      //***********************************************************************
+      /// Gets a const reference to the implementation object.
+      //***********************************************************************
+      const TObject& get_object() const
+      {
+        return TObject_Ref;
+      }
+
+      //***********************************************************************
+      /// Start the state chart.
+      //***********************************************************************
+      virtual void start(bool on_entry_initial = true) ETL_OVERRIDE
+      {
+        if (!started)
+        {
+          if (on_entry_initial)
+          {
+            const state* s = find_state(this->current_state_id);
+
+            if ((s != ETL_NULLPTR) && (s->on_entry != ETL_NULLPTR))
+            {
+              (TObject_Ref.*(s->on_entry))();
+            }
+          }
+
+          started = true;
+        }
+      }
+
+    protected:
+
+      typedef state_chart_traits::transition_lookup<transition, Number_Of_States, Number_Of_Events, Transition_Table_Size> transition_lookup_t;
+      typedef state_chart_traits::state_lookup<state, Number_Of_States, State_Table_Size>                                   state_lookup_t;
+
+      //***********************************************************************
+      /// Constructor.
+      //***********************************************************************
+      ETL_CONSTEXPR indexed_state_chart_base()
+        : etl::istate_chart<TParameter>(Initial_State)
+        , started(false)
+      {
+      }
+
+      //***********************************************************************
+      /// Finds the transition to execute for the event in the current state,
+      /// or ETL_NULLPTR if there is none.
+      /// The first transition is found by lookup. Only if its guard fails is
+      /// the rest of the table searched.
+      //***********************************************************************
+      const transition* find_transition(event_id_t event_id) const
+      {
+        if (!started || (size_t(event_id) >= Number_Of_Events))
+        {
+          return ETL_NULLPTR;
+        }
+
+        const state_id_t  state_id = this->current_state_id;
+        const transition* t        = Transition_Table_Begin + transitions().first[state_id][event_id];
+        const transition* end      = Transition_Table_Begin + Transition_Table_Size;
+
+        while (t != end)
+        {
+          if ((t->guard == ETL_NULLPTR) || ((TObject_Ref.*t->guard)()))
+          {
+            return t;
+          }
+
+          // Search for a later matching transition.
+          ++t;
+
+          while ((t != end) && !((t->event_id == event_id) && (t->from_any_state || (t->current_state_id == state_id))))
+          {
+            ++t;
+          }
+        }
+
+        return ETL_NULLPTR;
+      }
+
+      //***********************************************************************
+      /// Moves to the next state, calling 'on_exit' and 'on_entry' if it is a
+      /// different state.
+      //***********************************************************************
+      void change_state(state_id_t next_state_id)
+      {
+        if (this->current_state_id != next_state_id)
+        {
+          const state* s = find_state(this->current_state_id);
+
+          if ((s != ETL_NULLPTR) && (s->on_exit != ETL_NULLPTR))
+          {
+            (TObject_Ref.*(s->on_exit))();
+          }
+
+          this->current_state_id = next_state_id;
+
+          s = find_state(this->current_state_id);
+
+          if ((s != ETL_NULLPTR) && (s->on_entry != ETL_NULLPTR))
+          {
+            (TObject_Ref.*(s->on_entry))();
+          }
+        }
+      }
+
+    private:
+
+      //***********************************************************************
+      static const transition_lookup_t& transitions()
+      {
+        static constexpr transition_lookup_t lookup(Transition_Table_Begin);
+
+        return lookup;
+      }
+
+      //***********************************************************************
+      static const state_lookup_t& states()
+      {
+        static constexpr state_lookup_t lookup(State_Table_Begin);
+
+        return lookup;
+      }
+
+      //***********************************************************************
+      static const state* find_state(state_id_t state_id)
+      {
+        const size_t index = states().index[state_id];
+
+        return (index != State_Table_Size) ? (State_Table_Begin + index) : ETL_NULLPTR;
+      }
+
+      // Disabled
+      indexed_state_chart_base(const indexed_state_chart_base&) ETL_DELETE;
+      indexed_state_chart_base& operator =(const indexed_state_chart_base&) ETL_DELETE;
+
+      bool started; ///< Set if the state chart has been started.
+    };
+  }
+
+  //***************************************************************************
+  /// Simple Finite State Machine
+  /// Compile time tables, with a compile time (state, event) lookup, so that
+  /// an event costs one indexed lookup instead of a search of the table.
+  /// State ids must be less than Number_Of_States.
+  /// Events with ids of Number_Of_Events or above are ignored.
+  /// The transition and state tables must be constexpr.
+  /// Event has no parameter.
+  //***************************************************************************
+  template <typename                                                  TObject,
+            TObject&                                                  TObject_Ref,
+            const etl::state_chart_traits::transition<TObject, void>* Transition_Table_Begin,
+            size_t                                                    Transition_Table_Size,
+            const etl::state_chart_traits::state<TObject>*            State_Table_Begin,
+            size_t                                                    State_Table_Size,
+            etl::state_chart_traits::state_id_t                       Initial_State,
+            size_t                                                    Number_Of_States,
+            size_t                                                    Number_Of_Events>
+  class indexed_state_chart_ct : public private_state_chart::indexed_state_chart_base<TObject, void, TObject_Ref,
+                                                                                     Transition_Table_Begin, Transition_Table_Size,
+                                                                                     State_Table_Begin, State_Table_Size,
+                                                                                     Initial_State, Number_Of_States, Number_Of_Events>
+  {
+  public:
+
+    typedef void parameter_t;
+    typedef state_chart_traits::state_id_t state_id_t;
+    typedef state_chart_traits::event_id_t event_id_t;
+    typedef state_chart_traits::transition<TObject, void> transition;
+    typedef state_chart_traits::state<TObject> state;
+
+    //*************************************************************************
+    /// Processes the specified event.
+    /// The state machine will action the <b>first</b> item in the transition table
+    /// that satisfies the conditions for executing the action.
+    /// \param event_id The id of the event to process.
+    //*************************************************************************
+    virtual void process_event(event_id_t event_id) ETL_OVERRIDE
+    {
+      const transition* t = this->find_transition(event_id);
+
+      if (t != ETL_NULLPTR)
+      {
+        if (t->action != ETL_NULLPTR)
+        {
+          (TObject_Ref.*t->action)();
+        }
+
+        this->change_state(t->next_state_id);
+      }
+    }
+  };
+
+  //***************************************************************************
+  /// Simple Finite State Machine
+  /// Compile time tables, with a compile time (state, event) lookup.
+  /// See etl::indexed_state_chart_ct.
+  /// Event has parameter.
+  /// With a parameter of const etl::imessage&, messages may be passed using
+  /// their message id as the event id.
+  //***************************************************************************
+  template <typename                                                        TObject,
+            typename                                                        TParameter,
+            TObject&                                                        TObject_Ref,
+            const etl::state_chart_traits::transition<TObject, TParameter>* Transition_Table_Begin,
+            size_t                                                          Transition_Table_Size,
+            const etl::state_chart_traits::state<TObject>*                  State_Table_Begin,
+            size_t                                                          State_Table_Size,
+            etl::state_chart_traits::state_id_t                             Initial_State,
+            size_t                                                          Number_Of_States,
+            size_t                                                          Number_Of_Events>
+  class indexed_state_chart_ctp : public private_state_chart::indexed_state_chart_base<TObject, TParameter, TObject_Ref,
+                                                                                      Transition_Table_Begin, Transition_Table_Size,
+                                                                                      State_Table_Begin, State_Table_Size,
+                                                                                      Initial_State, Number_Of_States, Number_Of_Events>
+  {
+  public:
+
+    typedef TParameter parameter_t;
+    typedef state_chart_traits::state_id_t state_id_t;
+    typedef state_chart_traits::event_id_t event_id_t;
+    typedef state_chart_traits::transition<TObject, parameter_t> transition;
+    typedef state_chart_traits::state<TObject> state;
+
+    //*************************************************************************
+    /// Processes the specified event.
+    /// The state machine will action the <b>first</b> item in the transition table
+    /// that satisfies the conditions for executing the action.
+    /// \param event_id The id of the event to process.
+    //*************************************************************************
+    virtual void process_event(event_id_t event_id, parameter_t data) ETL_OVERRIDE
+    {
+      const transition* t = this->find_transition(event_id);
+
+      if (t != ETL_NULLPTR)
+      {
+        if (t->action != ETL_NULLPTR)
+        {
+          (TObject_Ref.*t->action)(etl::forward<parameter_t>(data));
+        }
+
+        this->change_state(t->next_state_id);
+      }
+    }
+  };
+#endif
 }
 
 #endif
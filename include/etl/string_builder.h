@@ -0,0 +1,443 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_BUILDER_INCLUDED
+#define ETL_STRING_BUILDER_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "string.h"
+#include "string_view.h"
+#include "span.h"
+#include "to_string.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup string_builder string_builder
+/// Builds a string from a list of fragments, without copying them.
+/// Each fragment is a string_view, either of the caller's text or of a small
+/// copy kept in the builder's own buffer, for text such as formatted numbers
+/// that does not outlive the call.
+/// The fragments can be written out as a gather list, or copied once into a
+/// string.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the string_builder.
+  ///\ingroup string_builder
+  //***************************************************************************
+  class string_builder_exception : public etl::exception
+  {
+  public:
+
+    string_builder_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the string_builder.
+  /// Emitted when there is no room for another fragment, or for a copy.
+  ///\ingroup string_builder
+  //***************************************************************************
+  class string_builder_full : public etl::string_builder_exception
+  {
+  public:
+
+    string_builder_full(string_type file_name_, numeric_type line_number_)
+      : etl::string_builder_exception(ETL_ERROR_TEXT("string_builder:full", ETL_STRING_BUILDER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base for string builders of any size.
+  ///\ingroup string_builder
+  //***************************************************************************
+  class istring_builder
+  {
+  public:
+
+    typedef size_t                            size_type;
+    typedef etl::string_view                  chunk_type;
+    typedef etl::span<const etl::string_view> chunk_span;
+
+    //*************************************************************************
+    /// Appends a reference to the text.
+    /// The text is not copied, and must outlive the builder's use of it.
+    /// Text that follows on from the previous fragment extends it.
+    ///\return <b>true</b> if appended, <b>false</b> if there are no free fragments.
+    //*************************************************************************
+    bool append(etl::string_view text)
+    {
+      if (text.empty())
+      {
+        return true;
+      }
+
+      // Does it follow on from the last fragment?
+      if ((number_of_chunks != 0U) && (p_chunks[number_of_chunks - 1U].end() == text.begin()))
+      {
+        etl::string_view& last = p_chunks[number_of_chunks - 1U];
+        last = etl::string_view(last.data(), last.size() + text.size());
+      }
+      else
+      {
+        if (number_of_chunks == max_chunks)
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(string_builder_full));
+          return false;
+        }
+
+        p_chunks[number_of_chunks] = text;
+        ++number_of_chunks;
+      }
+
+      total_size += text.size();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Appends a reference to a null terminated string.
+    //*************************************************************************
+    bool append(const char* text)
+    {
+      return append(etl::string_view(text));
+    }
+
+    //*************************************************************************
+    /// Appends a copy of the text, held in the builder's buffer.
+    /// Consecutive copies share one fragment.
+    ///\return <b>true</b> if appended, <b>false</b> if there is no room.
+    //*************************************************************************
+    bool append_copy(etl::string_view text)
+    {
+      if (text.size() > (buffer_size - buffer_used))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(string_builder_full));
+        return false;
+      }
+
+      char* p = p_buffer + buffer_used;
+
+      etl::copy(text.begin(), text.end(), p);
+
+      // Only keep the copy if its fragment can be recorded.
+      if (append(etl::string_view(p, text.size())))
+      {
+        buffer_used += text.size();
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Appends a copy of a character.
+    //*************************************************************************
+    bool append(char c)
+    {
+      return append_copy(etl::string_view(&c, 1U));
+    }
+
+    //*************************************************************************
+    /// Appends a copy of the text of a value, as given by etl::to_string.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_arithmetic<T>::value && !etl::is_same<T, char>::value, bool>::type
+      append(T value)
+    {
+      etl::string<Max_Value_Size> text;
+      etl::to_string(value, text);
+
+      return append_copy(etl::string_view(text.data(), text.size()));
+    }
+
+    //*************************************************************************
+    /// Appends a copy of the text of a value, formatted by format.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_arithmetic<T>::value, bool>::type
+      append(T value, const etl::format_spec& format)
+    {
+      etl::string<Max_Value_Size> text;
+      etl::to_string(value, text, format);
+
+      return append_copy(etl::string_view(text.data(), text.size()));
+    }
+
+    //*************************************************************************
+    /// Stream operators.
+    /// Strings are referenced, other values are copied.
+    //*************************************************************************
+    istring_builder& operator <<(etl::string_view text)
+    {
+      append(text);
+      return *this;
+    }
+
+    istring_builder& operator <<(const char* text)
+    {
+      append(text);
+      return *this;
+    }
+
+    istring_builder& operator <<(char c)
+    {
+      append(c);
+      return *this;
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_arithmetic<T>::value && !etl::is_same<T, char>::value, istring_builder&>::type
+      operator <<(T value)
+    {
+      append(value);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets the fragments, as a gather list.
+    //*************************************************************************
+    chunk_span chunks() const
+    {
+      return chunk_span(p_chunks, number_of_chunks);
+    }
+
+    //*************************************************************************
+    /// Calls writer with each fragment, in order, as an etl::string_view.
+    /// For writers that can take a whole gather list, see chunks().
+    ///\return The number of characters written.
+    //*************************************************************************
+    template <typename TWriter>
+    size_type write(TWriter writer) const
+    {
+      for (size_type i = 0U; i < number_of_chunks; ++i)
+      {
+        writer(p_chunks[i]);
+      }
+
+      return total_size;
+    }
+
+    //*************************************************************************
+    /// Copies the text to str, replacing its contents.
+    /// The text is truncated if str is too small.
+    ///\return <b>true</b> if all of the text was copied.
+    //*************************************************************************
+    bool copy_to(etl::istring& str) const
+    {
+      str.clear();
+
+      return append_to(str);
+    }
+
+    //*************************************************************************
+    /// Appends the text to str.
+    /// The text is truncated if str is too small.
+    ///\return <b>true</b> if all of the text was copied.
+    //*************************************************************************
+    bool append_to(etl::istring& str) const
+    {
+      const bool fits = (total_size <= (str.max_size() - str.size()));
+
+      for (size_type i = 0U; i < number_of_chunks; ++i)
+      {
+        str.append(p_chunks[i].data(), p_chunks[i].size());
+      }
+
+      return fits;
+    }
+
+    //*************************************************************************
+    /// Copies up to n characters of the text to p.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    size_type copy(char* p, size_type n) const
+    {
+      size_type copied = 0U;
+
+      for (size_type i = 0U; (i < number_of_chunks) && (copied < n); ++i)
+      {
+        const size_type length = etl::min(p_chunks[i].size(), n - copied);
+
+        etl::copy_n(p_chunks[i].data(), length, p + copied);
+        copied += length;
+      }
+
+      return copied;
+    }
+
+    //*************************************************************************
+    /// Clears the builder.
+    //*************************************************************************
+    void clear()
+    {
+      number_of_chunks = 0U;
+      buffer_used      = 0U;
+      total_size       = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of characters in the text.
+    //*************************************************************************
+    size_type size() const
+    {
+      return total_size;
+    }
+
+    //*************************************************************************
+    /// Is there no text?
+    //*************************************************************************
+    bool empty() const
+    {
+      return total_size == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of fragments.
+    //*************************************************************************
+    size_type number_of_fragments() const
+    {
+      return number_of_chunks;
+    }
+
+    //*************************************************************************
+    /// The maximum number of fragments.
+    //*************************************************************************
+    size_type max_fragments() const
+    {
+      return max_chunks;
+    }
+
+    //*************************************************************************
+    /// The free space in the buffer for copies.
+    //*************************************************************************
+    size_type available_buffer() const
+    {
+      return buffer_size - buffer_used;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    istring_builder(etl::string_view* p_chunks_, size_type max_chunks_, char* p_buffer_, size_type buffer_size_)
+      : p_chunks(p_chunks_)
+      , max_chunks(max_chunks_)
+      , number_of_chunks(0U)
+      , p_buffer(p_buffer_)
+      , buffer_size(buffer_size_)
+      , buffer_used(0U)
+      , total_size(0U)
+    {
+    }
+
+#if defined(ETL_POLYMORPHIC_STRING_BUILDER) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+
+    virtual ~istring_builder()
+    {
+    }
+#else
+    ~istring_builder()
+    {
+    }
+#endif
+
+  private:
+
+    /// The largest text of a value appended by append(T).
+    enum
+    {
+      Max_Value_Size = 40
+    };
+
+    // Disabled.
+    istring_builder(const istring_builder&) ETL_DELETE;
+    istring_builder& operator =(const istring_builder&) ETL_DELETE;
+
+    etl::string_view* p_chunks;
+    size_type         max_chunks;
+    size_type         number_of_chunks;
+    char*             p_buffer;
+    size_type         buffer_size;
+    size_type         buffer_used;
+    size_type         total_size;
+  };
+
+  //***************************************************************************
+  /// A string builder.
+  ///\tparam MAX_FRAGMENTS_ The maximum number of fragments.
+  ///\tparam BUFFER_SIZE_   The size of the buffer for copied text.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <size_t MAX_FRAGMENTS_, size_t BUFFER_SIZE_ = 64U>
+  class string_builder : public etl::istring_builder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_FRAGMENTS_ > 0U, "string_builder: zero fragments");
+
+    static ETL_CONSTANT size_t MAX_FRAGMENTS = MAX_FRAGMENTS_;
+    static ETL_CONSTANT size_t BUFFER_SIZE   = BUFFER_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    string_builder()
+      : etl::istring_builder(fragments, MAX_FRAGMENTS_, buffer, BUFFER_SIZE_)
+    {
+    }
+
+  private:
+
+    etl::string_view fragments[MAX_FRAGMENTS_];
+    char             buffer[BUFFER_SIZE_ == 0U ? 1U : BUFFER_SIZE_];
+  };
+
+  template <size_t MAX_FRAGMENTS_, size_t BUFFER_SIZE_>
+  ETL_CONSTANT size_t string_builder<MAX_FRAGMENTS_, BUFFER_SIZE_>::MAX_FRAGMENTS;
+
+  template <size_t MAX_FRAGMENTS_, size_t BUFFER_SIZE_>
+  ETL_CONSTANT size_t string_builder<MAX_FRAGMENTS_, BUFFER_SIZE_>::BUFFER_SIZE;
+}
+
+#endif
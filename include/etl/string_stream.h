@@ -39,10 +39,12 @@ SOFTWARE.
 #include "to_string.h"
 #include "string_view.h"
 #include "basic_string_stream.h"
+#include "basic_string_sink_stream.h"
 
 namespace etl
 {
   typedef etl::basic_string_stream<etl::format_spec, etl::istring, etl::string_view> string_stream;
+  typedef etl::basic_string_sink_stream<etl::format_spec, etl::istring, etl::string_view> string_sink_stream;
 }
 
 #endif
@@ -0,0 +1,327 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_TABLE_INCLUDED
+#define ETL_STRING_TABLE_INCLUDED
+
+#include "platform.h"
+#include "optional.h"
+#include "power.h"
+#include "string_view.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup string_table string_table
+/// A table of strings with dense ids and a minimal perfect hash, which may
+/// be built at compile time from C++14.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// A table of VSize strings, with ids 0 to VSize - 1 in the order given.
+  /// A lookup is one hash of the string, one table read and one compare.
+  /// The perfect hash is found by 'hash and displace': the strings are put
+  /// in buckets by one part of the hash, then, largest bucket first, each
+  /// bucket is given the displacement that places all of its strings in free
+  /// slots. Buckets with one string are given a free slot directly.
+  /// The strings are not copied. They must outlive the table.
+  ///\code
+  /// constexpr etl::string_view keys[] = { "speed", "mode", "limit" };
+  /// constexpr auto table = etl::make_string_table(keys);
+  /// static_assert(table.is_valid(), "Duplicate keys");
+  /// etl::optional<size_t> id = table.lookup(key); // 0, 1, 2 or nullopt
+  ///\endcode
+  ///\ingroup string_table
+  //***************************************************************************
+  template <size_t VSize, typename T = char>
+  class string_table
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize > 0U, "No strings");
+
+    typedef etl::basic_string_view<T> view_type;
+    typedef size_t                    id_type;
+
+    static ETL_CONSTANT size_t Size  = VSize;
+    static ETL_CONSTANT size_t Slots = etl::power_of_2_round_up<VSize>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Builds the hash for the strings.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit string_table(const view_type (&strings_)[VSize])
+      : strings()
+      , hashes()
+      , slot_ids()
+      , displacements()
+      , valid(true)
+    {
+      // The strings, their hashes and sizes of the buckets.
+      size_t bucket_sizes[Slots] = {};
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        strings[i] = strings_[i];
+        hashes[i]  = hash(strings_[i]);
+        ++bucket_sizes[bucket(hashes[i])];
+      }
+
+      for (size_t s = 0U; s < Slots; ++s)
+      {
+        slot_ids[s] = VSize;
+      }
+
+      // Place the buckets, largest first.
+      for (size_t size = VSize; size > 0U; --size)
+      {
+        for (size_t b = 0U; b < Slots; ++b)
+        {
+          if (bucket_sizes[b] == size)
+          {
+            valid = valid && place(b, size);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Whether every string has a slot.
+    /// False if there are duplicate strings.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool is_valid() const
+    {
+      return valid;
+    }
+
+    //*************************************************************************
+    /// Finds the id of a string.
+    /// Returns Size if the string is not in the table.
+    //*************************************************************************
+    ETL_CONSTEXPR14 id_type find(view_type text) const
+    {
+      const uint64_t h = hash(text);
+
+      const int32_t  displacement = displacements[bucket(h)];
+      const size_t   slot         = (displacement < 0) ? size_t(-(displacement + 1)) : position(h, uint32_t(displacement));
+      const id_type  id           = slot_ids[slot];
+
+      return ((id < VSize) && (hashes[id] == h) && (strings[id] == text)) ? id : VSize;
+    }
+
+    //*************************************************************************
+    /// Finds the id of a string.
+    //*************************************************************************
+    ETL_CONSTEXPR14 etl::optional<id_type> lookup(view_type text) const
+    {
+      const id_type id = find(text);
+
+      return (id < VSize) ? etl::optional<id_type>(id) : etl::optional<id_type>();
+    }
+
+    //*************************************************************************
+    /// Whether the string is in the table.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(view_type text) const
+    {
+      return find(text) < VSize;
+    }
+
+    //*************************************************************************
+    /// The string for an id.
+    //*************************************************************************
+    ETL_CONSTEXPR14 view_type operator [](id_type id) const
+    {
+      return strings[id];
+    }
+
+    //*************************************************************************
+    /// The hash of the string for an id.
+    //*************************************************************************
+    ETL_CONSTEXPR14 uint64_t get_hash(id_type id) const
+    {
+      return hashes[id];
+    }
+
+    //*************************************************************************
+    /// The number of strings.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t size() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// The 64 bit FNV-1a hash of a string, by character value.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 uint64_t hash(view_type text)
+    {
+      uint64_t h = 0xCBF29CE484222325ULL;
+
+      for (size_t i = 0U; i < text.size(); ++i)
+      {
+        h = (h ^ uint64_t(text[i])) * 0x00000100000001B3ULL;
+      }
+
+      return h;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The bucket for a hash, from the high bits.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t bucket(uint64_t h)
+    {
+      return size_t(h >> 32U) & (Slots - 1U);
+    }
+
+    //*************************************************************************
+    /// The slot for a hash and displacement, from the mixed low bits.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t position(uint64_t h, uint32_t displacement)
+    {
+      uint32_t x = uint32_t(h) + (displacement * 0x9E3779B9UL);
+
+      x ^= x >> 16U;
+      x *= 0x85EBCA6BUL;
+      x ^= x >> 13U;
+      x *= 0xC2B2AE35UL;
+      x ^= x >> 16U;
+
+      return size_t(x) & (Slots - 1U);
+    }
+
+    //*************************************************************************
+    /// Places the strings of a bucket.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool place(size_t b, size_t bucket_size)
+    {
+      if (bucket_size == 1U)
+      {
+        // Any free slot will do.
+        for (size_t s = 0U; s < Slots; ++s)
+        {
+          if (slot_ids[s] == VSize)
+          {
+            for (size_t i = 0U; i < VSize; ++i)
+            {
+              if (bucket(hashes[i]) == b)
+              {
+                slot_ids[s]      = i;
+                displacements[b] = -int32_t(s) - 1;
+                return true;
+              }
+            }
+          }
+        }
+
+        return false;
+      }
+
+      for (uint32_t displacement = 0U; displacement < Max_Displacement; ++displacement)
+      {
+        if (try_place(b, displacement))
+        {
+          displacements[b] = int32_t(displacement);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Places the strings of a bucket with a displacement, if they all fit.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool try_place(size_t b, uint32_t displacement)
+    {
+      size_t placed[VSize] = {};
+      size_t count         = 0U;
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        if (bucket(hashes[i]) == b)
+        {
+          const size_t s = position(hashes[i], displacement);
+
+          if (slot_ids[s] != VSize)
+          {
+            // Taken, so undo.
+            while (count > 0U)
+            {
+              slot_ids[placed[--count]] = VSize;
+            }
+
+            return false;
+          }
+
+          slot_ids[s]      = i;
+          placed[count++] = s;
+        }
+      }
+
+      return true;
+    }
+
+    // Strings with the same hash can never be separated.
+    static ETL_CONSTANT uint32_t Max_Displacement = 0x10000UL;
+
+    view_type strings[VSize];
+    uint64_t  hashes[VSize];
+    id_type   slot_ids[Slots];
+    int32_t   displacements[Slots];
+    bool      valid;
+  };
+
+  template <size_t VSize, typename T>
+  ETL_CONSTANT size_t string_table<VSize, T>::Size;
+
+  template <size_t VSize, typename T>
+  ETL_CONSTANT size_t string_table<VSize, T>::Slots;
+
+  template <size_t VSize, typename T>
+  ETL_CONSTANT uint32_t string_table<VSize, T>::Max_Displacement;
+
+  //***************************************************************************
+  /// Makes a string table from an array of string views.
+  ///\ingroup string_table
+  //***************************************************************************
+  template <typename T, size_t VSize>
+  ETL_CONSTEXPR14 etl::string_table<VSize, T> make_string_table(const etl::basic_string_view<T> (&strings)[VSize])
+  {
+    return etl::string_table<VSize, T>(strings);
+  }
+}
+
+#endif
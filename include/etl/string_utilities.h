@@ -37,6 +37,8 @@ SOFTWARE.
 #include "memory.h"
 #include "char_traits.h"
 #include "optional.h"
+#include "iterator.h"
+#include "private/string_search.h"
 
 #include <ctype.h>
 #include <stdint.h>
@@ -756,6 +758,198 @@ namespace etl
     return etl::optional<TStringView>(view);
   }
 
+  //***************************************************************************
+  /// A forward range of the tokens in a string view.
+  /// The delimiters are read once into a table, and the input is scanned once,
+  /// as the range is iterated. Tokens are views of the input.
+  /// The input and the delimiters must outlive the range.
+  //***************************************************************************
+  template <typename TStringView>
+  class token_range
+  {
+  public:
+
+    typedef TStringView                                value_type;
+    typedef typename TStringView::value_type           char_type;
+    typedef typename TStringView::const_pointer        const_pointer;
+    typedef private_string_search::char_set<char_type> delimiter_set;
+
+    //*************************************************************************
+    /// Const Iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class token_range;
+
+      //***************************************************
+      /// Default constructor. An end iterator.
+      //***************************************************
+      const_iterator()
+        : p_range(ETL_NULLPTR)
+        , p_first(ETL_NULLPTR)
+        , p_last(ETL_NULLPTR)
+      {
+      }
+
+      //***************************************************
+      /// Pre-increment operator
+      //***************************************************
+      const_iterator& operator ++()
+      {
+        if (p_last == p_range->p_end)
+        {
+          // That was the last token.
+          p_first = ETL_NULLPTR;
+        }
+        else
+        {
+          find_token(p_last + 1U);
+        }
+
+        return *this;
+      }
+
+      //***************************************************
+      /// Post-increment operator
+      //***************************************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+
+        return temp;
+      }
+
+      //***************************************************
+      /// De-reference operator
+      //***************************************************
+      value_type operator *() const
+      {
+        return value_type(p_first, static_cast<typename value_type::size_type>(p_last - p_first));
+      }
+
+      //***************************************************
+      /// Equality operator
+      //***************************************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_first == rhs.p_first;
+      }
+
+      //***************************************************
+      /// Inequality operator
+      //***************************************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //***************************************************
+      /// Constructor for use by token_range
+      //***************************************************
+      const_iterator(const token_range* p_range_, const_pointer p_start)
+        : p_range(p_range_)
+        , p_first(ETL_NULLPTR)
+        , p_last(ETL_NULLPTR)
+      {
+        find_token(p_start);
+      }
+
+      //***************************************************
+      /// Finds the next token at or after p_start.
+      //***************************************************
+      void find_token(const_pointer p_start)
+      {
+        const_pointer p_end = p_range->p_end;
+
+        while (true)
+        {
+          const_pointer p = p_start;
+
+          while ((p != p_end) && !p_range->delimiters.contains(*p))
+          {
+            ++p;
+          }
+
+          if ((p != p_start) || !p_range->ignore_empty_tokens)
+          {
+            p_first = p_start;
+            p_last  = p;
+            return;
+          }
+
+          if (p == p_end)
+          {
+            // No more tokens.
+            p_first = ETL_NULLPTR;
+            return;
+          }
+
+          p_start = p + 1U;
+        }
+      }
+
+      const token_range* p_range;
+      const_pointer      p_first; ///< The start of the token, or ETL_NULLPTR at the end.
+      const_pointer      p_last;  ///< The delimiter or end after the token.
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param input               The input to tokenize.
+    ///\param delimiters          The delimiter characters.
+    ///\param delimiters_length   The number of delimiter characters.
+    ///\param ignore_empty_tokens If true, empty tokens between adjacent delimiters are skipped.
+    //*************************************************************************
+    token_range(const TStringView& input, const_pointer delimiters, size_t delimiters_length, bool ignore_empty_tokens_)
+      : p_begin(input.data())
+      , p_end(input.data() + input.size())
+      , delimiters(delimiters, delimiters_length)
+      , ignore_empty_tokens(ignore_empty_tokens_)
+    {
+    }
+
+    //*************************************************************************
+    /// The first token.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return (p_begin == ETL_NULLPTR) ? const_iterator() : const_iterator(this, p_begin);
+    }
+
+    //*************************************************************************
+    /// The end of the tokens.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator();
+    }
+
+  private:
+
+    const_pointer p_begin;
+    const_pointer p_end;
+    delimiter_set delimiters;
+    bool          ignore_empty_tokens;
+  };
+
+  //***************************************************************************
+  /// tokenize
+  /// Returns a forward range of the tokens in the input.
+  ///\param input               The input view.
+  ///\param delimiters          A null terminated string of delimiter characters.
+  ///\param ignore_empty_tokens If true, empty tokens between adjacent delimiters are skipped. Default true.
+  //***************************************************************************
+  template <typename TStringView>
+  etl::token_range<TStringView> tokenize(const TStringView& input, typename TStringView::const_pointer delimiters, bool ignore_empty_tokens = true)
+  {
+    return etl::token_range<TStringView>(input, delimiters, etl::strlen(delimiters), ignore_empty_tokens);
+  }
+
   //***************************************************************************
   /// pad_left
   //***************************************************************************
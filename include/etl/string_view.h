@@ -41,6 +41,7 @@ SOFTWARE.
 #include "hash.h"
 #include "basic_string.h"
 #include "algorithm.h"
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 #include <stdint.h>
@@ -479,21 +480,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return private_string_search::find_substring(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find(T c, size_type position = 0) const
@@ -558,25 +545,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return private_string_search::find_first_of(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find_first_of(T c, size_type position = 0) const
@@ -599,32 +568,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_last_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return private_string_search::find_last_of(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find_last_of(T c, size_type position = npos) const
@@ -647,33 +591,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-              break;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return private_string_search::find_first_not_of(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find_first_not_of(T c, size_type position = 0) const
@@ -696,40 +614,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_last_not_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-            break;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return private_string_search::find_last_not_of(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find_last_not_of(T c, size_type position = npos) const
@@ -52,6 +52,9 @@ namespace etl
 
   typedef uint_least8_t task_priority_t;
 
+  /// A time, in scheduler ticks.
+  typedef uint32_t task_tick_t;
+
   //***************************************************************************
   /// Task.
   //***************************************************************************
@@ -64,7 +67,11 @@ namespace etl
     //*******************************************
     task(task_priority_t priority)
       : task_running(true),
-        task_priority(priority)
+        task_priority(priority),
+        task_has_deadline(false),
+        task_period(0U),
+        task_release(0U),
+        task_deadline(0U)
     {
     }
 
@@ -119,10 +126,96 @@ namespace etl
       return task_priority;
     }
 
+    //*******************************************
+    /// Makes the task periodic, for timed scheduling policies such as
+    /// etl::scheduler_policy_earliest_deadline_first.
+    /// The task is first released at 'first_release', then every 'period'
+    /// ticks. Each release must be processed by the next.
+    /// A period of zero makes the task aperiodic again.
+    //*******************************************
+    void set_task_period(etl::task_tick_t period, etl::task_tick_t first_release = 0U)
+    {
+      task_period       = period;
+      task_release      = first_release;
+      task_deadline     = first_release + period;
+      task_has_deadline = (period != 0U);
+    }
+
+    //*******************************************
+    /// Get the period of the task. Zero if aperiodic.
+    //*******************************************
+    etl::task_tick_t get_task_period() const
+    {
+      return task_period;
+    }
+
+    //*******************************************
+    /// Checks if the task is periodic.
+    //*******************************************
+    bool task_is_periodic() const
+    {
+      return task_period != 0U;
+    }
+
+    //*******************************************
+    /// Get the tick of the next release of a periodic task.
+    //*******************************************
+    etl::task_tick_t get_task_release() const
+    {
+      return task_release;
+    }
+
+    //*******************************************
+    /// Sets the absolute deadline of an aperiodic task's current work.
+    //*******************************************
+    void set_task_deadline(etl::task_tick_t deadline)
+    {
+      task_deadline     = deadline;
+      task_has_deadline = true;
+    }
+
+    //*******************************************
+    /// Removes the deadline of an aperiodic task.
+    //*******************************************
+    void clear_task_deadline()
+    {
+      task_has_deadline = task_is_periodic();
+    }
+
+    //*******************************************
+    /// Checks if the task has a deadline.
+    //*******************************************
+    bool has_task_deadline() const
+    {
+      return task_has_deadline;
+    }
+
+    //*******************************************
+    /// Get the absolute deadline of the task's current work.
+    //*******************************************
+    etl::task_tick_t get_task_deadline() const
+    {
+      return task_deadline;
+    }
+
+    //*******************************************
+    /// Moves a periodic task on to its next release.
+    /// Called by the scheduling policy after it has processed a release.
+    //*******************************************
+    void advance_task_release()
+    {
+      task_release  += task_period;
+      task_deadline += task_period;
+    }
+
   private:
 
     bool task_running;
     etl::task_priority_t task_priority;
+    bool task_has_deadline;
+    etl::task_tick_t task_period;
+    etl::task_tick_t task_release;
+    etl::task_tick_t task_deadline;
   };
 }
 
@@ -0,0 +1,425 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TDIGEST_INCLUDED
+#define ETL_TDIGEST_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "math_constants.h"
+
+#include <math.h>
+#include <stddef.h>
+
+///\defgroup tdigest tdigest
+/// A streaming quantile sketch in fixed memory.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup tdigest
+  /// A merging t-digest.
+  /// Summarises a stream of values as a fixed number of weighted centroids,
+  /// small near the tails and large near the median, so that extreme
+  /// percentiles such as p99 and p99.9 are the most accurate.
+  /// New values are buffered, then merged into the centroids when the buffer
+  /// fills or a percentile is queried. Digests of the same type may be merged,
+  /// for example to combine the digests of several cores.
+  /// Memory is 6 * Compression centroids, each a mean and a weight.
+  ///\tparam TInput      The value type.
+  ///\tparam Compression The accuracy. Higher is more accurate but larger. Default 100.
+  ///\tparam TCalc       The type of the centroid means and weights. Default double.
+  //***************************************************************************
+  template <typename TInput, size_t Compression = 100U, typename TCalc = double>
+  class tdigest : public etl::unary_function<TInput, void>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Compression >= 10U, "Compression must be at least 10");
+    ETL_STATIC_ASSERT(etl::is_floating_point<TCalc>::value, "TCalc must be a floating point type");
+
+    typedef TInput value_type;
+    typedef TCalc  calc_type;
+
+    static ETL_CONSTANT size_t COMPRESSION   = Compression;
+    static ETL_CONSTANT size_t MAX_CENTROIDS = 2U * Compression;  ///< The maximum number of merged centroids.
+    static ETL_CONSTANT size_t BUFFER_SIZE   = 4U * Compression;  ///< The number of values buffered before merging.
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    tdigest()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    tdigest(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(TInput value)
+    {
+      add_weighted(TCalc(value), TCalc(1));
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(TInput value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Merges another digest into this one.
+    //*********************************
+    void merge(const tdigest& other)
+    {
+      if (&other == this)
+      {
+        return;
+      }
+
+      for (size_t i = 0U; i < other.number_of_entries; ++i)
+      {
+        add_weighted(other.entries[i].mean, other.entries[i].weight);
+      }
+
+      if (other.total_count != 0U)
+      {
+        minimum = (total_count == other.total_count) ? other.minimum : ((other.minimum < minimum) ? other.minimum : minimum);
+        maximum = (total_count == other.total_count) ? other.maximum : ((other.maximum > maximum) ? other.maximum : maximum);
+      }
+    }
+
+    //*********************************
+    /// Get the value at the percentile, from 0 to 100.
+    /// Interpolates between the centroids, and between the outer centroids
+    /// and the exact minimum and maximum.
+    /// Returns 0 if the digest is empty.
+    //*********************************
+    double percentile(double percentile_) const
+    {
+      if (total_count == 0U)
+      {
+        return 0.0;
+      }
+
+      compress();
+
+      percentile_ = (percentile_ < 0.0) ? 0.0 : ((percentile_ > 100.0) ? 100.0 : percentile_);
+
+      if (number_of_entries == 1U)
+      {
+        return double(entries[0].mean);
+      }
+
+      const double total = double(total_weight);
+      const double index = (percentile_ / 100.0) * total;
+
+      // Before the centre of the first centroid.
+      const double first_half = double(entries[0].weight) / 2.0;
+
+      if (index < first_half)
+      {
+        return interpolate(double(minimum), double(entries[0].mean), index / first_half);
+      }
+
+      double centre = first_half;
+
+      for (size_t i = 0U; i < (number_of_entries - 1U); ++i)
+      {
+        const double next_centre = centre + ((double(entries[i].weight) + double(entries[i + 1U].weight)) / 2.0);
+
+        if (index < next_centre)
+        {
+          return interpolate(double(entries[i].mean), double(entries[i + 1U].mean), (index - centre) / (next_centre - centre));
+        }
+
+        centre = next_centre;
+      }
+
+      // After the centre of the last centroid.
+      const double last_half = total - centre;
+
+      return interpolate(double(entries[number_of_entries - 1U].mean), double(maximum), (last_half > 0.0) ? ((index - centre) / last_half) : 1.0);
+    }
+
+    //*********************************
+    /// Get the minimum value added.
+    //*********************************
+    TCalc get_min() const
+    {
+      return minimum;
+    }
+
+    //*********************************
+    /// Get the maximum value added.
+    //*********************************
+    TCalc get_max() const
+    {
+      return maximum;
+    }
+
+    //*********************************
+    /// Get the number of values added.
+    //*********************************
+    size_t count() const
+    {
+      return total_count;
+    }
+
+    //*********************************
+    /// Get the number of centroids, after merging any buffered values.
+    //*********************************
+    size_t centroids() const
+    {
+      compress();
+
+      return number_of_entries;
+    }
+
+    //*********************************
+    /// Returns true if no values have been added.
+    //*********************************
+    bool empty() const
+    {
+      return total_count == 0U;
+    }
+
+    //*********************************
+    /// Clear the digest.
+    //*********************************
+    void clear()
+    {
+      number_of_centroids = 0U;
+      number_of_entries   = 0U;
+      total_weight        = TCalc(0);
+      total_count         = 0U;
+      minimum             = TCalc(0);
+      maximum             = TCalc(0);
+    }
+
+  private:
+
+    //*********************************
+    /// A centroid, or a buffered value with a weight of 1.
+    //*********************************
+    struct entry
+    {
+      TCalc mean;
+      TCalc weight;
+    };
+
+    //*********************************
+    struct compare_means
+    {
+      bool operator ()(const entry& lhs, const entry& rhs) const
+      {
+        return lhs.mean < rhs.mean;
+      }
+    };
+
+    //*********************************
+    /// Adds a weighted point to the buffer, merging if it is full.
+    //*********************************
+    void add_weighted(TCalc mean, TCalc weight)
+    {
+      if (number_of_entries == (MAX_CENTROIDS + BUFFER_SIZE))
+      {
+        compress();
+      }
+
+      if (total_count == 0U)
+      {
+        minimum = mean;
+        maximum = mean;
+      }
+      else
+      {
+        minimum = (mean < minimum) ? mean : minimum;
+        maximum = (mean > maximum) ? mean : maximum;
+      }
+
+      entries[number_of_entries].mean   = mean;
+      entries[number_of_entries].weight = weight;
+      ++number_of_entries;
+
+      total_weight += weight;
+      total_count  += size_t(weight);
+    }
+
+    //*********************************
+    /// The upper quantile of a centroid that starts at quantile q.
+    /// The centroid may span one unit of both of the scale functions
+    /// k1 = (Compression / 2pi) * asin(2q - 1), which limits the centroids
+    /// near the median, and k2 = (Compression / normaliser) * log(q / (1 - q)),
+    /// which shrinks them quickly towards the tails.
+    /// normaliser grows with the log of the number of values, to bound the
+    /// number of k2 centroids.
+    //*********************************
+    static double quantile_limit(double q, double normaliser)
+    {
+      if (q <= 0.0)
+      {
+        return 0.0;
+      }
+
+      if (q >= 1.0)
+      {
+        return 1.0;
+      }
+
+      // k1
+      const double angle  = asin((2.0 * q) - 1.0) + ((2.0 * etl::math::pi) / double(Compression));
+      const double limit1 = (angle >= (etl::math::pi / 2.0)) ? 1.0 : ((sin(angle) + 1.0) / 2.0);
+
+      // k2
+      const double k      = log(q / (1.0 - q)) + (normaliser / double(Compression));
+      const double limit2 = 1.0 / (1.0 + exp(-k));
+
+      return (limit1 < limit2) ? limit1 : limit2;
+    }
+
+    //*********************************
+    /// Linear interpolation.
+    //*********************************
+    static double interpolate(double a, double b, double t)
+    {
+      return a + ((b - a) * t);
+    }
+
+    //*********************************
+    /// Merges the buffered values into the centroids.
+    /// Sorts all of the entries by mean, then combines neighbours while the
+    /// combined centroid spans less than one unit of the scale function.
+    //*********************************
+    void compress() const
+    {
+      if (number_of_entries == number_of_centroids)
+      {
+        return;
+      }
+
+      etl::sort(entries, entries + number_of_entries, compare_means());
+
+      const double total = double(total_weight);
+      const double ratio = total / double(Compression);
+
+      const double normaliser = (4.0 * log((ratio > 1.0) ? ratio : 1.0)) + 24.0;
+
+      size_t output        = 0U;
+      double weight_so_far = 0.0;
+      double limit         = quantile_limit(0.0, normaliser);
+
+      for (size_t i = 1U; i < number_of_entries; ++i)
+      {
+        entry&       current = entries[output];
+        const entry& next    = entries[i];
+
+        const double proposed = double(current.weight) + double(next.weight);
+
+        // Merge if within the limit, or if there is no room for another centroid.
+        if ((((weight_so_far + proposed) / total) <= limit) || (output == (MAX_CENTROIDS - 1U)))
+        {
+          current.mean   += (next.mean - current.mean) * (next.weight / TCalc(proposed));
+          current.weight  = TCalc(proposed);
+        }
+        else
+        {
+          weight_so_far += double(current.weight);
+          limit = quantile_limit(weight_so_far / total, normaliser);
+
+          ++output;
+          entries[output] = next;
+        }
+      }
+
+      number_of_entries   = output + 1U;
+      number_of_centroids = number_of_entries;
+    }
+
+    mutable entry  entries[MAX_CENTROIDS + BUFFER_SIZE];
+    mutable size_t number_of_centroids; ///< The number of entries, from the start, that are merged centroids.
+    mutable size_t number_of_entries;   ///< The number of centroids plus buffered values.
+    TCalc          total_weight;
+    size_t         total_count;
+    TCalc          minimum;
+    TCalc          maximum;
+  };
+
+  template <typename TInput, size_t Compression, typename TCalc>
+  ETL_CONSTANT size_t tdigest<TInput, Compression, TCalc>::COMPRESSION;
+
+  template <typename TInput, size_t Compression, typename TCalc>
+  ETL_CONSTANT size_t tdigest<TInput, Compression, TCalc>::MAX_CENTROIDS;
+
+  template <typename TInput, size_t Compression, typename TCalc>
+  ETL_CONSTANT size_t tdigest<TInput, Compression, TCalc>::BUFFER_SIZE;
+}
+
+#endif
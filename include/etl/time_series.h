@@ -0,0 +1,719 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIME_SERIES_INCLUDED
+#define ETL_TIME_SERIES_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "binary.h"
+#include "bit_stream.h"
+#include "circular_buffer.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup time_series time_series
+/// Gorilla style compression of (timestamp, value) samples.
+/// Timestamps are stored as the difference between successive deltas, so a
+/// regular sample rate costs one bit per timestamp. Values are stored as the
+/// XOR with the previous value, so a repeated value costs one bit and a
+/// slowly changing value costs only its changing bits.
+/// See "Gorilla: A Fast, Scalable, In-Memory Time Series Database", VLDB 2015.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_time_series
+  {
+    //*************************************************************************
+    /// The unsigned type with the bits of a value.
+    //*************************************************************************
+    template <size_t Size>
+    struct value_bits_type;
+
+    template <>
+    struct value_bits_type<4U>
+    {
+      typedef uint32_t type;
+      static ETL_CONSTANT uint_least8_t Length_Bits = 5U;
+    };
+
+    template <>
+    struct value_bits_type<8U>
+    {
+      typedef uint64_t type;
+      static ETL_CONSTANT uint_least8_t Length_Bits = 6U;
+    };
+
+    //*************************************************************************
+    /// The ranges of delta of delta, each with its prefix and width.
+    //*************************************************************************
+    static ETL_CONSTANT int32_t Range_1 = 64;   ///< '10'   + 7 bits.
+    static ETL_CONSTANT int32_t Range_2 = 256;  ///< '110'  + 9 bits.
+    static ETL_CONSTANT int32_t Range_3 = 2048; ///< '1110' + 12 bits. Otherwise '1111' + the timestamp.
+
+    /// The leading zero count of a value is stored in 5 bits.
+    static ETL_CONSTANT uint_least8_t Leading_Bits = 5U;
+    static ETL_CONSTANT uint_least8_t Max_Leading  = 31U;
+  }
+
+  //***************************************************************************
+  /// Encodes samples into a bit_stream_writer.
+  /// TTimestamp is an integral type. Timestamps may wrap.
+  /// TValue is a 32 or 64 bit type, usually float or double.
+  /// The first sample after construction or restart is stored in full.
+  ///\ingroup time_series
+  //***************************************************************************
+  template <typename TTimestamp, typename TValue>
+  class time_series_encoder
+  {
+  private:
+
+    typedef typename etl::make_unsigned<TTimestamp>::type                 time_type;
+    typedef typename etl::make_signed<TTimestamp>::type                   signed_time_type;
+    typedef private_time_series::value_bits_type<sizeof(TValue)>          value_traits;
+    typedef typename value_traits::type                                   bits_type;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TTimestamp>::value, "Timestamp must be integral");
+
+    static ETL_CONSTANT uint_least8_t Time_Bits  = etl::integral_limits<time_type>::bits;
+    static ETL_CONSTANT uint_least8_t Value_Bits = etl::integral_limits<bits_type>::bits;
+
+    /// The most bits used by a sample.
+    static ETL_CONSTANT size_t Max_Sample_Bits = Time_Bits + Value_Bits;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    time_series_encoder()
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Starts a new series. The next sample is stored in full.
+    //*************************************************************************
+    void restart()
+    {
+      started       = false;
+      last_time     = 0U;
+      last_delta    = 0U;
+      last_bits     = 0U;
+      last_leading  = Value_Bits; // No window yet.
+      last_trailing = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of bits that writing the sample would use.
+    //*************************************************************************
+    size_t bits(TTimestamp timestamp, TValue value) const
+    {
+      fields f;
+      make_fields(timestamp, value, f);
+
+      return f.time_bits + f.value_bits;
+    }
+
+    //*************************************************************************
+    /// Writes a sample.
+    /// Returns false, and writes nothing, if the stream does not have room.
+    //*************************************************************************
+    bool write(etl::bit_stream_writer& writer, TTimestamp timestamp, TValue value)
+    {
+      fields f;
+      make_fields(timestamp, value, f);
+
+      if (writer.available_bits() < size_t(f.time_bits + f.value_bits))
+      {
+        return false;
+      }
+
+      if (!started)
+      {
+        writer.write_unchecked(f.time_code, Time_Bits);
+        writer.write_unchecked(f.value_code, Value_Bits);
+        started = true;
+      }
+      else
+      {
+        // Timestamp.
+        if (f.time_prefix_bits != 0U)
+        {
+          writer.write_unchecked(f.time_prefix, f.time_prefix_bits);
+        }
+
+        if (f.time_bits != f.time_prefix_bits)
+        {
+          writer.write_unchecked(f.time_code, static_cast<uint_least8_t>(f.time_bits - f.time_prefix_bits));
+        }
+
+        // Value.
+        if (f.value_prefix_bits != 0U)
+        {
+          writer.write_unchecked(f.value_prefix, f.value_prefix_bits);
+        }
+
+        if (f.value_bits != f.value_prefix_bits)
+        {
+          writer.write_unchecked(f.value_code, static_cast<uint_least8_t>(f.value_bits - f.value_prefix_bits));
+        }
+
+        last_delta = f.delta;
+      }
+
+      last_time     = f.time;
+      last_bits     = f.bits;
+      last_leading  = f.leading;
+      last_trailing = f.trailing;
+
+      return true;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The encoded sample.
+    //*************************************************************************
+    struct fields
+    {
+      time_type     time;
+      time_type     delta;
+      time_type     time_code;
+      uint_least8_t time_prefix;
+      uint_least8_t time_prefix_bits;
+      uint_least8_t time_bits;
+      bits_type     bits;
+      bits_type     value_code;
+      uint16_t      value_prefix;
+      uint_least8_t value_prefix_bits;
+      uint_least8_t value_bits;
+      uint_least8_t leading;
+      uint_least8_t trailing;
+    };
+
+    //*************************************************************************
+    /// Encodes a sample without writing it.
+    //*************************************************************************
+    void make_fields(TTimestamp timestamp, TValue value, fields& f) const
+    {
+      using namespace private_time_series;
+
+      f.time = static_cast<time_type>(timestamp);
+      memcpy(&f.bits, &value, sizeof(f.bits));
+
+      f.leading  = last_leading;
+      f.trailing = last_trailing;
+
+      if (!started)
+      {
+        f.delta             = 0U;
+        f.time_code         = f.time;
+        f.time_prefix       = 0U;
+        f.time_prefix_bits  = 0U;
+        f.time_bits         = Time_Bits;
+        f.value_code        = f.bits;
+        f.value_prefix      = 0U;
+        f.value_prefix_bits = 0U;
+        f.value_bits        = Value_Bits;
+
+        return;
+      }
+
+      // Delta of delta.
+      f.delta = static_cast<time_type>(f.time - last_time);
+
+      const signed_time_type dod = static_cast<signed_time_type>(static_cast<time_type>(f.delta - last_delta));
+
+      if (dod == 0)
+      {
+        f.time_prefix      = 0x00U; // '0'
+        f.time_prefix_bits = 1U;
+        f.time_code        = 0U;
+        f.time_bits        = 1U;
+      }
+      else if ((dod >= (1 - Range_1)) && (dod <= Range_1))
+      {
+        f.time_prefix      = 0x02U; // '10'
+        f.time_prefix_bits = 2U;
+        f.time_code        = static_cast<time_type>(dod + (Range_1 - 1));
+        f.time_bits        = 2U + 7U;
+      }
+      else if ((dod >= (1 - Range_2)) && (dod <= Range_2))
+      {
+        f.time_prefix      = 0x06U; // '110'
+        f.time_prefix_bits = 3U;
+        f.time_code        = static_cast<time_type>(dod + (Range_2 - 1));
+        f.time_bits        = 3U + 9U;
+      }
+      else if ((dod >= (1 - Range_3)) && (dod <= Range_3))
+      {
+        f.time_prefix      = 0x0EU; // '1110'
+        f.time_prefix_bits = 4U;
+        f.time_code        = static_cast<time_type>(dod + (Range_3 - 1));
+        f.time_bits        = 4U + 12U;
+      }
+      else
+      {
+        f.time_prefix      = 0x0FU; // '1111'
+        f.time_prefix_bits = 4U;
+        f.time_code        = static_cast<time_type>(dod);
+        f.time_bits        = 4U + Time_Bits;
+      }
+
+      // XOR with the previous value.
+      const bits_type x = f.bits ^ last_bits;
+
+      if (x == 0U)
+      {
+        f.value_prefix      = 0x00U; // '0'
+        f.value_prefix_bits = 1U;
+        f.value_code        = 0U;
+        f.value_bits        = 1U;
+
+        return;
+      }
+
+      uint_least8_t leading  = etl::count_leading_zeros(x);
+      uint_least8_t trailing = etl::count_trailing_zeros(x);
+
+      leading = (leading > Max_Leading) ? Max_Leading : leading;
+
+      if ((last_leading < Value_Bits) && (leading >= last_leading) && (trailing >= last_trailing))
+      {
+        // Fits in the previous window.
+        const uint_least8_t length = static_cast<uint_least8_t>(Value_Bits - last_leading - last_trailing);
+
+        f.value_prefix      = 0x02U; // '10'
+        f.value_prefix_bits = 2U;
+        f.value_code        = x >> last_trailing;
+        f.value_bits        = static_cast<uint_least8_t>(2U + length);
+      }
+      else
+      {
+        // A new window.
+        const uint_least8_t length = static_cast<uint_least8_t>(Value_Bits - leading - trailing);
+
+        f.leading           = leading;
+        f.trailing          = trailing;
+        f.value_prefix      = static_cast<uint16_t>((0x03U << (Leading_Bits + value_traits::Length_Bits)) |
+                                                    (leading << value_traits::Length_Bits) |
+                                                    (length - 1U));
+        f.value_prefix_bits = static_cast<uint_least8_t>(2U + Leading_Bits + value_traits::Length_Bits);
+        f.value_code        = x >> trailing;
+        f.value_bits        = static_cast<uint_least8_t>(f.value_prefix_bits + length);
+      }
+    }
+
+    bool          started;
+    time_type     last_time;
+    time_type     last_delta;
+    bits_type     last_bits;
+    uint_least8_t last_leading;
+    uint_least8_t last_trailing;
+  };
+
+  template <typename TTimestamp, typename TValue>
+  ETL_CONSTANT uint_least8_t time_series_encoder<TTimestamp, TValue>::Time_Bits;
+
+  template <typename TTimestamp, typename TValue>
+  ETL_CONSTANT uint_least8_t time_series_encoder<TTimestamp, TValue>::Value_Bits;
+
+  template <typename TTimestamp, typename TValue>
+  ETL_CONSTANT size_t time_series_encoder<TTimestamp, TValue>::Max_Sample_Bits;
+
+  //***************************************************************************
+  /// Decodes samples from a bit_stream_reader.
+  /// The stream does not record the number of samples.
+  ///\ingroup time_series
+  //***************************************************************************
+  template <typename TTimestamp, typename TValue>
+  class time_series_decoder
+  {
+  private:
+
+    typedef typename etl::make_unsigned<TTimestamp>::type        time_type;
+    typedef typename etl::make_signed<TTimestamp>::type          signed_time_type;
+    typedef private_time_series::value_bits_type<sizeof(TValue)> value_traits;
+    typedef typename value_traits::type                          bits_type;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TTimestamp>::value, "Timestamp must be integral");
+
+    static ETL_CONSTANT uint_least8_t Time_Bits  = etl::integral_limits<time_type>::bits;
+    static ETL_CONSTANT uint_least8_t Value_Bits = etl::integral_limits<bits_type>::bits;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    time_series_decoder()
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Starts a new series.
+    //*************************************************************************
+    void restart()
+    {
+      started       = false;
+      last_time     = 0U;
+      last_delta    = 0U;
+      last_bits     = 0U;
+      last_leading  = 0U;
+      last_trailing = 0U;
+    }
+
+    //*************************************************************************
+    /// Reads a sample.
+    /// Returns false if the stream ends first.
+    //*************************************************************************
+    bool read(etl::bit_stream_reader& reader, TTimestamp& timestamp, TValue& value)
+    {
+      using namespace private_time_series;
+
+      if (!started)
+      {
+        if (!read_bits(reader, Time_Bits, last_time) || !read_bits(reader, Value_Bits, last_bits))
+        {
+          return false;
+        }
+
+        started = true;
+      }
+      else
+      {
+        // Delta of delta.
+        uint_least8_t ones = 0U;
+
+        if (!read_ones(reader, 4U, ones))
+        {
+          return false;
+        }
+
+        time_type dod = 0U;
+
+        if (ones != 0U)
+        {
+          static const uint_least8_t widths[4]  = { 7U, 9U, 12U, Time_Bits };
+          static const int32_t       offsets[4] = { Range_1 - 1, Range_2 - 1, Range_3 - 1, 0 };
+
+          if (!read_bits(reader, widths[ones - 1U], dod))
+          {
+            return false;
+          }
+
+          dod = static_cast<time_type>(dod - static_cast<time_type>(offsets[ones - 1U]));
+        }
+
+        // XOR with the previous value.
+        uint_least8_t control = 0U;
+
+        if (!read_ones(reader, 2U, control))
+        {
+          return false;
+        }
+
+        if (control == 2U)
+        {
+          // A new window.
+          uint_least8_t leading;
+          uint_least8_t length;
+
+          if (!read_bits(reader, Leading_Bits, leading) || !read_bits(reader, value_traits::Length_Bits, length))
+          {
+            return false;
+          }
+
+          last_leading  = leading;
+          last_trailing = static_cast<uint_least8_t>(Value_Bits - leading - length - 1U);
+        }
+
+        if (control != 0U)
+        {
+          bits_type x;
+
+          if (!read_bits(reader, static_cast<uint_least8_t>(Value_Bits - last_leading - last_trailing), x))
+          {
+            return false;
+          }
+
+          last_bits ^= (x << last_trailing);
+        }
+
+        last_delta = static_cast<time_type>(last_delta + dod);
+        last_time  = static_cast<time_type>(last_time + last_delta);
+      }
+
+      timestamp = static_cast<TTimestamp>(last_time);
+      memcpy(&value, &last_bits, sizeof(value));
+
+      return true;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Reads nbits into value.
+    //*************************************************************************
+    template <typename T>
+    static bool read_bits(etl::bit_stream_reader& reader, uint_least8_t nbits, T& value)
+    {
+      etl::optional<T> result = reader.read<T>(nbits);
+
+      if (result.has_value())
+      {
+        value = result.value();
+      }
+
+      return result.has_value();
+    }
+
+    //*************************************************************************
+    /// Reads a prefix of up to 'maximum' ones, ended by a zero.
+    //*************************************************************************
+    static bool read_ones(etl::bit_stream_reader& reader, uint_least8_t maximum, uint_least8_t& ones)
+    {
+      ones = 0U;
+
+      while (ones < maximum)
+      {
+        etl::optional<bool> bit = reader.read<bool>();
+
+        if (!bit.has_value())
+        {
+          return false;
+        }
+
+        if (!bit.value())
+        {
+          break;
+        }
+
+        ++ones;
+      }
+
+      return true;
+    }
+
+    bool          started;
+    time_type     last_time;
+    time_type     last_delta;
+    bits_type     last_bits;
+    uint_least8_t last_leading;
+    uint_least8_t last_trailing;
+  };
+
+  template <typename TTimestamp, typename TValue>
+  ETL_CONSTANT uint_least8_t time_series_decoder<TTimestamp, TValue>::Time_Bits;
+
+  template <typename TTimestamp, typename TValue>
+  ETL_CONSTANT uint_least8_t time_series_decoder<TTimestamp, TValue>::Value_Bits;
+
+  //***************************************************************************
+  /// A history of samples, compressed into VMax_Blocks blocks of VBlock_Size
+  /// bytes. When all blocks are full the oldest block is evicted whole.
+  /// Each block is encoded independently.
+  ///\ingroup time_series
+  //***************************************************************************
+  template <typename TTimestamp, typename TValue, size_t VBlock_Size, size_t VMax_Blocks>
+  class compressed_history
+  {
+  public:
+
+    typedef etl::time_series_encoder<TTimestamp, TValue> encoder_type;
+    typedef etl::time_series_decoder<TTimestamp, TValue> decoder_type;
+
+    ETL_STATIC_ASSERT(VMax_Blocks >= 2U, "There must be at least two blocks");
+    ETL_STATIC_ASSERT((VBlock_Size * CHAR_BIT) >= encoder_type::Max_Sample_Bits, "A block must hold at least one sample");
+
+    static ETL_CONSTANT size_t Block_Size = VBlock_Size;
+    static ETL_CONSTANT size_t Max_Blocks = VMax_Blocks;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    compressed_history()
+      : writer(current.data, VBlock_Size, etl::endian::big)
+      , samples(0U)
+    {
+      current.count = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a sample.
+    //*************************************************************************
+    void push(TTimestamp timestamp, TValue value)
+    {
+      if (!encoder.write(writer, timestamp, value))
+      {
+        // The current block is full, so seal it.
+        if (sealed.full())
+        {
+          samples -= sealed.front().count;
+        }
+
+        sealed.push(current);
+
+        writer.restart();
+        encoder.restart();
+        current.count = 0U;
+
+        encoder.write(writer, timestamp, value);
+      }
+
+      ++current.count;
+      ++samples;
+    }
+
+    //*************************************************************************
+    /// Calls function(timestamp, value) for each sample, from the oldest.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each(TFunction function) const
+    {
+      for (typename sealed_type::const_iterator itr = sealed.begin(); itr != sealed.end(); ++itr)
+      {
+        decode_block(*itr, function);
+      }
+
+      decode_block(current, function);
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Removes all samples.
+    //*************************************************************************
+    void clear()
+    {
+      sealed.clear();
+      writer.restart();
+      encoder.restart();
+      current.count = 0U;
+      samples       = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of samples.
+    //*************************************************************************
+    size_t size() const
+    {
+      return samples;
+    }
+
+    //*************************************************************************
+    /// Whether there are no samples.
+    //*************************************************************************
+    bool empty() const
+    {
+      return samples == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of blocks in use, including the one being filled.
+    //*************************************************************************
+    size_t block_count() const
+    {
+      return sealed.size() + 1U;
+    }
+
+    //*************************************************************************
+    /// The number of bytes of compressed samples.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return (sealed.size() * VBlock_Size) + writer.size_bytes();
+    }
+
+    //*************************************************************************
+    /// The number of bytes for compressed samples.
+    //*************************************************************************
+    size_t capacity_bytes() const
+    {
+      return VMax_Blocks * VBlock_Size;
+    }
+
+  private:
+
+    compressed_history(const compressed_history&) ETL_DELETE;
+    compressed_history& operator =(const compressed_history&) ETL_DELETE;
+
+    //*************************************************************************
+    /// A block of encoded samples.
+    //*************************************************************************
+    struct block
+    {
+      char   data[VBlock_Size];
+      size_t count;
+    };
+
+    typedef etl::circular_buffer<block, VMax_Blocks - 1U> sealed_type;
+
+    //*************************************************************************
+    /// Decodes the samples of a block.
+    //*************************************************************************
+    template <typename TFunction>
+    static void decode_block(const block& b, TFunction& function)
+    {
+      etl::bit_stream_reader reader(etl::span<const char>(b.data, VBlock_Size), etl::endian::big);
+      decoder_type           decoder;
+
+      TTimestamp timestamp;
+      TValue     value;
+
+      for (size_t i = 0U; i < b.count; ++i)
+      {
+        decoder.read(reader, timestamp, value);
+        function(timestamp, value);
+      }
+    }
+
+    block                  current;
+    etl::bit_stream_writer writer;
+    encoder_type           encoder;
+    sealed_type            sealed;
+    size_t                 samples;
+  };
+
+  template <typename TTimestamp, typename TValue, size_t VBlock_Size, size_t VMax_Blocks>
+  ETL_CONSTANT size_t compressed_history<TTimestamp, TValue, VBlock_Size, VMax_Blocks>::Block_Size;
+
+  template <typename TTimestamp, typename TValue, size_t VBlock_Size, size_t VMax_Blocks>
+  ETL_CONSTANT size_t compressed_history<TTimestamp, TValue, VBlock_Size, VMax_Blocks>::Max_Blocks;
+}
+
+#endif
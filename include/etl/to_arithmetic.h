@@ -46,6 +46,10 @@ SOFTWARE.
 #include "expected.h"
 #include "math.h"
 
+#if ETL_HAS_FAST_FLOAT_PARSE
+  #include "private/to_arithmetic_fast_float.h"
+#endif
+
 #include <math.h>
 
 namespace etl
@@ -374,10 +378,10 @@ namespace etl
     {
       //*********************************
       ETL_CONSTEXPR14
-      integral_accumulator(etl::radix::value_type radix_, TValue maximum_)
+      integral_accumulator(etl::radix::value_type radix_, TValue maximum_, TValue initial_value_ = 0)
         : radix(radix_)
         , maximum(maximum_)
-        , integral_value(0)
+        , integral_value(initial_value_)
         , conversion_status(to_arithmetic_status::Valid)
       {
       }
@@ -645,6 +649,392 @@ namespace etl
       to_arithmetic_status conversion_status;
     };
 
+#if ETL_HAS_FAST_FLOAT_PARSE
+    //***************************************************************************
+    /// The decimal significand and exponent of a floating point string.
+    //***************************************************************************
+    struct decimal_float
+    {
+      uint64_t significand;  ///< The leading significant digits.
+      int      exponent;     ///< The power of ten that the significand is scaled by.
+      bool     is_negative;
+      bool     is_truncated; ///< True if non-zero digits followed the first 19.
+    };
+
+    //***************************************************************************
+    /// Splits the text into a decimal significand and exponent.
+    /// Accepts the same format as floating_point_accumulator.
+    /// Returns false if the format is invalid.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    bool scan_decimal_float(const etl::basic_string_view<TChar>& view, decimal_float& decimal)
+    {
+      const int Max_Significant_Digits = 19;
+      const int Max_Exponent_Value     = 100000;
+
+      typename etl::basic_string_view<TChar>::const_iterator       itr     = view.begin();
+      const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
+
+      decimal.significand  = 0U;
+      decimal.exponent     = 0;
+      decimal.is_negative  = false;
+      decimal.is_truncated = false;
+
+      if ((itr != itr_end) && ((convert(*itr) == char_constant::Positive_Char) || (convert(*itr) == char_constant::Negative_Char)))
+      {
+        decimal.is_negative = (convert(*itr) == char_constant::Negative_Char);
+        ++itr;
+      }
+
+      int  significant_digits = 0;
+      bool is_fractional      = false;
+
+      // The significand.
+      for (; itr != itr_end; ++itr)
+      {
+        const char c = convert(*itr);
+
+        if ((c == char_constant::Radix_Point1_Char) || (c == char_constant::Radix_Point2_Char))
+        {
+          if (is_fractional)
+          {
+            return false;
+          }
+
+          is_fractional = true;
+        }
+        else if (c == char_constant::Exponential_Char)
+        {
+          break;
+        }
+        else if (is_valid(c, etl::radix::decimal))
+        {
+          const uint64_t digit = static_cast<uint64_t>(digit_value(c, etl::radix::decimal));
+
+          if ((significant_digits == 0) && (digit == 0U))
+          {
+            // A leading zero.
+            decimal.exponent -= (is_fractional ? 1 : 0);
+          }
+          else if (significant_digits < Max_Significant_Digits)
+          {
+            decimal.significand = (decimal.significand * 10U) + digit;
+            decimal.exponent   -= (is_fractional ? 1 : 0);
+            ++significant_digits;
+          }
+          else
+          {
+            decimal.is_truncated = decimal.is_truncated || (digit != 0U);
+            decimal.exponent    += (is_fractional ? 0 : 1);
+          }
+        }
+        else
+        {
+          return false;
+        }
+      }
+
+      // The exponent.
+      if (itr != itr_end)
+      {
+        ++itr;
+
+        bool is_negative_exponent = false;
+
+        if ((itr != itr_end) && ((convert(*itr) == char_constant::Positive_Char) || (convert(*itr) == char_constant::Negative_Char)))
+        {
+          is_negative_exponent = (convert(*itr) == char_constant::Negative_Char);
+          ++itr;
+        }
+
+        int exponent_value = 0;
+
+        for (; itr != itr_end; ++itr)
+        {
+          const char c = convert(*itr);
+
+          if (!is_valid(c, etl::radix::decimal))
+          {
+            return false;
+          }
+
+          // Anything larger is out of range anyway.
+          if (exponent_value < Max_Exponent_Value)
+          {
+            exponent_value = (exponent_value * 10) + digit_value(c, etl::radix::decimal);
+          }
+        }
+
+        decimal.exponent += (is_negative_exponent ? -exponent_value : exponent_value);
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Reads up to fast_float_bigint::Max_Digits significant digits of a
+    /// floating point string that has been checked by scan_decimal_float.
+    /// is_sticky is set if there were non-zero digits after those read.
+    //***************************************************************************
+    template <typename TChar>
+    void scan_decimal_digits(const etl::basic_string_view<TChar>& view, fast_float_bigint& digits, int& digit_count, bool& is_sticky)
+    {
+      typename etl::basic_string_view<TChar>::const_iterator       itr     = view.begin();
+      const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
+
+      digit_count = 0;
+      is_sticky   = false;
+
+      uint32_t chunk        = 0U;
+      uint32_t chunk_scale  = 1U;
+
+      for (; itr != itr_end; ++itr)
+      {
+        const char c = convert(*itr);
+
+        if (c == char_constant::Exponential_Char)
+        {
+          break;
+        }
+
+        if (!is_valid(c, etl::radix::decimal) || ((digit_count == 0) && (c == '0')))
+        {
+          // A sign, a radix point or a leading zero.
+          continue;
+        }
+
+        const uint32_t digit = static_cast<uint32_t>(digit_value(c, etl::radix::decimal));
+
+        if (size_t(digit_count) < fast_float_bigint::Max_Digits)
+        {
+          // Gather the digits nine at a time.
+          chunk        = (chunk * 10U) + digit;
+          chunk_scale *= 10U;
+          ++digit_count;
+
+          if (chunk_scale == 1000000000U)
+          {
+            digits.multiply_add(chunk_scale, chunk);
+            chunk       = 0U;
+            chunk_scale = 1U;
+          }
+        }
+        else
+        {
+          is_sticky = is_sticky || (digit != 0U);
+        }
+      }
+
+      if (chunk_scale != 1U)
+      {
+        digits.multiply_add(chunk_scale, chunk);
+      }
+    }
+
+    //***************************************************************************
+    /// Converts text to float or double with the Eisel-Lemire algorithm.
+    /// Strings with more than 19 significant digits that lie too close to the
+    /// halfway point between two floats are resolved by exact comparison.
+    //***************************************************************************
+    template <typename TValue, typename TChar>
+    bool fast_float_conversion(const etl::basic_string_view<TChar>& view, etl::to_arithmetic_result<TValue>& result, etl::bool_constant<true> /*is_supported*/)
+    {
+      typedef typename etl::to_arithmetic_result<TValue>::unexpected_type unexpected_type;
+
+      decimal_float decimal = decimal_float();
+
+      if (!scan_decimal_float(view, decimal))
+      {
+        result = unexpected_type(to_arithmetic_status::Invalid_Format);
+        return true;
+      }
+
+      TValue value = 0;
+
+      if (!fast_float_decimal_to_float(decimal.significand, decimal.exponent, decimal.is_truncated, decimal.is_negative, value))
+      {
+        fast_float_bigint digits;
+        int  digit_count = 0;
+        bool is_sticky   = false;
+
+        scan_decimal_digits(view, digits, digit_count, is_sticky);
+
+        // The significand held the first 19 digits.
+        fast_float_round_by_digits(value, digits, decimal.exponent - (digit_count - 19), is_sticky);
+      }
+
+      if (etl::is_infinity(value))
+      {
+        result = unexpected_type(to_arithmetic_status::Overflow);
+      }
+      else
+      {
+        result = value;
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Types not in IEEE 754 binary32 or binary64 format use floating_point_accumulator.
+    //***************************************************************************
+    template <typename TValue, typename TChar>
+    bool fast_float_conversion(const etl::basic_string_view<TChar>&, etl::to_arithmetic_result<TValue>&, etl::bool_constant<false> /*is_supported*/)
+    {
+      return false;
+    }
+#endif
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Loads eight characters into a word, the first in the lowest byte.
+    /// Compilers reduce this to a single load on little endian targets.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    uint64_t load_eight_chars(const TChar* p)
+    {
+      uint64_t word = 0U;
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        word |= uint64_t(static_cast<uint8_t>(p[i])) << (i * 8U);
+      }
+
+      return word;
+    }
+
+    //***************************************************************************
+    /// Sets the top bit of each byte that is within [Low, High].
+    /// Every byte must be less than 0x80.
+    //***************************************************************************
+    template <uint8_t Low, uint8_t High>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    uint64_t bytes_in_range(uint64_t word)
+    {
+      const uint64_t Ones = 0x0101010101010101ULL;
+
+      return (word + (Ones * (0x80U - Low))) & ~(word + (Ones * (0x7FU - High))) & (Ones * 0x80U);
+    }
+
+    //***************************************************************************
+    /// Converts eight decimal digits to their value, eight at a time.
+    /// Returns false if any of the characters is not a decimal digit.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    bool parse_eight_decimal_digits(uint64_t word, uint32_t& value)
+    {
+      // Every byte in '0' to '9'?
+      if ((((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) != 0x3333333333333333ULL))
+      {
+        return false;
+      }
+
+      word -= 0x3030303030303030ULL;
+
+      // Combine the pairs, then the quads, then the halves.
+      word  = (word * 10U) + (word >> 8U);
+      word  = (((word & 0x000000FF000000FFULL) * (100U + (1000000ULL << 32U))) +
+               (((word >> 16U) & 0x000000FF000000FFULL) * (1U + (10000ULL << 32U)))) >> 32U;
+
+      value = static_cast<uint32_t>(word);
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Converts eight hexadecimal digits of either case to their value.
+    /// Returns false if any of the characters is not a hexadecimal digit.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    bool parse_eight_hex_digits(uint64_t word, uint32_t& value)
+    {
+      const uint64_t High_Bits = 0x8080808080808080ULL;
+
+      if ((word & High_Bits) != 0U)
+      {
+        return false;
+      }
+
+      const uint64_t lower   = word | 0x2020202020202020ULL;
+      const uint64_t digits  = bytes_in_range<'0', '9'>(word);
+      const uint64_t letters = bytes_in_range<'a', 'f'>(lower);
+
+      if ((digits | letters) != High_Bits)
+      {
+        return false;
+      }
+
+      // '0'-'9' have low nibbles of 0-9. 'a'-'f' have 1-6, so add 9.
+      const uint64_t nibbles = (lower & 0x0F0F0F0F0F0F0F0FULL) + ((letters >> 7U) * 9U);
+
+      // Combine the pairs of nibbles, the first being the most significant.
+      const uint64_t bytes = ((nibbles & 0x000F000F000F000FULL) << 4U) | ((nibbles >> 8U) & 0x000F000F000F000FULL);
+
+      value = static_cast<uint32_t>(((bytes & 0xFFU) << 24U) | (((bytes >> 16U) & 0xFFU) << 16U) |
+                                    (((bytes >> 32U) & 0xFFU) << 8U) | ((bytes >> 48U) & 0xFFU));
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Converts leading blocks of eight decimal or hexadecimal characters.
+    /// Stops before a block that contains another character, or that would
+    /// overflow, leaving it for the character by character conversion.
+    /// \return The position of the first unconverted character.
+    //***************************************************************************
+    template <typename TChar, typename TAccumulatorType>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    const TChar* convert_eight_digit_blocks(const TChar*                 itr,
+                                            const TChar*                 itr_end,
+                                            const etl::radix::value_type radix,
+                                            const TAccumulatorType       maximum,
+                                            TAccumulatorType&            value)
+    {
+      const bool     is_decimal = (radix == etl::radix::decimal);
+      const uint64_t scale      = is_decimal ? 100000000ULL : 0x100000000ULL;
+
+      // Any value below this may be scaled and have a block added without overflow.
+      const uint64_t safe_limit = is_decimal ? (uint64_t(maximum) / 100000000ULL) : (uint64_t(maximum) >> 32U);
+
+      while ((itr_end - itr) >= 8)
+      {
+        const uint64_t word = load_eight_chars(itr);
+        uint32_t block = 0U;
+
+        const bool is_valid_block = is_decimal ? parse_eight_decimal_digits(word, block)
+                                               : parse_eight_hex_digits(word, block);
+
+        if (!is_valid_block || (uint64_t(value) > safe_limit))
+        {
+          break;
+        }
+
+        const uint64_t scaled = uint64_t(value) * scale;
+
+        // At the limit, the block must fit in what remains.
+        if ((uint64_t(value) == safe_limit) && (block > (uint64_t(maximum) - scaled)))
+        {
+          break;
+        }
+
+        value = static_cast<TAccumulatorType>(scaled + block);
+        itr += 8;
+      }
+
+      return itr;
+    }
+#endif
+
     //***************************************************************************
     // Define an unsigned accumulator type that is at least as large as TValue.
     //***************************************************************************
@@ -693,7 +1083,17 @@ namespace etl
       typename etl::basic_string_view<TChar>::const_iterator       itr     = view.begin();
       const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
 
-      integral_accumulator<TAccumulatorType> accumulator(radix, maximum);
+      TAccumulatorType initial_value = 0;
+
+#if ETL_USING_64BIT_TYPES
+      // Byte characters in decimal or hexadecimal are converted eight at a time.
+      if ((sizeof(TChar) == 1U) && ((radix == etl::radix::decimal) || (radix == etl::radix::hexadecimal)))
+      {
+        itr = convert_eight_digit_blocks(itr, itr_end, radix, maximum, initial_value);
+      }
+#endif
+
+      integral_accumulator<TAccumulatorType> accumulator(radix, maximum, initial_value);
 
       while ((itr != itr_end) && accumulator.add(convert(*itr)))
       {
@@ -899,6 +1299,12 @@ namespace etl
     {
       result = unexpected_type(to_arithmetic_status::Invalid_Format);
     }
+#if ETL_HAS_FAST_FLOAT_PARSE
+    else if (fast_float_conversion(view, result, etl::bool_constant<fast_float_format<TValue>::is_supported>()))
+    {
+      // Converted with the Eisel-Lemire algorithm.
+    }
+#endif
     else
     {
       floating_point_accumulator accumulator;
@@ -0,0 +1,245 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOP_K_INCLUDED
+#define ETL_TOP_K_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "static_assert.h"
+#include "vector.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Top K.
+  /// Keeps the VK largest values added, as ordered by TCompare.
+  /// The values are kept in a heap with the smallest of them at the top, so a
+  /// value that is not in the top VK costs one comparison.
+  //***************************************************************************
+  template <typename T, size_t VK, typename TCompare = etl::less<T> >
+  class top_k
+    : public etl::unary_function<T, void>
+  {
+  private:
+
+    //*********************************
+    /// Orders the heap with the smallest value at the top.
+    //*********************************
+    struct heap_compare
+    {
+      explicit heap_compare(TCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator ()(const T& lhs, const T& rhs) const
+      {
+        return compare(rhs, lhs);
+      }
+
+      TCompare compare;
+    };
+
+  public:
+
+    ETL_STATIC_ASSERT(VK > 0U, "Zero K");
+
+    typedef T                                           value_type;
+    typedef typename etl::vector<T, VK>::const_iterator const_iterator;
+
+    static ETL_CONSTANT size_t K = VK;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    explicit top_k(TCompare compare_ = TCompare())
+      : compare(compare_)
+      , counter(0U)
+    {
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    top_k(TIterator first, TIterator last, TCompare compare_ = TCompare())
+      : compare(compare_)
+      , counter(0U)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(const T& value)
+    {
+      ++counter;
+
+      if (!values.full())
+      {
+        values.push_back(value);
+        etl::push_heap(values.begin(), values.end(), compare);
+      }
+      else if (compare.compare(values.front(), value))
+      {
+        // Replace the smallest.
+        typedef typename etl::iterator_traits<typename etl::vector<T, VK>::iterator>::difference_type difference_t;
+
+        private_heap::adjust_heap(values.begin(), difference_t(0), difference_t(values.size()), T(value), compare);
+      }
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(const T& value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Gets the smallest value kept.
+    /// Once full, a value must be larger than this to be kept.
+    /// Undefined if empty.
+    //*********************************
+    const T& threshold() const
+    {
+      return values.front();
+    }
+
+    //*********************************
+    /// Copies the values kept to output, largest first.
+    ///\return An iterator to the end of the output.
+    //*********************************
+    template <typename TIterator>
+    TIterator get_sorted(TIterator output) const
+    {
+      TIterator output_end = etl::copy(values.begin(), values.end(), output);
+
+      etl::sort_heap(output, output_end, compare);
+
+      return output_end;
+    }
+
+    //*********************************
+    /// Iterators over the values kept, in no particular order.
+    //*********************************
+    const_iterator begin() const
+    {
+      return values.begin();
+    }
+
+    const_iterator end() const
+    {
+      return values.end();
+    }
+
+    //*********************************
+    /// The number of values kept.
+    //*********************************
+    size_t size() const
+    {
+      return values.size();
+    }
+
+    //*********************************
+    /// Are no values kept?
+    //*********************************
+    bool empty() const
+    {
+      return values.empty();
+    }
+
+    //*********************************
+    /// Are VK values kept?
+    //*********************************
+    bool full() const
+    {
+      return values.full();
+    }
+
+    //*********************************
+    /// Get the total number of values added.
+    //*********************************
+    size_t count() const
+    {
+      return counter;
+    }
+
+    //*********************************
+    /// Clear the values.
+    //*********************************
+    void clear()
+    {
+      values.clear();
+      counter = 0U;
+    }
+
+  private:
+
+    etl::vector<T, VK> values;
+    heap_compare       compare;
+    size_t             counter;
+  };
+
+  template <typename T, size_t VK, typename TCompare>
+  ETL_CONSTANT size_t top_k<T, VK, TCompare>::K;
+}
+
+#endif
@@ -0,0 +1,496 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRACE_INCLUDED
+#define ETL_TRACE_INCLUDED
+
+#include "platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup trace trace
+/// Hot path tracing hooks.
+/// Define ETL_TRACE_HOOKS to record events from the queues, pools, message
+/// routers, message bus, callback timers and FSMs into the etl::itrace_buffer
+/// set with etl::set_trace_buffer.
+/// Without ETL_TRACE_HOOKS the hooks expand to nothing.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The events recorded by the tracing hooks.
+  /// Application events may use values from 'user' upwards.
+  ///\ingroup trace
+  //***************************************************************************
+  struct trace_event
+  {
+    enum enum_type
+    {
+      queue_push,      ///< Argument is the number of items pushed.
+      queue_pop,       ///< Argument is the number of items popped.
+      pool_allocate,   ///< Argument is the number of items allocated.
+      pool_release,    ///< Argument is the number of items released.
+      message_receive, ///< Argument is the message id.
+      timer_expired,   ///< Argument is the timer id.
+      fsm_transition,  ///< Argument is the new state id.
+      user = 0x100
+    };
+  };
+}
+
+#if defined(ETL_TRACE_HOOKS) && ETL_HAS_ATOMIC
+
+#include "atomic.h"
+#include "cycle_counter.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+/// Records an event in the current trace buffer.
+/// The argument may be an integral or a pointer.
+//*****************************************************************************
+#define ETL_TRACE(event, object, argument) etl::trace(static_cast<uint16_t>(event), static_cast<const void*>(object), (uintptr_t)(argument))
+
+//*****************************************************************************
+/// The timestamp for each event.
+/// Defaults to ETL_CYCLE_COUNTER().
+/// Define ETL_TRACE_TIMESTAMP() to provide another 32 bit source.
+//*****************************************************************************
+#if !defined(ETL_TRACE_TIMESTAMP)
+  #define ETL_TRACE_TIMESTAMP() ETL_CYCLE_COUNTER()
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// A recorded event.
+  ///\ingroup trace
+  //***************************************************************************
+  struct trace_record
+  {
+    uint32_t    timestamp;
+    uint16_t    event;
+    const void* object;
+    uintptr_t   argument;
+  };
+
+  //***************************************************************************
+  /// The interface to a lock free trace ring buffer.
+  /// Any number of contexts may record at once. When full, the oldest records
+  /// are overwritten.
+  ///\ingroup trace
+  //***************************************************************************
+  class itrace_buffer
+  {
+  public:
+
+    //*************************************************************************
+    /// Records an event.
+    //*************************************************************************
+    void record(uint16_t event, const void* object, uintptr_t argument)
+    {
+      if (!enabled.load(etl::memory_order_relaxed))
+      {
+        return;
+      }
+
+      const uint32_t index = next.fetch_add(1U, etl::memory_order_relaxed);
+      slot_t&        slot  = p_slots[index & mask];
+
+      // Marks the slot as being written.
+      slot.sequence.store(0U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+
+      slot.timestamp.store(ETL_TRACE_TIMESTAMP(), etl::memory_order_relaxed);
+      slot.event.store(event, etl::memory_order_relaxed);
+      slot.object.store(object, etl::memory_order_relaxed);
+      slot.argument.store(argument, etl::memory_order_relaxed);
+
+      slot.sequence.store(index + 1U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Gets the record 'n' places after the oldest retained record.
+    /// Returns <b>false</b> if it has been overwritten or is being written.
+    //*************************************************************************
+    bool get(size_t n, etl::trace_record& record) const
+    {
+      const uint32_t index = first() + static_cast<uint32_t>(n);
+      const slot_t&  slot  = p_slots[index & mask];
+
+      if (slot.sequence.load(etl::memory_order_acquire) != (index + 1U))
+      {
+        return false;
+      }
+
+      record.timestamp = slot.timestamp.load(etl::memory_order_relaxed);
+      record.event     = slot.event.load(etl::memory_order_relaxed);
+      record.object    = slot.object.load(etl::memory_order_relaxed);
+      record.argument  = slot.argument.load(etl::memory_order_relaxed);
+
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      return (slot.sequence.load(etl::memory_order_relaxed) == (index + 1U));
+    }
+
+    //*************************************************************************
+    /// The number of retained records.
+    //*************************************************************************
+    size_t size() const
+    {
+      const uint32_t total = next.load(etl::memory_order_acquire);
+
+      return (total < capacity()) ? total : capacity();
+    }
+
+    //*************************************************************************
+    /// The number of records that the buffer can hold.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return mask + 1U;
+    }
+
+    //*************************************************************************
+    /// The number of events recorded since the last clear.
+    //*************************************************************************
+    uint32_t total() const
+    {
+      return next.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Discards all records.
+    /// Do not call while events are being recorded.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < capacity(); ++i)
+      {
+        p_slots[i].sequence.store(0U, etl::memory_order_relaxed);
+      }
+
+      next.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Starts recording.
+    //*************************************************************************
+    void enable()
+    {
+      enabled.store(true, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Stops recording, for example while the buffer is exported.
+    //*************************************************************************
+    void disable()
+    {
+      enabled.store(false, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Is recording enabled?
+    //*************************************************************************
+    bool is_enabled() const
+    {
+      return enabled.load(etl::memory_order_relaxed);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// One record, held as atomics so that reading while recording is safe.
+    //*************************************************************************
+    struct slot_t
+    {
+      etl::atomic<uint32_t>    sequence;
+      etl::atomic<uint32_t>    timestamp;
+      etl::atomic<uint16_t>    event;
+      etl::atomic<const void*> object;
+      etl::atomic<uintptr_t>   argument;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    itrace_buffer(slot_t* p_slots_, size_t capacity_)
+      : p_slots(p_slots_)
+      , mask(static_cast<uint32_t>(capacity_ - 1U))
+      , next(0U)
+      , enabled(true)
+    {
+      clear();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The index of the oldest retained record.
+    //*************************************************************************
+    uint32_t first() const
+    {
+      const uint32_t total = next.load(etl::memory_order_acquire);
+
+      return (total < capacity()) ? 0U : total - static_cast<uint32_t>(capacity());
+    }
+
+    itrace_buffer(const itrace_buffer&) ETL_DELETE;
+    itrace_buffer& operator =(const itrace_buffer&) ETL_DELETE;
+
+    slot_t* const         p_slots;
+    const uint32_t        mask;
+    etl::atomic<uint32_t> next;
+    etl::atomic<bool>     enabled;
+  };
+
+  //***************************************************************************
+  /// A trace ring buffer holding VCapacity records.
+  ///\tparam VCapacity The number of records. Must be a power of 2.
+  ///\ingroup trace
+  //***************************************************************************
+  template <size_t VCapacity>
+  class trace_buffer : public etl::itrace_buffer
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VCapacity != 0U) && ((VCapacity & (VCapacity - 1U)) == 0U), "Capacity must be a power of 2");
+
+    static ETL_CONSTANT size_t Capacity = VCapacity;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    trace_buffer()
+      : itrace_buffer(slots, VCapacity)
+    {
+    }
+
+  private:
+
+    slot_t slots[VCapacity];
+  };
+
+  template <size_t VCapacity>
+  ETL_CONSTANT size_t trace_buffer<VCapacity>::Capacity;
+
+  namespace private_trace
+  {
+    //*************************************************************************
+    /// The trace buffer used by the hooks.
+    //*************************************************************************
+    inline etl::itrace_buffer*& buffer()
+    {
+      static etl::itrace_buffer* p_buffer = ETL_NULLPTR;
+
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Writes an unsigned value in decimal.
+    //*************************************************************************
+    template <typename TWriter>
+    void write_decimal(TWriter& writer, uint64_t value, int min_digits = 1)
+    {
+      char  text[21];
+      char* p = text + sizeof(text);
+
+      *--p = '\0';
+
+      do
+      {
+        *--p = static_cast<char>('0' + (value % 10U));
+        value /= 10U;
+        --min_digits;
+      } while ((value != 0U) || (min_digits > 0));
+
+      writer(static_cast<const char*>(p));
+    }
+
+    //*************************************************************************
+    /// Writes an unsigned value in hex.
+    //*************************************************************************
+    template <typename TWriter>
+    void write_hex(TWriter& writer, uintptr_t value)
+    {
+      char  text[(sizeof(uintptr_t) * 2U) + 3U];
+      char* p = text + sizeof(text);
+
+      *--p = '\0';
+
+      do
+      {
+        *--p = "0123456789abcdef"[value & 0x0FU];
+        value >>= 4U;
+      } while (value != 0U);
+
+      *--p = 'x';
+      *--p = '0';
+
+      writer(static_cast<const char*>(p));
+    }
+
+    //*************************************************************************
+    /// Writes the name of an event.
+    //*************************************************************************
+    template <typename TWriter>
+    void write_event_name(TWriter& writer, uint16_t event)
+    {
+      static const char* const names[] =
+      {
+        "queue_push",
+        "queue_pop",
+        "pool_allocate",
+        "pool_release",
+        "message_receive",
+        "timer_expired",
+        "fsm_transition"
+      };
+
+      if (event < (sizeof(names) / sizeof(names[0])))
+      {
+        writer(names[event]);
+      }
+      else
+      {
+        writer("event_");
+        write_decimal(writer, event);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sets the trace buffer used by the hooks.
+  /// Set before recording starts. ETL_NULLPTR stops recording.
+  ///\ingroup trace
+  //***************************************************************************
+  inline void set_trace_buffer(etl::itrace_buffer* p_buffer)
+  {
+    private_trace::buffer() = p_buffer;
+  }
+
+  //***************************************************************************
+  /// Gets the trace buffer used by the hooks.
+  ///\ingroup trace
+  //***************************************************************************
+  inline etl::itrace_buffer* get_trace_buffer()
+  {
+    return private_trace::buffer();
+  }
+
+  //***************************************************************************
+  /// Records an event in the trace buffer used by the hooks, if there is one.
+  ///\ingroup trace
+  //***************************************************************************
+  inline void trace(uint16_t event, const void* object, uintptr_t argument)
+  {
+    etl::itrace_buffer* p_buffer = private_trace::buffer();
+
+    if (p_buffer != ETL_NULLPTR)
+    {
+      p_buffer->record(event, object, argument);
+    }
+  }
+
+  //***************************************************************************
+  /// Writes the retained records in Chrome trace event JSON, which may be
+  /// loaded by Perfetto or chrome://tracing.
+  /// Each record is an instant event on a track per object.
+  /// Timestamps are unwrapped relative to the oldest record.
+  /// Disable the buffer while exporting for a complete trace.
+  ///\param writer                A functor called with each piece of text, as a const char*.
+  ///\param ticks_per_microsecond The timestamp rate.
+  ///\ingroup trace
+  //***************************************************************************
+  template <typename TWriter>
+  void write_chrome_trace(const etl::itrace_buffer& buffer, TWriter& writer, uint32_t ticks_per_microsecond = 1U)
+  {
+    if (ticks_per_microsecond == 0U)
+    {
+      ticks_per_microsecond = 1U;
+    }
+
+    writer("{\"traceEvents\":[");
+
+    const size_t size = buffer.size();
+
+    bool     first_event    = true;
+    uint32_t last_timestamp = 0U;
+    uint64_t ticks          = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      etl::trace_record record;
+
+      if (!buffer.get(i, record))
+      {
+        continue;
+      }
+
+      if (first_event)
+      {
+        last_timestamp = record.timestamp;
+      }
+      else
+      {
+        writer(",");
+      }
+
+      // Modulo arithmetic unwraps the 32 bit timestamp.
+      ticks += static_cast<uint32_t>(record.timestamp - last_timestamp);
+      last_timestamp = record.timestamp;
+      first_event    = false;
+
+      writer("\n{\"name\":\"");
+      private_trace::write_event_name(writer, record.event);
+      writer("\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":");
+      private_trace::write_decimal(writer, reinterpret_cast<uintptr_t>(record.object));
+      writer(",\"ts\":");
+      private_trace::write_decimal(writer, ticks / ticks_per_microsecond);
+      writer(".");
+      private_trace::write_decimal(writer, ((ticks % ticks_per_microsecond) * 1000U) / ticks_per_microsecond, 3);
+      writer(",\"args\":{\"object\":\"");
+      private_trace::write_hex(writer, reinterpret_cast<uintptr_t>(record.object));
+      writer("\",\"argument\":");
+      private_trace::write_decimal(writer, record.argument);
+      writer("}}");
+    }
+
+    writer("\n]}\n");
+  }
+}
+
+#else
+  #define ETL_TRACE(event, object, argument)
+#endif
+
+#endif
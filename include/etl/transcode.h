@@ -0,0 +1,441 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRANSCODE_INCLUDED
+#define ETL_TRANSCODE_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "static_assert.h"
+#include "private/transcode_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup transcode transcode
+/// Conversion between UTF-8, UTF-16 and UTF-32, with validation.
+/// The encoding is set by the size of the character type, so char and
+/// char8_t are UTF-8, char16_t is UTF-16, char32_t is UTF-32, and wchar_t
+/// is UTF-16 or UTF-32.
+/// Runs of ASCII are checked and copied 16 bytes at a time.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// The status of a transcode.
+  ///\ingroup transcode
+  //***************************************************************************
+  struct transcode_status
+  {
+    enum enum_type
+    {
+      Success,         ///< All of the source was transcoded.
+      Invalid,         ///< The source has an invalid or incomplete sequence at 'read'.
+      Destination_Full ///< The destination is full. The source is transcoded up to 'read'.
+    };
+  };
+
+  //***************************************************************************
+  /// The result of a transcode.
+  ///\ingroup transcode
+  //***************************************************************************
+  struct transcode_result
+  {
+    transcode_result()
+      : status(etl::transcode_status::Success)
+      , read(0U)
+      , written(0U)
+    {
+    }
+
+    bool success() const
+    {
+      return status == etl::transcode_status::Success;
+    }
+
+    etl::transcode_status::enum_type status;
+    size_t                           read;    ///< The number of source units transcoded.
+    size_t                           written; ///< The number of destination units, or needed units for transcode_length.
+  };
+
+  namespace private_transcode
+  {
+    //*************************************************************************
+    /// Decodes a code point, as UTF-8, UTF-16 or UTF-32 by unit size.
+    /// Returns the number of units, or 0 if the sequence is invalid.
+    //*************************************************************************
+    template <size_t Size>
+    struct decoder;
+
+    template <>
+    struct decoder<1U>
+    {
+      template <typename T>
+      static size_t decode(const T* p, size_t length, uint32_t& code_point)
+      {
+        const uint32_t b0 = uint8_t(p[0]);
+
+        if (b0 < 0x80U)
+        {
+          code_point = b0;
+          return 1U;
+        }
+
+        size_t   units   = 0U;
+        uint32_t minimum = 0U;
+
+        if ((b0 & 0xE0U) == 0xC0U)
+        {
+          units      = 2U;
+          minimum    = 0x80U;
+          code_point = b0 & 0x1FU;
+        }
+        else if ((b0 & 0xF0U) == 0xE0U)
+        {
+          units      = 3U;
+          minimum    = 0x800U;
+          code_point = b0 & 0x0FU;
+        }
+        else if ((b0 & 0xF8U) == 0xF0U)
+        {
+          units      = 4U;
+          minimum    = 0x10000U;
+          code_point = b0 & 0x07U;
+        }
+        else
+        {
+          return 0U;
+        }
+
+        if (length < units)
+        {
+          return 0U;
+        }
+
+        for (size_t i = 1U; i < units; ++i)
+        {
+          const uint32_t b = uint8_t(p[i]);
+
+          if ((b & 0xC0U) != 0x80U)
+          {
+            return 0U;
+          }
+
+          code_point = (code_point << 6U) | (b & 0x3FU);
+        }
+
+        // Overlong, a surrogate or out of range.
+        if ((code_point < minimum) || ((code_point >= 0xD800U) && (code_point <= 0xDFFFU)) || (code_point > 0x10FFFFU))
+        {
+          return 0U;
+        }
+
+        return units;
+      }
+    };
+
+    template <>
+    struct decoder<2U>
+    {
+      template <typename T>
+      static size_t decode(const T* p, size_t length, uint32_t& code_point)
+      {
+        const uint32_t u0 = uint16_t(p[0]);
+
+        if ((u0 < 0xD800U) || (u0 > 0xDFFFU))
+        {
+          code_point = u0;
+          return 1U;
+        }
+
+        // A high surrogate, then a low surrogate.
+        if ((u0 > 0xDBFFU) || (length < 2U))
+        {
+          return 0U;
+        }
+
+        const uint32_t u1 = uint16_t(p[1]);
+
+        if ((u1 < 0xDC00U) || (u1 > 0xDFFFU))
+        {
+          return 0U;
+        }
+
+        code_point = 0x10000U + ((u0 - 0xD800U) << 10U) + (u1 - 0xDC00U);
+
+        return 2U;
+      }
+    };
+
+    template <>
+    struct decoder<4U>
+    {
+      template <typename T>
+      static size_t decode(const T* p, size_t, uint32_t& code_point)
+      {
+        code_point = uint32_t(p[0]);
+
+        return (((code_point >= 0xD800U) && (code_point <= 0xDFFFU)) || (code_point > 0x10FFFFU)) ? 0U : 1U;
+      }
+    };
+
+    //*************************************************************************
+    /// Encodes a valid code point, as UTF-8, UTF-16 or UTF-32 by unit size.
+    /// Returns the number of units.
+    //*************************************************************************
+    template <size_t Size>
+    struct encoder;
+
+    template <>
+    struct encoder<1U>
+    {
+      static size_t length(uint32_t code_point)
+      {
+        return (code_point < 0x80U) ? 1U : (code_point < 0x800U) ? 2U : (code_point < 0x10000U) ? 3U : 4U;
+      }
+
+      template <typename T>
+      static void encode(uint32_t code_point, T* p, size_t units)
+      {
+        if (units == 1U)
+        {
+          p[0] = T(code_point);
+        }
+        else
+        {
+          // The lead byte has 'units' high bits set.
+          p[0] = T(uint8_t((0xF00U >> units) | (code_point >> (6U * (units - 1U)))));
+
+          for (size_t i = 1U; i < units; ++i)
+          {
+            p[i] = T(uint8_t(0x80U | ((code_point >> (6U * (units - 1U - i))) & 0x3FU)));
+          }
+        }
+      }
+    };
+
+    template <>
+    struct encoder<2U>
+    {
+      static size_t length(uint32_t code_point)
+      {
+        return (code_point < 0x10000U) ? 1U : 2U;
+      }
+
+      template <typename T>
+      static void encode(uint32_t code_point, T* p, size_t units)
+      {
+        if (units == 1U)
+        {
+          p[0] = T(code_point);
+        }
+        else
+        {
+          code_point -= 0x10000U;
+          p[0] = T(0xD800U + (code_point >> 10U));
+          p[1] = T(0xDC00U + (code_point & 0x3FFU));
+        }
+      }
+    };
+
+    template <>
+    struct encoder<4U>
+    {
+      static size_t length(uint32_t)
+      {
+        return 1U;
+      }
+
+      template <typename T>
+      static void encode(uint32_t code_point, T* p, size_t)
+      {
+        p[0] = T(code_point);
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Transcodes 'source_length' units from 'source' to at most
+  /// 'destination_length' units at 'destination'.
+  /// Stops at the first invalid sequence, or before the first code point
+  /// that does not fit.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TSource, typename TDestination>
+  etl::transcode_result transcode(const TSource* source, size_t source_length, TDestination* destination, size_t destination_length)
+  {
+    typedef private_transcode::decoder<sizeof(TSource)>      decoder_type;
+    typedef private_transcode::encoder<sizeof(TDestination)> encoder_type;
+
+    etl::transcode_result result;
+
+    size_t& i = result.read;
+    size_t& o = result.written;
+
+    while (i < source_length)
+    {
+      // A run of ASCII is copied without decoding.
+      if (uint32_t(source[i]) < 0x80U)
+      {
+        const size_t ascii = private_transcode::ascii_prefix(source + i, etl::min(source_length - i, destination_length - o));
+
+        for (size_t k = 0U; k < ascii; ++k)
+        {
+          destination[o + k] = TDestination(source[i + k]);
+        }
+
+        i += ascii;
+        o += ascii;
+
+        if (i == source_length)
+        {
+          break;
+        }
+      }
+
+      uint32_t code_point = 0U;
+
+      const size_t read = decoder_type::decode(source + i, source_length - i, code_point);
+
+      if (read == 0U)
+      {
+        result.status = etl::transcode_status::Invalid;
+        break;
+      }
+
+      const size_t written = encoder_type::length(code_point);
+
+      if ((destination_length - o) < written)
+      {
+        result.status = etl::transcode_status::Destination_Full;
+        break;
+      }
+
+      encoder_type::encode(code_point, destination + o, written);
+
+      i += read;
+      o += written;
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Transcodes a string view to a string, replacing its contents.
+  /// If the result is not success, the string holds the part that was
+  /// transcoded.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TSource, typename TTraits, typename TDestination>
+  etl::transcode_result transcode(etl::basic_string_view<TSource, TTraits> source, etl::ibasic_string<TDestination>& destination)
+  {
+    destination.uninitialized_resize(destination.max_size());
+
+    const etl::transcode_result result = etl::transcode(source.data(), source.size(), destination.data(), destination.max_size());
+
+    destination.uninitialized_resize(result.written);
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Transcodes a string to a string, replacing its contents.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TSource, typename TDestination>
+  etl::transcode_result transcode(const etl::ibasic_string<TSource>& source, etl::ibasic_string<TDestination>& destination)
+  {
+    return etl::transcode(etl::basic_string_view<TSource>(source.data(), source.size()), destination);
+  }
+
+  //***************************************************************************
+  /// The number of TDestination units needed to transcode 'source_length'
+  /// units from 'source', in 'written'.
+  /// If the source is invalid, 'read' is the position of the invalid sequence.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TDestination, typename TSource>
+  etl::transcode_result transcode_length(const TSource* source, size_t source_length)
+  {
+    typedef private_transcode::decoder<sizeof(TSource)>      decoder_type;
+    typedef private_transcode::encoder<sizeof(TDestination)> encoder_type;
+
+    etl::transcode_result result;
+
+    size_t& i = result.read;
+    size_t& o = result.written;
+
+    while (i < source_length)
+    {
+      if (uint32_t(source[i]) < 0x80U)
+      {
+        const size_t ascii = private_transcode::ascii_prefix(source + i, source_length - i);
+
+        i += ascii;
+        o += ascii;
+
+        if (i == source_length)
+        {
+          break;
+        }
+      }
+
+      uint32_t code_point = 0U;
+
+      const size_t read = decoder_type::decode(source + i, source_length - i, code_point);
+
+      if (read == 0U)
+      {
+        result.status = etl::transcode_status::Invalid;
+        break;
+      }
+
+      i += read;
+      o += encoder_type::length(code_point);
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// The number of TDestination units needed to transcode a string view.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TDestination, typename TSource, typename TTraits>
+  etl::transcode_result transcode_length(etl::basic_string_view<TSource, TTraits> source)
+  {
+    return etl::transcode_length<TDestination>(source.data(), source.size());
+  }
+}
+
+#endif
@@ -2168,6 +2168,33 @@ typedef integral_constant<bool, true>  true_type;
 
 #endif
 
+  //***************************************************************************
+  /// is_trivially_relocatable
+  /// True if moving an object to a new address and destroying the original
+  /// may be done by copying its bytes. Containers may then shift elements
+  /// with memmove.
+  /// True for trivially copyable types. Specialise for other types that are,
+  /// such as those that own a resource through a pointer.
+  /// Types that hold pointers to themselves, or that register their address
+  /// elsewhere, are not trivially relocatable.
+  //***************************************************************************
+#if defined(ETL_USER_DEFINED_TYPE_TRAITS) && !defined(ETL_USE_TYPE_TRAITS_BUILTINS)
+  template <typename T>
+  struct is_trivially_relocatable : public etl::integral_constant<bool, etl::is_arithmetic<T>::value || etl::is_pointer<T>::value>
+  {
+  };
+#else
+  template <typename T>
+  struct is_trivially_relocatable : public etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>
+  {
+  };
+#endif
+
+#if ETL_USING_CPP17
+  template <typename T>
+  inline constexpr bool is_trivially_relocatable_v = etl::is_trivially_relocatable<T>::value;
+#endif
+
 #if ETL_USING_CPP11
   //*********************************************
   // common_type
@@ -39,10 +39,12 @@ SOFTWARE.
 #include "to_u16string.h"
 #include "string_view.h"
 #include "basic_string_stream.h"
+#include "basic_string_sink_stream.h"
 
 namespace etl
 {
   typedef etl::basic_string_stream<etl::u16format_spec, etl::iu16string, etl::u16string_view> u16string_stream;
+  typedef etl::basic_string_sink_stream<etl::u16format_spec, etl::iu16string, etl::u16string_view> u16string_sink_stream;
 }
 
 #endif
@@ -39,10 +39,12 @@ SOFTWARE.
 #include "to_u32string.h"
 #include "string_view.h"
 #include "basic_string_stream.h"
+#include "basic_string_sink_stream.h"
 
 namespace etl
 {
   typedef etl::basic_string_stream<etl::u32format_spec, etl::iu32string, etl::u32string_view> u32string_stream;
+  typedef etl::basic_string_sink_stream<etl::u32format_spec, etl::iu32string, etl::u32string_view> u32string_sink_stream;
 }
 
 #endif
@@ -39,10 +39,12 @@ SOFTWARE.
 #include "to_u8string.h"
 #include "string_view.h"
 #include "basic_string_stream.h"
+#include "basic_string_sink_stream.h"
 
 namespace etl
 {
   typedef etl::basic_string_stream<etl::u8format_spec, etl::iu8string, etl::u8string_view> u8string_stream;
+  typedef etl::basic_string_sink_stream<etl::u8format_spec, etl::iu8string, etl::u8string_view> u8string_sink_stream;
 }
 
 #endif
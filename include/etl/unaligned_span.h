@@ -0,0 +1,339 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNALIGNED_SPAN_INCLUDED
+#define ETL_UNALIGNED_SPAN_INCLUDED
+
+#include "platform.h"
+#include "unaligned_type.h"
+#include "endianness.h"
+#include "iterator.h"
+#include "span.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <string.h>
+
+///\defgroup unaligned_span unaligned_span
+/// A view of a byte buffer as an array of unaligned values with a set
+/// endianness, such as a packed array in a protocol frame.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Views a byte buffer as an array of etl::unaligned_type<T, Endian>.
+  /// Elements are read and written through etl::unaligned_type references,
+  /// so an iterator is a pointer and is random access.
+  /// Use 'const T' for a read only view.
+  /// copy_to and copy_from convert the whole array at once, with memcpy and,
+  /// for integral types of the other endianness, etl::byteswap_in_place.
+  ///\tparam T      The arithmetic type. May be const.
+  ///\tparam Endian The endianness of the values in the buffer.
+  ///\ingroup unaligned_span
+  //***************************************************************************
+  template <typename T, int Endian_>
+  class unaligned_span
+  {
+  public:
+
+    typedef typename etl::remove_cv<T>::type value_type;
+
+    typedef typename etl::conditional<etl::is_const<T>::value,
+                                      const etl::unaligned_type<value_type, Endian_>,
+                                      etl::unaligned_type<value_type, Endian_> >::type element_type;
+
+    typedef typename etl::conditional<etl::is_const<T>::value, const unsigned char, unsigned char>::type byte_type;
+
+    typedef size_t                                 size_type;
+    typedef element_type&                          reference;
+    typedef const element_type&                    const_reference;
+    typedef element_type*                          pointer;
+    typedef const element_type*                    const_pointer;
+    typedef element_type*                          iterator;
+    typedef const element_type*                    const_iterator;
+    typedef etl::reverse_iterator<iterator>        reverse_iterator;
+
+    static ETL_CONSTANT int Endian = Endian_;
+
+    // The elements are laid out back to back, with no padding.
+    ETL_STATIC_ASSERT(sizeof(element_type) == sizeof(value_type), "Unaligned type has padding");
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    ETL_CONSTEXPR unaligned_span()
+      : p_buffer(ETL_NULLPTR)
+      , length(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a buffer and a number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR unaligned_span(byte_type* p_buffer_, size_t length_)
+      : p_buffer(p_buffer_)
+      , length(length_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a byte array, with as many whole elements as fit.
+    //*************************************************************************
+    template <size_t VBytes>
+    ETL_CONSTEXPR explicit unaligned_span(byte_type (&buffer)[VBytes])
+      : p_buffer(buffer)
+      , length(VBytes / sizeof(value_type))
+    {
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the span.
+    //*************************************************************************
+    iterator begin() const
+    {
+      return reinterpret_cast<iterator>(p_buffer);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the span.
+    //*************************************************************************
+    iterator end() const
+    {
+      return begin() + length;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the span.
+    //*************************************************************************
+    reverse_iterator rbegin() const
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse end of the span.
+    //*************************************************************************
+    reverse_iterator rend() const
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the indexed element.
+    //*************************************************************************
+    reference operator [](size_t index) const
+    {
+      return begin()[index];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the first element.
+    //*************************************************************************
+    reference front() const
+    {
+      return *begin();
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the last element.
+    //*************************************************************************
+    reference back() const
+    {
+      return *(end() - 1);
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the buffer.
+    //*************************************************************************
+    ETL_CONSTEXPR byte_type* data() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return length;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size_bytes() const
+    {
+      return length * sizeof(value_type);
+    }
+
+    //*************************************************************************
+    /// Returns true if the span has no elements.
+    //*************************************************************************
+    ETL_CONSTEXPR bool empty() const
+    {
+      return length == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns a span of 'count' elements from 'offset'.
+    //*************************************************************************
+    unaligned_span subspan(size_t offset, size_t count) const
+    {
+      return unaligned_span(p_buffer + (offset * sizeof(value_type)), count);
+    }
+
+    //*************************************************************************
+    /// Copies the values to an array, converted to the host endianness.
+    /// Copies at most 'count' values.
+    /// Returns the number of values copied.
+    //*************************************************************************
+    size_t copy_to(value_type* p_destination, size_t count) const
+    {
+      const size_t n = (count < length) ? count : length;
+
+      memcpy(p_destination, p_buffer, n * sizeof(value_type));
+
+      if (Endian != etl::endianness::value())
+      {
+        reverse_each(p_destination, n, typename etl::integral_constant<bool, etl::is_integral<value_type>::value>());
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Copies the values to a span, converted to the host endianness.
+    /// Copies at most destination.size() values.
+    /// Returns the number of values copied.
+    //*************************************************************************
+    template <size_t VExtent>
+    size_t copy_to(etl::span<value_type, VExtent> destination) const
+    {
+      return copy_to(destination.data(), destination.size());
+    }
+
+    //*************************************************************************
+    /// Copies values from an array, converted from the host endianness.
+    /// Copies at most size() values.
+    /// Returns the number of values copied.
+    //*************************************************************************
+    size_t copy_from(const value_type* p_source, size_t count) const
+    {
+      ETL_STATIC_ASSERT(!etl::is_const<T>::value, "Read only view");
+
+      const size_t n = (count < length) ? count : length;
+
+      if (Endian != etl::endianness::value())
+      {
+        copy_reversed(p_source, n, typename etl::integral_constant<bool, etl::is_integral<value_type>::value>());
+      }
+      else
+      {
+        memcpy(p_buffer, p_source, n * sizeof(value_type));
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Copies values from a span, converted from the host endianness.
+    /// Copies at most size() values.
+    /// Returns the number of values copied.
+    //*************************************************************************
+    template <size_t VExtent>
+    size_t copy_from(etl::span<const value_type, VExtent> source) const
+    {
+      return copy_from(source.data(), source.size());
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Reverses the bytes of integral values in place, in bulk.
+    //*************************************************************************
+    static void reverse_each(value_type* p, size_t n, etl::true_type)
+    {
+      etl::byteswap_in_place(p, p + n);
+    }
+
+    //*************************************************************************
+    /// Reverses the bytes of floating point values in place.
+    //*************************************************************************
+    static void reverse_each(value_type* p, size_t n, etl::false_type)
+    {
+      unsigned char* p_bytes = reinterpret_cast<unsigned char*>(p);
+
+      for (size_t i = 0U; i < n; ++i, p_bytes += sizeof(value_type))
+      {
+        etl::reverse(p_bytes, p_bytes + sizeof(value_type));
+      }
+    }
+
+    //*************************************************************************
+    /// Copies integral values to the buffer, reversing the bytes, in bulk.
+    //*************************************************************************
+    void copy_reversed(const value_type* p_source, size_t n, etl::true_type) const
+    {
+      // Swapped into an aligned block on the stack, then copied out.
+      const size_t Block = 64U / sizeof(value_type);
+
+      value_type block[Block];
+
+      for (size_t i = 0U; i < n; i += Block)
+      {
+        const size_t count = ((n - i) < Block) ? (n - i) : Block;
+
+        etl::byteswap_copy(p_source + i, p_source + i + count, block);
+        memcpy(p_buffer + (i * sizeof(value_type)), block, count * sizeof(value_type));
+      }
+    }
+
+    //*************************************************************************
+    /// Copies floating point values to the buffer, reversing the bytes.
+    //*************************************************************************
+    void copy_reversed(const value_type* p_source, size_t n, etl::false_type) const
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        begin()[i] = p_source[i];
+      }
+    }
+
+    byte_type* p_buffer;
+    size_t     length;
+  };
+
+  template <typename T, int Endian_>
+  ETL_CONSTANT int unaligned_span<T, Endian_>::Endian;
+}
+
+#endif
@@ -51,6 +51,9 @@ SOFTWARE.
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "span.h"
+#include "private/comparator_is_transparent.h"
+#include "private/unordered_bucket.h"
 
 #include <stddef.h>
 
@@ -162,6 +165,9 @@ namespace etl
       }
 
       value_type key_value_pair;
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      size_t     hash_value;
+#endif
     };
 
     friend bool operator ==(const node_t& lhs, const node_t& rhs)
@@ -596,7 +602,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(const_key_reference key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return bucket_index(key_hash_function(key));
     }
 
     //*********************************************************************
@@ -605,7 +611,7 @@ namespace etl
     //*********************************************************************
     size_type bucket_size(const_key_reference key) const
     {
-      size_t index = bucket(key);
+      size_t index = get_bucket_index(key);
 
       return etl::distance(pbuckets[index].begin(), pbuckets[index].end());
     }
@@ -637,7 +643,8 @@ namespace etl
     mapped_reference operator [](rvalue_key_reference key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash    = key_hash_function(key);
+      bucket_t*    pbucket = pbuckets + bucket_index(hash);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -646,7 +653,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_has_key(*inode, hash, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -661,6 +668,7 @@ namespace etl
       // Get a new node.
       node_t* node = allocate_data_node();
       node->clear();
+      store_hash(*node, hash);
       ::new ((void*)etl::addressof(node->key_value_pair.first))  key_type(etl::move(key));
       ::new ((void*)etl::addressof(node->key_value_pair.second)) mapped_type();
       ETL_INCREMENT_DEBUG_COUNT;
@@ -681,7 +689,8 @@ namespace etl
     mapped_reference operator [](const_key_reference key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash    = key_hash_function(key);
+      bucket_t*    pbucket = pbuckets + bucket_index(hash);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -690,7 +699,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_has_key(*inode, hash, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -705,6 +714,7 @@ namespace etl
       // Get a new node.
       node_t* node = allocate_data_node();
       node->clear();
+      store_hash(*node, hash);
       ::new ((void*)etl::addressof(node->key_value_pair.first))  key_type(key);
       ::new ((void*)etl::addressof(node->key_value_pair.second)) mapped_type();
       ETL_INCREMENT_DEBUG_COUNT;
@@ -725,7 +735,8 @@ namespace etl
     mapped_reference at(const_key_reference key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash    = key_hash_function(key);
+      bucket_t*    pbucket = pbuckets + bucket_index(hash);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -734,7 +745,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_has_key(*inode, hash, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -760,7 +771,8 @@ namespace etl
     const_mapped_reference at(const_key_reference key) const
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t hash    = key_hash_function(key);
+      bucket_t*    pbucket = pbuckets + bucket_index(hash);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -769,7 +781,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (node_has_key(*inode, hash, key))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -825,7 +837,8 @@ namespace etl
       const key_type&    key = key_value_pair.first;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -837,6 +850,7 @@ namespace etl
         // Get a new node.
         node_t* node = allocate_data_node();
         node->clear();
+        store_hash(*node, hash);
         ::new ((void*)etl::addressof(node->key_value_pair)) value_type(key_value_pair);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -857,7 +871,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key_value_pair.first, key))
+          if (node_has_key(*inode, hash, key))
           {
             break;
           }
@@ -872,6 +886,7 @@ namespace etl
           // Get a new node.
           node_t* node = allocate_data_node();
           node->clear();
+          store_hash(*node, hash);
           ::new ((void*)etl::addressof(node->key_value_pair)) value_type(key_value_pair);
           ETL_INCREMENT_DEBUG_COUNT;
 
@@ -903,7 +918,8 @@ namespace etl
       const key_type&    key = key_value_pair.first;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -915,6 +931,7 @@ namespace etl
         // Get a new node.
         node_t* node = allocate_data_node();
         node->clear();
+        store_hash(*node, hash);
         ::new ((void*)etl::addressof(node->key_value_pair)) value_type(etl::move(key_value_pair));
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -935,7 +952,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key_value_pair.first, key))
+          if (node_has_key(*inode, hash, key))
           {
             break;
           }
@@ -950,6 +967,7 @@ namespace etl
           // Get a new node.
           node_t* node = allocate_data_node();
           node->clear();
+          store_hash(*node, hash);
           ::new ((void*)etl::addressof(node->key_value_pair)) value_type(etl::move(key_value_pair));
           ETL_INCREMENT_DEBUG_COUNT;
 
@@ -1015,30 +1033,24 @@ namespace etl
     //*********************************************************************
     size_t erase(const_key_reference key)
     {
-      size_t n = 0UL;
-      size_t index = get_bucket_index(key);
-
-      bucket_t& bucket = pbuckets[index];
-
-      local_iterator iprevious = bucket.before_begin();
-      local_iterator icurrent = bucket.begin();
-
-      // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (!key_equal_function(icurrent->key_value_pair.first, key)))
-      {
-        ++iprevious;
-        ++icurrent;
-      }
-
-      // Did we find it?
-      if (icurrent != bucket.end())
-      {
-        delete_data_node(iprevious, icurrent, bucket);
-        n = 1;
-      }
+      return erase_key(key);
+    }
 
-      return n;
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Erases an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual,
+              etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value &&
+                               !etl::is_convertible<K, iterator>::value && !etl::is_convertible<K, const_iterator>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      return erase_key(key);
     }
+#endif
 
     //*********************************************************************
     /// Erases an element.
@@ -1131,6 +1143,26 @@ namespace etl
       initialise();
     }
 
+    //*************************************************************************
+    /// Clears the unordered_map incrementally.
+    /// Erases up to 'budget' elements from the first occupied bucket onwards,
+    /// so that clearing a large unordered_map may be spread over several calls.
+    /// Empty buckets are skipped once in total, not once per call.
+    ///\param budget The maximum number of elements to erase.
+    ///\return <b>true</b> if the unordered_map is now empty.
+    //*************************************************************************
+    bool clear_some(size_t budget)
+    {
+      while ((budget != 0U) && !empty())
+      {
+        // The first marker always points at an occupied bucket.
+        delete_data_node(first->before_begin(), first->begin(), *first);
+        --budget;
+      }
+
+      return empty();
+    }
+
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
@@ -1141,6 +1173,20 @@ namespace etl
       return (find(key) == end()) ? 0 : 1;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Counts an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1148,32 +1194,22 @@ namespace etl
     //*********************************************************************
     iterator find(const_key_reference key)
     {
-      size_t index = get_bucket_index(key);
-
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // Is the bucket not empty?
-      if (!bucket.empty())
-      {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
-
-        while (inode != iend)
-        {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
-          {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
-          }
-
-          ++inode;
-        }
-      }
+      return find_node(key);
+    }
 
-      return end();
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return find_node(key);
     }
+#endif
 
     //*********************************************************************
     /// Finds an element.
@@ -1182,31 +1218,45 @@ namespace etl
     //*********************************************************************
     const_iterator find(const_key_reference key) const
     {
-      size_t index = get_bucket_index(key);
-
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // Is the bucket not empty?
-      if (!bucket.empty())
-      {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
+      return find_node(key);
+    }
 
-        while (inode != iend)
-        {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
-          {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
-          }
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return find_node(key);
+    }
+#endif
 
-          ++inode;
-        }
-      }
+    //*********************************************************************
+    /// Finds a batch of keys, such as those from a burst of packets.
+    /// All of the keys are hashed and their buckets prefetched before any are
+    /// compared, which hides much of the memory latency of a large table.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator for each key; end() if it does not exist.
+    ///\return The number of keys found.
+    //*********************************************************************
+    size_t find_batch(etl::span<const key_type> keys, etl::span<iterator> results)
+    {
+      return find_batch_nodes(keys, results);
+    }
 
-      return end();
+    //*********************************************************************
+    /// Finds a batch of keys, such as those from a burst of packets.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator for each key; end() if it does not exist.
+    ///\return The number of keys found.
+    //*********************************************************************
+    size_t find_batch(etl::span<const key_type> keys, etl::span<const_iterator> results) const
+    {
+      return find_batch_nodes(keys, results);
     }
 
     //*********************************************************************
@@ -1230,6 +1280,28 @@ namespace etl
       return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container,
+    /// using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1251,6 +1323,28 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container,
+    /// using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_map.
     //*************************************************************************
@@ -1300,6 +1394,16 @@ namespace etl
       return pnodepool->available();
     }
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Returns the usage statistics of the node pool.
+    //*************************************************************************
+    const etl::pool_statistics& get_pool_statistics() const
+    {
+      return pnodepool->get_statistics();
+    }
+#endif
+
     //*************************************************************************
     /// Returns the load factor = size / bucket_count.
     ///\return The load factor = size / bucket_count.
@@ -1434,6 +1538,167 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Gets the bucket index for the hash.
+    //*********************************************************************
+    size_t bucket_index(size_t hash) const
+    {
+      return private_unordered::bucket_index(hash, number_of_buckets);
+    }
+
+    //*********************************************************************
+    /// Checks whether the node holds the key.
+    /// If hashes are cached then the hashes are compared first.
+    //*********************************************************************
+    template <typename K>
+    bool node_has_key(const node_t& node, size_t hash, const K& key) const
+    {
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      return (node.hash_value == hash) && key_equal_function(key, node.key_value_pair.first);
+#else
+      (void)hash;
+      return key_equal_function(key, node.key_value_pair.first);
+#endif
+    }
+
+    //*********************************************************************
+    /// Stores the hash in the node, if hashes are cached.
+    //*********************************************************************
+    static void store_hash(node_t& node, size_t hash)
+    {
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      node.hash_value = hash;
+#else
+      (void)node;
+      (void)hash;
+#endif
+    }
+
+    //*********************************************************************
+    /// Finds the node for the key.
+    //*********************************************************************
+    template <typename K>
+    iterator find_node(const K& key) const
+    {
+      return find_node(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds the node for the key, with its hash already calculated.
+    //*********************************************************************
+    template <typename K>
+    iterator find_node(const K& key, size_t hash) const
+    {
+      bucket_t* pbucket = pbuckets + bucket_index(hash);
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_has_key(*inode, hash, key))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return iterator((pbuckets + number_of_buckets), last, last->end());
+    }
+
+    //*********************************************************************
+    /// Finds the nodes for a span of keys.
+    /// The keys are hashed and their buckets requested in batches, then the
+    /// first node of each bucket, so that the cache misses overlap rather
+    /// than being taken one key at a time.
+    //*********************************************************************
+    template <typename TIterator>
+    size_t find_batch_nodes(etl::span<const key_type> keys, etl::span<TIterator> results) const
+    {
+      ETL_ASSERT(results.size() >= keys.size(), ETL_ERROR(unordered_map_out_of_range));
+
+      const size_t n_keys = etl::min(keys.size(), results.size());
+      const const_iterator iend = end();
+
+      size_t    hashes[private_unordered::find_batch::Size];
+      bucket_t* buckets[private_unordered::find_batch::Size];
+      size_t    n_found = 0U;
+
+      for (size_t base = 0U; base < n_keys; base += private_unordered::find_batch::Size)
+      {
+        const size_t n = etl::min(size_t(private_unordered::find_batch::Size), n_keys - base);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          hashes[i]  = key_hash_function(keys[base + i]);
+          buckets[i] = pbuckets + bucket_index(hashes[i]);
+          private_unordered::prefetch(buckets[i]);
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          if (!buckets[i]->empty())
+          {
+            private_unordered::prefetch(&*buckets[i]->begin());
+          }
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const iterator itr = find_node(keys[base + i], hashes[i]);
+
+          results[base + i] = itr;
+
+          if (const_iterator(itr) != iend)
+          {
+            ++n_found;
+          }
+        }
+      }
+
+      return n_found;
+    }
+
+    //*********************************************************************
+    /// Erases the element with the key.
+    //*********************************************************************
+    template <typename K>
+    size_t erase_key(const K& key)
+    {
+      size_t n = 0UL;
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
+
+      bucket_t& bucket = pbuckets[index];
+
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent = bucket.begin();
+
+      // Search for the key, if we have it.
+      while ((icurrent != bucket.end()) && (!node_has_key(*icurrent, hash, key)))
+      {
+        ++iprevious;
+        ++icurrent;
+      }
+
+      // Did we find it?
+      if (icurrent != bucket.end())
+      {
+        delete_data_node(iprevious, icurrent, bucket);
+        n = 1;
+      }
+
+      return n;
+    }
+
     //*************************************************************************
     /// Create a node.
     //*************************************************************************
@@ -1637,13 +1902,13 @@ namespace etl
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = private_unordered::bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
     }
 
@@ -1651,7 +1916,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_map(const unordered_map& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
     {
       base::assign(other.cbegin(), other.cend());
     }
@@ -1661,7 +1926,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_map(unordered_map&& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
     {
       if (this != &other)
       {
@@ -1678,7 +1943,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
       base::assign(first_, last_);
     }
@@ -1688,7 +1953,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1728,7 +1993,7 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
   //*************************************************************************
@@ -50,6 +50,8 @@ SOFTWARE.
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "private/comparator_is_transparent.h"
+#include "private/unordered_bucket.h"
 
 #include <stddef.h>
 
@@ -153,6 +155,9 @@ namespace etl
       }
 
       value_type key;
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      size_t     hash_value;
+#endif
     };
 
     friend bool operator ==(const node_t& lhs, const node_t& rhs)
@@ -585,7 +590,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return bucket_index(key_hash_function(key));
     }
 
     //*********************************************************************
@@ -594,7 +599,7 @@ namespace etl
     //*********************************************************************
     size_type bucket_size(key_parameter_t key) const
     {
-      size_t index = bucket(key);
+      size_t index = get_bucket_index(key);
 
       return etl::distance(pbuckets[index].begin(), pbuckets[index].end());
     }
@@ -654,7 +659,8 @@ namespace etl
       ETL_ASSERT(!full(), ETL_ERROR(unordered_multiset_full));
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -666,6 +672,7 @@ namespace etl
         // Get a new node.
         node_t* node = allocate_data_node();
         node->clear();
+        store_hash(*node, hash);
         ::new (&node->key) value_type(key);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -685,7 +692,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (node_has_key(*inode, hash, key))
           {
             break;
           }
@@ -697,6 +704,7 @@ namespace etl
         // Get a new node.
         node_t* node = allocate_data_node();
         node->clear();
+        store_hash(*node, hash);
         ::new (&node->key) value_type(key);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -725,7 +733,8 @@ namespace etl
       ETL_ASSERT(!full(), ETL_ERROR(unordered_multiset_full));
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -737,6 +746,7 @@ namespace etl
         // Get a new node.
         node_t* node = allocate_data_node();
         node->clear();
+        store_hash(*node, hash);
         ::new (&node->key) value_type(etl::move(key));
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -756,7 +766,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (node_has_key(*inode, hash, key))
           {
             break;
           }
@@ -768,6 +778,7 @@ namespace etl
         // Get a new node.
         node_t* node = allocate_data_node();
         node->clear();
+        store_hash(*node, hash);
         ::new (&node->key) value_type(etl::move(key));
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -819,32 +830,24 @@ namespace etl
     //*********************************************************************
     size_t erase(key_parameter_t key)
     {
-      size_t n = 0UL;
-      size_t bucket_id = get_bucket_index(key);
-
-      bucket_t& bucket = pbuckets[bucket_id];
-
-      local_iterator iprevious = bucket.before_begin();
-      local_iterator icurrent = bucket.begin();
-
-      while (icurrent != bucket.end())
-      {
-        if (key_equal_function(icurrent->key, key))
-        {
-          delete_data_node(iprevious, icurrent, bucket);
-          ++n;
-          icurrent = iprevious;
-        }
-        else
-        {
-          ++iprevious;
-        }
-
-        ++icurrent;
-      }
+      return erase_key(key);
+    }
 
-      return n;
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Erases an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to erase.
+    ///\return The number of elements erased.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual,
+              etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value &&
+                               !etl::is_convertible<K, iterator>::value && !etl::is_convertible<K, const_iterator>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      return erase_key(key);
     }
+#endif
 
     //*********************************************************************
     /// Erases an element.
@@ -963,39 +966,59 @@ namespace etl
       return n;
     }
 
+#if ETL_USING_CPP11
     //*********************************************************************
-    /// Finds an element.
+    /// Counts an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
     ///\param key The key to search for.
-    ///\return An iterator to the element if the key exists, otherwise end().
+    ///\return 1 if the key exists, otherwise 0.
     //*********************************************************************
-    iterator find(key_parameter_t key)
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
     {
-      size_t index = get_bucket_index(key);
-
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
+      size_t n = 0UL;
+      const_iterator f = find(key);
+      const_iterator l = f;
 
-      // Is the bucket not empty?
-      if (!bucket.empty())
+      if (l != end())
       {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
+        ++l;
+        ++n;
 
-        while (inode != iend)
+        while ((l != end()) && key_equal_function(key, *l))
         {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key))
-          {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
-          }
-
-          ++inode;
+          ++l;
+          ++n;
         }
       }
 
-      return end();
+      return n;
     }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return find_node(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return find_node(key);
+    }
+#endif
 
     //*********************************************************************
     /// Finds an element.
@@ -1004,42 +1027,62 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      return find_node(key);
+    }
 
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return find_node(key);
+    }
+#endif
 
-      // Is the bucket not empty?
-      if (!bucket.empty())
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
       {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
+        ++l;
 
-        while (inode != iend)
+        while ((l != end()) && key_equal_function(key, *l))
         {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key))
-          {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
-          }
-
-          ++inode;
+          ++l;
         }
       }
 
-      return end();
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
     //*********************************************************************
-    /// Returns a range containing all elements with key key in the container.
+    /// Returns a range containing all elements with key key in the container,
+    /// using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
     /// The range is defined by two iterators, the first pointing to the first
     /// element of the wanted range and the second pointing past the last
     /// element of the range.
     ///\param key The key to search for.
     ///\return An iterator pair to the range of elements if the key exists, otherwise end().
     //*********************************************************************
-    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
     {
       iterator f = find(key);
       iterator l = f;
@@ -1056,6 +1099,7 @@ namespace etl
 
       return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
+#endif
 
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
@@ -1083,6 +1127,37 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container,
+    /// using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+
+        while ((l != end()) && key_equal_function(key, *l))
+        {
+          ++l;
+        }
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_multiset.
     //*************************************************************************
@@ -1266,6 +1341,110 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Gets the bucket index for the hash.
+    //*********************************************************************
+    size_t bucket_index(size_t hash) const
+    {
+      return private_unordered::bucket_index(hash, number_of_buckets);
+    }
+
+    //*********************************************************************
+    /// Checks whether the node holds the key.
+    /// If hashes are cached then the hashes are compared first.
+    //*********************************************************************
+    template <typename K>
+    bool node_has_key(const node_t& node, size_t hash, const K& key) const
+    {
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      return (node.hash_value == hash) && key_equal_function(key, node.key);
+#else
+      (void)hash;
+      return key_equal_function(key, node.key);
+#endif
+    }
+
+    //*********************************************************************
+    /// Stores the hash in the node, if hashes are cached.
+    //*********************************************************************
+    static void store_hash(node_t& node, size_t hash)
+    {
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      node.hash_value = hash;
+#else
+      (void)node;
+      (void)hash;
+#endif
+    }
+
+    //*********************************************************************
+    /// Finds the first node for the key.
+    //*********************************************************************
+    template <typename K>
+    iterator find_node(const K& key) const
+    {
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_has_key(*inode, hash, key))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return iterator((pbuckets + number_of_buckets), last, last->end());
+    }
+
+    //*********************************************************************
+    /// Erases the elements with the key.
+    //*********************************************************************
+    template <typename K>
+    size_t erase_key(const K& key)
+    {
+      size_t n = 0UL;
+      const size_t hash      = key_hash_function(key);
+      size_t       bucket_id = bucket_index(hash);
+
+      bucket_t& bucket = pbuckets[bucket_id];
+
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent = bucket.begin();
+
+      while (icurrent != bucket.end())
+      {
+        if (node_has_key(*icurrent, hash, key))
+        {
+          delete_data_node(iprevious, icurrent, bucket);
+          ++n;
+          icurrent = iprevious;
+        }
+        else
+        {
+          ++iprevious;
+        }
+
+        ++icurrent;
+      }
+
+      return n;
+    }
+
     //*************************************************************************
     /// Create a node.
     //*************************************************************************
@@ -1475,7 +1654,7 @@ namespace etl
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = private_unordered::bucket_count<MAX_BUCKETS_>::value;
 
 
     //*************************************************************************
@@ -1575,7 +1754,7 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
   //*************************************************************************
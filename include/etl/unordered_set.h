@@ -51,6 +51,9 @@ SOFTWARE.
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "span.h"
+#include "private/comparator_is_transparent.h"
+#include "private/unordered_bucket.h"
 
 #include <stddef.h>
 
@@ -154,6 +157,9 @@ namespace etl
       }
 
       value_type key;
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      size_t     hash_value;
+#endif
     };
 
     friend bool operator ==(const node_t& lhs, const node_t& rhs)
@@ -586,7 +592,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return bucket_index(key_hash_function(key));
     }
 
     //*********************************************************************
@@ -595,7 +601,7 @@ namespace etl
     //*********************************************************************
     size_type bucket_size(key_parameter_t key) const
     {
-      size_t index = bucket(key);
+      size_t index = get_bucket_index(key);
 
       return etl::distance(pbuckets[index].begin(), pbuckets[index].end());
     }
@@ -668,7 +674,8 @@ namespace etl
       }
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -680,6 +687,7 @@ namespace etl
         // Get a new node.
         node_t* node = allocate_data_node();
         node->clear();
+        store_hash(*node, hash);
         ::new (&node->key) value_type(key);
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -699,7 +707,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (node_has_key(*inode, hash, key))
           {
             break;
           }
@@ -714,6 +722,7 @@ namespace etl
           // Get a new node.
           node_t* node = allocate_data_node();
           node->clear();
+          store_hash(*node, hash);
           ::new (&node->key) value_type(key);
           ETL_INCREMENT_DEBUG_COUNT;
 
@@ -756,7 +765,8 @@ namespace etl
       }
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -768,6 +778,7 @@ namespace etl
         // Get a new node.
         node_t* node = allocate_data_node();
         node->clear();
+        store_hash(*node, hash);
         ::new (&node->key) value_type(etl::move(key));
         ETL_INCREMENT_DEBUG_COUNT;
 
@@ -787,7 +798,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (node_has_key(*inode, hash, key))
           {
             break;
           }
@@ -802,6 +813,7 @@ namespace etl
           // Get a new node.
           node_t* node = allocate_data_node();
           node->clear();
+          store_hash(*node, hash);
           ::new (&node->key) value_type(etl::move(key));
           ETL_INCREMENT_DEBUG_COUNT;
 
@@ -867,30 +879,24 @@ namespace etl
     //*********************************************************************
     size_t erase(key_parameter_t key)
     {
-      size_t n = 0UL;
-      size_t index = get_bucket_index(key);
-
-      bucket_t& bucket = pbuckets[index];
-
-      local_iterator iprevious = bucket.before_begin();
-      local_iterator icurrent = bucket.begin();
-
-      // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (!key_equal_function(icurrent->key, key)))
-      {
-        ++iprevious;
-        ++icurrent;
-      }
-
-      // Did we find it?
-      if (icurrent != bucket.end())
-      {
-        delete_data_node(iprevious, icurrent, bucket);
-        n = 1;
-      }
+      return erase_key(key);
+    }
 
-      return n;
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Erases an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual,
+              etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value &&
+                               !etl::is_convertible<K, iterator>::value && !etl::is_convertible<K, const_iterator>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      return erase_key(key);
     }
+#endif
 
     //*********************************************************************
     /// Erases an element.
@@ -993,6 +999,20 @@ namespace etl
       return (find(key) == end()) ? 0 : 1;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Counts an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1000,32 +1020,22 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
-
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // Is the bucket not empty?
-      if (!bucket.empty())
-      {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
-
-        while (inode != iend)
-        {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key))
-          {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
-          }
-
-          ++inode;
-        }
-      }
+      return find_node(key);
+    }
 
-      return end();
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return find_node(key);
     }
+#endif
 
     //*********************************************************************
     /// Finds an element.
@@ -1034,42 +1044,81 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      return find_node(key);
+    }
 
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element, using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return find_node(key);
+    }
+#endif
 
-      // Is the bucket not empty?
-      if (!bucket.empty())
-      {
-        // Step though the list until we find the end or an equivalent key.
-        local_iterator inode = bucket.begin();
-        local_iterator iend = bucket.end();
+    //*********************************************************************
+    /// Finds a batch of keys, such as those from a burst of packets.
+    /// All of the keys are hashed and their buckets prefetched before any are
+    /// compared, which hides much of the memory latency of a large table.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator for each key; end() if it does not exist.
+    ///\return The number of keys found.
+    //*********************************************************************
+    size_t find_batch(etl::span<const key_type> keys, etl::span<iterator> results)
+    {
+      return find_batch_nodes(keys, results);
+    }
 
-        while (inode != iend)
-        {
-          // Do we have this one?
-          if (key_equal_function(key, inode->key))
-          {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
-          }
+    //*********************************************************************
+    /// Finds a batch of keys, such as those from a burst of packets.
+    ///\param keys    The keys to search for.
+    ///\param results An iterator for each key; end() if it does not exist.
+    ///\return The number of keys found.
+    //*********************************************************************
+    size_t find_batch(etl::span<const key_type> keys, etl::span<const_iterator> results) const
+    {
+      return find_batch_nodes(keys, results);
+    }
 
-          ++inode;
-        }
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
       }
 
-      return end();
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
     //*********************************************************************
-    /// Returns a range containing all elements with key 'key' in the container.
+    /// Returns a range containing all elements with key 'key' in the container,
+    /// using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
     /// The range is defined by two iterators, the first pointing to the first
     /// element of the wanted range and the second pointing past the last
     /// element of the range.
     ///\param key The key to search for.
     ///\return An iterator pair to the range of elements if the key exists, otherwise end().
     //*********************************************************************
-    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
     {
       iterator f = find(key);
       iterator l = f;
@@ -1081,6 +1130,7 @@ namespace etl
 
       return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
+#endif
 
     //*********************************************************************
     /// Returns a range containing all elements with key 'key' in the container.
@@ -1103,6 +1153,32 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container,
+    /// using a key type that can be compared with key_type.
+    /// Enabled if both the hasher and the key comparator are transparent.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_set.
     //*************************************************************************
@@ -1292,6 +1368,167 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Gets the bucket index for the hash.
+    //*********************************************************************
+    size_t bucket_index(size_t hash) const
+    {
+      return private_unordered::bucket_index(hash, number_of_buckets);
+    }
+
+    //*********************************************************************
+    /// Checks whether the node holds the key.
+    /// If hashes are cached then the hashes are compared first.
+    //*********************************************************************
+    template <typename K>
+    bool node_has_key(const node_t& node, size_t hash, const K& key) const
+    {
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      return (node.hash_value == hash) && key_equal_function(key, node.key);
+#else
+      (void)hash;
+      return key_equal_function(key, node.key);
+#endif
+    }
+
+    //*********************************************************************
+    /// Stores the hash in the node, if hashes are cached.
+    //*********************************************************************
+    static void store_hash(node_t& node, size_t hash)
+    {
+#if ETL_HAS_UNORDERED_CACHED_HASH
+      node.hash_value = hash;
+#else
+      (void)node;
+      (void)hash;
+#endif
+    }
+
+    //*********************************************************************
+    /// Finds the first node for the key.
+    //*********************************************************************
+    template <typename K>
+    iterator find_node(const K& key) const
+    {
+      return find_node(key, key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds the first node for the key, with its hash already calculated.
+    //*********************************************************************
+    template <typename K>
+    iterator find_node(const K& key, size_t hash) const
+    {
+      bucket_t* pbucket = pbuckets + bucket_index(hash);
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (node_has_key(*inode, hash, key))
+          {
+            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return iterator((pbuckets + number_of_buckets), last, last->end());
+    }
+
+    //*********************************************************************
+    /// Finds the nodes for a span of keys.
+    /// The keys are hashed and their buckets requested in batches, then the
+    /// first node of each bucket, so that the cache misses overlap rather
+    /// than being taken one key at a time.
+    //*********************************************************************
+    template <typename TIterator>
+    size_t find_batch_nodes(etl::span<const key_type> keys, etl::span<TIterator> results) const
+    {
+      ETL_ASSERT(results.size() >= keys.size(), ETL_ERROR(unordered_set_out_of_range));
+
+      const size_t n_keys = etl::min(keys.size(), results.size());
+      const const_iterator iend = end();
+
+      size_t    hashes[private_unordered::find_batch::Size];
+      bucket_t* buckets[private_unordered::find_batch::Size];
+      size_t    n_found = 0U;
+
+      for (size_t base = 0U; base < n_keys; base += private_unordered::find_batch::Size)
+      {
+        const size_t n = etl::min(size_t(private_unordered::find_batch::Size), n_keys - base);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          hashes[i]  = key_hash_function(keys[base + i]);
+          buckets[i] = pbuckets + bucket_index(hashes[i]);
+          private_unordered::prefetch(buckets[i]);
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          if (!buckets[i]->empty())
+          {
+            private_unordered::prefetch(&*buckets[i]->begin());
+          }
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const iterator itr = find_node(keys[base + i], hashes[i]);
+
+          results[base + i] = itr;
+
+          if (const_iterator(itr) != iend)
+          {
+            ++n_found;
+          }
+        }
+      }
+
+      return n_found;
+    }
+
+    //*********************************************************************
+    /// Erases the element with the key.
+    //*********************************************************************
+    template <typename K>
+    size_t erase_key(const K& key)
+    {
+      size_t n = 0UL;
+      const size_t hash  = key_hash_function(key);
+      size_t       index = bucket_index(hash);
+
+      bucket_t& bucket = pbuckets[index];
+
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent = bucket.begin();
+
+      // Search for the key, if we have it.
+      while ((icurrent != bucket.end()) && (!node_has_key(*icurrent, hash, key)))
+      {
+        ++iprevious;
+        ++icurrent;
+      }
+
+      // Did we find it?
+      if (icurrent != bucket.end())
+      {
+        delete_data_node(iprevious, icurrent, bucket);
+        n = 1;
+      }
+
+      return n;
+    }
+
     //*************************************************************************
     /// Create a node.
     //*************************************************************************
@@ -1494,7 +1731,7 @@ namespace etl
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = private_unordered::bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
@@ -1592,7 +1829,7 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
   //*************************************************************************
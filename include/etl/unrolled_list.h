@@ -0,0 +1,1492 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNROLLED_LIST_INCLUDED
+#define ETL_UNROLLED_LIST_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "memory.h"
+#include "integral_limits.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "initializer_list.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup unrolled_list unrolled_list
+/// A doubly linked list with the capacity defined at compile time, where each
+/// node holds a small array of elements.
+/// Compared with etl::list, the link overhead is shared by the elements of a
+/// node, and a traversal reads each node's elements in order.
+/// Except for the first and last nodes, each node is kept at least half full.
+/// Inserting or erasing an element moves the elements after it in its node,
+/// and invalidates iterators to the elements of that node and its neighbours.
+/// The iterators are segmented, so etl::copy and etl::for_each process each
+/// node's elements as a pointer range.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_exception : public etl::exception
+  {
+  public:
+
+    unrolled_list_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_full : public etl::unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_full(string_type file_name_, numeric_type line_number_)
+      : etl::unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:full", ETL_UNROLLED_LIST_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the unrolled_list.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  class unrolled_list_empty : public etl::unrolled_list_exception
+  {
+  public:
+
+    unrolled_list_empty(string_type file_name_, numeric_type line_number_)
+      : etl::unrolled_list_exception(ETL_ERROR_TEXT("unrolled_list:empty", ETL_UNROLLED_LIST_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized unrolled_lists.
+  /// Can be used as a reference type for all unrolled_lists containing a specific type.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  template <typename T>
+  class iunrolled_list
+  {
+  public:
+
+    typedef T         value_type;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+#if ETL_USING_CPP11
+    typedef T&&       rvalue_reference;
+#endif
+    typedef T*        pointer;
+    typedef const T*  const_pointer;
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+  private:
+
+    /// The end of a list of nodes.
+    static ETL_CONSTANT size_t npos = etl::integral_limits<size_t>::max;
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, T>
+    {
+    public:
+
+      friend class iunrolled_list;
+      friend class const_iterator;
+
+      /// Marks the iterator as segmented. See etl::is_segmented_iterator.
+      typedef T* segment_pointer;
+
+      //*******************************
+      iterator()
+        : p_list(ETL_NULLPTR)
+        , node(npos)
+        , offset(0U)
+      {
+      }
+
+      //*******************************
+      iterator& operator ++()
+      {
+        if (++offset == p_list->p_counts[node])
+        {
+          node   = p_list->p_next[node];
+          offset = 0U;
+        }
+
+        return *this;
+      }
+
+      //*******************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      //*******************************
+      iterator& operator --()
+      {
+        if (node == npos)
+        {
+          node   = p_list->tail;
+          offset = p_list->p_counts[node] - 1U;
+        }
+        else if (offset == 0U)
+        {
+          node   = p_list->p_prev[node];
+          offset = p_list->p_counts[node] - 1U;
+        }
+        else
+        {
+          --offset;
+        }
+
+        return *this;
+      }
+
+      //*******************************
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      //*******************************
+      reference operator *() const
+      {
+        return *p_list->address(node, offset);
+      }
+
+      //*******************************
+      pointer operator ->() const
+      {
+        return p_list->address(node, offset);
+      }
+
+      //*******************************
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.node == rhs.node) && (lhs.offset == rhs.offset);
+      }
+
+      //*******************************
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //*******************************
+      /// The address of the current element.
+      //*******************************
+      segment_pointer segment_begin() const
+      {
+        return p_list->address(node, offset);
+      }
+
+      //*******************************
+      /// The number of contiguous elements from this one, up to
+      /// 'last' or the end of the node, whichever is nearer.
+      //*******************************
+      size_t segment_size(const iterator& last) const
+      {
+        return (last.node == node) ? (last.offset - offset) : (p_list->p_counts[node] - offset);
+      }
+
+      //*******************************
+      /// Moves forward by n elements, within the node.
+      //*******************************
+      void segment_advance(size_t n)
+      {
+        offset += n;
+
+        if (offset == p_list->p_counts[node])
+        {
+          node   = p_list->p_next[node];
+          offset = 0U;
+        }
+      }
+
+    private:
+
+      //*******************************
+      iterator(iunrolled_list* p_list_, size_t node_, size_t offset_)
+        : p_list(p_list_)
+        , node(node_)
+        , offset(offset_)
+      {
+      }
+
+      iunrolled_list* p_list;
+      size_t          node;
+      size_t          offset;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const T>
+    {
+    public:
+
+      friend class iunrolled_list;
+
+      /// Marks the iterator as segmented. See etl::is_segmented_iterator.
+      typedef const T* segment_pointer;
+
+      //*******************************
+      const_iterator()
+        : p_list(ETL_NULLPTR)
+        , node(npos)
+        , offset(0U)
+      {
+      }
+
+      //*******************************
+      const_iterator(const typename iunrolled_list::iterator& other)
+        : p_list(other.p_list)
+        , node(other.node)
+        , offset(other.offset)
+      {
+      }
+
+      //*******************************
+      const_iterator& operator ++()
+      {
+        if (++offset == p_list->p_counts[node])
+        {
+          node   = p_list->p_next[node];
+          offset = 0U;
+        }
+
+        return *this;
+      }
+
+      //*******************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      //*******************************
+      const_iterator& operator --()
+      {
+        if (node == npos)
+        {
+          node   = p_list->tail;
+          offset = p_list->p_counts[node] - 1U;
+        }
+        else if (offset == 0U)
+        {
+          node   = p_list->p_prev[node];
+          offset = p_list->p_counts[node] - 1U;
+        }
+        else
+        {
+          --offset;
+        }
+
+        return *this;
+      }
+
+      //*******************************
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      //*******************************
+      const_reference operator *() const
+      {
+        return *p_list->address(node, offset);
+      }
+
+      //*******************************
+      const_pointer operator ->() const
+      {
+        return p_list->address(node, offset);
+      }
+
+      //*******************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.node == rhs.node) && (lhs.offset == rhs.offset);
+      }
+
+      //*******************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //*******************************
+      /// The address of the current element.
+      //*******************************
+      segment_pointer segment_begin() const
+      {
+        return p_list->address(node, offset);
+      }
+
+      //*******************************
+      /// The number of contiguous elements from this one, up to
+      /// 'last' or the end of the node, whichever is nearer.
+      //*******************************
+      size_t segment_size(const const_iterator& last) const
+      {
+        return (last.node == node) ? (last.offset - offset) : (p_list->p_counts[node] - offset);
+      }
+
+      //*******************************
+      /// Moves forward by n elements, within the node.
+      //*******************************
+      void segment_advance(size_t n)
+      {
+        offset += n;
+
+        if (offset == p_list->p_counts[node])
+        {
+          node   = p_list->p_next[node];
+          offset = 0U;
+        }
+      }
+
+    private:
+
+      //*******************************
+      const_iterator(const iunrolled_list* p_list_, size_t node_, size_t offset_)
+        : p_list(p_list_)
+        , node(node_)
+        , offset(offset_)
+      {
+      }
+
+      const iunrolled_list* p_list;
+      size_t                node;
+      size_t                offset;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the list.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, head, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the list.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, head, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the list.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, npos, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the list.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, npos, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the list.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, head, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the list.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, npos, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return *address(head, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the first element.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return *address(head, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      return *address(tail, p_counts[tail] - 1U);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the last element.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return *address(tail, p_counts[tail] - 1U);
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values to the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list does not have enough free space.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns 'n' copies of a value to the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if n > max_size().
+    //*************************************************************************
+    void assign(size_t n, const_reference value)
+    {
+      clear();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        push_back(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Pushes a value to the front of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    void push_front(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(unrolled_list_full));
+
+      ::new (static_cast<void*>(front_slot())) T(value);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Pushes a value to the front of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    void push_front(rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(unrolled_list_full));
+
+      ::new (static_cast<void*>(front_slot())) T(etl::move(value));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_front(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = front_slot();
+      ::new (static_cast<void*>(p)) T(etl::forward<Args>(args)...);
+
+      return *p;
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value at the front of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    reference emplace_front()
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = front_slot();
+      ::new (static_cast<void*>(p)) T();
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename T1>
+    reference emplace_front(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = front_slot();
+      ::new (static_cast<void*>(p)) T(value1);
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    reference emplace_front(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = front_slot();
+      ::new (static_cast<void*>(p)) T(value1, value2);
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    reference emplace_front(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = front_slot();
+      ::new (static_cast<void*>(p)) T(value1, value2, value3);
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    reference emplace_front(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = front_slot();
+      ::new (static_cast<void*>(p)) T(value1, value2, value3, value4);
+
+      return *p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pushes a value to the back of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(unrolled_list_full));
+
+      ::new (static_cast<void*>(back_slot())) T(value);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Pushes a value to the back of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    void push_back(rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(unrolled_list_full));
+
+      ::new (static_cast<void*>(back_slot())) T(etl::move(value));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_back(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = back_slot();
+      ::new (static_cast<void*>(p)) T(etl::forward<Args>(args)...);
+
+      return *p;
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value at the back of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    reference emplace_back()
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = back_slot();
+      ::new (static_cast<void*>(p)) T();
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename T1>
+    reference emplace_back(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = back_slot();
+      ::new (static_cast<void*>(p)) T(value1);
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    reference emplace_back(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = back_slot();
+      ::new (static_cast<void*>(p)) T(value1, value2);
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    reference emplace_back(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = back_slot();
+      ::new (static_cast<void*>(p)) T(value1, value2, value3);
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back of the list.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    reference emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      T* p = back_slot();
+      ::new (static_cast<void*>(p)) T(value1, value2, value3, value4);
+
+      return *p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the first element.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_front()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      erase(begin());
+    }
+
+    //*************************************************************************
+    /// Removes the last element.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(unrolled_list_empty));
+
+      erase(iterator(this, tail, p_counts[tail] - 1U));
+    }
+
+    //*************************************************************************
+    /// Inserts a value before position.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      iterator itr = make_gap(position.node, position.offset);
+      ::new (static_cast<void*>(itr.segment_begin())) T(value);
+
+      return itr;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value before position.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      iterator itr = make_gap(position.node, position.offset);
+      ::new (static_cast<void*>(itr.segment_begin())) T(etl::move(value));
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value before position.
+    /// If asserts or exceptions are enabled, throws an etl::unrolled_list_full if the list is already full.
+    ///\return An iterator to the emplaced value.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(const_iterator position, Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unrolled_list_full));
+
+      iterator itr = make_gap(position.node, position.offset);
+      ::new (static_cast<void*>(itr.segment_begin())) T(etl::forward<Args>(args)...);
+
+      return itr;
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value at position.
+    ///\return An iterator to the value that followed the erased value.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const size_t node = position.node;
+      T* p = address(node, 0U);
+
+      p[position.offset].~T();
+      relocate_forward(p + position.offset + 1U, p + p_counts[node], p + position.offset);
+
+      --p_counts[node];
+      --current_size;
+
+      iterator result(this, node, position.offset);
+
+      if (position.offset == p_counts[node])
+      {
+        result.node   = p_next[node];
+        result.offset = 0U;
+      }
+
+      rebalance(node, result);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Erases a range of values.
+    ///\return An iterator to the value that followed the erased values.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      // Erasing may move the values after 'first', so count first.
+      size_t n = static_cast<size_t>(etl::distance(first, last));
+
+      iterator result(this, first.node, first.offset);
+
+      while (n-- != 0U)
+      {
+        result = erase(result);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Clears the list.
+    //*************************************************************************
+    void clear()
+    {
+      size_t node = head;
+
+      while (node != npos)
+      {
+        const size_t next = p_next[node];
+        etl::destroy(address(node, 0U), address(node, p_counts[node]));
+        release(node);
+        node = next;
+      }
+
+      head         = npos;
+      tail         = npos;
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunrolled_list& operator =(const iunrolled_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunrolled_list& operator =(iunrolled_list&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns true if the list is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if the list is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements in each full node.
+    //*************************************************************************
+    size_type node_size() const
+    {
+      return NODE_SIZE;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iunrolled_list(T* p_values_, size_t* p_next_, size_t* p_prev_, size_t* p_counts_,
+                   size_t max_size_, size_t node_size_, size_t number_of_nodes_)
+      : p_values(p_values_)
+      , p_next(p_next_)
+      , p_prev(p_prev_)
+      , p_counts(p_counts_)
+      , head(npos)
+      , tail(npos)
+      , free_nodes(npos)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+      , NODE_SIZE(node_size_)
+    {
+      for (size_t node = number_of_nodes_; node != 0U; --node)
+      {
+        release(node - 1U);
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another list to this one.
+    //*************************************************************************
+    void move_container(iunrolled_list&& other)
+    {
+      clear();
+
+      for (iterator itr = other.begin(); itr != other.end(); ++itr)
+      {
+        push_back(etl::move(*itr));
+      }
+
+      other.clear();
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNROLLED_LIST) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunrolled_list()
+    {
+    }
+#else
+    ~iunrolled_list()
+    {
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// The address of an element of a node.
+    //*************************************************************************
+    T* address(size_t node, size_t offset) const
+    {
+      return p_values + (node * NODE_SIZE) + offset;
+    }
+
+    //*************************************************************************
+    /// Takes a node from the free list.
+    //*************************************************************************
+    size_t allocate()
+    {
+      const size_t node = free_nodes;
+      free_nodes = p_next[node];
+      p_counts[node] = 0U;
+
+      return node;
+    }
+
+    //*************************************************************************
+    /// Returns a node to the free list.
+    //*************************************************************************
+    void release(size_t node)
+    {
+      p_next[node] = free_nodes;
+      free_nodes   = node;
+    }
+
+    //*************************************************************************
+    /// Links a new node after 'node', or at the front if 'node' is npos.
+    //*************************************************************************
+    size_t insert_node_after(size_t node)
+    {
+      const size_t new_node = allocate();
+      const size_t next     = (node == npos) ? head : p_next[node];
+
+      p_prev[new_node] = node;
+      p_next[new_node] = next;
+
+      if (node == npos)
+      {
+        head = new_node;
+      }
+      else
+      {
+        p_next[node] = new_node;
+      }
+
+      if (next == npos)
+      {
+        tail = new_node;
+      }
+      else
+      {
+        p_prev[next] = new_node;
+      }
+
+      return new_node;
+    }
+
+    //*************************************************************************
+    /// Unlinks and releases a node.
+    //*************************************************************************
+    void remove_node(size_t node)
+    {
+      const size_t prev = p_prev[node];
+      const size_t next = p_next[node];
+
+      if (prev == npos)
+      {
+        head = next;
+      }
+      else
+      {
+        p_next[prev] = next;
+      }
+
+      if (next == npos)
+      {
+        tail = prev;
+      }
+      else
+      {
+        p_prev[next] = prev;
+      }
+
+      release(node);
+    }
+
+    //*************************************************************************
+    /// Moves [sb, se) down to db, where db is before sb.
+    /// The destination is uninitialised. The source is left uninitialised.
+    //*************************************************************************
+    static void relocate_forward(T* sb, T* se, T* db)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::trivially_relocate(sb, se, db);
+      }
+      else
+      {
+        while (sb != se)
+        {
+          ::new (static_cast<void*>(db)) T(ETL_MOVE(*sb));
+          sb->~T();
+          ++sb;
+          ++db;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Moves [sb, se) up to de, where de is the end of the destination.
+    /// The destination is uninitialised. The source is left uninitialised.
+    //*************************************************************************
+    static void relocate_backward(T* sb, T* se, T* de)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::trivially_relocate(sb, se, de - (se - sb));
+      }
+      else
+      {
+        while (se != sb)
+        {
+          --se;
+          --de;
+          ::new (static_cast<void*>(de)) T(ETL_MOVE(*se));
+          se->~T();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Makes an uninitialised slot before (node, offset), or at the back if node is npos.
+    /// Splits a full node in half.
+    ///\return An iterator to the slot.
+    //*************************************************************************
+    iterator make_gap(size_t node, size_t offset)
+    {
+      if (node == npos)
+      {
+        node = tail;
+
+        if ((node == npos) || (p_counts[node] == NODE_SIZE))
+        {
+          node = insert_node_after(tail);
+        }
+
+        offset = p_counts[node];
+      }
+      else if (p_counts[node] == NODE_SIZE)
+      {
+        const size_t keep     = NODE_SIZE - (NODE_SIZE / 2U);
+        const size_t new_node = insert_node_after(node);
+
+        relocate_forward(address(node, keep), address(node, NODE_SIZE), address(new_node, 0U));
+        p_counts[new_node] = NODE_SIZE - keep;
+        p_counts[node]     = keep;
+
+        if (offset > keep)
+        {
+          node    = new_node;
+          offset -= keep;
+        }
+      }
+
+      T* p = address(node, 0U);
+      relocate_backward(p + offset, p + p_counts[node], p + p_counts[node] + 1U);
+
+      ++p_counts[node];
+      ++current_size;
+
+      return iterator(this, node, offset);
+    }
+
+    //*************************************************************************
+    /// Makes an uninitialised slot at the front.
+    //*************************************************************************
+    T* front_slot()
+    {
+      size_t node = head;
+
+      if ((node == npos) || (p_counts[node] == NODE_SIZE))
+      {
+        node = insert_node_after(npos);
+      }
+
+      return make_gap(node, 0U).segment_begin();
+    }
+
+    //*************************************************************************
+    /// Makes an uninitialised slot at the back.
+    //*************************************************************************
+    T* back_slot()
+    {
+      return make_gap(npos, 0U).segment_begin();
+    }
+
+    //*************************************************************************
+    /// Restores the fill of a node after an erase.
+    /// An inner node that is less than half full takes all of the next node,
+    /// if they fit, or otherwise its first element. An empty node is removed.
+    /// Adjusts 'itr' to refer to the same element.
+    //*************************************************************************
+    void rebalance(size_t node, iterator& itr)
+    {
+      if (p_counts[node] == 0U)
+      {
+        remove_node(node);
+        return;
+      }
+
+      if ((node == head) || (node == tail) || (p_counts[node] >= (NODE_SIZE / 2U)))
+      {
+        return;
+      }
+
+      const size_t next  = p_next[node];
+      const size_t count = p_counts[node];
+
+      if ((count + p_counts[next]) <= NODE_SIZE)
+      {
+        relocate_forward(address(next, 0U), address(next, p_counts[next]), address(node, count));
+        p_counts[node] += p_counts[next];
+        remove_node(next);
+
+        if (itr.node == next)
+        {
+          itr.node    = node;
+          itr.offset += count;
+        }
+      }
+      else
+      {
+        relocate_forward(address(next, 0U), address(next, 1U), address(node, count));
+        relocate_forward(address(next, 1U), address(next, p_counts[next]), address(next, 0U));
+        ++p_counts[node];
+        --p_counts[next];
+
+        if (itr.node == next)
+        {
+          if (itr.offset == 0U)
+          {
+            itr.node   = node;
+            itr.offset = count;
+          }
+          else
+          {
+            --itr.offset;
+          }
+        }
+      }
+    }
+
+    // Disable copy construction.
+    iunrolled_list(const iunrolled_list&);
+
+    T*              p_values;     ///< The elements, in nodes of NODE_SIZE.
+    size_t*         p_next;       ///< The next node, or the next free node.
+    size_t*         p_prev;       ///< The previous node.
+    size_t*         p_counts;     ///< The number of elements in each node.
+    size_t          head;
+    size_t          tail;
+    size_t          free_nodes;
+    size_type       current_size;
+    const size_type CAPACITY;
+    const size_type NODE_SIZE;
+  };
+
+  template <typename T>
+  ETL_CONSTANT size_t iunrolled_list<T>::npos;
+
+  //***************************************************************************
+  /// Equal operator.
+  //***************************************************************************
+  template <typename T>
+  bool operator ==(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  //***************************************************************************
+  template <typename T>
+  bool operator !=(const etl::iunrolled_list<T>& lhs, const etl::iunrolled_list<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A fixed capacity unrolled list.
+  ///\tparam T                 The type of the elements.
+  ///\tparam MAX_SIZE_         The maximum number of elements.
+  ///\tparam ELEMENTS_PER_NODE The number of elements in each node.
+  ///\ingroup unrolled_list
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, const size_t ELEMENTS_PER_NODE = 8U>
+  class unrolled_list : public etl::iunrolled_list<T>
+  {
+  private:
+
+    typedef etl::iunrolled_list<T> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(ELEMENTS_PER_NODE >= 2U, "An unrolled_list node must hold at least two elements");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    /// The number of nodes. Only the first and last nodes may be less than half full.
+    static ETL_CONSTANT size_t Number_Of_Nodes = ((2U + (MAX_SIZE_ / (ELEMENTS_PER_NODE / 2U))) < MAX_SIZE_) ?
+                                                 (2U + (MAX_SIZE_ / (ELEMENTS_PER_NODE / 2U))) : MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unrolled_list()
+      : base_t(values, next, prev, counts, MAX_SIZE, ELEMENTS_PER_NODE, Number_Of_Nodes)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    unrolled_list(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+      : base_t(values, next, prev, counts, MAX_SIZE, ELEMENTS_PER_NODE, Number_Of_Nodes)
+    {
+      base_t::assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from an initializer_list.
+    //*************************************************************************
+    unrolled_list(std::initializer_list<T> init)
+      : base_t(values, next, prev, counts, MAX_SIZE, ELEMENTS_PER_NODE, Number_Of_Nodes)
+    {
+      base_t::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unrolled_list(const unrolled_list& other)
+      : base_t(values, next, prev, counts, MAX_SIZE, ELEMENTS_PER_NODE, Number_Of_Nodes)
+    {
+      base_t::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unrolled_list(unrolled_list&& other)
+      : base_t(values, next, prev, counts, MAX_SIZE, ELEMENTS_PER_NODE, Number_Of_Nodes)
+    {
+      base_t::move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unrolled_list()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unrolled_list& operator =(const unrolled_list& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unrolled_list& operator =(unrolled_list&& rhs)
+    {
+      base_t::operator =(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    etl::uninitialized_buffer_of<T, Number_Of_Nodes * ELEMENTS_PER_NODE> values;
+    size_t next[Number_Of_Nodes];
+    size_t prev[Number_Of_Nodes];
+    size_t counts[Number_Of_Nodes];
+  };
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ELEMENTS_PER_NODE>
+  ETL_CONSTANT size_t unrolled_list<T, MAX_SIZE_, ELEMENTS_PER_NODE>::MAX_SIZE;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ELEMENTS_PER_NODE>
+  ETL_CONSTANT size_t unrolled_list<T, MAX_SIZE_, ELEMENTS_PER_NODE>::Number_Of_Nodes;
+}
+
+#endif
@@ -506,25 +506,41 @@ namespace etl
 
   namespace private_integer_sequence
   {
-    template <size_t N, typename IndexSeq>
-    struct make_index_sequence;
+    // Joins two sequences, offsetting the second by the length of the first.
+    template <typename TFirst, typename TSecond>
+    struct join;
 
-    template <size_t N, size_t... Indices>
-    struct make_index_sequence<N, etl::integer_sequence<size_t, Indices...>>
+    template <size_t... First, size_t... Second>
+    struct join<etl::integer_sequence<size_t, First...>, etl::integer_sequence<size_t, Second...>>
     {
-      typedef typename make_index_sequence<N - 1, etl::integer_sequence<size_t, N - 1, Indices...>>::type type;
+      typedef etl::integer_sequence<size_t, First..., (sizeof...(First) + Second)...> type;
     };
 
-    template <size_t... Indices>
-    struct make_index_sequence<0, etl::integer_sequence<size_t, Indices...>>
+    // Builds the sequence from two halves, so that the instantiation depth is
+    // logarithmic rather than linear in N.
+    template <size_t N>
+    struct make_index_sequence
     {
-      typedef etl::integer_sequence<size_t, Indices...> type;
+      typedef typename join<typename make_index_sequence<N / 2>::type,
+                            typename make_index_sequence<N - (N / 2)>::type>::type type;
+    };
+
+    template <>
+    struct make_index_sequence<0>
+    {
+      typedef etl::integer_sequence<size_t> type;
+    };
+
+    template <>
+    struct make_index_sequence<1>
+    {
+      typedef etl::integer_sequence<size_t, 0> type;
     };
   }
 
   //***********************************
   template <size_t N>
-  using make_index_sequence = typename private_integer_sequence::make_index_sequence<N, etl::integer_sequence<size_t>>::type;
+  using make_index_sequence = typename private_integer_sequence::make_index_sequence<N>::type;
 
   //***********************************
   template <size_t... Indices>
@@ -599,6 +615,19 @@ namespace etl
   inline constexpr in_place_index_t<I> in_place_index{};
 #endif
 
+  //***************************************************************************
+  /// sorted_unique disambiguation tag.
+  /// Indicates that a range is already sorted and holds no duplicate keys.
+  //***************************************************************************
+  struct sorted_unique_t
+  {
+    explicit ETL_CONSTEXPR sorted_unique_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr sorted_unique_t sorted_unique{};
+#endif
+
 #if ETL_USING_CPP11
   //*************************************************************************
   /// A function wrapper for free/global functions.
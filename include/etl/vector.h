@@ -586,6 +586,11 @@ namespace etl
       {
         create_back(value);
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        open_gap(position_, 1U);
+        etl::create_copy_at(position_, value);
+      }
       else
       {
         create_back(back());
@@ -613,6 +618,11 @@ namespace etl
       {
         create_back(etl::move(value));
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        open_gap(position_, 1U);
+        etl::create_copy_at(position_, etl::move(value));
+      }
       else
       {
         create_back(etl::move(back()));
@@ -642,6 +652,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -669,6 +684,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -696,6 +716,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -723,6 +748,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -750,6 +780,11 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -777,6 +812,14 @@ namespace etl
 
       iterator position_ = to_iterator(position);
 
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        open_gap(position_, n);
+        etl::uninitialized_fill_n(position_, n, value);
+
+        return;
+      }
+
       size_t insert_n = n;
       size_t insert_begin = etl::distance(begin(), position_);
       size_t insert_end = insert_begin + insert_n;
@@ -834,6 +877,16 @@ namespace etl
 
       ETL_ASSERT_OR_RETURN((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        iterator position_ = to_iterator(position);
+
+        open_gap(position_, count);
+        etl::uninitialized_copy(first, last, position_);
+
+        return;
+      }
+
       size_t insert_n = count;
       size_t insert_begin = etl::distance(cbegin(), position);
       size_t insert_end = insert_begin + insert_n;
@@ -883,8 +936,16 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      etl::move(i_element + 1, end(), i_element);
-      destroy_back();
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(i_element);
+        close_gap(i_element, 1U);
+      }
+      else
+      {
+        etl::move(i_element + 1, end(), i_element);
+        destroy_back();
+      }
 
       return i_element;
     }
@@ -898,8 +959,16 @@ namespace etl
     {
       iterator i_element_ = to_iterator(i_element);
 
-      etl::move(i_element_ + 1, end(), i_element_);
-      destroy_back();
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(i_element_);
+        close_gap(i_element_, 1U);
+      }
+      else
+      {
+        etl::move(i_element_ + 1, end(), i_element_);
+        destroy_back();
+      }
 
       return i_element_;
     }
@@ -921,6 +990,11 @@ namespace etl
       {
         clear();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy(first_, last_);
+        close_gap(first_, static_cast<size_t>(etl::distance(first_, last_)));
+      }
       else
       {
         etl::move(last_, end(), first_);
@@ -1098,6 +1172,30 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*********************************************************************
+    /// Opens a gap of n unconstructed elements at position, by relocating
+    /// the elements after it. For trivially relocatable types.
+    //*********************************************************************
+    void open_gap(iterator position, size_t n)
+    {
+      etl::trivially_relocate(position, p_end, position + n);
+      ETL_ADD_DEBUG_COUNT(n);
+
+      p_end += n;
+    }
+
+    //*********************************************************************
+    /// Closes a gap of n destroyed elements at position, by relocating
+    /// the elements after it. For trivially relocatable types.
+    //*********************************************************************
+    void close_gap(iterator position, size_t n)
+    {
+      etl::trivially_relocate(position + n, p_end, position);
+      ETL_SUBTRACT_DEBUG_COUNT(n);
+
+      p_end -= n;
+    }
+
     // Disable copy construction.
     ivector(const ivector&) ETL_DELETE;
 
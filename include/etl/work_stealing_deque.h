@@ -0,0 +1,296 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORK_STEALING_DEQUE_INCLUDED
+#define ETL_WORK_STEALING_DEQUE_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+#include "type_traits.h"
+#include "static_assert.h"
+#include "power.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue
+  /// The base for a fixed capacity, lock-free, Chase-Lev work-stealing deque.
+  /// The owner thread pushes and pops at the bottom. Any thread may steal from the top.
+  /// Elements are held in atomics, so T must be a pointer or integral type.
+  /// \tparam T The type of value that the deque holds.
+  //***************************************************************************
+  template <typename T>
+  class iwork_stealing_deque
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_pointer<T>::value || etl::is_integral<T>::value, "T must be a pointer or integral type");
+
+    typedef T        value_type;
+    typedef size_t   size_type;
+
+  private:
+
+    typedef uint32_t counter_type;
+    typedef int32_t  difference_type;
+
+  public:
+
+    //*************************************************************************
+    /// Pushes a value to the bottom of the deque.
+    /// Must only be called from the owner thread.
+    /// \return <b>true</b> if the value was pushed, <b>false</b> if the deque was full.
+    //*************************************************************************
+    bool push_bottom(value_type value)
+    {
+      counter_type b = bottom.load(etl::memory_order_relaxed);
+      counter_type t = top.load(etl::memory_order_acquire);
+
+      if (static_cast<difference_type>(b - t) >= static_cast<difference_type>(mask + 1U))
+      {
+        return false;
+      }
+
+      p_buffer[b & mask].store(value, etl::memory_order_relaxed);
+
+      // Publishes the value to the thieves.
+      bottom.store(b + 1U, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pops a value from the bottom of the deque.
+    /// Must only be called from the owner thread.
+    /// \return <b>true</b> if a value was popped, <b>false</b> if the deque was empty,
+    /// or the last value was taken by a thief.
+    //*************************************************************************
+    bool pop_bottom(value_type& value)
+    {
+      counter_type b = bottom.load(etl::memory_order_relaxed) - 1U;
+
+      // The store of bottom must be ordered before the load of top, so that
+      // the owner and a thief cannot both take the last value.
+      bottom.store(b, etl::memory_order_seq_cst);
+      counter_type t = top.load(etl::memory_order_seq_cst);
+
+      if (static_cast<difference_type>(b - t) < 0)
+      {
+        // Empty.
+        bottom.store(b + 1U, etl::memory_order_relaxed);
+        return false;
+      }
+
+      value = p_buffer[b & mask].load(etl::memory_order_relaxed);
+
+      if (b != t)
+      {
+        // More than one value, so no thief can reach this one.
+        return true;
+      }
+
+      // The last value. Race the thieves for it.
+      bool won = top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst);
+
+      bottom.store(b + 1U, etl::memory_order_relaxed);
+
+      return won;
+    }
+
+    //*************************************************************************
+    /// Steals a value from the top of the deque.
+    /// May be called from any thread.
+    /// \return <b>true</b> if a value was stolen, <b>false</b> if the deque was empty,
+    /// or another thread took the value first.
+    //*************************************************************************
+    bool steal(value_type& value)
+    {
+      counter_type t = top.load(etl::memory_order_seq_cst);
+      counter_type b = bottom.load(etl::memory_order_seq_cst);
+
+      if (static_cast<difference_type>(b - t) <= 0)
+      {
+        // Empty.
+        return false;
+      }
+
+      // Read before the claim. Once top moves on, the owner may overwrite the slot.
+      value = p_buffer[t & mask].load(etl::memory_order_relaxed);
+
+      return top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst);
+    }
+
+    //*************************************************************************
+    /// How many values are in the deque.
+    /// Approximate if other threads are accessing the deque.
+    //*************************************************************************
+    size_type size() const
+    {
+      counter_type b = bottom.load(etl::memory_order_acquire);
+      counter_type t = top.load(etl::memory_order_acquire);
+
+      difference_type n = static_cast<difference_type>(b - t);
+
+      return (n > 0) ? static_cast<size_type>(n) : 0U;
+    }
+
+    //*************************************************************************
+    /// Is the deque empty?
+    /// Approximate if other threads are accessing the deque.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the deque full?
+    /// Approximate if other threads are accessing the deque.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == capacity();
+    }
+
+    //*************************************************************************
+    /// How much free space is in the deque.
+    /// Approximate if other threads are accessing the deque.
+    //*************************************************************************
+    size_type available() const
+    {
+      return capacity() - size();
+    }
+
+    //*************************************************************************
+    /// The maximum number of values in the deque.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return static_cast<size_type>(mask) + 1U;
+    }
+
+    //*************************************************************************
+    /// The maximum number of values in the deque.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    iwork_stealing_deque(etl::atomic<value_type>* p_buffer_, size_type capacity_)
+      : p_buffer(p_buffer_)
+      , mask(static_cast<counter_type>(capacity_ - 1U))
+      , top(0U)
+      , bottom(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_WORK_STEALING_DEQUE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iwork_stealing_deque()
+    {
+    }
+#else
+    ~iwork_stealing_deque()
+    {
+    }
+#endif
+
+  private:
+
+    // Disable copy construction and assignment.
+    iwork_stealing_deque(const iwork_stealing_deque&) ETL_DELETE;
+    iwork_stealing_deque& operator =(const iwork_stealing_deque&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iwork_stealing_deque(iwork_stealing_deque&&) = delete;
+    iwork_stealing_deque& operator =(iwork_stealing_deque&&) = delete;
+#endif
+
+    etl::atomic<value_type>* p_buffer;
+    const counter_type       mask;
+    etl::atomic<counter_type> top;    ///< Where thieves take from.
+    etl::atomic<counter_type> bottom; ///< Where the owner pushes and pops.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue
+  /// A fixed capacity, lock-free, Chase-Lev work-stealing deque.
+  /// \tparam T    The type of value that the deque holds.
+  /// \tparam SIZE The maximum number of values. Must be a power of 2.
+  //***************************************************************************
+  template <typename T, size_t SIZE>
+  class work_stealing_deque : public etl::iwork_stealing_deque<T>
+  {
+    typedef etl::iwork_stealing_deque<T> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<SIZE>::value, "SIZE must be a power of 2");
+    ETL_STATIC_ASSERT(SIZE <= 0x40000000UL, "SIZE too large");
+
+    typedef typename base_t::value_type value_type;
+    typedef typename base_t::size_type  size_type;
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    work_stealing_deque()
+      : base_t(buffer, MAX_SIZE)
+    {
+    }
+
+  private:
+
+    etl::atomic<value_type> buffer[SIZE];
+  };
+
+  template <typename T, size_t SIZE>
+  ETL_CONSTANT typename work_stealing_deque<T, SIZE>::size_type work_stealing_deque<T, SIZE>::MAX_SIZE;
+}
+
+#endif
+#endif
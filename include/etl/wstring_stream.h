@@ -39,10 +39,12 @@ SOFTWARE.
 #include "to_wstring.h"
 #include "string_view.h"
 #include "basic_string_stream.h"
+#include "basic_string_sink_stream.h"
 
 namespace etl
 {
   typedef etl::basic_string_stream<etl::wformat_spec, etl::iwstring, etl::wstring_view> wstring_stream;
+  typedef etl::basic_string_sink_stream<etl::wformat_spec, etl::iwstring, etl::wstring_view> wstring_sink_stream;
 }
 
 #endif
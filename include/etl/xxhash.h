@@ -0,0 +1,563 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_XXHASH_INCLUDED
+#define ETL_XXHASH_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "binary.h"
+#include "iterator.h"
+#include "ihash.h"
+
+#include <stdint.h>
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup xxhash xxHash 32 & 64 bit hash calculations
+/// See https://github.com/Cyan4973/xxHash for more details.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_xxhash
+  {
+    //*************************************************************************
+    /// Reads a little endian 32 bit value, a byte at a time.
+    /// Optimising compilers reduce this to a single load on little endian targets.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint32_t read32(const uint8_t* p)
+    {
+      return  uint32_t(p[0])         | (uint32_t(p[1]) << 8U) |
+             (uint32_t(p[2]) << 16U) | (uint32_t(p[3]) << 24U);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Reads a little endian 64 bit value, a byte at a time.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t read64(const uint8_t* p)
+    {
+      return uint64_t(read32(p)) | (uint64_t(read32(p + 4U)) << 32U);
+    }
+#endif
+
+    //*************************************************************************
+    /// The xxHash32 state.
+    //*************************************************************************
+    class xxhash32_state
+    {
+    public:
+
+      //***********************************
+      ETL_CONSTEXPR14 explicit xxhash32_state(uint32_t seed_)
+        : seed(seed_)
+        , total_length(0U)
+        , buffer_size(0U)
+        , v1(seed_ + PRIME1 + PRIME2)
+        , v2(seed_ + PRIME2)
+        , v3(seed_)
+        , v4(seed_ - PRIME1)
+        , buffer()
+      {
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 void add(uint8_t value)
+      {
+        buffer[buffer_size++] = value;
+        ++total_length;
+
+        if (buffer_size == Stripe_Size)
+        {
+          add_stripe(buffer);
+          buffer_size = 0U;
+        }
+      }
+
+      //***********************************
+      /// Adds a contiguous block, hashing whole stripes in place.
+      //***********************************
+      ETL_CONSTEXPR14 void add(const uint8_t* p_data, size_t length)
+      {
+        // Complete a partially filled buffer.
+        while ((buffer_size != 0U) && (length != 0U))
+        {
+          add(*p_data++);
+          --length;
+        }
+
+        total_length += length;
+
+        while (length >= Stripe_Size)
+        {
+          add_stripe(p_data);
+          p_data += Stripe_Size;
+          length -= Stripe_Size;
+        }
+
+        while (length != 0U)
+        {
+          buffer[buffer_size++] = *p_data++;
+          --length;
+        }
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 uint32_t value() const
+      {
+        uint32_t hash = (total_length >= Stripe_Size) ? etl::rotate_left(v1, 1U)  + etl::rotate_left(v2, 7U) +
+                                                        etl::rotate_left(v3, 12U) + etl::rotate_left(v4, 18U)
+                                                      : seed + PRIME5;
+
+        hash += uint32_t(total_length);
+
+        size_t i = 0U;
+
+        while ((i + 4U) <= buffer_size)
+        {
+          hash += read32(buffer + i) * PRIME3;
+          hash  = etl::rotate_left(hash, 17U) * PRIME4;
+          i += 4U;
+        }
+
+        while (i < buffer_size)
+        {
+          hash += buffer[i] * PRIME5;
+          hash  = etl::rotate_left(hash, 11U) * PRIME1;
+          ++i;
+        }
+
+        hash ^= hash >> 15U;
+        hash *= PRIME2;
+        hash ^= hash >> 13U;
+        hash *= PRIME3;
+        hash ^= hash >> 16U;
+
+        return hash;
+      }
+
+    private:
+
+      static ETL_CONSTANT size_t   Stripe_Size = 16U;
+      static ETL_CONSTANT uint32_t PRIME1      = 0x9E3779B1UL;
+      static ETL_CONSTANT uint32_t PRIME2      = 0x85EBCA77UL;
+      static ETL_CONSTANT uint32_t PRIME3      = 0xC2B2AE3DUL;
+      static ETL_CONSTANT uint32_t PRIME4      = 0x27D4EB2FUL;
+      static ETL_CONSTANT uint32_t PRIME5      = 0x165667B1UL;
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint32_t round(uint32_t accumulator, uint32_t input)
+      {
+        accumulator += input * PRIME2;
+        accumulator  = etl::rotate_left(accumulator, 13U);
+        accumulator *= PRIME1;
+
+        return accumulator;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 void add_stripe(const uint8_t* p)
+      {
+        v1 = round(v1, read32(p));
+        v2 = round(v2, read32(p + 4U));
+        v3 = round(v3, read32(p + 8U));
+        v4 = round(v4, read32(p + 12U));
+      }
+
+      uint32_t seed;
+      size_t   total_length;
+      size_t   buffer_size;
+      uint32_t v1;
+      uint32_t v2;
+      uint32_t v3;
+      uint32_t v4;
+      uint8_t  buffer[Stripe_Size];
+    };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// The xxHash64 state.
+    //*************************************************************************
+    class xxhash64_state
+    {
+    public:
+
+      //***********************************
+      ETL_CONSTEXPR14 explicit xxhash64_state(uint64_t seed_)
+        : seed(seed_)
+        , total_length(0U)
+        , buffer_size(0U)
+        , v1(seed_ + PRIME1 + PRIME2)
+        , v2(seed_ + PRIME2)
+        , v3(seed_)
+        , v4(seed_ - PRIME1)
+        , buffer()
+      {
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 void add(uint8_t value)
+      {
+        buffer[buffer_size++] = value;
+        ++total_length;
+
+        if (buffer_size == Stripe_Size)
+        {
+          add_stripe(buffer);
+          buffer_size = 0U;
+        }
+      }
+
+      //***********************************
+      /// Adds a contiguous block, hashing whole stripes in place.
+      //***********************************
+      ETL_CONSTEXPR14 void add(const uint8_t* p_data, size_t length)
+      {
+        // Complete a partially filled buffer.
+        while ((buffer_size != 0U) && (length != 0U))
+        {
+          add(*p_data++);
+          --length;
+        }
+
+        total_length += length;
+
+        while (length >= Stripe_Size)
+        {
+          add_stripe(p_data);
+          p_data += Stripe_Size;
+          length -= Stripe_Size;
+        }
+
+        while (length != 0U)
+        {
+          buffer[buffer_size++] = *p_data++;
+          --length;
+        }
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 uint64_t value() const
+      {
+        uint64_t hash = seed + PRIME5;
+
+        if (total_length >= Stripe_Size)
+        {
+          hash = etl::rotate_left(v1, 1U)  + etl::rotate_left(v2, 7U) +
+                 etl::rotate_left(v3, 12U) + etl::rotate_left(v4, 18U);
+
+          hash = merge_round(hash, v1);
+          hash = merge_round(hash, v2);
+          hash = merge_round(hash, v3);
+          hash = merge_round(hash, v4);
+        }
+
+        hash += uint64_t(total_length);
+
+        size_t i = 0U;
+
+        while ((i + 8U) <= buffer_size)
+        {
+          hash ^= round(0U, read64(buffer + i));
+          hash  = (etl::rotate_left(hash, 27U) * PRIME1) + PRIME4;
+          i += 8U;
+        }
+
+        if ((i + 4U) <= buffer_size)
+        {
+          hash ^= uint64_t(read32(buffer + i)) * PRIME1;
+          hash  = (etl::rotate_left(hash, 23U) * PRIME2) + PRIME3;
+          i += 4U;
+        }
+
+        while (i < buffer_size)
+        {
+          hash ^= buffer[i] * PRIME5;
+          hash  = etl::rotate_left(hash, 11U) * PRIME1;
+          ++i;
+        }
+
+        hash ^= hash >> 33U;
+        hash *= PRIME2;
+        hash ^= hash >> 29U;
+        hash *= PRIME3;
+        hash ^= hash >> 32U;
+
+        return hash;
+      }
+
+    private:
+
+      static ETL_CONSTANT size_t   Stripe_Size = 32U;
+      static ETL_CONSTANT uint64_t PRIME1      = 0x9E3779B185EBCA87ULL;
+      static ETL_CONSTANT uint64_t PRIME2      = 0xC2B2AE3D27D4EB4FULL;
+      static ETL_CONSTANT uint64_t PRIME3      = 0x165667B19E3779F9ULL;
+      static ETL_CONSTANT uint64_t PRIME4      = 0x85EBCA77C2B2AE63ULL;
+      static ETL_CONSTANT uint64_t PRIME5      = 0x27D4EB2F165667C5ULL;
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint64_t round(uint64_t accumulator, uint64_t input)
+      {
+        accumulator += input * PRIME2;
+        accumulator  = etl::rotate_left(accumulator, 31U);
+        accumulator *= PRIME1;
+
+        return accumulator;
+      }
+
+      //***********************************
+      static ETL_CONSTEXPR14 uint64_t merge_round(uint64_t hash, uint64_t accumulator)
+      {
+        hash ^= round(0U, accumulator);
+        hash  = (hash * PRIME1) + PRIME4;
+
+        return hash;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 void add_stripe(const uint8_t* p)
+      {
+        v1 = round(v1, read64(p));
+        v2 = round(v2, read64(p + 8U));
+        v3 = round(v3, read64(p + 16U));
+        v4 = round(v4, read64(p + 24U));
+      }
+
+      uint64_t seed;
+      size_t   total_length;
+      size_t   buffer_size;
+      uint64_t v1;
+      uint64_t v2;
+      uint64_t v3;
+      uint64_t v4;
+      uint8_t  buffer[Stripe_Size];
+    };
+#endif
+
+    //*************************************************************************
+    /// Common streaming interface for the xxHash variants.
+    //*************************************************************************
+    template <typename TState, typename THash>
+    class xxhash_base
+    {
+    public:
+
+      typedef THash value_type;
+
+      //*************************************************************************
+      /// Resets the hash to the initial state.
+      //*************************************************************************
+      void reset()
+      {
+        state = TState(seed);
+      }
+
+      //*************************************************************************
+      /// Adds a range.
+      /// Contiguous ranges are hashed a stripe at a time.
+      /// \param begin
+      /// \param end
+      //*************************************************************************
+      template<typename TIterator>
+      void add(TIterator begin, const TIterator end)
+      {
+        ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+        add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+      }
+
+      //*************************************************************************
+      /// Adds a uint8_t value.
+      /// \param value The char to add to the hash.
+      //*************************************************************************
+      void add(uint8_t value_)
+      {
+        state.add(value_);
+      }
+
+      //*************************************************************************
+      /// Gets the hash value.
+      /// More data may be added after reading the value.
+      //*************************************************************************
+      value_type value() const
+      {
+        return state.value();
+      }
+
+      //*************************************************************************
+      /// Conversion operator to value_type.
+      //*************************************************************************
+      operator value_type () const
+      {
+        return value();
+      }
+
+    protected:
+
+      //*************************************************************************
+      xxhash_base(value_type seed_)
+        : seed(seed_)
+        , state(seed_)
+      {
+      }
+
+    private:
+
+      //*************************************************************************
+      template<typename TIterator>
+      void add_range(TIterator begin, const TIterator end, etl::false_type)
+      {
+        while (begin != end)
+        {
+          state.add(uint8_t(*begin));
+          ++begin;
+        }
+      }
+
+      //*************************************************************************
+      template<typename TIterator>
+      void add_range(TIterator begin, const TIterator end, etl::true_type)
+      {
+        state.add(reinterpret_cast<const uint8_t*>(begin), size_t(end - begin));
+      }
+
+      value_type seed;
+      TState     state;
+    };
+  }
+
+  //***************************************************************************
+  /// Calculates the xxHash32 hash.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash32 : public private_xxhash::xxhash_base<private_xxhash::xxhash32_state, uint32_t>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    xxhash32(value_type seed_ = 0U)
+      : xxhash_base(seed_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash32(TIterator begin, const TIterator end, value_type seed_ = 0U)
+      : xxhash_base(seed_)
+    {
+      this->add(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates the xxHash32 hash of a range.
+  /// constexpr from C++14, allowing compile time hashing of strings.
+  ///\ingroup xxhash
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR14 uint32_t xxhash32_calculate(TIterator begin, const TIterator end, uint32_t seed = 0U)
+  {
+    private_xxhash::xxhash32_state state(seed);
+
+    while (begin != end)
+    {
+      state.add(uint8_t(*begin));
+      ++begin;
+    }
+
+    return state.value();
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Calculates the xxHash64 hash.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash64 : public private_xxhash::xxhash_base<private_xxhash::xxhash64_state, uint64_t>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    xxhash64(value_type seed_ = 0U)
+      : xxhash_base(seed_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash64(TIterator begin, const TIterator end, value_type seed_ = 0U)
+      : xxhash_base(seed_)
+    {
+      this->add(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates the xxHash64 hash of a range.
+  /// constexpr from C++14, allowing compile time hashing of strings.
+  ///\ingroup xxhash
+  //***************************************************************************
+  template <typename TIterator>
+  ETL_CONSTEXPR14 uint64_t xxhash64_calculate(TIterator begin, const TIterator end, uint64_t seed = 0U)
+  {
+    private_xxhash::xxhash64_state state(seed);
+
+    while (begin != end)
+    {
+      state.add(uint8_t(*begin));
+      ++begin;
+    }
+
+    return state.value();
+  }
+#endif
+}
+
+#endif